@@ -3,29 +3,12 @@
 #include "kheap.h"
 #include "isr.h"
 #include "pci.h"
+#include "apic.h"
 #include "ethernet.h"
-
-uint16 checksum(uint8 *addr, uint count)
-{
-  register uint sum = 0;
-
-  // Main summing loop
-  while(count > 1)
-  {
-    sum = sum + (*((uint16 *) addr))++;
-    count = count - 2;
-  }
-
-  // Add left-over byte, if any
-  if (count > 0)
-    sum = sum + *((uint8 *) addr);
-
-  // Fold 32-bit sum to 16 bits
-  while (sum>>16)
-    sum = (sum & 0xFFFF) + (sum >> 16);
-
-  return(~sum);
-}
+#include "packet.h"
+#include "e1000.h"
+#include "spinlock.h"
+#include "process.h"
 
 typedef unsigned long long uint64;
 
@@ -36,14 +19,13 @@ typedef struct __attribute__ ((__packed__))
   uint16 type;             /* packet type ID field */
 } EthernetPacket;
 
-#define NUM_RX_DESC 16
-#define NUM_TX_DESC 16
-
 #define REG_CTRL        0x0000
 #define REG_STATUS      0x0008
 #define REG_EEPROM      0x0014
 #define REG_CTRL_EXT    0x0018
+#define REG_ICR         0x00C0
 #define REG_IMASK       0x00D0
+#define REG_IMASKCLR    0x00D8
 #define REG_RCTRL       0x0100
 #define REG_RXDESCLO    0x2800
 #define REG_RXDESCHI    0x2804
@@ -58,6 +40,28 @@ typedef struct __attribute__ ((__packed__))
 #define REG_TXDESCHEAD  0x3810
 #define REG_TXDESCTAIL  0x3818
 
+// Interrupt moderation
+#define REG_ITR         0x00C4      // Interrupt Throttling (256ns units)
+#define REG_RDTR        0x2820      // RX Delay Timer (1.024us units)
+#define REG_RADV        0x282C      // RX Absolute Delay
+#define REG_TIDV        0x3820      // TX Interrupt Delay
+#define REG_TADV        0x382C      // TX Absolute Delay
+
+#define REG_RXCSUM      0x5000      // Receive Checksum Control
+#define RXCSUM_IPOFLD   (1 << 8)    // IP checksum off-load
+#define RXCSUM_TUOFLD   (1 << 9)    // TCP/UDP checksum off-load
+
+// Receive address / multicast filters
+#define REG_MTA         0x5200      // Multicast Table Array, 128 registers
+#define REG_RAL         0x5400      // Receive Address Low, 16 pairs of registers
+#define REG_RAH         0x5404      // Receive Address High
+#define RAH_AV          (1u << 31)  // Address Valid
+#define E1000_NB_RAR    16
+
+// Statistics, cleared when read
+#define REG_MPC         0x4010      // Missed Packets
+#define REG_RNBC        0x40A0      // Receive No Buffers
+
 #define RCTRL_EN 	0x00000002
 #define RCTRL_SBP 	0x00000004
 #define RCTRL_UPE 	0x00000008
@@ -100,8 +104,10 @@ typedef struct __attribute__ ((__packed__))
 #define CMD_EOP                         (1 << 0)    // End of Packet
 #define CMD_IFCS                        (1 << 1)    // Insert FCS
 #define CMD_IC                          (1 << 2)    // Insert Checksum
+#define CMD_TSE                         (1 << 2)    // TCP Segmentation Enable (extended descriptors)
 #define CMD_RS                          (1 << 3)    // Report Status
 #define CMD_RPS                         (1 << 4)    // Report Packet Sent
+#define CMD_DEXT                        (1 << 5)    // Descriptor Extension
 #define CMD_VLE                         (1 << 6)    // VLAN Packet Enable
 #define CMD_IDE                         (1 << 7)    // Interrupt Delay Enable
 
@@ -112,6 +118,28 @@ typedef struct __attribute__ ((__packed__))
 #define TCTL_SWXOFF                     (1 << 22)   // Software XOFF Transmission
 #define TCTL_RTLC                       (1 << 24)   // Re-transmit on Late Collision
  
+#define ICR_TXDW                        (1 << 0)    // Transmit Descriptor Written Back
+#define ICR_TXQE                        (1 << 1)    // Transmit Queue Empty
+#define ICR_RXDMT0                      (1 << 4)    // Receive Descriptor Minimum Threshold
+#define ICR_RXO                         (1 << 6)    // Receiver Overrun
+#define ICR_RXT0                        (1 << 7)    // Receiver Timer Interrupt
+#define ICR_RX                          (ICR_RXDMT0 | ICR_RXO | ICR_RXT0)
+
+// The extended descriptors (DEXT): context and data
+#define DTYP_CONTEXT                    (0 << 20)
+#define DTYP_DATA                       (1 << 20)
+#define TUCMD_TCP                       (1 << 0)    // The context is for TCP, UDP otherwise
+#define TUCMD_IP                        (1 << 1)    // IPv4
+#define TUCMD_TSE                       (1 << 2)    // TCP Segmentation Enable
+#define POPTS_IXSM                      (1 << 0)    // Insert the IP checksum
+#define POPTS_TXSM                      (1 << 1)    // Insert the TCP/UDP checksum
+
+#define RSTA_IXSM                       (1 << 2)    // Ignore the checksum indications
+#define RSTA_TCPCS                      (1 << 5)    // TCP/UDP checksum computed
+#define RSTA_IPCS                       (1 << 6)    // IP checksum computed
+#define RERR_TCPE                       (1 << 5)    // TCP/UDP checksum error
+#define RERR_IPE                        (1 << 6)    // IP checksum error
+
 #define TSTA_DD                         (1 << 0)    // Descriptor Done
 #define TSTA_EC                         (1 << 1)    // Excess Collisions
 #define TSTA_LC                         (1 << 2)    // Late Collision
@@ -137,14 +165,45 @@ typedef struct __attribute__((packed)) {
 	uint16 special;
 }  E1000TxDesc;
 
+// Tells the NIC where the headers are in the packets which follow: the
+// checksum of the bytes from CSS to CSE (0: the end) goes at CSO
+typedef struct __attribute__((packed)) {
+	uint8 IPCSS;
+	uint8 IPCSO;
+	uint16 IPCSE;
+	uint8 TUCSS;
+	uint8 TUCSO;
+	uint16 TUCSE;
+	uint type;						// PAYLEN (20 bits), DTYP, TUCMD
+	uint8 status;
+	uint8 header_length;
+	uint16 MSS;
+} E1000TxContextDesc;
+
 typedef struct {
 	unsigned char MAC[6];
 	unsigned char router_MAC[6];
 	unsigned char *pci_bar_mem;
 	E1000TxDesc *tx_descs;
 	E1000RxDesc *rx_descs;
+	uint rx_size;
+	uint tx_size;
 	uint rx_cur;
-	uint tx_cur;
+	PacketBuffer **rx_buffers;		// The buffers the NIC receives in
+	uint tx_cur;					// Next descriptor to fill
+	uint tx_clean;					// Oldest descriptor the NIC may not be done with
+	PacketBuffer **tx_buffers;		// On the last descriptor of each packet
+	uint tx_context;				// The offsets of the last context descriptor, 0 for none
+	Spinlock rx_lock;
+	Spinlock tx_lock;
+	E1000RingStats rx_stats;
+	E1000RingStats tx_stats;
+	E1000Moderation moderation;
+	uint8 multicast[E1000_MAX_MULTICAST][6];	// The groups we receive
+	uint nb_multicast;
+	uint8 promiscuous;
+	Process *poll_process;			// Receives when the RX interrupts are masked
+	E1000PollStats poll_stats;
 } EthernetAdapter;
 
 EthernetAdapter E1000_adapter;
@@ -168,86 +227,290 @@ void E1000_enable_interrupt()
  
 }
 
-uint flag = 0;
-uint flag_FF = 0, flag_me = 0, flag_router = 0;
+static void E1000_disable_interrupt()
+{
+    E1000_write_command(REG_IMASKCLR, 0xFFFFFFFF);
+    E1000_read_command(REG_ICR);
+}
+
+static int E1000_rx_pending() {
+    return E1000_adapter.rx_descs && (E1000_adapter.rx_descs[E1000_adapter.rx_cur].status & 0x1);
+}
+
+// What the NIC has verified (with RXCSUM). A wrong checksum is left to the
+// stack to find, which counts and drops the packet
+static void E1000_rx_checksum(PacketBuffer *pb, E1000RxDesc *desc) {
+    if (desc->status & RSTA_IXSM) return;
 
-void E1000_handle_receive(registers_t regs) {
-	uint status = E1000_read_command(0xc0);
+    if ((desc->status & RSTA_IPCS) && !(desc->errors & RERR_IPE)) pb->checksum |= PACKET_CSUM_IP_OK;
+    if ((desc->status & RSTA_TCPCS) && !(desc->errors & RERR_TCPE)) pb->checksum |= PACKET_CSUM_L4_OK;
+}
 
+// Passes at most budget frames to the network stack, returns how many
+// there were. Called with the RX lock held
+static uint E1000_handle_receive(uint budget) {
     uint16 old_cur;
-    uint8 got_packet = 0;
+    uint nb_frames = 0;
 
-    while((E1000_adapter.rx_descs[E1000_adapter.rx_cur].status & 0x1))
+    while(nb_frames < budget && E1000_rx_pending())
     {
-            got_packet = 1;
-            uint8 *buf = (uint8 *)(uint)(E1000_adapter.rx_descs[E1000_adapter.rx_cur].addr);
+            nb_frames++;
+            PacketBuffer *pb = E1000_adapter.rx_buffers[E1000_adapter.rx_cur];
             uint16 len = E1000_adapter.rx_descs[E1000_adapter.rx_cur].length;
- 
-            // Here you should inject the received packet into your network stack
-//		    if (!flag) dump_mem(buf, 14, 280);
-//	            if (flag < 10) printf("Received %x\n", buf);*/
-
-            if (buf[0] == E1000_adapter.MAC[0] &&
-            	buf[1] == E1000_adapter.MAC[1] &&
-            	buf[2] == E1000_adapter.MAC[2] &&
-            	buf[3] == E1000_adapter.MAC[3] &&
-            	buf[4] == E1000_adapter.MAC[4] &&
-            	buf[5] == E1000_adapter.MAC[5]) flag_me++;
-
-            if (buf[0] == 0xFF &&
-            	buf[1] == 0xFF &&
-            	buf[2] == 0xFF &&
-            	buf[3] == 0xFF &&
-            	buf[4] == 0xFF &&
-            	buf[5] == 0xFF) flag_FF++;
-
-            if ((buf[0] == E1000_adapter.MAC[0] &&
-            	buf[1] == E1000_adapter.MAC[1] &&
-            	buf[2] == E1000_adapter.MAC[2] &&
-            	buf[3] == E1000_adapter.MAC[3] &&
-            	buf[4] == E1000_adapter.MAC[4] &&
-            	buf[5] == E1000_adapter.MAC[5]) ||
-            	(buf[0] == 0xFA &&
-            	buf[1] == 0xFF &&
-            	buf[2] == 0xFF &&
-            	buf[3] == 0xFF &&
-            	buf[4] == 0xFF &&
-            	buf[5] == 0xFF)
-               ) {
-//	            printf("%X:%X:%X:%X:%X:%X => %x\n", buf[0], buf[1], buf[2], buf[3], buf[4], buf[5], buf);
-//	        	dump_mem(buf, 320, 14);
-	        	ethernet_receive_packet(buf, len);
-	    	}
-
-/*	    	draw_ptr(flag_me, 0, 0);
-	    	draw_ptr(flag_FF, 400, 0);
-	    	draw_hex2(buf[0], 30*8, 0);
-	    	draw_hex2(buf[1], 33*8, 0);
-	    	draw_hex2(buf[2], 36*8, 0);
-	    	draw_hex2(buf[3], 39*8, 0);
-	    	draw_hex2(buf[4], 42*8, 0);
-	    	draw_hex2(buf[5], 45*8, 0);
-*/
+
+            // The buffer goes up the stack and the descriptor gets a new one.
+            // If the pool is empty, we drop the frame and reuse the buffer
+            PacketBuffer *new_pb = packet_alloc(0);
+            if (new_pb) {
+                E1000_adapter.rx_buffers[E1000_adapter.rx_cur] = new_pb;
+                E1000_adapter.rx_descs[E1000_adapter.rx_cur].addr = (uint64)(uint)new_pb->data;
+                packet_put(pb, len);
+                E1000_rx_checksum(pb, &E1000_adapter.rx_descs[E1000_adapter.rx_cur]);
+                E1000_adapter.rx_stats.packets++;
+                E1000_adapter.rx_stats.bytes += len;
+
+                // The NIC only keeps the frames for us (see E1000_write_filters())
+                ethernet_receive_packet(pb);
+                packet_free(pb);
+            }
+            else E1000_adapter.rx_stats.dropped++;
+
        	    E1000_adapter.rx_descs[E1000_adapter.rx_cur].status = 0;
 			old_cur = E1000_adapter.rx_cur;
-			E1000_adapter.rx_cur = (E1000_adapter.rx_cur + 1) % NUM_RX_DESC;
+			E1000_adapter.rx_cur = (E1000_adapter.rx_cur + 1) % E1000_adapter.rx_size;
 			E1000_write_command(REG_RXDESCTAIL, old_cur);
-    }    	
+    }
+
+    // How full the ring was: the frames waiting for us in this pass
+    E1000_adapter.rx_stats.in_use = nb_frames;
+    if (nb_frames > E1000_adapter.rx_stats.max_in_use) E1000_adapter.rx_stats.max_in_use = nb_frames;
+
+    return nb_frames;
+}
+
+// Frees the buffers of the packets the NIC has sent. Called with the TX
+// lock held
+static void E1000_tx_reap() {
+	while (E1000_adapter.tx_clean != E1000_adapter.tx_cur &&
+		   (E1000_adapter.tx_descs[E1000_adapter.tx_clean].status & TSTA_DD)) {
+
+		PacketBuffer *pb = E1000_adapter.tx_buffers[E1000_adapter.tx_clean];
+		if (pb) {
+			E1000_adapter.tx_buffers[E1000_adapter.tx_clean] = 0;
+			packet_free(pb);
+		}
+
+		E1000_adapter.tx_clean = (E1000_adapter.tx_clean + 1) % E1000_adapter.tx_size;
+	}
+}
+
+void E1000_handle_interrupt(registers_t *regs) {
+	// Reading ICR acknowledges the interrupt
+	uint status = E1000_read_command(REG_ICR);
+
+	if (status & (ICR_TXDW | ICR_TXQE)) {
+		spinlock_lock(&E1000_adapter.tx_lock);
+		if (E1000_adapter.tx_descs) E1000_tx_reap();
+		spinlock_unlock(&E1000_adapter.tx_lock);
+	}
+
+	// With a poll budget, the first RX interrupt masks the next ones and
+	// wakes up the poll process. Otherwise we receive everything right here
+	Process *ps = E1000_adapter.poll_process;
+	if (ps && E1000_adapter.poll_stats.budget) {
+		if (status & ICR_RX) {
+			E1000_write_command(REG_IMASKCLR, ICR_RX);
+			E1000_adapter.poll_stats.interrupts++;
+			__sync_fetch_and_and(&ps->flags, ~PROCESS_POLLING);
+		}
+		return;
+	}
+
+	spinlock_lock(&E1000_adapter.rx_lock);
+	E1000_handle_receive(~0u);
+	spinlock_unlock(&E1000_adapter.rx_lock);
+}
+
+// The poll process. Each pass hands at most a budget of frames to the
+// network stack (with the interrupts off, like the interrupt handler
+// does), then lets the other processes run. When the ring is empty, the
+// RX interrupts come back and the process waits for the next one. Under
+// a flood the NIC drops the frames we can't keep up with instead of
+// interrupting us for each of them
+static void E1000_poll() {
+	Process *ps = (Process*)current_process;
+
+	for (;;) {
+		uint budget = E1000_adapter.poll_stats.budget;
+		uint eflags = spinlock_lock_irqsave(&E1000_adapter.rx_lock);
+		uint nb_frames = E1000_handle_receive(budget ? budget : ~0u);
+		spinlock_unlock_irqrestore(&E1000_adapter.rx_lock, eflags);
+
+		E1000_adapter.poll_stats.polls++;
+
+		if (budget && nb_frames >= budget) E1000_adapter.poll_stats.exhausted++;
+		else {
+			// The flag is set before the interrupts are unmasked so that the
+			// handler can't wake us up before we sleep. A frame which came
+			// after the last pass may have had its interrupt acknowledged
+			// by a TX one, so we check the ring once more
+			__sync_fetch_and_or(&ps->flags, PROCESS_POLLING);
+			E1000_write_command(REG_IMASK, ICR_RX);
+			if (E1000_rx_pending()) __sync_fetch_and_and(&ps->flags, ~PROCESS_POLLING);
+		}
+
+		switch_process();
+	}
+}
+
+// Starts the poll process, which needs the scheduler. Until then the frames
+// are received in the interrupt handler. The IOAPIC sends the interrupt to
+// the BSP, so the process runs there: an AP would only see it was woken up
+// at its next timer tick
+void E1000_start_polling() {
+	if (!E1000_adapter.pci_bar_mem || E1000_adapter.poll_process) return;
+
+	E1000_adapter.poll_process = start_kernel_process(E1000_poll, cpu_get(0));
+}
+
+// The number of frames per poll pass, 0 to receive in the interrupt handler
+void E1000_set_poll_budget(uint budget) {
+	E1000_adapter.poll_stats.budget = budget;
+
+	// Back to the interrupts, the poll process may still be waiting for one
+	if (!budget && E1000_adapter.pci_bar_mem) E1000_write_command(REG_IMASK, ICR_RX);
+}
+
+E1000PollStats *E1000_get_poll_stats() {
+	return &E1000_adapter.poll_stats;
+}
+
+static uint E1000_rctl() {
+	uint rctl = RCTL_EN | RCTL_LBM_NONE | RTCL_RDMTS_HALF | RCTL_MO_36 | RCTL_BAM | RCTL_SECRC | RCTL_BSIZE_2048;
+	if (E1000_adapter.promiscuous) rctl |= RCTL_UPE | RCTL_MPE;
+	return rctl;
+}
+
+// The 12 bits of the address the Multicast Table Array is indexed with
+// (RCTL.MO = 0: bits 47:36)
+static uint E1000_multicast_hash(const uint8 *MAC) {
+	return ((MAC[4] >> 4) | ((uint)MAC[5] << 4)) & 0xFFF;
+}
+
+static void E1000_write_address(uint index, const uint8 *MAC) {
+	if (!MAC) {
+		E1000_write_command(REG_RAH + index * 8, 0);
+		return;
+	}
+
+	E1000_write_command(REG_RAL + index * 8, MAC[0] | (MAC[1] << 8) | (MAC[2] << 16) | ((uint)MAC[3] << 24));
+	E1000_write_command(REG_RAH + index * 8, MAC[4] | (MAC[5] << 8) | RAH_AV);
+}
+
+// Programs the receive filters: our MAC in the first Receive Address
+// register, the first multicast groups in the other ones (exact matches)
+// and the rest in the hash table. The broadcasts are accepted (RCTL.BAM),
+// everything else is dropped by the NIC unless we are promiscuous
+static void E1000_write_filters() {
+	uint MTA[128];
+	memset(MTA, 0, sizeof(MTA));
+
+	E1000_write_address(0, E1000_adapter.MAC);
+	for (uint i=1; i<E1000_NB_RAR; i++)
+		E1000_write_address(i, i - 1 < E1000_adapter.nb_multicast ? E1000_adapter.multicast[i-1] : 0);
+
+	for (uint i=E1000_NB_RAR-1; i<E1000_adapter.nb_multicast; i++) {
+		uint hash = E1000_multicast_hash(E1000_adapter.multicast[i]);
+		MTA[hash >> 5] |= 1 << (hash & 0x1F);
+	}
+	for (uint i=0; i<128; i++) E1000_write_command(REG_MTA + i * 4, MTA[i]);
+
+	if (E1000_adapter.rx_size) E1000_write_command(REG_RCTRL, E1000_rctl());
+}
+
+static int E1000_find_multicast(const uint8 *MAC) {
+	for (uint i=0; i<E1000_adapter.nb_multicast; i++) {
+		uint j = 0;
+		while (j < 6 && E1000_adapter.multicast[i][j] == MAC[j]) j++;
+		if (j == 6) return i;
+	}
+	return -1;
+}
+
+// Receives the frames sent to a multicast group (the address has its
+// lowest bit set). Returns 0 if there are too many groups
+int E1000_add_multicast(const uint8 *MAC) {
+	if (!(MAC[0] & 1)) return 0;
+
+	uint eflags = spinlock_lock_irqsave(&E1000_adapter.rx_lock);
+	int ok = 1;
+
+	if (E1000_find_multicast(MAC) < 0) {
+		if (E1000_adapter.nb_multicast < E1000_MAX_MULTICAST) {
+			memcpy(E1000_adapter.multicast[E1000_adapter.nb_multicast++], MAC, 6);
+			if (E1000_adapter.pci_bar_mem) E1000_write_filters();
+		}
+		else ok = 0;
+	}
+
+	spinlock_unlock_irqrestore(&E1000_adapter.rx_lock, eflags);
+	return ok;
+}
+
+void E1000_remove_multicast(const uint8 *MAC) {
+	uint eflags = spinlock_lock_irqsave(&E1000_adapter.rx_lock);
+
+	int i = E1000_find_multicast(MAC);
+	if (i >= 0) {
+		E1000_adapter.nb_multicast--;
+		memcpy(E1000_adapter.multicast[i], E1000_adapter.multicast[E1000_adapter.nb_multicast], 6);
+		if (E1000_adapter.pci_bar_mem) E1000_write_filters();
+	}
+
+	spinlock_unlock_irqrestore(&E1000_adapter.rx_lock, eflags);
+}
+
+// Receives every frame on the wire, for debugging
+void E1000_set_promiscuous(uint8 promiscuous) {
+	uint eflags = spinlock_lock_irqsave(&E1000_adapter.rx_lock);
+
+	E1000_adapter.promiscuous = promiscuous;
+	if (E1000_adapter.pci_bar_mem) E1000_write_filters();
+
+	spinlock_unlock_irqrestore(&E1000_adapter.rx_lock, eflags);
+}
+
+uint8 E1000_get_promiscuous() {
+	return E1000_adapter.promiscuous;
+}
+
+// The descriptor rings are in pages (physically contiguous), 16 bytes per
+// descriptor
+static void *E1000_alloc_ring(uint nb_descs, const char *name) {
+	uint nb_pages = (nb_descs * 16 + 0xFFF) / 0x1000;
+	void *ring = kmalloc_pages(nb_pages, name);
+	if (ring) memset(ring, 0, nb_pages * 0x1000);
+	return ring;
 }
 
-void E1000_txinit()
+// Returns 0 if the ring can't be allocated
+int E1000_txinit()
 {
-	uint *ptr;
-	
-//	ptr = (uint *)(kmalloc(sizeof(E1000TxDesc)*NUM_TX_DESC + 16));
-//	e->tx_free = (uint8_t *)ptr;
-//	if (ptr % 16 != 0)
-//		ptr = (ptr + 16) - (ptr % 16);
-	E1000_adapter.tx_descs = (E1000TxDesc *)kmalloc_pages(1, "Ethernet Transmission Packets");
-
-	for(int i = 0; i < NUM_TX_DESC; i++)
+	uint size = E1000_adapter.tx_size;
+
+	E1000_adapter.tx_descs = (E1000TxDesc *)E1000_alloc_ring(size, "Ethernet Transmission Packets");
+	E1000_adapter.tx_buffers = (PacketBuffer**)kmalloc(size * sizeof(PacketBuffer*));
+	if (!E1000_adapter.tx_descs || !E1000_adapter.tx_buffers) {
+		if (E1000_adapter.tx_buffers) kfree(E1000_adapter.tx_buffers);
+		if (E1000_adapter.tx_descs) kfree(E1000_adapter.tx_descs);
+		E1000_adapter.tx_descs = 0;
+		return 0;
+	}
+
+	memset(E1000_adapter.tx_buffers, 0, size * sizeof(PacketBuffer*));
+
+	for(int i = 0; i < size; i++)
 	{
-//		e->tx_descs[i] = (struct E1000_tx_desc *)((uintptr_t)descs + i*16);
 		E1000_adapter.tx_descs[i].addr = 0;
 		E1000_adapter.tx_descs[i].cmd = 0;
 		E1000_adapter.tx_descs[i].status = TSTA_DD;
@@ -258,13 +521,15 @@ void E1000_txinit()
 	E1000_write_command(REG_TXDESCHI, 0);
 
 	//now setup total length of descriptors
-	E1000_write_command(REG_TXDESCLEN, NUM_TX_DESC * 16);
+	E1000_write_command(REG_TXDESCLEN, size * 16);
 
 	//setup numbers
 	E1000_write_command(REG_TXDESCHEAD, 0);
 	E1000_write_command(REG_TXDESCTAIL, 0);
-//	e->tx_cur = 0;
 	E1000_adapter.tx_cur = 0;
+	E1000_adapter.tx_clean = 0;
+	E1000_adapter.tx_context = 0;
+	E1000_adapter.tx_stats.size = size;
 	/*
 	E1000_write_command(REG_TCTRL, TCTL_EN
         | TCTL_PSP
@@ -274,53 +539,304 @@ void E1000_txinit()
 */
 	E1000_write_command(REG_TCTRL,  0b0110000000000111111000011111010);
     E1000_write_command(REG_TIPG,  0x0060200A);	
+
+	return 1;
 }
 
-void E1000_rxinit()
+// Returns 0 if the pool doesn't have a buffer for each descriptor
+int E1000_rxinit()
 {
-    uint8 * ptr;
- 
-    // Allocate buffer for receive descriptors. For simplicity, in my case khmalloc returns a virtual address that is identical to it physical mapped address.
-    // In your case you should handle virtual and physical addresses as the addresses passed to the NIC should be physical ones
- 
-    ptr = (uint8 *)kmalloc_pages(1, "Ethernet receive bufferS");
- 
-    E1000_adapter.rx_descs = (E1000RxDesc *)ptr;
-    for(int i = 0; i < NUM_RX_DESC; i++)
+    uint size = E1000_adapter.rx_size;
+
+    E1000_adapter.rx_descs = (E1000RxDesc *)E1000_alloc_ring(size, "Ethernet receive buffers");
+    E1000_adapter.rx_buffers = (PacketBuffer**)kmalloc(size * sizeof(PacketBuffer*));
+    if (!E1000_adapter.rx_descs || !E1000_adapter.rx_buffers) {
+        if (E1000_adapter.rx_buffers) kfree(E1000_adapter.rx_buffers);
+        if (E1000_adapter.rx_descs) kfree(E1000_adapter.rx_descs);
+        E1000_adapter.rx_descs = 0;
+        return 0;
+    }
+
+    for(int i = 0; i < size; i++)
     {
-//        rx_descs[i] = (E1000RxDesc *)((uint8 *)rx_descs + i*16);
-        E1000_adapter.rx_descs[i].addr = (uint64)(uint)(uint8 *)kmalloc_pages(2, "Eth receive buffer");
+        // The buffers are 2KB, like RCTL_BSIZE_2048
+        E1000_adapter.rx_buffers[i] = packet_alloc(0);
+        if (!E1000_adapter.rx_buffers[i]) {
+            while (--i >= 0) packet_free(E1000_adapter.rx_buffers[i]);
+            kfree(E1000_adapter.rx_buffers);
+            kfree(E1000_adapter.rx_descs);
+            E1000_adapter.rx_descs = 0;
+            return 0;
+        }
+
+        E1000_adapter.rx_descs[i].addr = (uint64)(uint)E1000_adapter.rx_buffers[i]->data;
         E1000_adapter.rx_descs[i].status = 0;
     }
- 
-    E1000_write_command(REG_TXDESCLO, (uint)((uint64)(uint)ptr >> 32) );
-    E1000_write_command(REG_TXDESCHI, (uint)((uint64)(uint)ptr & 0xFFFFFFFF));
- 
-    E1000_write_command(REG_RXDESCLO, (uint64)(uint)ptr);
+
+    E1000_write_command(REG_RXDESCLO, (uint)E1000_adapter.rx_descs);
     E1000_write_command(REG_RXDESCHI, 0);
  
-    E1000_write_command(REG_RXDESCLEN, NUM_RX_DESC * 16);
+    E1000_write_command(REG_RXDESCLEN, size * 16);
  
     E1000_write_command(REG_RXDESCHEAD, 0);
-    E1000_write_command(REG_RXDESCTAIL, NUM_RX_DESC-1);
+    E1000_write_command(REG_RXDESCTAIL, size-1);
     E1000_adapter.rx_cur = 0;
-    E1000_write_command(REG_RCTRL, RCTL_EN| RCTL_SBP| RCTL_UPE | RCTL_MPE | RCTL_LBM_NONE | RTCL_RDMTS_HALF | RCTL_BAM | RCTL_SECRC  | RCTL_BSIZE_2048);
- 
+    E1000_adapter.rx_stats.size = size;
+    E1000_write_command(REG_RCTRL, E1000_rctl());
+
+    return 1;
+}
+
+// Stops the NIC and frees the rings, the TX ring once the NIC has sent
+// everything. Called with both locks held and the interrupts masked
+static void E1000_free_rings() {
+	while (E1000_adapter.tx_clean != E1000_adapter.tx_cur) {
+		asm volatile("pause" ::: "memory");
+		E1000_tx_reap();
+	}
+
+	E1000_write_command(REG_RCTRL, 0);
+	E1000_write_command(REG_TCTRL, 0);
+
+	if (E1000_adapter.rx_descs) {
+		for (uint i=0; i<E1000_adapter.rx_size; i++) packet_free(E1000_adapter.rx_buffers[i]);
+		kfree(E1000_adapter.rx_buffers);
+		kfree(E1000_adapter.rx_descs);
+	}
+	if (E1000_adapter.tx_descs) {
+		kfree(E1000_adapter.tx_buffers);
+		kfree(E1000_adapter.tx_descs);
+	}
+}
+
+// The ring sizes must be multiples of 8 (RDLEN and TDLEN are multiples of
+// 128 bytes). Each RX descriptor has a 2KB buffer from the packet pool: if
+// there aren't enough, the RX ring is halved until they fit. The TX ring
+// is halved the same way if it can't be allocated
+static void E1000_init_rings(uint rx_size, uint tx_size) {
+	rx_size = umin(umax(rx_size, 8), E1000_MAX_RING) & ~7;
+	tx_size = umin(umax(tx_size, 8), E1000_MAX_RING) & ~7;
+
+	for (E1000_adapter.tx_size = tx_size; E1000_adapter.tx_size >= 8; E1000_adapter.tx_size = (E1000_adapter.tx_size / 2) & ~7) {
+		if (E1000_txinit()) break;
+	}
+
+	// E1000_send_packet() drops everything without a ring
+	if (E1000_adapter.tx_size < 8) {
+		E1000_adapter.tx_size = 0;
+		printf("e1000: no buffers to send\n");
+	}
+	else if (E1000_adapter.tx_size != tx_size) printf("e1000: only %d TX descriptors\n", E1000_adapter.tx_size);
+
+	for (E1000_adapter.rx_size = rx_size; E1000_adapter.rx_size >= 8; E1000_adapter.rx_size = (E1000_adapter.rx_size / 2) & ~7) {
+		if (E1000_rxinit()) break;
+	}
+
+	if (E1000_adapter.rx_size < 8) {
+		E1000_adapter.rx_size = 0;
+		printf("e1000: no buffers to receive\n");
+	}
+	else if (E1000_adapter.rx_size != rx_size) printf("e1000: only %d RX descriptors\n", E1000_adapter.rx_size);
+}
+
+// Changes the number of descriptors of the rings, the packets in flight
+// are sent first and the frames not received yet are lost
+void E1000_resize_rings(uint rx_size, uint tx_size) {
+	if (!E1000_adapter.pci_bar_mem) return;
+
+	uint eflags = spinlock_lock_irqsave(&E1000_adapter.rx_lock);
+	spinlock_lock(&E1000_adapter.tx_lock);
+	E1000_disable_interrupt();
+
+	E1000_free_rings();
+	E1000_init_rings(rx_size, tx_size);
+	E1000_adapter.rx_stats.max_in_use = 0;
+	E1000_adapter.tx_stats.max_in_use = 0;
+
+	E1000_enable_interrupt();
+	spinlock_unlock(&E1000_adapter.tx_lock);
+	spinlock_unlock_irqrestore(&E1000_adapter.rx_lock, eflags);
+}
+
+// The delays are in microseconds, the NIC counts in units of 256ns (ITR) and
+// 1.024us (the other timers). With ITR, the NIC raises at most ITR_hz
+// interrupts per second whatever the traffic. RDTR waits for the link to
+// be idle before the RX interrupt, and RADV bounds that wait
+void E1000_set_moderation(E1000Moderation *moderation) {
+	E1000_adapter.moderation = *moderation;
+	if (!E1000_adapter.pci_bar_mem) return;
+
+	uint ITR = moderation->ITR_hz ? 1000000000 / (moderation->ITR_hz * 256) : 0;
+	E1000_write_command(REG_ITR, umin(ITR, 0xFFFF));
+	E1000_write_command(REG_RDTR, umin(moderation->RDTR_us * 1000 / 1024, 0xFFFF));
+	E1000_write_command(REG_RADV, umin(moderation->RADV_us * 1000 / 1024, 0xFFFF));
+	E1000_write_command(REG_TIDV, umin(moderation->TIDV_us * 1000 / 1024, 0xFFFF));
+	E1000_write_command(REG_TADV, umin(moderation->TADV_us * 1000 / 1024, 0xFFFF));
+}
+
+// The NIC verifies the IPv4, TCP and UDP checksums of the frames it
+// receives (see E1000_rx_checksum())
+void E1000_set_RX_checksum(uint8 enabled) {
+	if (!E1000_adapter.pci_bar_mem) return;
+	E1000_write_command(REG_RXCSUM, enabled ? RXCSUM_IPOFLD | RXCSUM_TUOFLD : 0);
+}
+
+E1000Moderation *E1000_get_moderation() {
+	return &E1000_adapter.moderation;
+}
+
+E1000RingStats *E1000_get_RX_stats() {
+	// The NIC counts the frames it had no descriptor for
+	if (E1000_adapter.pci_bar_mem) {
+		E1000_adapter.rx_stats.missed += E1000_read_command(REG_MPC);
+		E1000_adapter.rx_stats.ring_full += E1000_read_command(REG_RNBC);
+	}
+	return &E1000_adapter.rx_stats;
+}
+
+E1000RingStats *E1000_get_TX_stats() {
+	return &E1000_adapter.tx_stats;
+}
+
+static uint E1000_tx_free_descs() {
+	return (E1000_adapter.tx_clean + E1000_adapter.tx_size - E1000_adapter.tx_cur - 1) % E1000_adapter.tx_size;
+}
+
+// The offsets of the context descriptor the checksum flags of a packet
+// need, 0 if the NIC has nothing to compute. The headers are in the first
+// buffer: Ethernet, then IPv4 with its IHL
+static uint E1000_tx_context_offsets(PacketBuffer *pb, uint8 *popts) {
+	*popts = 0;
+	if (!(pb->checksum & (PACKET_CSUM_IP | PACKET_CSUM_TCP | PACKET_CSUM_UDP))) return 0;
+
+	uint IP_end = 14 + (pb->data[14] & 0xF) * 4;
+	uint L4_checksum = IP_end + (pb->checksum & PACKET_CSUM_TCP ? 16 : 6);
+
+	if (pb->checksum & PACKET_CSUM_IP) *popts |= POPTS_IXSM;
+	if (pb->checksum & (PACKET_CSUM_TCP | PACKET_CSUM_UDP)) *popts |= POPTS_TXSM;
+
+	return (1 << 24) | ((pb->checksum & PACKET_CSUM_TCP) ? 1 << 16 : 0) | (IP_end << 8) | L4_checksum;
+}
+
+// Puts a context descriptor in the ring. It stays valid for the next
+// packets, so we only send one when the headers change (e.g. TCP to UDP).
+// With TSO, it also tells the NIC how to cut the packet: the headers are
+// copied in front of each segment, with the lengths, sequence numbers and
+// checksums updated
+static void E1000_tx_context(uint offsets, PacketBuffer *pb) {
+	E1000TxContextDesc *desc = (E1000TxContextDesc*)&E1000_adapter.tx_descs[E1000_adapter.tx_cur];
+	uint IP_end = (offsets >> 8) & 0xFF;
+	uint TUCMD = CMD_DEXT | CMD_RS | TUCMD_IP | ((offsets >> 16) & 1 ? TUCMD_TCP : 0);
+
+	desc->IPCSS = 14;
+	desc->IPCSO = 14 + 10;
+	desc->IPCSE = IP_end - 1;
+	desc->TUCSS = IP_end;
+	desc->TUCSO = offsets & 0xFF;
+	desc->TUCSE = 0;
+	desc->status = 0;
+
+	if (pb->segment_size) {
+		uint header_length = IP_end + (pb->data[IP_end + 12] >> 4) * 4;
+		desc->type = DTYP_CONTEXT | ((TUCMD | TUCMD_TSE) << 24) | (packet_length(pb) - header_length);
+		desc->header_length = header_length;
+		desc->MSS = pb->segment_size;
+
+		// Only good for this packet
+		E1000_adapter.tx_context = 0;
+	}
+	else {
+		desc->type = DTYP_CONTEXT | (TUCMD << 24);
+		desc->header_length = 0;
+		desc->MSS = 0;
+		E1000_adapter.tx_context = offsets;
+	}
+
+	E1000_adapter.tx_cur = (E1000_adapter.tx_cur + 1) % E1000_adapter.tx_size;
+}
+
+// The most buffers a packet can have: with a context descriptor, it must
+// fit in the TX ring. A larger one is dropped
+uint E1000_tx_max_buffers() {
+	return E1000_adapter.tx_descs ? E1000_adapter.tx_size - 2 : 0;
 }
 
-void E1000_send_packet(uint8 *buffer, uint16 length) {
-	uint packet_addr32 = (uint)buffer;
-	uint64 packet_addr64 = packet_addr32;
+// Queues a packet, one descriptor per chained buffer, and returns without
+// waiting for the NIC. The buffer is freed when the NIC is done with it:
+// on the TX interrupt or on a later send.
+// If the ring is full we wait for the NIC to make room, which is how the
+// senders are slowed down to the speed of the link. Returns 0 if the
+// packet is dropped
+int E1000_send_packet(PacketBuffer *pb) {
+	uint nb_parts = 0;
+	for (PacketBuffer *part = pb; part; part = part->next) nb_parts++;
+
+	uint8 popts;
+	uint offsets = E1000_tx_context_offsets(pb, &popts);
+
+	uint eflags = spinlock_lock_irqsave(&E1000_adapter.tx_lock);
+
+	// The packet, and maybe a context descriptor, must fit in the ring
+	if (!E1000_adapter.tx_descs || nb_parts + 1 >= E1000_adapter.tx_size) {
+		E1000_adapter.tx_stats.dropped++;
+		spinlock_unlock_irqrestore(&E1000_adapter.tx_lock, eflags);
+		packet_free(pb);
+		return 0;
+	}
+
+	uint8 new_context = offsets && (offsets != E1000_adapter.tx_context || pb->segment_size);
+	uint nb_descs = nb_parts + new_context;
 
-	E1000_adapter.tx_descs[E1000_adapter.tx_cur].addr = packet_addr64;
-	E1000_adapter.tx_descs[E1000_adapter.tx_cur].length = length;
-	E1000_adapter.tx_descs[E1000_adapter.tx_cur].cmd = CMD_EOP | CMD_IFCS | CMD_RS | CMD_RPS;
-	E1000_adapter.tx_descs[E1000_adapter.tx_cur].status = 0;
+	E1000_tx_reap();
+	if (E1000_tx_free_descs() < nb_descs) {
+		E1000_adapter.tx_stats.ring_full++;
 
-	uint8 old_cur = E1000_adapter.tx_cur;
-	E1000_adapter.tx_cur = (E1000_adapter.tx_cur + 1) % NUM_TX_DESC;
+		// No need for the interrupt: the NIC sets DD on its own
+		while (E1000_tx_free_descs() < nb_descs) {
+			asm volatile("pause" ::: "memory");
+			E1000_tx_reap();
+		}
+	}
+
+	// With TIDV, the NIC waits a bit before the TX interrupt
+	uint8 delay = E1000_adapter.moderation.TIDV_us ? CMD_IDE : 0;
+
+	// With checksums to compute, the data descriptors are extended ones
+	if (new_context) E1000_tx_context(offsets, pb);
+	uint8 tso = pb->segment_size ? CMD_TSE : 0;
+
+	uint last = E1000_adapter.tx_cur;
+	for (PacketBuffer *part = pb; part; part = part->next) {
+		E1000TxDesc *desc = &E1000_adapter.tx_descs[E1000_adapter.tx_cur];
+		desc->addr = (uint64)(uint)part->data;
+		desc->length = packet_data_length(part);
+		desc->status = 0;
+		if (offsets) {
+			desc->cso = DTYP_DATA >> 16;
+			desc->cmd = CMD_DEXT | CMD_IFCS | CMD_RS | tso | delay | (part->next ? 0 : CMD_EOP);
+			desc->css = popts;
+		} else {
+			desc->cso = 0;
+			desc->cmd = CMD_IFCS | CMD_RS | CMD_RPS | delay | (part->next ? 0 : CMD_EOP);
+			desc->css = 0;
+		}
+
+		E1000_adapter.tx_stats.bytes += desc->length;
+		last = E1000_adapter.tx_cur;
+		E1000_adapter.tx_cur = (E1000_adapter.tx_cur + 1) % E1000_adapter.tx_size;
+	}
+	E1000_adapter.tx_buffers[last] = pb;
+	E1000_adapter.tx_stats.packets++;
+
+	E1000_adapter.tx_stats.in_use = E1000_adapter.tx_size - 1 - E1000_tx_free_descs();
+	if (E1000_adapter.tx_stats.in_use > E1000_adapter.tx_stats.max_in_use) E1000_adapter.tx_stats.max_in_use = E1000_adapter.tx_stats.in_use;
+
+	// The descriptors must be in memory before the NIC sees the new tail
+	asm volatile("" ::: "memory");
 	E1000_write_command(REG_TXDESCTAIL, E1000_adapter.tx_cur);
-	while(!(E1000_adapter.tx_descs[old_cur].status & 0xff));
+
+	spinlock_unlock_irqrestore(&E1000_adapter.tx_lock, eflags);
+	return 1;
 }
 
 uint8 *E1000_get_MAC() {
@@ -346,21 +862,27 @@ void init_E1000() {
     for (uint i=0; i<6; i++) E1000_adapter.MAC[i] = E1000_adapter.pci_bar_mem[0x5400 + i];
 //    printf("MAC address: %X:%X:%X:%X:%X:%X\n", MAC[0], MAC[1], MAC[2], MAC[3], MAC[4], MAC[5]);
 
-	register_interrupt_handler(IRQ0 + device->IRQ, &E1000_handle_receive);
+	// A vector of our own with MSI, otherwise the (maybe shared) INTx line
+	uint8 vector = PCI_enable_MSI(device);
+	if (vector) register_interrupt_handler(vector, &E1000_handle_interrupt);
+	else {
+		register_interrupt_handler(IRQ0 + device->IRQ, &E1000_handle_interrupt);
+		IOAPIC_route_PCI_IRQ(device->IRQ);
+	}
 
 	// Start the network
 	uint val = E1000_read_command(REG_CTRL);
 	E1000_write_command(REG_CTRL, val | ECTRL_SLU);
 
-	// Clear out the multicast filter
-	for(int i = 0; i < 0x80; i++)
-        E1000_write_command(0x5200 + i*4, 0);
+	// Only our MAC and the broadcasts until someone joins a group
+	E1000_write_filters();
 
-	// Register the interrupt handler (for receiving packets)
-	E1000_enable_interrupt();
+	// Initialize the rings, then let the interrupts in
+	E1000_init_rings(E1000_RX_RING_SIZE, E1000_TX_RING_SIZE);
 
-	// Initialize receive transmission
-    E1000_rxinit();
-    // Initialize send transmission
-    E1000_txinit();
+	E1000Moderation moderation = { E1000_ITR_HZ, E1000_RDTR_US, E1000_RADV_US, E1000_TIDV_US, E1000_TADV_US };
+	E1000_set_moderation(&moderation);
+	E1000_set_poll_budget(E1000_POLL_BUDGET);
+
+	E1000_enable_interrupt();
 }
@@ -0,0 +1,73 @@
+#ifndef __E1000_H
+#define __E1000_H
+
+#include "libc.h"
+#include "packet.h"
+
+// The default ring sizes (multiples of 8, at most E1000_MAX_RING). Each RX
+// descriptor holds a 2KB packet buffer
+#define E1000_RX_RING_SIZE	256
+#define E1000_TX_RING_SIZE	256
+#define E1000_MAX_RING		4096
+
+// The default interrupt moderation: at most 8000 interrupts per second, and
+// the TX interrupts are delayed to reap several packets at once
+#define E1000_ITR_HZ		8000
+#define E1000_RDTR_US		0
+#define E1000_RADV_US		0
+#define E1000_TIDV_US		8
+#define E1000_TADV_US		32
+
+// The frames the poll process receives before it lets the other processes
+// run, see E1000_poll()
+#define E1000_POLL_BUDGET	64
+
+// The multicast groups we can join. The first 15 are matched exactly, the
+// others through a hash table (so some frames of other groups get in)
+#define E1000_MAX_MULTICAST	64
+
+typedef struct {
+	uint size;					// Number of descriptors
+	uint in_use;				// RX: frames found by the last pass, TX: descriptors in flight
+	uint max_in_use;
+	uint packets;
+	uint bytes;
+	uint dropped;				// RX: no buffer to replace, TX: packet too large or no NIC
+	uint ring_full;				// RX: the NIC had no descriptor (RNBC), TX: the sender waited
+	uint missed;				// RX only: frames the NIC couldn't store (MPC)
+} E1000RingStats;
+
+typedef struct {
+	uint ITR_hz;				// Maximum interrupts per second, 0 for no limit
+	uint RDTR_us;
+	uint RADV_us;
+	uint TIDV_us;
+	uint TADV_us;
+} E1000Moderation;
+
+typedef struct {
+	uint budget;				// Frames per pass, 0 to receive in the interrupt handler
+	uint interrupts;			// RX interrupts which woke up the poll process
+	uint polls;					// Passes of the poll process
+	uint exhausted;				// Passes which used the whole budget
+} E1000PollStats;
+
+void init_E1000();
+uint8 *E1000_get_MAC();
+int E1000_send_packet(PacketBuffer *pb);
+uint E1000_tx_max_buffers();
+void E1000_resize_rings(uint rx_size, uint tx_size);
+void E1000_set_moderation(E1000Moderation *moderation);
+E1000Moderation *E1000_get_moderation();
+void E1000_set_RX_checksum(uint8 enabled);
+E1000RingStats *E1000_get_RX_stats();
+E1000RingStats *E1000_get_TX_stats();
+int E1000_add_multicast(const uint8 *MAC);
+void E1000_remove_multicast(const uint8 *MAC);
+void E1000_set_promiscuous(uint8 promiscuous);
+uint8 E1000_get_promiscuous();
+void E1000_start_polling();
+void E1000_set_poll_budget(uint budget);
+E1000PollStats *E1000_get_poll_stats();
+
+#endif
@@ -91,7 +91,7 @@ uint8 shift_key_pressed = 0;
 uint8 ctrl_key_pressed = 0;
 
 /* Handles the keyboard interrupt */
-static void keyboard_handler(registers_t regs)
+static void keyboard_handler(registers_t *regs)
 {
     unsigned char scancode;
 
@@ -143,17 +143,13 @@ static void keyboard_handler(registers_t regs)
         }
 
         // The keyboard handler does not process keystrokes per say
-        // It looks at the process which has the focus
-        // If that process has the PROCESS_POLLING flag turned on
-        // it means it is waiting for keyboard input
-        // The handler is thus filling the process buffer and flipping
-        // off the PROCESS_POLLING flag
-        
+        // It queues them in the input ring of the process which has the focus
+        // (the handler is the only producer, the process the only consumer)
+        // and flips off its PROCESS_POLLING flag in case it is waiting for
+        // keyboard input. Keystrokes are dropped when the ring is full
         Process *ps = get_process_focus();
-        if (ps->flags | PROCESS_POLLING) {
-            ps->buffer = c;
-            ps->flags &= ~PROCESS_POLLING;
-        }
+        ring_push(&ps->input, c);
+        __sync_fetch_and_and(&ps->flags, ~PROCESS_POLLING);
 
     }
 }
@@ -56,7 +56,7 @@ void text_mouse_move(int delta_x, int delta_y) {
 
 uint mouse_button_down = 0;
 
-static void mouse_handler(registers_t regs) {
+static void mouse_handler(registers_t *regs) {
    int x_dir;
    int y_dir;
 
@@ -3,57 +3,163 @@
 #include "kernel.h"
 #include "display.h"
 #include "kheap.h"
+#include "isr.h"
+#include "apic.h"
+#include "virtualmem.h"
+#include "spinlock.h"
+#include "acpi.h"
 
-extern int PCI_get_device_name(uint vendor, uint device, char **vendor_name, char **device_name);
+PCIDevice *PCI_chain, *PCI_last_device;
+static uint8 PCI_bus_scanned[256];
 
-PCIDevice *PCI_chain;
+// The legacy configuration mechanism (port I/O) needs two accesses, which
+// must not interleave between CPUs
+static Spinlock PCI_lock = SPINLOCK_INIT;
 
-uint16 PCI_config_read_word(uint8 bus, uint8 slot, uint8 func, uint8 offset)
+// The memory-mapped configuration space (ECAM), if ACPI has an MCFG table
+static uint PCI_ECAM_base = 0;
+static uint8 PCI_ECAM_start_bus = 0, PCI_ECAM_end_bus = 0;
+
+// Each function has 4KB of ECAM, which we map the first time we access it
+static volatile uint *PCI_ECAM_register(uint8 bus, uint8 slot, uint8 func, uint8 offset)
 {
-    uint address;
-    uint lbus  = (uint)bus;
-    uint lslot = (uint)slot;
-    uint lfunc = (uint)func;
-    uint16 tmp = 0;
- 
-    /* create configuration address as per Figure 1 */
-    address = (uint)((lbus << 16) | (lslot << 11) |
-              (lfunc << 8) | (offset & 0xfc) | ((uint)0x80000000));
- 
-    /* write out the address */
-    outportl(0xCF8, address);
-    /* read in the data */
-    /* (offset & 2) * 8) = 0 will choose the first word of the 32 bits register */
-    tmp = (uint16)((inportl(0xCFC) >> ((offset & 2) * 8)) & 0xffff);
-    return (tmp);
+    uint page = PCI_ECAM_base + (((uint)(bus - PCI_ECAM_start_bus) << 20) | ((uint)slot << 15) | ((uint)func << 12));
+
+    PageTableEntry *pte = get_PTE(page, current_page_directory, 0);
+    if (!pte || !pte->present) map_device_page(page);
+
+    return (volatile uint*)(page + (offset & 0xFC));
+}
+
+static int PCI_use_ECAM(uint8 bus)
+{
+    return PCI_ECAM_base && bus >= PCI_ECAM_start_bus && bus <= PCI_ECAM_end_bus;
 }
 
 uint PCI_config_read_long(uint8 bus, uint8 slot, uint8 func, uint8 offset) {
-    uint address;
-    uint lbus  = (uint)bus;
-    uint lslot = (uint)slot;
-    uint lfunc = (uint)func;
+    if (PCI_use_ECAM(bus)) return *PCI_ECAM_register(bus, slot, func, offset);
 
-    address = (uint)((lbus << 16) | (lslot << 11) |
-              (lfunc << 8) | (offset & 0xfc) | ((uint)0x80000000));
+    uint address = (uint)(((uint)bus << 16) | ((uint)slot << 11) |
+                   ((uint)func << 8) | (offset & 0xfc) | ((uint)0x80000000));
 
+    uint eflags = spinlock_lock_irqsave(&PCI_lock);
     outportl(0xCF8, address);
-    return inportl(0xCFC);
+    uint value = inportl(0xCFC);
+    spinlock_unlock_irqrestore(&PCI_lock, eflags);
+
+    return value;
 }
 
-int PCI_get_vendor(uint8 bus, uint8 slot, uint *vendor, uint *device)
+uint16 PCI_config_read_word(uint8 bus, uint8 slot, uint8 func, uint8 offset)
 {
-//    uint16 vendor, device;
-    /* try and read the first configuration register. Since there are no */
-    /* vendors that == 0xFFFF, it must be a non-existent device. */
-    if ((*vendor = PCI_config_read_word(bus,slot,0,0)) != 0xFFFF) {
-       *device = PCI_config_read_word(bus,slot,0,2);
-       return 1;
+    /* (offset & 2) * 8) = 0 will choose the first word of the 32 bits register */
+    return (uint16)((PCI_config_read_long(bus, slot, func, offset) >> ((offset & 2) * 8)) & 0xffff);
+}
+
+void PCI_config_write_long(uint8 bus, uint8 slot, uint8 func, uint8 offset, uint value) {
+    if (PCI_use_ECAM(bus)) {
+        *PCI_ECAM_register(bus, slot, func, offset) = value;
+        return;
+    }
+
+    uint address = (uint)(((uint)bus << 16) | ((uint)slot << 11) |
+                   ((uint)func << 8) | (offset & 0xfc) | ((uint)0x80000000));
+
+    uint eflags = spinlock_lock_irqsave(&PCI_lock);
+    outportl(0xCF8, address);
+    outportl(0xCFC, value);
+    spinlock_unlock_irqrestore(&PCI_lock, eflags);
+}
+
+// Writes the 16-bit register at offset (2-byte aligned) without touching
+// the other half of its 32-bit register
+static void PCI_config_write_word(uint8 bus, uint8 slot, uint8 func, uint8 offset, uint16 value) {
+    uint old = PCI_config_read_long(bus, slot, func, offset);
+    uint shift = (offset & 2) * 8;
+
+    PCI_config_write_long(bus, slot, func, offset, (old & ~(0xFFFF << shift)) | ((uint)value << shift));
+}
+
+// Walks the capability list, returns the offset of the capability or 0
+uint8 PCI_find_capability(PCIDevice *device, uint8 id) {
+    if (!(PCI_config_read_word(device->bus, device->slot, device->func, PCI_STATUS) & PCI_STATUS_CAPABILITIES))
+        return 0;
+
+    uint8 offset = PCI_config_read_word(device->bus, device->slot, device->func, PCI_CAPABILITIES) & 0xFC;
+
+    // 48 capabilities at most fit in the configuration space, don't loop forever
+    for (int i=0; offset && i<48; i++) {
+        uint header = PCI_config_read_long(device->bus, device->slot, device->func, offset);
+        if ((header & 0xFF) == id) return offset;
+
+        offset = (header >> 8) & 0xFC;
     }
 
     return 0;
 }
 
+// MSI-X: the vector goes in the first entry of the table, which lives in
+// one of the memory BARs
+static void PCI_enable_MSIX(PCIDevice *device, uint8 cap, uint address, uint8 vector) {
+    uint table = PCI_config_read_long(device->bus, device->slot, device->func, cap + PCI_MSIX_TABLE);
+    uint BAR = PCI_config_read_long(device->bus, device->slot, device->func, 0x10 + (table & 0x7) * 4);
+    volatile uint *entry = (volatile uint*)((BAR & 0xFFFFFFF0) + (table & 0xFFFFFFF8));
+
+    map_device_page((uint)entry);
+
+    // Function masked while we program the entry
+    uint16 control = PCI_config_read_word(device->bus, device->slot, device->func, cap + PCI_MSIX_CONTROL);
+    PCI_config_write_word(device->bus, device->slot, device->func, cap + PCI_MSIX_CONTROL, control | PCI_MSIX_ENABLE | PCI_MSIX_FUNCTION_MASK);
+
+    entry[0] = address;
+    entry[1] = 0;
+    entry[2] = vector;
+    entry[3] &= ~PCI_MSIX_ENTRY_MASKED;
+
+    PCI_config_write_word(device->bus, device->slot, device->func, cap + PCI_MSIX_CONTROL, (control | PCI_MSIX_ENABLE) & ~PCI_MSIX_FUNCTION_MASK);
+}
+
+// A single message (no multiple message enable), edge-triggered
+static void PCI_enable_MSI_cap(PCIDevice *device, uint8 cap, uint address, uint8 vector) {
+    uint16 control = PCI_config_read_word(device->bus, device->slot, device->func, cap + PCI_MSI_CONTROL);
+
+    PCI_config_write_long(device->bus, device->slot, device->func, cap + PCI_MSI_ADDRESS, address);
+    if (control & PCI_MSI_64BIT) {
+        PCI_config_write_long(device->bus, device->slot, device->func, cap + PCI_MSI_ADDRESS + 4, 0);
+        PCI_config_write_word(device->bus, device->slot, device->func, cap + PCI_MSI_ADDRESS + 8, vector);
+    }
+    else PCI_config_write_word(device->bus, device->slot, device->func, cap + PCI_MSI_ADDRESS + 4, vector);
+
+    // Bits 4-6: multiple message enable = 0 (one vector)
+    PCI_config_write_word(device->bus, device->slot, device->func, cap + PCI_MSI_CONTROL, (control & ~0x70) | PCI_MSI_ENABLE);
+}
+
+// Gives the device a vector of its own and makes it send its interrupts as
+// messages (MSI-X, or else MSI) to the BSP, instead of through its INTx
+// line. Returns the vector, or 0 if the device must keep its line
+uint8 PCI_enable_MSI(PCIDevice *device) {
+    if (!LAPIC_is_enabled()) return 0;
+
+    uint8 MSIX_cap = PCI_find_capability(device, PCI_CAP_MSIX);
+    uint8 MSI_cap = MSIX_cap ? 0 : PCI_find_capability(device, PCI_CAP_MSI);
+    if (!MSIX_cap && !MSI_cap) return 0;
+
+    uint8 vector = interrupt_alloc_vector();
+    if (!vector) return 0;
+
+    // Fixed delivery, physical destination: the LAPIC ID in bits 12-19
+    uint address = 0xFEE00000 | ((uint)LAPIC_id() << 12);
+
+    if (MSIX_cap) PCI_enable_MSIX(device, MSIX_cap, address, vector);
+    else PCI_enable_MSI_cap(device, MSI_cap, address, vector);
+
+    uint16 command = PCI_config_read_word(device->bus, device->slot, device->func, PCI_COMMAND);
+    PCI_config_write_word(device->bus, device->slot, device->func, PCI_COMMAND, command | PCI_COMMAND_INTX_DISABLE);
+
+    device->MSI_vector = vector;
+    return vector;
+}
+
 PCIDevice *PCI_search_device(uint16 vendor_id, uint16 device_id) {
     PCIDevice *device = PCI_get_devices();
 
@@ -70,37 +176,120 @@ PCIDevice *PCI_get_devices() {
     return PCI_chain;
 }
 
+// Reads the BARs and their sizes: all ones are written to each BAR, the bits
+// which stay at 0 give its size. Decoding is off meanwhile so that the device
+// doesn't answer at the temporary address
+static void PCI_read_BARs(PCIDevice *device, uint nb_BARs) {
+    uint16 command = PCI_config_read_word(device->bus, device->slot, device->func, PCI_COMMAND);
+    PCI_config_write_word(device->bus, device->slot, device->func, PCI_COMMAND, command & ~(PCI_COMMAND_IO | PCI_COMMAND_MEMORY));
+
+    for (uint i=0; i<nb_BARs; i++) {
+        uint8 offset = PCI_BAR0 + i * 4;
+        uint value = PCI_config_read_long(device->bus, device->slot, device->func, offset);
+
+        PCI_config_write_long(device->bus, device->slot, device->func, offset, 0xFFFFFFFF);
+        uint mask = PCI_config_read_long(device->bus, device->slot, device->func, offset);
+        PCI_config_write_long(device->bus, device->slot, device->func, offset, value);
+
+        PCIBar *BAR = &device->BARs[i];
+        BAR->flags = value & 0xF;
+
+        if (value & PCI_BAR_IO) {
+            BAR->address = value & 0xFFFFFFFC;
+            BAR->size = (~(mask & 0xFFFFFFFC) + 1) & 0xFFFF;
+        }
+        else {
+            BAR->address = value & 0xFFFFFFF0;
+            BAR->size = ~(mask & 0xFFFFFFF0) + 1;
+
+            // The high half of a 64-bit BAR is the next one, we only use
+            // the devices mapped below 4GB
+            if ((value & PCI_BAR_TYPE_MASK) == PCI_BAR_64BIT) i++;
+        }
+
+        if (!mask) BAR->size = 0;
+    }
+
+    PCI_config_write_word(device->bus, device->slot, device->func, PCI_COMMAND, command);
+}
+
+static void PCI_scan_bus(uint8 bus);
+
+static void PCI_add_function(uint8 bus, uint8 slot, uint8 func) {
+    uint id = PCI_config_read_long(bus, slot, func, 0);
+
+    PCIDevice *device = (PCIDevice*)kmalloc(sizeof(PCIDevice));
+    memset(device, 0, sizeof(PCIDevice));
+    device->bus = bus;
+    device->slot = slot;
+    device->func = func;
+    device->vendor_id = id & 0xFFFF;
+    device->device_id = id >> 16;
+
+    uint class = PCI_config_read_long(bus, slot, func, PCI_CLASS);
+    device->class_code = class >> 24;
+    device->subclass = (class >> 16) & 0xFF;
+    device->header_type = PCI_config_read_long(bus, slot, func, PCI_HEADER_TYPE & 0xFC) >> 16 & 0x7F;
+    device->IRQ = (uint8)(PCI_config_read_long(bus, slot, func, 0x3C) & 0xFF);
+
+    // Bridges only have 2 BARs
+    PCI_read_BARs(device, device->header_type == PCI_HEADER_BRIDGE ? 2 : 6);
+    device->BAR0 = (unsigned char*)device->BARs[0].address;
+
+    PCI_get_device_name(device->vendor_id, device->device_id, &device->vendor_name, &device->device_name);
+
+    if (PCI_chain == 0) PCI_chain = device;
+    else PCI_last_device->next = device;
+    PCI_last_device = device;
+
+    // The devices behind a PCI-to-PCI bridge are on its secondary bus
+    if (device->header_type == PCI_HEADER_BRIDGE && device->class_code == PCI_CLASS_BRIDGE && device->subclass == PCI_SUBCLASS_PCI_BRIDGE) {
+        uint8 secondary_bus = (PCI_config_read_long(bus, slot, func, PCI_SECONDARY_BUS & 0xFC) >> 8) & 0xFF;
+        PCI_scan_bus(secondary_bus);
+    }
+}
+
+static int PCI_is_multifunction(uint8 bus, uint8 slot) {
+    return (PCI_config_read_long(bus, slot, 0, PCI_HEADER_TYPE & 0xFC) >> 16) & PCI_HEADER_MULTIFUNCTION;
+}
+
+static void PCI_scan_slot(uint8 bus, uint8 slot) {
+    if ((PCI_config_read_long(bus, slot, 0, 0) & 0xFFFF) == 0xFFFF) return;
+
+    PCI_add_function(bus, slot, 0);
+    if (!PCI_is_multifunction(bus, slot)) return;
+
+    for (uint8 func=1; func<8; func++) {
+        if ((PCI_config_read_long(bus, slot, func, 0) & 0xFFFF) != 0xFFFF) PCI_add_function(bus, slot, func);
+    }
+}
+
+static void PCI_scan_bus(uint8 bus) {
+    // A badly configured bridge could send us back to a bus we have seen
+    if (PCI_bus_scanned[bus]) return;
+    PCI_bus_scanned[bus] = 1;
+
+    for (uint8 slot=0; slot<32; slot++) PCI_scan_slot(bus, slot);
+}
+
+// Enumerates the devices from the bus 0, going through the bridges, instead
+// of probing the 256 buses. If the host bridge (0:0.0) is multi-function,
+// its function n is the host bridge of the bus n
 void init_PCI() {
+    ACPIInfo *info = ACPI_get_info();
+    if (info->MCFG_address) {
+        PCI_ECAM_base = info->MCFG_address;
+        PCI_ECAM_start_bus = info->MCFG_start_bus;
+        PCI_ECAM_end_bus = info->MCFG_end_bus;
+    }
+
     PCI_chain = 0;
-    PCIDevice *device, *last_device;
-    uint vendor_id, device_id;
-    char *vendor_name, *device_name;
-    int idx;
-
-    for (uint bus=0; bus<256; bus++) {
-        for (uint slot=0; slot<32; slot++) {
-            if (PCI_get_vendor(bus, slot, &vendor_id, &device_id)) {
-
-                device = (PCIDevice*)kmalloc(sizeof(PCIDevice));
-                device->bus = bus;
-                device->slot = slot;
-                device->vendor_id = vendor_id;
-                device->device_id = device_id;
-                device->next = 0;
-
-                if (PCI_chain == 0) {
-                    last_device = device;
-                    PCI_chain = device;
-                } else {
-                    last_device->next = device;
-                    last_device = device;
-                }
-
-                PCI_get_device_name(vendor_id, device_id, &device->vendor_name, &device->device_name);
-                device->BAR0 = (unsigned char*)PCI_config_read_long(bus, slot, 0, 0x10);
-                device->IRQ = (uint8)(PCI_config_read_long(bus, slot, 0, 0x3C) & 0xFF);
-            }
+    memset(PCI_bus_scanned, 0, sizeof(PCI_bus_scanned));
+
+    if (!PCI_is_multifunction(0, 0)) PCI_scan_bus(0);
+    else {
+        for (uint8 func=0; func<8; func++) {
+            if ((PCI_config_read_long(0, 0, func, 0) & 0xFFFF) != 0xFFFF) PCI_scan_bus(func);
         }
     }
-
 }
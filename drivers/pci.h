@@ -1,5 +1,11 @@
 #include "libc.h"
 
+typedef struct {
+	uint address;					// Physical address (memory) or port (I/O)
+	uint size;						// 0 if the BAR is not used
+	uint8 flags;					// The low bits of the BAR (PCI_BAR_*)
+} PCIBar;
+
 typedef struct PCI_device_t {
 	uint16 vendor_id;
 	uint16 device_id;
@@ -9,9 +15,61 @@ typedef struct PCI_device_t {
 	struct PCI_device_t *next;
 	uint8 bus;
 	uint8 slot;
+	uint8 func;
 	uint8 IRQ;
+	uint8 MSI_vector;				// 0 if the device uses its INTx line
+	uint8 class_code;
+	uint8 subclass;
+	uint8 header_type;
+	PCIBar BARs[6];
 } PCIDevice;
 
+#define PCI_COMMAND					0x04
+#define PCI_STATUS					0x06
+#define PCI_CLASS					0x08	// Revision, prog IF, subclass, class
+#define PCI_HEADER_TYPE				0x0E
+#define PCI_BAR0					0x10
+#define PCI_SECONDARY_BUS			0x19	// Bridges only
+#define PCI_CAPABILITIES			0x34
+
+#define PCI_COMMAND_IO				0x1
+#define PCI_COMMAND_MEMORY			0x2
+#define PCI_COMMAND_INTX_DISABLE	0x400
+#define PCI_STATUS_CAPABILITIES		0x10
+
+#define PCI_HEADER_BRIDGE			0x01
+#define PCI_HEADER_MULTIFUNCTION	0x80
+
+#define PCI_CLASS_BRIDGE			0x06
+#define PCI_SUBCLASS_PCI_BRIDGE		0x04
+
+#define PCI_BAR_IO					0x1
+#define PCI_BAR_TYPE_MASK			0x6
+#define PCI_BAR_64BIT				0x4
+#define PCI_BAR_PREFETCHABLE		0x8
+
+// Capability IDs
+#define PCI_CAP_MSI					0x05
+#define PCI_CAP_MSIX				0x11
+
+// MSI capability (offsets from the capability)
+#define PCI_MSI_CONTROL				0x02
+#define PCI_MSI_ADDRESS				0x04
+#define PCI_MSI_64BIT				0x80
+#define PCI_MSI_ENABLE				0x01
+
+// MSI-X capability
+#define PCI_MSIX_CONTROL			0x02
+#define PCI_MSIX_TABLE				0x04
+#define PCI_MSIX_ENABLE				0x8000
+#define PCI_MSIX_FUNCTION_MASK		0x4000
+#define PCI_MSIX_ENTRY_MASKED		0x1
+
 PCIDevice *PCI_get_devices();
 PCIDevice *PCI_search_device(uint16 vendor_id, uint16 device_id);
-void PCI_init();
+void init_PCI();
+uint PCI_config_read_long(uint8 bus, uint8 slot, uint8 func, uint8 offset);
+void PCI_config_write_long(uint8 bus, uint8 slot, uint8 func, uint8 offset, uint value);
+uint8 PCI_find_capability(PCIDevice *device, uint8 id);
+uint8 PCI_enable_MSI(PCIDevice *device);
+int PCI_get_device_name(uint vendor, uint device, char **vendor_name, char **device_name);
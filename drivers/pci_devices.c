@@ -1,7730 +1,57 @@
 #include "libc.h"
+#include "pci.h"
+
+// The names of the PCI vendors and devices. The tables are generated at
+// build time from pci_ids/pci_ids.txt (see pci_ids/gen_pci_ids.c): the
+// vendors and the devices of each vendor are sorted by ID, and their names
+// are offsets in a pool where each string appears once.
 
 typedef struct {
 	uint16 vendor;
+	uint name;						// Offset in PCI_strings
+	uint16 first_device;			// Index of its devices in PCI_devices
+	uint16 nb_devices;
+} PCIVendorID;
+
+typedef struct {
 	uint16 device;
-	char *vendor_name;
-	char *code;
-	char *device_name;
-} PCIDevice;
-/*
-PCIDevice device_list[] = {
-{0x0033, 0x002F, "Paradyne Corp.","MAIAM","Spitfire VGA Accelerator" },
-{0x0033, 0x00333, "Paradyne Corp.","OTI107","Spitfire VGA Accelerator" },
-};
-*/
+	uint name;
+} PCIDeviceID;
+
+#include "pci_ids.h"
 
-PCIDevice device_list[] = {
-{0x0033, 0x002F, "Paradyne Corp.","MAIAM","Spitfire VGA Accelerator" },
-{0x0033, 0x00333, "Paradyne Corp.","OTI107","Spitfire VGA Accelerator" },
-{0x003D, 0x003a, "master","mx98715/25","i740pci" },
-{0x003D, 0x003d, "master","mx98715/25","1740pci" },
-{0x003D, 0x00D1, "master","mx98715/25","i740 PCI" },
-{0x0070, 0x6800, "Hauppauge Computer Works Inc.","PCI\\VEN_14F1&DEV_2F30&SUBSY5_205D14F1&REV_01\\3&130","Hauppage Nova -TD-500 DVB-T Tuner Device" },
-{0x0402, 0x1050, " Acer aspire one","0x1050","ethernet controller" },
-{0x0402, 0x5606, " Acer aspire one","0x0436","0x4752" },
-{0x0402, 0x8086, " Acer aspire one","0x8086","video controller" },
-{0x0402, 0x9665, " Acer aspire one","PCI\\VEN_10DE&DEV_0059&SUBSYS_2052161F&REV_A2","ZCT8YBT'" },
-{0x046D, 0x0805, "Logitech Inc.","atom &#305;ntel &#305;ns&#305;de","n.a." },
-{0x046D, 0x0808, "Logitech Inc.","n/a","Logitech Webcam C600" },
-{0x046D, 0x0809, "Logitech Inc.","Unknown","Webcam Pro 9000" },
-{0x046D, 0x082B, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0x0896, "Logitech Inc.","5&34B666AE&0&7","Camera" },
-{0x046D, 0x08AD, "Logitech Inc.","N/A","Quickcam Communicate STX" },
-{0x046D, 0x08AF, "Logitech Inc.","-","-" },
-{0x046D, 0x08b2, "Logitech Inc.","123abc","logitech QuickCam® Pro 4000" },
-{0x046D, 0x08C6, "Logitech Inc.","0x08C1","Logitech OEM Webcam" },
-{0x046D, 0x08f0, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0x08F6, "Logitech Inc.","0100","QuickCam Communicate" },
-{0x046D, 0x092F, "Logitech Inc.","QuickCam Express","model number: V-UAP9" },
-{0x046D, 0x0A0B, "Logitech Inc.","A-00008","Logitech ClearChat Pro USB" },
-{0x046D, 0x0A1F, "Logitech Inc.","USB _ phone toush","Logitech G930 Headset" },
-{0x046D, 0x5a61, "Logitech Inc.","356254","" },
-{0x046D, 0xC018, "Logitech Inc.","?","Baesline 3 Button Corded Optical Mouse, 2 button + scroll wheel" },
-{0x046D, 0xC045, "Logitech Inc.","M/N: M-BJ96C. P/N: 830667-0000. PID: c00e","Epoxy Hidden" },
-{0x046D, 0xC046, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0xc05b, "Logitech Inc.","ee","ftht" },
-{0x046D, 0xC063, "Logitech Inc.","k251d","DELL 6-Button mouse" },
-{0x046D, 0xC226, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0xC227, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0xC22D, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0xC281, "Logitech Inc.","J-UA9","Wingman Force J-UA9" },
-{0x046D, 0xC312, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0xC404, "Logitech Inc.","n/a","Logitech TrackMan Wheel" },
-{0x046D, 0xC50E, "Logitech Inc.","M-RAM99, C-BS35","MediaPlay Cordless Mouse" },
-{0x046D, 0xC512, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0xC51B, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0xc51e, "Logitech Inc.","Unknown","Unknown" },
-{0x046D, 0xC526, "Logitech Inc.","n/a","n/a" },
-{0x046D, 0xC52A, "Logitech Inc.","Dell Wireless Keyboard w/ mouse","HID Keyboard Device" },
-{0x046D, 0xC52B, "Logitech Inc.","FC8708A607198-10F1043TA3","USB Receiver for Wireless Mouse" },
-{0x046D, 0xC52E, "Logitech Inc.","n/a","USB3 receiver" },
-{0x046D, 0xC52F, "Logitech Inc.","Logitech Wireless Mouse USB Controller","Logitech Wireless Mouse USB Controller" },
-{0x0483, 0x2016, "UPEK","UPEK fingerprint sensors ","Driver Windows xp" },
-{0x04A9, 0x314D, "Canon","unknown","uhknown" },
-{0x04B3, 0x24D5, "IBM","PCI\\VEN_8086&DEV_24D5&SUBSYS_B026144D&REV_02","Audio Controller" },
-{0x04B3, 0x401,"IBM","8086","PCI\\VEN_8086&DEV_293E&SUBSYS_20F217AA&REV_03\\3&B1BFB68&0&D8	" },
-{0x04B3, 0x401, "IBM","24C5","PCI\\VEN_8086&DEV_24C6&REV_03\\3 267A616A" },
-{0x04B3, 0x4010, "IBM","cc020000","PCI\\VEN_10EC&DEV_5227&SUBSYS_220C17AA&REV_01" },
-{0x04B3, 0x9876, "IBM","CC_040100","PCI\\VEN_8086&DEV_1C3A&SUBSYS_1C3A1458&REV_04" },
-{0x04D9, 0x1603, "Filco","n\\a","Samsung" },
-{0x04D9, 0x2011, "Filco","n/a","n/a" },
-{0x04F2, 0xb008, "Chicony Electronics Co. ","USB\\VID_138A&PID_0001",".oem44.inf" },
-{0x04F2, 0xB044, "Chicony Electronics Co. ",".","Webcam" },
-{0x04F2, 0xB175, "Chicony Electronics Co. ","0001","SN" },
-{0x04F2, 0xB217, "Chicony Electronics Co. ","01A000166","Integrated Camera" },
-{0x04F2, 0xB307, "Chicony Electronics Co. ","6030","Webcam" },
-{0x051D, 0x0002, "ACPI\\VEN_INT&DEV_33A0","USB\\VID_0B05&PID_580F\\E6AZCY495152","Inter (R) Core [TM] 2 Duo cpu" },
-{0x051D, 0x051D, "ACPI\\VEN_INT&DEV_33A0","USB\\VID_0B05&PID_580F\\E6AZCY495152","0x051d" },
-{0x051D, 0x9876, "ACPI\\VEN_INT&DEV_33A0","USB\\VID_0B05&PID_580F\\E6AZCY495152","USB\\VID_0B05&PID_580F\\E6AZCY495152" },
-{0x0553, 0x0200," Aiptek USA","DS38xx","Oregon Scientific" },
-{0x058f, 0x0001, "Alcor Micro Corp.","6387","AM usb storage" },
-{0x058f, 0x0107, "Alcor Micro Corp.","0x03","0x01 " },
-{0x058f, 0x1234, "Alcor Micro Corp.","9380","6387" },
-{0x058f, 0x1600, "Alcor Micro Corp.","00000000","http://www.alldatasheet.com/datasheet-pdf/pdf/91600/ETC/AU9254A21.html" },
-{0x058f, 0x6362, "Alcor Micro Corp.","UNKNOWN","Unknown 4-in-1 card reader (istar)" },
-{0x058f, 0x6366, "Alcor Micro Corp.","Unknown","Multi Flash Reader USB Device" },
-{0x058f, 0x6387, "Alcor Micro Corp.","intel g620","USB Mass Storage Device(USB1005B Flash Disk)" },
-{0x058f, 0x8CBA, "Alcor Micro Corp.","PCI\\VEN_8086&DEV_8CBA&SUBSYS_78211462&REV_00\\3&115","PCI Simple Communications Controller" },
-{0x058f, 0x9254, "Alcor Micro Corp.","AU9254A21-HAS","http://www.alldatasheet.com/datasheet-pdf/pdf/91600/ETC/AU9254A21.html" },
-{0x058f, 0x9380, "Alcor Micro Corp.","FC8708-3","Micron=MT29F32G08CBABA" },
-{0x058f, 0x9540, "Alcor Micro Corp.","Unknown","SmartCard Reader" },
-{0x0590, 0x0028, "Omron Corp","HEM-790IT","hid device class blood pressure monitor" },
-{0x05ac, 0x021e, "Apple Inc.","Keyboard IT USB","Alluminium Keyboard IT USB" },
-{0x05ac, 0x1293, "Apple Inc.","Apple iPod 5","Apple iPod 5" },
-{0x05ac, 0x1297, "Apple Inc.","Apple iPhone ","Apple iPhone 4" },
-{0x05ac, 0x21e, "Apple Inc.","phone 3g","Allumium keyboard it USB " },
-{0x05ac, 0x8215, "Apple Inc.","BCM2046","Broadcom BCM2046 Bluetooth chipset iMac" },
-{0x05E1, 0x0408, "D-MAX","00000000000","USB 2.0 Video Capture Controller" },
-{0x05E1, 0x0501, "D-MAX","120315000000621","web cam" },
-{0x064e, 0x064e, "SUYIN Corporation","VID_0000&PID_0000\\5&2B3B5BA1&0&1","Suyin" },
-{0x064e, 0xa101, "SUYIN Corporation","suYin","Acer Crystal Eye Webcam" },
-{0x064e, 0xa103, "SUYIN Corporation","SuYin","WebCam" },
-{0x064e, 0xa116, "SUYIN Corporation","Suiyn Optronics","USB 2.0 UVC 0.3M WebCam" },
-{0x064e, 0xA219, "SUYIN Corporation","SUYIN","SUYIN 1.3M WebCam" },
-{0x064e, 0xB250, "SUYIN Corporation","SuYin","1.3M HD WebCam" },
-{0x064e, 0xc108, "SUYIN Corporation","dont know","its a webcam software" },
-{0x064e, 0xd101, "SUYIN Corporation","SuYin","Web Cam" },
-{0x064e, 0xD217, "SUYIN Corporation","SUYIN","HP TrueVision HD" },
-{0x067B, 0x2303, "Prolific Technology Inc.","2303 HXA","Prolific USB 2 Serial Comm Port &#1082;&#1086;&#1085;&#1090;&#1088;&#1086;&#1083;&#1083;&#1077;&#108" },
-{0x067B, 0x2305, "Prolific Technology Inc.","PL-2303","USB-to-Printer Bridge Controller" },
-{0x067B, 0x2393, "Prolific Technology Inc.","prolific","prolificz" },
-{0x067B, 0x2506, "Prolific Technology Inc.","PL-2506","Hi-Speed USB to IDE Bridge Controller" },
-{0x067B, 0x25a1, "Prolific Technology Inc.","PL-2501","Prolific PCLinq3 USB Transfer Cable Driver" },
-{0x067B, 0x9876, "Prolific Technology Inc.","067B","TES" },
-{0x06FE, 0x9700, "Acresso Software Inc.","i don't know","a netcard used usb interface" },
-{0x093a, 0x2468, "KYE Systems Corp. / Pixart Imaging","Genius iLook 300","http://genius.ru/products.aspx?pnum=24948&archive=1" },
-{0x093a, 0x2600, "KYE Systems Corp. / Pixart Imaging","PAC7311","http://www.speedlink.com/support/bin/24-02-2012/SETUP.rar" },
-{0x093a, 0x2608, "KYE Systems Corp. / Pixart Imaging","PAC7311 - Toshiba PX1342E-1 CAM","USB\\VID_093A&PID_2608&REV_0100&MI_00" },
-{0x093a, 0x2620, "KYE Systems Corp. / Pixart Imaging","CNR-WCAM53G","WEBCAM http://www.canyon-tech.com/archive/voip/webcams/CNR-WCAM53#pr-switcher" },
-{0x096E, 0x0201, "USB Rockey dongle from Feitain ","Rockey4"," " },
-{0x0A5C, 0x0201, "Broadcom Corporation","Blutonium BCM2035 Bluetooth 2.4 GHz Single Chip Tr","Broadcom USB iLine10(tm) Network Adapter" },
-{0x0A5C, 0x10DE, "Broadcom Corporation","0264","Controlador sm" },
-{0x0A5C, 0x2000, "Broadcom Corporation"," 0578A97","Broadcom Bluetooth Firmware Upgrade Device" },
-{0x0A5C, 0x2009, "Broadcom Corporation"," ","Broadcom Bluetooth Controller" },
-{0x0A5C, 0x200a, "Broadcom Corporation"," ","Broadcom Bluetooth Controller" },
-{0x0A5C, 0x200f, "Broadcom Corporation"," PCI\\VEN_14E4&DEV_43B1&SUBSYS_2B231A3B&REV_03","Broadcom 802.11ac Network Adapter " },
-{0x0A5C, 0x201d, "Broadcom Corporation"," n450","BROADCOM Bluetooth Device" },
-{0x0A5C, 0x201e, "Broadcom Corporation"," ","IBM Integrated Bluetooth IV" },
-{0x0A5C, 0x2020, "Broadcom Corporation"," ","Broadcom Bluetooth Dongle" },
-{0x0A5C, 0x2021, "Broadcom Corporation"," 0A5C","BCM2035B3 ROM Adapter Generic" },
-{0x0A5C, 0x2033, "Broadcom Corporation","  1ujy100539f","Broadcom Blutonium Device Firmware Downloader" },
-{0x0A5C, 0x2035, "Broadcom Corporation","5&263C7E89&0&1","BCM92035NMD Bluetooth" },
-{0x0A5C, 0x2038, "Broadcom Corporation"," ","Broadcom Blutonium Device Firmware Downloader (BCM2038)" },
-{0x0A5C, 0x2039, "Broadcom Corporation"," BCM92045B3 ROM","BROADCOM Bluetooth Device" },
-{0x0A5C, 0x2045, "Broadcom Corporation","BCM2045A","Broadcom Bluetooth Controller" },
-{0x0A5C, 0x2046, "Broadcom Corporation"," 5738z","Broadcom USB Bluetooth Device" },
-{0x0A5C, 0x2047, "Broadcom Corporation"," ","Broadcom USB Bluetooth Device" },
-{0x0A5C, 0x205e, "Broadcom Corporation"," USB\\VID_0A5C&PID_5801&MI_00","Broadcom Bluetooth Firmware Upgrade Device" },
-{0x0A5C, 0x2100, "Broadcom Corporation","BT 50","Broadcom Bluetooth 2.0+eDR USB dongle" },
-{0x0A5C, 0x2101, "Broadcom Corporation","USB\\VID_0A5C&PID_2101","Broadcom Bluetooth 2.0+EDR USB dongle" },
-{0x0A5C, 0x2102, "Broadcom Corporation"," USB\\VID_04B4&PID_2102\\5&38CD4C16&0&6","ANYCOM Blue USB-200/250" },
-{0x0A5C, 0x2110, "Broadcom Corporation"," 39A18BDD","Broadcom Bluetooth Controller" },
-{0x0A5C, 0x2111, "Broadcom Corporation"," ","ANYCOM Blue USB-UHE 200/250" },
-{0x0A5C, 0x2120, "Broadcom Corporation"," 2045","Broadcom 2045 Bluetooth 2.0 USB-UHE Device with trace filter" },
-{0x0A5C, 0x2121, "Broadcom Corporation"," ","Broadcom 2045 Bluetooth 2.0 USB Device with trace filter" },
-{0x0A5C, 0x2122, "Broadcom Corporation"," BCM92045B3","Broadcom Bluetooth 2.0+EDR USB dongle" },
-{0x0A5C, 0x2124, "Broadcom Corporation"," ","2045B3ROM Bluetooth Dongle" },
-{0x0A5C, 0x2130, "Broadcom Corporation"," ","Broadcom 2045 Bluetooth 2.0 USB-UHE Device with trace filter" },
-{0x0A5C, 0x2131, "Broadcom Corporation"," ","Broadcom 2045 Bluetooth 2.0 USB Device with trace filter" },
-{0x0A5C, 0x2140, "Broadcom Corporation"," ","2046 Flash UHE Class 2" },
-{0x0A5C, 0x2141, "Broadcom Corporation"," ","2046 Flash non UHE Class 2" },
-{0x0A5C, 0x2142, "Broadcom Corporation"," ","2046 Flash non UHE Class 1" },
-{0x0A5C, 0x2143, "Broadcom Corporation"," ","2046 Flash non UHE Class 1" },
-{0x0A5C, 0x2144, "Broadcom Corporation"," ","2046 Flash non UHE module Class 2" },
-{0x0A5C, 0x2145, "Broadcom Corporation","bcm9204md ","Broadcom BCM9204MD LENO Module" },
-{0x0A5C, 0x2146, "Broadcom Corporation"," ","Broadcom 2045 Bluetooth 2.1 USB UHE Dongle" },
-{0x0A5C, 0x2147, "Broadcom Corporation"," 0A5C&PID_5800","Broadcom 2046 Bluetooth 2.1 USB Dongle" },
-{0x0A5C, 0x2148, "Broadcom Corporation","GBU421","Broadcom 2046 Bluetooth 2.1 USB UHE Dongle" },
-{0x0A5C, 0x2149, "Broadcom Corporation"," ","Broadcom 2046 Bluetooth 2.1 USB Dongle" },
-{0x0A5C, 0x214a, "Broadcom Corporation"," ","Broadcom 2046 Bluetooth 2.1 USB Module" },
-{0x0A5C, 0x214b, "Broadcom Corporation"," 52AF1AB24D","Broadcom 2046 Bluetooth 2.1 USB Module" },
-{0x0A5C, 0x214c, "Broadcom Corporation"," ","Broadcom 2046 Bluetooth 2.1 USB Module" },
-{0x0A5C, 0x214d, "Broadcom Corporation"," ","Broadcom Bluetooth 2.1 UHE Module" },
-{0x0A5C, 0x214e, "Broadcom Corporation"," ","Thinkpad Bluetooth with Enhanced Data Rate II" },
-{0x0A5C, 0x214f, "Broadcom Corporation"," ","Broadcom 2046 Bluetooth 2.1 USB UHE Dongle" },
-{0x0A5C, 0x2150, "Broadcom Corporation"," ","Broadcom 2046 Bluetooth 2.1 USB Dongle" },
-{0x0A5C, 0x2151, "Broadcom Corporation"," 2151","Broadcom Bluetooth 2.1 USB Dongle" },
-{0x0A5C, 0x2152, "Broadcom Corporation"," ","Broadcom 2046 Bluetooth 2.1 USB UHE Dongle" },
-{0x0A5C, 0x2153, "Broadcom Corporation"," ","Broadcom 2046 Bluetooth 2.1 USB UHE Dongle" },
-{0x0A5C, 0x2154, "Broadcom Corporation"," ","Broadcom 2046 Bluetooth 2.1 USB UHE Dongle" },
-{0x0A5C, 0x2155, "Broadcom Corporation"," ","Broadcom Bluetooth USB Dongle" },
-{0x0A5C, 0x2157, "Broadcom Corporation"," ","BCM2046 B1 USB 500" },
-{0x0A5C, 0x2158, "Broadcom Corporation"," ","Broadcom 2046 Bluetooth 2.1 Device" },
-{0x0A5C, 0x219C, "Broadcom Corporation","BCM2070","Broadcom BCM2070 Bluetooth 3.0+HS USB Device " },
-{0x0A5C, 0x21E1, "Broadcom Corporation","Broadcom 20702 Bluetooth 4.0",".0112" },
-{0x0A5C, 0x21E3, "Broadcom Corporation","BCM43142A0","Broadcom Bluetooth 4.0" },
-{0x0A5C, 0x4500, "Broadcom Corporation","BCM2046B1","Broadcom 2046 Bluetooth 2.1 USB Dongle" },
-{0x0A5C, 0x4502, "Broadcom Corporation","BCM2046B1","Broadcom 2046 Bluetooth 2.1 USB Dongle" },
-{0x0A5C, 0x4503, "Broadcom Corporation"," BCM2046B1","Broadcom 2046 Bluetooth 2.1 USB Dongle" },
-{0x0A5C, 0x5800, "Broadcom Corporation"," 1ujy100539f","Unified Security Hub" },
-{0x0A5C, 0x5801, "Broadcom Corporation","0x5801","Unified Security Hub " },
-{0x0A5C, 0x6300, "Broadcom Corporation"," 965","Pirelli ISB Remote NDIS Device" },
-{0x0A5C, 0x6688, "Broadcom Corporation","PCI","NVIDIA GeForce GT 240M" },
-{0x0A5C, 0x8613, "Broadcom Corporation","USB\\VID_04B4&PID_8613&REV_:001","TD 3104 USB vedio grabber " },
-{0x0A5C, 0x9876, "Broadcom Corporation","0x9876","0x9876" },
-{0x0A92, 0x1010, "Egosys, Inc.","1010&REV_0101&MI_00"," RoMI/o by Egosys - Midi USB Cable" },
-{0x0AC8, 0x1234, "ASUS ","1","1" },
-{0x0AC8, 0x6719, "ASUS ","3330","8086&DEV_0F18&SUBSYS_16DD1043&REV_0E" },
-{0x0AC8, 0x9876, "ASUS ","1","1" },
-{0x0b05, 0x170C, "Toshiba Bluetooth RFBUS, RFCOM, RFHID","6205","WIFI USB Card" },
-{0x0c45, 0x0C45, "Microdia Ltd.","USB\\VID_041&PID_6143&REV_0101","USB2.0" },
-{0x0c45, 0x1111, "Microdia Ltd.","USB\\VID_0C45&PID_612A\\5&B0F4C74&0&2","USB webcam" },
-{0x0c45, 0x5243, "Microdia Ltd.","USB","xda exec Uknown device" },
-{0x0c45, 0x6007, "Microdia Ltd.","USB\\VID_0C45&PID_6007&REV_0101","Genius WebCam Eye" },
-{0x0c45, 0x600D, "Microdia Ltd.","USB\\VID_0C45&PID_600D&REV_0101","USB(v1.1) webcam" },
-{0x0c45, 0x602C, "Microdia Ltd.","SN9C102C","home made" },
-{0x0c45, 0x602D, "Microdia Ltd.","VID_0C45&PID_6480&MI_00","USB Webcam" },
-{0x0c45, 0x6030, "Microdia Ltd.","USB\\VID_0C45&PID_6029\\5&18D8BE1C&0&1","USB WebCam " },
-{0x0c45, 0x610C, "Microdia Ltd.","USB\\VID_0C45&PID_610B\\7&3211544E$0$2","usb web camera " },
-{0x0c45, 0x6128, "Microdia Ltd.","USB\\VID_0C45&PID_613C&REV_0101","USB &#1074;&#1077;&#1073;-&#1082;&#1072;&#1084;&#1077;&#1088;&#1072;" },
-{0x0c45, 0x6128, "Microdia Ltd.","USB\\VID_0C45&PID_6148&REV_0101","USB PC Camera Plus" },
-{0x0c45, 0x6129, "Microdia Ltd.","USB\\VID_0C45&PID_6128\\5&3875c171&0&1","USB WebCam" },
-{0x0c45, 0x6130, "Microdia Ltd.","USB\\VID_0000&PID_0000\\5&1AAEDD8&0&2","USB HUB" },
-{0x0c45, 0x613A, "Microdia Ltd.","USB\\VID_0C45&PID_613A\\5&2F621EE5&0&5","USB WEBCAM" },
-{0x0c45, 0x613c, "Microdia Ltd.","USB\\VID_0C45&PID_613C\\5&377B3285&0&1 ","USB Webcam" },
-{0x0c45, 0x613E, "Microdia Ltd.","5&29957435&0&1","USB Camera" },
-{0x0c45, 0x624f, "Microdia Ltd.","Sonix SN9C201","Integrated Webcam in Compal HEL81 series barebones." },
-{0x0c45, 0x6270, "Microdia Ltd.","USB\\VID_0C45&PID_6270","USB Microscopr" },
-{0x0c45, 0x6270, "Microdia Ltd.","usb\\vid_oc45&pid_627b\\5&138897&#1044;1&0&5","webcam" },
-{0x0c45, 0x627F, "Microdia Ltd.","USB\\VID_17A1&PID_0118&REV_0100","USB\\VID_17A1&PID_0118&REV_0100" },
-{0x0c45, 0x62B3, "Microdia Ltd.","USB\\Vid_0c45&Pid_62b3&Rev_0100&MI_00","USB 2.0 PC Camera" },
-{0x0c45, 0x62BF, "Microdia Ltd.","USB\\Vid_0c45&Pid_62bf","USB\\Vid_0c45&Pid_62bf&Rev_0100" },
-{0x0c45, 0x62c0, "Microdia Ltd.","SNP2UVC","Sonix Webcam" },
-{0x0c45, 0x6353, "Microdia Ltd.","USB\\VID_0000&PID_0000\\5&1FFD6427&0&2","USB Microscope" },
-{0x0c45, 0x641D, "Microdia Ltd.","USB\\VID_0C45&PID_643d","1.3 MPixel Integrated Webcam used in Dell N5010 series" },
-{0x0c45, 0x6421, "Microdia Ltd.","USB\\VID_0C45&PID_6421&REV_0224&MI_00","USB 2.0 Webcam slim 32" },
-{0x0c45, 0x642F, "Microdia Ltd.","USB\\VID_0C45&PID_642F&REV_1224","Webcam" },
-{0x0c45, 0x644b, "Microdia Ltd.","oc45&oid 641d& 9:07&mi oo","oc45&oid 641d& 9:07&mi oo" },
-{0x0c45, 0x6489, "Microdia Ltd.","0x6489","Integrated Webcam Universal Serial Bus controllers" },
-{0x0c45, 0x6840, "Microdia Ltd.","USB\\VID_0C45&PID_6480&MI_00 ","sonix 1.3 mp laptop integrated webcam" },
-{0x0c45, 0x7401, "Microdia Ltd.","n.a.","RDing TEMPer1V1.4" },
-{0x0c45, 0x9876, "Microdia Ltd.","USB\\VID_090C&PID_B371&MI_00\\6&462987E&0&0000","webcam" },
-{0x0cf3, 0x1002, "TP-Link","Wireless USB 2.0 adapter TL-WN821N","Wireless USB 2.0 adapter TL-WN821N" },
-{0x0cf3, 0x3000, "TP-Link","USB\\VID_0000&PID_0000\\6&F763642&0&4","USB\\VID_0000&PID_0000\\6&F763642&0&4" },
-{0x0cf3, 0x3002, "TP-Link","USB\\VID_0CF3&PID_3002&REV_0001","USB\\VID_0CF3&PID_3002&REV_0001" },
-{0x0cf3, 0x3005, "TP-Link","AR3011","Atheros Bluetooth Module" },
-{0x0cf3, 0x9271, "TP-Link","0x0108","TP-LINK 150 Mbps Wireless Lite N Adapter TL-WN721N" },
-{0x0D8C, 0x000E, "C-Media Electronics, Inc.","00","Generic USB Audio Device" },
-{0x0D8C, 0x0102, "C-Media Electronics, Inc.","6206lc","USB 5.1CH audio codec" },
-{0x0D8C, 0x5200, "C-Media Electronics, Inc.","0x5200","C-Media USB 2.0 Mass Storage Controller" },
-{0x0DF6, 0x9071, "Sitecom","   \\t9071\\t WL-113 - Wireless Network USB dongle 5","\\t9071\\t   WL-113 - Wireless Network USB dongle 54g  " },
-{0x0E11, 0x0001, "Compaq Computer Corp.","2","PCI to EISA Bridge" },
-{0x0E11, 0x0002, "Compaq Computer Corp.","64320","D2ufG0  <a href=" },
-{0x0E11, 0x000F, "Compaq Computer Corp.","CPQB1A9","StorageWorks Library Adapter (HVD)" },
-{0x0E11, 0x0012, "Compaq Computer Corp.","686P7","686P7" },
-{0x0E11, 0x0046, "Compaq Computer Corp.","Intel Exteme Graphics","Smart Array 6400 Controller" },
-{0x0E11, 0x0049, "Compaq Computer Corp.","NC7132","Gigabit Upgrade Module" },
-{0x0E11, 0x004A, "Compaq Computer Corp.","NC6136","Gigabit Server Adapter" },
-{0x0E11, 0x005A, "Compaq Computer Corp.","PowerPC 405GP processor at 200MHz [3305103C]","HP Remote Insight Lights-Out II Board" },
-{0x0E11, 0x00B1, "Compaq Computer Corp.","3305103C","HP Remote Insight Lights-Out II PCI Device" },
-{0x0E11, 0x00C0, "Compaq Computer Corp.","Adaptec AIC-7899G","64Bit,66MHz,Dual Channel WideUltra3 SCSI" },
-{0x0E11, 0x0508, "Compaq Computer Corp.","Neteligent 4/16 TR","PCI UTP/STP Controller" },
-{0x0E11, 0x1000, "Compaq Computer Corp.","Triflex Model 1000","Pentium Bridge" },
-{0x0E11, 0x2000, "Compaq Computer Corp.","Triflex Model 2000","Pentium Bridge" },
-{0x0E11, 0x3032, "Compaq Computer Corp.","95479","n9XQeH  <a href=" },
-{0x0E11, 0x3033, "Compaq Computer Corp.","23505","HTdOCe  <a href=" },
-{0x0E11, 0x3034, "Compaq Computer Corp.","QVision 1280/p v2","GUI Accelerator" },
-{0x0E11, 0x4000, "Compaq Computer Corp.","Triflex Model 4000","Pentium Bridge" },
-{0x0E11, 0x6010, "Compaq Computer Corp.","Model 6010","HotPlug PCI Bridge" },
-{0x0E11, 0x7020, "Compaq Computer Corp.","camara web","USB Controller" },
-{0x0E11, 0xA0EC, "Compaq Computer Corp.","","Original Compaq fibre Channel HBA" },
-{0x0E11, 0xA0F0, "Compaq Computer Corp.","","Advanced System Management Controller" },
-{0x0E11, 0xA0F3, "Compaq Computer Corp.","","Triflex PCI to ISA PnP Bridge" },
-{0x0E11, 0xA0F7, "Compaq Computer Corp.","PCI bus 6, device 4, function 4","PCI Hotplug Controller" },
-{0x0E11, 0xA0F8, "Compaq Computer Corp.","ZFMicro","USB Open Host Controller" },
-{0x0E11, 0xA0FC, "Compaq Computer Corp.","HPFC-5166A","Tachyon TL 64-bit/66-Mhz FC HBA" },
-{0x0E11, 0xAe10, "Compaq Computer Corp.","","Smart-2 Array Controller" },
-{0x0E11, 0xAE29, "Compaq Computer Corp.","MIS-L","PCI to ISA Bridge" },
-{0x0E11, 0xAE2A, "Compaq Computer Corp.","MPC","CPU to PCI Bridge" },
-{0x0E11, 0xAE2B, "Compaq Computer Corp.","MIS-E","PCI to ISA PnP Bridge" },
-{0x0E11, 0xAE31, "Compaq Computer Corp.","1002&DEV-5653&SUBSYS","System Management Controller" },
-{0x0E11, 0xAE32, "Compaq Computer Corp.","950","Netelligent 10/100 TX PCI UTP TLAN 2.3" },
-{0x0E11, 0xAE33, "Compaq Computer Corp.","Triflex","Dual EIDE Controller" },
-{0x0E11, 0xAE34, "Compaq Computer Corp.","","Netelligent 10 T PCI UTP TLAN 2.3" },
-{0x0E11, 0xAE35, "Compaq Computer Corp.","","Integrated NetFlex 3/P TLAN 2.3" },
-{0x0E11, 0xAE40, "Compaq Computer Corp.","","Dual Port Netelligent 10/100 TX PCI TLAN" },
-{0x0E11, 0xAE43, "Compaq Computer Corp.","","Integrated Netelligent 10/100 TX PCI" },
-{0x0E11, 0xAE69, "Compaq Computer Corp.","CETUS-L","PCI to ISA Bridge" },
-{0x0E11, 0xAE6C, "Compaq Computer Corp.","DRACO","PCI Bridge" },
-{0x0E11, 0xAE6D, "Compaq Computer Corp.","NorthStar","CPU to PCI Bridge" },
-{0x0E11, 0xB011, "Compaq Computer Corp.","","Dual Port Netelligent 10/100 TX" },
-{0x0E11, 0xB012, "Compaq Computer Corp.","Netelligent 10 T/2","UTP/Coax PCI" },
-{0x0E11, 0xB01E, "Compaq Computer Corp.","NC3120","Fast Ethernet NIC" },
-{0x0E11, 0xB01F, "Compaq Computer Corp.","NC3122","Fast Ethernet NIC" },
-{0x0E11, 0xB02F, "Compaq Computer Corp.","NC1120","Ethernet NIC" },
-{0x0E11, 0xB030, "Compaq Computer Corp.","Netelligent WS 1500","10/100TX Embedded UTP/Coax Controller" },
-{0x0E11, 0xB04A, "Compaq Computer Corp.","699209-003","10/100TX WOL UTP Controller" },
-{0x0E11, 0xB060, "Compaq Computer Corp.","CISS","SMART2 Array Controller" },
-{0x0E11, 0xB0C6, "Compaq Computer Corp.","NC3161","Fast Ethernet Embedded Controller w/ WOL" },
-{0x0E11, 0xB0C7, "Compaq Computer Corp.","NC3160","Fast Ethernet NIC" },
-{0x0E11, 0xB0D7, "Compaq Computer Corp.","NC3121 rev. A & B","Fast Ethernet NIC" },
-{0x0E11, 0xB0DD, "Compaq Computer Corp.","NC3131","Fast Ethernet NIC" },
-{0x0E11, 0xB0DE, "Compaq Computer Corp.","NC3132","Fast Ethernet NIC" },
-{0x0E11, 0xB0DF, "Compaq Computer Corp.","NC6132","Gigabit Module" },
-{0x0E11, 0xB0E0, "Compaq Computer Corp.","NC6133","Gigabit Module" },
-{0x0E11, 0xB0E1, "Compaq Computer Corp.","NC3133","Fast Ethernet Module" },
-{0x0E11, 0xB123, "Compaq Computer Corp.","NC6134","Gigabit NIC" },
-{0x0E11, 0xB134, "Compaq Computer Corp.","NC3163","Fast Ethernet NIC" },
-{0x0E11, 0xB13C, "Compaq Computer Corp.","NC3162","Fast Ethernet NIC" },
-{0x0E11, 0xB144, "Compaq Computer Corp.","NC3123","Fast Ethernet NIC" },
-{0x0E11, 0xB163, "Compaq Computer Corp.","NC3134","Fast Ethernet NIC" },
-{0x0E11, 0xB164, "Compaq Computer Corp.","NC3135","Fast Ethernet Upgrade Module" },
-{0x0E11, 0xB178, "Compaq Computer Corp.","CISSB","SMART2 Array Controller" },
-{0x0E11, 0xB196, "Compaq Computer Corp.","0230","Conexant SoftK56 Modem" },
-{0x0E11, 0xB1A4, "Compaq Computer Corp.","NC7131","Gigabit Server Adapter" },
-{0x0E11, 0xB203, "Compaq Computer Corp.","iLo","Integrated Lights Out Processor" },
-{0x0E11, 0xB204, "Compaq Computer Corp.","iLo","Integrated Lights Out Processor" },
-{0x0E11, 0xF095, "Compaq Computer Corp.","FCA2101","HP StorageWorks 2 Gb, 64-Bit/66-MHz PCI-to-Fibre Channel Host Bus Adapter for Windows 2000, Windows" },
-{0x0E11, 0xF130, "Compaq Computer Corp.","","ThunderLAN 1.0 NetFlex-3/P" },
-{0x0E11, 0xF150, "Compaq Computer Corp.","PCI\\VEN_14E4&DEV_1698&REV_10","ThunderLAN 2.3 NetFlex-3/P with BNC" },
-{0x0E11, 0xF700, "Compaq Computer Corp.","","LP7000 Compaq/Emulex Fibre Channel HBA" },
-{0x0E11, 0xF800, "Compaq Computer Corp.","","LP8000 Compaq/Emulex Fibre Channel HBA" },
-{0x0E8D, 0x0002, "MediaTek Inc.","2200","PCI Simple Communications Controller / Mobiles China" },
-{0x0E8D, 0x0003, "MediaTek Inc.","VT6212L","usb" },
-{0x1000, 0x0001, "LSI Logic","LSI53C810","PCI-SCSI I/O Processor" },
-{0x1000, 0x0002, "LSI Logic","53C820","Fast-wide SCSI gg" },
-{0x1000, 0x0003, "LSI Logic","LSI53C1010-33","PCI to SCSI I/O Processor" },
-{0x1000, 0x0004, "LSI Logic","53C815","SCSI raid controllers" },
-{0x1000, 0x0005, "LSI Logic","53C810AP","Fast SCSI" },
-{0x1000, 0x0006, "LSI Logic","LSI53C860/860E","PCI to Ultra SCSI I/O Processor" },
-{0x1000, 0x000A, "LSI Logic","LSI53C1510","PCI Dual Channel Wide Ultra2 SCSI Ctrlr" },
-{0x1000, 0x000B, "LSI Logic","LSI53C896/897","PCI Dual Channel Wide Ultra2 SCSI Ctrlr" },
-{0x1000, 0x000C, "LSI Logic","LSI53C895","PCI to Ultra2 SCSI I/O Processor" },
-{0x1000, 0x000D, "LSI Logic","53C885","Ultra Wide SCSI, Ethernet" },
-{0x1000, 0x000F, "LSI Logic","53C875/875E/876/876E","PCI to Ultra SCSI I/O Processor" },
-{0x1000, 0x0010, "LSI Logic","LSI53C1510","I2O-Ready PCI RAID Ultra2 SCSI Ctrlr" },
-{0x1000, 0x0012, "LSI Logic","LSI53C895A","PCI to Ultra2 SCSI Controller" },
-{0x1000, 0x0013, "LSI Logic","LSI53C875A","PCI to Ultra SCSI Controller" },
-{0x1000, 0x0020, "LSI Logic","LSI53C1010-33","PCI to Dual Channel Ultra3 SCSI Ctrlr" },
-{0x1000, 0x0021, "LSI Logic","LSI53C1000/1000R/1010R/1010-66","PCI to Ultra160 SCSI Controller" },
-{0x1000, 0x0030, "LSI Logic","LSI53C1020/1030","PCI-X to Ultra320 SCSI Controller" },
-{0x1000, 0x0031, "LSI Logic","LSI53C1030ZC","PCI-X SCSI Controller" },
-{0x1000, 0x0032, "LSI Logic","LSI53C1035","PCI-X to Ultra320 SCSI Controller" },
-{0x1000, 0x0035, "LSI Logic","LSI53C1035","PCI-X SCSI Controller" },
-{0x1000, 0x0040, "LSI Logic","LSI53C1035","PCI-X to Ultra320 SCSI Controller" },
-{0x1000, 0x0050, "LSI Logic","LSISAS1068E","LSISAS1068E / LSI SAS 6i RAID Controller" },
-{0x1000, 0x0054, "LSI Logic","LSISAS1068","LSI Adapter SAS 3000 series 8-port with 1068" },
-{0x1000, 0x0056, "LSI Logic","LSISAS1064ET","PCI-Express Fusion-MPT SAS" },
-{0x1000, 0x0058, "LSI Logic","LSISAS1068E","PCI-Express Fusion-MPT SAS" },
-{0x1000, 0x005B, "LSI Logic","LSISAS2108/2208","LSI Logic / Symbios Logic MegaRAID SAS 2208 [Thunderbolt] [1000:005b] (rev 05)" },
-{0x1000, 0x005e, "LSI Logic","LSISAS1066","PCI-X Fusion-MPT SAS" },
-{0x1000, 0x0060, "LSI Logic","0x1734","0x10f9" },
-{0x1000, 0x0062, "LSI Logic","LSISAS1078","PCI-Express Fusion-MPT SAS" },
-{0x1000, 0x0064, "LSI Logic","LSISAS2116","PCI-Express Fusion-MPT SAS 2.0" },
-{0x1000, 0x0072, "LSI Logic","SAS2008","Dell PERC H200" },
-{0x1000, 0x0073, "LSI Logic","LSISAS2008","IBM ServeRAID M1015, Dell Perc H310" },
-{0x1000, 0x0080, "LSI Logic","LSI Logic SAS2208","PCI-Express Fusion-MPT SAS 2.0/2.5" },
-{0x1000, 0x008F, "LSI Logic","53C810","LSI 53C8xx SCSI host adapter chip" },
-{0x1000, 0x0097, "LSI Logic","LSISAS3008","SAS3008 PCI-Express Fusion-MPT SAS-3" },
-{0x1000, 0x0408, "LSI Logic","L3-01037-03D","U320-2E Raid Controller" },
-{0x1000, 0x0621, "LSI Logic","LSIFC909","Fibre Channel I/O Processor" },
-{0x1000, 0x0622, "LSI Logic","53c885","Dial Channel Fibre Channel I/O Processor" },
-{0x1000, 0x0623, "LSI Logic","LSIFC929","Dual Channel Fibre Channel I/O Processor" },
-{0x1000, 0x0624, "LSI Logic","LSIFC919","Fibre Channel I/O Processor" },
-{0x1000, 0x0625, "LSI Logic","LSIFC919","Fibre Channel I/O Processor" },
-{0x1000, 0x0626, "LSI Logic","LSIFC929X","Fibre Channel Adapter" },
-{0x1000, 0x0628, "LSI Logic","LSIFC919X","Fibre Channel Adapter" },
-{0x1000, 0x0630, "LSI Logic","LSIFC920","Fibre Channel I/O Processor" },
-{0x1000, 0x0640, "LSI Logic","LSIFC949X","Fibre Channel Adapter" },
-{0x1000, 0x0642, "LSI Logic","LSIFC939X","Fibre Channel Adapter" },
-{0x1000, 0x0646, "LSI Logic","LSIFC949ES","Fibre Channel Adapter" },
-{0x1000, 0x0701, "LSI Logic","53C885","10/100 MBit Ethernet" },
-{0x1000, 0x0702, "LSI Logic","Yellowfin G-NIC","Gigabit Ethernet Controller" },
-{0x1000, 0x0901, "LSI Logic","61C102","USB Controller" },
-{0x1000, 0x1000, "LSI Logic","63C815","Fast SCSI Controller" },
-{0x1000, 0x1001, "LSI Logic","53C895","Symbios Ultra2 SCSI controller" },
-{0x1000, 0x1010, "LSI Logic","LSI 53C102000","Single channel SCSI controller" },
-{0x1000, 0x1020, "LSI Logic","LSI53C1020","LSI Logic MegaRAID 320-1 Dell PowerEdge PERC 4/SC" },
-{0x1000, 0x1960, "LSI Logic","6002432","RAID Controller" },
-{0x1000, 0x3050, "LSI Logic","LSISAS2008","PCI-Express Fusion-MPT SAS 2.0" },
-{0x1000, 0x9876, "LSI Logic","7DB82C.YF.F.3.25","5946504E44383243" },
-{0x1001, 0x0010, "Kolter Electronic - Germany","ispLSI1032E","PCI 1616, 16 TTL-IN, 16 TTL-OUT" },
-{0x1001, 0x0011, "Kolter Electronic - Germany","ispLSI1032E","OPTO-PCI, 16 IN / 16 OUT 24 VDC" },
-{0x1001, 0x0012, "Kolter Electronic - Germany","ispLSI1032E","PCI-AD, PCI-ADDA analog I/O-card" },
-{0x1001, 0x0013, "Kolter Electronic - Germany","ispLSI1032E","PCI-OptoRel, PCI-Relais 16 Relais & Opto" },
-{0x1001, 0x0014, "Kolter Electronic - Germany","ispLSI1032E","Timer, Pulse & Counter-card 16..32 bit" },
-{0x1001, 0x0015, "Kolter Electronic - Germany","ispLSI1032E","PCI-DAC416, 4 channel D/A16bit precision" },
-{0x1001, 0x0016, "Kolter Electronic - Germany","ispLSI1032E","PCI-MFB high-speed analog I/O" },
-{0x1001, 0x0017, "Kolter Electronic - Germany","ispLSI1032E","PROTO-3 PCI, digital I/O with chipselect" },
-{0x1001, 0x0020, "Kolter Electronic - Germany","ispLSI1032E","Universal digital I/O PCI-Interface" },
-{0x1002, 0x4370, "Advanced Micro Devices, Inc.","RV370","ATI RADEON X300/X550/X1050 Series Secondary" },
-{0x1002, 0x6760, "Advanced Micro Devices, Inc.","6470M","AMD Radeon HD 6470M" },
-{0x1002, 0x0100, "Advanced Micro Devices, Inc.","{4D36E972-E325-11CE-BFC1-08002BE10318}\\0016","{4D36E972-E325-11CE-BFC1-08002BE10318}\\0016" },
-{0x1002, 0x0002, "Advanced Micro Devices, Inc.","EMU10K1","Audio Cipset (SB) Livel" },
-{0x1002, 0x000D, "Advanced Micro Devices, Inc.","bhjkh","ATI RADEON X1200 &#1089;&#1077;&#1088;&#1080;&#1080;" },
-{0x1002, 0x0300, "Advanced Micro Devices, Inc.","1002","PCI" },
-{0x1002, 0x0B12, "Advanced Micro Devices, Inc.","R580","ATI Radeon X1900" },
-{0x1002, 0x1002, "Advanced Micro Devices, Inc.","0x675d pcie","0x675d pcie" },
-{0x1002, 0x1028, "Advanced Micro Devices, Inc.","R9 200","Radeon R9 200 Series" },
-{0x1002, 0x1043, "Advanced Micro Devices, Inc.","RV410","ATI MOBILITY/ATI RADEON X700" },
-{0x1002, 0x11, "Advanced Micro Devices, Inc.","0x215r2qzua21","0xbcg62" },
-{0x1002, 0x1111, "Advanced Micro Devices, Inc.","ATI Technologies Inc. / Advanced Micro Devices, In","ATI Technologies Inc. " },
-{0x1002, 0x1202, "Advanced Micro Devices, Inc.","1202","PCI standard host CPU bridge" },
-{0x1002, 0x1313, "Advanced Micro Devices, Inc.","Q770","AMD Radeon R7 Series" },
-{0x1002, 0x1314, "Advanced Micro Devices, Inc.","1314","High Definition Audio Controller" },
-{0x1002, 0x1400, "Advanced Micro Devices, Inc.","1400","PCI standard host CPU bridge" },
-{0x1002, 0x1401, "Advanced Micro Devices, Inc.","1401","PCI standard host CPU bridge" },
-{0x1002, 0x1402, "Advanced Micro Devices, Inc.","1402","PCI standard host CPU bridge" },
-{0x1002, 0x1403, "Advanced Micro Devices, Inc.","1403","PCI standard host CPU bridge" },
-{0x1002, 0x1404, "Advanced Micro Devices, Inc.","1404","PCI standard host CPU bridge" },
-{0x1002, 0x1405, "Advanced Micro Devices, Inc.","1405","PCI standard host CPU bridge" },
-{0x1002, 0x1410, "Advanced Micro Devices, Inc.","1410","PCI standard host CPU bridge" },
-{0x1002, 0x1417, "Advanced Micro Devices, Inc.","1417","PCI Express standard Root Port" },
-{0x1002, 0x1419, "Advanced Micro Devices, Inc.","1419","IOMMU Device" },
-{0x1002, 0x1631, "Advanced Micro Devices, Inc.","0000","bus" },
-{0x1002, 0x1714, "Advanced Micro Devices, Inc.","A4-3400","AMD Radeon™ HD 6410D Audio" },
-{0x1002, 0x1ab8, "Advanced Micro Devices, Inc.","2","ati radeon " },
-{0x1002, 0x3150, "Advanced Micro Devices, Inc.","M24","ATI MOBILITY /ATI RADEON X600" },
-{0x1002, 0x3151, "Advanced Micro Devices, Inc.","RV380","ATI FireMV 2400" },
-{0x1002, 0x3152, "Advanced Micro Devices, Inc.","M24","ATI MOBILITY /ATI RADEON X300" },
-{0x1002, 0x3154, "Advanced Micro Devices, Inc.","M24GL","ATI MOBILITY FireGL V3200" },
-{0x1002, 0x3171, "Advanced Micro Devices, Inc.","RV380","ATI FireMV 2400 Secondary" },
-{0x1002, 0x3E50, "Advanced Micro Devices, Inc.","PCI\\VEN_1002&DEV_68A8&SUBSYS_159B103C&REV_00","ATI RADEON 6870" },
-{0x1002, 0x3E54, "Advanced Micro Devices, Inc.","RV380GL","ATI FireGL V3200" },
-{0x1002, 0x3E70, "Advanced Micro Devices, Inc.","RV380","ATI RADEON X600/X550 Series Secondary" },
-{0x1002, 0x3E74, "Advanced Micro Devices, Inc.","RV380GL","ATI FireGL V3200 Secondary" },
-{0x1002, 0x4136, "Advanced Micro Devices, Inc.","A3","Radeon IGP 320" },
-{0x1002, 0x4137, "Advanced Micro Devices, Inc.","RS200","Radeon IGP 340m" },
-{0x1002, 0x4143, "Advanced Micro Devices, Inc.","9550","X1050" },
-{0x1002, 0x4144, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9500" },
-{0x1002, 0x4145, "Advanced Micro Devices, Inc.","R300","Radeon 9200 (M+X)" },
-{0x1002, 0x4146, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9600TX" },
-{0x1002, 0x4147, "Advanced Micro Devices, Inc.","R300GL","ATI FireGL Z1" },
-{0x1002, 0x4148, "Advanced Micro Devices, Inc.","R350","ATI RADEON 9800 SE" },
-{0x1002, 0x4149, "Advanced Micro Devices, Inc.","R350","ATI RADEON 9500" },
-{0x1002, 0x4150, "Advanced Micro Devices, Inc.","RV_00","ATI RADEON 9600 Pro Family (Microsoft Driver)" },
-{0x1002, 0x4151, "Advanced Micro Devices, Inc.","RV350","ATI RADEON 9600 Series" },
-{0x1002, 0x4152, "Advanced Micro Devices, Inc.","RV360","ATI RADEON 9600 Series" },
-{0x1002, 0x4153, "Advanced Micro Devices, Inc.","RV350","ATI RADEON 9550/X1050 Series" },
-{0x1002, 0x4154, "Advanced Micro Devices, Inc.","RV350GL","ATI FireGL T2" },
-{0x1002, 0x4155, "Advanced Micro Devices, Inc.","RV350","ATI RADEON 9600 Series" },
-{0x1002, 0x4158, "Advanced Micro Devices, Inc.","AA01","PCI\\VEN_1002&DEV_AAC8&SUBSYS_AAC8174B&REV_00" },
-{0x1002, 0x4164, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9500 Secondary" },
-{0x1002, 0x4166, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9600TX Secondary" },
-{0x1002, 0x4167, "Advanced Micro Devices, Inc.","R300GL","ATI FireGL Z1 Secondary" },
-{0x1002, 0x4168, "Advanced Micro Devices, Inc.","R350","ATI RADEON 9800 SE Secondary" },
-{0x1002, 0x4169, "Advanced Micro Devices, Inc.","R350","ATI RADEON 9500 Secondary" },
-{0x1002, 0x4170, "Advanced Micro Devices, Inc.","RV_00","ATI RADEON 9600/9550/x1050 Series Secondary (" },
-{0x1002, 0x4171, "Advanced Micro Devices, Inc.","RV350","ATI RADEON 9600 Series Secondary" },
-{0x1002, 0x4172, "Advanced Micro Devices, Inc.","REV_00","ATI RADEON 9600 Series Secondary" },
-{0x1002, 0x4173, "Advanced Micro Devices, Inc.","4484","ATI RADEON 9550/X1050 Series Secondary" },
-{0x1002, 0x4174, "Advanced Micro Devices, Inc.","RV350GL","ATI FireGL T2 Secondary" },
-{0x1002, 0x4175, "Advanced Micro Devices, Inc.","RV350","RADEON 9200 pro secundar" },
-{0x1002, 0x4242, "Advanced Micro Devices, Inc.","R200AIW","All-In-Wonder 8500DV" },
-{0x1002, 0x4243, "Advanced Micro Devices, Inc.","","Lucent OHCI IEEE1394 Host Controller" },
-{0x1002, 0x4336, "Advanced Micro Devices, Inc.","rs200","Radeon IGP 320M" },
-{0x1002, 0x4337, "Advanced Micro Devices, Inc.","RS200M","RADEON IGP 345M" },
-{0x1002, 0x4341, "Advanced Micro Devices, Inc.","SB200","AC'97 Audio Controller" },
-{0x1002, 0x4342, "Advanced Micro Devices, Inc.","SB200","PCI-PCI Bridge" },
-{0x1002, 0x4345, "Advanced Micro Devices, Inc.","SB200","EHCI USB Controller" },
-{0x1002, 0x4347, "Advanced Micro Devices, Inc.","SB200","USB Controller" },
-{0x1002, 0x4348, "Advanced Micro Devices, Inc.","SB200","USB Controller" },
-{0x1002, 0x4349, "Advanced Micro Devices, Inc.","SB200","PATA-100 IDE Controller" },
-{0x1002, 0x434C, "Advanced Micro Devices, Inc.","SB200","PCI-ISA Bridge" },
-{0x1002, 0x434d, "Advanced Micro Devices, Inc.","SB200","AC'97 Modem Controller" },
-{0x1002, 0x4353, "Advanced Micro Devices, Inc.","SB200","SMBus Controller" },
-{0x1002, 0x4354, "Advanced Micro Devices, Inc.","215CT","Mach64 CT" },
-{0x1002, 0x4358, "Advanced Micro Devices, Inc.","113-A52021-104","PCI\\VEN_1002&DEV_9553&SUBSYS_00821043&REV_00" },
-{0x1002, 0x4361, "Advanced Micro Devices, Inc.","ALC665","ATI AC97 REALTEK AUDIO DRIVER" },
-{0x1002, 0x4363, "Advanced Micro Devices, Inc.","SB300","ATI SOUTH BRIDGE SB300 DRIVER" },
-{0x1002, 0x4369, "Advanced Micro Devices, Inc.","IXP 3xx","PATA 133 Controller" },
-{0x1002, 0x436E, "Advanced Micro Devices, Inc.","IXP 3xx","ATI 436E Serial ATA Controller" },
-{0x1002, 0x4370, "Advanced Micro Devices, Inc.","SB400","AC-Link Audio" },
-{0x1002, 0x4371, "Advanced Micro Devices, Inc.","IXP SB400","PCI Standard PCI-to-PCI bridge" },
-{0x1002, 0x4372, "Advanced Micro Devices, Inc.","SMBus Controller","SMBus Controller" },
-{0x1002, 0x4373, "Advanced Micro Devices, Inc.","IXP SB400","Standard Enhanced PCI to USB Host Controller" },
-{0x1002, 0x4374, "Advanced Micro Devices, Inc.","IXP SB400","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x4375, "Advanced Micro Devices, Inc.","IXP SB400","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x4376, "Advanced Micro Devices, Inc.","SB4xx","PATA 133 Controller" },
-{0x1002, 0x4377, "Advanced Micro Devices, Inc.","IXP SB400","PCI Stanard ISA Bridge" },
-{0x1002, 0x4378, "Advanced Micro Devices, Inc.","SB400","AC'97 Modem Controller" },
-{0x1002, 0x4379, "Advanced Micro Devices, Inc.","SB400 / SB450 (Sil3112)","ATI 4379 Serial ATA Controller" },
-{0x1002, 0x437A, "Advanced Micro Devices, Inc.","SB4xx","ATI 437A Serial ATA Controller" },
-{0x1002, 0x437B, "Advanced Micro Devices, Inc.","SB450","High Definition Audio Controller " },
-{0x1002, 0x4381, "Advanced Micro Devices, Inc.","ATI ?","AHCI/Raid Controller" },
-{0x1002, 0x4383, "Advanced Micro Devices, Inc.","SB700","High Definition Audio controller" },
-{0x1002, 0x4384, "Advanced Micro Devices, Inc.","4384","ATI I/O Communications Processor PCI Bus Controller" },
-{0x1002, 0x4385, "Advanced Micro Devices, Inc.","ATI RD600/RS600","ATI I/O Communications Processor SMBus Controller" },
-{0x1002, 0x4386, "Advanced Micro Devices, Inc.","690G","Northbridge" },
-{0x1002, 0x4387, "Advanced Micro Devices, Inc.","4387","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x4388, "Advanced Micro Devices, Inc.","4388","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x4389, "Advanced Micro Devices, Inc.","4389","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x438A, "Advanced Micro Devices, Inc.","438A","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x438B, "Advanced Micro Devices, Inc.","438B","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x438C, "Advanced Micro Devices, Inc.","RD600/RS600","ATI RD600/RS600 IDE Controller" },
-{0x1002, 0x438D, "Advanced Micro Devices, Inc.","SB600","PCI to LPC Bridge" },
-{0x1002, 0x439, "Advanced Micro Devices, Inc.","rv360","ATI Technologies SB700 LPCHost Controller" },
-{0x1002, 0x4390, "Advanced Micro Devices, Inc.","SB750","Integrated SATA II Controller" },
-{0x1002, 0x4391, "Advanced Micro Devices, Inc.","ATI SB700","AHCI Controller" },
-{0x1002, 0x4392, "Advanced Micro Devices, Inc.","ATI SB700","Raid Controller" },
-{0x1002, 0x4393, "Advanced Micro Devices, Inc.","ATI SB850","RAID-Controller" },
-{0x1002, 0x4394, "Advanced Micro Devices, Inc.","5100","AMD SP5100 South Bridge" },
-{0x1002, 0x4396, "Advanced Micro Devices, Inc.","210888CX","Standard Enhanced PCI to USB Host Controller" },
-{0x1002, 0x4397, "Advanced Micro Devices, Inc.","4397","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x4398, "Advanced Micro Devices, Inc.","SB700","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x439C, "Advanced Micro Devices, Inc.","SB7xx","PATA 133 Controller" },
-{0x1002, 0x439D, "Advanced Micro Devices, Inc.","SB700 LPC","74A" },
-{0x1002, 0x43A0, "Advanced Micro Devices, Inc.","43A0","PCI Express standard Root Port" },
-{0x1002, 0x43A3, "Advanced Micro Devices, Inc.","43A3","PCI Express standard Root Port" },
-{0x1002, 0x4437, "Advanced Micro Devices, Inc.","ATI Mobility Radeon 7000 IGP","RS250M" },
-{0x1002, 0x4554, "Advanced Micro Devices, Inc.","Mach64 ET","" },
-{0x1002, 0x4654, "Advanced Micro Devices, Inc.","Mach64 VT","113--34004-104" },
-{0x1002, 0x4742, "Advanced Micro Devices, Inc.","(GT-C2U2)","3D Rage Pro AGP 1X" },
-{0x1002, 0x4744, "Advanced Micro Devices, Inc.","Rage 3D Pro AGP 2x","Rage 3D Pro AGP 2x" },
-{0x1002, 0x4747, "Advanced Micro Devices, Inc.","GT-C2U2","Rage 3D Pro" },
-{0x1002, 0x4749, "Advanced Micro Devices, Inc.","RAGE PRO TURBO AGP 2X","ATI ALL IN WONDER PRO (8MB)" },
-{0x1002, 0x474C, "Advanced Micro Devices, Inc.","Rage XC PCI-66","k7 som+" },
-{0x1002, 0x474D, "Advanced Micro Devices, Inc.","Rage XL AGP 2x","SLAT" },
-{0x1002, 0x474E, "Advanced Micro Devices, Inc.","Rage XC AGP 2x","" },
-{0x1002, 0x474F, "Advanced Micro Devices, Inc.","Rage XL PCI-66","I Need Driver for the Chip" },
-{0x1002, 0x4750, "Advanced Micro Devices, Inc.","1039","ATI 3D Rage Pro 215GP" },
-{0x1002, 0x4751, "Advanced Micro Devices, Inc.","0x1002","0x4752" },
-{0x1002, 0x4752, "Advanced Micro Devices, Inc.","Rage XL PCI","ATI On-Board VGA for HP Proliant 350 G3" },
-{0x1002, 0x4753, "Advanced Micro Devices, Inc.","Rage XC PCI","" },
-{0x1002, 0x4754, "Advanced Micro Devices, Inc.","Mach 64 VT","Rage 3D II Graphics Accelerator" },
-{0x1002, 0x4755, "Advanced Micro Devices, Inc.","Rage 3D II+pci","3d rage 2 + dvd" },
-{0x1002, 0x4756, "Advanced Micro Devices, Inc.","Rage 3D IIC AGP","Graphics Accelerator" },
-{0x1002, 0x4757, "Advanced Micro Devices, Inc.","3D 11C AGP","Rage 3D IIC AGP" },
-{0x1002, 0x4758, "Advanced Micro Devices, Inc.","210888GX","Mach64 GX" },
-{0x1002, 0x4759, "Advanced Micro Devices, Inc.","215r2qzua21","m3d agp card on agp slot" },
-{0x1002, 0x475A, "Advanced Micro Devices, Inc.","215r2qua12","Rage IIC AGP" },
-{0x1002, 0x4966, "Advanced Micro Devices, Inc.","RV250","Radeon 9000/9000 Pro" },
-{0x1002, 0x4967, "Advanced Micro Devices, Inc.","RV250","Radeon 9000" },
-{0x1002, 0x496E, "Advanced Micro Devices, Inc.","RV250","Radeon 9000/9000 Pro - Secondary" },
-{0x1002, 0x496F, "Advanced Micro Devices, Inc.","RV250","Radeon 9000 - Secondary" },
-{0x1002, 0x4A48, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 Series" },
-{0x1002, 0x4a49, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 PRO" },
-{0x1002, 0x4A4A, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 Series" },
-{0x1002, 0x4a4b, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 XT" },
-{0x1002, 0x4A4C, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 Series" },
-{0x1002, 0x4A4D, "Advanced Micro Devices, Inc.","R420GL","ATI FireGL X3-256" },
-{0x1002, 0x4A4E, "Advanced Micro Devices, Inc.","M18","ATI MOBILITY /ATI RADEON 9800" },
-{0x1002, 0x4A4F, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 SE" },
-{0x1002, 0x4A50, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 XT Platinum Edition" },
-{0x1002, 0x4A54, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 VE" },
-{0x1002, 0x4A68, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 Series Secondary" },
-{0x1002, 0x4A69, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 PRO Secondary" },
-{0x1002, 0x4A6A, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 Series Secondary" },
-{0x1002, 0x4a6b, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 XT Secondary" },
-{0x1002, 0x4A6C, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 Series Secondary" },
-{0x1002, 0x4A6D, "Advanced Micro Devices, Inc.","R420GL","ATI FireGL X3-256 Secondary" },
-{0x1002, 0x4A6F, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 SE Secondary" },
-{0x1002, 0x4A70, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 XT Platinum Edition Secondary" },
-{0x1002, 0x4A74, "Advanced Micro Devices, Inc.","R420","ATI RADEON X800 VE Secondary" },
-{0x1002, 0x4B49, "Advanced Micro Devices, Inc.","R481","ATI RADEON X850 XT" },
-{0x1002, 0x4B4B, "Advanced Micro Devices, Inc.","R481","ATI RADEON X850 PRO" },
-{0x1002, 0x4B4C, "Advanced Micro Devices, Inc.","R481","ATI RADEON X850 XT Platinum Edition" },
-{0x1002, 0x4B69, "Advanced Micro Devices, Inc.","R481","ATI RADEON X850 XT Secondary" },
-{0x1002, 0x4B6A, "Advanced Micro Devices, Inc.","R481","ATI RADEON X850 SE Secondary" },
-{0x1002, 0x4B6B, "Advanced Micro Devices, Inc.","R481","ATI RADEON X850 PRO Secondary" },
-{0x1002, 0x4B6C, "Advanced Micro Devices, Inc.","R481","ATI RADEON X850 XT Platinum Edition Secondary" },
-{0x1002, 0x4C42, "Advanced Micro Devices, Inc.","B10E0E11","3D Rage LT Pro AGP-133" },
-{0x1002, 0x4C44, "Advanced Micro Devices, Inc.","Rage 3D LT Pro AGP","Rage 3D LT Pro AGP 133 MHz" },
-{0x1002, 0x4C45, "Advanced Micro Devices, Inc.","","Rage Mobility M3 AGP" },
-{0x1002, 0x4C46, "Advanced Micro Devices, Inc.","Mobility M3 AGP","0x9495" },
-{0x1002, 0x4C47, "Advanced Micro Devices, Inc.","ati rage pro","Rage 3D LT-G" },
-{0x1002, 0x4C49, "Advanced Micro Devices, Inc.","123","Rage 3D LT Pro" },
-{0x1002, 0x4C4D, "Advanced Micro Devices, Inc.","01541014","Rage P/M Mobility AGP 2x" },
-{0x1002, 0x4C4E, "Advanced Micro Devices, Inc.","216lo sasa25","Rage Mobility l" },
-{0x1002, 0x4C50, "Advanced Micro Devices, Inc.","unknown","Rage 3D LT Pro PCI" },
-{0x1002, 0x4C51, "Advanced Micro Devices, Inc.","113","Rage 3D LT Pro PCI" },
-{0x1002, 0x4C52, "Advanced Micro Devices, Inc.","1241243","Rage P/M Mobility agp" },
-{0x1002, 0x4C53, "Advanced Micro Devices, Inc.","216L0SASA25","Rage L Mobility PCI" },
-{0x1002, 0x4C54, "Advanced Micro Devices, Inc.","4372","Mach 64 LT" },
-{0x1002, 0x4C57, "Advanced Micro Devices, Inc.","M7 [LW]","Mobility Radeon 7500" },
-{0x1002, 0x4C58, "Advanced Micro Devices, Inc.","(0x71C1)          DAC type: Internal DAC(400MHz)  ","FireGL Mobility" },
-{0x1002, 0x4C59, "Advanced Micro Devices, Inc.","ATI Mobility Radeon 7000 with 16MB (7500 with 16 o","ATI Mobility Radeon AGP (0x4C59), ATI Technologies Inc. -kompatible" },
-{0x1002, 0x4C5A, "Advanced Micro Devices, Inc.","","Radeon Mobility M6 LZ" },
-{0x1002, 0x4C64, "Advanced Micro Devices, Inc.","","Radeon Mobility M9-GL" },
-{0x1002, 0x4C66, "Advanced Micro Devices, Inc.","RV250","ATI MOBILITY RADEON 9000" },
-{0x1002, 0x4C6E, "Advanced Micro Devices, Inc.","0x4C6E","ATI FireMV 2400 PCI" },
-{0x1002, 0x4D46, "Advanced Micro Devices, Inc.","ATI mobility128","Rage Mobility 128 AGP 4x" },
-{0x1002, 0x4D4C, "Advanced Micro Devices, Inc.","216l0sasa25","Rage Mobility 128 AGP" },
-{0x1002, 0x4D52, "Advanced Micro Devices, Inc.","ATI Theater 550 Pro","ATI Theater 550 Pro" },
-{0x1002, 0x4D53, "Advanced Micro Devices, Inc.","TVT2 Wonder Elite","TVT2 Wonder Elite" },
-{0x1002, 0x4E44, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9700 PRO" },
-{0x1002, 0x4E45, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9500 PRO / 9700" },
-{0x1002, 0x4e46, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9600 TX" },
-{0x1002, 0x4E47, "Advanced Micro Devices, Inc.","R300GL","ATI FireGL X1" },
-{0x1002, 0x4E48, "Advanced Micro Devices, Inc.","R350","ATI RADEON 9800 PRO" },
-{0x1002, 0x4E49, "Advanced Micro Devices, Inc.","R350","ATI RADEON 9800" },
-{0x1002, 0x4E4A, "Advanced Micro Devices, Inc.","R360","ATI RADEON 9800 XT" },
-{0x1002, 0x4E4B, "Advanced Micro Devices, Inc.","R350GL","ATI FireGL X2-256/X2-256t" },
-{0x1002, 0x4E50, "Advanced Micro Devices, Inc.","M10","ATI MOBILITY /ATI RADEON 9600/9700 Series" },
-{0x1002, 0x4E51, "Advanced Micro Devices, Inc.","RV350","ATI RADEON 9600 Series" },
-{0x1002, 0x4E52, "Advanced Micro Devices, Inc.","M10","ATI MOBILITY /ATI RADEON 9500" },
-{0x1002, 0x4E54, "Advanced Micro Devices, Inc.","M10GL","ATI MOBILITY FIRE GL T2/T2e" },
-{0x1002, 0x4E56, "Advanced Micro Devices, Inc.","M12","ATI MOBILITY /ATI RADEON 9400" },
-{0x1002, 0x4E64, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9700" },
-{0x1002, 0x4E65, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9500 PRO / 9700 Secondary" },
-{0x1002, 0x4e66, "Advanced Micro Devices, Inc.","R300","ATI RADEON 9600 TX Secondary" },
-{0x1002, 0x4E67, "Advanced Micro Devices, Inc.","R300GL","ATI FireGL X1 Secondary" },
-{0x1002, 0x4E68, "Advanced Micro Devices, Inc.","R350","ATI RADEON 9800 PRO Secondary" },
-{0x1002, 0x4E69, "Advanced Micro Devices, Inc.","R350","ATI RADEON 9800 Secondary" },
-{0x1002, 0x4E6A, "Advanced Micro Devices, Inc.","R360","ATI RADEON 9800 XT Secondary" },
-{0x1002, 0x4E6B, "Advanced Micro Devices, Inc.","R350GL","ATI FireGL X2-256/X2-256t Secondary" },
-{0x1002, 0x4E71, "Advanced Micro Devices, Inc.","RV350","ATI RADEON 9600 Series Secondary" },
-{0x1002, 0x5041, "Advanced Micro Devices, Inc.","gt","Rage 128 Pro PA PCI" },
-{0x1002, 0x5042, "Advanced Micro Devices, Inc.","rage 128 pf pro agp ","Rage 128 Pro PB AGP 2x" },
-{0x1002, 0x5043, "Advanced Micro Devices, Inc.","1231324445","Rage 128 Pro PC AGP 4x" },
-{0x1002, 0x5044, "Advanced Micro Devices, Inc.","rv100","Rage 128 Pro PD PCI" },
-{0x1002, 0x5045, "Advanced Micro Devices, Inc.","","Rage 128 Pro PE AGP 2x" },
-{0x1002, 0x5046, "Advanced Micro Devices, Inc.","R128","Rage 128 Pro PF AGP 4x" },
-{0x1002, 0x5047, "Advanced Micro Devices, Inc.","215R3BUA22"," 3d Rage pro agp 2x" },
-{0x1002, 0x5048, "Advanced Micro Devices, Inc.","8212104D","Rage 128 Pro PH AGP 2x" },
-{0x1002, 0x5049, "Advanced Micro Devices, Inc.","R128","Rage 128 Pro PI AGP 4x" },
-{0x1002, 0x504A, "Advanced Micro Devices, Inc.","Rage 128 Pro PJ PCI","Rage 128 Pro PJ PCI (TMDS)" },
-{0x1002, 0x504B, "Advanced Micro Devices, Inc.","Rage 128 Pro PK AGP","Rage 128 Pro PK AGP 2x (TMDS)" },
-{0x1002, 0x504C, "Advanced Micro Devices, Inc.","Rage 128 Pro PL AGP","4x (TMDS)" },
-{0x1002, 0x504D, "Advanced Micro Devices, Inc.","Rage 128 Pro PM PCI","Rage 128 Pro PM PCI" },
-{0x1002, 0x504E, "Advanced Micro Devices, Inc.","Rage 128 Pro PN AGP","Rage 128 Pro PN AGP 2x" },
-{0x1002, 0x504F, "Advanced Micro Devices, Inc.","Rage 128 Pro PO AGP","Rage 128 Pro PO AGP 4x" },
-{0x1002, 0x5050, "Advanced Micro Devices, Inc.","Scheda Grafica Standard PCI(VGA)","Rage 128 Pro PP PCI (TMDS)" },
-{0x1002, 0x5051, "Advanced Micro Devices, Inc.","Rage 128 Pro PQ AGP","Rage 128 Pro PQ AGP 2x (TMDS)" },
-{0x1002, 0x5052, "Advanced Micro Devices, Inc.","Rage 128 Pro PR AGP","Rage 128 Pro PR AGP 4x (TMDS)" },
-{0x1002, 0x5053, "Advanced Micro Devices, Inc.","Rage 128 Pro PS PCI","Rage 128 Pro PS PCI" },
-{0x1002, 0x5054, "Advanced Micro Devices, Inc.","Rage 128 Pro PT AGP","Rage 128 Pro PT AGP 2x" },
-{0x1002, 0x5055, "Advanced Micro Devices, Inc.","rage 128 pro agp 4x tmds","rage 128 pro agp 4x tmds" },
-{0x1002, 0x5056, "Advanced Micro Devices, Inc.","Rage 128 Pro PV PCI","Rage 128 Pro PV PCI (TMDS)" },
-{0x1002, 0x5057, "Advanced Micro Devices, Inc.","Rage 128 Pro PW AGP","Rage 128 Pro PW AGP 2x (TMDS)" },
-{0x1002, 0x5058, "Advanced Micro Devices, Inc.","Rage 128 Pro","PX AGP 4x (TMDS)" },
-{0x1002, 0x5144, "Advanced Micro Devices, Inc.","Radeon 7200 QD SDR/DDR","Radeon 7200 QD SDR/DDR" },
-{0x1002, 0x5145, "Advanced Micro Devices, Inc.","","Radeon QE" },
-{0x1002, 0x5146, "Advanced Micro Devices, Inc.","","Radeon QF" },
-{0x1002, 0x5147, "Advanced Micro Devices, Inc.","","Radeon QG" },
-{0x1002, 0x5148, "Advanced Micro Devices, Inc.","R200","Radeon R200 QH" },
-{0x1002, 0x5149, "Advanced Micro Devices, Inc.","","Radeon R200 QI" },
-{0x1002, 0x514A, "Advanced Micro Devices, Inc.","","Radeon R200 QJ" },
-{0x1002, 0x514B, "Advanced Micro Devices, Inc.","","Radeon R200 QK" },
-{0x1002, 0x514C, "Advanced Micro Devices, Inc.","R200","Radeon 8500 / 8500LE" },
-{0x1002, 0x514D, "Advanced Micro Devices, Inc.","R200","Redeon 9100 Series" },
-{0x1002, 0x514E, "Advanced Micro Devices, Inc.","","Radeon R200 QM" },
-{0x1002, 0x514F, "Advanced Micro Devices, Inc.","","Radeon R200 QN" },
-{0x1002, 0x5157, "Advanced Micro Devices, Inc.","RV200","Radeon 7500" },
-{0x1002, 0x5158, "Advanced Micro Devices, Inc.","radeon 9200","Radeon 7500 QX" },
-{0x1002, 0x5159, "Advanced Micro Devices, Inc.","RV100","Radeon 7000 series AGP " },
-{0x1002, 0x515A, "Advanced Micro Devices, Inc.","","Radeon VE QZ" },
-{0x1002, 0x515E, "Advanced Micro Devices, Inc.","Radeon ES1000","Radeon ES1000" },
-{0x1002, 0x5168, "Advanced Micro Devices, Inc.","ati","Radeon R200 Qh" },
-{0x1002, 0x5169, "Advanced Micro Devices, Inc.","","Radeon R200 Qi" },
-{0x1002, 0x516A, "Advanced Micro Devices, Inc.","","Radeon R200 Qj" },
-{0x1002, 0x516B, "Advanced Micro Devices, Inc.","","Radeon R200 Qk" },
-{0x1002, 0x516C, "Advanced Micro Devices, Inc.","E7505","Radeon 8500 / 8500LE" },
-{0x1002, 0x516D, "Advanced Micro Devices, Inc.","R200","Redeon 9100 Series - Secondary" },
-{0x1002, 0x5245, "Advanced Micro Devices, Inc.","215R2QZUA21","Rage 128 GL PCI" },
-{0x1002, 0x5246, "Advanced Micro Devices, Inc.","Rage 128","Rage 32MB" },
-{0x1002, 0x5247, "Advanced Micro Devices, Inc.","Rage 32MB","Rage 128 RG" },
-{0x1002, 0x524B, "Advanced Micro Devices, Inc.","g01080-108","Rage 128 VR RK PCI" },
-{0x1002, 0x524C, "Advanced Micro Devices, Inc.","","Rage 128 VR RL AGP 2x" },
-{0x1002, 0x5345, "Advanced Micro Devices, Inc.","","Rage 128 4x SE PCI" },
-{0x1002, 0x5346, "Advanced Micro Devices, Inc.","Rage 128 SF 4x AGP 2x","Rage 128 SF 4x AGP 2x" },
-{0x1002, 0x5347, "Advanced Micro Devices, Inc.","","Rage 128 SG 4x AGP 4x" },
-{0x1002, 0x5348, "Advanced Micro Devices, Inc.","","Rage 128 4x SH" },
-{0x1002, 0x534B, "Advanced Micro Devices, Inc.","Rage 128 SK PCI","Rage 128 4x SK PCI" },
-{0x1002, 0x534C, "Advanced Micro Devices, Inc.","Rage 128 SL AGP 2x","Rage 128 4x SL AGP 2x" },
-{0x1002, 0x534D, "Advanced Micro Devices, Inc.","Rage 128 SM AGP 4x","Rage 128 4x SM AGP 4x" },
-{0x1002, 0x534E, "Advanced Micro Devices, Inc.","Rage 128 4x","" },
-{0x1002, 0x5354, "Advanced Micro Devices, Inc.","","Mach 64 ST" },
-{0x1002, 0x5446, "Advanced Micro Devices, Inc.","unknown","Rage 128 Pro Ultra TF" },
-{0x1002, 0x544C, "Advanced Micro Devices, Inc.","","Rage 128 Pro TL" },
-{0x1002, 0x5452, "Advanced Micro Devices, Inc.","5452","Rage 128 Pro TR" },
-{0x1002, 0x5455, "Advanced Micro Devices, Inc.","","Rage 128 Pro Ultra TU" },
-{0x1002, 0x5457, "Advanced Micro Devices, Inc.","RS200M","RADEON IGP 345M" },
-{0x1002, 0x5460, "Advanced Micro Devices, Inc.","M22","ATI MOBILITY /ATI RADEON X300" },
-{0x1002, 0x5461, "Advanced Micro Devices, Inc.","M22","ATI MOBILITY /ATI RADEON X300" },
-{0x1002, 0x5462, "Advanced Micro Devices, Inc.","M24C","ATI MOBILITY /ATI RADEON X600 SE" },
-{0x1002, 0x5464, "Advanced Micro Devices, Inc.","M22GL","ATI MOBILITY FireGL V3100" },
-{0x1002, 0x5548, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 Series" },
-{0x1002, 0x5549, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 GTO" },
-{0x1002, 0x554A, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 XT Platinum Edition" },
-{0x1002, 0x554b, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 GT" },
-{0x1002, 0x554D, "Advanced Micro Devices, Inc.","R430","ATI RADEON X800 CrossFire Edition" },
-{0x1002, 0x554E, "Advanced Micro Devices, Inc.","R430","ATI RADEON X800 GT" },
-{0x1002, 0x554F, "Advanced Micro Devices, Inc.","R430","ATI RADEON X800 GTO" },
-{0x1002, 0x5550, "Advanced Micro Devices, Inc.","R423GL","ATI FireGL V7100" },
-{0x1002, 0x5551, "Advanced Micro Devices, Inc.","R423GL","ATI FireGL V5100" },
-{0x1002, 0x5568, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 Series Secondary" },
-{0x1002, 0x5569, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 GTO Secondary" },
-{0x1002, 0x556A, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 XT Platinum Edition Secondary" },
-{0x1002, 0x556B, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 GT Secondary" },
-{0x1002, 0x556D, "Advanced Micro Devices, Inc.","R430","ATI RADEON X800 CrossFire Edition Secondary" },
-{0x1002, 0x556E, "Advanced Micro Devices, Inc.","R430","ATI RADEON X800 GT Secondary" },
-{0x1002, 0x556F, "Advanced Micro Devices, Inc.","R430","ATI RADEON X800 GTO Secondary" },
-{0x1002, 0x5570, "Advanced Micro Devices, Inc.","R423GL","ATI FireGL V7100 Secondary" },
-{0x1002, 0x5571, "Advanced Micro Devices, Inc.","R423GL","ATI FireGL V5100  Secondary" },
-{0x1002, 0x564A, "Advanced Micro Devices, Inc.","M26GL","ATI MOBILITY FireGL V5000" },
-{0x1002, 0x564B, "Advanced Micro Devices, Inc.","M26GL","ATI MOBILITY FireGL V5000" },
-{0x1002, 0x564F, "Advanced Micro Devices, Inc.","M26","ATI MOBILITY /ATI RADEON X700 XL" },
-{0x1002, 0x5652, "Advanced Micro Devices, Inc.","M26","ATI MOBILITY /ATI RADEON X700" },
-{0x1002, 0x5653, "Advanced Micro Devices, Inc.","RV410","ATI MOBILITY/ATI RADEON X700" },
-{0x1002, 0x5654, "Advanced Micro Devices, Inc.","264VT","Mach64 VT" },
-{0x1002, 0x5655, "Advanced Micro Devices, Inc.","","Mach 64 VT3" },
-{0x1002, 0x5656, "Advanced Micro Devices, Inc.","Mach 64 VT4 PCI","Mach 64 VT4 PCI" },
-{0x1002, 0x5657, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X550/X700 Series" },
-{0x1002, 0x5673, "Advanced Micro Devices, Inc.","M26","ATI MOBILITY /ATI RADEON X700 Secondary" },
-{0x1002, 0x5677, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X550/X700 Series Secondary" },
-{0x1002, 0x5830, "Advanced Micro Devices, Inc.","RS300","Host Bridge" },
-{0x1002, 0x5831, "Advanced Micro Devices, Inc.","RS300","Host Bridge" },
-{0x1002, 0x5832, "Advanced Micro Devices, Inc.","RS300","Host Bridge" },
-{0x1002, 0x5833, "Advanced Micro Devices, Inc.","RS300M","ATI Radeon 9000/9100 IGP Chipset - Host-PCI Bridge" },
-{0x1002, 0x5834, "Advanced Micro Devices, Inc.","RS300","Radeon 9100 IGP" },
-{0x1002, 0x5835, "Advanced Micro Devices, Inc.","RS300M","Mobilitiy Radeon 9000 IGP (RGP)" },
-{0x1002, 0x5838, "Advanced Micro Devices, Inc.","RS330M","ATI Radeon 9000/9100 IGP Chipset - AGP Controller" },
-{0x1002, 0x5854, "Advanced Micro Devices, Inc.","RS480","ATI RADEON Xpress Series" },
-{0x1002, 0x5874, "Advanced Micro Devices, Inc.","RS482","ATI RADEON Xpress Series" },
-{0x1002, 0x5940, "Advanced Micro Devices, Inc.","RV280","Radeon 9200 Pro Secondary" },
-{0x1002, 0x5941, "Advanced Micro Devices, Inc.","RV280","ATI Radeon 9200 - Secondary" },
-{0x1002, 0x5950, "Advanced Micro Devices, Inc.","RS480","PCI standard Host CPU Bridge" },
-{0x1002, 0x5954, "Advanced Micro Devices, Inc.","RS482","ATI RADEON Xpress 200" },
-{0x1002, 0x5955, "Advanced Micro Devices, Inc.","RS480M","ATI RADEON Xpress 200M" },
-{0x1002, 0x5960, "Advanced Micro Devices, Inc.","RV280","Radeon 9200 Pro" },
-{0x1002, 0x5961, "Advanced Micro Devices, Inc.","RV280","ATI RADEON 9200 se agp" },
-{0x1002, 0x5962, "Advanced Micro Devices, Inc.","Rev_01","Radeon 9200" },
-{0x1002, 0x5964, "Advanced Micro Devices, Inc.","Radeon 9200","Radeon 9200 SE Series" },
-{0x1002, 0x5965, "Advanced Micro Devices, Inc.","unknown","FireMV 2200" },
-{0x1002, 0x5974, "Advanced Micro Devices, Inc.","RS482","ATI RADEON Xpress Series" },
-{0x1002, 0x5975, "Advanced Micro Devices, Inc.","RS482M (200M)","ATI RADEON Xpress Series" },
-{0x1002, 0x5a23, "Advanced Micro Devices, Inc.","RD890","AMD IOMMU" },
-{0x1002, 0x5a31, "Advanced Micro Devices, Inc.","RS400/133","Host Bridge" },
-{0x1002, 0x5A33, "Advanced Micro Devices, Inc.","RC410","Northbridge: Radeon Xpress 200" },
-{0x1002, 0x5A3F, "Advanced Micro Devices, Inc.","5A3F","PCI standard PCI-to-PCI bridge" },
-{0x1002, 0x5A41, "Advanced Micro Devices, Inc.","RS400","ATI RADEON Xpress Series" },
-{0x1002, 0x5A42, "Advanced Micro Devices, Inc.","RS400M","ATI RADEON Xpress Series" },
-{0x1002, 0x5A43, "Advanced Micro Devices, Inc.","RS400","ATI RADEON Xpress Series" },
-{0x1002, 0x5A60, "Advanced Micro Devices, Inc.","SUBSYS_FF311179","Video Controller" },
-{0x1002, 0x5A61, "Advanced Micro Devices, Inc.","RC410","ATI Radeon Xpress 200" },
-{0x1002, 0x5A62, "Advanced Micro Devices, Inc.","PCI\\VEN_1002&DEV_5A62&SUBSYS_2A051584&REV_00","ATI Radeon X 200" },
-{0x1002, 0x5A63, "Advanced Micro Devices, Inc.","RC410","ATI RADEON Xpress Series" },
-{0x1002, 0x5b60, "Advanced Micro Devices, Inc.","RV370","ATI RADEON X300/X550/X1050 Series.." },
-{0x1002, 0x5b62, "Advanced Micro Devices, Inc.","RV380x","ATI RADEON X600 Series" },
-{0x1002, 0x5B63, "Advanced Micro Devices, Inc.","REV_00\\4&178951BB&0&0008","ATI RADEON X300/X550/X1050 Series" },
-{0x1002, 0x5B64, "Advanced Micro Devices, Inc.","RV370GL","ATI FireGL V3100" },
-{0x1002, 0x5B65, "Advanced Micro Devices, Inc.","RV370","ATI FireMV 2200" },
-{0x1002, 0x5B60, "Advanced Micro Devices, Inc.","RV370","ATI RADEON X300/X550/X1050 Series" },
-{0x1002, 0x5B70, "Advanced Micro Devices, Inc.","RV380","Radeon" },
-{0x1002, 0x5B72, "Advanced Micro Devices, Inc.","RV380x","ATI RADEON X600 Series Secondary" },
-{0x1002, 0x5B73, "Advanced Micro Devices, Inc.","RV370","0 SerieATI RADEON X300 Secondary" },
-{0x1002, 0x5B74, "Advanced Micro Devices, Inc.","RV370GL","ATI FireGL V3100 Secondary" },
-{0x1002, 0x5B75, "Advanced Micro Devices, Inc.","RV370","ATI FireMV 2200 Secondary" },
-{0x1002, 0x5C61, "Advanced Micro Devices, Inc.","bk-ati ver008.016m.085.006","Mobility Radeon 9200" },
-{0x1002, 0x5C63, "Advanced Micro Devices, Inc.","RV280 (M9+)","Mobility Radeon 9200" },
-{0x1002, 0x5D44, "Advanced Micro Devices, Inc.","RV280","Radeon 9200 SE Series - Secondary" },
-{0x1002, 0x5D45, "Advanced Micro Devices, Inc.","RV280","ATI FireMV 2200 PCI Secondary" },
-{0x1002, 0x5D48, "Advanced Micro Devices, Inc.","M28","ATI MOBILITY/ATI RADEON X800  XT" },
-{0x1002, 0x5D49, "Advanced Micro Devices, Inc.","M28GL","ATI MOBILITY FireGL V5100" },
-{0x1002, 0x5d4a, "Advanced Micro Devices, Inc.","M28","ATI MOBILITY /ATI RADEON X800" },
-{0x1002, 0x5d4d, "Advanced Micro Devices, Inc.","R480","ATI RADEON X850 XT Platinum Edition" },
-{0x1002, 0x5d4f, "Advanced Micro Devices, Inc.","R480","ATI RADEON X800 GTO" },
-{0x1002, 0x5D50, "Advanced Micro Devices, Inc.","R480GL","ATI FireGL V7200" },
-{0x1002, 0x5d52, "Advanced Micro Devices, Inc.","R480","ATI RADEON X850 XT" },
-{0x1002, 0x5D57, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 XT" },
-{0x1002, 0x5d6d, "Advanced Micro Devices, Inc.","R480","ATI RADEON X850 XT Platinum Edition Secondary" },
-{0x1002, 0x5D6F, "Advanced Micro Devices, Inc.","R480","ATI RADEON X800 GTO Secondary" },
-{0x1002, 0x5D70, "Advanced Micro Devices, Inc.","R480GL","ATI FireGL V7200 Secondary" },
-{0x1002, 0x5D72, "Advanced Micro Devices, Inc.","R480","ATI RADEON X850 XT Secondary" },
-{0x1002, 0x5D77, "Advanced Micro Devices, Inc.","R423","ATI RADEON X800 XT Secondary" },
-{0x1002, 0x5E48, "Advanced Micro Devices, Inc.","RV410GL","ATI FireGL V5000" },
-{0x1002, 0x5E4A, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700 XT" },
-{0x1002, 0x5E4B, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700 PRO" },
-{0x1002, 0x5E4C, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700 SE" },
-{0x1002, 0x5E4D, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700" },
-{0x1002, 0x5E4F, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700/X550 Series" },
-{0x1002, 0x5E68, "Advanced Micro Devices, Inc.","RV410GL","ATI FireGL V5000 Secondary" },
-{0x1002, 0x5E6A, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700 XT Secondary" },
-{0x1002, 0x5E6B, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700 PRO Secondary" },
-{0x1002, 0x5E6C, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700 SE Secondary" },
-{0x1002, 0x5E6D, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700 Secondary" },
-{0x1002, 0x5E6F, "Advanced Micro Devices, Inc.","RV410","ATI RADEON X700/X550 Series Secondary" },
-{0x1002, 0x6076, "Advanced Micro Devices, Inc.","123123132","11" },
-{0x1002, 0x6600, "Advanced Micro Devices, Inc.","AMD","Radeon HD 8600M/8700M/8750M" },
-{0x1002, 0x6718, "Advanced Micro Devices, Inc.","CAYMAN XT","AMD Radeon HD 6970" },
-{0x1002, 0x6719, "Advanced Micro Devices, Inc.","Cayman","AMD Radeon HD 6950" },
-{0x1002, 0x6738, "Advanced Micro Devices, Inc.","HD6870","MSI" },
-{0x1002, 0x6739, "Advanced Micro Devices, Inc.","Barts (Pro)","AMD Radeon HD 6850" },
-{0x1002, 0x673E, "Advanced Micro Devices, Inc.","0x2310","0x1787" },
-{0x1002, 0x6740, "Advanced Micro Devices, Inc.","Powered by AMD","ATI Radeon HD 6700M" },
-{0x1002, 0x6741, "Advanced Micro Devices, Inc.","Whistler","AMD Radeon™ HD 6700M/HD 6600M Series " },
-{0x1002, 0x6749, "Advanced Micro Devices, Inc.","unknown","unknown" },
-{0x1002, 0x674A, "Advanced Micro Devices, Inc.","V3900","AMD FirePro V3900 graphics" },
-{0x1002, 0x6750, "Advanced Micro Devices, Inc.","1996","AMD Radeon HD 6570" },
-{0x1002, 0x6758, "Advanced Micro Devices, Inc.","NI","AMD Radeon HD 6670" },
-{0x1002, 0x6759, "Advanced Micro Devices, Inc.","1996","AMD Radeon HD 6570" },
-{0x1002, 0x675D, "Advanced Micro Devices, Inc.","HD7570","AMD Radeon HD7570" },
-{0x1002, 0x6760, "Advanced Micro Devices, Inc.","3305M","AMD/ATi Radeon 6760M" },
-{0x1002, 0x6761, "Advanced Micro Devices, Inc.","AMD Radeon HD 6430M","6430M" },
-{0x1002, 0x6778, "Advanced Micro Devices, Inc.","7470","AMD Radeon HD 7470" },
-{0x1002, 0x6779, "Advanced Micro Devices, Inc.","AMD Radeon HD 6470m","AMD Radeon HD 6470m" },
-{0x1002, 0x677B, "Advanced Micro Devices, Inc.","Unknown","Radeon HD 7450" },
-{0x1002, 0x6798, "Advanced Micro Devices, Inc.","6798","AMD Radeon 7970 Series" },
-{0x1002, 0x6810, "Advanced Micro Devices, Inc.","R9 200","Radeon R9 200 Series" },
-{0x1002, 0x6819, "Advanced Micro Devices, Inc.","AMD Radeon HD 7800 Series","PCI\\VEN_1002&DEV_6819&SUBSYS_32601682&REV_00" },
-{0x1002, 0x6840, "Advanced Micro Devices, Inc.","SUBSY","AMD Radeon HD 7600M Series" },
-{0x1002, 0x6841, "Advanced Micro Devices, Inc.","subsys 1789103c","AMD Radeon HD 7500M/7600M" },
-{0x1002, 0x6898, "Advanced Micro Devices, Inc.","EG CYPRESS XT","ATI Radeon HD 5800 Series" },
-{0x1002, 0x6899, "Advanced Micro Devices, Inc.","EG CYPRESS PRO","ATI Radeon HD 5800 Series" },
-{0x1002, 0x689C, "Advanced Micro Devices, Inc.","EG Cypress XT HEMLOCK","ATI Radeon HD 5970 Series" },
-{0x1002, 0x68A0, "Advanced Micro Devices, Inc.","EG BROADWAY XT","ATI Mobility Radeon HD 5800 Series" },
-{0x1002, 0x68A1, "Advanced Micro Devices, Inc.","EG BROADWAY PRO/LP","ATI Mobility Radeon HD 5800 Series" },
-{0x1002, 0x68A8, "Advanced Micro Devices, Inc.","AMD Radeon HD6870M (at least the one from Dell)","AMD Radeon HD6870M (at least the one from Dell)" },
-{0x1002, 0x68B0, "Advanced Micro Devices, Inc.","EG BROADWAY XT","ATI Mobility Radeon HD 5800 Series" },
-{0x1002, 0x68B8, "Advanced Micro Devices, Inc.","EG JUNIPER XT","ATI Radeon HD 5700 Series" },
-{0x1002, 0x68BA, "Advanced Micro Devices, Inc.","1482174B","ATI Radeon HD 6700 Series graphics card" },
-{0x1002, 0x68BE, "Advanced Micro Devices, Inc.","EG JUNIPER LE","ATI Radeon HD 5700 Series" },
-{0x1002, 0x68C1, "Advanced Micro Devices, Inc.","DEV_68C1&SUBSYS_144A103C&REV_00","ATI Mobility Radeon HD 5650M" },
-{0x1002, 0x68C8, "Advanced Micro Devices, Inc.","RV830","FirePro v4800" },
-{0x1002, 0x68c9, "Advanced Micro Devices, Inc.","RV830","FirePro 3D V3800" },
-{0x1002, 0x68D8, "Advanced Micro Devices, Inc.","Redwood","ATI Radeon HD 5670" },
-{0x1002, 0x68D9, "Advanced Micro Devices, Inc.","RV830/Redwood","HD 5570" },
-{0x1002, 0x68E0, "Advanced Micro Devices, Inc.","HD 5470","ATI Mobility Radeon HD 5470" },
-{0x1002, 0x68E4, "Advanced Micro Devices, Inc.","RV810","Ati Radeon HD 6370Mmobile" },
-{0x1002, 0x68f9, "Advanced Micro Devices, Inc.","Cedar","ATI Radeon HD 5450" },
-{0x1002, 0x700F, "Advanced Micro Devices, Inc.","A3/U1","PCI to AGP Bridge" },
-{0x1002, 0x7010, "Advanced Micro Devices, Inc.","RS200","PCI to AGP Bridge" },
-{0x1002, 0x7100, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series" },
-{0x1002, 0x7101, "Advanced Micro Devices, Inc.","M58","ATI MOBILITY /ATI RADEON X1800 XT" },
-{0x1002, 0x7102, "Advanced Micro Devices, Inc.","PCIE","ATI MOBILITY /ATI RADEON X1800" },
-{0x1002, 0x7103, "Advanced Micro Devices, Inc.","M58GL","ATI MOBILITY FireGL V7200" },
-{0x1002, 0x7104, "Advanced Micro Devices, Inc.","R520GL","ATI FireGL V7200" },
-{0x1002, 0x7105, "Advanced Micro Devices, Inc.","R520GL","ATI FireGL V5300" },
-{0x1002, 0x7106, "Advanced Micro Devices, Inc.","M58GL","ATI MOBILITY FireGL V7100" },
-{0x1002, 0x7108, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series" },
-{0x1002, 0x7109, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series" },
-{0x1002, 0x710A, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series" },
-{0x1002, 0x710B, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series" },
-{0x1002, 0x710C, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series" },
-{0x1002, 0x710E, "Advanced Micro Devices, Inc.","R520GL","ATI FireGL V7300" },
-{0x1002, 0x710F, "Advanced Micro Devices, Inc.","R520GL","ATI FireGL V7350" },
-{0x1002, 0x7120, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series Secondary" },
-{0x1002, 0x7124, "Advanced Micro Devices, Inc.","R520GL","ATI FireGL V7200 Secondary" },
-{0x1002, 0x7125, "Advanced Micro Devices, Inc.","R520GL","ATI FireGL V5300 Secondary" },
-{0x1002, 0x7128, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series Secondary" },
-{0x1002, 0x7129, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series Secondary" },
-{0x1002, 0x712A, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series Secondary" },
-{0x1002, 0x712B, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series Secondary" },
-{0x1002, 0x712C, "Advanced Micro Devices, Inc.","R520","ATI RADEON X1800 Series Secondary" },
-{0x1002, 0x712E, "Advanced Micro Devices, Inc.","R520GL","ATI FireGL V7300 Secondary" },
-{0x1002, 0x712F, "Advanced Micro Devices, Inc.","R520GL","ATI FireGL V7350 Secondary" },
-{0x1002, 0x7140, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1600 Series" },
-{0x1002, 0x7142, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300/X1550 Series" },
-{0x1002, 0x7143, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300/ X1550 Series" },
-{0x1002, 0x7145, "Advanced Micro Devices, Inc.","M54","ATI MOBILITY /ATI RADEON X1400" },
-{0x1002, 0x7146, "Advanced Micro Devices, Inc.","RV505","ATI RADEON X1300 / X1550 Series" },
-{0x1002, 0x7147, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1550 64-bit" },
-{0x1002, 0x7149, "Advanced Micro Devices, Inc.","M52","ATI MOBILITY RADEON X1300" },
-{0x1002, 0x714A, "Advanced Micro Devices, Inc.","M52","ATI MOBILITY /ATI RADEON X1300" },
-{0x1002, 0x714B, "Advanced Micro Devices, Inc.","M52","ATI MOBILITY /ATI RADEON X1300" },
-{0x1002, 0x714C, "Advanced Micro Devices, Inc.","M52","ATI MOBILITY /ATI RADEON X1300" },
-{0x1002, 0x714D, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300 Series" },
-{0x1002, 0x714E, "Advanced Micro Devices, Inc.","RV515PCI","ATI RADEON X1300 Series" },
-{0x1002, 0x7152, "Advanced Micro Devices, Inc.","RV515GL","ATI FireGL V3300" },
-{0x1002, 0x7153, "Advanced Micro Devices, Inc.","RV515GL","ATI FireGL V3350" },
-{0x1002, 0x715E, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300 Series" },
-{0x1002, 0x715F, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1550 64-bit" },
-{0x1002, 0x7160, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1600 Series Secondary" },
-{0x1002, 0x7162, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300/X1550 Series Secondary" },
-{0x1002, 0x7163, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1550 Series Secondary" },
-{0x1002, 0x7166, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300 / X1550 Series Secondary" },
-{0x1002, 0x7167, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1550 64-bit Secondary" },
-{0x1002, 0x716D, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300 Series Secondary" },
-{0x1002, 0x716E, "Advanced Micro Devices, Inc.","RV515PCI","ATI RADEON X1300 Series Secondary" },
-{0x1002, 0x7172, "Advanced Micro Devices, Inc.","RV515GL","ATI FireGL V3300 Secondary" },
-{0x1002, 0x7173, "Advanced Micro Devices, Inc.","RV515GL","ATI FireGL V3350 Secondary" },
-{0x1002, 0x717E, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300 Series Secondary" },
-{0x1002, 0x717F, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1550 32-bit Secondary" },
-{0x1002, 0x7180, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300/X1550 Series =x1400" },
-{0x1002, 0x7181, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1600 Series" },
-{0x1002, 0x7183, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300/X1550 Series" },
-{0x1002, 0x7186, "Advanced Micro Devices, Inc.","M54","ATI MOBILITY /ATI RADEON X1450" },
-{0x1002, 0x7187, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300/X1550 Series" },
-{0x1002, 0x7188, "Advanced Micro Devices, Inc.","M64","ATI MOBILITY /ATI RADEON X2300" },
-{0x1002, 0x718A, "Advanced Micro Devices, Inc.","M54","ATI MOBILITY /ATI RADEON X2300" },
-{0x1002, 0x718B, "Advanced Micro Devices, Inc.","M52","ATI MOBILITY /ATI RADEON X1350" },
-{0x1002, 0x718C, "Advanced Micro Devices, Inc.","M52","ATI MOBILITY /ATI RADEON X1350" },
-{0x1002, 0x718D, "Advanced Micro Devices, Inc.","M54","ATI MOBILITY /ATI RADEON X1450" },
-{0x1002, 0x718F, "Advanced Micro Devices, Inc.","RV515PCI","ATI RADEON X1300 Series" },
-{0x1002, 0x7193, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1550 Series" },
-{0x1002, 0x7196, "Advanced Micro Devices, Inc.","M62","ATI MOBILITY /ATI RADEON X1350" },
-{0x1002, 0x719B, "Advanced Micro Devices, Inc.","RV515","ATI FireMV 2250" },
-{0x1002, 0x719F, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1550 64-bit" },
-{0x1002, 0x71A0, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300/X1550 Series Secondary" },
-{0x1002, 0x71A1, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1600 Series Secondary" },
-{0x1002, 0x71A3, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300/X1550 Series Secondary" },
-{0x1002, 0x71A7, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1300/X1550 Series Secondary" },
-{0x1002, 0x71AF, "Advanced Micro Devices, Inc.","RV515PCI","ATI RADEON X1300 Series Secondary" },
-{0x1002, 0x71B3, "Advanced Micro Devices, Inc.","RV515","ATI RADEON X1550 Series Secondary" },
-{0x1002, 0x71BB, "Advanced Micro Devices, Inc.","RV515","ATI FireMV 2250 Secondary" },
-{0x1002, 0x71C0, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1600 Series" },
-{0x1002, 0x71C1, "Advanced Micro Devices, Inc.","RV535","ATI RADEON X1650 Series" },
-{0x1002, 0x71c2, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1600 Series" },
-{0x1002, 0x71C3, "Advanced Micro Devices, Inc.","RV535","ATI RADEON X1650 Series" },
-{0x1002, 0x71C4, "Advanced Micro Devices, Inc.","M56GL","ATI MOBILITY FireGL V5200" },
-{0x1002, 0x71c5, "Advanced Micro Devices, Inc.","M56","ATI MOBILITY / ATI RADEON X1600" },
-{0x1002, 0x71C6, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1650 Series" },
-{0x1002, 0x71C7, "Advanced Micro Devices, Inc.","RV535","ATI RADEON X1650 Series" },
-{0x1002, 0x71CD, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1600 &#1057;&#1077;&#1088;&#1080;&#1080;" },
-{0x1002, 0x71ce, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1600 Pro / ATI RADEON X1300 XT" },
-{0x1002, 0x71D2, "Advanced Micro Devices, Inc.","RV530GL","ATI FireGL V3400" },
-{0x1002, 0x71D4, "Advanced Micro Devices, Inc.","M56GL","ATI MOBILITY FireGL V5250" },
-{0x1002, 0x71D5, "Advanced Micro Devices, Inc.","M56","ATI MOBILITY /ATI RADEON X1700" },
-{0x1002, 0x71D6, "Advanced Micro Devices, Inc.","M56","ATI MOBILITY /ATI RADEON X1700 XT" },
-{0x1002, 0x71DA, "Advanced Micro Devices, Inc.","RV530GL","ATI FireGL V5200" },
-{0x1002, 0x71DE, "Advanced Micro Devices, Inc.","M56","ATI MOBILITY /ATI RADEON X1700" },
-{0x1002, 0x71E0, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1600 Series Secondary" },
-{0x1002, 0x71E1, "Advanced Micro Devices, Inc.","RV535","ATI RADEON X1650 Series Secondary" },
-{0x1002, 0x71e2, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1600 Series Secondary" },
-{0x1002, 0x71E3, "Advanced Micro Devices, Inc.","RV535","ATI RADEON X1300 Series Secondary" },
-{0x1002, 0x71E6, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1600 Series Secondary" },
-{0x1002, 0x71E7, "Advanced Micro Devices, Inc.","RV535","ATI RADEON X1650 Series Secondary" },
-{0x1002, 0x71ED, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1600 Series Secondary" },
-{0x1002, 0x71EE, "Advanced Micro Devices, Inc.","RV530","ATI RADEON X1600 Pro / ATI RADEON X1300 XT Secondary" },
-{0x1002, 0x71F2, "Advanced Micro Devices, Inc.","RV530GL","ATI FireGL V3400 Secondary" },
-{0x1002, 0x71FA, "Advanced Micro Devices, Inc.","RV530GL","ATI FireGL V5200 Secondary" },
-{0x1002, 0x7205, "Advanced Micro Devices, Inc.","1106","S3G Unichrome IGP KM400/KN400" },
-{0x1002, 0x7210, "Advanced Micro Devices, Inc.","M71","ATI MOBILITY /ATI RADEON HD 2300" },
-{0x1002, 0x7211, "Advanced Micro Devices, Inc.","M71","ATI MOBILITY /ATI RADEON HD 2300" },
-{0x1002, 0x7240, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1950 Series" },
-{0x1002, 0x7243, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x7244, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1950 Series" },
-{0x1002, 0x7245, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x7246, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x7247, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x7248, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x7249, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x724A, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x724B, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x724C, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x724D, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x724E, "Advanced Micro Devices, Inc.","R580","ATI FireStream 2U" },
-{0x1002, 0x724F, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series" },
-{0x1002, 0x7260, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1950 Series Secondary" },
-{0x1002, 0x7263, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x7264, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1950 Series Secondary" },
-{0x1002, 0x7265, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x7266, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x7267, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x7268, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x7269, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x726A, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x726B, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x726C, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x726D, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x726E, "Advanced Micro Devices, Inc.","R580","ATI FireStream 2U Secondary" },
-{0x1002, 0x726F, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1900 Series Secondary" },
-{0x1002, 0x7280, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1950 Series" },
-{0x1002, 0x7284, "Advanced Micro Devices, Inc.","M58","ATI MOBILITY /ATI RADEON X1900" },
-{0x1002, 0x7286, "Advanced Micro Devices, Inc.","R580","ATI RAEDON X1950 " },
-{0x1002, 0x7288, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1950 GT" },
-{0x1002, 0x7291, "Advanced Micro Devices, Inc.","R560","ATI RADEON X1650 Series" },
-{0x1002, 0x7293, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1650 Series" },
-{0x1002, 0x72A0, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1950 Series Secondary" },
-{0x1002, 0x72A8, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1950 GT Secondary" },
-{0x1002, 0x72B1, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1650 Series Secondary" },
-{0x1002, 0x72B3, "Advanced Micro Devices, Inc.","R580","ATI RADEON X1650 Series Secondary" },
-{0x1002, 0x7801, "Advanced Micro Devices, Inc.","7801","SATA Controller" },
-{0x1002, 0x7807, "Advanced Micro Devices, Inc.","7807","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x7808, "Advanced Micro Devices, Inc.","7808","Standard Enhanced PCI to USB Host Controller" },
-{0x1002, 0x7809, "Advanced Micro Devices, Inc.","7809","Standard OpenHCD USB Host Controller" },
-{0x1002, 0x780B, "Advanced Micro Devices, Inc.","780B","SMBus" },
-{0x1002, 0x780D, "Advanced Micro Devices, Inc.","780D","HDMI Audio" },
-{0x1002, 0x780E, "Advanced Micro Devices, Inc.","780E","PCI standard ISA bridge" },
-{0x1002, 0x780F, "Advanced Micro Devices, Inc.","780F","PCI standard PCI-to-PCI bridge" },
-{0x1002, 0x7814, "Advanced Micro Devices, Inc.","7814","AMD USB 3.0 Host Controller" },
-{0x1002, 0x7833, "Advanced Micro Devices, Inc.","RS350","Radeon 9100 Pro" },
-{0x1002, 0x79, "Advanced Micro Devices, Inc.","unknown, 2200 mhz","Campo	Valor Juego de instrucciones	x86, x86-64, MMX, 3DNow!, SSE, SSE2, SSE3" },
-{0x1002, 0x791, "Advanced Micro Devices, Inc.","RS690M","ATI Mobility Radeon x1200" },
-{0x1002, 0x7910, "Advanced Micro Devices, Inc.","7910","PCI standard host CPU bridge" },
-{0x1002, 0x7912, "Advanced Micro Devices, Inc.","7912","PCI standard PCI-to-PCI bridge" },
-{0x1002, 0x7914, "Advanced Micro Devices, Inc.","7914","PCI standard PCI-to-PCI bridge" },
-{0x1002, 0x7915, "Advanced Micro Devices, Inc.","7915","PCI standard PCI-to-PCI bridge" },
-{0x1002, 0x7916, "Advanced Micro Devices, Inc.","7916","PCI standard PCI-to-PCI bridge" },
-{0x1002, 0x791a, "Advanced Micro Devices, Inc.","791A","HDMI Audio" },
-{0x1002, 0x791E, "Advanced Micro Devices, Inc.","RS690","ATI RADEON X1200 Series" },
-{0x1002, 0x791F, "Advanced Micro Devices, Inc.","RS690M","ATI Radeon X1250" },
-{0x1002, 0x7937, "Advanced Micro Devices, Inc.","Samsung R25P","ATI Technoligies Inc" },
-{0x1002, 0x793F, "Advanced Micro Devices, Inc.","RS600","ATI RADEON Xpress 1200 Series" },
-{0x1002, 0x7941, "Advanced Micro Devices, Inc.","RS690M","ATI RADEON Xpress 1200 Series" },
-{0x1002, 0x7942, "Advanced Micro Devices, Inc.","RS600M","ATI RADEON Xpress 1250" },
-{0x1002, 0x796E, "Advanced Micro Devices, Inc.","RS690","ATI RADEON 2100" },
-{0x1002, 0x8086, "Advanced Micro Devices, Inc.","1050","PCI" },
-{0x1002, 0x9000, "Advanced Micro Devices, Inc.","RV350","ATI Radeon 9600" },
-{0x1002, 0x9094, "Advanced Micro Devices, Inc.","RV730","ATI Radeon HD 4600 Series" },
-{0x1002, 0x9400, "Advanced Micro Devices, Inc.","R600","ATI Radeon HD 2900 XT" },
-{0x1002, 0x9401, "Advanced Micro Devices, Inc.","R600","ATI RADEON HD 2900 XT" },
-{0x1002, 0x9402, "Advanced Micro Devices, Inc.","R600","ATI RADEON HD 2900 XT" },
-{0x1002, 0x9403, "Advanced Micro Devices, Inc.","R600","ATI RADEON HD 2900 PRO" },
-{0x1002, 0x9405, "Advanced Micro Devices, Inc.","R600","ATI RADEON HD 2900 GT" },
-{0x1002, 0x940A, "Advanced Micro Devices, Inc.","R600GL","ATI FireGL V8650" },
-{0x1002, 0x940B, "Advanced Micro Devices, Inc.","R600GL","ATI FireGL V8600" },
-{0x1002, 0x940F, "Advanced Micro Devices, Inc.","R600GL","ATI FireGL V7600" },
-{0x1002, 0x9440, "Advanced Micro Devices, Inc.","RV770","ATI Radeon HD 4870" },
-{0x1002, 0x9441, "Advanced Micro Devices, Inc.","R700","ATI Radeon HD 4870 X2" },
-{0x1002, 0x9442, "Advanced Micro Devices, Inc.","RV770","ATI Radeon HD 4800 Series" },
-{0x1002, 0x9443, "Advanced Micro Devices, Inc.","R700","ATI Radeon HD 4850 X2" },
-{0x1002, 0x9444, "Advanced Micro Devices, Inc.","RV770","ATI FirePro V8750 (FireGL)" },
-{0x1002, 0x9446, "Advanced Micro Devices, Inc.","RV770","ATI FirePro V7770 (FireGL)" },
-{0x1002, 0x9447, "Advanced Micro Devices, Inc.","R700","ATI FirePro V8700 Duo (FireGL)" },
-{0x1002, 0x944A, "Advanced Micro Devices, Inc.","M98","ATI Mobility Radeon HD 4850" },
-{0x1002, 0x944B, "Advanced Micro Devices, Inc.","M98","ATI Mobility Radeon HD 4850 X2" },
-{0x1002, 0x944C, "Advanced Micro Devices, Inc.","RV770","ATI Radeon HD 4800 Series" },
-{0x1002, 0x944E, "Advanced Micro Devices, Inc.","RV770","ATI Radeon HD 4700 Series" },
-{0x1002, 0x9450, "Advanced Micro Devices, Inc.","RV770","AMD FireStream 9270" },
-{0x1002, 0x9452, "Advanced Micro Devices, Inc.","RV770","AMD FireStream 9250" },
-{0x1002, 0x9456, "Advanced Micro Devices, Inc.","RV770","ATI FirePro V8700 (FireGL)" },
-{0x1002, 0x945A, "Advanced Micro Devices, Inc.","M98","ATI Mobility Radeon HD 4870" },
-{0x1002, 0x9460, "Advanced Micro Devices, Inc.","RV790","ATI Radeon HD 4800 Series" },
-{0x1002, 0x9462, "Advanced Micro Devices, Inc.","RV790","ATI Mobility Radeon HD 5650" },
-{0x1002, 0x9480, "Advanced Micro Devices, Inc.","M96","ATI Mobility Radeon HD 4650" },
-{0x1002, 0x9487, "Advanced Micro Devices, Inc.","RV730","ATI Radeon Graphics Processor" },
-{0x1002, 0x9488, "Advanced Micro Devices, Inc.","M96","ATI Mobility Radeon HD 4670" },
-{0x1002, 0x948F, "Advanced Micro Devices, Inc.","RV730","ATI Radeon Graphics Processor" },
-{0x1002, 0x9490, "Advanced Micro Devices, Inc.","RV730","ATI Radeon HD 4600 Series" },
-{0x1002, 0x9491, "Advanced Micro Devices, Inc.","M96","ATI Radeon E4600" },
-{0x1002, 0x9495, "Advanced Micro Devices, Inc.","RV730","ATI RADEON HD4650" },
-{0x1002, 0x9498, "Advanced Micro Devices, Inc.","RV730","ATI Radeon HD 4600" },
-{0x1002, 0x949C, "Advanced Micro Devices, Inc.","RV730","ATI FirePro V7750 (FireGL)" },
-{0x1002, 0x949E, "Advanced Micro Devices, Inc.","RV730","ATI FirePro V5700 (FireGL)" },
-{0x1002, 0x949F, "Advanced Micro Devices, Inc.","RV730","ATI FirePro V3750 (FireGL)" },
-{0x1002, 0x94A0, "Advanced Micro Devices, Inc.","M97","ATI Mobility Radeon HD 4830" },
-{0x1002, 0x94A1, "Advanced Micro Devices, Inc.","M97","ATI Mobility Radeon HD 4860" },
-{0x1002, 0x94A3, "Advanced Micro Devices, Inc.","M97","ATI FirePro M7740" },
-{0x1002, 0x94B1, "Advanced Micro Devices, Inc.","RV740","ATI Radeon Graphics Processor" },
-{0x1002, 0x94B3, "Advanced Micro Devices, Inc.","RV740","ATI Radeon HD 4770" },
-{0x1002, 0x94B4, "Advanced Micro Devices, Inc.","RV740","ATI Radeon HD 4700 Series" },
-{0x1002, 0x94B5, "Advanced Micro Devices, Inc.","AA38","ATI Radeon HD 4650" },
-{0x1002, 0x94C1, "Advanced Micro Devices, Inc.","RV610-DT (Pro)","ATI Radeon HD 2400 XT" },
-{0x1002, 0x94C3, "Advanced Micro Devices, Inc.","RV610","ATI Radeon HD 2400 PRO PCI-E" },
-{0x1002, 0x94C4, "Advanced Micro Devices, Inc.","RV610LE","ATI Radeon HD 2400 PRO AGP" },
-{0x1002, 0x94C5, "Advanced Micro Devices, Inc.","RV610","ATI RADEON HD 2400 LE" },
-{0x1002, 0x94C7, "Advanced Micro Devices, Inc.","RV610","ATI RADEON HD 2350" },
-{0x1002, 0x94C8, "Advanced Micro Devices, Inc.","M72","ATI MOBILITY /ATI RADEON HD 2400 XT" },
-{0x1002, 0x94C9, "Advanced Micro Devices, Inc.","M72","ATI MOBILITY /ATI RADEON HD 2400" },
-{0x1002, 0x94CB, "Advanced Micro Devices, Inc.","M72","ATI RADEON E2400" },
-{0x1002, 0x94CC, "Advanced Micro Devices, Inc.","RV610","ATI RADEON HD 2400" },
-{0x1002, 0x9501, "Advanced Micro Devices, Inc.","RV670 XT","ATI Radeon HD 3870" },
-{0x1002, 0x9504, "Advanced Micro Devices, Inc.","M76","ATI MOBILITY /ATI RADEON HD 3850" },
-{0x1002, 0x9505, "Advanced Micro Devices, Inc.","RV630","ATI RADEON HD 3850" },
-{0x1002, 0x9506, "Advanced Micro Devices, Inc.","M76","ATI MOBILITY /ATI RADEON HD 3850 X2" },
-{0x1002, 0x9507, "Advanced Micro Devices, Inc.","RV670","ATI Radeon HD 3830" },
-{0x1002, 0x9508, "Advanced Micro Devices, Inc.","M76","ATI MOBILITY /ATI RADEON HD 3870" },
-{0x1002, 0x9509, "Advanced Micro Devices, Inc.","M76","ATI MOBILITY /ATI RADEON HD 3870 X2" },
-{0x1002, 0x950F, "Advanced Micro Devices, Inc.","R680","ATI RADEON HD 3870 X2" },
-{0x1002, 0x9511, "Advanced Micro Devices, Inc.","RV630GL","ATI FireGL V7700" },
-{0x1002, 0x9513, "Advanced Micro Devices, Inc.","R680","ATI Radeon HD 3850 X2" },
-{0x1002, 0x9515, "Advanced Micro Devices, Inc.","RV670 AGP","ATI Radeon HD 3850 AGP" },
-{0x1002, 0x9519, "Advanced Micro Devices, Inc.","RV670","AMD FireStream 9170" },
-{0x1002, 0x9540, "Advanced Micro Devices, Inc.","RV710","ATI Radeon HD 4550" },
-{0x1002, 0x9541, "Advanced Micro Devices, Inc.","RV710","ATI Radeon Graphics Processor" },
-{0x1002, 0x954E, "Advanced Micro Devices, Inc.","RV710","ATI Radeon Graphics Processor" },
-{0x1002, 0x954F, "Advanced Micro Devices, Inc.","RV710","ATI Radeon HD 4350" },
-{0x1002, 0x9552, "Advanced Micro Devices, Inc.","M92","ATI Mobility Radeon HD 4330 Ð¡ÐµÑ€Ð¸Ð¸" },
-{0x1002, 0x9553, "Advanced Micro Devices, Inc.","M92","ATI Mobility Radeon HD 5145" },
-{0x1002, 0x9555, "Advanced Micro Devices, Inc.","M93","ATI Mobility Radeon HD 4500 Series" },
-{0x1002, 0x9557, "Advanced Micro Devices, Inc.","M93","ATI FirePro RG220" },
-{0x1002, 0x9581, "Advanced Micro Devices, Inc.","M76M","ATI Mobility Radeon HD 2600" },
-{0x1002, 0x9583, "Advanced Micro Devices, Inc.","M76","ATI MOBILITY /ATI RADEON HD 2600 XT" },
-{0x1002, 0x9586, "Advanced Micro Devices, Inc.","RV630","ATI RADEON HD 2600 XT AGP" },
-{0x1002, 0x9587, "Advanced Micro Devices, Inc.","RV630 PRO","ATI Radeon HD 2600 Pro AGP" },
-{0x1002, 0x9588, "Advanced Micro Devices, Inc.","RV630 XT","ATI Radeon HD 2600 XT" },
-{0x1002, 0x9589, "Advanced Micro Devices, Inc.","&#1055;&#1056;&#1054; RV630","ATI Radeon HD 2600 Pro" },
-{0x1002, 0x958B, "Advanced Micro Devices, Inc.","M76","ATI MOBILITY / ATI RADEON HD 2600 XT Gemini" },
-{0x1002, 0x958C, "Advanced Micro Devices, Inc.","RV630GL","ATI FireGL V5600" },
-{0x1002, 0x958D, "Advanced Micro Devices, Inc.","RV630GL","ATI FireGL V3600" },
-{0x1002, 0x958E, "Advanced Micro Devices, Inc.","RV630","ATI RADEON HD 2600 LE" },
-{0x1002, 0x958F, "Advanced Micro Devices, Inc.","M76","ATI Mobility FireGL Graphics Processor" },
-{0x1002, 0x9590, "Advanced Micro Devices, Inc.","RV630","ATI RADEON HD 3650 Serieshttp://www.pcidatabase.com/update_device.php?__ec_i=ec.1307313611.e071ed73c" },
-{0x1002, 0x9591, "Advanced Micro Devices, Inc.","M86-M","ATI Mobility Radeon HD 3650" },
-{0x1002, 0x9593, "Advanced Micro Devices, Inc.","M86","ATI Mobility Radeon HD 3670" },
-{0x1002, 0x9595, "Advanced Micro Devices, Inc.","M86","ATI Mobility FireGL V5700" },
-{0x1002, 0x9596, "Advanced Micro Devices, Inc.","RV630","ATI RADEON HD 3600 Series" },
-{0x1002, 0x9597, "Advanced Micro Devices, Inc.","RV630","ATI RADEON HD 3600 Series" },
-{0x1002, 0x9598, "Advanced Micro Devices, Inc.","RV630","ATI Radeon HD 3600 Series " },
-{0x1002, 0x9599, "Advanced Micro Devices, Inc.","RV630","ATI RADEON HD 3600 Series" },
-{0x1002, 0x959B, "Advanced Micro Devices, Inc.","M86","ATI Mobility FireGL Graphics Processor" },
-{0x1002, 0x95C0, "Advanced Micro Devices, Inc.","RV610","ATI RADEON HD 3470" },
-{0x1002, 0x95C2, "Advanced Micro Devices, Inc.","M72","ATI MOBILITY /ATI RADEON HD 3430" },
-{0x1002, 0x95c4, "Advanced Micro Devices, Inc.","M82-S","ATI Mobility Radeon HD 3450" },
-{0x1002, 0x95C5, "Advanced Micro Devices, Inc.","RV620 LE","ATI Radeon HD 3450" },
-{0x1002, 0x95C6, "Advanced Micro Devices, Inc.","RV620","ATI Radeon HD 3450" },
-{0x1002, 0x95C7, "Advanced Micro Devices, Inc.","RV610","ATI RADEON HD 3430" },
-{0x1002, 0x95C9, "Advanced Micro Devices, Inc.","RV620","ATI Radeon HD 3450" },
-{0x1002, 0x95CC, "Advanced Micro Devices, Inc.","RV620","ATI FirePRO V3700" },
-{0x1002, 0x95CD, "Advanced Micro Devices, Inc.","RV610","ATI FireMV 2450" },
-{0x1002, 0x95CE, "Advanced Micro Devices, Inc.","RV610","ATI FireMV 2260" },
-{0x1002, 0x95CF, "Advanced Micro Devices, Inc.","RV610","ATI FireMV 2260" },
-{0x1002, 0x9610, "Advanced Micro Devices, Inc.","RS780","ATI Radeon HD 3200 Graphics" },
-{0x1002, 0x9611, "Advanced Micro Devices, Inc.","RS780","ATI RADEON 3100 Graphics" },
-{0x1002, 0x9612, "Advanced Micro Devices, Inc.","RS780M","ATI RADEON HD 3200 Graphics" },
-{0x1002, 0x9613, "Advanced Micro Devices, Inc.","RS780M","ATI RADEON 3100 Graphics" },
-{0x1002, 0x9614, "Advanced Micro Devices, Inc.","RS780","ATI RADEON HD 3300 Graphics" },
-{0x1002, 0x9615, "Advanced Micro Devices, Inc.","RS780","AMD 780E" },
-{0x1002, 0x9616, "Advanced Micro Devices, Inc.","RS780","AMD 760G" },
-{0x1002, 0x9644, "Advanced Micro Devices, Inc.","A4-3420","AMD Radeon™ HD 6410D" },
-{0x1002, 0x9647, "Advanced Micro Devices, Inc.","AMD A6-3410MX APU With AMD Radeon HD 6520G","&#1089;&#1090;&#1072;&#1085;&#1076;&#1072;&#1088;&#1090;&#1085;&#1099;&#1081; vga &#1075;&#1088;&#10" },
-{0x1002, 0x9648, "Advanced Micro Devices, Inc."," 9648","AMD Radeon(TM) HD 6480G" },
-{0x1002, 0x9649, "Advanced Micro Devices, Inc.","HD 6480G","AMD Radeon(TM) HD 6480G" },
-{0x1002, 0x970F, "Advanced Micro Devices, Inc.","970F","High Definition Audio Controller" },
-{0x1002, 0x9710, "Advanced Micro Devices, Inc.","RS880","ATI Radeon HD 4200" },
-{0x1002, 0x9711, "Advanced Micro Devices, Inc.","RS880","ATI Radeon 4100" },
-{0x1002, 0x9712, "Advanced Micro Devices, Inc.","4250","ATI Mobility Radeon HD 4200 Series (ATI Mobility Radeon HD 4250)" },
-{0x1002, 0x9713, "Advanced Micro Devices, Inc.","RS880MC","ATI Mobility Radeon 4100" },
-{0x1002, 0x9715, "Advanced Micro Devices, Inc.","RS880","ATI Radeon HD 4250 Graphics" },
-{0x1002, 0x9802, "Advanced Micro Devices, Inc.","AMD E-350","AMD Radeon HD 6310 series" },
-{0x1002, 0x9803, "Advanced Micro Devices, Inc.","2411E6FE","Display driver http://support1.toshiba-tro.de/tedd-files2/0/display-20110404110958.zip" },
-{0x1002, 0x9804, "Advanced Micro Devices, Inc.","AMD Radeon HD 6310 Graphics  AMD Radeon HD 6310 Gr","AMD Radeon HD 6310 Graphics" },
-{0x1002, 0x9806, "Advanced Micro Devices, Inc.","AMD Radeon HD 6320","E-450 APU" },
-{0x1002, 0x9807, "Advanced Micro Devices, Inc.","unknow","amd radeon hd 6290 graphic" },
-{0x1002, 0x9808, "Advanced Micro Devices, Inc.","E2-1800","E-Series APU (E2-1800, maybe more)" },
-{0x1002, 0x9809, "Advanced Micro Devices, Inc.","7310M","ATI Radeon 7310M" },
-{0x1002, 0x9834, "Advanced Micro Devices, Inc.","AMD Radeon HD 8210","PCI\\VEN_1002&DEV_9834&SUBSYS_380217AA&REV_00" },
-{0x1002, 0x9851, "Advanced Micro Devices, Inc.","3801","AMD Radeon(TM) R4 Graphics" },
-{0x1002, 0x9876, "Advanced Micro Devices, Inc.","ATI GTC (GT-C2U2)","ATI 3D Rage Pro AGP 2X" },
-{0x1002, 0x9902, "Advanced Micro Devices, Inc.","9902","HDMI Audio" },
-{0x1002, 0x9998, "Advanced Micro Devices, Inc.","9998","Radeon HD 8370D" },
-{0x1002, 0x9999, "Advanced Micro Devices, Inc.","(0x9498","ATI Radeon HD 4600" },
-{0x1002, 0x999C, "Advanced Micro Devices, Inc.","999C","Radeon HD 8550D" },
-{0x1002, 0xAA01, "Advanced Micro Devices, Inc.","Ati Function driver for high definition audio1","Ati Mobility Radeon HD HDMI Audio realtek" },
-{0x1002, 0xAA08, "Advanced Micro Devices, Inc.","All with HDMI support","High Definition Audio Device" },
-{0x1002, 0xAA10, "Advanced Micro Devices, Inc.","677","HDMI Audio Support" },
-{0x1002, 0xAA20, "Advanced Micro Devices, Inc.","RV630","ATI Radeon HD 3600 Series" },
-{0x1002, 0xAA28, "Advanced Micro Devices, Inc.","3400","Radeon HD 3400 Series" },
-{0x1002, 0xAA58, "Advanced Micro Devices, Inc.","AA58","High Definition Audio Controller" },
-{0x1002, 0xaa68, "Advanced Micro Devices, Inc."," 0x040300"," 0x00" },
-{0x1002, 0xAC12, "Advanced Micro Devices, Inc.","Theater HD T507","(DVB-T) TV tuner/capture device" },
-{0x1002, 0xCAB0, "Advanced Micro Devices, Inc.","A3/U1","S2K CPU to PCI Bridge" },
-{0x1002, 0xCAB1, "Advanced Micro Devices, Inc.","A3/U1","Slot1 CPU to PCI Bridge" },
-{0x1002, 0xcab2, "Advanced Micro Devices, Inc.","RS200","CPU to PCI Bridge" },
-{0x1002, 0xCBB2, "Advanced Micro Devices, Inc.","RS200","CPU to PCI Bridge" },
-{0x1003, 0x0201, "ULSI","0x0201","GUI Accelerator" },
-{0x1004, 0x0005, "VLSI Technology","PCI\\VEN_13F0","DEV_0200" },
-{0x1004, 0x0006, "VLSI Technology","82C593","ISA Bridge" },
-{0x1004, 0x0007, "VLSI Technology","82C594","Wildcat System Controller" },
-{0x1004, 0x0008, "VLSI Technology","82C596/597","Wildcat ISA Bridge" },
-{0x1004, 0x0009, "VLSI Technology","82C597-AFC2","" },
-{0x1004, 0x000C, "VLSI Technology","82C541","" },
-{0x1004, 0x000D, "VLSI Technology","82C543","" },
-{0x1004, 0x0100, "VLSI Technology","dtdftdfz","CPU to PCI Bridge for notebook" },
-{0x1004, 0x0101, "VLSI Technology","82C532","Peripheral Controller" },
-{0x1004, 0x0102, "VLSI Technology","82C534","PCI to PCI Bridge" },
-{0x1004, 0x0103, "VLSI Technology","82C538","PCI to ISA Bridge" },
-{0x1004, 0x0104, "VLSI Technology","82C535","Host Bridge" },
-{0x1004, 0x0105, "VLSI Technology","82C147","IrDA Controller" },
-{0x1004, 0x0200, "VLSI Technology","82C975","RISC GUI Accelerator" },
-{0x1004, 0x0280, "VLSI Technology","82C925","RISC GUI Accelerator" },
-{0x1004, 0x0304, "VLSI Technology","SAA7785","ThunderBird PCI Audio Accelerator" },
-{0x1004, 0x0305, "VLSI Technology","SAA7785","ThunderBird joystick port" },
-{0x1004, 0x0306, "VLSI Technology","SAA7785","ThunderBird 16650 UART" },
-{0x1004, 0x0307, "VLSI Technology","KTX0208X","Philips Seismic Edge 705" },
-{0x1004, 0x0308, "VLSI Technology","1","Philips PSC705 GamePort Enumerator" },
-{0x1004, 0x0702, "VLSI Technology","VAS96011","Golden Gate II" },
-{0x1006, 0x3044, "Reply Group","n/a 1","OHCI Compliant IEEE 1394 Host Controller" },
-{0x1008, 0x9876, "Epson","23","23" },
-{0x100A, 0x8235, "Ã‚as Ltd. de Phoenix del Âƒ de TecnologÃƒ","VIA 82C3128","U87088R06" },
-{0x100B, 0x0001, "National Semiconductors","DP83810","10/100 Ethernet MAC" },
-{0x100B, 0x0002, "National Semiconductors","PC87415","PCI-IDE DMA Master Mode Interface Ctrlr" },
-{0x100B, 0x000E, "National Semiconductors","PC87560","Legacy I/O Controller" },
-{0x100B, 0x000F, "National Semiconductors","CS4210","IEEE 1394 OHCI Controller" },
-{0x100B, 0x0011, "National Semiconductors","PC87560","PCI System I/O" },
-{0x100B, 0x0012, "National Semiconductors","","USB Controller" },
-{0x100B, 0x001B, "National Semiconductors","LM4560","Advanced PCI Audio Accelerator" },
-{0x100B, 0x0020, "National Semiconductors","DP83815","MacPhyter 10/100 Mb/s Ethernet MAC & PHY" },
-{0x100B, 0x0021, "National Semiconductors","PC82440","PCI to ISA Bridge" },
-{0x100B, 0x0022, "National Semiconductors","DP83820/1","10/100/1000 Mb/s PCI Ethernet NIC" },
-{0x100B, 0x0028, "National Semiconductors","Geode GX2","PCI Host Bridge" },
-{0x100B, 0x002A, "National Semiconductors","CS5535","GeodeLink PCI South Bridge" },
-{0x100B, 0x002D, "National Semiconductors","5535","Geode IDE Controller" },
-{0x100B, 0x002E, "National Semiconductors","Castle ()","GEODE - GX3 Audio CS5535" },
-{0x100B, 0x002F, "National Semiconductors","Geode","USB Controller" },
-{0x100B, 0x0030, "National Semiconductors","NSC","Geode VGA Compatible Device" },
-{0x100B, 0x0500, "National Semiconductors","SCx200","LPC Bridge and GPIO" },
-{0x100B, 0x0501, "National Semiconductors","SCx200","SMI Status and ACPI" },
-{0x100B, 0x0502, "National Semiconductors","SC1100/SCx200","IDE Controller" },
-{0x100B, 0x0503, "National Semiconductors","SC1100/SCx200","XpressAUDIO" },
-{0x100B, 0x0504, "National Semiconductors","SCx200","Video Processor" },
-{0x100B, 0x0505, "National Semiconductors","SCx200","X-Bus Expansion Interface" },
-{0x100B, 0x0510, "National Semiconductors","SC1100","LPC Bridge and GPIO" },
-{0x100B, 0x0511, "National Semiconductors","SC1100","SMI Status and ACPI" },
-{0x100B, 0x0515, "National Semiconductors","SC1100","X-Bus Expansion Interface" },
-{0x100B, 0x23, "National Semiconductors","","" },
-{0x100B, 0xD001, "National Semiconductors","M2764AFI","PCI-IDE Interface" },
-{0x100C, 0x3202, "Tseng Labs","ET4000W32P-A","GUI Accelerator" },
-{0x100C, 0x3205, "Tseng Labs","ET4000W32P-B","GUI Accelerator" },
-{0x100C, 0x3206, "Tseng Labs","ET4000W32P-C","GUI Accelerator" },
-{0x100C, 0x3207, "Tseng Labs","54005443","GUI Accelerator" },
-{0x100C, 0x3208, "Tseng Labs","ET6000","Graphics/Multimedia Engine" },
-{0x100C, 0x4702, "Tseng Labs","ET6300","" },
-{0x100E, 0x0564, "Weitek","STPC Client","Host Bridge" },
-{0x100E, 0x55CC, "Weitek","STPC Client","South Bridge" },
-{0x100E, 0x9000, "Weitek","P9000","WeitekPower GUI Accelerator" },
-{0x100E, 0x9001, "Weitek","P9000","GUI Accelerator" },
-{0x100E, 0x9100, "Weitek","P9100","GUI Accelerator" },
-{0x1011, 0x0001, "Digital Equipment Corporation","DC21050","PCI-PCI Bridge" },
-{0x1011, 0x0002, "Digital Equipment Corporation","DC21040","Tulip Ethernet Adapter" },
-{0x1011, 0x0004, "Digital Equipment Corporation","DC21030","PCI Graphics Accelerator" },
-{0x1011, 0x0007, "Digital Equipment Corporation","Zephyr","NV-RAM" },
-{0x1011, 0x0008, "Digital Equipment Corporation","KZPSA","SCSI to SCSI Adapter" },
-{0x1011, 0x0009, "Digital Equipment Corporation","DC21140","Fast Ethernet Ctrlr" },
-{0x1011, 0x000A, "Digital Equipment Corporation","DC21230","Video Codec" },
-{0x1011, 0x000C, "Digital Equipment Corporation","1011","6IfPpL  <a href=" },
-{0x1011, 0x000D, "Digital Equipment Corporation","TGA2","TGA2 PDXGB" },
-{0x1011, 0x000F, "Digital Equipment Corporation","DEFPA","FDDI" },
-{0x1011, 0x0014, "Digital Equipment Corporation","DC21041","Tulip Plus Ethernet Adapter" },
-{0x1011, 0x0016, "Digital Equipment Corporation","DGLPB","ATM" },
-{0x1011, 0x0019, "Digital Equipment Corporation","DC21142/3","Olicom RapidFire 2327 Fast Ethernet Adapter" },
-{0x1011, 0x0021, "Digital Equipment Corporation","21052[-AB]","PCI-PCI Bridge" },
-{0x1011, 0x0022, "Digital Equipment Corporation","DC21150-AA","PCI-PCI Bridge" },
-{0x1011, 0x0023, "Digital Equipment Corporation","DC21150","PCI to PCI Bridge" },
-{0x1011, 0x0024, "Digital Equipment Corporation","DC21151/2","PCI-PCI Bridge" },
-{0x1011, 0x0025, "Digital Equipment Corporation","21153","PCI-PCI Bridge" },
-{0x1011, 0x0026, "Digital Equipment Corporation","21154","PCI-PCI Bridge" },
-{0x1011, 0x0034, "Digital Equipment Corporation","Modem56","CardBus" },
-{0x1011, 0x0045, "Digital Equipment Corporation","DC21553","PCI to PCI Bridge" },
-{0x1011, 0x0046, "Digital Equipment Corporation","21554","PCI-to-PCI Bridge" },
-{0x1011, 0x1011, "Digital Equipment Corporation","DC21050","PCI-PCI Bridge" },
-{0x1011, 0x1065, "Digital Equipment Corporation","DAC960","Mylex DAC1164P Disk Array Controller" },
-{0x1011, 0x2000, "Digital Equipment Corporation","3X-KPCON-AA","Fault Mgr (3.3v/5v Universal PCI)" },
-{0x1013, 0x0038, "Cirrus Logic","FW82371EB","pci" },
-{0x1013, 0x0040, "Cirrus Logic","CL-GD7555","Flat Panel GUI Accelerator" },
-{0x1013, 0x004C, "Cirrus Logic","CL-GD7556","64-bit Accelerated LCD/CRT Controller" },
-{0x1013, 0x00A0, "Cirrus Logic","CL-GD5440","GUI Accelerator" },
-{0x1013, 0x00A2, "Cirrus Logic","CL-GD5432","Alpine GUI Accelerator" },
-{0x1013, 0x00A4, "Cirrus Logic","CL-GD5434","Alpine GUI Accelerator" },
-{0x1013, 0x00A8, "Cirrus Logic","CL-GD5434","Alpine GUI Accelerator" },
-{0x1013, 0x00AC, "Cirrus Logic","CL-GD5426","Video card (i guess?)" },
-{0x1013, 0x00B8, "Cirrus Logic","CL-GD5446","64-bit VisualMedia Accelerator" },
-{0x1013, 0x00BC, "Cirrus Logic","CL-GD5480","64-bit SGRAM GUI accelerator" },
-{0x1013, 0x00D0, "Cirrus Logic","CL-GD5462","Laguna VisualMedia graphics accelerator" },
-{0x1013, 0x00D4, "Cirrus Logic","CL-GD5455","Laguna 3D VisualMedia Graphics Accel" },
-{0x1013, 0x00D5, "Cirrus Logic","CL-GD5464","Laguna BD" },
-{0x1013, 0x00D6, "Cirrus Logic","CL-GD5465","Laguna 3D VisualMedia Graphics Accel" },
-{0x1013, 0x00E8, "Cirrus Logic","CL-GD5436U","" },
-{0x1013, 0x1013, "Cirrus Logic","cs4630cm","accelerator do audio do pci de sound fusion" },
-{0x1013, 0x1100, "Cirrus Logic","CL-PD6729","PCI-to-PC Card host adapter" },
-{0x1013, 0x1110, "Cirrus Logic","CL-PD6832","PCMCIA/CardBus Controller" },
-{0x1013, 0x1112, "Cirrus Logic","CL-PD6834","PCMCIA/CardBus Controller" },
-{0x1013, 0x1113, "Cirrus Logic","CL-PD6833","PCI-to-CardBus Host Adapter" },
-{0x1013, 0x1200, "Cirrus Logic","CL-GD7542","Nordic GUI Accelerator" },
-{0x1013, 0x1202, "Cirrus Logic","GD7543","Viking GUI Accelerator" },
-{0x1013, 0x1204, "Cirrus Logic","CL-GD7541","Nordic-lite VGA Cntrlr" },
-{0x1013, 0x4000, "Cirrus Logic","1085","Ambient CLM Data Fax Voice" },
-{0x1013, 0x4400, "Cirrus Logic","CL-CD4400","Communications Controller" },
-{0x1013, 0x6001, "Cirrus Logic","CS4610/4611","CrystalClear SoundFusion PCI Audio Accelerator" },
-{0x1013, 0x6003, "Cirrus Logic","CS4630-CM","Crystal Sound Fusion a" },
-{0x1013, 0x6004, "Cirrus Logic","CS464","CrystalClear SoundFusion PCI Audio Accel" },
-{0x1013, 0x6005, "Cirrus Logic","CS4010","Crystal Soundfusion(tm) CS 40210" },
-{0x1013, 0x9876, "Cirrus Logic","cirrus logic crystal CS 4614","SoundFusion PCI Audio Accelerator" },
-{0x1014, 0x0002, "International Business Machines Corp.","MCA Bridge","MCA Bridge" },
-{0x1014, 0x0005, "International Business Machines Corp.","Alta Lite","CPU Bridge" },
-{0x1014, 0x0007, "International Business Machines Corp.","Alta MP","CPU Bridge" },
-{0x1014, 0x000A, "International Business Machines Corp.","Fire Coral","ISA Bridge w/PnP" },
-{0x1014, 0x0017, "International Business Machines Corp.","","CPU to PCI Bridge" },
-{0x1014, 0x0018, "International Business Machines Corp.","Auto LANStreamer","TR Auto LANStreamer" },
-{0x1014, 0x001B, "International Business Machines Corp.","GXT-150P","Graphics Adapter" },
-{0x1014, 0x001D, "International Business Machines Corp.","82G2675","scsi-2 fast pci adapter" },
-{0x1014, 0x0020, "International Business Machines Corp.","82351/2","MCA Bridge" },
-{0x1014, 0x0022, "International Business Machines Corp.","82351/2","PCI to PCI Bridge " },
-{0x1014, 0x002D, "International Business Machines Corp.","Python","" },
-{0x1014, 0x002E, "International Business Machines Corp.","ServeRAID I/II/3x/4H","Coppertime RAID SCSI Adapter" },
-{0x1014, 0x0036, "International Business Machines Corp.","Miami/PCI","32-bit LocalBus Bridge" },
-{0x1014, 0x0037, "International Business Machines Corp.","IBM27-82660","PowerPC to PCI Bridge and Memory Ctrlr" },
-{0x1014, 0x003A, "International Business Machines Corp.","","CPU to PCI Bridge" },
-{0x1014, 0x003E, "International Business Machines Corp.","85H9533","IBM Token Ring PCI" },
-{0x1014, 0x0045, "International Business Machines Corp.","","SSA Adapter" },
-{0x1014, 0x0046, "International Business Machines Corp.","MPIC","Interrupt Controller" },
-{0x1014, 0x0047, "International Business Machines Corp.","","PCI to PCI Bridge" },
-{0x1014, 0x0048, "International Business Machines Corp.","00003720","PCI to PCI Bridge" },
-{0x1014, 0x0049, "International Business Machines Corp.","","Warhead SCSI Controller" },
-{0x1014, 0x004D, "International Business Machines Corp.","IBM 3780IDSP","MPEG-2 Decoder" },
-{0x1014, 0x004E, "International Business Machines Corp.","","ATM Controller" },
-{0x1014, 0x004F, "International Business Machines Corp.","","ATM Controller" },
-{0x1014, 0x0050, "International Business Machines Corp.","","ATM Controller" },
-{0x1014, 0x0053, "International Business Machines Corp.","85h9533","25 MBit ATM controller" },
-{0x1014, 0x0057, "International Business Machines Corp.","85g1897","MPEG PCI Bridge" },
-{0x1014, 0x005C, "International Business Machines Corp.","i82557B","10/100 PCI Ethernet Adapter" },
-{0x1014, 0x005D, "International Business Machines Corp.","05J3506","TCP/IP networking device" },
-{0x1014, 0x007C, "International Business Machines Corp.","","ATM Controller" },
-{0x1014, 0x007D, "International Business Machines Corp.","3780IDSP","MPEG-2 Decoder" },
-{0x1014, 0x0090, "International Business Machines Corp.","GXT-3000P","" },
-{0x1014, 0x0095, "International Business Machines Corp.","20H2999","PCI Docking Bridge" },
-{0x1014, 0x0096, "International Business Machines Corp.","","Chukar chipset SCSI Controller" },
-{0x1014, 0x00A1, "International Business Machines Corp.","PowerNP NPr2.7","ATM support device" },
-{0x1014, 0x00A5, "International Business Machines Corp.","","ATM Controller" },
-{0x1014, 0x00A6, "International Business Machines Corp.","","ATM 155Mbps MM Controller" },
-{0x1014, 0x00B7, "International Business Machines Corp.","GXT2000","256-bit Graphics Rasterizer" },
-{0x1014, 0x00BE, "International Business Machines Corp.","","ATM 622Mbps Controller" },
-{0x1014, 0x00CE, "International Business Machines Corp.","02li537","Adapter 2 Token Ring Card" },
-{0x1014, 0x00F9, "International Business Machines Corp.","CPC700","Memory Controller and PCI Bridge" },
-{0x1014, 0x00FC, "International Business Machines Corp.","CPC710","PCI-64 Bridge" },
-{0x1014, 0x0105, "International Business Machines Corp.","CPC710","PCI-32 Bridge" },
-{0x1014, 0x010F, "International Business Machines Corp.","0680","Remote Supervisor+Serial Port+Mouse/Keyb" },
-{0x1014, 0x011B, "International Business Machines Corp.","cbeh3w","Raid controller" },
-{0x1014, 0x0142, "International Business Machines Corp.","Yotta","Video Compositor Input" },
-{0x1014, 0x0144, "International Business Machines Corp.","Yotta","Video Compositor Output" },
-{0x1014, 0x0153, "International Business Machines Corp.","","" },
-{0x1014, 0x0156, "International Business Machines Corp.","405GP","PLB to PCI Bridge" },
-{0x1014, 0x0170, "International Business Machines Corp.","RC1000","Rasterizer/IBM GT1000 Geometr" },
-{0x1014, 0x0188, "International Business Machines Corp.","x","PCI Bridge" },
-{0x1014, 0x01a2, "International Business Machines Corp.","82801","Modem: Intel Corporation 82440MX AC'97 Modem Controller (prog-if 00 [Generic])" },
-{0x1014, 0x01A7, "International Business Machines Corp.","IBM 133","PCI-X Bridge R1.1" },
-{0x1014, 0x01BD, "International Business Machines Corp.","ServeRAID 4/5","Morpheus SCSI RAID Controller" },
-{0x1014, 0x01ef, "International Business Machines Corp.","440GP","PLB to PCI-X Bridge" },
-{0x1014, 0x01ff, "International Business Machines Corp.","FC 4962 CCIN 4962 FRU 09P5023","10/100 Mbps Ethernet PCI Adapter II" },
-{0x1014, 0x0246, "International Business Machines Corp.","","" },
-{0x1014, 0x027F, "International Business Machines Corp.","440GX","Embedded PowerPC CPU" },
-{0x1014, 0x0289, "International Business Machines Corp.","8086","0890" },
-{0x1014, 0x028c, "International Business Machines Corp.","112","SCSI Storage Controller" },
-{0x1014, 0x0295, "International Business Machines Corp.","NECSCE 11508082","IBM SurePOS Riser Card Function 0" },
-{0x1014, 0x0297, "International Business Machines Corp.","NECSCE 11508082","IBM SurePOS Riser Card Function 1 (UARTs)" },
-{0x1014, 0x02A1, "International Business Machines Corp."," ","Calgary PCI-X Host Bridge" },
-{0x1014, 0x0302, "International Business Machines Corp.","b8331462","PCI-X Host Bridge" },
-{0x1014, 0x0308, "International Business Machines Corp.","1","IBM CalIOC2 (Calgary on PCI-E)" },
-{0x1014, 0x0339, "International Business Machines Corp.","n/a","n/a" },
-{0x1014, 0x10e5, "International Business Machines Corp.","41U0441 / 41U0442","IBM 4764-001 PCI-X Cryptographic Coprocessor (1410e501)" },
-{0x1014, 0xFFFF, "International Business Machines Corp.","MPIC 2","Interrupt Controller" },
-{0x1017, 0x5343, "Spea Software AG","v7-mpeg modul","SPEA 3D Accelerator" },
-{0x1018, 0x3330, "Unisys Systems","544469821","5444469821" },
-{0x1019, 0x1B10, "Elitegroup Computer System","sis-648D","VIA chipset" },
-{0x1019, 0x9876, "Elitegroup Computer System","5.03.2600.2180 32bit Unicode","Intel(R) Celeron(R) CPU 2.80GHz" },
-{0x101A, 0x0005, "NCR Corporation","8156","100VG/AnyLAN Adapter" },
-{0x101A, 0x0009, "NCR Corporation","Altera FLEX","PCI-X dual port  " },
-{0x101E, 0x9010, "American Megatrends Inc.","MegaRAID 428","Ultra Wide SCSI RAID Controller2" },
-{0x101E, 0x9030, "American Megatrends Inc.","","EIDE Controller" },
-{0x101E, 0x9031, "American Megatrends Inc.","","EIDE Controller" },
-{0x101E, 0x9032, "American Megatrends Inc.","","IDE and SCSI Cntrlr" },
-{0x101E, 0x9033, "American Megatrends Inc.","I960","SCSI Controller" },
-{0x101E, 0x9040, "American Megatrends Inc.","amd sempron(tm)2200+","Multimedia card" },
-{0x101E, 0x9060, "American Megatrends Inc.","MegaRAID 434","Ultra GT RAID Controller" },
-{0x101E, 0x9063, "American Megatrends Inc.","MegaRAC 780","Remote Assistant" },
-{0x101E, 0x9095, "American Megatrends Inc.","9095","SGPIO/SES/IPMI Initiator" },
-{0x1022, 0x1100, "Advanced Micro Devices","Athlon 64 / Opteron","HyperTransport Technology Configuration" },
-{0x1022, 0x1101, "Advanced Micro Devices","Athlon 64 / Opteron","Address Map" },
-{0x1022, 0x1102, "Advanced Micro Devices","Athlon 64 / Opteron","AMD Hammer - DRAM Controller " },
-{0x1022, 0x1103, "Advanced Micro Devices","Athlon 64 / Opteron","AMD Hammer - Miscellaneous Control " },
-{0x1022, 0x1200, "Advanced Micro Devices","1200","PCI standard host CPU bridge" },
-{0x1022, 0x1201, "Advanced Micro Devices","1201","PCI standard host CPU bridge" },
-{0x1022, 0x1203, "Advanced Micro Devices","1203","PCI standard host CPU bridge" },
-{0x1022, 0x1204, "Advanced Micro Devices","1204","PCI standard host CPU bridge" },
-{0x1022, 0x1419, "Advanced Micro Devices","PCI\\VEN_1022&DEV_1419&SUBSYS_14191022&REV_00","AMD Input/Outpu Memory Management Unit" },
-{0x1022, 0x1510, "Advanced Micro Devices","1510","PCI standard host CPU bridge" },
-{0x1022, 0x1513, "Advanced Micro Devices","1513","PCI standard PCI-to-PCI bridge" },
-{0x1022, 0x1514, "Advanced Micro Devices","1514","PCI standard PCI-to-PCI bridge" },
-{0x1022, 0x1515, "Advanced Micro Devices","1515","PCI standard PCI-to-PCI bridge" },
-{0x1022, 0x1700, "Advanced Micro Devices","1700","PCI standard host CPU bridge" },
-{0x1022, 0x1701, "Advanced Micro Devices","1701","PCI standard host CPU bridge" },
-{0x1022, 0x1702, "Advanced Micro Devices","1702","PCI standard host CPU bridge" },
-{0x1022, 0x1703, "Advanced Micro Devices","1703","PCI standard host CPU bridge" },
-{0x1022, 0x1704, "Advanced Micro Devices","1704","PCI standard host CPU bridge" },
-{0x1022, 0x1716, "Advanced Micro Devices","1716","PCI standard host CPU bridge" },
-{0x1022, 0x1718, "Advanced Micro Devices","1718","PCI standard host CPU bridge" },
-{0x1022, 0x1719, "Advanced Micro Devices","1719","PCI standard host CPU bridge" },
-{0x1022, 0x2000, "Advanced Micro Devices","Am79C970/1/2/3/5/6","PCnet LANCE PCI Ethernet Controller" },
-{0x1022, 0x2001, "Advanced Micro Devices","Am79C978","PCnet-Home Networking Ctrlr (1/10 Mbps)" },
-{0x1022, 0x2003, "Advanced Micro Devices","Am1772","Wireless LAN chipset SMC 2602W V3 http://www.smc.com/index.cfm?event=downloads.doSearchCriteria&loca" },
-{0x1022, 0x2020, "Advanced Micro Devices","Am53C974","SCSI Controller" },
-{0x1022, 0x2040, "Advanced Micro Devices","Am79C974","Ethernet Controller" },
-{0x1022, 0x2081, "Advanced Micro Devices","Unknown","GeodeLX graphics adapter" },
-{0x1022, 0x2082, "Advanced Micro Devices","GX3","Geode GX3 AES Crypto Driver" },
-{0x1022, 0x208F, "Advanced Micro Devices","CS5536","GeodeLink PCI South Bridge" },
-{0x1022, 0x2093, "Advanced Micro Devices","CS5536","CS5536 Audio Controller" },
-{0x1022, 0x2094, "Advanced Micro Devices","CS5536","CS5536 OHCI USB Host Controller" },
-{0x1022, 0x2095, "Advanced Micro Devices","CS5536","CS5536 EHCI USB Host Controller" },
-{0x1022, 0x2096, "Advanced Micro Devices","Number: CS5536","CS5536 USB Device Controller" },
-{0x1022, 0x2097, "Advanced Micro Devices","CS5536","CS5536 USB OTG Controller" },
-{0x1022, 0x209A, "Advanced Micro Devices","CS5536","CS5536 IDE Controller" },
-{0x1022, 0x2433, "Advanced Micro Devices","690LC","Chill Control Connector" },
-{0x1022, 0x3000, "Advanced Micro Devices","SC520","ELAN Microcontroller PCI Host Bridge" },
-{0x1022, 0x5e4b, "Advanced Micro Devices","RV410","Radeon X700 Pro" },
-{0x1022, 0x7004, "Advanced Micro Devices","AMD-751","CPU to PCI Bridge" },
-{0x1022, 0x7006, "Advanced Micro Devices","AMD-751","Processor-to-PCI Bridge / Memory Ctrlr" },
-{0x1022, 0x7007, "Advanced Micro Devices","AMD-751","AGP and PCI-to-PCI Bridge (1x/2x AGP)" },
-{0x1022, 0x700A, "Advanced Micro Devices","AMD-IGR4","AGP Host to PCI Bridge" },
-{0x1022, 0x700B, "Advanced Micro Devices","AMD-IGR4","AGP PCI to PCI Bridge" },
-{0x1022, 0x700C, "Advanced Micro Devices","AMD-762","CPU to PCI Bridge (SMP chipset)" },
-{0x1022, 0x700D, "Advanced Micro Devices","AMD-762","CPU to PCI Bridge (AGP 4x)" },
-{0x1022, 0x700E, "Advanced Micro Devices","AMD-761","North Bridge" },
-{0x1022, 0x700F, "Advanced Micro Devices","AMD-761","CPU to AGP Bridge  (AGP 4x)" },
-{0x1022, 0x7400, "Advanced Micro Devices","AMD-755","PCI to ISA Bridge" },
-{0x1022, 0x7401, "Advanced Micro Devices","AMD-755","Bus Master IDE Controller" },
-{0x1022, 0x7403, "Advanced Micro Devices","AMD-755","Power Management Controller" },
-{0x1022, 0x7404, "Advanced Micro Devices","AMD-755","PCI to USB Open Host Controller" },
-{0x1022, 0x7408, "Advanced Micro Devices","AMD-756","PCI-ISA Bridge" },
-{0x1022, 0x7409, "Advanced Micro Devices","AMD-756","EIDE Controller" },
-{0x1022, 0x740B, "Advanced Micro Devices","AMD-756","Power Management" },
-{0x1022, 0x740C, "Advanced Micro Devices","10","USB Open Host Controller" },
-{0x1022, 0x7410, "Advanced Micro Devices","AMD-766","PCI to ISA/LPC Bridge" },
-{0x1022, 0x7411, "Advanced Micro Devices","AMD-766","Enhanced IDE Controller" },
-{0x1022, 0x7412, "Advanced Micro Devices","AMD-766","USB Controller" },
-{0x1022, 0x7413, "Advanced Micro Devices","AMD-766","Power Management Controller" },
-{0x1022, 0x7414, "Advanced Micro Devices","AMD-766","USB OpenHCI Host Controller" },
-{0x1022, 0x7440, "Advanced Micro Devices","AMD-768","LPC Bridge" },
-{0x1022, 0x7441, "Advanced Micro Devices","AMD-768","EIDE Controller" },
-{0x1022, 0x7443, "Advanced Micro Devices","AMD-768","System Management" },
-{0x1022, 0x7445, "Advanced Micro Devices","AMD-768","AC97 Audio" },
-{0x1022, 0x7446, "Advanced Micro Devices","AMD-768","AC97 Modem" },
-{0x1022, 0x7448, "Advanced Micro Devices","AMD-768","PCI Bridge" },
-{0x1022, 0x7449, "Advanced Micro Devices","AMD-768","USB Controller" },
-{0x1022, 0x7450, "Advanced Micro Devices","AMD-8131","PCI-X Bridge" },
-{0x1022, 0x7451, "Advanced Micro Devices","AMD-8131","PCI-X IOAPIC" },
-{0x1022, 0x7454, "Advanced Micro Devices","AMD-8151","System Controller" },
-{0x1022, 0x7455, "Advanced Micro Devices","AMD-8151","AGP Bridge" },
-{0x1022, 0x7458, "Advanced Micro Devices","AMD-8132","PCI-X Bridge" },
-{0x1022, 0x7459, "Advanced Micro Devices","AMD-8132","PCI-X IOAPIC" },
-{0x1022, 0x7460, "Advanced Micro Devices","AMD-8111","PCI Bridge" },
-{0x1022, 0x7461, "Advanced Micro Devices","AMD-8111","USB 2.0 Controller" },
-{0x1022, 0x7462, "Advanced Micro Devices","AMD-8111","Ethernet Controller" },
-{0x1022, 0x7463, "Advanced Micro Devices","AMD-8111","USB Enhanced Host Controller" },
-{0x1022, 0x7464, "Advanced Micro Devices","AMD-8111","USB OpenHCI Host Controller" },
-{0x1022, 0x7468, "Advanced Micro Devices","AMD-8111","LPC Bridge" },
-{0x1022, 0x7469, "Advanced Micro Devices","AMD-8111","UltraATA/133 Controller" },
-{0x1022, 0x746A, "Advanced Micro Devices","AMD-8111","SMBus 2.0 Controller" },
-{0x1022, 0x746B, "Advanced Micro Devices","AMD-8111","System Management" },
-{0x1022, 0x746D, "Advanced Micro Devices","AMD-8111 (not sure but definitively not c-media cm"," Audio Controller" },
-{0x1022, 0x746E, "Advanced Micro Devices","AMD-8111","AC'97 Modem" },
-{0x1022, 0x756B, "Advanced Micro Devices","AMD-8111","ACPI Controller" },
-{0x1022, 0x7801, "Advanced Micro Devices","amd_sata","AMD SATA Controller" },
-{0x1022, 0x7804, "Advanced Micro Devices","AMD SATA Controller","AMD SATA Controller" },
-{0x1022, 0x7807, "Advanced Micro Devices","Standard OpenHCD USB Host Controller - Amd Usb Fil","Standard OpenHCD USB Host Controller - Amd Usb Filter Driver" },
-{0x1022, 0x7808, "Advanced Micro Devices","Standard PCI-to-USB extended host controller ","Standard PCI-to-USB extended host controller " },
-{0x1022, 0x7809, "Advanced Micro Devices","7809","Standard OpenHCD USB Host Controller" },
-{0x1022, 0x780b, "Advanced Micro Devices","2128103C","SM Bus controller" },
-{0x1022, 0x780D, "Advanced Micro Devices","780D","High Definition Audio Controller" },
-{0x1022, 0x780E, "Advanced Micro Devices","780E","PCI standard ISA bridge" },
-{0x1022, 0x780F, "Advanced Micro Devices","780F","PCI standard PCI-to-PCI bridge" },
-{0x1022, 0x7812, "Advanced Micro Devices","amd_sata ","AMD USB 3.0 Host Controller" },
-{0x1022, 0x7814, "Advanced Micro Devices","7814","FCH USB XHCI Controller" },
-{0x1022, 0x840, "Advanced Micro Devices","4u","Used to blow up the motherboard.  Highly explosive.  Use at ur own risk" },
-{0x1022, 0x9601, "Advanced Micro Devices","9601","PCI standard host CPU bridge" },
-{0x1022, 0x9602, "Advanced Micro Devices","9602","PCI standard PCI-to-PCI bridge" },
-{0x1022, 0x9604, "Advanced Micro Devices","9604","PCI standard PCI-to-PCI bridge" },
-{0x1022, 0x9605, "Advanced Micro Devices","9605","PCI standard PCI-to-PCI bridge" },
-{0x1022, 0x9606, "Advanced Micro Devices","9609","PCI standard PCI-to-PCI bridge" },
-{0x1022, 0x9642, "Advanced Micro Devices","AMD-6370D","AMD Radeon HD6370D" },
-{0x1023, 0x0194, "TRIDENT MICRO","82C194","CardBus Controller" },
-{0x1023, 0x2000, "TRIDENT MICRO","4DWAVE-DX","advanced PCI DirectSound accelerator" },
-{0x1023, 0x2001, "TRIDENT MICRO","4D WAVE DX SOUND ACCELERATOR","PCI Audio" },
-{0x1023, 0x2100, "TRIDENT MICRO","Cyber-XP4","Video Accelerator" },
-{0x1023, 0x2200, "TRIDENT MICRO","Volari V3","Video adapter" },
-{0x1023, 0x8400, "TRIDENT MICRO","84001023","sausgauos" },
-{0x1023, 0x8420, "TRIDENT MICRO","51331071","Trident Cyber Blade i7 AGP (55)" },
-{0x1023, 0x8500, "TRIDENT MICRO","VT8361","Via Tech VT8361/VT8601 Graphics Controller" },
-{0x1023, 0x8520, "TRIDENT MICRO","Trident Video Accelerator CyberBlade i1","Windows xp" },
-{0x1023, 0x8620, "TRIDENT MICRO","CyberBlade-i1","trident" },
-{0x1023, 0x8820, "TRIDENT MICRO","Ai1","TRIDENT DISPLAY CONTROLER /CyberALADDiN-T Driver" },
-{0x1023, 0x9320, "TRIDENT MICRO","TGUI9320","32-bit GUI Accelerator" },
-{0x1023, 0x9350, "TRIDENT MICRO","TGUI9350","32-bit GUI Accelerator" },
-{0x1023, 0x9360, "TRIDENT MICRO","7tskbc","Flat panel Cntrlr" },
-{0x1023, 0x9382, "TRIDENT MICRO","Cyber9382","" },
-{0x1023, 0x9383, "TRIDENT MICRO","Cyber9383","" },
-{0x1023, 0x9385, "TRIDENT MICRO","Cyber9385","" },
-{0x1023, 0x9386, "TRIDENT MICRO","Cyber9386","Video Accelerator" },
-{0x1023, 0x9388, "TRIDENT MICRO","Cyber9388","Video Accelerator" },
-{0x1023, 0x9397, "TRIDENT MICRO","Cyber9397","Video Accelerator 3D" },
-{0x1023, 0x939A, "TRIDENT MICRO","Cyber9397DVD","Video Accelerator" },
-{0x1023, 0x9420, "TRIDENT MICRO","TGUI9420","DGi GUI Accelerator" },
-{0x1023, 0x9430, "TRIDENT MICRO","TGUI9430","GUI Accelerator" },
-{0x1023, 0x9440, "TRIDENT MICRO","TGUI9682","DGi GUI Acclerator" },
-{0x1023, 0x9460, "TRIDENT MICRO","TGUI9460","32-bit GUI Accelerator" },
-{0x1023, 0x9470, "TRIDENT MICRO","TGUI9470","" },
-{0x1023, 0x9520, "TRIDENT MICRO","ox16","Video Accelerator" },
-{0x1023, 0x9525, "TRIDENT MICRO","Cyber9525","Video Accelerator" },
-{0x1023, 0x9540, "TRIDENT MICRO","Cyber9540","Video Acclerator" },
-{0x1023, 0x9660, "TRIDENT MICRO","TGUI9660","GUI Accelerator" },
-{0x1023, 0x9680, "TRIDENT MICRO","TGUI9680","GUI Accelerator" },
-{0x1023, 0x9682, "TRIDENT MICRO","TGUI9680","Trident A CAB01" },
-{0x1023, 0x9683, "TRIDENT MICRO","TGUI9683","GUI Accelerator" },
-{0x1023, 0x9685, "TRIDENT MICRO","ProVIDIA 9685","2MB VGA" },
-{0x1023, 0x9750, "TRIDENT MICRO","3DImage 9750 PCI/AGP","trident dgi" },
-{0x1023, 0x9753, "TRIDENT MICRO","TGUI9753","Video Accelerator" },
-{0x1023, 0x9754, "TRIDENT MICRO","TGUI9753","Wave Video Accelerator" },
-{0x1023, 0x9759, "TRIDENT MICRO","TGUI975?","Image GUI Accelerator" },
-{0x1023, 0x9783, "TRIDENT MICRO","TGUI9783","" },
-{0x1023, 0x9785, "TRIDENT MICRO","TGUI9785","" },
-{0x1023, 0x9850, "TRIDENT MICRO","3D Image 9850 AGP","4mb" },
-{0x1023, 0x9880, "TRIDENT MICRO","Blade 3D 9880","gggggg" },
-{0x1023, 0x9910, "TRIDENT MICRO","00011178","CyberBlade XP" },
-{0x1023, 0x9930, "TRIDENT MICRO","CyberBlade XPm","" },
-{0x1023, 0x9960, "TRIDENT MICRO","9960","Trident Video Accelerator CyberBlade-1A31" },
-{0x1025, 0x0028, "Acer Incorporated","AC97","Agere Systems soft modem chip" },
-{0x1025, 0x1435, "Acer Incorporated","M1435","USB\\VID_0502&PID_3476&MI_01\\6&207B7CA8&0&0001" },
-{0x1025, 0x1445, "Acer Incorporated","M1445","VL Bridge & EIDE" },
-{0x1025, 0x1449, "Acer Incorporated","M1449","ISA Bridge" },
-{0x1025, 0x1451, "Acer Incorporated","M1451","Pentium Chipset" },
-{0x1025, 0x1461, "Acer Incorporated","M1461","P54C Chipset" },
-{0x1025, 0x1489, "Acer Incorporated","M1489","" },
-{0x1025, 0x1511, "Acer Incorporated","M1511","" },
-{0x1025, 0x1512, "Acer Incorporated","M1512","" },
-{0x1025, 0x1513, "Acer Incorporated","M1513","" },
-{0x1025, 0x1521, "Acer Incorporated","M1521","CPU Bridge" },
-{0x1025, 0x1523, "Acer Incorporated","M1523","ISA Bridge" },
-{0x1025, 0x1531, "Acer Incorporated","M1531","North Bridge" },
-{0x1025, 0x1533, "Acer Incorporated","M1533","ISA South Bridge" },
-{0x1025, 0x1535, "Acer Incorporated","M1535","PCI South Bridge" },
-{0x1025, 0x1541, "Acer Incorporated","M1541","AGP PCI North Bridge Aladdin V/V+" },
-{0x1025, 0x1542, "Acer Incorporated","M1542","AGP+PCI North Bridge" },
-{0x1025, 0x1543, "Acer Incorporated","M1543C","PCi South Bridge Aladdin IV+/V" },
-{0x1025, 0x1561, "Acer Incorporated","M1561","driver video" },
-{0x1025, 0x1621, "Acer Incorporated","M1621","PCI North Bridge Aladdin Pro II" },
-{0x1025, 0x1631, "Acer Incorporated","M1631","PCI North Bridge Aladdin Pro III" },
-{0x1025, 0x1641, "Acer Incorporated","M1641","PCI North Bridge Aladdin Pro IV" },
-{0x1025, 0x3141, "Acer Incorporated","M3141","GUI Accelerator" },
-{0x1025, 0x3143, "Acer Incorporated","M3143","GUI Accelerator" },
-{0x1025, 0x3145, "Acer Incorporated","M3145","GUI Accelerator" },
-{0x1025, 0x3147, "Acer Incorporated","M3147","GUI Accelerator" },
-{0x1025, 0x3149, "Acer Incorporated","M3149","GUI Accelerator" },
-{0x1025, 0x3151, "Acer Incorporated","M3151","GUI Accelerator" },
-{0x1025, 0x3307, "Acer Incorporated","M3307","MPEG-1 Decoder" },
-{0x1025, 0x3309, "Acer Incorporated","M3309","MPEG Decoder" },
-{0x1025, 0x5212, "Acer Incorporated","M4803","" },
-{0x1025, 0x5215, "Acer Incorporated","M5217","EIDE Controller" },
-{0x1025, 0x5217, "Acer Incorporated","M5217","I/O Controller" },
-{0x1025, 0x5219, "Acer Incorporated","M5219","I/O Controller" },
-{0x1025, 0x5225, "Acer Incorporated","M5225","EIDE Controller" },
-{0x1025, 0x5229, "Acer Incorporated","M522","EIDE Controlle" },
-{0x1025, 0x5235, "Acer Incorporated","1025","I/O Controller" },
-{0x1025, 0x5237, "Acer Incorporated","M5237","Intel(R) 5 Series/3400 Series Chipset Family 4 Port SATA AHCI Controller - 3B29" },
-{0x1025, 0x5239, "Acer Incorporated","","" },
-{0x1025, 0x5240, "Acer Incorporated","","EIDE Controller" },
-{0x1025, 0x5241, "Acer Incorporated","","PCMCIA Bridge" },
-{0x1025, 0x5242, "Acer Incorporated","","General Purpose Controller" },
-{0x1025, 0x5243, "Acer Incorporated","","PCI to PCI Bridge" },
-{0x1025, 0x5244, "Acer Incorporated","","Floppy Disk Controller" },
-{0x1025, 0x5247, "Acer Incorporated","M1541","PCI-PCI Bridge" },
-{0x1025, 0x5427, "Acer Incorporated","","PCI to AGP Bridge" },
-{0x1025, 0x5451, "Acer Incorporated","M5451","PCI AC-Link Controller Audio Device" },
-{0x1025, 0x5453, "Acer Incorporated","M5453","M5453 AC-Link Controller Modem Device" },
-{0x1025, 0x7101, "Acer Incorporated","M7101","PCI PMU Power Management Controller" },
-{0x1028, 0x0001, "Dell Inc.","PowerEdge 2 /Si","Expandable RAID Controller (PERC) (SCSI)" },
-{0x1028, 0x0002, "Dell Inc.","PowerEdge 3/Di","Expandable RAID Controller" },
-{0x1028, 0x0003, "Dell Inc.","PowerEdge 3/Si","Expandable RAID Controller" },
-{0x1028, 0x0004, "Dell Inc.","PowerEdge 3/Si","Expandable RAID Controller" },
-{0x1028, 0x0005, "Dell Inc.","PowerEdge 3/Di","Expandable RAID Controller" },
-{0x1028, 0x0006, "Dell Inc.","PowerEdge 3/Di","Expandable RAID Controller" },
-{0x1028, 0x0007, "Dell Inc.","270","Remote Assistant Card" },
-{0x1028, 0x0008, "Dell Inc.","PowerEdge 3/Di","RAC Virtual UART Port" },
-{0x1028, 0x000A, "Dell Inc.","PowerEdge 3/Di","Expandable RAID Controller" },
-{0x1028, 0x000C, "Dell Inc.","53C885 23800 SCSI Adapter","Embedded Systems Management Device 4" },
-{0x1028, 0x000D, "Dell Inc.","?","LSI53C895 PCI to Ultra2 SCSI I/O Processor with LVD Link" },
-{0x1028, 0x000E, "Dell Inc.","000E","PERC 4/DI Raid Controller" },
-{0x1028, 0x0010, "Dell Inc.","DRAC4","HJ866 - ESM4 &#1059;&#1076;&#1072;&#1083;&#1077;&#1085;&#1085;&#1099;&#1081; &#1044;&#1086;&#1089;&#" },
-{0x1028, 0x0011, "Dell Inc.","DRAC4","Dell Remote Access Controller v4" },
-{0x1028, 0x0012, "Dell Inc.","DRAC4-UART","Dell RAC v4 Virtual UART" },
-{0x1028, 0x0013, "Dell Inc.","PERC 4e/Si and PERC 4e/Di","Expandable RAID Controller" },
-{0x1028, 0x0014, "Dell Inc.","DRAC4-0","Dell Remote Access Controller subsystem" },
-{0x1028, 0x0015, "Dell Inc.","PERC 5/i RAID Controller","Integrated RAID controller" },
-{0x1028, 0x012c, "Dell Inc.","915gm/gms,910gml","Intel Gigabit controller" },
-{0x1028, 0x016d, "Dell Inc.","82541GI","Dell PRO/1000 MT Network Connection" },
-{0x1028, 0x0287, "Dell Inc.","DELL PERC 320/DC","Adaptec 2200S SCSI RAID controller" },
-{0x1028, 0x1000, "Dell Inc.","FA82537EP","A Intel 537 epg v.92 modem repackaged by dell" },
-{0x1028, 0x1050, "Dell Inc.","0200","ethernet controller" },
-{0x1028, 0x1f0c, "Dell Inc.","4050","PCI Simple Communication Controller" },
-{0x1028, 0x2107, "Dell Inc.","0115","HID Keyboard Device" },
-{0x1028, 0x3002, "Dell Inc.","AR3011","Dell Wireless 1702 Bluetooth v3.0+HS" },
-{0x1028, 0x3582, "Dell Inc.","ispiron 4700","video controller" },
-{0x1028, 0x675d, "Dell Inc.","hd7570","amd radeon hd7570" },
-{0x1028, 0x6821, "Dell Inc.","3","3" },
-{0x1028, 0x8184, "Dell Inc.","Dell Wireless 5540","Dell Wireless 5540 HSPA Mini Card" },
-{0x1028, 0x9876, "Dell Inc.","PowerEdge 3/Si","Expandable RAID Controller" },
-{0x102A, 0x0000, "LSI Logic Headland Division","HYDRA","4 port usb hub" },
-{0x102A, 0x0003, "LSI Logic Headland Division","0x0000","USB\\VID_0000&PID_0000\\6&76F8B18&0&2" },
-{0x102A, 0x0010, "LSI Logic Headland Division","ASPEN","i486 Chipset" },
-{0x102A, 0x002A, "LSI Logic Headland Division","6.1.7601.18328","4 port usb hub" },
-{0x102A, 0x102A, "LSI Logic Headland Division","HYDRA","P5 Chipset" },
-{0x102A, 0x9876, "LSI Logic Headland Division","HYDRA","P5 CHIPSET" },
-{0x102B, 0x0010, "Matrox Electronic Systems Ltd.","MGA-I","Impression?" },
-{0x102B, 0x0040, "Matrox Electronic Systems Ltd.","chip=0x2539102b","Matrox P650 very new model (20080724)" },
-{0x102B, 0x051, "Matrox Electronic Systems Ltd.","MGA-2164W","matrox" },
-{0x102B, 0x0518, "Matrox Electronic Systems Ltd.","MGA-PX2085","Atlas GUI Accelerator" },
-{0x102B, 0x0519, "Matrox Electronic Systems Ltd.","MGA-2064W","Strorm GUI Accelerator" },
-{0x102B, 0x051A, "Matrox Electronic Systems Ltd.","mga-1164sg-a","Hurricane/Cyclone 64-bit graphics chip" },
-{0x102B, 0x051B, "Matrox Electronic Systems Ltd.","MGA-2164W","Matrox" },
-{0x102B, 0x051E, "Matrox Electronic Systems Ltd.","MGA-1164SG","Chinook" },
-{0x102B, 0x051F, "Matrox Electronic Systems Ltd.","MGA-200B","Mistral" },
-{0x102B, 0x0520, "Matrox Electronic Systems Ltd.","Matrox lnc MGA-G200B","AGP" },
-{0x102B, 0x0521, "Matrox Electronic Systems Ltd.","Matrox lnc MGA-G200B","102B" },
-{0x102B, 0x0522, "Matrox Electronic Systems Ltd.","G200e","Matrox G200e (ServerEngines) - English" },
-{0x102B, 0x0525, "Matrox Electronic Systems Ltd.","i440B","Intel Pentium III" },
-{0x102B, 0x0527, "Matrox Electronic Systems Ltd.","Parhelia AGP","" },
-{0x102B, 0x0528, "Matrox Electronic Systems Ltd.","Parhelia","Parhelia 128MB/256MB/PCI/HR256" },
-{0x102B, 0x0530, "Matrox Electronic Systems Ltd.","Matrox  G200eV","Matrox G200eV" },
-{0x102B, 0x0534, "Matrox Electronic Systems Ltd.","?","G200eR" },
-{0x102B, 0x0540, "Matrox Electronic Systems Ltd.","M9138","M9138 LP PCIe x16" },
-{0x102B, 0x0D10, "Matrox Electronic Systems Ltd.","MGA-I","Athena GUI accelerator" },
-{0x102B, 0x1000, "Matrox Electronic Systems Ltd.","MGA-G100","Twister" },
-{0x102B, 0x1001, "Matrox Electronic Systems Ltd.","MGA-G100","Twister AGP" },
-{0x102B, 0x1525, "Matrox Electronic Systems Ltd.","Fusion G450 AGP","" },
-{0x102B, 0x1527, "Matrox Electronic Systems Ltd.","Fusion Plus G800 AGP","" },
-{0x102B, 0x2007, "Matrox Electronic Systems Ltd.","Mistral","GUI+3D Accelerator" },
-{0x102B, 0x2527, "Matrox Electronic Systems Ltd.","MGA-G550","AGP Chipset" },
-{0x102B, 0x2537, "Matrox Electronic Systems Ltd.","Parhelia-LX","Parhelia Chipset AGP" },
-{0x102B, 0x2538, "Matrox Electronic Systems Ltd.","Matrox Millennium P650 LP PCIe 64","Matrox Millennium P650 LP PCIe 64" },
-{0x102B, 0x2539, "Matrox Electronic Systems Ltd.","G550/P650 Dual DVI","Matrox Graphics Board dual DVI" },
-{0x102B, 0x4536, "Matrox Electronic Systems Ltd.","Meteor 2 STD/MC/Dig","Video Capture Card" },
-{0x102B, 0x522, "Matrox Electronic Systems Ltd.","MGA-G200E","Matrox G200e (ServerEngines)" },
-{0x102B, 0x525, "Matrox Electronic Systems Ltd.","G450","G45+" },
-{0x102B, 0x532, "Matrox Electronic Systems Ltd.","G200eW","Matrox G200eW 8 MB DDR2 " },
-{0x102B, 0x6573, "Matrox Electronic Systems Ltd.","Shark","10/100 Multiport Switch NIC" },
-{0x102B, 0x80A0, "Matrox Electronic Systems Ltd.","RT.x10","Multimedia Device" },
-{0x102B, 0x9876, "Matrox Electronic Systems Ltd.","RT 2000","Multimedia device" },
-{0x102C, 0x00B8, "Asiliant (Chips And Technologies)","64310","Wingine DGX - DRAM Graphics Accelerator" },
-{0x102C, 0x00C0, "Asiliant (Chips And Technologies)","69000","AGP/PCI Flat Panel/CRT VGA Accelerator" },
-{0x102C, 0x00D0, "Asiliant (Chips And Technologies)","65545","Flat panel/crt VGA Cntrlr" },
-{0x102C, 0x00D8, "Asiliant (Chips And Technologies)","65540","Flat Panel/CRT VGA Controller" },
-{0x102C, 0x00DC, "Asiliant (Chips And Technologies)","65548","GUI Accelerator" },
-{0x102C, 0x00E0, "Asiliant (Chips And Technologies)","65550","LCD/CRT controller" },
-{0x102C, 0x00E4, "Asiliant (Chips And Technologies)","65554","Flat Panel/LCD CRT GUI Accelerator" },
-{0x102C, 0x00E5, "Asiliant (Chips And Technologies)","65555","VGA GUI Accelerator" },
-{0x102C, 0x00F0, "Asiliant (Chips And Technologies)","68554","vga Controller" },
-{0x102C, 0x00F4, "Asiliant (Chips And Technologies)","68554","graphic driver" },
-{0x102C, 0x00F5, "Asiliant (Chips And Technologies)","68555","GUI Controller" },
-{0x102C, 0x01E0, "Asiliant (Chips And Technologies)","65560","PCI Flat Panel/CRT VGA Accelerator" },
-{0x102C, 0x0C30, "Asiliant (Chips And Technologies)","69030","AGP/PCI Flat Panel/CRT VGA Accelerator" },
-{0x102D, 0x50DC, "Wyse Technology","3328","Audio" },
-{0x102F, 0x0009, "Toshiba America","r4x00","CPU Bridge" },
-{0x102F, 0x000A, "Toshiba America","TX3927","CPU Bridge?" },
-{0x102F, 0x0020, "Toshiba America","Meteor 155","ATM PCI Adapter" },
-{0x102F, 0x0030, "Toshiba America","TC35815CF","PCI\\VEN_8086" },
-{0x102F, 0x0031, "Toshiba America","TX4938","Integrated 10/100 Mbit Ethernet Controller" },
-{0x102F, 0x0100, "Toshiba America","8185","Realtek RTS5208 Card Reader" },
-{0x102F, 0x0105, "Toshiba America","TC86C001FG","GOKU-S Bus Master IDE Controller" },
-{0x102F, 0x0106, "Toshiba America","TC86C001FG","GOKU-S USB Host Controller" },
-{0x102F, 0x0107, "Toshiba America","TC86C001FG","GOKU-S USB Device Controller" },
-{0x102F, 0x0108, "Toshiba America","TC86C001FG","GOKU-S I2C Bus/SIO/GPIO Controller" },
-{0x102F, 0x0180, "Toshiba America","TX4927","MIPS Processor" },
-{0x102F, 0x0181, "Toshiba America","TX4925","MIPS RISC PCI Controller (PCIC)" },
-{0x102F, 0x0182, "Toshiba America","TX4937","MIPS RISC PCI Controller (PCIC)" },
-{0x102F, 0x01BA, "Toshiba America","SE1000","SpursEngine" },
-{0x102F, 0x0805, "Toshiba America","TC35815CF","PCI\\VEN_1179&DEV_0805&CC_0880" },
-{0x102F, 0x102F, "Toshiba America","ACPI\\SMCFO30\\4&69EE968&0","PCI\\VEN_1179&DEV_0805&SUBSYS_00011179&REV_05\\4&7562792&0&68F0" },
-{0x1031, 0x5601, "miro Computer Products AG","MiroVIDEO DC20","I/O & JPEG" },
-{0x1031, 0x5607, "miro Computer Products AG","2IVDC-PCX1 1250400 033893932","video in and out with motion jpeg compression and deco" },
-{0x1031, 0x5631, "miro Computer Products AG","Media 3D","" },
-{0x1031, 0x6057, "miro Computer Products AG","MiroVIDEO DC30D","DC30D-601601-4.0" },
-{0x1033, 0x0001, "NEC Electronics","upD98409","PCI to 486 like bus Bridge" },
-{0x1033, 0x0002, "NEC Electronics","","PCI to VL98 Bridge" },
-{0x1033, 0x0003, "NEC Electronics","","ATM Controller" },
-{0x1033, 0x0004, "NEC Electronics","R4000","PCI bus Bridge" },
-{0x1033, 0x0005, "NEC Electronics","pci 7432","PCI to 486 like peripheral bus Bridge" },
-{0x1033, 0x0006, "NEC Electronics","","GUI Accelerator" },
-{0x1033, 0x0007, "NEC Electronics","unknown from Creative.com","PCI to ux-bus Bridge" },
-{0x1033, 0x0008, "NEC Electronics","","GUI Accelerator (vga equivalent)" },
-{0x1033, 0x0009, "NEC Electronics","","graphic Cntrlr for 98" },
-{0x1033, 0x001A, "NEC Electronics","Nile II","" },
-{0x1033, 0x001D, "NEC Electronics","uPD98405","NEASCOT-S20 ATM Integrated SAR Ctrlr" },
-{0x1033, 0x0021, "NEC Electronics","Vrc4373","Nile I" },
-{0x1033, 0x0029, "NEC Electronics","PoverVR PCX1","3D Accelerator" },
-{0x1033, 0x002A, "NEC Electronics","PoverVR","3D Accelerator" },
-{0x1033, 0x002f, "NEC Electronics","NEC D72874GC","1394 Host Controller" },
-{0x1033, 0x0034, "NEC Electronics","PCI\\VEN_1033&DEV_0034&SUBSYS_00341033&REV_43","PCI\\VEN_1033&DEV_0034&SUBSYS_00341033" },
-{0x1033, 0x0035, "NEC Electronics","udp9210","Dual OHCI controllers plus Single EHCI controller" },
-{0x1033, 0x0036, "NEC Electronics","uPD98409","NEASCOT-S40C ATM Light SAR Controller" },
-{0x1033, 0x003E, "NEC Electronics","uPD66369","NAPCCARD CardBus Controller" },
-{0x1033, 0x0046, "NEC Electronics","PoverVR PCX2","3D Accelerator" },
-{0x1033, 0x005A, "NEC Electronics","Vrc5074","Nile 4" },
-{0x1033, 0x0063, "NEC Electronics","uPD72862","Firewarden IEEE1394 OHCI Host Controller" },
-{0x1033, 0x0067, "NEC Electronics","PowerVR Neon 250","PowerVR series II graphics processor" },
-{0x1033, 0x0074, "NEC Electronics","NEC FMK 56 V90","56k Voice Modem" },
-{0x1033, 0x009B, "NEC Electronics","Vrc5476","" },
-{0x1033, 0x00A6, "NEC Electronics","","" },
-{0x1033, 0x00BE, "NEC Electronics","VR4122","64-bit CPU with Northbridge" },
-{0x1033, 0x00CD, "NEC Electronics","uPD72870","IEEE1394 1-Chip OHCI Host Controller" },
-{0x1033, 0x00CE, "NEC Electronics","uPD72871/2","IEEE1394 1-Chip OHCI Host Controller" },
-{0x1033, 0x00E0, "NEC Electronics","uPD720100A uPD720102GC","USB 2.0 Host Controller" },
-{0x1033, 0x00E7, "NEC Electronics","uPD72874","IEEE1394 OHCI 1.1 3-port PHY-Link Ctrlr" },
-{0x1033, 0x00F2, "NEC Electronics","D72874GC","IEEE1394+OHCI+1.1+3-port+PHY-Link+Ctrlr" },
-{0x1033, 0x0165, "NEC Electronics","-","AVerMedia A313 MiniCard Hybrid DVB-T" },
-{0x1033, 0x0194, "NEC Electronics","0C0330","Renesas Electronics USB 3.0 Host Controller" },
-{0x1033, 0x0520, "NEC Electronics","NEC D72874GC","1394 CARD" },
-{0x1033, 0x1033, "NEC Electronics","0720101GJ","NEC PCI to USB Open Host Controller" },
-{0x1033, 0x9876, "NEC Electronics","uPD720100A uPD720102GC","USB 2.0 Host Controller" },
-{0x1036, 0x0000, "Future Domain","TMC-18C30","Fast SCSI" },
-{0x1039, 0x0001, "Silicon Integrated Systems","HPSiS760","Anthlon 64 cpu to PCI bridge" },
-{0x1039, 0x0002, "Silicon Integrated Systems","520","Virtual PCI to PCI Bridge (AGP)" },
-{0x1039, 0x0003, "Silicon Integrated Systems","SiS760","SiS AGP Controller / SiS Accelerated Graphics Port " },
-{0x1039, 0x0005, "Silicon Integrated Systems","0900","Pentium chipset" },
-{0x1039, 0x0006, "Silicon Integrated Systems","SiS 85C501","PCI/ISA Cache Memory Controller (PCMC)" },
-{0x1039, 0x0008, "Silicon Integrated Systems","SiS 85C503","PCI System I/O (PSIO)" },
-{0x1039, 0x0009, "Silicon Integrated Systems","5595","SIS PMU device" },
-{0x1039, 0x0016, "Silicon Integrated Systems","SiS740","SMBus ControllerP4kjc" },
-{0x1039, 0x0018, "Silicon Integrated Systems","SiS950","vga" },
-{0x1039, 0x0160, "Silicon Integrated Systems","SiS160","SiS160 811 Wireless LAN Adapter" },
-{0x1039, 0x0180, "Silicon Integrated Systems","SiS180","SiS 180/181 RAID Controller " },
-{0x1039, 0x0181, "Silicon Integrated Systems","?","Raid Controller(?Mode Raid1)" },
-{0x1039, 0x0182, "Silicon Integrated Systems","?","Raid Controller(?Mode Raid0+1)" },
-{0x1039, 0x0183, "Silicon Integrated Systems","?SIS965","?SATA" },
-{0x1039, 0x0186, "Silicon Integrated Systems","1039","0330" },
-{0x1039, 0x0190, "Silicon Integrated Systems","SiS968, SiS965, SiS966, SiS965L, SiS966L","SiS191 Gigabit LAN & SiS190 LAN" },
-{0x1039, 0x0191, "Silicon Integrated Systems","SIS191","SIS191" },
-{0x1039, 0x0200, "Silicon Integrated Systems","SiS5597/98","Onboard Graphics Controller" },
-{0x1039, 0x0204, "Silicon Integrated Systems","SiS 6215","PCI1" },
-{0x1039, 0x0205, "Silicon Integrated Systems","SiS 6205","PCI Graphics & Video Accelerator" },
-{0x1039, 0x0300, "Silicon Integrated Systems","SiS330","GUI Accelerator+3D" },
-{0x1039, 0x0305, "Silicon Integrated Systems","SiS305","2D/3D/Video/DVD Accelerator" },
-{0x1039, 0x0315, "Silicon Integrated Systems","Geforce2 MX400","2D/3D Accelerator" },
-{0x1039, 0x0325, "Silicon Integrated Systems","SiS6330","Silicon Integrated Systems (SiS)" },
-{0x1039, 0x0330, "Silicon Integrated Systems","SiS330","Xabre 2D/3D Accelerator (AG400T8-D64)" },
-{0x1039, 0x0406, "Silicon Integrated Systems","85C501","PCI/ISA Cache Memory Controller (PCMC)" },
-{0x1039, 0x0496, "Silicon Integrated Systems","85C496","CPU to PCI & PCI to ISA Bridge" },
-{0x1039, 0x0530, "Silicon Integrated Systems","SiS530","Host-to-PCI bridge" },
-{0x1039, 0x0540, "Silicon Integrated Systems","SiS540","Host-to-PCI Bridge" },
-{0x1039, 0x0550, "Silicon Integrated Systems","SiS550/1/2","North Bridge" },
-{0x1039, 0x0596, "Silicon Integrated Systems","SiS596","Pentium PCI chipset with IDE" },
-{0x1039, 0x0597, "Silicon Integrated Systems","SiS620","EIDE Controller (step C)" },
-{0x1039, 0x0601, "Silicon Integrated Systems","SiS83C601","PCI EIDE Controller" },
-{0x1039, 0x0620, "Silicon Integrated Systems","SiS620","Host-to-PCI Bridge" },
-{0x1039, 0x0630, "Silicon Integrated Systems","SiS6330","Host-to-PCI Bridge" },
-{0x1039, 0x0635, "Silicon Integrated Systems","SiS 635","Host-to-PCI Bridge" },
-{0x1039, 0x0640, "Silicon Integrated Systems","SiS 640","Host-to-PCI Bridge" },
-{0x1039, 0x0645, "Silicon Integrated Systems","SiS 645","Host-to-PCI Bridge" },
-{0x1039, 0x0646, "Silicon Integrated Systems","SiS645DX","Host-to-PCI Bridge" },
-{0x1039, 0x0648, "Silicon Integrated Systems","SiS648MX","Host-to-PCI Bridge" },
-{0x1039, 0x0649, "Silicon Integrated Systems","sis649","Host-to-PCI Bridge" },
-{0x1039, 0x0650, "Silicon Integrated Systems","SiS961","Host-to-PCI Bridge" },
-{0x1039, 0x0651, "Silicon Integrated Systems","SiS651","Host-to-PCI Bridge" },
-{0x1039, 0x0655, "Silicon Integrated Systems","SiS655","Host-to-PCI Bridge" },
-{0x1039, 0x0656, "Silicon Integrated Systems","???","CPU to PCI Bridge" },
-{0x1039, 0x0658, "Silicon Integrated Systems","SiS R658","CPU to PCI Bridge" },
-{0x1039, 0x0659, "Silicon Integrated Systems","SiS R659","CPU to PCI Bridge" },
-{0x1039, 0x0660, "Silicon Integrated Systems","vt8237a","Host-to-PCI Bridge" },
-{0x1039, 0x0661, "Silicon Integrated Systems","SiS 661FX","SiS 661FX/GX Chipset - Host-PCI Bridge" },
-{0x1039, 0x0662, "Silicon Integrated Systems","???","CPU to PCI Bridge" },
-{0x1039, 0x0663, "Silicon Integrated Systems","???","CPU to PCI Bridge" },
-{0x1039, 0x0730, "Silicon Integrated Systems","SiS 730","Host-to-PCI Bridge" },
-{0x1039, 0x0735, "Silicon Integrated Systems","SiS 735","Host-to-PCI Bridge" },
-{0x1039, 0x0740, "Silicon Integrated Systems","SiS 074","LPC Bridge" },
-{0x1039, 0x0741, "Silicon Integrated Systems","SIS741","CPU to PCI Bridge" },
-{0x1039, 0x0745, "Silicon Integrated Systems","SiS745","Host-to-PCI Bridge" },
-{0x1039, 0x0746, "Silicon Integrated Systems","SiS746","Host-to-PCI Bridge" },
-{0x1039, 0x0748, "Silicon Integrated Systems","SiS748","CPU to PCI Bridge" },
-{0x1039, 0x0755, "Silicon Integrated Systems","SiSM650?","Host-to-PCI Bridge" },
-{0x1039, 0x0756, "Silicon Integrated Systems","SiS755FX","CPU to PCI Bridge" },
-{0x1039, 0x0760, "Silicon Integrated Systems","SiS760","Athlon 64 CPU to PCI Bridge" },
-{0x1039, 0x0761, "Silicon Integrated Systems","88e8056","Athlon 64 CPU to PCI Bridge" },
-{0x1039, 0x0762, "Silicon Integrated Systems","???","Athlon 64 CPU to PCI Bridge" },
-{0x1039, 0x0900, "Silicon Integrated Systems","SiS 900","SiS 900 Fast Ethernet Adapter" },
-{0x1039, 0x0901, "Silicon Integrated Systems","Device ID = 0900 SiS900","SiS900 10/100 Ethernet Adapter" },
-{0x1039, 0x0962, "Silicon Integrated Systems","SiS962","LPC Bridge" },
-{0x1039, 0x0963, "Silicon Integrated Systems","SiS963","PCI to ISA Bridge" },
-{0x1039, 0x0964, "Silicon Integrated Systems","SiS964","SiS 964 MuTIOL Media I/O Bridge " },
-{0x1039, 0x0999, "Silicon Integrated Systems","sis950","pci\\ven_1039&subsys_200b163&rev_a0\\3&61aaa01\\0&17" },
-{0x1039, 0x1039, "Silicon Integrated Systems","SiS5597a","SiS5597 SVGAa" },
-{0x1039, 0x1040, "Silicon Integrated Systems","","" },
-{0x1039, 0x10ec, "Silicon Integrated Systems","961/2","bus controler" },
-{0x1039, 0x1182, "Silicon Integrated Systems","?","Raid Controller(?Mode Raid5)" },
-{0x1039, 0x1183, "Silicon Integrated Systems","SIS966/968 ","SATA IDE Controller" },
-{0x1039, 0x1184, "Silicon Integrated Systems","SIS966(AHCI)&#12289;SIS968(RAID)","Raid/AHCI Controller" },
-{0x1039, 0x1185, "Silicon Integrated Systems","SIS968","AHCI Controller" },
-{0x1039, 0x1234, "Silicon Integrated Systems","SiS5597a","SiS5597 SVGAa" },
-{0x1039, 0x191, "Silicon Integrated Systems","MTC ms9377c","PCI /ven_1039" },
-{0x1039, 0x3602, "Silicon Integrated Systems","SiS83C602","IDE Controller" },
-{0x1039, 0x4321, "Silicon Integrated Systems","Video Controller","Video Controller (VGA Compatible)" },
-{0x1039, 0x5107, "Silicon Integrated Systems","SiS5107","Hot Docking Controller" },
-{0x1039, 0x5300, "Silicon Integrated Systems","SiS540","AGP" },
-{0x1039, 0x5315, "Silicon Integrated Systems","SiS530/1/2","GUI Accelerator" },
-{0x1039, 0x5401, "Silicon Integrated Systems","SiS5401","486 PCI Chipset" },
-{0x1039, 0x5511, "Silicon Integrated Systems","SiS5511/5512","PCI/ISA System Memory Controller" },
-{0x1039, 0x5513, "Silicon Integrated Systems","All SIS SouthBridge","SiS 5513 IDE UDMA Controller / SiS 85C513 IDE Controller" },
-{0x1039, 0x5517, "Silicon Integrated Systems","SiS5517","CPU to PCI Bridge" },
-{0x1039, 0x5518, "Silicon Integrated Systems","SiS5518","UDMA IDE Controller" },
-{0x1039, 0x5571, "Silicon Integrated Systems","SiS5571","Memory/PCI bridge" },
-{0x1039, 0x5581, "Silicon Integrated Systems","SiS 5581","p5 chipset" },
-{0x1039, 0x5582, "Silicon Integrated Systems","SiS5582","PCI to ISA Bridge" },
-{0x1039, 0x5591, "Silicon Integrated Systems","MTC ms9377c (SIS 741                      ","PCI\\VEN_1039" },
-{0x1039, 0x5596, "Silicon Integrated Systems","SiS661FX"," VGA Controller" },
-{0x1039, 0x5597, "Silicon Integrated Systems","SiS5597","Host to PCI bridge" },
-{0x1039, 0x5600, "Silicon Integrated Systems","SiS600","Host-to-PCI Bridge" },
-{0x1039, 0x5630, "Silicon Integrated Systems","SiS630","Host-to-PCI Bridge" },
-{0x1039, 0x5811, "Silicon Integrated Systems","","" },
-{0x1039, 0x6204, "Silicon Integrated Systems","SiS6204","video decoder/mpeg interface" },
-{0x1039, 0x6205, "Silicon Integrated Systems","SiS6215","PCI VGA Controller" },
-{0x1039, 0x6225, "Silicon Integrated Systems","SiS 950 m2284dxs","PCI Graphics & Video Accelerator" },
-{0x1039, 0x6236, "Silicon Integrated Systems","SG3730il","Graphics" },
-{0x1039, 0x6300, "Silicon Integrated Systems","SiS630/730","GUI Accelerator+3D" },
-{0x1039, 0x6306, "Silicon Integrated Systems","SiS530/620","Integrated 3D  SVGA Controller" },
-{0x1039, 0x6325, "Silicon Integrated Systems","pc&#305;\\VEN_1039&DEV_6325","sis-651dx" },
-{0x1039, 0x6326, "Silicon Integrated Systems","0x1039","sis 6326 AGP" },
-{0x1039, 0x6330, "Silicon Integrated Systems","SiS661FX/M661FX/760/741/M760/M741","GUI 2D/3D Accelerator" },
-{0x1039, 0x6331, "Silicon Integrated Systems"," 04","USB Host Controller" },
-{0x1039, 0x6351, "Silicon Integrated Systems","SIS M672 FX","SiS IGP Graphics family SIS66x/SIS76x & SIS67x" },
-{0x1039, 0x6355, "Silicon Integrated Systems","962","962lua" },
-{0x1039, 0x6787, "Silicon Integrated Systems","SiS5597a","Smart Link 56K Voice Modem (download from driverguide.com)" },
-{0x1039, 0x6972, "Silicon Integrated Systems","","" },
-{0x1039, 0x7001, "Silicon Integrated Systems","SiS 7001","SiS 7001 PCI to USB Open Host Controller " },
-{0x1039, 0x7002, "Silicon Integrated Systems","SiS 7001 PCI to USB Open Host Controller","USB 2.0 Enhanced Host Controller" },
-{0x1039, 0x7005, "Silicon Integrated Systems","SiS551/2","Memory Stick Controller" },
-{0x1039, 0x7007, "Silicon Integrated Systems","1039","OHCI Compliant FireWire Controller" },
-{0x1039, 0x7012, "Silicon Integrated Systems","SiS 7012","SiS 7012 Audio Device / Realtek AC'97 Audio" },
-{0x1039, 0x7013, "Silicon Integrated Systems","SiS7013","Smart Link 56K Voice Modem" },
-{0x1039, 0x7015, "Silicon Integrated Systems","SiS550 dd","Software Audio dd" },
-{0x1039, 0x7016, "Silicon Integrated Systems","SiS191","10/100 Ethernet Adapter" },
-{0x1039, 0x7018, "Silicon Integrated Systems","SiS7018","Onboard audio" },
-{0x1039, 0x7019, "Silicon Integrated Systems","SiS550/1/2","Hardware Audio" },
-{0x1039, 0x7300, "Silicon Integrated Systems","SiS7013","GUI Accelerator+3D" },
-{0x1039, 0x7502, "Silicon Integrated Systems","649","Realtek HDA Audio Driver." },
-{0x1039, 0x8139, "Silicon Integrated Systems","2012","2012" },
-{0x1039, 0x9632, "Silicon Integrated Systems","pc&#305;\\ven_1039&dev_6325","sis 650 integrated gfx controller (IGP)" },
-{0x1039, 0x964, "Silicon Integrated Systems","sis964","LPC BRIDGE" },
-{0x1039, 0x9876, "Silicon Integrated Systems","sis6215","pci vga card for win95 & nt4 only" },
-{0x1039, 0x9989, "Silicon Integrated Systems","SiS5597a","Smart Link 56K Voice Modem (download from driverguide.com)" },
-{0x1039, 0x7012, "Silicon Integrated Systems","HDAUDIO\\FUNC_01&VEN_&DEV_504514F1&SUBSYS_1631C106&","PCI Audio Accelerator" },
-{0x1039, 0x5811, "Silicon Integrated Systems","","" },
-{0x103B, 0x103b, "Tatung Corp. Of America","82801DB","LAN Controller with 82562EM/EX PHY" },
-{0x103C, 0x0024, "Hewlett-Packard","?","Standard Vista USB Keyboard" },
-{0x103C, 0x0A01, "Hewlett-Packard","HP2400","HP Scanjet 2400" },
-{0x103C, 0x1005, "Hewlett-Packard","A4977A","Visialize EG" },
-{0x103C, 0x1008, "Hewlett-Packard","Donner GFX","001" },
-{0x103C, 0x100A, "Hewlett-Packard","hpVisualizeFX","Hewlett-Packard VisualizeFX Series Video" },
-{0x103C, 0x1028, "Hewlett-Packard","ACPI/HPQ0004/3&b1bfb68&0","HP ProtectSmart Hard Drive Protection - HP 3D DriveGuard" },
-{0x103C, 0x1029, "Hewlett-Packard","HPFC-5200B","Tachyon XL2 Fibre Channel Adapter" },
-{0x103C, 0x102A, "Hewlett-Packard","Tach TS","Tachyon TS Fibre Channel Host Adapter" },
-{0x103C, 0x1030, "Hewlett-Packard","J2585B","DeskDirect 10/100VG LAN Adapter" },
-{0x103C, 0x1031, "Hewlett-Packard","J2585B222","DeskDirect 10/100" },
-{0x103C, 0x1040, "Hewlett-Packard","J2973A","DeskDirect 10BaseT NIC" },
-{0x103C, 0x1041, "Hewlett-Packard","J2585B","DeskDirect 10/100VG NIC" },
-{0x103C, 0x1042, "Hewlett-Packard","J2970A","DeskDirect 10BaseT/2 NIC" },
-{0x103C, 0x1048, "Hewlett-Packard","SAS","" },
-{0x103C, 0x1049, "Hewlett-Packard","DIVA1","" },
-{0x103C, 0x104A, "Hewlett-Packard","DIVA2","intel" },
-{0x103C, 0x104B, "Hewlett-Packard","SP2","" },
-{0x103C, 0x104D, "Hewlett-Packard","J3242A","EL-10 Ethernet Adapter" },
-{0x103C, 0x1064, "Hewlett-Packard","79C970","PCnet Ethernet Controller" },
-{0x103C, 0x10C1, "Hewlett-Packard","PCI\\VEN_10DE&DEV_0543&SUBSYS_30CF103C&REV_A2","NetServer Smart IRQ Router" },
-{0x103C, 0x10ED, "Hewlett-Packard","TopTools","HP Communications Port" },
-{0x103C, 0x1200, "Hewlett-Packard","82557B","10/100 NIC" },
-{0x103C, 0x1219, "Hewlett-Packard","","NetServer PCI Hot-Plug Controller" },
-{0x103C, 0x121A, "Hewlett-Packard","","NetServer SMIC Controller" },
-{0x103C, 0x121B, "Hewlett-Packard","","NetServer Legacy COM Port Decoder" },
-{0x103C, 0x121C, "Hewlett-Packard","","NetServer PCI COM Port Decoder" },
-{0x103C, 0x1229, "Hewlett-Packard","zx1","System Bus Adapter" },
-{0x103C, 0x122A, "Hewlett-Packard","zx1","I/O Controller" },
-{0x103C, 0x122B, "Hewlett-Packard","zx1","Local Bus Adapter" },
-{0x103C, 0x12FA, "Hewlett-Packard","Broadcom BCM4306","Broadcom Wireless miniPCI in a HP laptop" },
-{0x103C, 0x1302, "Hewlett-Packard","1302103C","HP Management Shared Memory Device" },
-{0x103C, 0x137a, "Hewlett-Packard","AR5007","Atheros AR5007" },
-{0x103C, 0x1411, "Hewlett-Packard","HPOJ750","HP PSC 750" },
-{0x103C, 0x171d, "Hewlett-Packard","HP Integrated Module with Bluetooth Wireless","HP Integrated Module with Bluetooth Wireless" },
-{0x103C, 0x1F1D, "Hewlett-Packard","USB\\VID_03F0&PID_241D&REV_0002","3G Broadband device" },
-{0x103C, 0x201D, "Hewlett-Packard","?","3G Broadband device" },
-{0x103C, 0x231D, "Hewlett-Packard","USB\\VID_03F0&PID_0a01\\6&23104BA&0&7","HP Integrated Module with Bluetooth Wireless Technology" },
-{0x103C, 0x241D, "Hewlett-Packard","USB\\VID_0000_PID_0000_0000\\5&25243b3b&0&1","HP compaq nx6125" },
-{0x103C, 0x2910, "Hewlett-Packard","E2910A","PCI Bus Exerciser" },
-{0x103C, 0x292, "Hewlett-Packard","E2924A","PCI Host Interface Adapter" },
-{0x103C, 0x2920, "Hewlett-Packard","","Fast Host Interface" },
-{0x103C, 0x2924, "Hewlett-Packard","QDS-BRCM1051","PCI Host Interface Adapter" },
-{0x103C, 0x2925, "Hewlett-Packard","E2925A","32 bit PCI Bus Exerciser and Analyzer" },
-{0x103C, 0x2926, "Hewlett-Packard","E2926A","64 bit PCI Bus Exerciser and Analyzer" },
-{0x103C, 0x2927, "Hewlett-Packard","E2927a","64 Bit, 66/50MHz PCI Analyzer & Exerciser" },
-{0x103C, 0x294, "Hewlett-Packard","qds brcm1051","pci hostinterface" },
-{0x103C, 0x2940, "Hewlett-Packard","E2940A","64 bit, 66/50MHz CompactPCI Analyzer&Exerciser" },
-{0x103C, 0x311d, "Hewlett-Packard","rev 001","ATHEROS AR3011 bluetooth 3.0+HS adapter" },
-{0x103C, 0x3206, "Hewlett-Packard","unknown","Adaptec Embedded Serial ATA HostRAID" },
-{0x103C, 0x3207, "Hewlett-Packard","not sure","not sure" },
-{0x103C, 0x3220, "Hewlett-Packard","P600","P600 SmartArray Raid Controller" },
-{0x103C, 0x3230, "Hewlett-Packard","Smart Array P400 Controller","Smart Array P400 Controller" },
-{0x103C, 0x323A, "Hewlett-Packard","Smart Array P410i Controller","Smart Array P410i Controller" },
-{0x103C, 0x3302, "Hewlett-Packard","3305103C","Integrated Lights Out 2.0 Interfaz IPMI" },
-{0x103C, 0x3A1D, "Hewlett-Packard","hs2340","HP hs2340 HSPA+ MobileBroadband" },
-{0x103C, 0x5461, "Hewlett-Packard","unknown","HP integrated Module with Bluetooth 2.0 Wireless support" },
-{0x103C, 0x6007, "Hewlett-Packard","ACPI\\VEN_HPQ&DEV_6007","HP Mobile Data Protection Sensor" },
-{0x103C, 0x9876, "Hewlett-Packard","rev 001","ATHEROS AR3011 bluetooth 3.0+HS adapter" },
-{0x1043, 0x0675, "Asustek Computer Inc.","p5g41c-mlx","Crestline" },
-{0x1043, 0x1969, "Asustek Computer Inc.","P5LD2 - EAYZ","Attansic L1 Gigabit Ethernet 10/100/1000Base-T Adapter" },
-{0x1043, 0x5653, "Asustek Computer Inc.","M5A78L-M LX V2","ATI Radeon 3000 Graphics (Microsoft Corporation - WDDM v1.1)" },
-{0x1043, 0x8103, "Asustek Computer Inc.","NV31","NV31 [GeForce FX 5600 Ultra]" },
-{0x1043, 0x82c6, "Asustek Computer Inc.","RTL8168","Gigabit Ethernet(NDIS 6.0)" },
-{0x1044, 0x1012, "Distributed Processing Tech","Domino","RAID Engine" },
-{0x1044, 0x800A, "Distributed Processing Tech","13D09B4F","802.11 bg WLAN" },
-{0x1044, 0xA400, "Distributed Processing Tech","2124A/9X","SmartCache III/RAID SCSI Controller" },
-{0x1044, 0xA500, "Distributed Processing Tech","unknown","PCI Bridge" },
-{0x1044, 0xA501, "Distributed Processing Tech","c03c","I2O SmartRAID V Controller" },
-{0x1044, 0xA511, "Distributed Processing Tech","Raptor","SmartRAID Controller" },
-{0x1045, 0x0005, "OPTi Inc.","","" },
-{0x1045, 0xA0F8, "OPTi Inc.","82C750","PCI USB Controller" },
-{0x1045, 0xC101, "OPTi Inc.","82C264","GUI Accelerator" },
-{0x1045, 0xC178, "OPTi Inc.","82C178","pci usb card 2- port" },
-{0x1045, 0xC556, "OPTi Inc.","82C556","Viper" },
-{0x1045, 0xC557, "OPTi Inc.","82C557","CPU Bridge (Viper)" },
-{0x1045, 0xC558, "OPTi Inc.","82C558","ISA Bridge w/PnP" },
-{0x1045, 0xC567, "OPTi Inc.","82C750","Vendetta chipset: host bridge" },
-{0x1045, 0xC568, "OPTi Inc.","82C750","Vendetta chipset: ISA bridge" },
-{0x1045, 0xC569, "OPTi Inc.","82C579","Pentium to PCI Bridge" },
-{0x1045, 0xC621, "OPTi Inc.","82C621","PCI IDE Controller (PIC)" },
-{0x1045, 0xC700, "OPTi Inc.","82C700","82C700 FireStar PCI to ISA Bridge" },
-{0x1045, 0xC701, "OPTi Inc.","82C701","FireStar mobile chipset: host bridge" },
-{0x1045, 0xC814, "OPTi Inc.","82C814","FireBridge II Docking Station Controller" },
-{0x1045, 0xC822, "OPTi Inc.","82C822","CPU to PCI & PCI to ISA PnP bridge" },
-{0x1045, 0xC824, "OPTi Inc.","82C824","FireFox 32-Bit PC Card Controller" },
-{0x1045, 0xC825, "OPTi Inc.","82C825 function 0","PCI-to-ISA Bridge" },
-{0x1045, 0xC832, "OPTi Inc.","82C832","CPU-to-PCI and PCI-to-ISA Bridge" },
-{0x1045, 0xC861, "OPTi Inc.","82C861","OPTi 82C861 PCI to USB Open Host Controller" },
-{0x1045, 0xC881, "OPTi Inc.","82C881","FireLink 1394 OHCI Link Controller" },
-{0x1045, 0xC895, "OPTi Inc.","82C895","" },
-{0x1045, 0xC931, "OPTi Inc.","82C931","ISA Sound & Game Port controller." },
-{0x1045, 0xC935, "OPTi Inc.","82C935","MachOne integrated PCI audio processor" },
-{0x1045, 0xD568, "OPTi Inc.","82C825","PCI bus master IDE controller" },
-{0x1045, 0xD768, "OPTi Inc.","82C750","Ultra DMA IDE controller" },
-{0x1046, 0x5600, "IPC Corporation LTD","03001426","00/4&1a671" },
-{0x1048, 0x0253, "ELSA GmbH","0x0c92","ELSA GLADIAC 528" },
-{0x1048, 0x0C60, "ELSA GmbH","Elsa Gladiac MX","NVidia Geforce 2 MX" },
-{0x1048, 0x0C71, "ELSA GmbH","Elsa Gladiac 721","NVidia GeForce3 Ti 200" },
-{0x1048, 0x1000, "ELSA GmbH","Quick Step 1000","ISDN Controller" },
-{0x1048, 0x3000, "ELSA GmbH","QuickStep 3000","" },
-{0x1048, 0x8901, "ELSA GmbH","","ELSA GLoria XL" },
-{0x104A, 0x0008, "STMicroelectronics","STG 2000X","diamond" },
-{0x104A, 0x0009, "STMicroelectronics","STG 1764X","" },
-{0x104A, 0x0010, "STMicroelectronics","STG4000","PowerVR KYRO series 3 graphics processor" },
-{0x104A, 0x0123, "STMicroelectronics","V65204","SPEAr1300" },
-{0x104A, 0x0209, "STMicroelectronics","STPC Consmr/Indstrl","North/South Bridges" },
-{0x104A, 0x020A, "STMicroelectronics","STPC Atlas/Elite","North Bridge" },
-{0x104A, 0x0210, "STMicroelectronics","STPC Atlas","ISA Bridge" },
-{0x104A, 0x021A, "STMicroelectronics","STPC Consmr-S/Elite","ISA Bridge" },
-{0x104A, 0x021B, "STMicroelectronics","STPC Consumer-II","ISA Bridge" },
-{0x104A, 0x0228, "STMicroelectronics","STPC Atlas","IDE Controller" },
-{0x104A, 0x0230, "STMicroelectronics","STPC Atlas","USB Controller" },
-{0x104A, 0x0500, "STMicroelectronics","ST70137","ADSL" },
-{0x104A, 0x0981, "STMicroelectronics","jmc260","10/100 Ethernet Adapter" },
-{0x104A, 0x1746, "STMicroelectronics","mp280","mp280" },
-{0x104A, 0x2774, "STMicroelectronics","STE10/100A","PCI 10/100 Ethernet Controller" },
-{0x104A, 0x3520, "STMicroelectronics","","MPEG-II Video Decoder" },
-{0x104A, 0x7108, "STMicroelectronics","STi7108","Advanced HD AVC decoder with 3D graphics acceleration" },
-{0x104A, 0xCC00, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC01, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC02, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC03, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC04, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC05, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC06, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC07, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC08, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC09, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC0A, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC0B, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC0C, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC0D, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC0E, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC0F, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC10, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC11, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC12, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC13, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC14, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC15, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC16, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCC17, "STMicroelectronics","STA2X11","ConneXt I/O Hub multifunction device" },
-{0x104A, 0xCD00, "STMicroelectronics","V65204","SPEAr1300" },
-{0x104A, 0xCD80, "STMicroelectronics","SPEAr1300","Root Complex of SPEAr1300" },
-{0x104B, 0x1040, "Mylex / Buslogic","BA81C15","BT958 SCSI Host Adaptor" },
-{0x104B, 0x8130, "Mylex / Buslogic","-","Flashpoint LT" },
-{0x104C, 0x803B, "Texas Instruments","0366107B","Texas Instruments Card Reader" },
-{0x104C, 0x014e, "Texas Instruments","4610,4515,4610fm","device" },
-{0x104C, 0x0500, "Texas Instruments","TNETE100A/110A/211","ThunderLAN 100 Mbit LAN Controller" },
-{0x104C, 0x0508, "Texas Instruments","TI380PCI","PCI interface for TI380 compressors" },
-{0x104C, 0x1000, "Texas Instruments","TI PCI Eagle i/f AS","" },
-{0x104C, 0x104C, "Texas Instruments","PCI\\VEN_104C&DEV_803B&SUBSYS_FF021179&REV_00","PCI Simple Communications Controller" },
-{0x104C, 0x3B04, "Texas Instruments","028000","otros dispositivos" },
-{0x104C, 0x3D04, "Texas Instruments","TVP4010","Permedia" },
-{0x104C, 0x3D07, "Texas Instruments","TVP4020","AGP Permedia 2" },
-{0x104C, 0x8000, "Texas Instruments","TSB12LV21","LYNX IEEE1394 FireWire Host Controller" },
-{0x104C, 0x8009, "Texas Instruments","TSB12LV22","OHCI-Lynx PCI IEEE 1394 Host Controller" },
-{0x104C, 0x8010, "Texas Instruments","TSB12LV26","OHCI-Lynx IEEE 1394 Host Controller" },
-{0x104C, 0x8011, "Texas Instruments","PCI4450","OHCI-Lynx IEEE 1394 Controller" },
-{0x104C, 0x8017, "Texas Instruments","PCI4410","OHCI-Lynx IEEE 1394 Controller" },
-{0x104C, 0x8019, "Texas Instruments","TSB12LV23","OHCI-Lynx PCI IEEE 1394 Host Controller" },
-{0x104C, 0x8020, "Texas Instruments","TSB12LV26","OHCI Compliant FireWire Controller" },
-{0x104C, 0x8021, "Texas Instruments","TSB43AB23","1394a-2000 OHCI PHY/Link Layer CONTROLLER" },
-{0x104C, 0x8023, "Texas Instruments","TSB43AB21/A","IEEE1394a-2000 OHCI PHY/Link-Layer Ctrlr" },
-{0x104C, 0x8024, "Texas Instruments","TSB43AB23","1394a-2000 OHCI PHY/Link Layer Ctrl" },
-{0x104C, 0x8025, "Texas Instruments","TSB82AA2","1394b OHCI-Lynx IEEE 1394 Host Controller" },
-{0x104C, 0x8026, "Texas Instruments","TSB43AB21A","1394a-2000 OHCI PHY/Link Layer Ctrlr" },
-{0x104C, 0x8027, "Texas Instruments","PCI4451","OHCI-Lynx IEEE 1394 Controller" },
-{0x104C, 0x8029, "Texas Instruments","040803-2158","OHCI Compliant IEEE-1394 FireWire Controller " },
-{0x104C, 0x802e, "Texas Instruments","PCI7420","OHCI Compliant IEEE 1394 Host Controller" },
-{0x104C, 0x8031, "Texas Instruments","8031","Generic CardBus Controller" },
-{0x104C, 0x8033, "Texas Instruments","PCI0021","Integrated FlashMedia / Card Reader" },
-{0x104C, 0x8034, "Texas Instruments","10981734","SDA Standard Compliant SD Host Controller" },
-{0x104C, 0x8035, "Texas Instruments","N/A","PCI GemCore based SmartCard controller" },
-{0x104C, 0x8036, "Texas Instruments","PCI6515","Texas Instruments PCIxxx12 Cardbus Controller" },
-{0x104C, 0x8038, "Texas Instruments","PCI\\VEN_104C&DEV_8038&SUBSYS_01861028&REV_00\\4&2FA","Texas Instruments PCI GemCore based SmartCard Controller" },
-{0x104C, 0x8039, "Texas Instruments","104C","104C" },
-{0x104C, 0x803a, "Texas Instruments","PCIxx12","OHCI Compliant IEEE 1394 Host controller" },
-{0x104C, 0x803B, "Texas Instruments","PCIxx12 Integrated FlashMed","Texas Instruments Card Reader" },
-{0x104C, 0x803c, "Texas Instruments","PCI0024","SDA Standard Compliant SD Host Controller" },
-{0x104C, 0x803D, "Texas Instruments","0780","Texas Instruments PCI GemCore based SmartCard controller" },
-{0x104C, 0x8119, "Texas Instruments","na","iRDA Compatible Controller" },
-{0x104C, 0x8201, "Texas Instruments","006B103C","TI UltraMedia Firmware Loader Device" },
-{0x104C, 0x8204, "Texas Instruments","4610, 4515, 4610FM, 7510","PCI 7510/4510 Cardbus Controller" },
-{0x104C, 0x8231, "Texas Instruments","XIO2000A","PCI-Express to PCI/PCI-X bridge" },
-{0x104C, 0x8232, "Texas Instruments","1","Controladora de vídeo multimedia" },
-{0x104C, 0x8241, "Texas Instruments","Texas Instruments USB 3.0 XHCI Host Controller","Texas Instruments USB 3.0 XHCI Host Controller" },
-{0x104C, 0x8400, "Texas Instruments","ACX100AGHK","D-Link AirPlus DWL-520+, Uses a TI 802.11b 22 MBPS Chip" },
-{0x104C, 0x8671, "Texas Instruments","bogus","bogus" },
-{0x104C, 0x9065, "Texas Instruments","TMX320C6412","Fixed Point Digital Signal Processor" },
-{0x104C, 0x9066, "Texas Instruments","USR5410","U.S. Robotics 802.11g Wireless Turbo PC Card " },
-{0x104C, 0xA001, "Texas Instruments","TDC1570","64-bit PCI ATM SAR" },
-{0x104C, 0xA100, "Texas Instruments","TDC1561","32-bit PCI ATM SAR" },
-{0x104C, 0xA102, "Texas Instruments","TNETA1575","HyperSAR Plus w/PCI host & UTOPIA i/f" },
-{0x104C, 0xA106, "Texas Instruments","TMS320C6205","Fixed Point Digital Signal Processor" },
-{0x104C, 0xA186, "Texas Instruments","TMS320C6416T","TI C6416T DSP" },
-{0x104C, 0xa828, "Texas Instruments","PCI2050BPDV","PCI-to-PCI Bridge" },
-{0x104C, 0xAC10, "Texas Instruments","PCI1050","PC Card Controller" },
-{0x104C, 0xAC11, "Texas Instruments","PCI1030/1053","PC Card Controller" },
-{0x104C, 0xAC12, "Texas Instruments","PCI1131","PC card CardBus Controller" },
-{0x104C, 0xAC13, "Texas Instruments","PCI9066","Texas InstrumentsÃ¢â€Å¾Â¢ PCIxx12 Integrated FlashMedia Controller" },
-{0x104C, 0xAC15, "Texas Instruments","PCI-1131","CardBus Controller" },
-{0x104C, 0xAC16, "Texas Instruments","PCI1250","PC Card CardBus Controller" },
-{0x104C, 0xAC17, "Texas Instruments","PCI1220","CardBus Controller" },
-{0x104C, 0xAC18, "Texas Instruments","PCI1260","PC card CardBus Controller" },
-{0x104C, 0xAC19, "Texas Instruments","PCI1221","PC card CardBus Controller" },
-{0x104C, 0xAC1A, "Texas Instruments","PCI1210","PC card CardBus Controller" },
-{0x104C, 0xAC1B, "Texas Instruments","PCI1450","PC card CardBus Controller" },
-{0x104C, 0xAC1C, "Texas Instruments","PCI1225","PC Card CardBus Controller" },
-{0x104C, 0xac1e, "Texas Instruments","PCI1211","PCI To PCMCIA  bridge" },
-{0x104C, 0xAC1F, "Texas Instruments","PCI1251B","PC card CardBus Controller" },
-{0x104C, 0xAC20, "Texas Instruments","PCI2030","PCI to PCI Bridge" },
-{0x104C, 0xAC21, "Texas Instruments","PCI2031","PCI to PCI Bridge" },
-{0x104C, 0xAC22, "Texas Instruments","PCI2032","PCI Docking Bridge" },
-{0x104C, 0xAC23, "Texas Instruments","PCI2250","PCI-to-PCI Bridge" },
-{0x104C, 0xAC28, "Texas Instruments","PCI2050/2050I","PCI-to-PCI Bridge" },
-{0x104C, 0xAC30, "Texas Instruments","PCI1260","PC card CardBus Controller" },
-{0x104C, 0xAC40, "Texas Instruments","PCI4450","PC card CardBus Controller" },
-{0x104C, 0xAC41, "Texas Instruments","PCI4410","PC card CardBus Controller" },
-{0x104C, 0xAC42, "Texas Instruments","PCI4451","PC card CardBus Controller" },
-{0x104C, 0xAC43, "Texas Instruments","PCI4550","PC card CardBus Controller" },
-{0x104C, 0xAC44, "Texas Instruments","PCI4510SDFSDFSD","PC Card Controller SDFSDAFSADFSDAFSDAF" },
-{0x104C, 0xAC46, "Texas Instruments","PCI4520","PCCard CardBus Controller" },
-{0x104C, 0xac47, "Texas Instruments","7510/4510","Cardbus" },
-{0x104C, 0xAC50, "Texas Instruments","PCI1410","PC card cardBus Controller" },
-{0x104C, 0xAC51, "Texas Instruments","PCI-1420","Texas Instruments 1420" },
-{0x104C, 0xAC52, "Texas Instruments","PCI1451","PC card CardBus Controller" },
-{0x104C, 0xAC53, "Texas Instruments","PCI1421","PC card CardBus Controller - 5-in-1 Media Card Reader" },
-{0x104C, 0xAC54, "Texas Instruments","PCI-1510","PCCard CardBus Controller w/UltraMedia" },
-{0x104C, 0xAC55, "Texas Instruments","PCI1520","PCCard CardBus Controller" },
-{0x104C, 0xAC56, "Texas Instruments","PCI1510","PCCard CardBus Controller" },
-{0x104C, 0xAC57, "Texas Instruments","PCI1530","PCCard CardBus Controller" },
-{0x104C, 0xAC58, "Texas Instruments","PCI1515","PCCard CardBus Controller" },
-{0x104C, 0xAC59, "Texas Instruments","PCI1620","PCCard CardBus Controller w/UltraMedia" },
-{0x104C, 0xAC5A, "Texas Instruments","PCI1610","PCCard CardBus Controller w/UltraMedia" },
-{0x104C, 0xac60, "Texas Instruments"," 09050844","PCI2040 PCI to DSP Bridge" },
-{0x104C, 0xac8e, "Texas Instruments","PCI7420","Generic CardBus Controller " },
-{0x104C, 0xAC8F, "Texas Instruments","7420/7620","FlashMedia" },
-{0x104C, 0xB000, "Texas Instruments","TMS320C645x","Device ID: 0xB001 " },
-{0x104C, 0xB001, "Texas Instruments","TMS320DM642","DSP with a C64x+ core and M/S PCI interface" },
-{0x104C, 0xFE00, "Texas Instruments","tsb12lv26","FireWire Host Controller" },
-{0x104C, 0xFE03, "Texas Instruments","12C01A","FireWire Host Controller" },
-{0x104D, 0x011B, "Sony Corporation","RT2571WF","USB Ralink Wireless LAN" },
-{0x104D, 0x5001, "Sony Corporation","SNY5001","Sony Firmware Extension Parser listed as ACPI&#92;SNY5001 in device manager." },
-{0x104D, 0x6001, "Sony Corporation","SNY6001","Sony Programmable I/O Control Device" },
-{0x104D, 0x8009, "Sony Corporation","CXD1947","PCI bus 9" },
-{0x104D, 0x8039, "Sony Corporation","CXD3222","OHCI i.LINK (IEEE 1394) PCI Host Ctrlr" },
-{0x104D, 0x8056, "Sony Corporation","0x127a","Rockwell HCF 56K Modem" },
-{0x104D, 0x8087, "Sony Corporation","PCI\\VEN_104D&DEV_8086","SONY MPEG ENCODER" },
-{0x104D, 0x808A, "Sony Corporation","Qc pass","Memory Stick Controller" },
-{0x104E, 0x0017, "Oak Technology","OTI-64017","" },
-{0x104E, 0x0107, "Oak Technology","OTI107","Spitfire VGA Accelerator" },
-{0x104E, 0x0109, "Oak Technology","","Video Adapter" },
-{0x104E, 0x0217, "Oak Technology","OTI-64217","" },
-{0x104E, 0x0317, "Oak Technology","OTI-64317","" },
-{0x104E, 0x0611, "Oak Technology","OTI-610","T9732" },
-{0x104E, 0x317, "Oak Technology","OTI107","Spitfire VGA Accelerator" },
-{0x104F, 0x104F, "Co-Time Computer Ltd.","iatca8262","Multi I/O" },
-{0x1050, 0x6692, "Winbond Electronics Corp.","W6692/92A/92CFyr6","PCI BusISDN S/T-Controllerry" },
-{0x1050, 0x0000, "Winbond Electronics Corp.","004005-34c8c8","Ethernet Controller (NE2000 compatible)" },
-{0x1050, 0x0001, "Winbond Electronics Corp.","W83769F","PCI/IDE controller" },
-{0x1050, 0x0033, "Winbond Electronics Corp.","W89C33","Winbond W89C33 mPCI 802.11 Wireless LAN Adapter" },
-{0x1050, 0x0105, "Winbond Electronics Corp.","W82C105","Ethernet Adapter" },
-{0x1050, 0x0628, "Winbond Electronics Corp.","W83628F/629D","PCI to ISA Bridge Set" },
-{0x1050, 0x0840, "Winbond Electronics Corp.","W89C840F","100/10Mbps Ethernet Controller" },
-{0x1050, 0x0940, "Winbond Electronics Corp.","w89c940f","winbond pci ethernet" },
-{0x1050, 0x1050, "Winbond Electronics Corp.","W99200aF","Video capture card mpeg-1" },
-{0x1050, 0x5A5A, "Winbond Electronics Corp.","W89C940F","ELANC-PCI Twisted-pair Ether-LAN Ctrlr" },
-{0x1050, 0x6692, "Winbond Electronics Corp.","W6692CF","PCI BusISDN S/T-Controller" },
-{0x1050, 0x8481, "Winbond Electronics Corp.","Unknown","SD Host Controller" },
-{0x1050, 0x9921, "Winbond Electronics Corp.","W99200AF","MPEG1 capture card" },
-{0x1050, 0x9922, "Winbond Electronics Corp.","W9922PF","MPEG-1/2 Decoder" },
-{0x1050, 0x9960, "Winbond Electronics Corp.","W9960CF","Video Codec" },
-{0x1050, 0x9961, "Winbond Electronics Corp.","W9961CF","H.263/H.261 Video Codec" },
-{0x1050, 0x9970, "Winbond Electronics Corp.","W9970CF","VGA controller" },
-{0x1050, 0x9971, "Winbond Electronics Corp.","W9971CF","W9971CF" },
-{0x1051, 0x0100, "Anigma Corp.","Motorola MC145575","" },
-{0x1054, 0x0001, "Hitachi Ltd","","PCI Bridge" },
-{0x1054, 0x0002, "Hitachi Ltd","pci bus","PCI bus Cntrlr" },
-{0x1054, 0x0003, "Hitachi Ltd","06A2","hts547575a9e384" },
-{0x1054, 0x3505, "Hitachi Ltd","SH7751","SuperH (SH) 32-Bit RISC MCU/MPU Series" },
-{0x1055, 0x0810, "Standard Microsystems Corp.","","EFAR 486 host Bridge" },
-{0x1055, 0x0922, "Standard Microsystems Corp.","","Pentium/p54c host Bridge" },
-{0x1055, 0x0926, "Standard Microsystems Corp.","I don´t know pentium 133 intel   everex setpnot mx","ISA Bridge" },
-{0x1055, 0x9130, "Standard Microsystems Corp.","SLC90E66","Ultra ATA/66 IDE Controller" },
-{0x1055, 0x9460, "Standard Microsystems Corp.","SLC90E66","Victory66 PCI to ISA Bridge" },
-{0x1055, 0x9461, "Standard Microsystems Corp.","SLC90E66","Victory66 UDMA EIDE Controller" },
-{0x1055, 0x9462, "Standard Microsystems Corp.","SLC90E66","Victory66 USB Host Controller" },
-{0x1055, 0x9463, "Standard Microsystems Corp.","SLC90E66","Victory66 Power Management Controller" },
-{0x1055, 0xe420, "Standard Microsystems Corp.","LAN9420/LAN9420i","PCI 10/100 Ethernet controller" },
-{0x1056, 0x2001, "ICL","Divio NW700LQ. 0243CDTAA. V90479. 1","Philips P89C51RD271BA. 1D041700A0. AeD0217G" },
-{0x1057, 0x5600, "Motorola","52-6116-2A","Motorola FM 56 PCI Speakerphone Modem" },
-{0x1057, 0x0001, "Motorola","MPC105","PCI Bridge / Memory Controller (PCIB/MC)" },
-{0x1057, 0x0002, "Motorola","MPC106","PCI Bridge/Memory Controller (PCIB/MC)" },
-{0x1057, 0x0003, "Motorola","MPC8240","Integrated Processor" },
-{0x1057, 0x0004, "Motorola","MPC107","PCI Bridge/Memory Controller for PPC" },
-{0x1057, 0x0006, "Motorola","MPC8245","Integrated Processor" },
-{0x1057, 0x0100, "Motorola","MC145575","HCF-PCI" },
-{0x1057, 0x0431, "Motorola","KTI829c","100VG Ethernet Controller" },
-{0x1057, 0x1801, "Motorola","DSP56301","24-bit Digital Signal Processor" },
-{0x1057, 0x1802, "Motorola","DSP56305","24-Bit Digital Signal Processor" },
-{0x1057, 0x18C0, "Motorola","MPC8265A/66","PowerQUICC II PCI Bridge" },
-{0x1057, 0x3052, "Motorola","0644dfea15","MotorolaSM56Modem_PCI device" },
-{0x1057, 0x3055, "Motorola","SM56","Motorola SM56 Data Fax Modem " },
-{0x1057, 0x3057, "Motorola","HDAUDIO\\FUNC_02om&VEN_1057&DEV_3057&SUBSYS_0001000","Modem Device on High Definition Audio Bus" },
-{0x1057, 0x3410, "Motorola","DSP56361","Digital Signal Processor" },
-{0x1057, 0x3421, "Motorola","56IVMR/Phoenix 56ISM","Modem" },
-{0x1057, 0x4801, "Motorola","Raven","PowerPC Chipset" },
-{0x1057, 0x4802, "Motorola","Falcon","memory control chipset" },
-{0x1057, 0x4803, "Motorola","Hawk","" },
-{0x1057, 0x4806, "Motorola","CPX8216","" },
-{0x1057, 0x4809, "Motorola","CPX8216T","HotSwap Controller" },
-{0x1057, 0x5600, "Motorola","WDM MOT8888","SM 56 PCI Speakerphone/Data,Fax  Modem" },
-{0x1057, 0x5602, "Motorola","SM56","PCI Modem" },
-{0x1057, 0x5608, "Motorola","52-6116-2A 21-864-4 OR 62802-51 QZ0024 M5T90-000","Motorola SM56 Speakerphone Modem" },
-{0x1057, 0x5803, "Motorola","MPC5200","32-Bit Embedded PowerPC Processor" },
-{0x1057, 0x6400, "Motorola","MPC190","Security Co-Processor" },
-{0x1057, 0x9876, "Motorola","1543","3052" },
-{0x105A, 0x0262, "Promise Technology","Promise Technology","Ultra66/FastTrak66" },
-{0x105A, 0x0D30, "Promise Technology","PDC20265/R","MBUltra100/MBFastTrack100 Lite" },
-{0x105A, 0x0D38, "Promise Technology","PDC20263","FastTrak66 Lite EIDE Controller" },
-{0x105A, 0x105A, "Promise Technology","DC5300","EIDE Controller" },
-{0x105A, 0x1275, "Promise Technology","PDC20275","MBUltra133" },
-{0x105A, 0x1960, "Promise Technology","?","SuperTrak 66/100 RAID" },
-{0x105A, 0x1962, "Promise Technology","?","SuperTrak SX 6000" },
-{0x105A, 0x3318, "Promise Technology","PDC20318","SATA150 TX4" },
-{0x105A, 0x3319, "Promise Technology","PDC20319","FastTrak S150 TX4" },
-{0x105A, 0x3371, "Promise Technology","PDC20371?","FastTrak S150 TX2+" },
-{0x105A, 0x3373, "Promise Technology","PDC20378","FastTrak 378/SATA 378 RAID Controller" },
-{0x105A, 0x3375, "Promise Technology","PDC20375","SATA150 TX2+" },
-{0x105A, 0x3376, "Promise Technology","PDC20376","FastTrak 376 Controller" },
-{0x105A, 0x3515, "Promise Technology","PDC40719","FastTrak TX43xx" },
-{0x105A, 0x3519, "Promise Technology","PDC40519","FastTrak TX42xx" },
-{0x105A, 0x3570, "Promise Technology","PDC20771","FastTrak TX2300 SATA300 Controller" },
-{0x105A, 0x3571, "Promise Technology","PDC20571","Fasttrack TX2200" },
-{0x105A, 0x3574, "Promise Technology","PDC20579","SATAII 150 579" },
-{0x105A, 0x3d17, "Promise Technology","PDC40718-GP","SATA 300 TX4 Controller" },
-{0x105A, 0x3D18, "Promise Technology","PDC20518/40518","SATAII 150TX2+/SATAII150 TX4" },
-{0x105A, 0x3D73, "Promise Technology","PDC40775","SATAII 300 TX2+" },
-{0x105A, 0x3F19, "Promise Technology","scsi","FastTrak TX2650/4650/4652" },
-{0x105A, 0x3F20, "Promise Technology","PDC42819","FastTrak TX2650(3F21)/4650(3F22)/PDC42819(3716)" },
-{0x105A, 0x4302, "Promise Technology","?","SuperTrak EX 43X0" },
-{0x105A, 0x4303, "Promise Technology","?","SuperTrak EX 4350" },
-{0x105A, 0x4D30, "Promise Technology","PDC20267","FastTrack100 on Intel MB SE7500CW2" },
-{0x105A, 0x4D33, "Promise Technology","PDC20246","FastTrak/Ultra33 ATA RAID controller" },
-{0x105A, 0x4D38, "Promise Technology","PDC20262","Ultra66/FastTrak66" },
-{0x105A, 0x4D68, "Promise Technology","PDC20268/R","Ultra100TX2/FastTrak100TX/LP" },
-{0x105A, 0x4D69, "Promise Technology","PDC20269","Ultra133TX2" },
-{0x105A, 0x5275, "Promise Technology","PDC20276","MBUltra133/MBFastTrak133" },
-{0x105A, 0x5300, "Promise Technology","DC5300","EIDE Controller" },
-{0x105A, 0x6268, "Promise Technology","PDC20270","FastTrak100 TX2/TX4/LP" },
-{0x105A, 0x6269, "Promise Technology","PDC20271","FastTrak TX2000 EIDE controller" },
-{0x105A, 0x6300, "Promise Technology","?","FastTrak SX 8300" },
-{0x105A, 0x6301, "Promise Technology","?","FastTrak SX8300-1" },
-{0x105A, 0x6302, "Promise Technology","6302","FastTrak SX 4300" },
-{0x105A, 0x6303, "Promise Technology","?","FastTrak SX 4" },
-{0x105A, 0x6304, "Promise Technology","?","FastTrak SX8300-2" },
-{0x105A, 0x6305, "Promise Technology","?","FastTrak SX8300-3" },
-{0x105A, 0x6306, "Promise Technology","?","FastTrak SX 4300-2" },
-{0x105A, 0x6307, "Promise Technology","?","FastTrak SX 4300-3" },
-{0x105A, 0x6621, "Promise Technology","PDC 20621(?)","FastTrak SX4000" },
-{0x105A, 0x6622, "Promise Technology","PDC 20622 (?)","FastTrak S150SX4" },
-{0x105A, 0x6629, "Promise Technology","PDC20619","FastTrak TX4000" },
-{0x105A, 0x7250, "Promise Technology","7250","Vitesse 7250 SAS RAID" },
-{0x105A, 0x7275, "Promise Technology","PDC 20277","SBUltra133/SBFastTrak 133 Lite" },
-{0x105A, 0x8000, "Promise Technology","?","SATAII150 SX8" },
-{0x105A, 0x8002, "Promise Technology","?","SATAII150 SX8" },
-{0x105A, 0x8003, "Promise Technology","PDC 20621","FastTrak SX4000" },
-{0x105A, 0x8004, "Promise Technology","?","SATAII150 SX8" },
-{0x105A, 0x8006, "Promise Technology","?","SATAII150 SX8" },
-{0x105A, 0x8350, "Promise Technology","?","SuperTrak EX8350/16350/8300/16300" },
-{0x105A, 0x8650, "Promise Technology","?","SuperTrak EX SAS RAID" },
-{0x105A, 0xC350, "Promise Technology","?","SuperTrak EX 123X0" },
-{0x105A, 0xE350, "Promise Technology","?","SuperTrak EX 243X0" },
-{0x105D, 0x2309, "Number Nine Visual Technology","Imagine 128","GUI Accelerator" },
-{0x105D, 0x2339, "Number Nine Visual Technology","I128s2","Imagine 128 Series 2" },
-{0x105D, 0x493D, "Number Nine Visual Technology","T2R","Revolution 3D" },
-{0x105D, 0x5348, "Number Nine Visual Technology","Revolution IV","Revolution IV" },
-{0x1060, 0x0001, "United Microelectronics","UM82C881","486 Chipset" },
-{0x1060, 0x0002, "United Microelectronics","UM82C886","ISA Bridge" },
-{0x1060, 0x0101, "United Microelectronics","UM8673F","EIDE Controller" },
-{0x1060, 0x0881, "United Microelectronics","UM8881","HB4 486 PCI Chipset" },
-{0x1060, 0x0886, "United Microelectronics","UM8886F","ISA Bridge" },
-{0x1060, 0x0891, "United Microelectronics","UM82C891","Pentium CPU to PCI bridge" },
-{0x1060, 0x1001, "United Microelectronics","UM886A","IDE Cntrlr (dual function)" },
-{0x1060, 0x673A, "United Microelectronics","UM8886BF","EIDE Controller" },
-{0x1060, 0x673B, "United Microelectronics","","EIDE Master/DMA" },
-{0x1060, 0x8710, "United Microelectronics","UM8710","VGA Cntrlr" },
-{0x1060, 0x8821, "United Microelectronics","21611a3b","CPU/PCI Bridge" },
-{0x1060, 0x8822, "United Microelectronics","","PCI/ISA Bridge" },
-{0x1060, 0x8851, "United Microelectronics","","Pentium CPU/PCI Bridge" },
-{0x1060, 0x8852, "United Microelectronics","LG-772","Pentium CPU/ISA Bridge" },
-{0x1060, 0x886A, "United Microelectronics","UM8886A","ISA Bridge with EIDE" },
-{0x1060, 0x8881, "United Microelectronics","UM8881F","HB4 486 PCI Chipset" },
-{0x1060, 0x8886, "United Microelectronics","UM8886","ISA Bridge (w/o IDE support)" },
-{0x1060, 0x888A, "United Microelectronics","UM8886A","" },
-{0x1060, 0x8891, "United Microelectronics","UM8891","586 Chipset" },
-{0x1060, 0x9017, "United Microelectronics","UM9017F","Ethernet" },
-{0x1060, 0x9018, "United Microelectronics","UM9018","Ethernet" },
-{0x1060, 0x9026, "United Microelectronics","UM9026","Fast Ethernet" },
-{0x1060, 0xE881, "United Microelectronics","UM8881","486 Chipset" },
-{0x1060, 0xE886, "United Microelectronics","UM8886N","ISA Bridge w/EIDE" },
-{0x1060, 0xE88A, "United Microelectronics","UM8886N","PCI / ISA Bridge" },
-{0x1060, 0xE891, "United Microelectronics","UM8891N","um8891n" },
-{0x1061, 0x0001, "8x8 Inc.","AGX013/016","GUI Accelerator" },
-{0x1061, 0x0002, "8x8 Inc.","IIT3104","MPEG Decoder" },
-{0x1065, 0x8139, "Texas Microsystems","nic","Realtek 8139C Network Card" },
-{0x1066, 0x0000, "Picopower Technology","PT80C826","VL Bridge" },
-{0x1066, 0x0001, "Picopower Technology","PT86C521","Vesuvius V1-LS System Controller" },
-{0x1066, 0x0002, "Picopower Technology","PT86C523","Vesuvius V3-LS ISA Bridge" },
-{0x1066, 0x0003, "Picopower Technology","PT80C524","Nile PCI to PCI Bridge" },
-{0x1066, 0x0004, "Picopower Technology","PT80C525","Nile-II PCI to PCI Bridge" },
-{0x1066, 0x0005, "Picopower Technology","PCI\\en_14E&DEV4318_REV|02","System Controller" },
-{0x1066, 0x8002, "Picopower Technology","PT86C523","ISA Bridge" },
-{0x1067, 0x1002, "Mitsubishi Electronics","G500","VolumePro Volume Rendering Accelerator" },
-{0x106B, 0x0001, "Apple Inc.","Bandit","PowerPC Host-PCI Bridge" },
-{0x106B, 0x0002, "Apple Inc.","Grand Central","I/O Controller" },
-{0x106B, 0x0003, "Apple Inc.","Control Video","" },
-{0x106B, 0x0004, "Apple Inc.","PlanB","Video-in" },
-{0x106B, 0x0007, "Apple Inc.","OHare","I/O Controller" },
-{0x106B, 0x0009, "Apple Inc.","BCM5703X","BCM5703X" },
-{0x106B, 0x000C, "Apple Inc.","","" },
-{0x106B, 0x000E, "Apple Inc.","Hydra","Mac I/O Controller" },
-{0x106B, 0x0010, "Apple Inc.","Heathrow","Mac I/O Controller" },
-{0x106B, 0x0017, "Apple Inc.","Paddington","Mac I/O Controller" },
-{0x106B, 0x0018, "Apple Inc.","UniNorth","FireWire Controller" },
-{0x106B, 0x001F, "Apple Inc.","UniNorth","Host-PCI bridge" },
-{0x106B, 0x0020, "Apple Inc.","UniNorth","AGP interface" },
-{0x106B, 0x0026, "Apple Inc.","Pangea","USB Interface" },
-{0x106B, 0x0027, "Apple Inc.","Pangea","AGP interface" },
-{0x106B, 0x002D, "Apple Inc.","UniNorth 1.5","AGP Bridge" },
-{0x106B, 0x002E, "Apple Inc.","UniNorth 1.5","PCI Bridge" },
-{0x106B, 0x002F, "Apple Inc.","UniNorth 1.5","Internal PCI" },
-{0x106B, 0x0030, "Apple Inc.","UniNorth/Pangea","FireWire Controller" },
-{0x106B, 0x003B, "Apple Inc.","Intrepid","Integrated ATA Controller" },
-{0x106B, 0x004f, "Apple Inc.","Shasta","Mac I/O controler" },
-{0x106B, 0x0050, "Apple Inc.","Shasta","IDE controler" },
-{0x106B, 0x0051, "Apple Inc.","Shasta","Sungem ethernet controler" },
-{0x106B, 0x0052, "Apple Inc.","Shasta","Firewire controler" },
-{0x106B, 0x0053, "Apple Inc.","Shasta","PCI Bridge" },
-{0x106B, 0x0054, "Apple Inc.","Shasta","PCI Bridge" },
-{0x106B, 0x0055, "Apple Inc.","Shasta","PCI Bridge" },
-{0x106B, 0x0058, "Apple Inc.","U3L","AGP Bridge" },
-{0x106B, 0x008A, "Apple Inc.","Apple RAID Controller","Mac Pro RAID Card" },
-{0x106B, 0x008C, "Apple Inc.","BCM4321 802.11a/b/g/n","AirPort Extreme" },
-{0x106C, 0x8801, "Hyundai Electronics America","","Dual Pentium ISA/PCI Motherboard" },
-{0x106C, 0x8802, "Hyundai Electronics America","P54C Tr8","PowerPC ISA/PCI Motherboard" },
-{0x106C, 0x8803, "Hyundai Electronics America","","Dual Window Graphics Accelerator" },
-{0x106C, 0x8804, "Hyundai Electronics America","ht019a","PCI LAN Controller" },
-{0x106C, 0x8805, "Hyundai Electronics America","00b","100-BaseT LAN Controller" },
-{0x106E, 0x4362, "DFI Inc.","88E8053","Yukon PCI-E Gigabit Ethernet Controller (copper)" },
-{0x1073, 0x0001, "Yamaha Corporation","","3D graphics Cntrlr" },
-{0x1073, 0x0002, "Yamaha Corporation","YGV615","RPA3 3D-Graphics Controller" },
-{0x1073, 0x0003, "Yamaha Corporation","00011179","" },
-{0x1073, 0x0004, "Yamaha Corporation","YMF754B DS-1S Audio","PCI Audio Controller" },
-{0x1073, 0x0005, "Yamaha Corporation","DS1","DS1 Audio" },
-{0x1073, 0x0006, "Yamaha Corporation","DS1","DS1 Audio" },
-{0x1073, 0x0008, "Yamaha Corporation","DS1","DS1 Audio" },
-{0x1073, 0x000A, "Yamaha Corporation","YMF740","DS-1L PCI Audio Controller" },
-{0x1073, 0x000C, "Yamaha Corporation","YMF740C","DS-1L PCI audio controller" },
-{0x1073, 0x000D, "Yamaha Corporation","YMF724F","YamahaDS1 native audio " },
-{0x1073, 0x0010, "Yamaha Corporation","YMF744B-V","DS-1 PCI audio controller" },
-{0x1073, 0x0012, "Yamaha Corporation","YMF754B","DS-1E PCI Audio Controller" },
-{0x1073, 0x0020, "Yamaha Corporation","744","DS-1 Audio" },
-{0x1073, 0x1000, "Yamaha Corporation","SW1000XG","Sound system" },
-{0x1073, 0x2000, "Yamaha Corporation","DS2416","Digital Mixing Card" },
-{0x1073, 0x9876, "Yamaha Corporation","ymf724b-v9941","yamaha" },
-{0x1074, 0x4E78, "Nexgen Microsystems","82C500/1","Nx586 Chipset" },
-{0x1077, 0x1016, "QLogic Corporation","ISP10160","Single Channel Ultra3 SCSI Processor" },
-{0x1077, 0x1020, "QLogic Corporation","ISP093a/2460","Fast-wide SCSI - Sparc PCI" },
-{0x1077, 0x1022, "QLogic Corporation","ISP1022A","Fast-wide SCSI" },
-{0x1077, 0x1080, "QLogic Corporation","ISP1080","SCSI Host Adapter" },
-{0x1077, 0x1216, "QLogic Corporation","ISP12160","Dual Channel Ultra3 SCSI Processor" },
-{0x1077, 0x1240, "QLogic Corporation","ISP1240","SCSI Host Adapter" },
-{0x1077, 0x1280, "QLogic Corporation","ISP1280","SCSI Host Adapter" },
-{0x1077, 0x2020, "QLogic Corporation","ISP2020A","Fast!SCSI Basic Adapter" },
-{0x1077, 0x2100, "QLogic Corporation","ISP2100","64-bit Fibre Channel Adapter" },
-{0x1077, 0x2200, "QLogic Corporation","ISP2200","PCI Fibre Channel Adapter" },
-{0x1077, 0x2300, "QLogic Corporation","ISP 2300","64-bit PCI FC-AL Adapter" },
-{0x1077, 0x2312, "QLogic Corporation","ISP 2312","Fibre Channel Adapter" },
-{0x1077, 0x2422, "QLogic Corporation","ISP2422","QLogic PCI to Fibre Channel Host Adapter for QLA2460" },
-{0x1077, 0x2432, "QLogic Corporation","ISP2432","4Gb PCI Single/Dual Fibre Channel HBA" },
-{0x1077, 0x2532, "QLogic Corporation","ISP2532","8Gb PCIe x8 Single/Dual Fibre Channel HBA" },
-{0x1077, 0x3010, "QLogic Corporation","n/a","n/a" },
-{0x1077, 0x3032, "QLogic Corporation","ISP4032","QLOGIC Dual Port 1GBPS PCI-E HBA" },
-{0x1077, 0x4000, "QLogic Corporation","","" },
-{0x1077, 0x4010, "QLogic Corporation","","" },
-{0x1077, 0x6312, "QLogic Corporation","SP202","Qlogic FC-HBA QLA200" },
-{0x1077, 0x6422, "QLogic Corporation","EP2422","4-Gbps Fibre Channel to PCI-X 2.0 266MHz controller for Embedded Applications" },
-{0x1077, 0x6432, "QLogic Corporation","EP2432","4-Gbps Fibre Channel to PCIe controller for Embedded Applications" },
-{0x1077, 0x8000, "QLogic Corporation","8142","QLE8142 QLogic PCI Express to 10 GbE Dual Channel CNA" },
-{0x1077, 0x8001, "QLogic Corporation","8142","QLE8142 QLogic PCI Express to 10 GbE Dual Channel CNA (FCoE)" },
-{0x1077, 0x8020, "QLogic Corporation","8242","QLogic Dual Port 10 Gigabit Ethernet CNA" },
-{0x1077, 0x8021, "QLogic Corporation","8242","QLogic [FCoE] Adapter" },
-{0x1077, 0x8022, "QLogic Corporation","ISP8242","QLE8142 QLogic PCI Express to 10 GbE Dual Channel CNA (iSCSI)" },
-{0x1078, 0x0000, "Cyrix Corporation","Cx5520","ISA Bridge" },
-{0x1078, 0x0001, "Cyrix Corporation","MediaGXm","Cyrix Integrated CPU" },
-{0x1078, 0x0002, "Cyrix Corporation","Cx5520","ISA Bridge" },
-{0x1078, 0x0100, "Cyrix Corporation","Cx5530","ISA bridge" },
-{0x1078, 0x0101, "Cyrix Corporation","Cx5530","SMI status and ACPI timer" },
-{0x1078, 0x0102, "Cyrix Corporation","Cx5530","IDE Controller" },
-{0x1078, 0x0103, "Cyrix Corporation","Cx5530","XpressAUDIO" },
-{0x1078, 0x0104, "Cyrix Corporation","Cx5530","Video Controller" },
-{0x1078, 0x0400, "Cyrix Corporation","ZFMicro","CPU to PCI Bridge" },
-{0x1078, 0x0401, "Cyrix Corporation","ZFMicro","Power Management Controller" },
-{0x1078, 0x0402, "Cyrix Corporation","ZFMicro","IDE Controller" },
-{0x1078, 0x0403, "Cyrix Corporation","ZFMicro","Expansion Bus" },
-{0x107D, 0x0000, "Leadtek Research","P86C850","Graphic GLU-Logic" },
-{0x107E, 0x0001, "Testernec","FLIPPER","FRED Local Bus I/F to PCI Peripheral" },
-{0x107E, 0x0002, "Testernec","","100 vg anylan Cntrlr" },
-{0x107E, 0x0004, "Testernec","5526","Fibre Channel Host Adapter" },
-{0x107E, 0x0005, "Testernec","x526","Fibre Channel Host Adapter" },
-{0x107E, 0x0008, "Testernec","4575/5525/5575/6575","(i)chipSAR+ 155 MBit ATM controller" },
-{0x107E, 0x9003, "Testernec","5535-4P-BRI-ST","" },
-{0x107E, 0x9007, "Testernec","5535-4P-BRI-U","" },
-{0x107E, 0x9008, "Testernec","5535-1P-SR","" },
-{0x107E, 0x900C, "Testernec","5535-1P-SR-ST","" },
-{0x107E, 0x900E, "Testernec","5535-1P-SR-U","" },
-{0x107E, 0x9011, "Testernec","5535-1P-PRI","" },
-{0x107E, 0x9013, "Testernec","5535-2P-PRI","" },
-{0x107E, 0x9023, "Testernec","5535-4P-BRI-ST","" },
-{0x107E, 0x9027, "Testernec","5536-4P-BRI-U","" },
-{0x107E, 0x9031, "Testernec","5535-1P-PRI","" },
-{0x107E, 0x9033, "Testernec","5536-2P-PRI","Adapter" },
-{0x107E, 0x9060, "Testernec","6535","CompactPCI T1/E1/J1Communications Ctrlr" },
-{0x107E, 0x9070, "Testernec","4538","PMC T1/E1/J1 Communications Controller" },
-{0x107E, 0x9080, "Testernec","4532-002/005","PMC ATM Over OC-3/STM-1 Comm Controller" },
-{0x107E, 0x9081, "Testernec","4532-001/004","PMC ATM Over OC-3/STM-1 Comm Controller" },
-{0x107E, 0x9082, "Testernec","4532-000/003","PMC ATM Over OC-3/STM-1 Comm Controller" },
-{0x107E, 0x9090, "Testernec","107","PMC ATM Over T3/E3 Communications Ctrlr" },
-{0x107E, 0x90A0, "Testernec","4539","PMC Quad T1/E1/J1 Communications Ctrlr" },
-{0x107F, 0x0802, "Data Technology Corporation","mb87j3560","pinacale capture card" },
-{0x107F, 0x0803, "Data Technology Corporation","","EIDE Bus Master Controller" },
-{0x107F, 0x0806, "Data Technology Corporation","","EIDE Controller" },
-{0x107F, 0x2015, "Data Technology Corporation","","EIDE Controller" },
-{0x1080, 0x0600, "Cypress Semiconductor","82C596/9","CPU to PCI & PCI to ISA Bridge" },
-{0x1080, 0xC691, "Cypress Semiconductor","Cypress CY7c68001","AN2131QC 0230" },
-{0x1080, 0xC693, "Cypress Semiconductor","82C693","PCI to ISA Bridge" },
-{0x1081, 0x0D47, "Radius Inc.","2330","Radius PCI to NuBUS Bridge" },
-{0x1083, 0x0001, "Forex Computer Corporation","FR710","PCI Enhanced IDE Adapter" },
-{0x1083, 0x0613, "Forex Computer Corporation","","PCI" },
-{0x1085, 0x0001, "Tulip Computers Int'l BV","UsbDgn","Datalaster Interface for OBD automotive" },
-{0x1087, 0x9200, "Cache Computer","","" },
-{0x1089, 0x5555, "Data General Corporation","3059","3249" },
-{0x108A, 0x0001, "SBS  Operations","Model 617","PCI-VME Bus Adapter" },
-{0x108A, 0x0003, "SBS  Operations","Model 616","PCI to VME Bridge" },
-{0x108A, 0x0010, "SBS  Operations","Model 618","VME Bridge" },
-{0x108A, 0x0040, "SBS  Operations","dataBLIZZARD","" },
-{0x108A, 0x3000, "SBS  Operations","Model 2106","VME Bridge" },
-{0x108D, 0x0001, "Olicom","OC-3136/37","Token-Ring 16/4 PCI Adapter" },
-{0x108D, 0x0002, "Olicom","OC-3139f","Fastload 16/4 PCI/III Token Ring Adapter" },
-{0x108D, 0x0004, "Olicom","OC-3139/40","RapidFire Token Ring 16/4 Adapter" },
-{0x108D, 0x0005, "Olicom","OC-3250","GoCard Token Ring 16/4 Adapter" },
-{0x108D, 0x0006, "Olicom","OC-3530","RapidFire Token Ring 100 Adapter" },
-{0x108D, 0x0007, "Olicom","OC-3141","RapidFire Token Ring 16/4 Adapter" },
-{0x108D, 0x0008, "Olicom","OC-3540","RapidFire HSTR 100/16/4 Adapter" },
-{0x108D, 0x000A, "Olicom","OC-3150","RapidFire Token-Ring 16/4 PCI Adapter" },
-{0x108D, 0x0011, "Olicom","OC-2805","Ethernet Controller" },
-{0x108D, 0x0012, "Olicom","OC-2325","Ethernet PCI/II 10/100 Controller" },
-{0x108D, 0x0013, "Olicom","OC-2183/85","PCI/II Ethernet Controller" },
-{0x108D, 0x0014, "Olicom","OC-2326","Ethernet PCI/II 10/100 Controller" },
-{0x108D, 0x0019, "Olicom","PCI/VEN_8086&DEV_1039&SUBSYS_02671014&REV_81\\4&252","10/100 Ethernet Controller" },
-{0x108D, 0x0021, "Olicom","OC-6151/52","155 Mbit ATM Adapter" },
-{0x108D, 0x0022, "Olicom","","ATM Adapter" },
-{0x108E, 0x0001, "Sun Microsystems","SPARC EBUS","" },
-{0x108E, 0x1000, "Sun Microsystems","PCIO","PCI Input/Output Controller" },
-{0x108E, 0x1001, "Sun Microsystems","PCIO","Happy Meal Ethernet" },
-{0x108E, 0x1100, "Sun Microsystems","RIO EBUS","" },
-{0x108E, 0x1101, "Sun Microsystems","RIO GEM","" },
-{0x108E, 0x1102, "Sun Microsystems","RIO 1394","" },
-{0x108E, 0x1103, "Sun Microsystems","RIO USB","" },
-{0x108E, 0x2BAD, "Sun Microsystems","GEM","Sun Gigabit Ethernet Card" },
-{0x108E, 0x5000, "Sun Microsystems","SME2411","UltraSPARC-IIi Advanced PCI Bridge" },
-{0x108E, 0x5043, "Sun Microsystems","SunPCI","Co-processor" },
-{0x108E, 0x7063, "Sun Microsystems","SunPCi","PCI card with Intel or AMD processor" },
-{0x108E, 0x8000, "Sun Microsystems","STP2223BGA","UPA to PCI Interface (UPA)" },
-{0x108E, 0x8001, "Sun Microsystems","Schizo","PCI Bus Module" },
-{0x108E, 0xA000, "Sun Microsystems","UltraSPARC IIi","Sabre" },
-{0x108E, 0xA001, "Sun Microsystems","UltraSPARC IIe","Hummingbird" },
-{0x108E, 0xabba, "Sun Microsystems","CE (Cassini Ethernet)","10/100/1000 Ethernet adapter" },
-{0x1091, 0x0020, "Intergraph Corporation","1091","3D Graphics Processor" },
-{0x1091, 0x0021, "Intergraph Corporation","","3D graphics processor w/texturing" },
-{0x1091, 0x0040, "Intergraph Corporation","","3D graphics frame buffer" },
-{0x1091, 0x0041, "Intergraph Corporation","","3D graphics frame buffer" },
-{0x1091, 0x0060, "Intergraph Corporation","","Proprietary bus Bridge" },
-{0x1091, 0x00E4, "Intergraph Corporation","Powerstorm 4D50T","" },
-{0x1091, 0x0720, "Intergraph Corporation","","Motion JPEG Codec" },
-{0x1092, 0x00A0, "Diamond Computer Systems","SpeedStar Pro SE","GUI Accelerator" },
-{0x1092, 0x00A8, "Diamond Computer Systems","SpeedStar 64","GUI Accelerator" },
-{0x1092, 0x0550, "Diamond Computer Systems","Viper V550","" },
-{0x1092, 0x08D4, "Diamond Computer Systems","Supra 2260","WinModem" },
-{0x1092, 0x094C, "Diamond Computer Systems","SupraExpress 56i Pro","SupraExpress 56i Pro" },
-{0x1092, 0x09C8, "Diamond Computer Systems","SUP2761","SupraExpress 56i Pro VCC" },
-{0x1092, 0x1002, "Diamond Computer Systems","R6793-12","RS56-pci" },
-{0x1092, 0x1092, "Diamond Computer Systems","Viper V330","2710a" },
-{0x1092, 0x6120, "Diamond Computer Systems","Maximum","DVD" },
-{0x1092, 0x8810, "Diamond Computer Systems","Stealth SE","GUI Accelerator" },
-{0x1092, 0x8811, "Diamond Computer Systems","Stealth 64/SE","GUI Accelerator" },
-{0x1092, 0x8880, "Diamond Computer Systems","Stealth Video","" },
-{0x1092, 0x8881, "Diamond Computer Systems","Stealth Video","GUI Accelerator" },
-{0x1092, 0x88B0, "Diamond Computer Systems","Stealth 64 Video","GUI Accelerator" },
-{0x1092, 0x88B1, "Diamond Computer Systems","Stealth 64 Video","GUI Accelerator" },
-{0x1092, 0x88C0, "Diamond Computer Systems","Stealth 64","GUI Accelerator" },
-{0x1092, 0x88C1, "Diamond Computer Systems","Stealth 64","GUI Accelerator" },
-{0x1092, 0x88D0, "Diamond Computer Systems","Stealth 64","GUI Accelerator" },
-{0x1092, 0x88D1, "Diamond Computer Systems","Stealth 64","GUI Accelerator" },
-{0x1092, 0x88F0, "Diamond Computer Systems","Stealth 64 Video","GUI Accelerator" },
-{0x1092, 0x88F1, "Diamond Computer Systems","Stealth 64 Video","GUI Accelerator" },
-{0x1092, 0x9876, "Diamond Computer Systems","","Supra Express 56i Pro CW #2" },
-{0x1092, 0x9999, "Diamond Computer Systems","Monster Sound","Diamand Technology DT0398" },
-{0x1093, 0x0160, "National Instruments","PCI-DIO-96","data adquisition input and output" },
-{0x1093, 0x0161, "National Instruments","PCI-1200","Multifunction data acquisition board" },
-{0x1093, 0x0162, "National Instruments","PCI-MIO-16XE-50","24MIO  6-03-2" },
-{0x1093, 0x1150, "National Instruments","PCI-DIO-32HS","High Speed Digital I/O Board" },
-{0x1093, 0x1170, "National Instruments","PCI-MIO-16XE-10","" },
-{0x1093, 0x1180, "National Instruments","PCI-VEN-1180 ","base system device" },
-{0x1093, 0x1190, "National Instruments","PCI-MIO-16E-4","" },
-{0x1093, 0x11B0, "National Instruments","","" },
-{0x1093, 0x11C0, "National Instruments","","" },
-{0x1093, 0x11D0, "National Instruments","","" },
-{0x1093, 0x11E0, "National Instruments","","" },
-{0x1093, 0x1270, "National Instruments","PCI-6032E","Multifunction Data Acquisition Card" },
-{0x1093, 0x12b0, "National Instruments","PCI-6534","High Speed DIO" },
-{0x1093, 0x1310, "National Instruments","PCI-6602","Data Acquisition Device" },
-{0x1093, 0x1320, "National Instruments","","" },
-{0x1093, 0x1330, "National Instruments","PCI-6031E","" },
-{0x1093, 0x1340, "National Instruments","PCI-6033E","Multifunction Data Acquisition Card" },
-{0x1093, 0x1350, "National Instruments","PCI-6071E"," NI PCI-6071E Multifunction I/O & NI-DAQ" },
-{0x1093, 0x1360, "National Instruments","","" },
-{0x1093, 0x14e0, "National Instruments","PCI611X","PCI611X" },
-{0x1093, 0x17D0, "National Instruments","PCI-6503","" },
-{0x1093, 0x18B0, "National Instruments","","" },
-{0x1093, 0x28b0, "National Instruments","NI 6014","I/O Terminal NI-DAQ (Legacy) and NI-DAQmx" },
-{0x1093, 0x2A60, "National Instruments","PCI-6023E","" },
-{0x1093, 0x2A70, "National Instruments","PCI-6024E","Multifunction Data Acquisition Card" },
-{0x1093, 0x2A80, "National Instruments","PCI-6025E","Multifunction Data Acquisition Card" },
-{0x1093, 0x2B20, "National Instruments","PCI-6527","" },
-{0x1093, 0x2C80, "National Instruments","PCI-6035E","" },
-{0x1093, 0x2CA0, "National Instruments","","PCI-6034E" },
-{0x1093, 0x702C, "National Instruments","NI PXI-7831R","NI FPGA Modul" },
-{0x1093, 0x70af, "National Instruments","PCI-6221","16-Bit, 250 kS/s, 16 Analog Inputs" },
-{0x1093, 0x70b8, "National Instruments","NI PCI-6251","Multifunction DAQ Device" },
-{0x1093, 0x70E3, "National Instruments","1","NI PXI-8431/8 (RS485/RS422)" },
-{0x1093, 0x70E4, "National Instruments","70E41093","NI PCI-8430/8 (RS-232) Interface" },
-{0x1093, 0x710e, "National Instruments","PCIe-GPIB","GPIB Controller Interface Board" },
-{0x1093, 0x7146, "National Instruments","NI-PCI-6132","NI-PCI-6132" },
-{0x1093, 0x71BC, "National Instruments","PCI-6221 ","16-Bit, 250 kS/s, 16 Analog Inputs  (DSUB37)" },
-{0x1093, 0x7414, "National Instruments","PCIe-GPIB+","NI PCIe-GPIB+ GPIB with analyzer" },
-{0x1093, 0xB001, "National Instruments","IMAQ-PCI-1408","" },
-{0x1093, 0xB011, "National Instruments","IMAQ-PXI-1408","" },
-{0x1093, 0xB021, "National Instruments","IMAQ-PCI-1424","" },
-{0x1093, 0xB031, "National Instruments","IMAQ-PCI-1413","" },
-{0x1093, 0xB041, "National Instruments","IMAQ-PCI-1407","1pcs" },
-{0x1093, 0xB051, "National Instruments","IMAQ-PXI-1407","" },
-{0x1093, 0xB061, "National Instruments","IMAQ-PCI-1411","" },
-{0x1093, 0xB071, "National Instruments","IMAQ-PCI-1422","IMAQ-PCI-1422" },
-{0x1093, 0xB081, "National Instruments","IMAQ-PXI-1422","" },
-{0x1093, 0xB091, "National Instruments","IMAQ-PXI-1411","bluethooth" },
-{0x1093, 0xC4C4, "National Instruments","NI PCIe-1433","NI PCIe-1433 extended (deca) Camera Link frame grabber" },
-{0x1093, 0xC801, "National Instruments","PCI-GPIB","GPIB Controller Interface Board" },
-{0x1093, 0xC811, "National Instruments","","" },
-{0x1093, 0xC821, "National Instruments","","" },
-{0x1093, 0xC831, "National Instruments","TNT5002","PCI-GPIB" },
-{0x1093, 0xC840, "National Instruments","","" },
-{0x1093, 0xd130, "National Instruments","PCI-232/2","2-port RS-232 Serial Interface Board" },
-{0x1095, 0x0240, "Silicon Image, Inc.","SIL3112","SATA/Raid controller(2XSATA150)" },
-{0x1095, 0x0242, "Silicon Image, Inc.","SIL3132","SATAII/Raid controller" },
-{0x1095, 0x0244, "Silicon Image, Inc.","SIL3132","eSATA/Raid controller" },
-{0x1095, 0x0640, "Silicon Image, Inc.","PCI0640A/B","EIDE Ctrlr" },
-{0x1095, 0x0641, "Silicon Image, Inc.","pci0640","pci eide adapter with raid 1" },
-{0x1095, 0x0642, "Silicon Image, Inc.","PCI0642","IDE Cntrlr w/RAID 1" },
-{0x1095, 0x0643, "Silicon Image, Inc.","PCI0643","PCI EIDE controller" },
-{0x1095, 0x0646, "Silicon Image, Inc.","CMD646","EIDE/UDMA Controller" },
-{0x1095, 0x0647, "Silicon Image, Inc.","PCI0647","9738" },
-{0x1095, 0x0648, "Silicon Image, Inc.","PCI-648","Bus Master Ultra DMA PCI-IDE/ATA Chip" },
-{0x1095, 0x0649, "Silicon Image, Inc.","PCI-649","PATA100 ATAPI/RAID Controller" },
-{0x1095, 0x0650, "Silicon Image, Inc.","PBC0650A","Fast SCSI-II Ctrlr" },
-{0x1095, 0x0670, "Silicon Image, Inc.","USB0670","PCI-USB" },
-{0x1095, 0x0673, "Silicon Image, Inc.","USB0673","PCI-USB ASIC" },
-{0x1095, 0x0680, "Silicon Image, Inc.","SiI 0680/680A","PATA133 ATAPI/RAID Controller" },
-{0x1095, 0x1025, "Silicon Image, Inc.","PCI0647","9738" },
-{0x1095, 0x1392, "Silicon Image, Inc.","1390/1392","High Definition Audio HDMI output" },
-{0x1095, 0x2455, "Silicon Image, Inc.","SI3124","SATALink 4-Port PCI-X Host Controller" },
-{0x1095, 0x3112, "Silicon Image, Inc.","SIL3112","SATA/Raid controller(2XSATA150)" },
-{0x1095, 0x3114, "Silicon Image, Inc.","Sil 3114","SATALink/SATARaid Controller" },
-{0x1095, 0x3124, "Silicon Image, Inc.","SiI 3124","PCI-X to Serial ATA Controller" },
-{0x1095, 0x3132, "Silicon Image, Inc.","SiI 3132","RR252x SATA Controller" },
-{0x1095, 0x3512, "Silicon Image, Inc.","Sil 3512","SATALink/SATARaid Controllerhttp://www.pcidatabase.com/update_device.php?__ec_i=ec.1378825283.616786" },
-{0x1095, 0x3531, "Silicon Image, Inc.","3531","SiI 3531 SATA Controller" },
-{0x1095, 0x9876, "Silicon Image, Inc.","0x9876","0x9876" },
-{0x1096, 0x1106, "Alacron","0x3059","Realtek AC97 Audio for VIA (R) Audio Controller" },
-{0x1096, 0x3059, "Alacron","VT8233","South Bridge" },
-{0x1097, 0x0038, "Appian Graphics","","EIDE Controller (single FIFO)" },
-{0x1098, 0x0001, "Quantum Designs Ltd.","QD8500","EIDE Controller" },
-{0x1098, 0x0002, "Quantum Designs Ltd.","QD8580","EIDE Controller" },
-{0x109A, 0x8280, "Packard Bell","0x036en","4 channel video digitizer cardm" },
-{0x109E, 0x0350, "Brooktree Corporation","036E","rb8701.1" },
-{0x109E, 0x0351, "Brooktree Corporation","Bt848","BrookTree Bt848 Video Capture Device - Audio Section	PCI" },
-{0x109E, 0x0369, "Brooktree Corporation","Bt878fusion 878a","Video Capture" },
-{0x109E, 0x036C, "Brooktree Corporation","th&#305;k","" },
-{0x109E, 0x036E, "Brooktree Corporation","A8FEFC28","AVerMediaAverTV WDM AudioCapture (878)" },
-{0x109E, 0x036F, "Brooktree Corporation","bx878","Video Capture" },
-{0x109E, 0x0370, "Brooktree Corporation","Bt880B","Video Capture (10 bit High qualtiy cap)" },
-{0x109E, 0x0878, "Brooktree Corporation","Conexant Fusion 878A 25878-13 0549Y1JF","Multimedia Controller Conexant Fusion 878A 25878-13 0549Y1JF" },
-{0x109E, 0x0879, "Brooktree Corporation","Bt879khf","Video Capture (Audio Section)" },
-{0x109E, 0x0880, "Brooktree Corporation","Bt880","Video Capture (Audio Section)" },
-{0x109E, 0x109E, "Brooktree Corporation","Brooktree Corp BT848 SVR-2000 V1.02m","Multimedia Video Controllerm" },
-{0x109E, 0x2115, "Brooktree Corporation","BtV 2115","BtV Mediastream Controller 9x" },
-{0x109E, 0x2125, "Brooktree Corporation","109E","BtV Mediastream Controller" },
-{0x109E, 0x2164, "Brooktree Corporation","BtV 2164","Display Adapter" },
-{0x109E, 0x2165, "Brooktree Corporation","BtV 2165","MediaStream Controller" },
-{0x109E, 0x36e, "Brooktree Corporation","878a","25878-13" },
-{0x109E, 0x8230, "Brooktree Corporation","BtV 8230","ATM Segment/Reassembly Controller (SRC)" },
-{0x109E, 0x8472, "Brooktree Corporation","Bt8471/72","32/64-channel HDLC Controllers" },
-{0x109E, 0x8474, "Brooktree Corporation","Bt8474","128-channel HDLC Controller" },
-{0x109F, 0x036F, "Trigem Computer Inc.","20020001","Video Capturee" },
-{0x10A4, 0x5969, "Globe Manufacturing Sales","","" },
-{0x10A8, 0x0000, "Sierra Semiconductor","0100","ethernet controller" },
-{0x10A9, 0x0004, "Silicon Graphics","O2 MACE","" },
-{0x10A9, 0x0005, "Silicon Graphics","RAD Audio","" },
-{0x10A9, 0x0006, "Silicon Graphics","HPCEX","" },
-{0x10A9, 0x0007, "Silicon Graphics","RPCEX","" },
-{0x10A9, 0x0008, "Silicon Graphics","DiVO VIP","" },
-{0x10A9, 0x0009, "Silicon Graphics","Alteon","Gigabit Ethernet" },
-{0x10A9, 0x0010, "Silicon Graphics","AMP","Video I/O" },
-{0x10A9, 0x0011, "Silicon Graphics","GRIP","" },
-{0x10A9, 0x0012, "Silicon Graphics","SGH PSHAC GSN","" },
-{0x10A9, 0x1001, "Silicon Graphics","Magic Carpet","" },
-{0x10A9, 0x1002, "Silicon Graphics","Lithium","" },
-{0x10A9, 0x1003, "Silicon Graphics","Dual JPEG 1","" },
-{0x10A9, 0x1004, "Silicon Graphics","Dual JPEG 2","" },
-{0x10A9, 0x1005, "Silicon Graphics","Dual JPEG 3","" },
-{0x10A9, 0x1006, "Silicon Graphics","Dual JPEG 4","" },
-{0x10A9, 0x1007, "Silicon Graphics","Dual JPEG 5","" },
-{0x10A9, 0x1008, "Silicon Graphics","Cesium","" },
-{0x10A9, 0x2001, "Silicon Graphics","","Fibre Channel" },
-{0x10A9, 0x2002, "Silicon Graphics","ASDE","" },
-{0x10A9, 0x8001, "Silicon Graphics","O2 1394","" },
-{0x10A9, 0x8002, "Silicon Graphics","G-net NT","" },
-{0x10AB, 0x1005, "Digicom","USB\\VID_0000@PID_0000\\6@390392D@0@1","USB Pendrive" },
-{0x10AB, 0x1007, "Digicom","USB\\VID_0000@PID_0000\\6@390392D@0@1","usb pendrive" },
-{0x10AB, 0x8086, "Digicom","2200","PCI Simple Communications Controller " },
-{0x10AD, 0x0001, "Winbond Systems Labs","W83769F","EIDE Ctrlr" },
-{0x10AD, 0x0103, "Winbond Systems Labs","sl82c103","PCI-ide mode 4.5 Cntrlr" },
-{0x10AD, 0x0105, "Winbond Systems Labs","W83789F","Sonata bus master PCI-IDE controller" },
-{0x10AD, 0x0565, "Winbond Systems Labs","W83C553F","PCI/ISA bridge" },
-{0x10B5, 0x0324, "PLX Technology Inc.","","" },
-{0x10B5, 0x0480, "PLX Technology Inc.","IOP 480","Integrated PowerPC I/O Processor" },
-{0x10B5, 0x0960, "PLX Technology Inc.","PCI 9080RDK-960","PCI Reference Design Kit for PCI 9080" },
-{0x10B5, 0x1030, "PLX Technology Inc.","Gazel R685","ISDN card" },
-{0x10B5, 0x1054, "PLX Technology Inc.","Gazel R697","dual channel ISDN card" },
-{0x10B5, 0x1078, "PLX Technology Inc.","PCI 9050","Vision Systems VScom PCI-210" },
-{0x10B5, 0x1103, "PLX Technology Inc.","PCI 9050","Vision Systems VScom PCI-200" },
-{0x10B5, 0x1146, "PLX Technology Inc.","PCI 9050","Vision Systems VScom PCI-010S" },
-{0x10B5, 0x1147, "PLX Technology Inc.","PCI 9050","Vision Systems VScom PCI-020S" },
-{0x10B5, 0x1151, "PLX Technology Inc.","Gazel R753","ISDN card" },
-{0x10B5, 0x1152, "PLX Technology Inc.","Gazel R753","ISDN card" },
-{0x10B5, 0x2724, "PLX Technology Inc.","","Thales PCSM Security Card" },
-{0x10B5, 0x2748, "PLX Technology Inc.","9054","TPCX Transientrecorder Card" },
-{0x10B5, 0x3001, "PLX Technology Inc.","plx9030","gpscard" },
-{0x10B5, 0x5406, "PLX Technology Inc.","PCI RDK9054-LITE","PCI Reference Design Kit for PLX PCI 9054" },
-{0x10B5, 0x5601, "PLX Technology Inc.","PCI 9056","32-bit; 66MHz PCI Bus Master I/O Accelerator, 17 x 17mm FPBGA" },
-{0x10B5, 0x6520, "PLX Technology Inc.","PCI6520 G","PCI-X to PCI-X Bridge" },
-{0x10B5, 0x6ACC, "PLX Technology Inc.","PCI 9030","General Mechatronics 6 Axis Motion Control Card for EMC2" },
-{0x10B5, 0x8111, "PLX Technology Inc.","PEX 8311","1 Lane PCI Express to PCI bridge (PEX8111); 1 Lane PCI Express to Generic Local Bus bridge (PEX8311)" },
-{0x10B5, 0x8112, "PLX Technology Inc.","PEX8112","1 Lane PCI Express to PCI bridge" },
-{0x10B5, 0x8508, "PLX Technology Inc.","PEX8508","8 Lane, 5 Port PCI Express Switch" },
-{0x10B5, 0x8509, "PLX Technology Inc.","PEX8509","8-lane PCI-Express Switch" },
-{0x10B5, 0x8516, "PLX Technology Inc.","PEX 8516","Versatile PCI Express Switch" },
-{0x10B5, 0x8518, "PLX Technology Inc.","PEX8518-AB25BI","PLX PCI-e switch" },
-{0x10B5, 0x8532, "PLX Technology Inc.","PEX 8532","Versatile PCI Express Switch" },
-{0x10B5, 0x8548, "PLX Technology Inc.","8548","48-lane PCIe switch" },
-{0x10B5, 0x8609, "PLX Technology Inc.","PEX 8609","8 Lane, 8 Port PCI Express Switch" },
-{0x10B5, 0x8664, "PLX Technology Inc.","PEX 8664","64-Lane, 16-Port PCI Express Gen 2 (5.0 GT/s) Switch, 35 x 35mm FCBGA" },
-{0x10B5, 0x8748, "PLX Technology Inc.","PEX 8748","48-Lane, 12-Port PCI Express Gen 3  Multi-Root Switch" },
-{0x10B5, 0x9030, "PLX Technology Inc.","PCI 9030","PCI SMARTarget I/O Accelerator" },
-{0x10B5, 0x9036, "PLX Technology Inc.","PCI9036","Interface chip - value 1k" },
-{0x10B5, 0x9050, "PLX Technology Inc.","PCI 9050","Target PCI Interface Chip - value 1k" },
-{0x10B5, 0x9052, "PLX Technology Inc.","PCI 9052","PCI 9052 Target PLX PCI Interface Chip" },
-{0x10B5, 0x9054, "PLX Technology Inc.","PCI 9054","PCI I/O Accelerator" },
-{0x10B5, 0x9056, "PLX Technology Inc.","PCI9056","32-bit, 66 MHz PCI Bus-Mastering I/O Accelerator for PowerQUICC and Generic 32-bit, 66 MHz Local Bus" },
-{0x10B5, 0x9060, "PLX Technology Inc.","PCI9060","PCI Bus Master Interface Chip" },
-{0x10B5, 0x906D, "PLX Technology Inc.","PCI 9060SD","PCI Bus Master Interface Chip" },
-{0x10B5, 0x906E, "PLX Technology Inc.","PCI 9060ES","PCI Bus Master Interface Chip" },
-{0x10B5, 0x9080, "PLX Technology Inc.","PCI 9080","High performance PCI to Local Bus chip" },
-{0x10B6, 0x0001, "Madge Networks","Smart 16/4","Ringnode (PCI1b)" },
-{0x10B6, 0x0002, "Madge Networks","Smart 16/4","Ringnode (PCIBM2/CardBus)" },
-{0x10B6, 0x0003, "Madge Networks","Smart 16/4","Ringnode" },
-{0x10B6, 0x0004, "Madge Networks","","Smart 16/4 Ringnode Mk1 (PCIBM1)" },
-{0x10B6, 0x0006, "Madge Networks","","16/4 CardBus Adapter (Eric 2)" },
-{0x10B6, 0x0007, "Madge Networks","Presto PCI 1716","" },
-{0x10B6, 0x0009, "Madge Networks","","Smart 100/16/4 PCi-HS Ringnode" },
-{0x10B6, 0x000A, "Madge Networks","","Smart 100/16/4 PCI Ringnode" },
-{0x10B6, 0x000B, "Madge Networks","","16/4 CardBus  Adapter Mk2" },
-{0x10B6, 0x1000, "Madge Networks","Horizon","ATM adapter" },
-{0x10B6, 0x1001, "Madge Networks","Ambassador","ATM adapter" },
-{0x10B6, 0x1002, "Madge Networks","Ambassador","ATM Adapter" },
-{0x10B7, 0x0001, "3Com Corporation","3C985","1000BaseSX Gigabit Etherlink" },
-{0x10B7, 0x0013, "3Com Corporation","3com p/n: 3CRDAG675","3Com11a/b/g Wireless PCI Adapter " },
-{0x10B7, 0x1000, "3Com Corporation","3C905CX-TXNM","3COM 3C905CX-TXNM with 40-0664-003 ASIC" },
-{0x10B7, 0x1006, "3Com Corporation","14e4:1645","Broadcom Corporation NetXtreme BCM5701 Gigabit Ethernet" },
-{0x10B7, 0x1007, "3Com Corporation","3C556","V.90 Mini-PCI Modem" },
-{0x10B7, 0x1700, "3Com Corporation","3C940","Gigabit Ethernet PCI CODEC" },
-{0x10B7, 0x1F1F, "3Com Corporation","3CRWE777A","AirConnect Wireless LAN PCI Card" },
-{0x10B7, 0x3390, "3Com Corporation","3C339","Token Link Velocity" },
-{0x10B7, 0x3590, "3Com Corporation","3C359","TokenLink Velocity XL Adapter" },
-{0x10B7, 0x4500, "3Com Corporation","3C450","Cyclone" },
-{0x10B7, 0x5055, "3Com Corporation","3C555","Laptop Hurricane" },
-{0x10B7, 0x5057, "3Com Corporation","3C575","Megahertz 10/100 LAN CardBus PC Card" },
-{0x10B7, 0x5157, "3Com Corporation","3C575B","Megahertz 10/100 LAN CardBus PC Card" },
-{0x10B7, 0x5257, "3Com Corporation","3CCFE575CT","Cyclone Fast Ethernet CardBus PC Card" },
-{0x10B7, 0x5900, "3Com Corporation","3C590","Ethernet III Bus Fast PCI" },
-{0x10B7, 0x5920, "3Com Corporation","3C592","PCI/EISA 10Mbps Demon/Vortex" },
-{0x10B7, 0x5950, "3Com Corporation","3COM 3C595-TX","100MB PCI Ethernet Adapter" },
-{0x10B7, 0x5951, "3Com Corporation","3C595","Fast EtherLink PCI T4" },
-{0x10B7, 0x5952, "3Com Corporation","3C595","Fast EtherLink PCI MII" },
-{0x10B7, 0x5970, "3Com Corporation","3C597","PCI/EISA Fast Demon/Vortex" },
-{0x10B7, 0x5B57, "3Com Corporation","3C595","Megahertz 10/100 LAN CardBus" },
-{0x10B7, 0x6055, "3Com Corporation","3C556","10/100 Fast Ethernet MiniPCI Adapter" },
-{0x10B7, 0x6056, "3Com Corporation","3CN3AC1556B","MiniPCI 10/100 Ethernet+Modem56k (see devid:1007)" },
-{0x10B7, 0x6560, "3Com Corporation","3CCFE656","Cyclone CardBus PC Card" },
-{0x10B7, 0x6561, "3Com Corporation","FEM656","10/100 LAN+56K Modem CardBus PC Card" },
-{0x10B7, 0x6562, "3Com Corporation","3CCFEM656","Cyclone CardBus PC Card" },
-{0x10B7, 0x6563, "3Com Corporation","FEM656B","10/100 LAN+56K Modem CardBus PC Card" },
-{0x10B7, 0x6564, "3Com Corporation","3CCFEM656","Cyclone CardBus PC Card" },
-{0x10B7, 0x6565, "3Com Corporation","3CCFEM656C","Global 10/100 Fast Ethernet+56K Modem" },
-{0x10B7, 0x7646, "3Com Corporation","3CSOHO100B-TX","3com" },
-{0x10B7, 0x7770, "3Com Corporation","???","AirConnect Wireless PCI" },
-{0x10B7, 0x8811, "3Com Corporation","","Token Ring" },
-{0x10B7, 0x9000, "3Com Corporation","3C900-TPO","Fast Etherlink PCI TPO NIC" },
-{0x10B7, 0x9001, "3Com Corporation","3C900-COMBO","Fast Etherlink XL PCI Combo NIC" },
-{0x10B7, 0x9004, "3Com Corporation","3C900-TPO","EtherLink XL TPO 10Mb" },
-{0x10B7, 0x9005, "3Com Corporation","3C900B-COMBO","Fast Etherlink 10Mbps Combo NIC" },
-{0x10B7, 0x9006, "3Com Corporation","3C900B-TPC","EtherLink XL TPC" },
-{0x10B7, 0x900A, "3Com Corporation","3C900B-FL","EtherLink PCI Fiber NIC" },
-{0x10B7, 0x9041, "3Com Corporation","3C905-T4","Fast Etherlink XL 10/100" },
-{0x10B7, 0x9050, "3Com Corporation","3C905B - Combo","Fast Etherlink XL PCI 10/100" },
-{0x10B7, 0x9051, "3Com Corporation","3C905-T4","Fast Etherlink XL 10/100" },
-{0x10B7, 0x9055, "3Com Corporation","APCI/pnpb006","Fast Etherlink 10/100 PCI TX NIC" },
-{0x10B7, 0x9056, "3Com Corporation","3C905B-T4","Fast EtherLink XL 10/100" },
-{0x10B7, 0x9058, "3Com Corporation","3C905B-COMBO","Deluxe EtherLink 10/100 PCI Combo NIC" },
-{0x10B7, 0x905A, "3Com Corporation","3C905B-FX","Fast EtherLink 100 Fiber NIC" },
-{0x10B7, 0x9200, "3Com Corporation","3C905 CX-TXM","3Com 10/100 Managed NIC 3C905CX-TX-M" },
-{0x10B7, 0x9201, "3Com Corporation","3C920B-EMB","Integrated Fast Ethernet Controller" },
-{0x10B7, 0x9202, "3Com Corporation","3C920B-EMB","3C920B-EMB 3Com + Realtek 8201L" },
-{0x10B7, 0x9210, "3Com Corporation","3C920B-EMB-WNM","Integrated Fast Ethernet Controller" },
-{0x10B7, 0x9300, "3Com Corporation","3csoho100b-tx","3ComSOHO100B-TX" },
-{0x10B7, 0x9800, "3Com Corporation","3C980-TX","Fast EtherLink XL Server Adapter2" },
-{0x10B7, 0x9805, "3Com Corporation","3C980-TX","Python-T 10/100baseTX NIC" },
-{0x10B7, 0x9876, "3Com Corporation","3C920B-EMB","3C920B-EMB 3Com + Realtek 8201L" },
-{0x10B7, 0x9902, "3Com Corporation","3CR990-TX-95","EtherLink 10/100 PCI with 3XP Processor" },
-{0x10B7, 0x9903, "3Com Corporation","3CR990-TX-97","EtherLink 10/100 PCI with 3XP Processor" },
-{0x10B7, 0x9905, "3Com Corporation","3C990B-FX","100FX PCI Server NIC w/3XP" },
-{0x10B7, 0x9908, "3Com Corporation","3CR990SVR95","EtherLink 10/100 Server PCI with 3XP" },
-{0x10B7, 0x9909, "3Com Corporation","3CR990SVR97","EtherLink 10/100 Server PCI with 3XP" },
-{0x10B7, 0xD004, "3Com Corporation","3C900B-TPO","EtherLink XL PCI" },
-{0x10B8, 0x0005, "Standard Microsystems Corporation","LAN83C170QF/171","EPIC/XF 10/100 Mbps Fast Ethernet Ctrlr" },
-{0x10B8, 0x0006, "Standard Microsystems Corporation","LAN83C175","EPIC/C Ethernet CardBus Integrated Ctrlr" },
-{0x10B8, 0x1000, "Standard Microsystems Corporation","37C665","FDC" },
-{0x10B8, 0x1001, "Standard Microsystems Corporation","37C922","FDC" },
-{0x10B8, 0xA011, "Standard Microsystems Corporation","83C170QF","Fast ethernet controller" },
-{0x10B8, 0xB106, "Standard Microsystems Corporation","SMC34C90","CardBus Controller" },
-{0x10B9, 0x0101, "Ali Corporation","CMI8338/C3DX","PCI Audio Device (OEM)" },
-{0x10B9, 0x0102, "Ali Corporation","CMI8338/C3DX","PCI Audio Device (OEM)" },
-{0x10B9, 0x0111, "Ali Corporation","CMI8738/C3DX","C-Media Audio Device (OEM)" },
-{0x10B9, 0x0780, "Ali Corporation","???","Multi-IO Card" },
-{0x10B9, 0x0782, "Ali Corporation","???","Multi-IO Card" },
-{0x10B9, 0x10b9, "Ali Corporation","ALI M5273 A1","0402t505 CK46828100B" },
-{0x10B9, 0x10CE, "Ali Corporation","5288","cpi" },
-{0x10B9, 0x1435, "Ali Corporation","M1435","VL Bridge" },
-{0x10B9, 0x1445, "Ali Corporation","M1445","CPU to PCI & PCI to ISA Bridge w/EIDE" },
-{0x10B9, 0x1449, "Ali Corporation","M1449","ISA Bridge" },
-{0x10B9, 0x1451, "Ali Corporation","M1451","Pentium CPU to PCI Bridge" },
-{0x10B9, 0x1461, "Ali Corporation","M1461","P54C Chipset" },
-{0x10B9, 0x1489, "Ali Corporation","M1489","486 PCI Chipset" },
-{0x10B9, 0x1511, "Ali Corporation","M1575","Aladdin 2 Host Bridge" },
-{0x10B9, 0x1513, "Ali Corporation","M1513","Aladdin 2 South Bridge" },
-{0x10B9, 0x1521, "Ali Corporation","M1521","Bios" },
-{0x10B9, 0x1523, "Ali Corporation","M1523","ISA Bridge" },
-{0x10B9, 0x1533, "Ali Corporation","M1535+","PCI South Bridge" },
-{0x10B9, 0x1535, "Ali Corporation","M1535x","ISA Bridge" },
-{0x10B9, 0x1541, "Ali Corporation","M1541","Aladdin V AGPset Host Bridge" },
-{0x10B9, 0x1543, "Ali Corporation","M1543 a1","Aladdin V chipset South Bridge" },
-{0x10B9, 0x1561, "Ali Corporation","M1561","North Bridge" },
-{0x10B9, 0x1563, "Ali Corporation","M1563","South Bridge with Hypertransport Support" },
-{0x10B9, 0x1632, "Ali Corporation","M1632","North Bridge" },
-{0x10B9, 0x1641, "Ali Corporation","M1641","CPU to PCI Bridge" },
-{0x10B9, 0x1644, "Ali Corporation","M1644","AGP System Controller" },
-{0x10B9, 0x1646, "Ali Corporation","M1646","AGP System Controller" },
-{0x10B9, 0x1647, "Ali Corporation","M1647","CPU to PCI Bridge" },
-{0x10B9, 0x1651, "Ali Corporation","M1651","CPU to PCI Bridge" },
-{0x10B9, 0x1661, "Ali Corporation","M1661","AGP System Controller" },
-{0x10B9, 0x1667, "Ali Corporation","M1667","AGP System Controller" },
-{0x10B9, 0x1671, "Ali Corporation","M1671","Super P4 Nouth Bridge" },
-{0x10B9, 0x1672, "Ali Corporation","M1672","AGP System Controller" },
-{0x10B9, 0x1681, "Ali Corporation","M1681","P4 Nouth Bridge with HyperTransport" },
-{0x10B9, 0x1687, "Ali Corporation","M1687","K8 North Bridge with HyperTransport" },
-{0x10B9, 0x1849, "Ali Corporation","52871849","02\\3&267A616A" },
-{0x10B9, 0x3141, "Ali Corporation","M3141","GUI Accelerator" },
-{0x10B9, 0x3143, "Ali Corporation","M3143","GUI Accelerator" },
-{0x10B9, 0x3145, "Ali Corporation","M3145","GUI Accelerator" },
-{0x10B9, 0x3147, "Ali Corporation","M3147","GUI Accelerator" },
-{0x10B9, 0x3149, "Ali Corporation","M3149","GUI Accelerator" },
-{0x10B9, 0x3151, "Ali Corporation","M3151","GUI Accelerator" },
-{0x10B9, 0x3307, "Ali Corporation","M3307","MPEG-1 Decoder" },
-{0x10B9, 0x3309, "Ali Corporation","M3309","MPEG Decoder" },
-{0x10B9, 0x5212, "Ali Corporation","M4803","" },
-{0x10B9, 0x5215, "Ali Corporation","MS4803","EIDE Ctrlr" },
-{0x10B9, 0x5217, "Ali Corporation","m5217h","I/O (?)" },
-{0x10B9, 0x5219, "Ali Corporation","PCI\\VEN_10B9&DEV_5451&CC_040100","Ali M5219 PCI BUS MASTER IDE Controller" },
-{0x10B9, 0x5225, "Ali Corporation","M5225","IDE Controller" },
-{0x10B9, 0x5228, "Ali Corporation","M1563","M5228 PATA/RAID Controller" },
-{0x10B9, 0x5229, "Ali Corporation","M5229 Southbridge","EIDE Controller" },
-{0x10B9, 0x5235, "Ali Corporation","M1621","ALI M6503c" },
-{0x10B9, 0x5236, "Ali Corporation","M5273","EHCI USB 2.0" },
-{0x10B9, 0x5237, "Ali Corporation","M5273 A1 for windows 2000","OpenHCI 1.1 USB to  2.0" },
-{0x10B9, 0x5239, "Ali Corporation","523910A9","USB EHCI2.0 Controller" },
-{0x10B9, 0x5249, "Ali Corporation","M5249","HyperTransport to PCI Bridge" },
-{0x10B9, 0x5251, "Ali Corporation","M5251","IEEE P1394 OpenHCI 1.0 Controller" },
-{0x10B9, 0x5253, "Ali Corporation","M5253","IEEE P1394 OpenHCI 1.0 Controller" },
-{0x10B9, 0x5261, "Ali Corporation","M5261","Ethernet Controller" },
-{0x10B9, 0x5263, "Ali Corporation","Albatron K8ULTRA-U Pro","ULi PCI Fast Ethernet Controller" },
-{0x10B9, 0x528, "Ali Corporation","52871849","02\\3&267A616A" },
-{0x10B9, 0x5281, "Ali Corporation","M1565/1566","ALI M5281/5283  SATA/RAID Controller" },
-{0x10B9, 0x5286, "Ali Corporation","52291849","Realtek PCIE CardReader" },
-{0x10B9, 0x5287, "Ali Corporation","ULI M1573","SATA/Raid controller" },
-{0x10B9, 0x5288, "Ali Corporation","ULI M1575/M1697 ","M5288 SATA/Raid controller (Asrock 939SLI32-eSata2)" },
-{0x10B9, 0x5289, "Ali Corporation","ULI M1567/M1689 ","M5289 SATA/Raid controller" },
-{0x10B9, 0x5450, "Ali Corporation","65525","Agere Systems AC97 Modem" },
-{0x10B9, 0x5451, "Ali Corporation","M5451","Ali Audio Accelerator" },
-{0x10B9, 0x5455, "Ali Corporation","M1563M Southbridge","AC'97 Audio Controller" },
-{0x10B9, 0x5457, "Ali Corporation","M1563M","AC97 Modem controller" },
-{0x10B9, 0x5459, "Ali Corporation","MDV92XP NetoDragon","PCI Soft Modem V92 NetoDragon" },
-{0x10B9, 0x5461, "Ali Corporation","M5461","High Definition Audio Controller" },
-{0x10B9, 0x5471, "Ali Corporation","M1563M Southbridge","Memory Stick Host" },
-{0x10B9, 0x5473, "Ali Corporation","M1563M Southbridge","MMC/SD controller" },
-{0x10B9, 0x7101, "Ali Corporation","M7101","Power Management Controller" },
-{0x10B9, 0x7471, "Ali Corporation","M1563M Southbridge","Memory Stick Host" },
-{0x10B9, 0x9876, "Ali Corporation","mdv92xp","xhcth700000b" },
-{0x10BA, 0x0304, "Mitsubishi Electronics Corp.","","GUI Accelerator" },
-{0x10BD, 0x0803, "Surecom Technology"," MYSON Technology Inc SURECOM EP-320X-S 100/10M Et","Ethernet PCI Adapter" },
-{0x10BD, 0x0E34, "Surecom Technology","NE34","Ethernet Adapter (NE2000 PCI clone)" },
-{0x10BD, 0x5240, "Surecom Technology","0055","IDE Cntrlr" },
-{0x10BD, 0x5241, "Surecom Technology","8086","PCMCIA Bridge" },
-{0x10BD, 0x5242, "Surecom Technology","","General Purpose Cntrlr" },
-{0x10BD, 0x5243, "Surecom Technology","00000000","Bus Cntrlr" },
-{0x10BD, 0x5244, "Surecom Technology","","FCD Cntrlr" },
-{0x10BD, 0x8136, "Surecom Technology","Unkown","Unkown" },
-{0x10BD, 0x8139, "Surecom Technology","surecom EP-320X-R adapter with realtek 8139c chip","realtek 8139c" },
-{0x10C3, 0x8920, "Samsung Semiconductors","5335fn800829","MCP67 High Definition Audio " },
-{0x10C3, 0x8925, "Samsung Semiconductors","","" },
-{0x10C4, 0x8363, "Award Software Int'l Inc.","s/n124102160","10C4" },
-{0x10C4, 0xEA60, "Award Software Int'l Inc.","CP210x","Silicon Labs CP210x USB to UART Bridge" },
-{0x10C8, 0x0000, "Neomagic Corporation","NM2097","Graphics Cntrlr" },
-{0x10C8, 0x0003, "Neomagic Corporation","NM2093","MagicGraph 128ZV Video Controller" },
-{0x10C8, 0x0004, "Neomagic Corporation","NM2160","MagicGraph 128XD" },
-{0x10C8, 0x0005, "Neomagic Corporation","NM2200","MagicMedia 256AV" },
-{0x10C8, 0x0006, "Neomagic Corporation","NM2360","MagicMedia 256ZX/256M6D" },
-{0x10C8, 0x0016, "Neomagic Corporation","NM2380","MagicMedia 256XL+" },
-{0x10C8, 0x0025, "Neomagic Corporation","NM2230","MagicMedia 256AV+" },
-{0x10C8, 0x0083, "Neomagic Corporation","NM2097","Graphic Controller NeoMagic MagicGraph128ZV+" },
-{0x10C8, 0x8005, "Neomagic Corporation","NM2200","MagicMedia 256AV Audio Device" },
-{0x10C8, 0x8006, "Neomagic Corporation","NM2360","MagicMedia 256ZX Audio Device" },
-{0x10C8, 0x8016, "Neomagic Corporation","NM2380","MagicMedia 256XL+ Audio Device" },
-{0x10CA, 0x9876, "Fujitsu Siemens","ROOT\\MEDIA\\0000","PCI\\VEN_1217&DEV_7110&SUBSYS_106A1734&REV_00" },
-{0x10CD, 0x1100, "Advanced System Products","ASC1100","PCI SCSI Host Adapter" },
-{0x10CD, 0x1200, "Advanced System Products","ASC1200","Fast SCSI-II" },
-{0x10CD, 0x1300, "Advanced System Products","ABP-3925","ABP-3925" },
-{0x10CD, 0x2300, "Advanced System Products","F914C536","PCI Ultra Wide SCSI Host Adapter" },
-{0x10CD, 0x2500, "Advanced System Products","ASC38C0800/1600","PCI Ultra 80/160 SCSI Controllers" },
-{0x10CD, 0x4000, "Advanced System Products","ASC30C0400","IEEE-1394 OHCI PCI Controller" },
-{0x10CF, 0x10C5, "Fujitsu Ltd.","FMV-103","Serial Parallel Card" },
-{0x10CF, 0x2001, "Fujitsu Ltd.","MB86605","PCI SCSI Host Adapter (Fast Wide SCSI-2)" },
-{0x10CF, 0x2002, "Fujitsu Ltd.","MB86606","Fast Wide SCSI Controller" },
-{0x10CF, 0x2005, "Fujitsu Ltd.","MB86974","10/100 Fast Ethernet Adapter" },
-{0x10CF, 0x200C, "Fujitsu Ltd.","MB86974","IEEE1394 OpenHCI Controller" },
-{0x10CF, 0x2010, "Fujitsu Ltd.","","OHCI FireWire Controller" },
-{0x10CF, 0x2011, "Fujitsu Ltd.","12711718","MPEG2 R-Engine (MPEG2 Hardware Encoder)" },
-{0x10CF, 0x2019, "Fujitsu Ltd.","MB86295","Coral-P Graphics Chip" },
-{0x10CF, 0x201E, "Fujitsu Ltd.","MB86296","Coral-PA Graphics Chip" },
-{0x10CF, 0x202A, "Fujitsu Ltd.","u/k","u/k" },
-{0x10CF, 0x202B, "Fujitsu Ltd.","mb86297","Carmine Graphisc adapter" },
-{0x10D6, 0xFF51, "Wilson .co .ltd","0x0100","ATJ2091N" },
-{0x10D6, 0xff66, "Wilson .co .ltd","0x0100","ATJ2091N" },
-{0x10D9, 0x0066, "Macronix International Co. Ltd.","MX86101P","sdas" },
-{0x10D9, 0x0512, "Macronix International Co. Ltd.","MX98713","Fast Ethernet Adapter" },
-{0x10D9, 0x0531, "Macronix International Co. Ltd.","MX98715/25","Single Chip Fast Ethernet NIC Controller" },
-{0x10D9, 0x0532, "Macronix International Co. Ltd.","MX98723/727","PCI/CardBus Fast Ethernet Controller" },
-{0x10D9, 0x0553, "Macronix International Co. Ltd.","MX987x5","Ethernet Adapter" },
-{0x10D9, 0x8625, "Macronix International Co. Ltd.","MX86250","xiankasqudong" },
-{0x10D9, 0x8626, "Macronix International Co. Ltd.","MX86251","PCI\\VEN_10D9&DEV_8626&SUBSYS_00000000&REV_00\\4&1F7DBC9F&0&08F0 " },
-{0x10D9, 0x8627, "Macronix International Co. Ltd.","MX86251FC","Voodoo Rush MX86251" },
-{0x10D9, 0x8888, "Macronix International Co. Ltd.","MX86250","9619E" },
-{0x10D9, 0xC115, "Macronix International Co. Ltd.","lc82c115"," Linksys LNE100TX " },
-{0x10DC, 0x0001, "CERN-European Lab. for Particle Physics","STAR/RD24","PCI-SCI  PMC  mezzanine" },
-{0x10DC, 0x0002, "CERN-European Lab. for Particle Physics","ATT 2C15-3 (FPGA)","SCI bridge  on PCI 5 Volt card" },
-{0x10DC, 0x0004, "CERN-European Lab. for Particle Physics","EP20S780","ALTERA STRATIX" },
-{0x10DC, 0x0010, "CERN-European Lab. for Particle Physics","680-1110-150/400","Simple PMC/PCI to S-LINK interface" },
-{0x10DC, 0x0011, "CERN-European Lab. for Particle Physics","680-1110-200/450","Simple S-LINK to PMC/PCI interface" },
-{0x10DC, 0x0012, "CERN-European Lab. for Particle Physics","S32PCI64","32-bit S-LINK to 64-bit PCI interface" },
-{0x10DC, 0x0021, "CERN-European Lab. for Particle Physics","","HIPPI destination" },
-{0x10DC, 0x0022, "CERN-European Lab. for Particle Physics","","HIPPI source" },
-{0x10DC, 0x0033, "CERN-European Lab. for Particle Physics","EP20KE (APEX-FPGA)","ALICE DDL to  PCI interface (RORC)" },
-{0x10DC, 0x0101, "CERN-European Lab. for Particle Physics","SL651 7057 C200","Acquisition card for the SPS Orbit System (MACI)" },
-{0x10DC, 0x016A, "CERN-European Lab. for Particle Physics","XC4VFX100","CALICE ODR" },
-{0x10DC, 0x10DC, "CERN-European Lab. for Particle Physics","ATT 2C15-3 (FPGA)","TTC sr   first TTC chip receiver PMC" },
-{0x10DC, 0x301, "CERN-European Lab. for Particle Physics","PLX PCI 9030","based on the PLX PCI 9030 to build a MIL1553 bus interface" },
-{0x10DC, 0x324, "CERN-European Lab. for Particle Physics","PLX PCI96556","64 Bit/66MHz PCI to Local Bus Bridge" },
-{0x10DC, 0x8086, "CERN-European Lab. for Particle Physics","a002","geodelink pci south" },
-{0x10DD, 0x0001, "Evans & Sutherland","","3D graphics processor" },
-{0x10DE, 0x04EF, "NVIDIA","NV3","Riva 128" },
-{0x10DE, 0x0001, "NVIDIA","Lucent 0x00da","SoundMAX Integrated Digital Audio" },
-{0x10DE, 0x0002, "NVIDIA","0x0002","HDMI Audio Driver Driver" },
-{0x10DE, 0x0003, "NVIDIA","It seems to be Realtek ALC888/9","nVIDIA High Definition Audio/HDMI " },
-{0x10DE, 0x0006, "NVIDIA","Realtek","realtek based HD Audio" },
-{0x10DE, 0x0008, "NVIDIA","NV1","Edge 3D" },
-{0x10DE, 0x0009, "NVIDIA","NV1","Edge 3D" },
-{0x10DE, 0x000B, "NVIDIA","7025","HDMI Audio Driver Driver 1.00.00.59" },
-{0x10DE, 0x0010, "NVIDIA","NV2","Mutara V08" },
-{0x10DE, 0x0011, "NVIDIA","Various - see list on site","NVIDIA High Def Audio" },
-{0x10DE, 0x0018, "NVIDIA","NV3","Riva 128" },
-{0x10DE, 0x0019, "NVIDIA","NV3","Riva 128ZX" },
-{0x10DE, 0x001D, "NVIDIA","NV35","nVidia GeForce FX 5900XT" },
-{0x10DE, 0x0020, "NVIDIA","GTX680M","NVIDIA RIVA TNT" },
-{0x10DE, 0x0028, "NVIDIA","NVIDIA GeForce 635M","ACPI\\NSC1200" },
-{0x10DE, 0x0029, "NVIDIA","NV05","NVIDIA RIVA TNT 2 Ultra" },
-{0x10DE, 0x002A, "NVIDIA","0df4","TNT2" },
-{0x10DE, 0x002B, "NVIDIA","NV5","Riva TNT2" },
-{0x10DE, 0x002C, "NVIDIA","NV05","NVIDIA Vanta/Vanta LT" },
-{0x10DE, 0x002D, "NVIDIA","NV05","NVIDIA RIVA TNT2 Model 64/Model 64 AGP 32M" },
-{0x10DE, 0x002E, "NVIDIA","NV6","VANTA" },
-{0x10DE, 0x002F, "NVIDIA","NV6","VANTA" },
-{0x10DE, 0x0035, "NVIDIA","MCP04","MCP04 PATA Controller" },
-{0x10DE, 0x0036, "NVIDIA","MCP04","MCP04 SATA/RAID Controller" },
-{0x10DE, 0x003E, "NVIDIA","MCP04","MCP04 SATA/RAID Controller" },
-{0x10DE, 0x0040, "NVIDIA","NV40","NVIDIA GeForce 6800 Ultra" },
-{0x10DE, 0x0041, "NVIDIA","NV40","NVIDIA GeForce 6800" },
-{0x10DE, 0x0042, "NVIDIA","NV40","NVIDIA GeForce 6800 LE" },
-{0x10DE, 0x0043, "NVIDIA","NV40","NVIDIA GeForce 6800 XE" },
-{0x10DE, 0x0044, "NVIDIA","NV40","NVIDIA GeForce 6800 XT" },
-{0x10DE, 0x0045, "NVIDIA","NV40","NVIDIA GeForce 6800 GT" },
-{0x10DE, 0x0046, "NVIDIA","NV45","NVIDIA GeForce 6800 GT" },
-{0x10DE, 0x0047, "NVIDIA","NV40","NVIDIA GeForce 6800 GS" },
-{0x10DE, 0x0048, "NVIDIA","NV40","NVIDIA GeForce 6800 XT" },
-{0x10DE, 0x0049, "NVIDIA","NV40","NVIDIA NV40GL" },
-{0x10DE, 0x004D, "NVIDIA","NV40","NVIDIA Quadro FX 3400" },
-{0x10DE, 0x004E, "NVIDIA","NV40","NVIDIA Quadro FX 4000" },
-{0x10DE, 0x0052, "NVIDIA","NV06","NVIDIA nForce PCI System Management" },
-{0x10DE, 0x0053, "NVIDIA","CK804","CK804 PATA Controller" },
-{0x10DE, 0x0054, "NVIDIA","CK804","CK804 SATA/RAID Controller" },
-{0x10DE, 0x0055, "NVIDIA","CK804","CK804 SATA/RAID Controller" },
-{0x10DE, 0x0057, "NVIDIA","CK804","NVIDIA Network Bus Enumerator" },
-{0x10DE, 0x0059, "NVIDIA","sdsd","nForce Audio Controller" },
-{0x10DE, 0x005E, "NVIDIA","nForce4","nForce4 HyperTransport Bridge" },
-{0x10DE, 0x0060, "NVIDIA","MCP68","PCI to ISA Bridge" },
-{0x10DE, 0x0064, "NVIDIA","MCP","SMBus Controller" },
-{0x10DE, 0x0065, "NVIDIA","nForce MCP2/MCP2-T/MCP2-U","PATA Controller" },
-{0x10DE, 0x0066, "NVIDIA","nForce MCP2","nForce 2 Networking Controller" },
-{0x10DE, 0x0067, "NVIDIA","MCP2","Nvidia 7050 chipset HDMI Audio" },
-{0x10DE, 0x0068, "NVIDIA","MCP2","EHCI USB 2.0 Controller" },
-{0x10DE, 0x006A, "NVIDIA","MCP2s","nForce AC97s" },
-{0x10DE, 0x006B, "NVIDIA","nForce MCP-T?","Audio Processing Unit (Dolby Digital)" },
-{0x10DE, 0x006C, "NVIDIA","nForce","PCI to PCI Bridge" },
-{0x10DE, 0x006D, "NVIDIA","nForce MCP-T","Audio Codec Interface" },
-{0x10DE, 0x006E, "NVIDIA","nForce MCP2","OHCI Compliant IEEE 1394 Controller" },
-{0x10DE, 0x0085, "NVIDIA","MCP2S","MCP2S PATA Controller" },
-{0x10DE, 0x008C, "NVIDIA","RLT8201BL","Single-Port 10/100M Fast Ethernet PHYceiver" },
-{0x10DE, 0x008E, "NVIDIA","MCP2S","MCP2S SATA/RAID Controller" },
-{0x10DE, 0x0090, "NVIDIA","G70","NVIDIA GeForce 7800 GTX" },
-{0x10DE, 0x0091, "NVIDIA","G70","NVIDIA GeForce 7800 GTX" },
-{0x10DE, 0x0092, "NVIDIA","G70","NVIDIA GeForce 7800 GT" },
-{0x10DE, 0x0093, "NVIDIA","G70","NVIDIA GeForce 7800 GS" },
-{0x10DE, 0x0094, "NVIDIA","G70","NVIDIA GeForce 7800SE/XT/LE/LT/ZT" },
-{0x10DE, 0x0095, "NVIDIA","G70","NVIDIA GeForce 7800 SLI" },
-{0x10DE, 0x0098, "NVIDIA","G70","NVIDIA GeForce Go 7800" },
-{0x10DE, 0x0099, "NVIDIA","G70","NVIDIA GeForce Go 7800 GTX" },
-{0x10DE, 0x009C, "NVIDIA","G70","NVIDIA Quadro FX 350M" },
-{0x10DE, 0x009D, "NVIDIA","G70","NVIDIA Quadro FX 4500" },
-{0x10DE, 0x009E, "NVIDIA","G70","NVIDIA G70GL" },
-{0x10DE, 0x00A0, "NVIDIA","NV10de","Aladdin TNT2" },
-{0x10DE, 0x00C0, "NVIDIA","NV41","NVIDIA GeForce 6800 GS" },
-{0x10DE, 0x00C1, "NVIDIA","NV41","NVIDIA GeForce 6800" },
-{0x10DE, 0x00C2, "NVIDIA","NV41","NVIDIA GeForce GTX670M" },
-{0x10DE, 0x00C3, "NVIDIA","NV41","NVIDIA GeForce 6800 XT" },
-{0x10DE, 0x00C8, "NVIDIA","NV41.8","NVIDIA GeForce Go 6800" },
-{0x10DE, 0x00C9, "NVIDIA","NV41","NVIDIA GeForce Go 6800 Ultra" },
-{0x10DE, 0x00CC, "NVIDIA","NV41","NVIDIA Quadro FX Go 1400" },
-{0x10DE, 0x00CD, "NVIDIA","NV41","NVIDIA Quadro FX 3450/4000 SDI" },
-{0x10DE, 0x00CE, "NVIDIA","NV41","NVIDIA Quadro FX 1400" },
-{0x10DE, 0x00D0, "NVIDIA","nForce 3","LPC Bridge" },
-{0x10DE, 0x00D1, "NVIDIA","nForce 3","Host Bridge" },
-{0x10DE, 0x00D2, "NVIDIA","nForce 3?","PCI-to-PCI Bridge" },
-{0x10DE, 0x00D4, "NVIDIA","MCP2","SMBus Controller" },
-{0x10DE, 0x00D5, "NVIDIA","nForce3-150","CK8 PATA 133/PATA to SATA Bridge" },
-{0x10DE, 0x00D6, "NVIDIA","MCP3","nForce 3 Networking Controller" },
-{0x10DE, 0x00D7, "NVIDIA","nForce MCP3?","OpenHCD USB Host Controller" },
-{0x10DE, 0x00D8, "NVIDIA","nForce MCP3?","Enhanced PCI to USB Host Controller" },
-{0x10DE, 0x00D9, "NVIDIA","nForce 3","Agere System PCI Soft Modem" },
-{0x10DE, 0x00DA, "NVIDIA","MCP3","AC97 Audio Controller" },
-{0x10DE, 0x00DD, "NVIDIA","nForce MCP3?","PCI-to-PCI Bridge" },
-{0x10DE, 0x00DF, "NVIDIA","MCP73","nForce3 Networking Controller" },
-{0x10DE, 0x00E0, "NVIDIA","nForce3 250","LPC Interface Bridge" },
-{0x10DE, 0x00E1, "NVIDIA","nForce3 250","Host/PCI Bridge" },
-{0x10DE, 0x00E2, "NVIDIA","nForce 8400 M","AGP Host to PCI Bridge" },
-{0x10DE, 0x00E3, "NVIDIA","nForce 250","CK8S SATA/RAID Controller" },
-{0x10DE, 0x00E4, "NVIDIA","nForce3 200","PCI System Management" },
-{0x10DE, 0x00E5, "NVIDIA","nForce3 250","Parallel ATA Controller" },
-{0x10DE, 0x00E7, "NVIDIA","nForce3 250","OpenHCD USB Controller" },
-{0x10DE, 0x00E8, "NVIDIA","nForce3 250","Enhanced PCI to USB Controller" },
-{0x10DE, 0x00EA, "NVIDIA","nForce3 250 ","Audio Codec Interface (Realtek ALC658)" },
-{0x10DE, 0x00ED, "NVIDIA","nForce gt 220","PCI-PCI Bridge" },
-{0x10DE, 0x00EE, "NVIDIA","nForce 250","CK8S SATA/RAID Controller" },
-{0x10DE, 0x00F0, "NVIDIA","BR02","NVIDIA Device" },
-{0x10DE, 0x00F1, "NVIDIA","BR02","NVIDIA GeForce 6600 GT" },
-{0x10DE, 0x00F2, "NVIDIA","BR02","NVIDIA GeForce 6600" },
-{0x10DE, 0x00F3, "NVIDIA","BR02","NVIDIA GeForce 6200" },
-{0x10DE, 0x00F4, "NVIDIA","BR02","NVIDIA GeForce 6600 gt" },
-{0x10DE, 0x00F5, "NVIDIA","BR02","NVIDIA GeForce 7800 GS" },
-{0x10DE, 0x00F6, "NVIDIA","BR02","NVIDIA GeForce 6800 GS/XT" },
-{0x10DE, 0x00F8, "NVIDIA","BR02","NVIDIA Quadro FX 3400/4400" },
-{0x10DE, 0x00F9, "NVIDIA","BR02","NVIDIA GeForce 6800 Series GPU" },
-{0x10DE, 0x00FA, "NVIDIA","BR02","NVIDIA GeForce PCX 5750" },
-{0x10DE, 0x00FB, "NVIDIA","BR02","NVIDIA GeForce PCX 5900" },
-{0x10DE, 0x00FC, "NVIDIA","BR02","NVIDIA GeForce PCX 5300" },
-{0x10DE, 0x00FD, "NVIDIA","BR02","NVIDIA Quadro PCI-E Series" },
-{0x10DE, 0x00FE, "NVIDIA","BR02","NVIDIA Quadro FX 1300" },
-{0x10DE, 0x00FF, "NVIDIA","BR02","NVIDIA GeForce PCX 4300" },
-{0x10DE, 0x0100, "NVIDIA","NV10","HDAUDIO\\FUNC_01&VEN_10EC&DEV_0269&SUBSYS_11790644&REV_1002\\4&1422899C&0&0001" },
-{0x10DE, 0x0101, "NVIDIA","NV10","NVIDIA GeForce DDR" },
-{0x10DE, 0x0102, "NVIDIA","NV10","GeForce 256 Ultra" },
-{0x10DE, 0x0103, "NVIDIA","NV10","NVIDIA Quadro" },
-{0x10DE, 0x0110, "NVIDIA","NV12","NVIDIA GeForce2 MX/MX 400" },
-{0x10DE, 0x0111, "NVIDIA","NV11","NVIDIA GeForce2 MX 100/200" },
-{0x10DE, 0x0112, "NVIDIA","NV9","NVIDIA GeForce 9800gt" },
-{0x10DE, 0x0113, "NVIDIA","NV11","NVIDIA Quadro2 MXR/EX" },
-{0x10DE, 0x0140, "NVIDIA","NV43","NVIDIA GeForce 6600 GT" },
-{0x10DE, 0x0141, "NVIDIA","NV43","nVIDIA GeForce 6600 PCI-E Video Adapter" },
-{0x10DE, 0x0142, "NVIDIA","NV43","NVIDIA GeForce 6600 LE" },
-{0x10DE, 0x0143, "NVIDIA","NV43","NVIDIA GeForce 6600 VE" },
-{0x10DE, 0x0144, "NVIDIA","NV43","NVIDIA GeForce Go 6600" },
-{0x10DE, 0x0145, "NVIDIA","NV43","NVIDIA GeForce 6610 XL" },
-{0x10DE, 0x0146, "NVIDIA","NV43","NVIDIA GeForce Go 6200 TE/6600 TE" },
-{0x10DE, 0x0147, "NVIDIA","NV43","NVIDIA GeForce 6700 XL" },
-{0x10DE, 0x0148, "NVIDIA","NV43","NVIDIA GeForce Go 6600" },
-{0x10DE, 0x0149, "NVIDIA","NV43","NVIDIA GeForce Go 6600 GT" },
-{0x10DE, 0x014A, "NVIDIA","NV43","NVIDIA Quadro NVS 440" },
-{0x10DE, 0x014B, "NVIDIA","NV43","NVIDIA NV43" },
-{0x10DE, 0x014C, "NVIDIA","NV43","NVIDIA Quadro FX 540M" },
-{0x10DE, 0x014D, "NVIDIA","NV43","NVIDIA Quadro FX 550" },
-{0x10DE, 0x014E, "NVIDIA","NV43","NVIDIA Quadro FX 540" },
-{0x10DE, 0x014F, "NVIDIA","NV43","NVIDIA GeForce 6200 go" },
-{0x10DE, 0x0150, "NVIDIA","NV15","NVIDIA GeForce2 GTS/GeForce2 Pro" },
-{0x10DE, 0x0151, "NVIDIA","NV15","NVIDIA GeForce2 Ti" },
-{0x10DE, 0x0152, "NVIDIA","NV15","NVIDIA GeForce2 Ultra" },
-{0x10DE, 0x0153, "NVIDIA","NV15","NVIDIA Quadro2 Pro" },
-{0x10DE, 0x016, "NVIDIA","1","1" },
-{0x10DE, 0x0160, "NVIDIA","NV44","NVIDIA GeForce 6500 " },
-{0x10DE, 0x0161, "NVIDIA","NV44","NVIDIA GeForce 6200 TurboCache(TM)" },
-{0x10DE, 0x0162, "NVIDIA","NV44","NVIDIA GeForce 6200SE TurboCache(TM)" },
-{0x10DE, 0x0163, "NVIDIA","NV44","NVIDIA GeForce 6200 LE" },
-{0x10DE, 0x0164, "NVIDIA","NV44","NVIDIA NV44" },
-{0x10DE, 0x0165, "NVIDIA","NV44","NVIDIA Quadro NVS 285" },
-{0x10DE, 0x0166, "NVIDIA","NV44","NVIDIA GeForce Go 6250" },
-{0x10DE, 0x0167, "NVIDIA","NV44","NVIDIA GeForce Go 6200" },
-{0x10DE, 0x0168, "NVIDIA","NV44","NVIDIA GeForce Go 6400" },
-{0x10DE, 0x0169, "NVIDIA","NV44","NVIDIA GeForce 6250" },
-{0x10DE, 0x016a, "NVIDIA","NV44","NVIDIA GeForce 7100 GS" },
-{0x10DE, 0x016B, "NVIDIA","NV44","NVIDIA NV44GLM" },
-{0x10DE, 0x016C, "NVIDIA","NV44","NVIDIA NV44GLM" },
-{0x10DE, 0x016D, "NVIDIA","NV44","NVIDIA NV44GLM" },
-{0x10DE, 0x016E, "NVIDIA","NV44","NVIDIA NV44GL" },
-{0x10DE, 0x0170, "NVIDIA","NV17","NVIDIA GeForce4 MX 460" },
-{0x10DE, 0x0171, "NVIDIA","NV17","NVIDIA GeForce4 MX 440 with AGP 4X 64mb" },
-{0x10DE, 0x0172, "NVIDIA","NV17","NVIDIA GeForce4 MX 420" },
-{0x10DE, 0x0173, "NVIDIA","NV17","NVIDIA GeForce4 MX 440-SE" },
-{0x10DE, 0x0174, "NVIDIA","NV17","NVIDIA GeForce4 MX 440 Go" },
-{0x10DE, 0x0175, "NVIDIA","NV17","NVIDIA GeForce4 MX 420 Go" },
-{0x10DE, 0x0176, "NVIDIA","NV17","NVIDIA GeForce4 MX 420 Go 32M" },
-{0x10DE, 0x0177, "NVIDIA","NV17","NVIDIA GeForce4 460 Go" },
-{0x10DE, 0x0178, "NVIDIA","NV17","NVIDIA Quadro4 550 XGL" },
-{0x10DE, 0x0179, "NVIDIA","NV17.2","NVIDIA GeForce4 MX 440 Go 64M" },
-{0x10DE, 0x017A, "NVIDIA","NV17","NVIDIA Quadro NVS" },
-{0x10DE, 0x017B, "NVIDIA","NV17GL.3","Quadro4 550 XGL" },
-{0x10DE, 0x017C, "NVIDIA","NV17","NVIDIA Quadro4 500 Go GL" },
-{0x10DE, 0x017D, "NVIDIA","NV17","NVIDIA GeForce4 410 Go 16M" },
-{0x10DE, 0x0181, "NVIDIA","NV18","NVIDIA GeForce4 MX 440 with AGP8X" },
-{0x10DE, 0x0182, "NVIDIA","NV18","NVIDIA GeForce4 MX 440SE with AGP8X" },
-{0x10DE, 0x0183, "NVIDIA","NV18","NVIDIA GeForce4 MX 420 with AGP8X" },
-{0x10DE, 0x0185, "NVIDIA","NV18","NVIDIA GeForce4 MX 4000 128 mb 64 bit" },
-{0x10DE, 0x0186, "NVIDIA","NV18","NVIDIA GeForce4 448 Go" },
-{0x10DE, 0x0187, "NVIDIA","NV18","NVIDIA GeForce4000 Go" },
-{0x10DE, 0x0188, "NVIDIA","NV18","NVIDIA Quadro4 580 XGL" },
-{0x10DE, 0x018A, "NVIDIA","NV18","NVIDIA Quadro NVS with AGP8X" },
-{0x10DE, 0x018B, "NVIDIA","NV18","NVIDIA Quadro4 380 XGL" },
-{0x10DE, 0x018C, "NVIDIA","NV18","NVIDIA Quadro NVS 50 PCI" },
-{0x10DE, 0x018D, "NVIDIA","NV18","NVIDIA GeForce4 448 Go" },
-{0x10DE, 0x0191, "NVIDIA","G80","NVIDIA GeForce 8800 GTX" },
-{0x10DE, 0x0193, "NVIDIA","G80","NVIDIA GeForce 8800 GTS" },
-{0x10DE, 0x0194, "NVIDIA","G80","NVIDIA GeForce 8800 Ultra" },
-{0x10DE, 0x0197, "NVIDIA","G80","NVIDIA Tesla C870" },
-{0x10DE, 0x019D, "NVIDIA","G80","NVIDIA Quadro FX 5600" },
-{0x10DE, 0x019E, "NVIDIA","G80","NVIDIA Quadro FX 4600" },
-{0x10DE, 0x01A0, "NVIDIA","CR11","NVIDIA GeForce2 Integrated GPU" },
-{0x10DE, 0x01A4, "NVIDIA","nForce","AGP Controller" },
-{0x10DE, 0x01A5, "NVIDIA","nForce","AGP Controller" },
-{0x10DE, 0x01A6, "NVIDIA","nForce","AGP Controller" },
-{0x10DE, 0x01A8, "NVIDIA","nForce 210","Memory Controller (SDR) ddr3" },
-{0x10DE, 0x01A9, "NVIDIA","nForce 420","Memory Controller (SDR)" },
-{0x10DE, 0x01AA, "NVIDIA","nForce 220/230","Memory Controller (DDR)" },
-{0x10DE, 0x01AB, "NVIDIA","nForce 415/420/430","Memory Controller (DDR)" },
-{0x10DE, 0x01AC, "NVIDIA","nForce 2x0/415/4x0","Memory Controller" },
-{0x10DE, 0x01AD, "NVIDIA","nForce 2x0/415/4x0","Memory Controller" },
-{0x10DE, 0x01B0, "NVIDIA","MCP73","nForce Dolby Digital Audio Controller" },
-{0x10DE, 0x01B1, "NVIDIA","MCP3","nForce AC'97 Audio Controller" },
-{0x10DE, 0x01B2, "NVIDIA","nForce","HUB Interface" },
-{0x10DE, 0x01B4, "NVIDIA","MCP","nForce 1/2 SMBus Controller" },
-{0x10DE, 0x01B7, "NVIDIA","nForce","AGP Bridge" },
-{0x10DE, 0x01B8, "NVIDIA","nForce","PCI Bridge" },
-{0x10DE, 0x01BC, "NVIDIA","MCP","nForce IDE/ATA Controller" },
-{0x10DE, 0x01C1, "NVIDIA","nForce MCP","AC97 Modem" },
-{0x10DE, 0x01C2, "NVIDIA","MCP","OHCI USB Controller" },
-{0x10DE, 0x01C3, "NVIDIA","MCP73 ethernet","nForce Networking Controller" },
-{0x10DE, 0x01D0, "NVIDIA","G72","NVIDIA GeForce 7350 LE" },
-{0x10DE, 0x01D1, "NVIDIA","G72","NVIDIA GeForce 7300 LE" },
-{0x10DE, 0x01D2, "NVIDIA","G72","NVIDIA GeForce 7550 LE" },
-{0x10DE, 0x01D3, "NVIDIA","GS7200","NVIDIA GeForce 7300 SE/7200 GS" },
-{0x10DE, 0x01D5, "NVIDIA","G72","NVIDIA GeForce 7300 LE" },
-{0x10DE, 0x01D7, "NVIDIA","G72","NVIDIA GeForce Go 7300" },
-{0x10DE, 0x01D8, "NVIDIA","G72","NVIDIA GeForce Go 7400" },
-{0x10DE, 0x01DB, "NVIDIA","G72","NVIDIA Quadro NVS 120M" },
-{0x10DE, 0x01DC, "NVIDIA","G72","NVIDIA Quadro FX 350M" },
-{0x10DE, 0x01DD, "NVIDIA","G72","NVIDIA GeForce 7500 LE" },
-{0x10DE, 0x01DE, "NVIDIA","G72","NVIDIA Quadro FX 350" },
-{0x10DE, 0x01DF, "NVIDIA","G72","NVIDIA GeForce 7300 GS" },
-{0x10DE, 0x01E0, "NVIDIA","nForce2","AGP Controller" },
-{0x10DE, 0x01E1, "NVIDIA","nForce2","AGP Controller" },
-{0x10DE, 0x01E8, "NVIDIA","nForce2","AGP Host to PCI Bridge" },
-{0x10DE, 0x01EA, "NVIDIA","nForce2","Memory Controller 0" },
-{0x10DE, 0x01EB, "NVIDIA","nForce2","Memory Controller 1" },
-{0x10DE, 0x01EC, "NVIDIA","nForce2","Memory Controller 2" },
-{0x10DE, 0x01ED, "NVIDIA","nForce2","Memory Controller 3" },
-{0x10DE, 0x01EE, "NVIDIA","nForce2","Memory Controller 4" },
-{0x10DE, 0x01EF, "NVIDIA","nForce2","Memory Controller 5" },
-{0x10DE, 0x01F0, "NVIDIA","CR17","NVIDIA GeForce4 MX Integrated GPU" },
-{0x10DE, 0x0200, "NVIDIA","NV20","NVIDIA GeForce3" },
-{0x10DE, 0x0201, "NVIDIA","NV20","NVIDIA GeForce3 Ti 200" },
-{0x10DE, 0x0202, "NVIDIA","NV20","NVIDIA GeForce3 Ti 500" },
-{0x10DE, 0x0203, "NVIDIA","NV20","NVIDIA Quadro DCC" },
-{0x10DE, 0x0210, "NVIDIA","NV48","NVIDIA NV48" },
-{0x10DE, 0x0211, "NVIDIA","NV48","NVIDIA GeForce 6800" },
-{0x10DE, 0x0212, "NVIDIA","NV48","NVIDIA GeForce 6800 LE" },
-{0x10DE, 0x0215, "NVIDIA","NV48","NVIDIA GeForce 6800 GT" },
-{0x10DE, 0x0218, "NVIDIA","NV48","NVIDIA GeForce 6800 XT" },
-{0x10DE, 0x0220, "NVIDIA","NV44","NVIDIA NV44" },
-{0x10DE, 0x0221, "NVIDIA","NV44","nVidia Geforce 6200 AGP" },
-{0x10DE, 0x0222, "NVIDIA","NV44","NVIDIA GeForce 6200 A-LE" },
-{0x10DE, 0x0228, "NVIDIA","NV44","NVIDIA NV44M" },
-{0x10DE, 0x0240, "NVIDIA","C51","NVIDIA GeForce 6150" },
-{0x10DE, 0x0241, "NVIDIA","C51","NVIDIA GeForce 6150 LE" },
-{0x10DE, 0x0242, "NVIDIA","C51","NVIDIA GeForce 6100" },
-{0x10DE, 0x0243, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x0244, "NVIDIA","Geforce Go 7600","Geforce Go 6150" },
-{0x10DE, 0x0245, "NVIDIA","C51","NVIDIA Quadro NVS 210S / NVIDIA GeForce 6150LE" },
-{0x10DE, 0x0246, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x0247, "NVIDIA","C51","Geforce 6100 Go" },
-{0x10DE, 0x0248, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x0249, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x024A, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x024B, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x024C, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x024D, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x024E, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x024F, "NVIDIA","C51","PCI Express Bridge" },
-{0x10DE, 0x0250, "NVIDIA","NV25","NVIDIA GeForce4 Ti 4600" },
-{0x10DE, 0x0251, "NVIDIA","NV25","NVIDIA GeForce4 Ti 4400" },
-{0x10DE, 0x0252, "NVIDIA","NV25","NVIDIA GeForce4 Ti" },
-{0x10DE, 0x0253, "NVIDIA","NV25","NVIDIA GeForce4 Ti 4200" },
-{0x10DE, 0x0258, "NVIDIA","NV25","NVIDIA Quadro4 900 XGL" },
-{0x10DE, 0x0259, "NVIDIA","NV25","NVIDIA Quadro4 750 XGL" },
-{0x10DE, 0x025B, "NVIDIA","NV25","NVIDIA Quadro4 700 XGL" },
-{0x10DE, 0x0260, "NVIDIA","0260","PCI standard ISA bridge" },
-{0x10DE, 0x0264, "NVIDIA","NVIDIA SMB Bus Controller","NVIDIA nForce PCI System Management" },
-{0x10DE, 0x0265, "NVIDIA","MCP51","Standard Dual Channel PCI IDE Controller" },
-{0x10DE, 0x0266, "NVIDIA","MCP51S","NVIDIA nForce 430/410 Serial ATA Controller" },
-{0x10DE, 0x0267, "NVIDIA","MCP51S","NVIDIA nForce 430/410 Serial ATA Controller" },
-{0x10DE, 0x0268, "NVIDIA","MCP51","NVIDIA nForce Networking Controller" },
-{0x10DE, 0x0269, "NVIDIA","MCP51","NVIDIA nForce 10/100 Mbps Ethernet" },
-{0x10DE, 0x026B, "NVIDIA","MCP51","MCP51 AC'97 Audio " },
-{0x10DE, 0x026C, "NVIDIA","MCP51","Realtek HD Audio Driver" },
-{0x10DE, 0x026D, "NVIDIA","026D","Standard OpenHCD USB Host Controller" },
-{0x10DE, 0x026e, "NVIDIA","MCP51 USB Controller (EHCI) ","MCP51 USB Controller" },
-{0x10DE, 0x026F, "NVIDIA","026F","PCI standard PCI-to-PCI bridge" },
-{0x10DE, 0x0270, "NVIDIA","0270","nForce Memory Controller" },
-{0x10DE, 0x0271, "NVIDIA","nForce","NVIDIA nForce System Management Controller" },
-{0x10DE, 0x027E, "NVIDIA","027E","nForce Memory Controller" },
-{0x10DE, 0x027F, "NVIDIA","027F","nForce Memory Controller" },
-{0x10DE, 0x0280, "NVIDIA","NV28","NVIDIA GeForce4 Ti 4800" },
-{0x10DE, 0x0281, "NVIDIA","NV28","NVIDIA GeForce4 Ti 4200 with AGP8X" },
-{0x10DE, 0x0282, "NVIDIA","NV28","NVIDIA GeForce4 Ti 4800 SE" },
-{0x10DE, 0x0286, "NVIDIA","NV25","NVIDIA GeForce4 4200 Go" },
-{0x10DE, 0x0288, "NVIDIA","NV28","NVIDIA Quadro4 980 XGL" },
-{0x10DE, 0x0289, "NVIDIA","NV28","NVIDIA Quadro4 780 XGL" },
-{0x10DE, 0x028C, "NVIDIA","NV28","NVIDIA Quadro4 700 Go GL" },
-{0x10DE, 0x0290, "NVIDIA","G71","NVIDIA GeForce 7900 GTX" },
-{0x10DE, 0x0291, "NVIDIA","G71","NVIDIA GeForce 7900 GT/GTO" },
-{0x10DE, 0x0292, "NVIDIA","G71","NVIDIA GeForce 7900 GS" },
-{0x10DE, 0x0293, "NVIDIA","G71","NVIDIA GeForce 7950 GX2" },
-{0x10DE, 0x0294, "NVIDIA","G71","NVIDIA GeForce 7950 GX2" },
-{0x10DE, 0x0295, "NVIDIA","G71","NVIDIA GeForce 7950 GT" },
-{0x10DE, 0x0297, "NVIDIA","G71","NVIDIA GeForce Go 7950 GTX" },
-{0x10DE, 0x0298, "NVIDIA","G71","NVIDIA GeForce Go 7900 GS" },
-{0x10DE, 0x0299, "NVIDIA","G71","NVIDIA GeForce Go 7900 GTX" },
-{0x10DE, 0x029B, "NVIDIA","G71","NVIDIA Quadro FX 1500M" },
-{0x10DE, 0x029C, "NVIDIA","G71","NVIDIA Quadro FX 5500" },
-{0x10DE, 0x029D, "NVIDIA","G71","NVIDIA Quadro FX 3500" },
-{0x10DE, 0x029E, "NVIDIA","G71","NVIDIA Quadro FX 1500" },
-{0x10DE, 0x029F, "NVIDIA","G71","NVIDIA Quadro FX 4500 X2" },
-{0x10DE, 0x02A0, "NVIDIA","NV2A","NVIDIA NV2A GeForce 3 Integrated (XBOX)" },
-{0x10DE, 0x02e0, "NVIDIA","BR02","NVIDIA GeForce 7600 GT" },
-{0x10DE, 0x02E1, "NVIDIA","BR02","NVIDIA GeForce 7600 GS" },
-{0x10DE, 0x02E2, "NVIDIA","BR02","NVIDIA GeForce 7300 GT" },
-{0x10DE, 0x02E3, "NVIDIA","BR02","NVIDIA GeForce 7900 GS" },
-{0x10DE, 0x02E4, "NVIDIA","BR02","NVIDIA GeForce 7950 GT" },
-{0x10DE, 0x02F3, "NVIDIA","02F3","PCI standard RAM controller" },
-{0x10DE, 0x02F8, "NVIDIA","02F8","nForce Memory Controller" },
-{0x10DE, 0x02F9, "NVIDIA","02F9","nForce Memory Controller" },
-{0x10DE, 0x02FA, "NVIDIA","02FA","nForce HyperTransport Bridge" },
-{0x10DE, 0x02FC, "NVIDIA","02FC","PCI standard PCI-to-PCI bridge" },
-{0x10DE, 0x02FD, "NVIDIA","02FD","PCI stanard PCI-to-PCI bridge" },
-{0x10DE, 0x02FE, "NVIDIA","02FE","nForce Memory Controll" },
-{0x10DE, 0x0300, "NVIDIA","NV30","NVIDIA NV30" },
-{0x10DE, 0x0301, "NVIDIA","NV30","NVIDIA GeForce FX 5800 Ultra" },
-{0x10DE, 0x0302, "NVIDIA","NV30","NVIDIA GeForce FX 5800" },
-{0x10DE, 0x0308, "NVIDIA","NV30","NVIDIA Quadro FX 2000" },
-{0x10DE, 0x0309, "NVIDIA","NV30","NVIDIA Quadro FX 1000" },
-{0x10DE, 0x030A, "NVIDIA","NV30","NVIDIA ICE FX 2000" },
-{0x10DE, 0x0311, "NVIDIA","NV31","NVIDIA GeForce FX 5600 Ultra" },
-{0x10DE, 0x0312, "NVIDIA","NV31","NVIDIA GeForce FX 5600" },
-{0x10DE, 0x0313, "NVIDIA","NV31","NVIDIA NV31" },
-{0x10DE, 0x0314, "NVIDIA","NV31","NVIDIA GeForce FX 5600XT" },
-{0x10DE, 0x0316, "NVIDIA","NV31","NVIDIA NV31M" },
-{0x10DE, 0x0317, "NVIDIA","NV31","NVIDIA NV31M Pro" },
-{0x10DE, 0x0318, "NVIDIA","NV31","NVIDIA NV31GL" },
-{0x10DE, 0x0319, "NVIDIA","NV31","NVIDIA NV31GL" },
-{0x10DE, 0x031A, "NVIDIA","NV31","NVIDIA GeForce FX Go 5600" },
-{0x10DE, 0x031B, "NVIDIA","NV31","NVIDIA GeForce FX Go 5650" },
-{0x10DE, 0x031C, "NVIDIA","NV31","NVIDIA Quadro FX Go 700" },
-{0x10DE, 0x031D, "NVIDIA","NV31","NVIDIA NV31GLM" },
-{0x10DE, 0x031E, "NVIDIA","NV31","NVIDIA NV31GLM Pro" },
-{0x10DE, 0x031F, "NVIDIA","NV31","NVIDIA NV31GLM Pro" },
-{0x10DE, 0x0320, "NVIDIA","NV34","NVIDIA GeForce FX 5200" },
-{0x10DE, 0x0321, "NVIDIA","NV34","NVIDIA GeForce FX 5200 Ultra" },
-{0x10DE, 0x0322, "NVIDIA","NV34.3","NVIDIA GeForce FX 5200" },
-{0x10DE, 0x0323, "NVIDIA","NV34","NVIDIA GeForce FX 5200LE" },
-{0x10DE, 0x0324, "NVIDIA","NV34","NVIDIA GeForce FX Go 5200 64mb" },
-{0x10DE, 0x0325, "NVIDIA","NV34","NVIDIA GeForce FX Go 5250/5500" },
-{0x10DE, 0x0326, "NVIDIA","FX 5500","NVIDIA GeForce FX 5500" },
-{0x10DE, 0x0327, "NVIDIA","NV34","NVIDIA GeForce FX 5100" },
-{0x10DE, 0x0328, "NVIDIA","NV34","NVIDIA GeForce FX Go 5200 32/64M" },
-{0x10DE, 0x0329, "NVIDIA","NV34","NVIDIA NV34MAP" },
-{0x10DE, 0x032A, "NVIDIA","NV34","NVIDIA Quadro NVS 55/280 PCI" },
-{0x10DE, 0x032B, "NVIDIA","NV34","NVIDIA Quadro FX 500/FX 600" },
-{0x10DE, 0x032C, "NVIDIA","NV34","NVIDIA GeForce FX Go 53x0" },
-{0x10DE, 0x032D, "NVIDIA","NV34","NVIDIA GeForce FX Go 5100" },
-{0x10DE, 0x032F, "NVIDIA","NV34","NVIDIA NV34GL" },
-{0x10DE, 0x0330, "NVIDIA","NV35","NVIDIA GeForce FX 5900 Ultra" },
-{0x10DE, 0x0331, "NVIDIA","NV35","NVIDIA GeForce FX 5900" },
-{0x10DE, 0x0332, "NVIDIA","NV35","NVIDIA GeForce FX 5900XT" },
-{0x10DE, 0x0333, "NVIDIA","NV35","NVIDIA GeForce FX 5950 Ultra" },
-{0x10DE, 0x0334, "NVIDIA","NV35","NVIDIA GeForce FX 5900ZT" },
-{0x10DE, 0x0338, "NVIDIA","NV35","NVIDIA Quadro FX 3000" },
-{0x10DE, 0x033F, "NVIDIA","NV35","NVIDIA Quadro FX 700" },
-{0x10DE, 0x0341, "NVIDIA","NV36","NVIDIA GeForce FX 5700 Ultra" },
-{0x10DE, 0x0342, "NVIDIA","NV36","NVIDIA GeForce FX 5700" },
-{0x10DE, 0x0343, "NVIDIA","NV36","NVIDIA GeForce FX 5700LE" },
-{0x10DE, 0x0344, "NVIDIA","NV36","NVIDIA GeForce FX 5700VE" },
-{0x10DE, 0x0345, "NVIDIA","NV36","NVIDIA NV36" },
-{0x10DE, 0x0347, "NVIDIA","NV36","NVIDIA GeForce FX Go 5700" },
-{0x10DE, 0x0348, "NVIDIA","NV36","NVIDIA GeForce FX Go 5700" },
-{0x10DE, 0x0349, "NVIDIA","NV36","NVIDIA NV36M Pro" },
-{0x10DE, 0x034B, "NVIDIA","NV36","NVIDIA NV36MAP" },
-{0x10DE, 0x034C, "NVIDIA","NV36","NVIDIA Quadro FX Go 1000" },
-{0x10DE, 0x034E, "NVIDIA","NV36","NVIDIA Quadro FX 1100" },
-{0x10DE, 0x034F, "NVIDIA","NV36","NVIDIA NV36GL" },
-{0x10DE, 0x0368, "NVIDIA","(0xCB84 integrated chip nForce Pro 3400)","SMBus controller" },
-{0x10DE, 0x036C, "NVIDIA","81FB1043","Standard OpenHCD USB Hostcontroller" },
-{0x10DE, 0x036d, "NVIDIA","81FB1043","Standard PCI-to-USB Enhanced Hostcontroller" },
-{0x10DE, 0x036E, "NVIDIA","MCP55","MCP55 PATA Controller" },
-{0x10DE, 0x036F, "NVIDIA","MCP55","MCP55 SATA/RAID Controller" },
-{0x10DE, 0x0371, "NVIDIA","MCP55","High Definition Audio Controller" },
-{0x10DE, 0x0373, "NVIDIA","rev.1","NVIDIA nForce Networking Controller" },
-{0x10DE, 0x037E, "NVIDIA","MCP55","MCP55 SATA/RAID Controller" },
-{0x10DE, 0x037F, "NVIDIA","MCP55S","MCP55 SATA/RAID Controller" },
-{0x10DE, 0x038B, "NVIDIA","G73","NVIDIA GeForce 7650 GS" },
-{0x10DE, 0x0390, "NVIDIA","G73","NVIDIA GeForce 7650 GS" },
-{0x10DE, 0x0391, "NVIDIA","G73","NVIDIA GeForce 7600 GT" },
-{0x10DE, 0x0392, "NVIDIA","GS","NVIDIA GeForce 7600 GS" },
-{0x10DE, 0x0393, "NVIDIA","G73","NVIDIA GeForce 7300 GT" },
-{0x10DE, 0x0394, "NVIDIA","G73","NVIDIA GeForce 7600 LE" },
-{0x10DE, 0x0395, "NVIDIA","G73","NVIDIA GeForce 7300 GT" },
-{0x10DE, 0x0398, "NVIDIA","G70","NVIDIA GeForce Go 7600" },
-{0x10DE, 0x039E, "NVIDIA","G73","NVIDIA Quadro FX 560" },
-{0x10DE, 0x039F, "NVIDIA","SUBSYS_00000000","REV_A1\\4&1B41B794&0&00E0" },
-{0x10DE, 0x03AC, "NVIDIA","GT216GLM","Nvidia Quadro FX 880M" },
-{0x10DE, 0x03D0, "NVIDIA","MCP61 ","NVIDIA GEForce 6150SE nForce 430" },
-{0x10DE, 0x03D1, "NVIDIA","C61","nForce 520 LE" },
-{0x10DE, 0x03D2, "NVIDIA","C61","NVIDIA GeForce 6100 nForce 400" },
-{0x10DE, 0x03D5, "NVIDIA","C61","NVIDIA GeForce 6100 nForce 420" },
-{0x10DE, 0x03D6, "NVIDIA","GT218","NVidia GeForce 7025 nForce 630a" },
-{0x10DE, 0x03E0, "NVIDIA","nForce 430, MCP61 LPC Bridge","PCI standard ISA bridge" },
-{0x10DE, 0x03E1, "NVIDIA","NV3","Riva128" },
-{0x10DE, 0x03E7, "NVIDIA","MCP61","MCP61 SATA/RAID Controller" },
-{0x10DE, 0x03EA, "NVIDIA","MCP61 Memory Controller","Memory controller" },
-{0x10DE, 0x03eb, "NVIDIA","MCP6P1, 85B36Q1, G822B1, MCP61 SMBus","NVIDIA nForce PCI Ð¡Ð¸ÑÑ‚ÐµÐ¼Ð° Ð£Ð¿Ñ€Ð°Ð²Ð»ÐµÐ½Ð¸Ðµ" },
-{0x10DE, 0x03EC, "NVIDIA","MCP61","MCP61 PATA Controller" },
-{0x10DE, 0x03EF, "NVIDIA","nForce 405, MCP61 Ethernet","Nvidia Networking Card" },
-{0x10DE, 0x03F0, "NVIDIA","ALC660/ALC662","Realtek High Defnition Audio getarnt als nVidia MCP" },
-{0x10DE, 0x03F1, "NVIDIA","MCP61 USB Controller","Serial bus controller" },
-{0x10DE, 0x03F2, "NVIDIA","MCP61 USB Controller","Serial bus controller" },
-{0x10DE, 0x03F3, "NVIDIA","MCP61 PCI bridge","Bridge" },
-{0x10DE, 0x03F4, "NVIDIA","Co-Processor","NVIDIA nForce System Management Controller" },
-{0x10DE, 0x03F5, "NVIDIA","MCP61 Memory Controller","Memory controller" },
-{0x10DE, 0x03F6, "NVIDIA","MCP61","MCP61 SATA/RAID Controller" },
-{0x10DE, 0x03F7, "NVIDIA","MCP51","MCP61 SATA/RAID Controller" },
-{0x10DE, 0x0400, "NVIDIA","G84","NVIDIA GeForce 8600 GTS" },
-{0x10DE, 0x0401, "NVIDIA","G84","NVIDIA GeForce 8600 GT" },
-{0x10DE, 0x0402, "NVIDIA","G84","NVIDIA GeForce 8600 GT" },
-{0x10DE, 0x0403, "NVIDIA","G84","NVIDIA GeForce 8600GS" },
-{0x10DE, 0x0404, "NVIDIA","G84","NVIDIA GeForce 8400 GS" },
-{0x10DE, 0x0405, "NVIDIA","unknown","GeForce 9500m GS" },
-{0x10DE, 0x0406, "NVIDIA","G84","NVIDIA GeForce 8300 GS" },
-{0x10DE, 0x0407, "NVIDIA","NVIDIA GeForce 8600M GT","NVIDIA GeForce 8600M GT" },
-{0x10DE, 0x0409, "NVIDIA","No Idea","Nvidia GeForce 8700M GT" },
-{0x10DE, 0x040a, "NVIDIA","G84","NVIDIA Quadro FX 370" },
-{0x10DE, 0x040C, "NVIDIA","NVIDIA Quadro NVS 570M","Mobile Quadro FX/NVS video card" },
-{0x10DE, 0x040E, "NVIDIA","G84","NVIDIA Quadro FX 570" },
-{0x10DE, 0x040F, "NVIDIA","G84","NVIDIA Quadro FX 1700" },
-{0x10DE, 0x0420, "NVIDIA","G86","NVIDIA GeForce 8400 SE" },
-{0x10DE, 0x0421, "NVIDIA","G86","NVIDIA GeForce 8500 GT" },
-{0x10DE, 0x0422, "NVIDIA","G86","NVIDIA GeForce 8400 GS" },
-{0x10DE, 0x0423, "NVIDIA","G86","NVIDIA GeForce 8300 GS" },
-{0x10DE, 0x0424, "NVIDIA","G86","NVIDIA GeForce 8400 GS" },
-{0x10DE, 0x0425, "NVIDIA","NVIDIA 8600m GS","NVIDIA 8600m GS" },
-{0x10DE, 0x0426, "NVIDIA","G86M","Geforce 8400M GT GPU" },
-{0x10DE, 0x0427, "NVIDIA","G86M","Geforce 8400M GS" },
-{0x10DE, 0x0428, "NVIDIA","NVIDIA GeForce 8400M G","NVIDIA GeForce 8400M G" },
-{0x10DE, 0x0429, "NVIDIA","Unknown","nVidia Quadro NVS 135M or Quadro NVS 140M " },
-{0x10DE, 0x042b, "NVIDIA","9600","NVIDIA Quadro NVS 135M" },
-{0x10DE, 0x042C, "NVIDIA","G86","NVIDIA GeForce 8600gts" },
-{0x10DE, 0x042D, "NVIDIA","Quadro FX 360 M","Quadro FX 360 M (Mobile)" },
-{0x10DE, 0x042E, "NVIDIA","GeForce 9300M G","Mobile graphics" },
-{0x10DE, 0x042f, "NVIDIA","G86","NVIDIA Quadro NVS 290" },
-{0x10DE, 0x0447, "NVIDIA","NVIDIA nForce AR Chipset","NVIDIA nForce System Management Controller" },
-{0x10DE, 0x0448, "NVIDIA","MCP65","MCP65 PATA Controller" },
-{0x10DE, 0x044C, "NVIDIA","MCP65","MCP65 RAID" },
-{0x10DE, 0x044D, "NVIDIA","MCP65","MCP65 AHCI" },
-{0x10DE, 0x044E, "NVIDIA","MCP67D","MCP67D AHCI" },
-{0x10DE, 0x044F, "NVIDIA","MCP65","MCP65 ?AHCI" },
-{0x10DE, 0x0450, "NVIDIA","E0001458","A3" },
-{0x10DE, 0x045D, "NVIDIA","MCP65","MCP65 SATA Controller(IDE mode)" },
-{0x10DE, 0x04EF, "NVIDIA","NV3","Riva 128" },
-{0x10DE, 0x0523, "NVIDIA","NVidia GeForce 9400GT","GPU" },
-{0x10DE, 0x0531, "NVIDIA","7150","NVIDIA GeForce Go 7150M (UMA)" },
-{0x10DE, 0x0533, "NVIDIA","-PCI\\VEN 10DEV 0533&SUBSYS 30EA103C&REV A2\\3&2411E","nVidia GeForce 7000M / nForce 610M" },
-{0x10DE, 0x053A, "NVIDIA","C68","NVIDIA GeForce 7050 PV / NVIDIA nForce 630a" },
-{0x10DE, 0x053B, "NVIDIA","C68","NVIDIA GeForce 7050 PV / NVIDIA nForce 630a" },
-{0x10DE, 0x053E, "NVIDIA","C68","NVIDIA GeForce 7025 / NVIDIA nForce 630a" },
-{0x10DE, 0x054, "NVIDIA","NVidia nForce 4 SLI","IDE Controller" },
-{0x10DE, 0x0542, "NVIDIA","30CF","nForce PCI System Management" },
-{0x10DE, 0x0543, "NVIDIA","Coprocessor","Coprocessor" },
-{0x10DE, 0x0543, "NVIDIA","Coprocessor","Coprocessor" },
-{0x10DE, 0x0548, "NVIDIA","ENE0100","ENE0100c" },
-{0x10DE, 0x054c, "NVIDIA","MCP67","MCP67 Ethernet Vista" },
-{0x10DE, 0x0550, "NVIDIA","Myson MTD803/TAMARACK TC6020","PCI Ethernet controller" },
-{0x10DE, 0x0554, "NVIDIA","MCP67","MCP67 AHCI" },
-{0x10DE, 0x0555, "NVIDIA","MCP67","MCP67 AHCI" },
-{0x10DE, 0x0556, "NVIDIA","MCP67","MCP67 AHCI" },
-{0x10DE, 0x0558, "NVIDIA","MCP67","MCP67 RAID" },
-{0x10DE, 0x0559, "NVIDIA","MCP67","MCP67 RAID" },
-{0x10DE, 0x055A, "NVIDIA","MCP67","MCP67 RAID" },
-{0x10DE, 0x0560, "NVIDIA","MCP67","MCP67 PATA Controller" },
-{0x10DE, 0x056C, "NVIDIA","MCP73","MCP73 PATA" },
-{0x10DE, 0x05E0, "NVIDIA","GT200b1","GeForce GTX 295" },
-{0x10DE, 0x05E1, "NVIDIA","GT200","NVIDIA GeForce GTX 280" },
-{0x10DE, 0x05E2, "NVIDIA","GT200","NVIDIA GeForce GTX 260" },
-{0x10DE, 0x05E3, "NVIDIA","GT200b","GeForce GTX 285" },
-{0x10DE, 0x05E6, "NVIDIA","GT200","NVIDIA GeForce GT 240M" },
-{0x10DE, 0x05E7, "NVIDIA","GT200","NVIDIA Tesla C1060" },
-{0x10DE, 0x05F8, "NVIDIA","GT200","NVIDIA Quadroplex 2200 S4" },
-{0x10DE, 0x05F9, "NVIDIA","GT200","NVIDIA Quadro CX" },
-{0x10DE, 0x05FD, "NVIDIA","GT200","NVIDIA Quadro FX 5800" },
-{0x10DE, 0x05FE, "NVIDIA","GT200","NVIDIA Quadro FX 4800" },
-{0x10DE, 0x05FF, "NVIDIA","G200GL","NVIDIA Quadro FX 3800" },
-{0x10DE, 0x0600, "NVIDIA","G92","NVIDIA GeForce 8800 GTS 512" },
-{0x10DE, 0x0601, "NVIDIA","G92","NVIDIA GeForce 9800 GT" },
-{0x10DE, 0x0602, "NVIDIA","G92","NVIDIA GeForce 8800 GT" },
-{0x10DE, 0x0604, "NVIDIA","G92","NVIDIA GeForce 9800 GX2" },
-{0x10DE, 0x0605, "NVIDIA","G92","NVIDIA GeForce 9800 GT" },
-{0x10DE, 0x0606, "NVIDIA","G92","NVIDIA GeForce 8800 GS" },
-{0x10DE, 0x0608, "NVIDIA","G92","NVIDIA Geforce 9800M GTX" },
-{0x10DE, 0x060B, "NVIDIA","G92","GeForce 9800M GT" },
-{0x10DE, 0x060D, "NVIDIA","G92","NVIDIA GeForce 8800 GS" },
-{0x10DE, 0x0610, "NVIDIA","G93","NVIDIA GeForce 9300 GSO" },
-{0x10DE, 0x0611, "NVIDIA","G92","NVIDIA GeForce 8800 GT" },
-{0x10DE, 0x0612, "NVIDIA","G92","NVIDIA GeForce 9800 GTX/9800 GTX+" },
-{0x10DE, 0x0613, "NVIDIA","G92","NVIDIA GeForce 9800 GTX+" },
-{0x10DE, 0x0614, "NVIDIA","G92","NVIDIA GeForce 9800 GT" },
-{0x10DE, 0x0615, "NVIDIA","0615","GeForce GTS 250" },
-{0x10DE, 0x0619, "NVIDIA","G92","NVIDIA Quadro FX 4700 X2" },
-{0x10DE, 0x061A, "NVIDIA","G92","NVIDIA Quadro FX 3700" },
-{0x10DE, 0x061B, "NVIDIA","G92","NVIDIA Quadro VX 200" },
-{0x10DE, 0x061D, "NVIDIA","G92","Nvidia Quadro 2800M" },
-{0x10DE, 0x061F, "NVIDIA","02EF","NVIDIA Quadro FX 3800M" },
-{0x10DE, 0x0622, "NVIDIA","G94","gt220" },
-{0x10DE, 0x0623, "NVIDIA","G94","NVIDIA GeForce 9600 GS" },
-{0x10DE, 0x0625, "NVIDIA","G94","NVIDIA GeForce 9600 GSO 512" },
-{0x10DE, 0x062C, "NVIDIA","na","G-Force 9800M GTS" },
-{0x10DE, 0x062D, "NVIDIA","G94","NVIDIA GeForce 9600 GT" },
-{0x10DE, 0x062E, "NVIDIA","G94","NVIDIA GeForce 9600 GT" },
-{0x10DE, 0x0637, "NVIDIA","G94","NVIDIA GeForce 9600 GT" },
-{0x10DE, 0x0638, "NVIDIA","0638","NVIDIA Quadro FX 1800" },
-{0x10DE, 0x0640, "NVIDIA","60770","81yJUT  <a href=" },
-{0x10DE, 0x0641, "NVIDIA","jwh058862","NVIDIA GeForce 9400 GT" },
-{0x10DE, 0x0642, "NVIDIA","G96","NVIDIA GeForce 8400 GS" },
-{0x10DE, 0x0643, "NVIDIA","G95","NVIDIA GeForce 9500 GT" },
-{0x10DE, 0x0644, "NVIDIA","G96","NVIDIA GeForce 9500 GS" },
-{0x10DE, 0x0645, "NVIDIA","G96","NVIDIA GeForce 9500 GS" },
-{0x10DE, 0x0646, "NVIDIA","G95","Geforce 9500GS" },
-{0x10DE, 0x0648, "NVIDIA","G96","NVIDIA GeForce 9600 GS" },
-{0x10DE, 0x0649, "NVIDIA","G96","nVidia GeForce 9600M GT" },
-{0x10DE, 0x064A, "NVIDIA","G96","GeForce 9700M GT" },
-{0x10DE, 0x0652, "NVIDIA","G96M","Ge Force GT 130M" },
-{0x10DE, 0x0654, "NVIDIA","G96M","NVIDIA (0x10de)" },
-{0x10DE, 0x0658, "NVIDIA","Quadro FX 380","Quadro FX" },
-{0x10DE, 0x0659, "NVIDIA","0x00","512 MB QUADRO NVIDIA FX580 " },
-{0x10DE, 0x065C, "NVIDIA","unkown","Quadro FX 770M" },
-{0x10DE, 0x06C0, "NVIDIA","GTX 480","MSI GTX 480" },
-{0x10DE, 0x06C4, "NVIDIA","GTX 465","nVidia GTX 465" },
-{0x10DE, 0x06CD, "NVIDIA","Nvidia Gefore GTX 470","Nvidia Gefore GTX 470" },
-{0x10DE, 0x06dd, "NVIDIA","GF100","nVidia Quadro 4000" },
-{0x10DE, 0x06E0, "NVIDIA","G98","NVIDIA GeForce 9300 GE" },
-{0x10DE, 0x06E1, "NVIDIA","G98","NVIDIA GeForce 9300 GS" },
-{0x10DE, 0x06E2, "NVIDIA","G98","NVIDIA GeForce 8400" },
-{0x10DE, 0x06E3, "NVIDIA","G98","NVIDIA GeForce 8300 GS" },
-{0x10DE, 0x06E4, "NVIDIA","G98","NVIDIA GeForce 8400 GS" },
-{0x10DE, 0x06e5, "NVIDIA","2430","asus" },
-{0x10DE, 0x06E6, "NVIDIA","G100","nVidia G100" },
-{0x10DE, 0x06E7, "NVIDIA","G98","NVIDIA GeForce 9300 SE" },
-{0x10DE, 0x06E9, "NVIDIA","G98","NVIDIA GeForce 9300M GS" },
-{0x10DE, 0x06ea, "NVIDIA","unknown","nvidia quadro nvs 150m" },
-{0x10DE, 0x06EB, "NVIDIA","G98M","Quadro NVS 160M" },
-{0x10DE, 0x06EC, "NVIDIA","0x0003","NVIDIA GeForce G105M (Acer Aspire 5738z)" },
-{0x10DE, 0x06EF, "NVIDIA","NVIDIA GeForce G 103M","NVIDIA GeForce G 103M" },
-{0x10DE, 0x06F8, "NVIDIA","G98","NVIDIA Quadro NVS 420" },
-{0x10DE, 0x06F9, "NVIDIA","G98","NVIDIA Quadro FX 370 LP" },
-{0x10DE, 0x06FA, "NVIDIA","G98","NVIDIA Quadro NVS 450" },
-{0x10DE, 0x06FD, "NVIDIA","NVS 295","NVidia NVS 295" },
-{0x10DE, 0x0753, "NVIDIA","8100","NVIDIA nForce System Management Controller" },
-{0x10DE, 0x0760, "NVIDIA","MCP78 NIC","NForce Network Controller" },
-{0x10DE, 0x0768, "NVIDIA","MCP ?","AHCI Controller" },
-{0x10DE, 0x07B5, "NVIDIA","MCP72","MCP72 AHCI" },
-{0x10DE, 0x07B9, "NVIDIA","MCP72","MCP72 RAID" },
-{0x10DE, 0x07D8, "NVIDIA","nForce 7100-630i (MCP73PV)","nForce 7100-630i (MCP73PV)" },
-{0x10DE, 0x07DA, "NVIDIA","PCI\\VEN_10DE&DEV_07DA&SUBSYS_01371025&REV_A2","coprocessor" },
-{0x10DE, 0x07DC, "NVIDIA","nForce 7100-630i (MCP73PV)","nForce 7100-630i (MCP73PV)" },
-{0x10DE, 0x07de, "NVIDIA","not known","not known" },
-{0x10DE, 0x07E0, "NVIDIA","C73","NVIDIA GeForce 7150m graphics" },
-{0x10DE, 0x07E1, "NVIDIA","C73","NVIDIA GeForce 7100 / NVIDIA nForce 630i" },
-{0x10DE, 0x07E2, "NVIDIA","C73","NVIDIA GeForce 7050 / NVIDIA nForce 630i" },
-{0x10DE, 0x07E3, "NVIDIA","C73","NVIDIA GeForce 7050 / NVIDIA nForce 610i" },
-{0x10DE, 0x07E5, "NVIDIA","C73","NVIDIA GeForce 7050 / NVIDIA nForce 620i" },
-{0x10DE, 0x07F0, "NVIDIA","MCP73","MCP73 SATA(IDE mode)" },
-{0x10DE, 0x07F4, "NVIDIA","MCP73","MCP73 AHCI1" },
-{0x10DE, 0x07F5, "NVIDIA","MCP73","MCP73 AHCI2" },
-{0x10DE, 0x07F6, "NVIDIA","MCP73","MCP73 AHCI3" },
-{0x10DE, 0x07F7, "NVIDIA","MCP73","MCP73 AHCI4" },
-{0x10DE, 0x07F8, "NVIDIA","MCP73","MCP73 RAID1" },
-{0x10DE, 0x07F9, "NVIDIA","MCP73","MCP73 RAID2" },
-{0x10DE, 0x07FA, "NVIDIA","MCP73","MCP73 RAID3" },
-{0x10DE, 0x07FB, "NVIDIA","MCP73","MCP73 RAID4" },
-{0x10DE, 0x07fc, "NVIDIA","nForce 630i","High Definition Audio Bus" },
-{0x10DE, 0x0848, "NVIDIA","C73","NVIDIA GeForce 8300" },
-{0x10DE, 0x0849, "NVIDIA","C77","NVIDIA GeForce 8200" },
-{0x10DE, 0x084A, "NVIDIA","C77","NVIDIA nForce 730a" },
-{0x10DE, 0x084B, "NVIDIA","C77","NVIDIA GeForce 8200" },
-{0x10DE, 0x084C, "NVIDIA","C77","NVIDIA nForce 780a SLI" },
-{0x10DE, 0x084D, "NVIDIA","C77","NVIDIA nForce 750a SLI" },
-{0x10DE, 0x084F, "NVIDIA","C77","NVIDIA GeForce 8100 / nForce 720a" },
-{0x10DE, 0x0860, "NVIDIA","C79","NVIDIA GeForce 9300" },
-{0x10DE, 0x0861, "NVIDIA","1002","NVIDIA GeForce 9400" },
-{0x10DE, 0x0863, "NVIDIA","C79","NVIDIA GeForce 9400M" },
-{0x10DE, 0x0864, "NVIDIA","C79","NVIDIA GeForce 9300" },
-{0x10DE, 0x0865, "NVIDIA","C79","NVIDIA GeForce 9300" },
-{0x10DE, 0x0866, "NVIDIA","?","NVIDIA GeForce 9400M G" },
-{0x10DE, 0x0868, "NVIDIA","C79","NVIDIA nForce 760i SLI" },
-{0x10DE, 0x086A, "NVIDIA","C79","NVIDIA GeForce 9400" },
-{0x10DE, 0x086C, "NVIDIA","C79","NVIDIA GeForce 9300 / nForce 730i" },
-{0x10DE, 0x086D, "NVIDIA","C79","NVIDIA GeForce 9200" },
-{0x10DE, 0x086F, "NVIDIA","MCP79MVL","GeForce 8200M G" },
-{0x10DE, 0x0871, "NVIDIA","C79","NVIDIA GeForce 9200" },
-{0x10DE, 0x087A, "NVIDIA","C79","NVIDIA Quadro FX 470" },
-{0x10DE, 0x087d, "NVIDIA","00741B0A","REV_B1\\4" },
-{0x10DE, 0x0A20, "NVIDIA","GeForce GT 220","GeForce GT 220" },
-{0x10DE, 0x0A22, "NVIDIA","GF315","GeForce 315" },
-{0x10DE, 0x0a23, "NVIDIA","nvidia geforce 210","nvidia geforce 210" },
-{0x10DE, 0x0A29, "NVIDIA","NVIDIA GeForce GT-330M","NVIDIA GeForce GT-330M" },
-{0x10DE, 0x0A2B, "NVIDIA","GT 330M","NVIDIA GeForce 330M" },
-{0x10DE, 0x0a2c, "NVIDIA","NV","Quadro NVS 5100M" },
-{0x10DE, 0x0A2D, "NVIDIA","GT 320M","GT 320M" },
-{0x10DE, 0x0A38, "NVIDIA","nVidia quadro 400","nVidia quadro 400" },
-{0x10DE, 0x0A65, "NVIDIA","GeForce 210","Nvidia 200 Series" },
-{0x10DE, 0x0A66, "NVIDIA","GT218","GeForce 310" },
-{0x10DE, 0x0A6A, "NVIDIA","NVS 2100M","NVIDIA NVS 2100M" },
-{0x10DE, 0x0A6C, "NVIDIA","NVS 5100M","NVidia NVS 5100M" },
-{0x10DE, 0x0A6F, "NVIDIA","ION","Ion next gen small size chip" },
-{0x10DE, 0x0A70, "NVIDIA","G310M","vga nVidia &#26174;&#31034;&#39537;&#21160;&#31243;&#24207;" },
-{0x10DE, 0x0A73, "NVIDIA","0x0A73","NVIDIA ION Graphic driver" },
-{0x10DE, 0x0A74, "NVIDIA","GeForce G210M","GPU" },
-{0x10DE, 0x0A75, "NVIDIA","GF300M","GeForce 310M" },
-{0x10DE, 0x0A78, "NVIDIA","GT218GL","NVIDIA Quadro FX 380 LP" },
-{0x10DE, 0x0A7B, "NVIDIA","Nvidia GT218 [GeForce 505] ","Nvidia GT218 [GeForce 505] " },
-{0x10DE, 0x0aa3, "NVIDIA","MCP7A","nForce 730i SMBus Controller" },
-{0x10DE, 0x0AB0, "NVIDIA","NForce 9300 LAN/SATA/SMBUS/SMU/GPU","0x0A80" },
-{0x10DE, 0x0AB8, "NVIDIA","MCP79","MCP79 AHCI1" },
-{0x10DE, 0x0AB9, "NVIDIA","MCP79","MCP79 AHCI2" },
-{0x10DE, 0x0ABC, "NVIDIA","MCP79","MCP79 RAID1" },
-{0x10DE, 0x0ABD, "NVIDIA","MCP79","MCP79 RAID2" },
-{0x10DE, 0x0AD0, "NVIDIA","MCP78","SATA Controller IDE mode" },
-{0x10DE, 0x0BC4, "NVIDIA","MCP?","AHCI Controller" },
-{0x10DE, 0x0BC5, "NVIDIA","MCP?","AHCI Controller" },
-{0x10DE, 0x0BCC, "NVIDIA","MCP?","Raid Controller" },
-{0x10DE, 0x0BCD, "NVIDIA","MCP?","Raid Controller" },
-{0x10DE, 0x0BE3, "NVIDIA","NV34","Riva 128" },
-{0x10DE, 0x0CA3, "NVIDIA","GT240","GeForce GT 240" },
-{0x10DE, 0x0dc4, "NVIDIA","GeForce 400M GTS 450","http://www.nvidia.pl/download/driverResults.aspx/71737/pl" },
-{0x10DE, 0x0DCD, "NVIDIA","GT555M","Nvidia GeForce GT555M" },
-{0x10DE, 0x0DD1, "NVIDIA","GF106M","Geforce GTX 460M" },
-{0x10DE, 0x0DE1, "NVIDIA","GF108","NVIDIA GeForce GT 430" },
-{0x10DE, 0x0DE3, "NVIDIA","GF116","nVidia GT 635M" },
-{0x10DE, 0x0DF4, "NVIDIA","0DF4","NVIDIA GeForce GT 540M" },
-{0x10DE, 0x0DF5, "NVIDIA","164A10CF","NVIDIA GeForce GT 525M [VISTA,WIN7/64bits]" },
-{0x10DE, 0x0DF8, "NVIDIA","GF108","Quadro 600 rev a1" },
-{0x10DE, 0x0DFA, "NVIDIA","1000M","Nvidia Quadro 1000M" },
-{0x10DE, 0x0DFC, "NVIDIA","NVS Notebook","NVS 5200M" },
-{0x10DE, 0x0E1B, "NVIDIA","0E1B","High Definition Audio Controller" },
-{0x10DE, 0x0E22, "NVIDIA","GTX 460","GTX 460" },
-{0x10DE, 0x0F00, "NVIDIA","NVIDIA GeForce 8800 GTX","NVIDIA GeForce 8800 GTX" },
-{0x10DE, 0x0F01, "NVIDIA","-","GeForce GT 620" },
-{0x10DE, 0x0FC1, "NVIDIA","GK107","NVIDIA GeForce GT 640" },
-{0x10DE, 0x0FC2, "NVIDIA","GT 630","NVIDIA GeForce 332.21" },
-{0x10DE, 0x0FC6, "NVIDIA","GK107","NVIDIA GeForce GTX 650" },
-{0x10DE, 0x0FD4, "NVIDIA","Alienware M17xR3","GTX 660M" },
-{0x10DE, 0x0fe0, "NVIDIA","GK107M","GeForce GTX 660M (Mac)" },
-{0x10DE, 0x0FE1, "NVIDIA","730M","NVIDIA GeForce GT 730M" },
-{0x10DE, 0x0FF6, "NVIDIA","GK107","NVIDIA Quadro K1100M" },
-{0x10DE, 0x0FFD, "NVIDIA","GK107","NVIDIA NVS 510" },
-{0x10DE, 0x0FFE, "NVIDIA","GK107GL","NVIDIA Quadro K2000" },
-{0x10DE, 0x100c, "NVIDIA","GK110","GeForce GTX TITAN Black" },
-{0x10DE, 0x1021, "NVIDIA","nVidia K20Xm","K20X passive cooling" },
-{0x10DE, 0x1022, "NVIDIA","nVidia K20c","K20 active cooling" },
-{0x10DE, 0x1040, "NVIDIA","GT520","Nvidia GeForce GT520" },
-{0x10DE, 0x1049, "NVIDIA","GT 620","Graphics" },
-{0x10DE, 0x104A, "NVIDIA","GF119","NVIDIA GeForce GT 610" },
-{0x10DE, 0x1050, "NVIDIA","GT 540M","Nvidia GeForce GT 540M" },
-{0x10DE, 0x1051, "NVIDIA","GT520","GeForce GT520 MX" },
-{0x10DE, 0x1054, "NVIDIA","GeForce 410M","Vvideo ÐšÐ°Ñ€Ñ‚Ñ‹" },
-{0x10DE, 0x1056, "NVIDIA","NVidia NVS 4200m","NVidia NVS 4200m" },
-{0x10DE, 0x1058, "NVIDIA","NV34","Riva128" },
-{0x10DE, 0x1086, "NVIDIA","GF110","GTX 570" },
-{0x10DE, 0x10C3, "NVIDIA","GT218","NVIDIA GeForce 8400GS" },
-{0x10DE, 0x10C5, "NVIDIA","GT218","Nvidia Geforce 405(OEM)" },
-{0x10DE, 0x10D8, "NVIDIA","GT218","NVIDIA NVS 300" },
-{0x10DE, 0x10DE, "NVIDIA","NV34","Riva 128" },
-{0x10DE, 0x10F0, "NVIDIA","82578DC (NV3)","INTEL " },
-{0x10DE, 0x110, "NVIDIA","nv11","geforcemx/mx400" },
-{0x10DE, 0x1112, "NVIDIA","0x1112","Gateway Solo 9550 NVIDIA Geforce 2 GO 32 MB" },
-{0x10DE, 0x1140, "NVIDIA","GF117","Geforce 710M" },
-{0x10DE, 0x11a2, "NVIDIA","GK104M","GeForce GTX 675MX (Mac)" },
-{0x10DE, 0x11a3, "NVIDIA","GK104M","GeForce GTX 680MX" },
-{0x10DE, 0x11C0, "NVIDIA","GTX660","GeForce GTX 660" },
-{0x10DE, 0x11C6, "NVIDIA","GTX650Ti","NVIDIA GeForce GTX 650 Ti" },
-{0x10DE, 0x11FA, "NVIDIA","Quattro K4000","NVidia Quattro K4000" },
-{0x10DE, 0x1200, "NVIDIA","GF114","560 GTX TI" },
-{0x10DE, 0x1201, "NVIDIA","GF114","NVIDIA GeForce GTX 560" },
-{0x10DE, 0x1202, "NVIDIA","gf114","nvidia gtx 560 ti" },
-{0x10DE, 0x1244, "NVIDIA","NVIDIA Corporation","GeForce  GTX 550" },
-{0x10DE, 0x1251, "NVIDIA","GF116 (GTX 560m)","Nvidia Geforce GTX 560m (MXM 3.0b)" },
-{0x10DE, 0x1292, "NVIDIA","NVIDIA GEFORCE GT 740m","NVIDIA GEFORCE GT 740m" },
-{0x10DE, 0x1341, "NVIDIA","PCI\\VEN_10DE&DEV_1341&SUBSYS_504017AA&REV_A2","NVIDIA GeForce 840M" },
-{0x10DE, 0x1381, "NVIDIA","GM107-300-A2","GeForce GTX 750" },
-{0x10DE, 0x13C2, "NVIDIA","GTX970","NVIDIA GeForce GTX 970" },
-{0x10DE, 0x161, "NVIDIA","NV44","GeForce 6200 TurboCache" },
-{0x10DE, 0x181, "NVIDIA","NV18B","GeForce4 MX 440 AGP 8X" },
-{0x10DE, 0x247, "NVIDIA","NVS210S","GF6150" },
-{0x10DE, 0x26C, "NVIDIA","6150","AMD" },
-{0x10DE, 0x4569, "NVIDIA","Unknown" },
-{0x10DE, 0x5209, "NVIDIA","0x10E6","C-Media Audio Controller" },
-{0x10DE, 0x69, "NVIDIA","nVidia MCP2T","nVidia MCP2T in MSI MEGA 180" },
-{0x10DE, 0x8001, "NVIDIA","MCP73","nVidia MCP73 HDMI Audio Driver" },
-{0x10DE, 0x9490, "NVIDIA","OSx 10.6.7","4670 ati radeon hd eah4670/di/1gd3/a" },
-{0x10DE, 0x9876, "NVIDIA","NV11","GeForce2 MX / MX 400" },
-{0x10DE, 0x98DE, "NVIDIA","0x9876","0x9876" },
-{0x10DE, 0x9991, "NVIDIA","NV10","HDAUDIO\\FUNC_01&VEN_10EC&DEV_0662&SUBSYS_1B0A0062&REV_1001\\4&22548B7C&0&0001" },
-{0x10DE, 0xDC4, "NVIDIA","GTS 450","NVIDIA GeForce GTS 450" },
-{0x10DE, 0xDF5, "NVIDIA","GT525M","Nvidia GeForce GT525M" },
-{0x10DE, 0xDF5a, "NVIDIA","GT525M","Nvidia GeForce GT525M" },
-{0x10DE, 0x0DE9, "NVIDIA","GT 630M","Geforce GT 630M" },
-{0x10DE, 0x026C, "NVIDIA","nVidia Geforce 6150 GPU ( Built-Into Controller )","Nvidia Motherboard nForce 430 ( MCP-51 ) with On-Board GeForce 6150 GPU" },
-{0x10DF, 0x10DF, "Emulex Corporation","Light Pulse","Fibre Channel Adapter" },
-{0x10DF, 0x1AE5, "Emulex Corporation","LP6000","Fibre Channel Host Adapter" },
-{0x10DF, 0xF0A5, "Emulex Corporation","PL1050Ex","Emulex 1050EX FC HBA - 2GB PCI-EXPRESS" },
-{0x10DF, 0xF0E5, "Emulex Corporation","Emulex LightPulse® LPe1150 ","ANSI Fibre Channel: FC-PH-3, FC-PI-2, FC-FS, FC-AL-2, FC-GS-4, FC-FLA, FC-PLDA, FC-SP, FC-TAPE, FCP-" },
-{0x10DF, 0xF100, "Emulex Corporation","LPe12000 / LPe12002 / LPe1205","8Gb PCIe Single / Dual port Fibre Channel Adapter" },
-{0x10DF, 0xF700, "Emulex Corporation","LP7000","Fibre Channel Host Adapter" },
-{0x10DF, 0xF800, "Emulex Corporation","LP8000","Fibre Channel Host Adapter" },
-{0x10DF, 0xF900, "Emulex Corporation","????","Light Pulse LP9002 2Gb" },
-{0x10DF, 0xF980, "Emulex Corporation","LP9802 / DC","LP9802 & LP9802DC HBA adapter" },
-{0x10DF, 0xFA00, "Emulex Corporation","LP10000","Fibre Channel Host Adapter" },
-{0x10DF, 0xfd00, "Emulex Corporation","L2A2860 HELIOS v1.11","Emulex LP11002" },
-{0x10DF, 0xfe00, "Emulex Corporation","LPe11000 / LPe11002 / LPe1105","4Gb PCIe Single / Dual port Fibre Channel Adapter" },
-{0x10E1, 0x0391, "Tekram Technology Corp. Ltd.","TRM-S1040","0000" },
-{0x10E1, 0x690C, "Tekram Technology Corp. Ltd.","DC-690c","" },
-{0x10E1, 0xDC20, "Tekram Technology Corp. Ltd.","DC-390F","SCSI Controller" },
-{0x10E3, 0x0000, "Tundra Semiconductor Corp.","CA91C042/142","Universe/II VMEbus Bridge" },
-{0x10E3, 0x0148, "Tundra Semiconductor Corp.","Tundra Tsi148","PCI/X-to-VME Bridge" },
-{0x10E3, 0x0513, "Tundra Semiconductor Corp.","Tsi320","Dual-Mode PCI-to-PCI Bus Bridge" },
-{0x10E3, 0x0850, "Tundra Semiconductor Corp.","Tsi850","Power PC Dual PCI Host Bridge" },
-{0x10E3, 0x0854, "Tundra Semiconductor Corp.","Tsi850","Power PC Single PCI Host Bridge" },
-{0x10E3, 0x0860, "Tundra Semiconductor Corp.","CA91C860","QSpan Motorola Processor Bridge" },
-{0x10E3, 0x0862, "Tundra Semiconductor Corp.","CA91L862A","QSpan II PCI-to-Motorola CPU Bridge" },
-{0x10E3, 0x8114, "Tundra Semiconductor Corp.","Tsi384","PCIe to PCI-X Bridge" },
-{0x10E3, 0x8260, "Tundra Semiconductor Corp.","CA91L8200/8260","PowerSpan II PowerPC-to-PCI Bus Switch" },
-{0x10E3, 0x8261, "Tundra Semiconductor Corp.","CA91L8200/8260","PowerSpan II PowerPC-to-PCI Bus Switch" },
-{0x10E6, 0x5209, "Gainbery Computer Products Inc.","0904UGG1EB","C-Media Audio Controller" },
-{0x10E8, 0x0002, "Applied Micro Circuits Corp.","2BA57D2F","PCI card" },
-{0x10E8, 0x2011, "Applied Micro Circuits Corp.","Q-Motion pci 264","Video Capture/Edit board" },
-{0x10E8, 0x4750, "Applied Micro Circuits Corp.","S59200","Amcc PCI MatchMaker" },
-{0x10E8, 0x5920, "Applied Micro Circuits Corp.","S5920","amcc" },
-{0x10E8, 0x8033, "Applied Micro Circuits Corp.","BBK-PCI light","Transputer Link Interface" },
-{0x10E8, 0x8034, "Applied Micro Circuits Corp.","bbk pci light","transputer link interface" },
-{0x10E8, 0x8043, "Applied Micro Circuits Corp.","LANai4.x","Myrinet LANai interface chip" },
-{0x10E8, 0x8062, "Applied Micro Circuits Corp.","S5933Qc","Parastation" },
-{0x10E8, 0x807D, "Applied Micro Circuits Corp.","S5933QE","PCI44" },
-{0x10E8, 0x8088, "Applied Micro Circuits Corp.","FS","Kingsberg Spacetec Format Synchronizer" },
-{0x10E8, 0x8089, "Applied Micro Circuits Corp.","SOB","Kingsberg Spacetec Serial Output Board" },
-{0x10E8, 0x809C, "Applied Micro Circuits Corp.","S5933","Traquair HEPC3" },
-{0x10E8, 0x80b1, "Applied Micro Circuits Corp.","Data Fire Basic 4MB PCI","Active ISDN Controller" },
-{0x10E8, 0x80b9, "Applied Micro Circuits Corp.","PCI MATCHMAKER S5935QF","Driver" },
-{0x10E8, 0x80D7, "Applied Micro Circuits Corp.","PCI-9112","Data Acquisition Card (ADLINK)" },
-{0x10E8, 0x80D8, "Applied Micro Circuits Corp.","PCI-7200","40MB/s 32-channels Digital I/O card (ADLINK)" },
-{0x10E8, 0x80D9, "Applied Micro Circuits Corp.","PCI-9118","Data Acquisition Card (ADLINK)" },
-{0x10E8, 0x80DA, "Applied Micro Circuits Corp.","","" },
-{0x10E8, 0x80e3, "Applied Micro Circuits Corp.","S5933QC","AMCC PCI Matchmaker" },
-{0x10E8, 0x811A, "Applied Micro Circuits Corp.","PCI-DSlink","PCI-IEEE1355-DS-DE interface" },
-{0x10E8, 0x8170, "Applied Micro Circuits Corp.","S5933Qe","AMCC Matchmaker PCI drivers" },
-{0x10E8, 0x831C, "Applied Micro Circuits Corp.","S5933 32b PCI MatchMaker","KVD PCIDIS Interface" },
-{0x10E9, 0x10E9, "Alps Electronic Corp. Ltd.","VID_044E&PID_3001","ALPS Integrated Bluetooth UGPZ = BTHUSB, USB \\ Vid_044e & Pid_3001 " },
-{0x10E9, 0x3001, "Alps Electronic Corp. Ltd.","Bluetooth USB Controller (ALPS/UGPZ6)","http://esupport.sony.com/US/p/swu-matrix.pl?upd_id=2396" },
-{0x10EA, 0x1680, "Tvia, Inc.","IGA-1680","svga" },
-{0x10EA, 0x1682, "Tvia, Inc.","IGA-1682","video" },
-{0x10EA, 0x1683, "Tvia, Inc.","IGA-1683","" },
-{0x10EA, 0x2000, "Tvia, Inc.","CyberPro 2010","TV output ram 2MB  Cyberpro2010" },
-{0x10EA, 0x2010, "Tvia, Inc.","CyberPro 20xx/2000A","vbcvbcvbcvb" },
-{0x10EA, 0x5000, "Tvia, Inc.","CyberPro 5000","" },
-{0x10EA, 0x5050, "Tvia, Inc.","CyberPro 5050","" },
-{0x10EB, 0x0101, "Artist Graphics","3GA","64 bit graphics processor" },
-{0x10EB, 0x8111, "Artist Graphics","Twist3","Frame Grabber" },
-{0x10EC, 0x8136, "Realtek Semiconductor Corp.","Realtek AC97Audio drivers","Realtek 171 High Definition Audio" },
-{0x10EC, 0x0062, "Realtek Semiconductor Corp.","LSISAS1078","PCI-Express Fusion-MPT SAS" },
-{0x10EC, 0x0129, "Realtek Semiconductor Corp.","unknown","Realtek USB 2.0 Card Reader" },
-{0x10EC, 0x0185, "Realtek Semiconductor Corp.","802.11b","Realtek 8180 Extensible 802.11b Wireless Device" },
-{0x10EC, 0x0200, "Realtek Semiconductor Corp.","RTL8102E","Realtek 10/100/1000 PCI-E NIC Family" },
-{0x10EC, 0x0260, "Realtek Semiconductor Corp.","Realtek ALC260 High Definition Audio","HDAUDIO\\FUNC_01&VEN_10EC&DEV_0262&SUBSYS_144DC034&REV_1002" },
-{0x10EC, 0x0262, "Realtek Semiconductor Corp.","Realtek ALC 262","Realtek ALC 262 &#1040;&#1091;&#1076;&#1080;&#1086;" },
-{0x10EC, 0x0268, "Realtek Semiconductor Corp.","ALC268","High Definition Audio Codecs" },
-{0x10EC, 0x0269, "Realtek Semiconductor Corp.","ALC269","Realtek High Definition audio" },
-{0x10EC, 0x0270, "Realtek Semiconductor Corp.","0270","Realtek High Definition Audio " },
-{0x10EC, 0x0272, "Realtek Semiconductor Corp.","ALC272X","Realtek High Definition audio" },
-{0x10EC, 0x0532, "Realtek Semiconductor Corp.","RTL8723AE","BT combo mini pcie card" },
-{0x10EC, 0x0660, "Realtek Semiconductor Corp.","HDAUDIO\\FUNC_01&VEN_10EC&DEV_0660&SUBSYS_10191386&","HD Audio" },
-{0x10EC, 0x0662, "Realtek Semiconductor Corp.","ALC662","5.1 Channel Audio Codec" },
-{0x10EC, 0x0861, "Realtek Semiconductor Corp.","ALC862","Realtek ALC861 High Defintion Audio" },
-{0x10EC, 0x0880, "Realtek Semiconductor Corp.","1631F603","Realtek 880 High Definition Audio" },
-{0x10EC, 0x0882, "Realtek Semiconductor Corp.","Realtek ALC882/D/M","Intel 82801GB ICH7 - High Definition Audio Controller" },
-{0x10EC, 0x0883, "Realtek Semiconductor Corp.","ALC883","Realtek High definition Audio" },
-{0x10EC, 0x0885, "Realtek Semiconductor Corp.","ALC889A","REALTEK - 8 channel audio card ALC889A" },
-{0x10EC, 0x0887, "Realtek Semiconductor Corp.","FUNC_01&VEN_10EC&DEV_0887&SUBSYS_1458A002&REV_1002","xHDAUDIO\\FUNC_01&VEN_10EC&DEV_0887&SUBSYS_104383BC&REV_1002\\4&159EE542&0&0001" },
-{0x10EC, 0x0888, "Realtek Semiconductor Corp.","ALC888","Realtek High Definition Audio" },
-{0x10EC, 0x0889, "Realtek Semiconductor Corp.","1Device Ses GigabyteTeh","HDAUDIO\\FUNC_01&VEN_10EC&DEV_0662" },
-{0x10EC, 0x0892, "Realtek Semiconductor Corp.","ALC892","7.1+2 Channel HD Audio Codec with Content Protection" },
-{0x10EC, 0x0900, "Realtek Semiconductor Corp.","ALC1150","HDAUDIO\\FUNC_01&VEN_10EC&DEV_0900" },
-{0x10EC, 0xC139, "Realtek Semiconductor Corp.","5229","PCIE RTS5229 Card Reader" },
-{0x10EC, 0x10B9, "Realtek Semiconductor Corp.","M5288 SATA/Raid controller","cpi" },
-{0x10EC, 0x10EC, "Realtek Semiconductor Corp.","Realtek AC97Audio","Realtek 171 High Definition Audio" },
-{0x10EC, 0x12ec, "Realtek Semiconductor Corp.","naum tem","naum tem " },
-{0x10EC, 0x1626, "Realtek Semiconductor Corp.","PCI\\VEN_10EC&DEV_8039&SUBSYS_803910EC","Realtek 10/100/1000 PCI-E NIC Family" },
-{0x10EC, 0x5109, "Realtek Semiconductor Corp.","012659873654","cuenta" },
-{0x10EC, 0x5208, "Realtek Semiconductor Corp.","8185","Realtek RTS5208 Card Reader" },
-{0x10EC, 0x5209, "Realtek Semiconductor Corp.","Realtek","Realtek PCIE CardReader" },
-{0x10EC, 0x5227, "Realtek Semiconductor Corp.","123","Realtek PCIE Card Reader" },
-{0x10EC, 0x5229, "Realtek Semiconductor Corp.","Rts5229","Realtek PCIE CardReader" },
-{0x10EC, 0x5286, "Realtek Semiconductor Corp.","Realtek RTS528x","Realtek RTS528x PCIe Card Reader" },
-{0x10EC, 0x5287, "Realtek Semiconductor Corp.","5287","Realtek PCIE CardReader (PCI Device)" },
-{0x10EC, 0x5288, "Realtek Semiconductor Corp.","Realtek USB 2.0 Card Reader","card reader" },
-{0x10EC, 0x5289, "Realtek Semiconductor Corp.","RTL8411","Realtek PCIE Card Reader" },
-{0x10EC, 0x5461, "Realtek Semiconductor Corp.","M5461","High Definition Audio Controller" },
-{0x10EC, 0x5591, "Realtek Semiconductor Corp.","MTC ms9377c","PCI /ven_1039" },
-{0x10EC, 0x662, "Realtek Semiconductor Corp.","Realtek AC97Audio","Realtek 171 High Definition Audio" },
-{0x10EC, 0x7305, "Realtek Semiconductor Corp.","Realtek UWB Radio Driver","PCI\\VEN_10EC&DEV_7305" },
-{0x10EC, 0x8029, "Realtek Semiconductor Corp.","8172","Realtek RTL8191SE Wireless LAN 802.11n PCI-E NIC" },
-{0x10EC, 0x8039, "Realtek Semiconductor Corp.","10EC","10EC" },
-{0x10EC, 0x8136, "Realtek Semiconductor Corp.","PCI\\VEN_8086&DEV_1C3A&SUBSYS_1C3A1849&REV_04","Realtek 10/100/1000 PCI-E NIC Family" },
-{0x10EC, 0x8137, "Realtek Semiconductor Corp.","RTL8102E","Realtek 10/100/1000 PCI-E NIC Family" },
-{0x10EC, 0x8139, "Realtek Semiconductor Corp.","RTL8139","RTL8139 Fast Ethernet NIC" },
-{0x10EC, 0x8167, "Realtek Semiconductor Corp.","RTL8167","Realtek RTL8169/8110" },
-{0x10EC, 0x8168, "Realtek Semiconductor Corp.","RTL8168E/RTL8111F/RTL","PCIe GBE" },
-{0x10EC, 0x8169, "Realtek Semiconductor Corp.","8169S","Realtek RTL8169\\8110 &#1057;&#1077;&#1084;&#1100;&#1080; Gigabit Ethernet" },
-{0x10EC, 0x816C, "Realtek Semiconductor Corp.","Realtek virtual IPMI","\\10EC\\" },
-{0x10EC, 0x8171, "Realtek Semiconductor Corp.","8172","Realtek RTL8191SE &#1041;&#1077;&#1089;&#1087;&#1088;&#1086;&#1074;&#1086;&#1076;&#1085;&#1086;&#108" },
-{0x10EC, 0x8172, "Realtek Semiconductor Corp.","RTL8191SE-VA2","Single-Chip IEEE 802.11b/g/n 1T2R WLAN Controller with PCI Express Interface" },
-{0x10EC, 0x8174, "Realtek Semiconductor Corp.","RTL8188RU","Realtek RTL8188RU" },
-{0x10EC, 0x8176, "Realtek Semiconductor Corp.","RTL8188CE","Realtek RTL8188CE Wireless LAN 802.11n PCI-E NIC" },
-{0x10EC, 0x8178, "Realtek Semiconductor Corp.","PCE-N15","ASUS PCE-N15 Wireless LAN PCI-E Card" },
-{0x10EC, 0x8179, "Realtek Semiconductor Corp.","RTL8188E","IEEE 802.11b/g/n Single-Chip WiFi Chip" },
-{0x10EC, 0x8180, "Realtek Semiconductor Corp.","RTL8180L 802.11b MAC","Network controller" },
-{0x10EC, 0x8185, "Realtek Semiconductor Corp.","RTL8188ce","RTL8185L " },
-{0x10EC, 0x8191, "Realtek Semiconductor Corp.","RTL8192CE","Single-Chip IEEE 802.11b/g/n 2T2R WLAN Controller with PCI Express Interface" },
-{0x10EC, 0x8199, "Realtek Semiconductor Corp.","RTL8187SE","http://www.realtek.com/downloads/downloadsView.aspx?Langid=1&PNid=21&PFid=40&Level=5&Conn=4&DownType" },
-{0x10EC, 0x8339, "Realtek Semiconductor Corp.","RTL8139","Realtek 10/100M Fast Ethernet Controller" },
-{0x10EC, 0x8609, "Realtek Semiconductor Corp.","Realtek AC97Audio","Realtek 171 High Definition Audio" },
-{0x10EC, 0x8723, "Realtek Semiconductor Corp.","8723AE","Realtek 8191SE Wireless LAN" },
-{0x10EC, 0x8979, "Realtek Semiconductor Corp.","RTL8168","PCIe Gigabit Ethernet Family Controller" },
-{0x10EC, 0x9876, "Realtek Semiconductor Corp.","Realtek AC97Audio drivers","Realtek 171 High Definition Audio" },
-{0x10EC, 0xA167, "Realtek Semiconductor Corp.","Realtek RTL8110SC-&#1043;&#1056;.","Realtek RTL8110SC-&#1043;&#1056;." },
-{0x10EC, 0xB723, "Realtek Semiconductor Corp.","unkown","Realtek RTL8723BE Wireless LAN 802.11n PCI-NIC #4" },
-{0x10EC, 0xC139, "Realtek Semiconductor Corp.","5229","PCIE RTS5229 card reader" },
-{0x10ED, 0x10DE, "Ascii Corporation","SN0730506616","PT ICT FQC" },
-{0x10ED, 0x7310, "Ascii Corporation","V753","VGA Video Overlay Adapter" },
-{0x10EE, 0x0004, "Xilinx Corporation","Virtex 4","Virtex 4 FPGA" },
-{0x10EE, 0x0007, "Xilinx Corporation","Virtex V","Virtex V FPGA" },
-{0x10EE, 0x0105, "Xilinx Corporation","0","Fibre Channel" },
-{0x10EE, 0x0106, "Xilinx Corporation","Virtex 5","data compression device" },
-{0x10EE, 0x0314, "Xilinx Corporation","Spartan XC2S50E","Communications Controller" },
-{0x10EE, 0x1001, "Xilinx Corporation","8343176","PCI to H.100 audio interface" },
-{0x10EE, 0x3FC0, "Xilinx Corporation","RME Digi96","" },
-{0x10EE, 0x3FC1, "Xilinx Corporation","RME Digi96/8","Xilinx Corp RME Digi96/8 Pad" },
-{0x10EE, 0x3FC2, "Xilinx Corporation","RME Digi 96/8 Pro","" },
-{0x10EE, 0x3FC3, "Xilinx Corporation","RME Digi96/8 Pad","RME Digi96/8 Pad" },
-{0x10EE, 0x3FC4, "Xilinx Corporation","Digi9652","Hammerfall" },
-{0x10EE, 0x3FC5, "Xilinx Corporation","0","HDSP 9632" },
-{0x10EE, 0x4F01, "Xilinx Corporation","Jungo","PCI Simple Communications Controller" },
-{0x10EE, 0x5343, "Xilinx Corporation","Seamont SC100","Security Adapter" },
-{0x10EE, 0x8130, "Xilinx Corporation","Durango PMC","Virtex-II Bridge, XC2V1000-4FG456C" },
-{0x10EE, 0x8381, "Xilinx Corporation","Santos","Frame Grabber" },
-{0x10EE, 0xA123, "Xilinx Corporation","XA3S1600E","Spartan 3E" },
-{0x10EE, 0xA124, "Xilinx Corporation","Spartan 3E","XA3S1600E" },
-{0x10EE, 0xA125, "Xilinx Corporation","Spartan 6","XC6SLX16" },
-{0x10EF, 0x8154, "Racore Computer Products","M815x","Token Ring Adapter" },
-{0x10F0, 0xA800, "Curtiss-Wright Controls Embedded Computing","VCL-P","Graphics board" },
-{0x10F0, 0xB300, "Curtiss-Wright Controls Embedded Computing","VCL-M","graphics board" },
-{0x10F1, 0x1566, "Tyan Computer","","IDE/SCSI" },
-{0x10F1, 0x1677, "Tyan Computer","http://www.broadcom.com/support/ethernet_nic/netxt","Multimedia" },
-{0x10F1, 0x1A2A, "Tyan Computer","Unknown","web cam on toshiba satellite c6555" },
-{0x10F1, 0x1a34, "Tyan Computer","Unknown","Camera" },
-{0x10F1, 0x2013, "Tyan Computer","RS-56 sp-pci","Conexant RS-56 PCI Modem" },
-{0x10F4, 0x1300, "S-Mos Systems","rev1.1","PCI to S5U13x06B0B Bridge Adapter" },
-{0x10F5, 0xA001, "NKK Corporation","NDR4000","NR4600 Bridge" },
-{0x10F6, 0x0111, "Creative Electronic Systems SA","PCI\\VEN_1102&DEV_000B&SUBSYS_00421102&REV_04","CMI8" },
-{0x10F6, 0x10F6, "Creative Electronic Systems SA","pci\\ven","CMI8738/C3DX Multimedia Audio Controller" },
-{0x10FA, 0x0000, "Truevision","BT848KPF","GUI Accelerator" },
-{0x10FA, 0x0001, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0002, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0003, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0004, "Truevision","2189","GUI Accelerator" },
-{0x10FA, 0x0005, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0006, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0007, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0008, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0009, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x000A, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x000B, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x000C, "Truevision","Targa 1000","Video Capture & Editing card" },
-{0x10FA, 0x000D, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x000E, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x000F, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0010, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0011, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0012, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0013, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0014, "Truevision","","GUI Accelerator" },
-{0x10FA, 0x0015, "Truevision","","GUI Accelerator" },
-{0x10FB, 0x186f, "Thesys Microelectronic's","TH6255","" },
-{0x10FC, 0x8139, "I-O Data Device Inc.","Chip Description","10" },
-{0x10FD, 0x7E50, "Soyo Technology Corp. Ltd.","10FD","1518" },
-{0x1100, 0x3044, "Jazz Multimedia","VT6307","IEEE1394 Firewire 3 Port PCI Card" },
-{0x1101, 0x0002, "Initio Corporation","INI-920","Ultra SCSI Adapter" },
-{0x1101, 0x1060, "Initio Corporation","INI-A100U2W","Orchid Ultra-2 SCSI Controller" },
-{0x1101, 0x134A, "Initio Corporation","","Ultra SCSI Adapter" },
-{0x1101, 0x1622, "Initio Corporation","INIC1620","PCI SATA Controller" },
-{0x1101, 0x9100, "Initio Corporation","INI-9010/9010W","Fast Wide SCSI Controller" },
-{0x1101, 0x9400, "Initio Corporation","INIC-940","Fast Wide SCSI Controller" },
-{0x1101, 0x9401, "Initio Corporation","INIC-935","Fast Wide SCSI Controller" },
-{0x1101, 0x9500, "Initio Corporation","","" },
-{0x1101, 0x9502, "Initio Corporation","INIC-1620","pci sata controller" },
-{0x1101, 0x9700, "Initio Corporation","","Fast Wide SCSI" },
-{0x1102, 0x0002, "Creative Technology LTD.","sb80611102","Sound Blaster audigy! (Also Live! 5.1) - Drivers only 98SE/ME/2k/XP" },
-{0x1102, 0x0003, "Creative Technology LTD.","EMU8008","AWE64D OEM (CT4600)" },
-{0x1102, 0x0004, "Creative Technology LTD.","Creative SB Audigy 2 ZS (WDM)","Audigy Audio Processor" },
-{0x1102, 0x0005, "Creative Technology LTD.","EMU20K1, CA20K1","Sound Blaster X-Fi XtremeMusic (SB0460), XtremeGamer OEM (SB0770)" },
-{0x1102, 0x0006, "Creative Technology LTD.","emu10k1x","Soundblaster Live! 5.1 (SB0200)" },
-{0x1102, 0x0007, "Creative Technology LTD.","C6SB0410515017656A","Sound Blaster 5.1 vhttp://files2.europe.creative.com/manualdn/Drivers/AVP/10599/0x48689B99/SB51_XPDR" },
-{0x1102, 0x0008, "Creative Technology LTD.","ca0108","sound blaster Audigy 4" },
-{0x1102, 0x000A, "Creative Technology LTD.","SB24PCDRVLB1040090","Creative Labs  Sound Blaster X-Fi Xtreme Audio" },
-{0x1102, 0x000B, "Creative Technology LTD.","SB1270","Sound Blaster X-Fi Titanium HD" },
-{0x1102, 0x000D, "Creative Technology LTD.","SB0880","PCIe SB X-Fi Titanium Fatal1ty Pro Series" },
-{0x1102, 0x0011, "Creative Technology LTD.","SB1500","Sound Blaster Z" },
-{0x1102, 0x0012, "Creative Technology LTD.","SB1500","Sound Blaster Z Audio Controller" },
-{0x1102, 0x006, "Creative Technology LTD.","emu10k1x","Soundblaster Live! 5.1" },
-{0x1102, 0x1017, "Creative Technology LTD.","5803","3D Blaster Banshee PCI CT6760" },
-{0x1102, 0x1020, "Creative Technology LTD.","NV5","3D Blaster RIVA TNT2" },
-{0x1102, 0x1047, "Creative Technology LTD.","bV1938","Creative bV1938 3D Blaster Annihilator 2" },
-{0x1102, 0x1102, "Creative Technology LTD.","10011102","Phison" },
-{0x1102, 0x1371, "Creative Technology LTD.","ES1373"," ES1373 AudioPCI" },
-{0x1102, 0x2898, "Creative Technology LTD.","es2898","es56t-p1" },
-{0x1102, 0x4001, "Creative Technology LTD.","EMU10K1","Audigy IEEE1394a Firewire Controller" },
-{0x1102, 0x7002, "Creative Technology LTD.","EMU10K1","GamePort" },
-{0x1102, 0x7003, "Creative Technology LTD.","EMU10KX","SB Creative Labs Audigy MIDI/Game-&#1087;&#1086;&#1088;&#1090;" },
-{0x1102, 0x7004, "Creative Technology LTD.","ca0103-dbq","Game port for SB Live! Series" },
-{0x1102, 0x7005, "Creative Technology LTD.","650","Audigy LS Series Game Port" },
-{0x1102, 0x7802, "Creative Technology LTD.","EMU1OK1-NGF","Environmental Audio (SB  Live)" },
-{0x1102, 0x8938, "Creative Technology LTD.","EV1938","Sound" },
-{0x1102, 0x9800, "Creative Technology LTD.","EMU10KX","Game Port" },
-{0x1102, 0x1371, "Creative Technology LTD.","PCI\\VEN_1274&DEV_1371&CC_040100","" },
-{0x1103, 0x0003, " HighPoint Technologies, Inc.","HPT 343/345/363","EIDE Controller" },
-{0x1103, 0x0004, " HighPoint Technologies, Inc.","HPT366/368/370/370A/372","ATA Raid Controller/ATA 100" },
-{0x1103, 0x0005, " HighPoint Technologies, Inc.","HPT372/372N","PATA133 Raid Controller" },
-{0x1103, 0x0006, " HighPoint Technologies, Inc.","HPT302","ATA Raid Controller" },
-{0x1103, 0x0007, " HighPoint Technologies, Inc.","HPT371","ATA133 Controller" },
-{0x1103, 0x0008, " HighPoint Technologies, Inc.","HPT-374","ATA Raid Controller" },
-{0x1103, 0x1720, " HighPoint Technologies, Inc.","RR172x","RR172x SATA Controller" },
-{0x1103, 0x1740, " HighPoint Technologies, Inc.","RR174x","RR174x SATA Controller" },
-{0x1103, 0x1742, " HighPoint Technologies, Inc.","RR174x","RR174x SATA Controller" },
-{0x1103, 0x2210, " HighPoint Technologies, Inc.","RR2210","RR2210 SATA Controller" },
-{0x1103, 0x2300, " HighPoint Technologies, Inc.","RR2300","RR2300 SATA Controller" },
-{0x1103, 0x2310, " HighPoint Technologies, Inc.","RR231x","RR231x SATA Controller" },
-{0x1103, 0x2340, " HighPoint Technologies, Inc.","RR2340","RR2340 SATA Controller" },
-{0x1103, 0x2522, " HighPoint Technologies, Inc.","RR252x","RR252x SATA Controller" },
-{0x1103, 0x3120, " HighPoint Technologies, Inc.","RR312x","RR312x SATA Controller" },
-{0x1103, 0x3220, " HighPoint Technologies, Inc.","RR322x","RR322x SATA Controller" },
-{0x1103, 0x3320, " HighPoint Technologies, Inc.","RR332x","RR332x SATA Controller" },
-{0x1103, 0x3410, " HighPoint Technologies, Inc.","RR341x","RR341x SATA Controller" },
-{0x1103, 0x3510, " HighPoint Technologies, Inc.","RR35xx","RR35xx SATA Controller" },
-{0x1103, 0x3511, " HighPoint Technologies, Inc.","RR35xx","RR35xx SATA Controller" },
-{0x1103, 0x3520, " HighPoint Technologies, Inc.","RR35xx","RR35xx SATA Controller" },
-{0x1103, 0x3521, " HighPoint Technologies, Inc.","RR35xx","RR35xx SATA Controller" },
-{0x1103, 0x3522, " HighPoint Technologies, Inc.","RR35xx","RR35xx SATA Controller" },
-{0x1103, 0x3530, " HighPoint Technologies, Inc.","RR3530","RR3530 SATA RAID Controller" },
-{0x1103, 0x3540, " HighPoint Technologies, Inc.","RR35xx","RR35xx SATA Controller" },
-{0x1103, 0x4320, " HighPoint Technologies, Inc.","RR432x","RR432x SATA Controller" },
-{0x1103, 0x5081, " HighPoint Technologies, Inc.","RR18xx","RR18xx SATA Controller" },
-{0x1103, 0x6081, " HighPoint Technologies, Inc.","RR222x/224x","RR222x/224x SATA Controller" },
-{0x1103, 0x7042, " HighPoint Technologies, Inc.","RR231x","RR231x SATA Controller" },
-{0x1105, 0x5000, "Sigma Designs Inc.","","Multimedia" },
-{0x1105, 0x8300, "Sigma Designs Inc.","EM8220","MPEG-2 Decoder" },
-{0x1105, 0x8400, "Sigma Designs Inc.","EM8400","MPEG-2 Decoder" },
-{0x1105, 0x8470, "Sigma Designs Inc.","EM8470","multimedia controller/A/V streaming processor" },
-{0x1105, 0x8475, "Sigma Designs Inc.","EM8475","MPEG-4 Decoder" },
-{0x1105, 0xc623, "Sigma Designs Inc.","EM8623L","Media Decoder SoC" },
-{0x1106, 0x0130, "VIA Technologies, Inc.","VT6305","VIA Fire 1394.A OHCI Link Layer Ctrlr" },
-{0x1106, 0x0198, "VIA Technologies, Inc.","","CPU to PCI Bridge" },
-{0x1106, 0x0238, "VIA Technologies, Inc.","K8T890","CPU to PCI Bridge" },
-{0x1106, 0x0259, "VIA Technologies, Inc.","CN400/PM880","Host Bridge" },
-{0x1106, 0x0269, "VIA Technologies, Inc.","KT880","CPU to PCI Bridge" },
-{0x1106, 0x0282, "VIA Technologies, Inc.","K8T880Pro","CPU to PCI Bridge" },
-{0x1106, 0x0305, "VIA Technologies, Inc.","VT8363A/8365","Host Bridge" },
-{0x1106, 0x0314, "VIA Technologies, Inc.","VIA Technologies","VT82xxxx EIDE Controller (All VIA Chipsets)" },
-{0x1106, 0x0391, "VIA Technologies, Inc.","VT8363/71","Host Bridge" },
-{0x1106, 0x0397, "VIA Technologies, Inc.","VT1708S","VIA High Definition Audio" },
-{0x1106, 0x0440, "VIA Technologies, Inc.","VIA VT1818S","VIA VT1818S @ ATI SB800 - High Definition Audio Controller	PCI" },
-{0x1106, 0x0441, "VIA Technologies, Inc.","VT2020","VIA HD Audio Controller" },
-{0x1106, 0x0448, "VIA Technologies, Inc.","0","0" },
-{0x1106, 0x0501, "VIA Technologies, Inc.","VT8501","Host Bridge" },
-{0x1106, 0x0505, "VIA Technologies, Inc.","VIA S3G UniChrome IGP","3059" },
-{0x1106, 0x0506, "VIA Technologies, Inc.","1106","0397" },
-{0x1106, 0x0561, "VIA Technologies, Inc.","82C570 MV","IDE Controller" },
-{0x1106, 0x0571, "VIA Technologies, Inc.","VT8235 / VT8237a","Bus Master IDE Controller" },
-{0x1106, 0x0576, "VIA Technologies, Inc.","82C576","P54 Ctrlr" },
-{0x1106, 0x0581, "VIA Technologies, Inc.","CX700","VIA/S3G Unichrome Pro II IGP" },
-{0x1106, 0x0585, "VIA Technologies, Inc.","VT82C585VP/VPX","Host Bus-PCI Bridge" },
-{0x1106, 0x0586, "VIA Technologies, Inc.","VT82C586VP","PCI-to-ISA Bridge" },
-{0x1106, 0x0591, "VIA Technologies, Inc.","VT8237S","VIA VT8237A SATA RAID Controller" },
-{0x1106, 0x0595, "VIA Technologies, Inc.","VT82C595","Apollo VP2 PCI North Bridge" },
-{0x1106, 0x0596, "VIA Technologies, Inc.","VT82C596","PCI ISA Bridge" },
-{0x1106, 0x0597, "VIA Technologies, Inc.","VT82C597","Host Bridge (Apollo VP3)" },
-{0x1106, 0x0598, "VIA Technologies, Inc.","VT82C598","Host Bridge" },
-{0x1106, 0x0601, "VIA Technologies, Inc.","VIA8601","System Controller" },
-{0x1106, 0x0605, "VIA Technologies, Inc.","VT82c686b","PM133 System Control" },
-{0x1106, 0x0680, "VIA Technologies, Inc.","VT82C680","Apollo P6" },
-{0x1106, 0x0686, "VIA Technologies, Inc.","VT82C686","PCI-to-ISA bridge" },
-{0x1106, 0x0689, "VIA Technologies, Inc.","8906","3249" },
-{0x1106, 0x0691, "VIA Technologies, Inc.","VIA VT KN133","Mainboard" },
-{0x1106, 0x0692, "VIA Technologies, Inc.","","North Bridge" },
-{0x1106, 0x0693, "VIA Technologies, Inc.","VT82C693","Host Bridge" },
-{0x1106, 0x0926, "VIA Technologies, Inc.","VT86C926","Amazon PCI Ethernet Controller" },
-{0x1106, 0x1000, "VIA Technologies, Inc.","82C570MV","Host Bridge" },
-{0x1106, 0x1006, "VIA Technologies, Inc.","3059","3249" },
-{0x1106, 0x1089, "VIA Technologies, Inc.","3059","VIA Sound VIA AC97 in VT82C686A/B,VIA AC97 in VT8233/AC,VT8235" },
-{0x1106, 0x1106, "VIA Technologies, Inc.","1106","management engine driver" },
-{0x1106, 0x1107, "VIA Technologies, Inc.","060000A","ISA Bridge w/IDE" },
-{0x1106, 0x1111, "VIA Technologies, Inc.","060000A1106","VIA Sound VIA AC97 in VT82C686A/B, VIA AC97 in VT8233/AC, VT8235 & VT8237/R, VIA Vinyl audio VT1612A" },
-{0x1106, 0x1122, "VIA Technologies, Inc.","1106","management engine driver" },
-{0x1106, 0x1204, "VIA Technologies, Inc.","???","CPU to PCI" },
-{0x1106, 0x1238, "VIA Technologies, Inc.","K8T890","CPU to PCI Bridge" },
-{0x1106, 0x1259, "VIA Technologies, Inc.","CN400/PM880","Host Bridge" },
-{0x1106, 0x1269, "VIA Technologies, Inc.","KT880","CPU to PCI Bridge" },
-{0x1106, 0x1282, "VIA Technologies, Inc.","K8T880Pro","CPU to PCI Bridge" },
-{0x1106, 0x1289, "VIA Technologies, Inc.","VT1708","PCI\\VEN_1106&DEV_3059&SUBSYS_03011F6&REV_50\\3&13C0B0C5&0&8" },
-{0x1106, 0x1401, "VIA Technologies, Inc.","060000A","ISA Bridge w/IDE" },
-{0x1106, 0x1571, "VIA Technologies, Inc.","VT82C416","IDE Controller" },
-{0x1106, 0x1595, "VIA Technologies, Inc.","VT82C595/97","Host Bridge" },
-{0x1106, 0x1708, "VIA Technologies, Inc.","VIA VT8237","High Definition Audio controller" },
-{0x1106, 0x1989, "VIA Technologies, Inc.","VT1708","PCI\\VEN_1106&DEV_3344&SUBSYS_12021565&REV_01\\4&8CA73A7&0&0008 " },
-{0x1106, 0x2006, "VIA Technologies, Inc.","VT6105M","VIA Rhine III VT6105M Fast Ethernet controller" },
-{0x1106, 0x2012, "VIA Technologies, Inc.","1106","7205" },
-{0x1106, 0x2038, "VIA Technologies, Inc.","Unknown","PCI Device" },
-{0x1106, 0x204, "VIA Technologies, Inc.","K8M400 chipset","CPU " },
-{0x1106, 0x2204, "VIA Technologies, Inc.","???","CPU to PCI" },
-{0x1106, 0x2238, "VIA Technologies, Inc.","K8T890","CPU to PCI Bridge" },
-{0x1106, 0x2259, "VIA Technologies, Inc.","CN400/PM880","Host Bridge" },
-{0x1106, 0x2269, "VIA Technologies, Inc.","KT880","CPU to PCI Bridge" },
-{0x1106, 0x2282, "VIA Technologies, Inc.","K8T880Pro","CPU to PCI Bridge" },
-{0x1106, 0x24c5, "VIA Technologies, Inc.","8086 SoundController (ICH4-M B0 step)","VIA Vynil v700b" },
-{0x1106, 0x3009, "VIA Technologies, Inc.","SB200","AC'97 Audio Controller" },
-{0x1106, 0x3038, "VIA Technologies, Inc.","VT6212L","USB" },
-{0x1106, 0x3040, "VIA Technologies, Inc.","VT82C586A/B","APM(or ACPIAPIC?)" },
-{0x1106, 0x3041, "VIA Technologies, Inc.","82C570MV","ISA Bridge w/IDE" },
-{0x1106, 0x3043, "VIA Technologies, Inc.","VT86C100A","Rhine 10/100 Ethernet Adapter" },
-{0x1106, 0x3044, "VIA Technologies, Inc.","VT6306/VT6307/VT6308","VIA Fire II 1394a OHCI Link Layer Ctrlr1" },
-{0x1106, 0x305, "VIA Technologies, Inc.","VIA Sound VIA AC 97 in VT82C686A/B","VIA AC 97 in VT8233/AC" },
-{0x1106, 0x3050, "VIA Technologies, Inc.","VT82C596/596A/596","Power Management and SMBus Controller" },
-{0x1106, 0x3051, "VIA Technologies, Inc.","","Power Management Controller" },
-{0x1106, 0x3053, "VIA Technologies, Inc.","VT6105M","Rhine III Management Adapter" },
-{0x1106, 0x3057, "VIA Technologies, Inc.","VT82C686A/B","ACPI Power Management Controller" },
-{0x1106, 0x3058, "VIA Technologies, Inc.","VT1709","PCI\\VEN_1106&DEV_3059&SUBSYS_73801462&REV_50" },
-{0x1106, 0x3059, "VIA Technologies, Inc.","3059","VIA Sound VIA AC97 in VT82C686A/B&#8203;, VIA AC97 in VT8233/AC, VT8235" },
-{0x1106, 0x3065, "VIA Technologies, Inc.","VT6102","Rhine II PCI Fast Ethernet Controller" },
-{0x1106, 0x3068, "VIA Technologies, Inc.","PCI\\VEN_1106&DEV_3068&SUBSYS_4C211543&REV_80\\3&13C","VIA MC'97 Modem Controller - Agere Systems AC'97 Modem / AC-Link modems" },
-{0x1106, 0x3074, "VIA Technologies, Inc.","VT8233","PCI to ISA Bridge" },
-{0x1106, 0x3086, "VIA Technologies, Inc.","VT82C686","Power" },
-{0x1106, 0x3091, "VIA Technologies, Inc.","VT8633","CPU to PCI Bridge" },
-{0x1106, 0x3099, "VIA Technologies, Inc.","vt8233","CPU to PCI Bridge" },
-{0x1106, 0x3101, "VIA Technologies, Inc.","VT8653","CPU to PCI Bridge" },
-{0x1106, 0x3102, "VIA Technologies, Inc.","VT8362","CPU to PCI Bridge" },
-{0x1106, 0x3103, "VIA Technologies, Inc.","VT8615","CPU to PCI Bridge" },
-{0x1106, 0x3104, "VIA Technologies, Inc.","VT6202","USB 2.0 Enhanced Host Controller" },
-{0x1106, 0x3106, "VIA Technologies, Inc.","VT6105M/LOM","Rhine III PCI Fast Ethernet Controller" },
-{0x1106, 0x3107, "VIA Technologies, Inc.","VT8233/A AC97' Enhance Audio Controller","PCI to ISA Bridge" },
-{0x1106, 0x3108, "VIA Technologies, Inc.","8237","VIA/S3G UniChrome Pro IGP (Integrated Video Adapter)" },
-{0x1106, 0x3109, "VIA Technologies, Inc.","VT8233/A AC97' Enhance Audio Controller","PCI to ISA Bridge" },
-{0x1106, 0x3112, "VIA Technologies, Inc.","VT8361","CPU to PCI Bridge" },
-{0x1106, 0x3113, "VIA Technologies, Inc.","","PCI to PCI Bridge" },
-{0x1106, 0x3116, "VIA Technologies, Inc.","VT8375","CPU-to-PCI Bridge" },
-{0x1106, 0x3118, "VIA Technologies, Inc.","CN400","P4M800/CE/Pro UniChrome Pro,PM880, PM800, CN400 UniChrome,VN800 UniChrome Pro" },
-{0x1106, 0x3119, "VIA Technologies, Inc.","VT6120/VT6121/VT6122","'Velocity' Gigabit Ethernet Controllers" },
-{0x1106, 0x3122, "VIA Technologies, Inc.","3122110","CastleRock AGP 8X Controller" },
-{0x1106, 0x3123, "VIA Technologies, Inc.","VT8623","CPU to PCI Bridge" },
-{0x1106, 0x3128, "VIA Technologies, Inc.","vt8753","CPU-to-PCI Bridge" },
-{0x1106, 0x3133, "VIA Technologies, Inc.","VT3133","CPU to PCI Bridge" },
-{0x1106, 0x3147, "VIA Technologies, Inc.","VT8233","PCI to ISA Bridge" },
-{0x1106, 0x3148, "VIA Technologies, Inc.","VT8751","CPU-to-PCI Bridge" },
-{0x1106, 0x3149, "VIA Technologies, Inc.","VT8237 Family/ VT6421a","SATA RAID Controller" },
-{0x1106, 0x3156, "VIA Technologies, Inc.","VT8372","CPU to PCI Bridge" },
-{0x1106, 0x3157, "VIA Technologies, Inc.","VIA VT8237","CX700 - SATA RAID " },
-{0x1106, 0x3158, "VIA Technologies, Inc.","","CPU-to-PCI Bridge" },
-{0x1106, 0x3164, "VIA Technologies, Inc.","VT6410","VIA RAID Controller - 3164 " },
-{0x1106, 0x3168, "VIA Technologies, Inc.","VT8374","P4X400 Host Controller/AGP Bridge" },
-{0x1106, 0x3177, "VIA Technologies, Inc.","VT8235","PCI to ISA Bridge" },
-{0x1106, 0x3178, "VIA Technologies, Inc.","","CPU to PCI Bridge" },
-{0x1106, 0x3188, "VIA Technologies, Inc.","K8HTB-8237","CPU to PCI Bridge" },
-{0x1106, 0x3189, "VIA Technologies, Inc.","VT8377","CPU to PCI Bridge" },
-{0x1106, 0x3198, "VIA Technologies, Inc.","VEN_1106&DEV_B198&SUBSYS_00000000&REV_00","CPU-to-PCI Bridge" },
-{0x1106, 0x3202, "VIA Technologies, Inc.","","CPU to PCI Bridge" },
-{0x1106, 0x3204, "VIA Technologies, Inc.","1394 i2c","CPU to PCI Bridge" },
-{0x1106, 0x3205, "VIA Technologies, Inc.","PCI\\VEN_1106&DEV_3432","CPU to PCI Bridge" },
-{0x1106, 0x3208, "VIA Technologies, Inc.","PT890","CPU to PCI Bridge" },
-{0x1106, 0x3209, "VIA Technologies, Inc.","","CPU to PCI Bridge" },
-{0x1106, 0x3213, "VIA Technologies, Inc.","","PCI to PCI Bridge" },
-{0x1106, 0x3227, "VIA Technologies, Inc.","VT8237R","PCI-to-ISA Bridge" },
-{0x1106, 0x3230, "VIA Technologies, Inc.","K8M890CE & K8N890CE Display Driver","Via Chrome9 HC IGP Integrated Graphics" },
-{0x1106, 0x3238, "VIA Technologies, Inc.","K8T890","CPU-to-PCI Bridge" },
-{0x1106, 0x3249, "VIA Technologies, Inc.","VT6421","VIA VT6421 RAID Controller - Windows XP 32.bit" },
-{0x1106, 0x3253, "VIA Technologies, Inc.","VT6655","PCI-Cardbus Wireless LAN Adapter" },
-{0x1106, 0x3258, "VIA Technologies, Inc.","PT880","CPU-to-PCI Bridge" },
-{0x1106, 0x3259, "VIA Technologies, Inc.","???","CPU to PCI Bridge" },
-{0x1106, 0x3269, "VIA Technologies, Inc.","KT880","CPU to PCI Bridge" },
-{0x1106, 0x3282, "VIA Technologies, Inc.","K8T880Pro","CPU to PCI Bridge" },
-{0x1106, 0x3288, "VIA Technologies, Inc.","040300","HDA Codec Realtek ALC660" },
-{0x1106, 0x3343, "VIA Technologies, Inc.","81CE1043","VIA S3G UniChrome Family" },
-{0x1106, 0x3344, "VIA Technologies, Inc.","CN700","VIA/S3G UniChrome Pro IGP CN700 in GA-8VM800M" },
-{0x1106, 0x3349, "VIA Technologies, Inc.","VT8251","VIA VT8251 AHCI RAID Controller" },
-{0x1106, 0x3365, "VIA Technologies, Inc.","060000A1106","VIA Sound VIA AC97 in VT82C686A/B, VIA AC97 in VT8233/AC, VT8235 & VT8237/R, VIA Vinyl audio VT1612A" },
-{0x1106, 0x3371, "VIA Technologies, Inc.","P4M900","V&#304;A Chrome9 HC IGP" },
-{0x1106, 0x3403, "VIA Technologies, Inc.","VT6315/VT6330","OHCI Compliant IEEE 1394 Host Controller " },
-{0x1106, 0x3483, "VIA Technologies, Inc.","VL805-q6","Universal Serial Bus (USB) Controller" },
-{0x1106, 0x3680, "VIA Technologies, Inc.","pci\\ven_1106&dev_3108_&subsys_4c211543_rev_80\\3&13","via mc97 controller for ac -link modems" },
-{0x1106, 0x401A, "VIA Technologies, Inc.","VT-6325","Via Card Reader" },
-{0x1106, 0x4149, "VIA Technologies, Inc.","VT6420","PATA" },
-{0x1106, 0x4204, "VIA Technologies, Inc.","???","CPU to PCI Bridge" },
-{0x1106, 0x4238, "VIA Technologies, Inc.","K8T890","CPU to PCI Bridge" },
-{0x1106, 0x4258, "VIA Technologies, Inc.","???","CPU to PCI Bridge" },
-{0x1106, 0x4259, "VIA Technologies, Inc.","???","CPU to PCI Bridge" },
-{0x1106, 0x4269, "VIA Technologies, Inc.","KT880","CPU to PCI Bridge" },
-{0x1106, 0x4282, "VIA Technologies, Inc.","K8T880Pro","CPU to PCI Bridge" },
-{0x1106, 0x4397, "VIA Technologies, Inc.","VT1708S","VIA HD Audio Codecs" },
-{0x1106, 0x5000, "VIA Technologies, Inc.","3059","VIA Sound VIA AC97 in VT82C686A/B, VIA AC97 in VT8233/AC, VT8235" },
-{0x1106, 0x5030, "VIA Technologies, Inc.","VT82C596","ACPI Power Management Controller" },
-{0x1106, 0x5308, "VIA Technologies, Inc.","PT880 Pro / VT8237","Via I/O APIC Interrupt Controller" },
-{0x1106, 0x5372, "VIA Technologies, Inc.","VT8237S","IDE SATA Controller" },
-{0x1106, 0x6100, "VIA Technologies, Inc.","VIA VT86C100A","Rhine II PCI Fast SATA and ethernet controller" },
-{0x1106, 0x6287, "VIA Technologies, Inc.","27611","UT2DC2  <a href=" },
-{0x1106, 0x7064, "VIA Technologies, Inc.","SUBSYS_10020000","REV_46\\3&61AAA01&0&80" },
-{0x1106, 0x7204, "VIA Technologies, Inc.","K8M400","CPU to PCI Bridge" },
-{0x1106, 0x7205, "VIA Technologies, Inc.","KM400","VIA Technologies, Inc. VT8378 [S3 UniChrome] Graphics Adapter" },
-{0x1106, 0x7238, "VIA Technologies, Inc.","K8T890","CPU to PCI Bridge" },
-{0x1106, 0x7258, "VIA Technologies, Inc.","PT880","CPU to PCI Bridge" },
-{0x1106, 0x7259, "VIA Technologies, Inc.","PM800","CPU to PCI Bridge" },
-{0x1106, 0x7269, "VIA Technologies, Inc.","KT880","CPU to PCI Bridge" },
-{0x1106, 0x7282, "VIA Technologies, Inc.","K8T880Pro","CPU to PCI Bridge" },
-{0x1106, 0x7353, "VIA Technologies, Inc.","CX700","SATA RAID" },
-{0x1106, 0x7372, "VIA Technologies, Inc.","VT8237","SATA RAID" },
-{0x1106, 0x7565, "VIA Technologies, Inc.","473040005","60" },
-{0x1106, 0x8208, "VIA Technologies, Inc.","PT890?","PCI to AGP Bridge" },
-{0x1106, 0x8231, "VIA Technologies, Inc.","VT8231","PCI to ISA Bridge" },
-{0x1106, 0x8235, "VIA Technologies, Inc.","VT8754","vga" },
-{0x1106, 0x8237, "VIA Technologies, Inc.","VT8237","AC97 Enhanced Audio Controller - the 8251 controller is different" },
-{0x1106, 0x8305, "VIA Technologies, Inc.","VT8363A/65","PCI to AGP Bridge" },
-{0x1106, 0x8391, "VIA Technologies, Inc.","VT8363/71","PCI to AGP Bridge" },
-{0x1106, 0x8501, "VIA Technologies, Inc.","VT8501","PCI to AGP Bridge" },
-{0x1106, 0x8596, "VIA Technologies, Inc.","VT82C596","PCI to AGP Bridge" },
-{0x1106, 0x8597, "VIA Technologies, Inc.","VT82C597","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0x8598, "VIA Technologies, Inc.","VT82C598","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0x8601, "VIA Technologies, Inc.","VT82C601","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0x8602, "VIA Technologies, Inc.","","CPU to AGP Bridge" },
-{0x1106, 0x8605, "VIA Technologies, Inc.","VT8605","PCI-to-PCI Bridge(AGP)" },
-{0x1106, 0x8691, "VIA Technologies, Inc.","VT82C691/693A/694X","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0x8693, "VIA Technologies, Inc.","VT82C693/A","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0x8920, "VIA Technologies, Inc.","3059","3249" },
-{0x1106, 0x9238, "VIA Technologies, Inc.","K8T890","I/O APIC" },
-{0x1106, 0x9398, "VIA Technologies, Inc.","VT8601","2D/3D Graphics Accelerator" },
-{0x1106, 0x9530, "VIA Technologies, Inc.","1106","Via MSP Cardreader driver" },
-{0x1106, 0x9875, "VIA Technologies, Inc.","1","pci" },
-{0x1106, 0x9876, "VIA Technologies, Inc.","VT8233/A AC97' Enhance Audio Controller","PCI to ISA Bridge" },
-{0x1106, 0xA208, "VIA Technologies, Inc.","PT890","PCI-to-PCI Bridge" },
-{0x1106, 0xA238, "VIA Technologies, Inc.","K8T890","PCI-to-PCI Bridge" },
-{0x1106, 0xb01f, "VIA Technologies, Inc.","castle rock agp8x controll","fast ethernet nic" },
-{0x1106, 0xB091, "VIA Technologies, Inc.","VT8633","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0xB099, "VIA Technologies, Inc.","VT8366/A","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0xB101, "VIA Technologies, Inc.","VT8653","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0xB102, "VIA Technologies, Inc.","VT8362","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0xB103, "VIA Technologies, Inc.","VT8615","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0xB112, "VIA Technologies, Inc.","VT8361","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0xB113, "VIA Technologies, Inc.","","I/O APIC" },
-{0x1106, 0xB115, "VIA Technologies, Inc.","VT8363/65","CPU to AGP Controller" },
-{0x1106, 0xB116, "VIA Technologies, Inc.","VT8375","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0xB133, "VIA Technologies, Inc.","vt686b","CPU to AGP Controller" },
-{0x1106, 0xB148, "VIA Technologies, Inc.","VT8751 Apollo","PCI-to-Host" },
-{0x1106, 0xB156, "VIA Technologies, Inc.","VT8372","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0xB158, "VIA Technologies, Inc.","VIA Technologies Inc","PCI-to-PCI Bridge (AGP)" },
-{0x1106, 0xB168, "VIA Technologies, Inc.","VT8235","PCI-to-PCI Bridge (AGP 2.0/3.0)" },
-{0x1106, 0xB188, "VIA Technologies, Inc.","K8M800/K8N800","VIA CPU to AGP2.0/AGP3.0 Controller" },
-{0x1106, 0xB198, "VIA Technologies, Inc.","546546","PCI-to-PCI Bridge (AGP 2.0/3.0)" },
-{0x1106, 0xB213, "VIA Technologies, Inc.","","I/O APIC" },
-{0x1106, 0xC208, "VIA Technologies, Inc.","PT890","PCI-to-PCI Bridge" },
-{0x1106, 0xC238, "VIA Technologies, Inc.","K8T890","PCI-to-PCI Bridge" },
-{0x1106, 0xD208, "VIA Technologies, Inc.","PT890","PCI-to-PCI Bridge" },
-{0x1106, 0xD213, "VIA Technologies, Inc.","","PCI to PCI Bridge" },
-{0x1106, 0xD238, "VIA Technologies, Inc.","K8T890","PCI-to-PCI Bridge" },
-{0x1106, 0xE208, "VIA Technologies, Inc.","PT890","PCI-to-PCI Bridge" },
-{0x1106, 0xE238, "VIA Technologies, Inc.","K8T890","PCI-to-PCI Bridge" },
-{0x1106, 0xe721, "VIA Technologies, Inc.","104382EA","VIA HD Audio Deck VT1708B" },
-{0x1106, 0xe724, "VIA Technologies, Inc.","VT1705","VT HD AUDIO DECK vt8235" },
-{0x1106, 0xF208, "VIA Technologies, Inc.","PT890","PCI-to-PCI Bridge" },
-{0x1106, 0xF238, "VIA Technologies, Inc.","K8T890","PCI-to-PCI Bridge" },
-{0x1107, 0x8576, "Stratus Computer","","PCI Host Bridge" },
-{0x1108, 0x0100, "Proteon Inc.","p1690plus-AA","Token Ring Adapter" },
-{0x1108, 0x0101, "Proteon Inc.","p1690plus-AB","2-Port Token Ring Adapter" },
-{0x1108, 0x0105, "Proteon Inc.","P1690Plus","Token Ring Adapter" },
-{0x1108, 0x0108, "Proteon Inc.","P1690Plus","Token Ring Adapter" },
-{0x1108, 0x0138, "Proteon Inc.","P1690Plus","Token Ring Adapter" },
-{0x1108, 0x0139, "Proteon Inc.","P1690Plus","Token Ring Adapter" },
-{0x1108, 0x013C, "Proteon Inc.","P1690Plus","Token Ring Adapter" },
-{0x1108, 0x013D, "Proteon Inc.","P1690Plus","Token Ring Adapter" },
-{0x1109, 0x1400, "Adaptec/Cogent Data Technologies","EM110TX","EX110TX PCI Fast Ethernet Adapter" },
-{0x110A, 0x2101, "Siemens AG","PEB 20321","Multichannel Network Interface Controller for HDLC" },
-{0x110A, 0x2102, "Siemens AG","PEB 20534","DMA supported serial communication controller with 4 channels" },
-{0x110A, 0x2104, "Siemens AG","PSB4610","PCI Interface for Telephony/Data Applications PITA-2" },
-{0x110A, 0x3141, "Siemens AG","01","PROFIBUS Communication Processor CP5611 A2" },
-{0x110A, 0x4033, "Siemens AG","ERTEC400","EB400 ProfiNet Device-Kit" },
-{0x110A, 0x4036, "Siemens AG","Industrial Ethernet CP 1616","Siemens I/O Control" },
-{0x110B, 0x0001, "Chromatic Research Inc","Mpact","Media Processor" },
-{0x110B, 0x0002, "Chromatic Research Inc","GM90C7110VX","MPACT DVD decoder." },
-{0x110B, 0x0004, "Chromatic Research Inc","Mpact","Integrated video card" },
-{0x1112, 0x2200, "Osicom Technologies Inc.","2200","FDDI adapter" },
-{0x1112, 0x2300, "Osicom Technologies Inc.","2300","Fast Ethernet adapter" },
-{0x1112, 0x2340, "Osicom Technologies Inc.","2340","4 Port 10/100 UTP Fast Ethernet Adapter" },
-{0x1112, 0x2400, "Osicom Technologies Inc.","2400","ATM adapter" },
-{0x1113, 0x1211, "Accton Technology Corporation","EN5030, EN5038,EN1207D-TX/ Realtek 8139C","Ethernet Controller 10/100 MBit" },
-{0x1113, 0x1216, "Accton Technology Corporation","EN5251BE","accton  EN5251BE" },
-{0x1113, 0x1217, "Accton Technology Corporation","EN-2242","Ethernet Adapter" },
-{0x1113, 0x5105, "Accton Technology Corporation","EN-1660","untuk install driver" },
-{0x1113, 0x9211, "Accton Technology Corporation","EN-1207F","Fast Ethernet Adapter" },
-{0x1113, 0x9511, "Accton Technology Corporation","SMC en5251be","0445tabgf16143.1" },
-{0x1113, 0x9876, "Accton Technology Corporation","EN5251BE / EN1207F-TX","Ethernet Controller/ drivers" },
-{0x1114, 0x0506, "Atmel Corp.","AT76C506","802.11b Wireless Network Adaptor" },
-{0x1114, 0x3202, "Atmel Corp.","1103","TPM - Trusted Platform Module" },
-{0x1116, 0x0022, "Data Translation, Inc.","DT3001","" },
-{0x1116, 0x0023, "Data Translation, Inc.","DT3002","9PAEAN" },
-{0x1116, 0x0024, "Data Translation, Inc.","DT3003","" },
-{0x1116, 0x0025, "Data Translation, Inc.","DT3004","" },
-{0x1116, 0x0026, "Data Translation, Inc.","Dt3005","" },
-{0x1116, 0x0027, "Data Translation, Inc.","DT3001-PGL","" },
-{0x1116, 0x0028, "Data Translation, Inc.","DT3003-PGL","" },
-{0x1117, 0x9500, "Datacube Inc.","","max-lc SVGA card" },
-{0x1117, 0x9501, "Datacube Inc.","","MaxPCI image processing board" },
-{0x1119, 0x0000, "ICP vortex Computersysteme GmbH","GDT6000/6020/6050","PCI SCSI RAID Controller" },
-{0x1119, 0x0001, "ICP vortex Computersysteme GmbH","GDT6000/6010","PCI 1-channel SCSI RAID Controller" },
-{0x1119, 0x0002, "ICP vortex Computersysteme GmbH","GDT6110/6510","PCI 1-channel SCSI RAID Controller" },
-{0x1119, 0x0003, "ICP vortex Computersysteme GmbH","GDT6120/6520","PCI 2-channel SCSI RAID Controller" },
-{0x1119, 0x0004, "ICP vortex Computersysteme GmbH","GDT6530","PCI 3-channel SCSI RAID Controller" },
-{0x1119, 0x0005, "ICP vortex Computersysteme GmbH","GDT6550","PCI 5-channel SCSI RAID Controller" },
-{0x1119, 0x0006, "ICP vortex Computersysteme GmbH","GDT6117/6517","Wide Ultra SCSI Controller" },
-{0x1119, 0x0007, "ICP vortex Computersysteme GmbH","GDT6127/6527","Wide Ultra SCSI Controller" },
-{0x1119, 0x0008, "ICP vortex Computersysteme GmbH","GDT6537","Wide Ultra SCSI Controller" },
-{0x1119, 0x0009, "ICP vortex Computersysteme GmbH","GDT6557/6557-ECC","Wide Ultra SCSI Controller" },
-{0x1119, 0x000A, "ICP vortex Computersysteme GmbH","GDT6115/6515","Ultra SCSI Controller" },
-{0x1119, 0x000B, "ICP vortex Computersysteme GmbH","GDT6125/6525","Wide SCSI Controller" },
-{0x1119, 0x000C, "ICP vortex Computersysteme GmbH","GDT6535","Wide SCSI Controller" },
-{0x1119, 0x000D, "ICP vortex Computersysteme GmbH","GDT6555/6555-ECC","Wide SCSI Controller" },
-{0x1119, 0x0100, "ICP vortex Computersysteme GmbH","GDT6117RP/6517RP","2 Channel Wide Ultra SCSI" },
-{0x1119, 0x0101, "ICP vortex Computersysteme GmbH","GDT6127RP/6527RP","Wide Ultra SCSI HBA" },
-{0x1119, 0x0102, "ICP vortex Computersysteme GmbH","GDT6537RP","Wide Ultra SCSI HBA" },
-{0x1119, 0x0103, "ICP vortex Computersysteme GmbH","GDT6557RP","Wide Ultra SCSI HBA" },
-{0x1119, 0x0104, "ICP vortex Computersysteme GmbH","GDT6111RP/6511RP","Ultra SCSI HBA" },
-{0x1119, 0x0105, "ICP vortex Computersysteme GmbH","GDT6121RP/6521RP","Ultra SCSI HBA" },
-{0x1119, 0x0110, "ICP vortex Computersysteme GmbH","GDT6117RD/6517RD","Wide Ultra SCSI HBA" },
-{0x1119, 0x0111, "ICP vortex Computersysteme GmbH","GDT6127RD/6527RD","Wide Ultra SCSI HBA" },
-{0x1119, 0x0112, "ICP vortex Computersysteme GmbH","GDT6537RD","Wide Ultra SCSI HBA" },
-{0x1119, 0x0113, "ICP vortex Computersysteme GmbH","GDT6557RD","Wide Ultra SCSI HBA" },
-{0x1119, 0x0114, "ICP vortex Computersysteme GmbH","GDT6111RD/6511RD","Ultra SCSI HBA" },
-{0x1119, 0x0115, "ICP vortex Computersysteme GmbH","GDT6127RD/6527RD","Ultra SCSI HBA" },
-{0x1119, 0x0118, "ICP vortex Computersysteme GmbH","GDT6x18RD","Wide Ultra2 SCSI HBA" },
-{0x1119, 0x0119, "ICP vortex Computersysteme GmbH","GDT6x28RD","Wide Ultra2 SCSI HBA" },
-{0x1119, 0x011A, "ICP vortex Computersysteme GmbH","GDT6538RD/6638RD","Wide Ultra2 SCSI HBA" },
-{0x1119, 0x011B, "ICP vortex Computersysteme GmbH","GDT6558RD/6658RD","Wide Ultra2 SCSI HBA" },
-{0x1119, 0x0120, "ICP vortex Computersysteme GmbH","GDT6117RP2/6517RP2","" },
-{0x1119, 0x0121, "ICP vortex Computersysteme GmbH","GDT6127RP2/6527RP2","" },
-{0x1119, 0x0122, "ICP vortex Computersysteme GmbH","GDT6537RP2","" },
-{0x1119, 0x0123, "ICP vortex Computersysteme GmbH","GDT6557RP2","" },
-{0x1119, 0x0124, "ICP vortex Computersysteme GmbH","GDT6111RP2/6511RP2","" },
-{0x1119, 0x0125, "ICP vortex Computersysteme GmbH","GDT6127RP2/6527RP2","" },
-{0x1119, 0x0136, "ICP vortex Computersysteme GmbH","GDT 6x13RS","" },
-{0x1119, 0x0137, "ICP vortex Computersysteme GmbH","GDT 6x23RS","Disk Array Controller" },
-{0x1119, 0x0138, "ICP vortex Computersysteme GmbH","GDT 6x18RS","" },
-{0x1119, 0x0139, "ICP vortex Computersysteme GmbH","GDT 6x28RS","0139" },
-{0x1119, 0x013A, "ICP vortex Computersysteme GmbH","GDT 6x38RS","IBM IXA - Integrated xSeries Adapter" },
-{0x1119, 0x013B, "ICP vortex Computersysteme GmbH","GDT 6x58RS","" },
-{0x1119, 0x013C, "ICP vortex Computersysteme GmbH","GDT 6x33RS","" },
-{0x1119, 0x013D, "ICP vortex Computersysteme GmbH","GDT 6x43RS","" },
-{0x1119, 0x013E, "ICP vortex Computersysteme GmbH","GDT 6x53RS","" },
-{0x1119, 0x013F, "ICP vortex Computersysteme GmbH","GDT 6x63RS","" },
-{0x1119, 0x0166, "ICP vortex Computersysteme GmbH","GDT 7x13RN","" },
-{0x1119, 0x0167, "ICP vortex Computersysteme GmbH","GDT 7x23RN","" },
-{0x1119, 0x0168, "ICP vortex Computersysteme GmbH","GDT7x18RN","64-bit PCI Wide Untra2 SCSI HBA" },
-{0x1119, 0x0169, "ICP vortex Computersysteme GmbH","GDT7x28RN","64-bit PCI Wide Ultra2 SCSI HBA" },
-{0x1119, 0x016A, "ICP vortex Computersysteme GmbH","GDT7538RN/7638RN","64-bit PCI Wide Ultra2 SCSI HBA" },
-{0x1119, 0x016B, "ICP vortex Computersysteme GmbH","GDT7558RN/7658RN","64-bit PCI Wide Ultra2 SCSI HBA" },
-{0x1119, 0x016C, "ICP vortex Computersysteme GmbH","GDT 7x33RN","" },
-{0x1119, 0x016D, "ICP vortex Computersysteme GmbH","GDT 7x43RN","" },
-{0x1119, 0x016E, "ICP vortex Computersysteme GmbH","GDT 7x53RN","" },
-{0x1119, 0x016F, "ICP vortex Computersysteme GmbH","GDT 7x63RN","" },
-{0x1119, 0x01D6, "ICP vortex Computersysteme GmbH","GDT 4x13RZ","GDT 4513RZ" },
-{0x1119, 0x01D7, "ICP vortex Computersysteme GmbH","GDT 4x23RZ","" },
-{0x1119, 0x01db, "ICP vortex Computersysteme GmbH","GDT8514RZ","SCSI Ultra320  1-channel" },
-{0x1119, 0x01F6, "ICP vortex Computersysteme GmbH","GDT 8x13RZ","" },
-{0x1119, 0x01F7, "ICP vortex Computersysteme GmbH","1119","BtYVKixCnmzB" },
-{0x1119, 0x01FC, "ICP vortex Computersysteme GmbH","GDT 8x33RZ","cfa-4k" },
-{0x1119, 0x01FD, "ICP vortex Computersysteme GmbH","GDT 8x43RZ","" },
-{0x1119, 0x01FE, "ICP vortex Computersysteme GmbH","GDT 8x53RZ","" },
-{0x1119, 0x01FF, "ICP vortex Computersysteme GmbH","GDT 8x63RZ","" },
-{0x1119, 0x0210, "ICP vortex Computersysteme GmbH","GDT6519RD/6619RD","Fibre Channel HBA" },
-{0x1119, 0x0211, "ICP vortex Computersysteme GmbH","GDT6529RD/6629RD","Fibre Channel HBA" },
-{0x1119, 0x0260, "ICP vortex Computersysteme GmbH","GDT7519RN/7619RN","64-bit PCI Fibre Channel HBA" },
-{0x1119, 0x0261, "ICP vortex Computersysteme GmbH","GDT7529RN/7629RN","64-bit PCI Fibre Channel HBA" },
-{0x1119, 0x0300, "ICP vortex Computersysteme GmbH","GDT Rx","" },
-{0x1119, 0x6111, "ICP vortex Computersysteme GmbH","1","61xx raid" },
-{0x111A, 0x0000, "Efficent Networks","155P-MF1","" },
-{0x111A, 0x0002, "Efficent Networks","166P-MF1","" },
-{0x111A, 0x0003, "Efficent Networks","ENI-25P","ATM Adapter" },
-{0x111C, 0x0001, "Tricord Systems Inc.","921014946","Powerbus Bridge" },
-{0x111D, 0x0001, "Integrated Device Technology Inc.","55383","zqUh5f  <a href=" },
-{0x111D, 0x0003, "Integrated Device Technology Inc.","IDT77222/252","MICRO ABR SAR PCI ATM Controller" },
-{0x111D, 0x0004, "Integrated Device Technology Inc.","IDT77V252","MICRO ABR SAR PCI ATM Controller" },
-{0x111D, 0x7603, "Integrated Device Technology Inc.","IDT Audio CODEC","IDT High Definition Audio CODEC" },
-{0x111D, 0x7605, "Integrated Device Technology Inc.","IDT","IDT High Definition Audio CODEC" },
-{0x111D, 0x7608, "Integrated Device Technology Inc.","IDT Audio CODEC","IDT High Definition Audio CODEC" },
-{0x111D, 0x7616, "Integrated Device Technology Inc.","5.10.5515.0","SigmaTel High Definition Audio CODEC" },
-{0x111D, 0x7618, "Integrated Device Technology Inc.","STAC9221","SigmaTel High Definition Audio CODEC" },
-{0x111D, 0x7621, "Integrated Device Technology Inc.","Sigmatel HD","IDT High Definition Codec" },
-{0x111D, 0x7634, "Integrated Device Technology Inc.","IDT_Audiov5939","IDT/Sigmae HDl Audio Driver v6.10.5939.0 05/06/2008" },
-{0x111D, 0x7662, "Integrated Device Technology Inc.","IDT_Audiov5939","SigmaTel High Definition Audio CODEC" },
-{0x111D, 0x7667, "Integrated Device Technology Inc.","92hdxxx","High Definition (HD) Audio Codecs" },
-{0x111D, 0x7675, "Integrated Device Technology Inc.","92HD73C1","92HD73C1" },
-{0x111D, 0x7680, "Integrated Device Technology Inc.","102801ab","SIGMATEL STAC 92XX " },
-{0x111D, 0x76A0, "Integrated Device Technology Inc.","102801FF","STAC 92XX C-Major HD Audio (Dell Precision M4300 and LAT D630 & D830)" },
-{0x111D, 0x76B2, "Integrated Device Technology Inc.","92HD75B3","IDT Audio" },
-{0x111D, 0x76D1, "Integrated Device Technology Inc.","IDT 92HD87B1","IDT High Definition Audio CODEC" },
-{0x111D, 0x76D5, "Integrated Device Technology Inc.","0x76D1","IDT 92HD87B1/3" },
-{0x111D, 0x76D9, "Integrated Device Technology Inc.","00000000","hp IDT Audio Codec" },
-{0x111D, 0x76E7, "Integrated Device Technology Inc.","92HDxxx","HDAUDIO" },
-{0x111D, 0x8018, "Integrated Device Technology Inc.","PES12N3A","PCI Express Switch" },
-{0x111D, 0x802d, "Integrated Device Technology Inc.","PES16T7","PCI Express Switch PES16T7" },
-{0x111D, 0x806e, "Integrated Device Technology Inc.","PES24T6G2 ","PCI Express Gen2 Switch" },
-{0x111D, 0x8086, "Integrated Device Technology Inc.","IDT77201/211","NICStAR ATM Adapter" },
-{0x111D, 0x9876, "Integrated Device Technology Inc.","IDT_Audiov5939","IDT/Sigmatel HDl Audio Driver v6.10.5939.0 05/06/2008" },
-{0x111F, 0x4A47, "Precision Digital Images","Precision MX","Video engine interface" },
-{0x111F, 0x5243, "Precision Digital Images","","Frame Capture Bus Interface" },
-{0x1127, 0x0200, "FORE Systems","FireRunner PCA-200","ATM" },
-{0x1127, 0x0210, "FORE Systems","PCA-200PC","ATM" },
-{0x1127, 0x0250, "FORE Systems","","ATM" },
-{0x1127, 0x0300, "FORE Systems","PCA-200E","ATM adapter" },
-{0x1127, 0x0310, "FORE Systems","","ATM" },
-{0x1127, 0x0400, "FORE Systems","ForeRunner HE","ATM Adapter" },
-{0x1127, 0x1603, "FORE Systems","USB\\Vid_04d9&Pid_160&Rev_0310","atm" },
-{0x112D, 0x8086, "Ravicad","2200","pci simple controller " },
-{0x112E, 0x0000, "Infomedia","","EIDE/hdd and IDE/cd-rom Ctrlr" },
-{0x112E, 0x000B, "Infomedia","","EIDE/hdd and IDE/cd-rom Ctrlr" },
-{0x1130, 0xF211, "Computervision","0x010","USB Audio Sound Card" },
-{0x1131, 0x0011, "NXP Semiconductors N.V.","028","Ethernet Controller" },
-{0x1131, 0x1001, "NXP Semiconductors N.V.","bm05e ","BlueTooth &#1040;&#1076;&#1072;&#1087;&#1090;&#1077;&#1088; ISSCBTA [Tripper USB Dongle]" },
-{0x1131, 0x1131, "NXP Semiconductors N.V.","7130","01384E42y8" },
-{0x1131, 0x1201, "NXP Semiconductors N.V.","PTD3000","VPN IPSEC coprocessor" },
-{0x1131, 0x1234, "NXP Semiconductors N.V.","5.1.2600.0","EHCI USB 2.0 Controller" },
-{0x1131, 0x1301, "NXP Semiconductors N.V.","PTD3210","SSL Accelerator" },
-{0x1131, 0x1562, "NXP Semiconductors N.V.","ISP1561","EHCI USB 2.0 Controller" },
-{0x1131, 0x1996, "NXP Semiconductors N.V.","7130","01384E42y8" },
-{0x1131, 0x2780, "NXP Semiconductors N.V.","TDA2780AQ","Stream\\LVTVTune " },
-{0x1131, 0x3400, "NXP Semiconductors N.V.","UCB1500","Modem" },
-{0x1131, 0x3401, "NXP Semiconductors N.V.","UCB1500","Multimedia Audio Device" },
-{0x1131, 0x5400, "NXP Semiconductors N.V.","TriMedia TM1000/1100","Multimedia processor" },
-{0x1131, 0x5400, "NXP Semiconductors N.V.","TriMedia TM1000/1100","Multimedia processorkk" },
-{0x1131, 0x5402, "NXP Semiconductors N.V.","TriMedia TM-1300EH","Media Processor" },
-{0x1131, 0x5406, "NXP Semiconductors N.V.","","TriMedia PNX1700" },
-{0x1131, 0x7130, "NXP Semiconductors N.V.","SAA7130HL","01384E42" },
-{0x1131, 0x7133, "NXP Semiconductors N.V.","Behold TV 609 FM","PCI audio and video broadcast decoder or only avertv dvb-t pci card" },
-{0x1131, 0x7134, "NXP Semiconductors N.V.","0x7134","SAA7134 TV Card Philips" },
-{0x1131, 0x7145, "NXP Semiconductors N.V.","d145ah","ddddf" },
-{0x1131, 0x7146, "NXP Semiconductors N.V.","saa7146ah"," 0X7146" },
-{0x1131, 0x7160, "NXP Semiconductors N.V.","Philips SAA7134E, TDA10046 and TDA8275A","PCI\\VEN_1131&DEV_7160&SUBSYS_1F551461&REV_03" },
-{0x1131, 0x7162, "NXP Semiconductors N.V.","idk","idk" },
-{0x1131, 0x7164, "NXP Semiconductors N.V.","PE9400","ASUS My Cinnema PE9400 PCI-E 1x capture card." },
-{0x1131, 0x7231, "NXP Semiconductors N.V.","Philips 7231/726x-&#1057;&#1077;&#1088;&#1080;&#10","AVerMedia H339 &#1043;&#1080;&#1073;&#1088;&#1080;&#1076;&#1085;&#1099;&#1081; &#1040;&#1085;&#1072;" },
-{0x1131, 0x9730, "NXP Semiconductors N.V.","SAA9730","Ethernet controller" },
-{0x1131, 0x9876, "NXP Semiconductors N.V.","tw9903 ","saa7146ah" },
-{0x1131, 0xFFFF, "NXP Semiconductors N.V.","FF","device" },
-{0x1133, 0x7711, "Eicon Networks Corporation","EiconCard C91","" },
-{0x1133, 0x7901, "Eicon Networks Corporation","EiconCard S90","" },
-{0x1133, 0x7902, "Eicon Networks Corporation","","" },
-{0x1133, 0x7911, "Eicon Networks Corporation","","" },
-{0x1133, 0x7912, "Eicon Networks Corporation","","" },
-{0x1133, 0x7941, "Eicon Networks Corporation","","" },
-{0x1133, 0x7942, "Eicon Networks Corporation","","" },
-{0x1133, 0x7943, "Eicon Networks Corporation","","EiconCard S94" },
-{0x1133, 0x7944, "Eicon Networks Corporation","","EiconCard S94" },
-{0x1133, 0xB921, "Eicon Networks Corporation","","" },
-{0x1133, 0xB922, "Eicon Networks Corporation","","" },
-{0x1133, 0xB923, "Eicon Networks Corporation","","EiconCard P92" },
-{0x1133, 0xE001, "Eicon Networks Corporation","DIVA Pro 2.0 S/T","Pro 2." },
-{0x1133, 0xE002, "Eicon Networks Corporation","DIVA 2.0 S/T","" },
-{0x1133, 0xE003, "Eicon Networks Corporation","DIVA Pro 2.0 U","" },
-{0x1133, 0xE004, "Eicon Networks Corporation","DIVA 2.0 U","chip" },
-{0x1133, 0xE005, "Eicon Networks Corporation","DIVA 2.01 S/T","Eicon ISDN card using Siemens IPAC chip" },
-{0x1133, 0xE00B, "Eicon Networks Corporation","DIVA ISDN 2.02 PCI","Eicon ISDN card using Infineon chip" },
-{0x1133, 0xE010, "Eicon Networks Corporation","Maestra","DIVA Server BRI-2M" },
-{0x1133, 0xE012, "Eicon Networks Corporation","MaestraQ","DIVA Server BRI-8M" },
-{0x1133, 0xE013, "Eicon Networks Corporation","MaestraQ-U","DIVA Server 4BRI/PCI" },
-{0x1133, 0xE014, "Eicon Networks Corporation","MaestraP","DIVA Server PRI-30M" },
-{0x1133, 0xE015, "Eicon Networks Corporation","","Diva Server PRI-30M PCI v.2" },
-{0x1133, 0xE018, "Eicon Networks Corporation","00","DIVA Server BRI-2M/-2F" },
-{0x1134, 0x0001, "Mercury Computer Systems Inc.","1106","audio driver" },
-{0x1134, 0x0002, "Mercury Computer Systems Inc.","DPRB","Dual PCI to RapidIO Bridge" },
-{0x1134, 0x9876, "Mercury Computer Systems Inc.","3059","audio driver" },
-{0x1135, 0x0001, "Fuji Xerox Co Ltd","","Printer Cntrlr" },
-{0x1138, 0x8905, "Ziatech Corporation","8905","STD 32 Bridge" },
-{0x113C, 0x0000, "Cyclone Microsystems Inc.","PCI9060","i960 Bridge" },
-{0x113C, 0x0001, "Cyclone Microsystems Inc.","PCI9060","i960 Bridge / Evaluation Platform" },
-{0x113C, 0x0911, "Cyclone Microsystems Inc.","PCI911","i960Jx I/O Controller" },
-{0x113C, 0x0912, "Cyclone Microsystems Inc.","PCI912","i960Cx I/O Controller" },
-{0x113C, 0x0913, "Cyclone Microsystems Inc.","PCI913","i960Hx I/O Controller" },
-{0x113C, 0x0914, "Cyclone Microsystems Inc.","PCI914","I/O Controller with secondary PCI bus" },
-{0x113F, 0x0808, "Equinox Systems","SST-64P","Adapter" },
-{0x113F, 0x1010, "Equinox Systems","SST-128P","Adapter" },
-{0x113F, 0x80C0, "Equinox Systems","","" },
-{0x113F, 0x80C4, "Equinox Systems","","" },
-{0x113F, 0x80C8, "Equinox Systems","","" },
-{0x113F, 0x8888, "Equinox Systems","","" },
-{0x113F, 0x9090, "Equinox Systems","","" },
-{0x1141, 0x0001, "Crest Microsystem Inc","","EIDE/ATAPI super adapter" },
-{0x1142, 0x3210, "Alliance Semiconductor","ProMotion 3210","VGA/AVI Playback Accelerator" },
-{0x1142, 0x6410, "Alliance Semiconductor","6410 6422","GUI Accelerator" },
-{0x1142, 0x6412, "Alliance Semiconductor","","GUI Accelerator" },
-{0x1142, 0x6420, "Alliance Semiconductor","","GUI Accelerator" },
-{0x1142, 0x6422, "Alliance Semiconductor","ProMotion-6422","ProMotion-6422" },
-{0x1142, 0x6424, "Alliance Semiconductor","ProVideo 6424","ProMotion AT24 GUI Accelerator" },
-{0x1142, 0x6425, "Alliance Semiconductor","ProMotion AT25","0752 20005" },
-{0x1142, 0x6426, "Alliance Semiconductor","aT25","GUI Accelerator" },
-{0x1142, 0x643D, "Alliance Semiconductor","AT25","ProMotion-AT3D" },
-{0x1142, 0x9876, "Alliance Semiconductor","ProMotion 6422","139K76B 9808" },
-{0x1142, 0x3210, "Alliance Semiconductor","9809","139K76B" },
-{0x1144, 0x0001, "Cincinnati Milacron","","Noservo Cntrlr" },
-{0x1145, 0xF021, "Workbit Corp","????","HDCClassName=" },
-{0x1145, 0xF020, "Workbit Corp","","CardBus ATAPI Host Adapter" },
-{0x1145, 0xF021, "Workbit Corp","NPATA32","CardBus CompactFlash Adapter" },
-{0x1145, 0xf024, "Workbit Corp","NPATA-32","CardBus CompactFlash Adapter" },
-{0x1147, 0x1123, "Interface Corp","123","131dq" },
-{0x1148, 0x4000, "Marvell Semiconductor Germany GmbH","SK-NET","FDDI adapter" },
-{0x1148, 0x4200, "Marvell Semiconductor Germany GmbH","","Token Ring Adapter" },
-{0x1148, 0x4300, "Marvell Semiconductor Germany GmbH","SysKonnect Genesis","SK-NET Gigabit Ethernet Adapter" },
-{0x1148, 0x4320, "Marvell Semiconductor Germany GmbH","Marvell Yukon D-Link DGE530T","SysKonnect Marvel RDK 8001" },
-{0x1148, 0x4362, "Marvell Semiconductor Germany GmbH","88E8053","Marvell Yukon 88E8053 based Ethernet Controller" },
-{0x1148, 0x9000, "Marvell Semiconductor Germany GmbH","Marvell Yukon II PCI-X","PCI-X 10/100/1000Base-T Server" },
-{0x1148, 0x9E00, "Marvell Semiconductor Germany GmbH","Marvell Yukon EC","PCI Express 10/100/1000Base-T Desktop" },
-{0x114A, 0x5565, "VMIC","VMIPCI-5565","Ultrahigh-Speed Fiber-Optics Reflective Memory w/ Interrupts" },
-{0x114A, 0x5579, "VMIC","VMIPCI-5579","Reflective Memory Card" },
-{0x114A, 0x5588, "VMIC","VMICPCI5588","VMICPCI5588 Reflective Memory Card" },
-{0x114A, 0x6504, "VMIC","","Timer/SRAM FPGA" },
-{0x114A, 0x7587, "VMIC","VMIVME-7587","" },
-{0x114D, 0x2189, "IC Corporation","0x1002114D","PCTel HSP56 PCI Modem" },
-{0x114F, 0x0002, "Digi International","AccelePort EPC","ACPI\\NSC6001" },
-{0x114F, 0x0003, "Digi International","RightSwitch SE-6","" },
-{0x114F, 0x0004, "Digi International","AccelePort Xem","driver" },
-{0x114F, 0x0005, "Digi International","AccelePort Xr","" },
-{0x114F, 0x0006, "Digi International","AccelePort C/X","" },
-{0x114F, 0x0007, "Digi International","DataFire PCI 1 S/T","Digi Data Fire PCI 1 S/T" },
-{0x114F, 0x0009, "Digi International","AccelePort Xr/J","" },
-{0x114F, 0x000A, "Digi International","AccelePort EPC/J","" },
-{0x114F, 0x000C, "Digi International","DataFirePRIme T1","" },
-{0x114F, 0x000D, "Digi International","SyncPort","X.25/FR 2-port" },
-{0x114F, 0x0011, "Digi International","AccelePort8r EIA-232","" },
-{0x114F, 0x0012, "Digi International","AccelePort8r EIA-422","" },
-{0x114F, 0x0013, "Digi International","AccelePort Xr","" },
-{0x114F, 0x0014, "Digi International","AccelePort8r EIA-422","" },
-{0x114F, 0x0015, "Digi International","AccelePort Xem","" },
-{0x114F, 0x0016, "Digi International","AccelePort EPC/X","" },
-{0x114F, 0x0017, "Digi International","AccelePort C/X","" },
-{0x114F, 0x0019, "Digi International","DataFire PCI 1 U","" },
-{0x114F, 0x001A, "Digi International","DataFirePRIme E1","" },
-{0x114F, 0x001B, "Digi International","AccelePort C/X (IBM)","" },
-{0x114F, 0x001D, "Digi International","DataFire RAS","T1/E1/PRI" },
-{0x114F, 0x001F, "Digi International","","ClydeNonCsu6034" },
-{0x114F, 0x0020, "Digi International","","ClydeNonCsu6032" },
-{0x114F, 0x0021, "Digi International","","ClydeNonCsu4" },
-{0x114F, 0x0022, "Digi International","","ClydeNonCsu2" },
-{0x114F, 0x0023, "Digi International","AccelePort RAS","" },
-{0x114F, 0x0024, "Digi International","DataFire RAS B4 ST/U","" },
-{0x114F, 0x0026, "Digi International","AccelePort 4r 920","" },
-{0x114F, 0x0027, "Digi International","AccelePort 8r 920","" },
-{0x114F, 0x0029, "Digi International","DigiClassic PCI","" },
-{0x114F, 0x0034, "Digi International","AccelePort 2r 920","" },
-{0x114F, 0x0035, "Digi International","DataFire DSP","T1/E1/PRI, Compact PCI" },
-{0x114F, 0x0040, "Digi International","AccelePort Xp","" },
-{0x114F, 0x0042, "Digi International","AccelePort 2p PCI","" },
-{0x114F, 0x0070, "Digi International","DataFire Micro V","" },
-{0x114F, 0x0071, "Digi International","DataFire Micro V","Descargar" },
-{0x114F, 0x0072, "Digi International","DataFire Micro V","" },
-{0x114F, 0x0073, "Digi International","DataFire Micro V","" },
-{0x114F, 0x00c8, "Digi International","20F0","Digi Neo 2" },
-{0x114F, 0x6001, "Digi International","Avanstar","ACPI\\VEN_HPQ&DEV_6001" },
-{0x1155, 0x0810, "Pine Technology Ltd","","486 CPU/PCI Bridge" },
-{0x1155, 0x0922, "Pine Technology Ltd","2838","Pentium CPU/PCI Bridge" },
-{0x1155, 0x0926, "Pine Technology Ltd","","PCI/ISA Bridge" },
-{0x1158, 0x3011, "Voarx R&D Inc","3011","Tokenet/vg 1001/10m anylan" },
-{0x1158, 0x9050, "Voarx R&D Inc","","Lanfleet/Truevalue" },
-{0x1158, 0x9051, "Voarx R&D Inc","","Lanfleet/Truevalue" },
-{0x1159, 0x0001, "Mutech","MV1000","" },
-{0x1159, 0x0002, "Mutech","MV-1500","Frame Grabber" },
-{0x115D, 0x0003, "Xircom","RBEM56G-100","Cardbus Ethernet 10/100+Modem 56" },
-{0x115D, 0x0005, "Xircom","NEC VersaPro VA70j need to reinstall driver","CardBus Ethernet 10/100" },
-{0x115D, 0x0007, "Xircom","","CardBus Ethernet 10/100" },
-{0x115D, 0x000B, "Xircom","","CardBus Ethernet 10/100" },
-{0x115D, 0x000C, "Xircom","MPCI 3A56GSP-100 PA","Mini-PCI V.90 56k Modem" },
-{0x115D, 0x000F, "Xircom","","CardBus Ethernet 10/100" },
-{0x115D, 0x002b, "Xircom","168c","Winmodem built into NEC Versa VXi" },
-{0x115D, 0x0076, "Xircom","2U6MLA-35295-M5-E","Xircom MPCI3B-56G (Lucent SCORPIO) Soft" },
-{0x115D, 0x00d3, "Xircom","2333333333333","Xircom MPCI Modem 56" },
-{0x115D, 0x00D4, "Xircom","MPCI","Modem 56k" },
-{0x115D, 0x0101, "Xircom","Ms0612006303","CardBus 56k Modem" },
-{0x115D, 0x0103, "Xircom","","CardBus Ehternet + 56k Modem" },
-{0x1161, 0x0001, "PFU Ltd","921014946","Host Bridge" },
-{0x1163, 0x0001, "mohamed alsherif","Verite 1000","3D Blaster" },
-{0x1163, 0x2000, "mohamed alsherif","Rendition V2200 (1179-002)","Rendition V2200 (BLITZ 2200 AGP)" },
-{0x1165, 0x0001, "Imagraph Corporation","","Motion JPEG rec/play w/audio" },
-{0x1165, 0x0060, "Imagraph Corporation"," ","Foresight Imaging I-Color" },
-{0x1165, 0x0088, "Imagraph Corporation","03200-150","AccuStream 50a, 75a & 205a Frame Grabber & Video Streamer" },
-{0x1166, 0x0005, "Broadcom / ServerWorks","NB6536 (CNB20-LE)","PCI to PCI Bridge, bus/dev/func 0/0/1" },
-{0x1166, 0x0006, "Broadcom / ServerWorks","NB6536 (CNB20-HE)","Host Bridge, function 2 and function 3" },
-{0x1166, 0x0007, "Broadcom / ServerWorks","NB6635 (CNB20-LE/HE)","CPU to PCI Bridge" },
-{0x1166, 0x0008, "Broadcom / ServerWorks","NB6536 (CNB20-HE)","Hostbridge & MCH, bus/dev/func 0/0/0" },
-{0x1166, 0x0009, "Broadcom / ServerWorks","NB6536 (CNB20-LE)","AGP interface" },
-{0x1166, 0x0010, "Broadcom / ServerWorks","CIOB30","" },
-{0x1166, 0x0011, "Broadcom / ServerWorks","CMIC-HE","" },
-{0x1166, 0x0012, "Broadcom / ServerWorks","CMIC-LE","" },
-{0x1166, 0x0013, "Broadcom / ServerWorks","CNB20-HE","Hostbridge and MCH" },
-{0x1166, 0x0014, "Broadcom / ServerWorks","CNB20-HE","Host Bridge" },
-{0x1166, 0x0015, "Broadcom / ServerWorks","CMIC-GC","Hostbridge and MCH" },
-{0x1166, 0x0016, "Broadcom / ServerWorks","CMIC-GC","Host Bridge" },
-{0x1166, 0x0017, "Broadcom / ServerWorks","CMIC-SL","" },
-{0x1166, 0x0101, "Broadcom / ServerWorks","CIOB-X2","" },
-{0x1166, 0x0103, "Broadcom / ServerWorks","47553"," " },
-{0x1166, 0x0110, "Broadcom / ServerWorks","CIOB-E","I/O Bridge with Gigabit Ethernet ServerWorks Grand Champion" },
-{0x1166, 0x0200, "Broadcom / ServerWorks","OSB4","PCI to ISA Bridge" },
-{0x1166, 0x0201, "Broadcom / ServerWorks","CSB5","ISA bridge" },
-{0x1166, 0x0203, "Broadcom / ServerWorks","CSB6","PCI to ISA Bridge" },
-{0x1166, 0x0211, "Broadcom / ServerWorks","OSB4","PATA33 Controller" },
-{0x1166, 0x0212, "Broadcom / ServerWorks","CSB5","PATA66" },
-{0x1166, 0x0213, "Broadcom / ServerWorks","CSB6","PATA100 RAID Controller" },
-{0x1166, 0x0217, "Broadcom / ServerWorks","CSB6","PATA100 IDE Controller" },
-{0x1166, 0x0220, "Broadcom / ServerWorks","OSB4","OpenHCI Compliant USB Controller" },
-{0x1166, 0x0221, "Broadcom / ServerWorks","OSB6","OHCI Compliant USB Controller" },
-{0x1166, 0x0223, "Broadcom / ServerWorks","0x0223","USB controller" },
-{0x1166, 0x0225, "Broadcom / ServerWorks","CSB5","PCI Bridge" },
-{0x1166, 0x0227, "Broadcom / ServerWorks","CSB6","PCI Bridge" },
-{0x1166, 0x0230, "Broadcom / ServerWorks","???","PCI to ISA bridge" },
-{0x1166, 0x0240, "Broadcom / ServerWorks","RaidCore4000","Apple K2 SATA AHCI&RAID Controller" },
-{0x1166, 0x0241, "Broadcom / ServerWorks","RC5000Series&BC48(4850L&4852...)","ServerWorks Frodo4 SATA RAID Controller" },
-{0x1166, 0x0242, "Broadcom / ServerWorks","RaidCore4000 Series","ServerWorks Frodo8 8xSATA RAID" },
-{0x1166, 0x024A, "Broadcom / ServerWorks","BC5785","Broadcom5785/Serverworks HT1000 AHCI Controller" },
-{0x1166, 0x024B, "Broadcom / ServerWorks","BC5785","BC5785/ServerWorks HT1000 SATA(IDE MODE)" },
-{0x1166, 0x0252, "Broadcom / ServerWorks","RaidCore5000 Series","ServerWorks Elrond 8xSAS/SATAII" },
-{0x1168, 0x7145, "Thine Electronics Inc","1002","ATI Mobility Radeon X 1400" },
-{0x1169, 0x0102, "Centre f/Dev. of Adv. Computing","QL5032","32 Channel Digital Input Card Interface" },
-{0x1169, 0x0202, "Centre f/Dev. of Adv. Computing","QL5032","16 Channel Digital Output, 16 Channel Digital Input Interface" },
-{0x1169, 0x0302, "Centre f/Dev. of Adv. Computing","QL5032","32 Channel Analog Input Interface" },
-{0x1169, 0x0402, "Centre f/Dev. of Adv. Computing","QL5032","16 Channel Analog Output / Analog Input Interface" },
-{0x1169, 0x0502, "Centre f/Dev. of Adv. Computing","QL5232","8 Channel Timer Counter Interface" },
-{0x1169, 0x0902, "Centre f/Dev. of Adv. Computing","QL5232","PCI to TigerSHARC FPGA Interface" },
-{0x1169, 0x2001, "Centre f/Dev. of Adv. Computing","Ql5032-33APQ208C","PCI to C-DAC RTU bus interface FPGA" },
-{0x116A, 0x6100, "Luminex Software, Inc","","Bus/Tag Channel" },
-{0x116A, 0x6800, "Luminex Software, Inc","","Escon Channel" },
-{0x116A, 0x7100, "Luminex Software, Inc","","Bus/Tag Channel" },
-{0x116A, 0x7800, "Luminex Software, Inc","nvidia harmony","Escon Channel" },
-{0x116E, 0x0015, "Electronics for Imaging","VX120","Fiery EX2000D RIP Card Melbourne VX120" },
-{0x116E, 0x0500, "Electronics for Imaging","Vx500","Printer ASIC" },
-{0x1172, 0x0001, "Altera Corporation","EPF6016ATC144-2","S CCA5000243A" },
-{0x1172, 0x0004, "Altera Corporation","-epf6016qc240-2","Multi-serial card" },
-{0x1172, 0x0007, "Altera Corporation","StratixIIGX","Altera FPGA board" },
-{0x1172, 0x1234, "Altera Corporation","5SGXEA7N","Stratix V FPGA" },
-{0x1172, 0xD4AA, "Altera Corporation","EP1AGX90EF1152C6N","Arria GX" },
-{0x1176, 0x8474, "SBE","42000133","Conexant Multichannel Synchronous Communications Controller (MUSYCC)" },
-{0x1178, 0xAFA1, "Alfa Inc","","Fast Ethernet" },
-{0x1179, 0x8136, "Toshiba corporation","RTL8101E","Realtek 10/100/1000 PCI-E NIC Family" },
-{0x1179, 0x0102, "Toshiba corporation","toshiba america info systems","Trusted Platform Module" },
-{0x1179, 0x0103, "Toshiba corporation","833810","Extended PCI IDE Controller Type-B" },
-{0x1179, 0x1179, "Toshiba corporation","0x8136","PCI\\VEN_8086&DEV_3B03&SUBSYS_02FE1028&REV_05\\3&11583659&0&F8" },
-{0x1179, 0x0201, "Toshiba corporation","PCI\\VEN_1814&DEV_3298&SUBSYS_1451033","Ralink Chipset 802.11b/g WLAN Card" },
-{0x1179, 0x0404, "Toshiba corporation","","" },
-{0x1179, 0x0406, "Toshiba corporation","Tecra a2","Video Capture device" },
-{0x1179, 0x0407, "Toshiba corporation","NVIDIA GeForce 8600M GT","NVIDIA GeForce 8600M GT" },
-{0x1179, 0x051D, "Toshiba corporation","LEN0068","ACPI" },
-{0x1179, 0x0601, "Toshiba corporation","0555873412","Toshiba CPU to PCI bridge" },
-{0x1179, 0x0602, "Toshiba corporation","TOS6205","PCI to ISA Bridge for Notebooks" },
-{0x1179, 0x0603, "Toshiba corporation","ToPIC95","PCI to CardBus Bridge for Notebooks" },
-{0x1179, 0x0604, "Toshiba corporation","PCI\\VEN_104C&DEV_803B&SUBSYS_FF1E1179","PCI to PCI Bridge for Notebooks" },
-{0x1179, 0x0605, "Toshiba corporation","ACPI\\IBM0068","PCI to ISA Bridge for Notebooks" },
-{0x1179, 0x0606, "Toshiba corporation","","PCI to ISA Bridge for Notebooks" },
-{0x1179, 0x0609, "Toshiba corporation","0322","PCI to PCI Bridge for Notebooks" },
-{0x1179, 0x060A, "Toshiba corporation","ToPIC95B","Toshiba ToPIC95 CardBus Controller" },
-{0x1179, 0x060F, "Toshiba corporation","ToPIC97","CardBus Controller" },
-{0x1179, 0x0611, "Toshiba corporation","PNP0510","PCI-ISA Bridge" },
-{0x1179, 0x0617, "Toshiba corporation","ToPIC100","PCI to CardBus Bridge with ZV support" },
-{0x1179, 0x0618, "Toshiba corporation","","CPU to PCI and PCI to ISA Bridge" },
-{0x1179, 0x0701, "Toshiba corporation","1E3D","PCI Communication Device" },
-{0x1179, 0x0804, "Toshiba corporation","0x0804","Toshiba Smart Media Host Controller" },
-{0x1179, 0x0805, "Toshiba corporation","ACPI\\TOS1901\\2&DABA3FF&er.com1","ACPI\\ASD0001\\2&DABA3FF&1" },
-{0x1179, 0x0D01, "Toshiba corporation","0x0D01","FIR Port Type-O" },
-{0x1179, 0x1179, "Toshiba corporation","32","Dispositivo de comunicaciones pci" },
-{0x1179, 0x13A8, "Toshiba corporation","XR17C158/154/152","Multi-channel PCI UART" },
-{0x1179, 0x168, "Toshiba corporation","AREG9485 WB","Qualcomm Atheros AR9485WB-EG wireless Network Adapter" },
-{0x1179, 0x3b64, "Toshiba corporation","intel 3b64","Management Engine Driver" },
-{0x1179, 0x8136, "Toshiba corporation","0x8136","pci\\ven_10 EC" },
-{0x1179, 0x9876, "Toshiba corporation","ACPI\\TOS1901","SD Card Controller" },
-{0x117B, 0x8320, "LG (Lucky Goldstar) Electronics Inc.","NOFM12","VGA" },
-{0x117C, 0x0030, "Atto Technology","ExpressPCI UL5D","Dual-Channel Low-Profile Ultra320 SCSI PCIe Host Bus Adapter" },
-{0x117C, 0x0042, "Atto Technology","ExpressSAS H60F","Low-Profile 16-Internal Port 6Gb/s SAS/SATA PCIe 2.0 Host Bus Adapter" },
-{0x117E, 0x0001, "T/R Systems","","Printer Host" },
-{0x1180, 0x0475, "RicohCompany,Ltd.","RL5c592","Cardbus Controller" },
-{0x1180, 0x0476, "RicohCompany,Ltd.","RL5c476 II","RICOH SmartCard Reader" },
-{0x1180, 0x0478, "RicohCompany,Ltd.","RB5c478","Cardbus Controller" },
-{0x1180, 0x0552, "RicohCompany,Ltd.","R5C552","FireWire (IEEE 1394) Controller" },
-{0x1180, 0x0575, "RicohCompany,Ltd.","44192","I11fXI  <a href=" },
-{0x1180, 0x059, "RicohCompany,Ltd.","1","1" },
-{0x1180, 0x0592, "RicohCompany,Ltd.","0880","Ricoh R5C833 R5C8xx Memory Stick Controller" },
-{0x1180, 0x0822, "RicohCompany,Ltd.","R5C832","SDA Standard Compliant SD Host Controller" },
-{0x1180, 0x0832, "RicohCompany,Ltd.","ACPI\\ENE0100\\4&15458EF3&0","ACPI\\ENE0100\\4&15458EF3&0" },
-{0x1180, 0x0843, "RicohCompany,Ltd.","022E1028","Ricoh SD Host Controller" },
-{0x1180, 0x0847, "RicohCompany,Ltd.","delete","delete" },
-{0x1180, 0x0852, "RicohCompany,Ltd.","R5C852","Ricoh xD-Picture Card Controller" },
-{0x1180, 0x1108, "RicohCompany,Ltd.","30CF","Ricoh Memory Stick Host Controller" },
-{0x1180, 0x2792, "RicohCompany,Ltd.","0x8086","PCI\\VEN_1180&DEV_0852&SUBSYS_022F1028&REV_12 " },
-{0x1180, 0x5551, "RicohCompany,Ltd.","Unknown","IEEE 1394 Controller" },
-{0x1180, 0x852, "RicohCompany,Ltd.","01cf1028 ","Ricoh xD-Picture Card Host Controller;0852h xd picture card controller" },
-{0x1180, 0x9876, "RicohCompany,Ltd.","CC_088000","Ricoh Memory Stick Host Controlle" },
-{0x1180, 0xE230, "RicohCompany,Ltd.","9086104D","Ricoh PCIe Memory Stick " },
-{0x1180, 0xe476, "RicohCompany,Ltd.","Ricoh R5C843","Multipurpose chip, this e476 seems to be the CardBus controller part" },
-{0x1180, 0xe823, "RicohCompany,Ltd.","R5U822","Ricoh PCIe SDXC/MMC Host Controller" },
-{0x1180, 0xe832, "RicohCompany,Ltd.","R5U832","Ricoh PCIe IEEE1394 Fireware Host Controller" },
-{0x1180, 0xE852, "RicohCompany,Ltd.","Uknown","Ricoh PCIe xD-Picture Card Controller" },
-{0x1185, 0x8929, "Dataworld","","EIDE Controller" },
-{0x1186, 0x0100, "D-Link System Inc","88e8003","Ethernet Adapter" },
-{0x1186, 0x1002, "D-Link System Inc","DFE-550TX/580TX/DFE-550FX","Fast Ethernet Adapter" },
-{0x1186, 0x1100, "D-Link System Inc","driv16c003206","Fast Ethernet Adapter" },
-{0x1186, 0x1300, "D-Link System Inc","DL10038C or DL10038E","Realtek RTL8139 Family PCI Fast Ethernet Adapter" },
-{0x1186, 0x1301, "D-Link System Inc","DGE-528T ","Fast Ethernet Adapter" },
-{0x1186, 0x1340, "D-Link System Inc","DFE-690TXD","Fast Ethernet CardBus PC Card" },
-{0x1186, 0x1561, "D-Link System Inc","DRP-32TXD","CardBus PC Card" },
-{0x1186, 0x3065, "D-Link System Inc","14001186","D-Link DFE-500Tx PCI fast Ethernet adapter Re v.A" },
-{0x1186, 0x3106, "D-Link System Inc","DFE 520TX/530TX+ rev E1","Fast Ethernet Adapter" },
-{0x1186, 0x3300, "D-Link System Inc","D-Link Air Wireless Network (DWL-G510)","IEEE 802.11g PCI card" },
-{0x1186, 0x3b00, "D-Link System Inc","0x3b001186","D-LINK DWL-650+" },
-{0x1186, 0x3c09, "D-Link System Inc","DWL-G510 Version C1","Ralink RT61" },
-{0x1186, 0x4000, "D-Link System Inc","DL2000","Gigabit Ethernet Adapter" },
-{0x1186, 0x4001, "D-Link System Inc","DFE-650TX","D Link Fast Ethernet PCMCIA Card" },
-{0x1186, 0x4200, "D-Link System Inc","DFE-520TX_C1","-" },
-{0x1186, 0x4300, "D-Link System Inc","dlg10086","Used on DGE-528T Gigabit adaptor" },
-{0x1186, 0x4302, "D-Link System Inc","dg530t","DGE-530T" },
-{0x1186, 0x4b00, "D-Link System Inc","DGE-560T","D-Link System Inc DGE-560T PCI Express Gigabit Ethernet Adapter (rev 13)" },
-{0x1186, 0x4B01, "D-Link System Inc","DGE-530T","Gigabit Ethernet Adapter" },
-{0x1186, 0x4C00, "D-Link System Inc","DGE-530T","Gigabit Ethernet Adapter" },
-{0x1186, 0x9876, "D-Link System Inc","876","d" },
-{0x1189, 0x1592, "Matsushita Electronics","","VL/PCI Bridge" },
-{0x118C, 0x0014, "Corollary Inc","PCIB","C-bus II to PCI bus host bridge chip" },
-{0x118C, 0x1117, "Corollary Inc","MAC-94C201B3","Corollary/Intel Memory Controller Chip" },
-{0x118D, 0x0001, "BitFlow Inc","n/a","Raptor-PCI framegrabber" },
-{0x118D, 0x0012, "BitFlow Inc","Model 12","Road Runner Frame Grabber" },
-{0x118D, 0x0014, "BitFlow Inc","Model 14","Road Runner Frame Grabber" },
-{0x118D, 0x0024, "BitFlow Inc","Model 24","Road Runner Frame Grabber" },
-{0x118D, 0x0044, "BitFlow Inc","Model 44","Road Runner Frame Grabber" },
-{0x118D, 0x0112, "BitFlow Inc","Model 12","Road Runner Frame Grabber" },
-{0x118D, 0x0114, "BitFlow Inc","Model 14","Road Runner Frame Grabber" },
-{0x118D, 0x0124, "BitFlow Inc","Model 24","Road Runner Frame Grabber" },
-{0x118D, 0x0144, "BitFlow Inc","Model 44","Road Runner Frame Grabber" },
-{0x118D, 0x0212, "BitFlow Inc","Model 12","Road Runner Frame Grabber" },
-{0x118D, 0x0214, "BitFlow Inc","Model 14","Road Runner Frame Grabber" },
-{0x118D, 0x0224, "BitFlow Inc","Model 24","Road Runner Frame Grabber" },
-{0x118D, 0x0244, "BitFlow Inc","Model 44","Road Runner Frame Grabber" },
-{0x118D, 0x0312, "BitFlow Inc","Model 12","Road Runner Frame Grabber" },
-{0x118D, 0x0314, "BitFlow Inc","Model 14","Road Runner Frame Grabber" },
-{0x118D, 0x0324, "BitFlow Inc","Model 24","Road Runner Frame Grabber" },
-{0x118D, 0x0344, "BitFlow Inc","Model 44","Road Runner Frame Grabber" },
-{0x118E, 0x0042, "Hermstedt AG","","" },
-{0x118E, 0x0142, "Hermstedt AG","","" },
-{0x118E, 0x0242, "Hermstedt AG","","" },
-{0x118E, 0x0342, "Hermstedt AG","","" },
-{0x118E, 0x0440, "Hermstedt AG","","" },
-{0x118E, 0x0442, "Hermstedt AG","","" },
-{0x118E, 0x0842, "Hermstedt AG","02321038","red" },
-{0x1190, 0x2550, "Tripace","TC-2550","Single Chip Ultra (Wide) SCSI Processor" },
-{0x1190, 0xC721, "Tripace","","EIDE" },
-{0x1190, 0xC731, "Tripace","TP-910/920/940","PCI Ultra (Wide) SCSI Adapter" },
-{0x1191, 0x0001, "Acard Technology Corp.","","IDE Ctrlr" },
-{0x1191, 0x0002, "Acard Technology Corp.","ATP850UF","UltraDMA33 EIDE Controller (AEC6210UF)" },
-{0x1191, 0x0003, "Acard Technology Corp.","","SCSI-2 cache Cntrlr" },
-{0x1191, 0x0004, "Acard Technology Corp.","4111111111111111","UltraDMA33 EIDE Controller" },
-{0x1191, 0x0005, "Acard Technology Corp.","ATP850UF","UltraDMA33 EIDE Controller (AEC6210UF)" },
-{0x1191, 0x0006, "Acard Technology Corp.","ATP860A","UltraDMA66 EDIE Controller (AEC6260)" },
-{0x1191, 0x0007, "Acard Technology Corp.","ATP860R","UltraDMA66 EIDE Controller (AEC6260)" },
-{0x1191, 0x0008, "Acard Technology Corp.","ATP865","2CH PCI UltraDMA133 IDE Controller" },
-{0x1191, 0x0009, "Acard Technology Corp.","ATP865","AEC6280PATA133|AEC6880 PATA RAID|AEC6290 SATA|AEC6890 SATA RAID|AEC6891 SATA RAID" },
-{0x1191, 0x000a, "Acard Technology Corp.","aec6885","ACARD AEC-6885/6895/6896 RAID Controller" },
-{0x1191, 0x000B, "Acard Technology Corp.","373953244361001","ACARD AEC-6897/6898 RAID Controller" },
-{0x1191, 0x000D, "Acard Technology Corp.","ATP8620","2S1P PCI-X SATA(3G)/UDMA Combo Controller" },
-{0x1191, 0x8001, "Acard Technology Corp.","ATP8600","SCSI-2 RAID (cache?) Adapter (AEC6820U)" },
-{0x1191, 0x8002, "Acard Technology Corp.","ATP850S/5412751206270000","AEC6710S/U/UW SCSI-2 Host Adapter " },
-{0x1191, 0x8010, "Acard Technology Corp.","ATP870","Ultra Wide SCSI Controller" },
-{0x1191, 0x8020, "Acard Technology Corp.","ATP870","AEC6712U/TU Ultra SCSI Controller" },
-{0x1191, 0x8030, "Acard Technology Corp.","ATP870","AEC 6712S/TS Ultra SCSI Controller" },
-{0x1191, 0x8040, "Acard Technology Corp.","ATP870","SCSI Controller" },
-{0x1191, 0x8050, "Acard Technology Corp.","","AEC6715UW Ultra Wide SCSI Controller" },
-{0x1191, 0x8060, "Acard Technology Corp.","4116360015430005","SCSI Host Adapter/PAYPAL.COM/X.COM" },
-{0x1191, 0x8081, "Acard Technology Corp.","5412751206270000","PCI Ultra160 LVD/SE SCSI Adapter" },
-{0x1191, 0x808A, "Acard Technology Corp.","ATP885","AEC6710S/U/UW SCSI-2 Host Adapter" },
-{0x1197, 0x010C, "Gage Applied Technologies","CompuScope 82G","8-bit 2GS/s Analog Input Card" },
-{0x1199, 0x0001, "Attachmate Corp.","IRMA 3270 PCI Adapter","IRMA 3270 PCI Adapter" },
-{0x1199, 0x0002, "Attachmate Corp.","","Advanced ISCA PCI Adapter" },
-{0x1199, 0x0201, "Attachmate Corp.","","SDLC PCI Adapter" },
-{0x119B, 0x1221, "Omega Micro Inc.","82C092G","PCI PCMCIA bridge" },
-{0x119E, 0x0001, "Fujitsu Microelectronics Ltd.","MB86697","FireStream 155 ATM adapter" },
-{0x119E, 0x0003, "Fujitsu Microelectronics Ltd.","MB86695","FireStream 50 ATM adapter" },
-{0x11A8, 0x7302, "Systech Corp.","","NTX-8023-PCI 2MB Long Card" },
-{0x11A8, 0x7308, "Systech Corp.","","NTX-8023-PCI 8MB Long Card" },
-{0x11A8, 0x7402, "Systech Corp.","","NTX-8023-PCI 2MB Short Card" },
-{0x11A8, 0x7408, "Systech Corp.","","NTX-8023-PCI 8MB Short Card" },
-{0x11A9, 0x4240, "InnoSys Inc.","AMCC S5933Q","pci matchmaker 9622qac" },
-{0x11AB, 0x0028, "Marvell Semiconductor","NV05","MCP67 High Definition Audio" },
-{0x11AB, 0x0146, "Marvell Semiconductor","GT-64010/A","System Ctrlr for R4xxx/5000 Family CPUs" },
-{0x11AB, 0x11AB, "Marvell Semiconductor","88E8055 PCI-E","Gigabit Ethernet Controller" },
-{0x11AB, 0x13F8, "Marvell Semiconductor","W8300","802.11 Adapter" },
-{0x11AB, 0x1fa6, "Marvell Semiconductor","88W8310","The Libertas WLAN 802.11b/g" },
-{0x11AB, 0x1FA7, "Marvell Semiconductor","88W8310","Libertas WLAN 802.11b/g" },
-{0x11AB, 0x1fa8, "Marvell Semiconductor","WG311","54M Wireless 802.11b PCI wifi Adapter Card" },
-{0x11AB, 0x1FAA, "Marvell Semiconductor","8335 (MRV8835)","Marvell Libertas 802.11 b/g Wireless (8335)" },
-{0x11AB, 0x2A30, "Marvell Semiconductor","88W8687","PCI-Express 802.11bg Wireless" },
-{0x11AB, 0x4320, "Marvell Semiconductor","88E8001","Marvell Yukon PCI E Gigabit drivers for d" },
-{0x11AB, 0x4350, "Marvell Semiconductor","88E8036","Yukon PCI-E Fast Ethernet Controller" },
-{0x11AB, 0x4351, "Marvell Semiconductor","88E8036","Yukon PCI-E Fast Ethernet Controller" },
-{0x11AB, 0x4352, "Marvell Semiconductor","88E8038","Marvell Yukon 88E8038 PCI-E Fasvt Ethernet Controller" },
-{0x11AB, 0x4353, "Marvell Semiconductor","88E8039","88E8039 PCIe Fast Ethernet Controller" },
-{0x11AB, 0x4354, "Marvell Semiconductor","88E8040","Marvell Yukon 88E8040 PCI-E Fast Ethernet Controller" },
-{0x11AB, 0x4355, "Marvell Semiconductor","88E8001","Marvell Yukon 88E8040T PCI-E Fast Ethernet Controller" },
-{0x11AB, 0x4357, "Marvell Semiconductor","88E8042","marvell ethernet lan No painel " },
-{0x11AB, 0x4360, "Marvell Semiconductor","88E8050","Yukon PCI-E ASF Gigabit Ethernet Controller" },
-{0x11AB, 0x4361, "Marvell Semiconductor","88E8036","Marvell Yukon 88E8036 Network Card" },
-{0x11AB, 0x4362, "Marvell Semiconductor","88E8053","Marvell Yukon 88E8053 PCI-E Gigabit Ethernet Controller" },
-{0x11AB, 0x4363, "Marvell Semiconductor","88E8042","Yukon PCI-E Gigabit Ethernet Controller" },
-{0x11AB, 0x4364, "Marvell Semiconductor","81f81043","Yukon PCI-E Gigabit Ethernet Controller" },
-{0x11AB, 0x4365, "Marvell Semiconductor","88E8070","Yukon Gigabit Controller DRIVER" },
-{0x11AB, 0x436A, "Marvell Semiconductor","88E8058","Marvell Yukon 88E8058" },
-{0x11AB, 0x436b, "Marvell Semiconductor","88E8072","Marvell Yukon 8072" },
-{0x11AB, 0x436C, "Marvell Semiconductor","88E8072","Marvell 8072 Ethernet Nic" },
-{0x11AB, 0x4380, "Marvell Semiconductor","88e8071","Marvell Yukon 88E8057 PCI-E Gigabit Ethernet Controller" },
-{0x11AB, 0x4381, "Marvell Semiconductor","88E8059","Marvell Yukon 88E8059 PCI-E Gigabit Ethernet Controller" },
-{0x11AB, 0x4611, "Marvell Semiconductor","GT-64115","System Controller" },
-{0x11AB, 0x4620, "Marvell Semiconductor","GT-64120","System Controller for R5000 & R7000 (64-bit PCI)" },
-{0x11AB, 0x4801, "Marvell Semiconductor","88w8335","8 port switched ethernet ctrlr" },
-{0x11AB, 0x4809, "Marvell Semiconductor","EV-48300","Evaluation board for the GT-48300" },
-{0x11AB, 0x5005, "Marvell Semiconductor","F5D5005","Belkin Desktop Gigabit PCI card" },
-{0x11AB, 0x5040, "Marvell Semiconductor","88SX5040","4-port SATA I PCI-X Controller" },
-{0x11AB, 0x5041, "Marvell Semiconductor","88SX504","4-port SATA I PCI-X Controller" },
-{0x11AB, 0x5080, "Marvell Semiconductor","RocketRAID 62x","SATA Controller" },
-{0x11AB, 0x5081, "Marvell Semiconductor","RocketRAID 182x","SATA Controller" },
-{0x11AB, 0x6041, "Marvell Semiconductor","MV88SX6041","Marvell Technology Group Ltd. MV88SX6041 4-port SATA II PCI-X Controller (rev 03)" },
-{0x11AB, 0x6081, "Marvell Semiconductor","0007","PCI-X RocketRAID 222x SATA Controller" },
-{0x11AB, 0x6101, "Marvell Semiconductor","88SE6101","PATA 133 One Channel" },
-{0x11AB, 0x6111, "Marvell Semiconductor","?","61xx RAID" },
-{0x11AB, 0x6120, "Marvell Semiconductor","?","61xx RAID" },
-{0x11AB, 0x6121, "Marvell Semiconductor","88SE6121","61xx AHCI" },
-{0x11AB, 0x6122, "Marvell Semiconductor","?","61xx RAID" },
-{0x11AB, 0x6140, "Marvell Semiconductor","4355","61xx RAID" },
-{0x11AB, 0x6145, "Marvell Semiconductor","88SE6145","Marvell 6145 SATA II PCI-E Controller 4 SATA2 300MB/s ports - Thor 4S/1P" },
-{0x11AB, 0x6320, "Marvell Semiconductor","GT-64130/131","System Controller for PowerPC Processors" },
-{0x11AB, 0x6440, "Marvell Semiconductor","88SE6320","64xx/63xx SAS" },
-{0x11AB, 0x6480, "Marvell Semiconductor","MV6446x","PowerPC System Controller" },
-{0x11AB, 0x6485, "Marvell Semiconductor","MV6446x ","Marvel 88SE6480 is the chip on the mainboard" },
-{0x11AB, 0x9128, "Marvell Semiconductor","SE9128","SATA3  6 GB/s  SATA3/Raid Controller" },
-{0x11AB, 0x91A2, "Marvell Semiconductor","91xx","Sata 6G RAID Controller" },
-{0x11AB, 0x9653, "Marvell Semiconductor","GT-96100A","Advanced Communication Controller" },
-{0x11AB, 0x9876, "Marvell Semiconductor","88E8038","marvell yukon 88E8038 pci-e fast ethernet controller" },
-{0x11AB, 0xF003, "Marvell Semiconductor","GT-64010","Primary Image Piranha Image Generator" },
-{0x11AB, 0xF004, "Marvell Semiconductor","GT64120","Primary Image Barracuda Image Generator" },
-{0x11AB, 0xF006, "Marvell Semiconductor","GT-64120A","Primary Image Cruncher Geometry Accelerator" },
-{0x11AB, 0xFFFF, "Marvell Semiconductor","88SA8040","PATA2SATA/SATA2PATA Bridge" },
-{0x11AD, 0x0001, "Lite-On Technology Corp.","LC82C168","Fast Ethernet Adapter" },
-{0x11AD, 0x0002, "Lite-On Technology Corp.","LC82C169","NETGEAR FA310TX Fast Ethernet PCI Adapter" },
-{0x11AD, 0xC115, "Lite-On Technology Corp.","LC82C115","PNIC II PCI MAC/PHY" },
-{0x11AE, 0x4153, "Scitex Corporation Ltd","","Bridge Controller" },
-{0x11AE, 0x5842, "Scitex Corporation Ltd","","Bridge Controller" },
-{0x11AF, 0x0001, "Avid Technology, Inc.","9704","Cinema" },
-{0x11AF, 0x000A, "Avid Technology, Inc."," ","Nitris" },
-{0x11AF, 0x000B, "Avid Technology, Inc."," ","Nitris DX / Mojo DX" },
-{0x11B0, 0x0001, "Quicklogic Corp","V960PBC/PSC","i960 Local Bus to PCI Bridge" },
-{0x11B0, 0x0002, "Quicklogic Corp","V961PBC/PSC","i960Jx Local Bus to PCI Bridge" },
-{0x11B0, 0x0004, "Quicklogic Corp","V962PBC/PSC","i960Cx/Hx Local Bus to PCI Bridge" },
-{0x11B0, 0x0010, "Quicklogic Corp","V292PBC/PSC","Am29K Local Bus to PCI Bridge" },
-{0x11B0, 0x0021, "Quicklogic Corp","V363EPC","i960Sx Local Bus to PCI Bridge" },
-{0x11B0, 0x0022, "Quicklogic Corp","V363EPC","i960Jx Local Bus to PCI Bridge" },
-{0x11B0, 0x0024, "Quicklogic Corp","V363EPC","i960Cx/Hx Local Bus to PCI Bridge" },
-{0x11B0, 0x0030, "Quicklogic Corp","V363EPC","Am29K Local Bus to PCI Bridge" },
-{0x11B0, 0x0100, "Quicklogic Corp","V320USC","PCI System Ctrlr for 32-bit MIPS CPU" },
-{0x11B0, 0x0101, "Quicklogic Corp","V320USC","PCI System Ctrlr for 32-bit MIPS CPU" },
-{0x11B0, 0x0102, "Quicklogic Corp","V320USC","PCI System Ctrlr for Super-H SH3 CPU" },
-{0x11B0, 0x0103, "Quicklogic Corp","V320USC","PCI System Ctrlr for Super-H SH4 CPU" },
-{0x11B0, 0x0200, "Quicklogic Corp","V370PDC","High Performance PCI SDRAM Controller" },
-{0x11B0, 0x0292, "Quicklogic Corp","V292PBC","Am29030/40 Bridge" },
-{0x11B0, 0x0500, "Quicklogic Corp","V340HPC","PCI System Ctrlr for 64-bit MIPS CPU" },
-{0x11B0, 0x0960, "Quicklogic Corp","V96xPBC","i960 Bridges for i960 Processors" },
-{0x11B0, 0x4750, "Quicklogic Corp","V3 V962PBC-40LP / VLSI VP06597A","SCRAMNet" },
-{0x11B0, 0xC960, "Quicklogic Corp","V96DPC","i960 Dual PCI Bridge" },
-{0x11B5, 0x0001, "Radstone Technology Ltd.","PMC/PMX1553","1553 Bus Interface Card" },
-{0x11B5, 0x0002, "Radstone Technology Ltd.","PMCF1","FLASH memory Card" },
-{0x11B5, 0x0003, "Radstone Technology Ltd.","PMCMMA","Multi Media Adapter" },
-{0x11B5, 0x0004, "Radstone Technology Ltd.","PMCVGO","Video Graphics Overlay" },
-{0x11B5, 0x0005, "Radstone Technology Ltd.","PMCPCIS","PPzero Slave Interface Card" },
-{0x11B5, 0x0006, "Radstone Technology Ltd.","PMCPCIM","PPzero Master Interface Card" },
-{0x11B5, 0x0007, "Radstone Technology Ltd.","PMCQ1","Serial/1553 Interface Card" },
-{0x11B5, 0x0008, "Radstone Technology Ltd.","EPMCQ2","Intelligent Serial/Ethernet Card" },
-{0x11B5, 0x0009, "Radstone Technology Ltd.","PMCPIO1","Parallel I/O Module" },
-{0x11B5, 0x000a, "Radstone Technology Ltd.","PMCFA1C","Fibre Channel Adapter" },
-{0x11B5, 0x000b, "Radstone Technology Ltd.","PMCHH1","High Speed DSP Gateway Module" },
-{0x11B5, 0x000c, "Radstone Technology Ltd.","PMCMA2","Memory Adaptor Module" },
-{0x11B5, 0x0012, "Radstone Technology Ltd.","PMCF1","FLASH memory Card (V2)" },
-{0x11B5, 0x0013, "Radstone Technology Ltd.","PMC1553EX","1553 Bus Interface Card" },
-{0x11B5, 0x0014, "Radstone Technology Ltd.","PMC1553E","1553 Bus Interface Card" },
-{0x11B5, 0x2200, "Radstone Technology Ltd.","PMCFA2C","Dual Fibre Channel Adapter" },
-{0x11B8, 0x0001, "Xpoint Technologies Inc","Quad PeerMaster","" },
-{0x11B9, 0xC0ED, "Pathlight Technology Inc.","SSA Ctrlr","" },
-{0x11BC, 0x0001, "Network Peripherals Inc","NPI NuCard","PCI FDDI" },
-{0x11BD, 0x0015, "Pinnacle system","660806-2.0","rob2d" },
-{0x11BD, 0x1111, "Pinnacle system","1456","www.unibobodioulasso.0fees.net" },
-{0x11BD, 0x1158, "Pinnacle system","48","Tunner Royal TS 1" },
-{0x11BD, 0x11BD, "Pinnacle system","MB87J3560","maintenance informatique" },
-{0x11BD, 0x2020, "Pinnacle system","assistance en ligne","70009823/76199706" },
-{0x11BD, 0xBEBE, "Pinnacle system","51015777","MAINTENANCE INFORMATIQUE VENTE DE CONSOMABLE" },
-{0x11BD, 0xBEDE, "Pinnacle system","51014521","Pinnacle Studio 700 PCI" },
-{0x11C1, 0x0440, "LSI Corporation","LT Winmodem 56k","Data+Fax+Voice+DSVD" },
-{0x11C1, 0x0441, "LSI Corporation","5517158","modem driver" },
-{0x11C1, 0x0442, "LSI Corporation","1646T00","LT WinModem 56K Data+Fax" },
-{0x11C1, 0x0443, "LSI Corporation","LT Winmodem","1646T00" },
-{0x11C1, 0x0444, "LSI Corporation","LT Winmodem","845G" },
-{0x11C1, 0x0445, "LSI Corporation","LT Winmodem","" },
-{0x11C1, 0x0446, "LSI Corporation","NVidia SMBus","PCI\\VEN_10DE&DEV_03d1&subsys_26011019&rev_a2\\3&2411e6fe&0&68" },
-{0x11C1, 0x0447, "LSI Corporation","LT Winmodem","windowsme" },
-{0x11C1, 0x0448, "LSI Corporation","LT Winmodem 56k","SV2P2" },
-{0x11C1, 0x0449, "LSI Corporation","LT Winmodem 56k","0449144F" },
-{0x11C1, 0x044A, "LSI Corporation","LT Winmodem 56k","pci ven_1904" },
-{0x11C1, 0x044B, "LSI Corporation","LT Winmodem","USB\\VID_13FD&PID_1650&REV_0446" },
-{0x11C1, 0x044C, "LSI Corporation","LT Winmodem","SV95PL-TOO" },
-{0x11C1, 0x044D, "LSI Corporation","LT Winmodem","" },
-{0x11C1, 0x044E, "LSI Corporation","12232","LT WinModem 56k Data+Fax or Agere F-1156IV/A3" },
-{0x11C1, 0x044F, "LSI Corporation","90094-1","LT V.90+DSL WildFire Modem" },
-{0x11C1, 0x0450, "LSI Corporation","1468VQH19R-1(INT)","LT Winmodem 56K" },
-{0x11C1, 0x0451, "LSI Corporation","LT Winmodem","LT WinModem 56k Data+Fax+Voice+DSVD" },
-{0x11C1, 0x0452, "LSI Corporation","LT Winmodem","1513144" },
-{0x11C1, 0x0453, "LSI Corporation","LT Winmodem","" },
-{0x11C1, 0x0454, "LSI Corporation","LT Winmodem","" },
-{0x11C1, 0x0455, "LSI Corporation","LT Winmodem","" },
-{0x11C1, 0x0456, "LSI Corporation","LT Winmodem","" },
-{0x11C1, 0x0457, "LSI Corporation","LT Winmodem","" },
-{0x11C1, 0x0458, "LSI Corporation","1648C","Mars 3 Mercury v.92 v.44" },
-{0x11C1, 0x0459, "LSI Corporation","LT Winmodem","" },
-{0x11C1, 0x045A, "LSI Corporation","LT Winmodem","" },
-{0x11C1, 0x045D, "LSI Corporation","LT WinModem","mars2" },
-{0x11C1, 0x0461, "LSI Corporation","90094","V90 Wildfire Modem" },
-{0x11C1, 0x0462, "LSI Corporation","1690","56K.V90/ADSL Wildwire Modem" },
-{0x11C1, 0x0464, "LSI Corporation","This is NOT a Riptide! (as previously stated)","Lucent Wildwire v.90 + DSL modem" },
-{0x11C1, 0x0480, "LSI Corporation","Venus Winmodem ","56k.V90/ADSL Wildfire Modem " },
-{0x11C1, 0x048b, "LSI Corporation","1648T00","creative modem blaster di5733-1" },
-{0x11C1, 0x048C, "LSI Corporation","1648c-tv5","net-comm modem" },
-{0x11C1, 0x048d, "LSI Corporation","lt winmodem","9m56pml-g" },
-{0x11C1, 0x048E, "LSI Corporation","svp92pl-t00","56k V.92modem" },
-{0x11C1, 0x048F, "LSI Corporation","SV92P-T00","Agere PCI Soft Modem. SV92PL" },
-{0x11C1, 0x0540, "LSI Corporation","","" },
-{0x11C1, 0x0600, "LSI Corporation","sv5","SV92P-T00 Agere PCI Soft Modem. SV92PL" },
-{0x11C1, 0x0620, "LSI Corporation","SV92PP","Agere PCI Soft Modem " },
-{0x11C1, 0x0630, "LSI Corporation","11c1063011c1","#1: 32 pins, 8 each on 4 sides #2: 20 pins, 10 ea on 2 sides. - hp / compaq - Modem_HP_sp45489" },
-{0x11C1, 0x1040, "LSI Corporation","Prespa","Agere Systems HDA Modem" },
-{0x11C1, 0x11c1, "LSI Corporation","ÐŸÑ€ÐµÑÐ¿Ð°","Agere Systems ÐœÐ¾Ð´ÐµÐ¼ HDA" },
-{0x11C1, 0x3026, "LSI Corporation","0x11c11040","Agere Modem" },
-{0x11C1, 0x3055, "LSI Corporation","Modem on Audio Bus","Agere Systems HDA Modem v6081" },
-{0x11C1, 0x4758, "LSI Corporation","210888GX","Mach64 GX" },
-{0x11C1, 0x5400, "LSI Corporation","OR3TP12","FPSC FPGA with 32/64bit, 33/66MHz core" },
-{0x11C1, 0x5801, "LSI Corporation","","USB Open Host Controller" },
-{0x11C1, 0x5802, "LSI Corporation","USS-312MC","2-port PCI-to-USB OpenHCI Host Ctrlr" },
-{0x11C1, 0x5803, "LSI Corporation","USS-344","QuadraBus 4-port USB OpenHCI Host Ctrlr" },
-{0x11C1, 0x5805, "LSI Corporation","uss344","USB Advanced Host Controller" },
-{0x11C1, 0x5811, "LSI Corporation","FW322/323","1394A PCI PHY/Link Open Host Ctrlr I/F" },
-{0x11C1, 0x5901, "LSI Corporation","FW643","firewire chip for macbook pro" },
-{0x11C1, 0x9876, "LSI Corporation","lucent 1646T00","LT WinModem 56K Data+Fax" },
-{0x11C1, 0xAB20, "LSI Corporation","WaveLAN","PCI Wireless LAN Adapter" },
-{0x11C1, 0xAB30, "LSI Corporation","wlsam48d","Mini-PCI WaveLAN a/b/g" },
-{0x11C1, 0xED00, "LSI Corporation","ET-131x","PCI-E Ethernet Controller" },
-{0x11C6, 0x3001, "Dainippon Screen Mfg. Co","1","VM-1200 Opto Unit Controller" },
-{0x11C8, 0x0658, "Dolphin Interconnect Solutions","PSB 32","32 bit , 33 Mhz PCI-SCI Bridge" },
-{0x11C8, 0xD665, "Dolphin Interconnect Solutions","PSB64","64 bit , 33 Mhz PCI-SCI Bridge" },
-{0x11C8, 0xD667, "Dolphin Interconnect Solutions","PSB66","64 bit , 66 Mhz PCI-SCI Bridge. (D33x)" },
-{0x11C9, 0x0010, "MAGMA","1106","16-line serial port w/DMA" },
-{0x11C9, 0x0011, "MAGMA","","4-line serial port w/DMA" },
-{0x11CB, 0x2000, "Specialix International Ltd.","PCI-9050-1100083-11","port small IC" },
-{0x11CB, 0x4000, "Specialix International Ltd.","SUPI-1","XIO/SIO Host" },
-{0x11CB, 0x8000, "Specialix International Ltd.","T225","Bridge RIO Host" },
-{0x11CE, 0x102B, "Primary Rate Inc","1001","FF00102B" },
-{0x11D1, 0x01F7, "AuraVision Corporation","VxP524","PCI Video Processor" },
-{0x11D1, 0x01F8, "AuraVision Corporation","VxP524","PCI Video Processor" },
-{0x11D1, 0x01f9, "AuraVision Corporation","rev_03","tuner card" },
-{0x11D4, 0x11D4, "Analog Devices, Inc.","1986","AD1988B 8-channel High Definition Audio CODEC" },
-{0x11D4, 0x1535, "Analog Devices, Inc.","ADSP-21535","Blackfin DSP PCI Bus Interface" },
-{0x11D4, 0x1805, "Analog Devices, Inc.","62412-51","U52018.2-0.6" },
-{0x11D4, 0x1884, "Analog Devices, Inc.","AD1884HD","SoundMAX Integrated Digital HD Audio" },
-{0x11D4, 0x1889, "Analog Devices, Inc.","AD1980","Sound Chip" },
-{0x11D4, 0x194A, "Analog Devices, Inc.","AD1984A","SoundMAX Integrated Digital Audio" },
-{0x11D4, 0x1981, "Analog Devices, Inc.","7037","SoundMAX Integrated Digital Audio" },
-{0x11D4, 0x1983, "Analog Devices, Inc.","AD1983HD","SoundMAX Integrated Digital HD Audio" },
-{0x11D4, 0x1984, "Analog Devices, Inc.","Analog Devices ADI 1984","Analog Devices ADI 1984 Integrated HD Audio" },
-{0x11D4, 0x1986, "Analog Devices, Inc.","ADI1986A","SoundMAX Digital HD Audio" },
-{0x11D4, 0x1988, "Analog Devices, Inc.","AD1981","HD Audio Codec" },
-{0x11D4, 0x198B, "Analog Devices, Inc.","AD1988B","SoundMAX AD1988B 8channel CODEC" },
-{0x11D4, 0x2192, "Analog Devices, Inc.","ADSP-2192","DSP Microcomputer (function #0)" },
-{0x11D4, 0x219A, "Analog Devices, Inc.","ADSP-2192","DSP Microcomputer (function #1)" },
-{0x11D4, 0x219E, "Analog Devices, Inc.","ADSP-2192","DSP Microcomputer (function #2)" },
-{0x11D4, 0x2F44, "Analog Devices, Inc.","ADSP-1882","SafeNet Crypto Accelerator chip" },
-{0x11D4, 0x989B, "Analog Devices, Inc.","AD1989B","SoundMax Integrated Digital HD Audio" },
-{0x11D5, 0x0115, "Tahoma Technology","10115","Versatec Parallel Interface (VPI) + Centronics" },
-{0x11D5, 0x0116, "Tahoma Technology","10118","DR11-W emulator" },
-{0x11D5, 0x0117, "Tahoma Technology","10117","Versatec Parallel Interface (VPI) + Centronics" },
-{0x11D5, 0x0118, "Tahoma Technology","10118","DR11-W emulator" },
-{0x11DA, 0x2000, "Novell","2","Virtual-Bus / AlacrityVM bridge" },
-{0x11DB, 0x1234, "Sega Enterprises Ltd","","Dreamcast Broadband Adapter" },
-{0x11DE, 0x6057, "Zoran Corporation","59568","Mc3aDo  <a href=" },
-{0x11DE, 0x6067, "Zoran Corporation","zr36067pqc","zoran" },
-{0x11DE, 0x6120, "Zoran Corporation","ZR36120PQC","MPEG VideoBVPSXI Capture Card" },
-{0x11DE, 0x6057, "Zoran Corporation","ZR36057PQC","ZORAN PCI Bridge (interface for transferring video across the PCI bus)" },
-{0x11DE, 0x9876, "Zoran Corporation","","" },
-{0x11EC, 0x0028, "Coreco Inc","NV05","MCP67 High Definition Audio" },
-{0x11EC, 0x2064, "Coreco Inc","","" },
-{0x11F0, 0x2772, "Triya","FASTline UTP Quattr","PCI\\VEN_8086&DEV_2772&SUBSYS_0CCB105B&REV_02\\3&2411E6FE&0&10" },
-{0x11F0, 0x4, "Triya","FASTline UTP Quattr","PCI\\VEN_8086&DEV_2772&SUBSYS_0CCB105B&REV_02\\3&2411E6FE&0&10" },
-{0x11F0, 0x4231, "Triya","1","2" },
-{0x11F0, 0x4232, "Triya","FASTline UTP Quattr","PCI\\VEN_8086&DEV_2772&SUBSYS_0CCB105B&REV_02\\3&2411E6FE&0&10" },
-{0x11F0, 0x4233, "Triya","FASTline FO","" },
-{0x11F0, 0x4234, "Triya","FASTline UTP","" },
-{0x11F0, 0x4235, "Triya","FASTline-II UTP","" },
-{0x11F0, 0x4236, "Triya","FASTline-II FO","" },
-{0x11F0, 0x4731, "Triya","GIGAline","Gigabit Ethernet Adapter" },
-{0x11F0, 0x9876, "Triya","1","2" },
-{0x11F4, 0x2915, "Kinetic Systems Corporation","2915","" },
-{0x11F6, 0x0112, "Powermatic Data Systems Ltd","ATT2MD11","ReadyLink ENET100-VG4" },
-{0x11F6, 0x0113, "Powermatic Data Systems Ltd","","FreedomLine 100" },
-{0x11F6, 0x1401, "Powermatic Data Systems Ltd","832AE28030680","ReadyLink RL2000" },
-{0x11F6, 0x2011, "Powermatic Data Systems Ltd","TXA9882","ReadyLink  RL100ATX/PCI Fast Ethernet Adapter" },
-{0x11F6, 0x2201, "Powermatic Data Systems Ltd","TXA9883","ReadyLink 100TX (Winbond W89C840)" },
-{0x11F6, 0x9881, "Powermatic Data Systems Ltd","TXA9881?","ReadyLink RL100TX Fast Ethernet Adapter" },
-{0x11F8, 0x7364, "PMC-Sierra Inc.","PM7364","FREEDM-32 Frame Engine & Datalink Mgr" },
-{0x11F8, 0x7366, "PMC-Sierra Inc.","PM7364","FREEDM-8 Frame Engine & Datalink Manager" },
-{0x11F8, 0x7367, "PMC-Sierra Inc.","PM7367","FREEDM-32P32 Frame Engine & Datalink Mgr" },
-{0x11F8, 0x7375, "PMC-Sierra Inc.","PM7375","LASAR-155 ATM SAR" },
-{0x11F8, 0x7380, "PMC-Sierra Inc.","PM7380","FREEDM-32P672 Frm Engine & Datalink Mgr" },
-{0x11F8, 0x7382, "PMC-Sierra Inc.","PM7382","FREEDM-32P256 Frm Engine & Datalink Mgr" },
-{0x11F8, 0x7384, "PMC-Sierra Inc.","PM7384","FREEDM-84P672 Frm Engine & Datalink Mgr" },
-{0x11F8, 0x8000, "PMC-Sierra Inc.","PM8000 SPC","6G SAS/SATA Controller" },
-{0x11F8, 0x8010, "PMC-Sierra Inc.","PM8010 SRC","6G SAS/SATA RAID Controller" },
-{0x11FB, 0x0417, "Datel Inc","417","PCI-417 High Speed A/D Board" },
-{0x11FE, 0x0001, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x0002, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x0003, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x0004, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x0005, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x0006, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x0007, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x0008, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x0009, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x000A, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x000B, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x000C, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x000D, "Comtrol Corp","RocketPort","" },
-{0x11FE, 0x8015, "Comtrol Corp","RocketPort","4-port UART 16954" },
-{0x1202, 0x0001, "Network General Corp","NAIATMPCI","PCI ATM Adapter" },
-{0x1203, 0x0001, "Bayer Corporation Agfa Div","Unknown","Unknown" },
-{0x1204, 0x9876, "Lattice Semiconductor Corp","12","wwDW" },
-{0x1208, 0x4853, "Parsytec GmbH","","HS-Link Device" },
-{0x1209, 0x0100, "Sci Systems Inc","PCI 9054","PLX PCI BRIDGE" },
-{0x120E, 0x0100, "Cyclades Corporation","Cyclom-Y","Multiport Serial Card" },
-{0x120E, 0x0101, "Cyclades Corporation","Cyclom-Y","Multiport Serial Card" },
-{0x120E, 0x0102, "Cyclades Corporation","Cyclom-4Y","Multiport Serial Card" },
-{0x120E, 0x0103, "Cyclades Corporation","Cyclom-4Y","Multiport Serial Card" },
-{0x120E, 0x0104, "Cyclades Corporation","Cyclom-8Y","Multiport Serial Card" },
-{0x120E, 0x0105, "Cyclades Corporation","Cyclom-8Y","Multiport Serial Card" },
-{0x120E, 0x0200, "Cyclades Corporation","Cyclom-Z","Intelligent Multiport Serial" },
-{0x120E, 0x0201, "Cyclades Corporation","Cyclom-Z","Intelligent Serial Card" },
-{0x120E, 0x0300, "Cyclades Corporation","PC300 RX 2","1105" },
-{0x120E, 0x0301, "Cyclades Corporation","PC300 RX 1","" },
-{0x120E, 0x0302, "Cyclades Corporation","PC300 TE 2","" },
-{0x120E, 0x0303, "Cyclades Corporation","PC300 TE 1","teclado" },
-{0x120F, 0x0001, "Essential Communications","Roadrunner","" },
-{0x1210, 0x25f4, "Hyperparallel Technologies","No data","No data" },
-{0x1216, 0x0003, "Purup-Eskofot A/S","188A2L432B","PTM400 PCI Taxi Module" },
-{0x1217, 0x00f7, "O2Micro Inc","0x00f71217","1394 Open Host Controller Interface" },
-{0x1217, 0x1217, "O2Micro Inc","EN-2242","111111111" },
-{0x1217, 0x6729, "O2Micro Inc","OZ6729","PCI to PCMCIA Bridge" },
-{0x1217, 0x673A, "O2Micro Inc","OZ6730","PCI to PCMCIA Bridge" },
-{0x1217, 0x6832, "O2Micro Inc","OZ6832/3","CardBus Controller" },
-{0x1217, 0x6836, "O2Micro Inc","OZ6836/6860","CardBus Controller" },
-{0x1217, 0x6872, "O2Micro Inc","OZ6812","CardBus Controller" },
-{0x1217, 0x6925, "O2Micro Inc","OZ6922","CardBus Controller" },
-{0x1217, 0x6933, "O2Micro Inc","OZ6933","CardBus Controller" },
-{0x1217, 0x6972, "O2Micro Inc","OZ6912","CardBus Controller" },
-{0x1217, 0x7110, "O2Micro Inc","OZ711Mx","MemoryCardBus Accelerator" },
-{0x1217, 0x7112, "O2Micro Inc","","" },
-{0x1217, 0x7113, "O2Micro Inc","0Z711EC1","PCMCIA/SmartCardBus Contoller" },
-{0x1217, 0x7114, "O2Micro Inc","OZ711M1","CardBus Controller" },
-{0x1217, 0x7120, "O2Micro Inc","Unknown device","O2Micro Integrated MMC/SD controller" },
-{0x1217, 0x7130, "O2Micro Inc","501179","O2Micro Integrated MMC/SD/MS/xD/SM Controller" },
-{0x1217, 0x7134, "O2Micro Inc","OZ711MP1/MS1","MemoryCardBus Controller 6-in-1" },
-{0x1217, 0x7135, "O2Micro Inc","OZ711EZ1","MemoryCardBus Contoller" },
-{0x1217, 0x7136, "O2Micro Inc","OZ711SP1","O2Micro CardBus Controller" },
-{0x1217, 0x71E2, "O2Micro Inc","","" },
-{0x1217, 0x7212, "O2Micro Inc","","" },
-{0x1217, 0x7213, "O2Micro Inc","","" },
-{0x1217, 0x7222, "O2Micro Inc","unknow","pci to pcmcia bridge" },
-{0x1217, 0x7223, "O2Micro Inc","OZ711M3/MC3","MemoryCardBus Controller" },
-{0x1217, 0x8130, "O2Micro Inc","0x8130","o2 sd card reader" },
-{0x1217, 0x8231, "O2Micro Inc","OZ600XXX","O2Micro OZ600XXX Memory Card " },
-{0x1217, 0x8330, "O2Micro Inc"," PCI\\VEN_1217&DEV_8331&SUBSYS_049A1028&REV_05\\4&34","Mass storage controller [0180]" },
-{0x1217, 0x8331, "O2Micro Inc","OZ600xxx","O2Micro Integrated MS/PRO controller" },
-{0x121A, 0x0001, "3dfx Interactive Inc","Voodoo","Voodoo 3D Acceleration Chip" },
-{0x121A, 0x0002, "3dfx Interactive Inc","Voodoo2","Voodoo 2 3D Accelerator" },
-{0x121A, 0x0003, "3dfx Interactive Inc","Voodoo Banshee","Voodoo Banshee" },
-{0x121A, 0x0005, "3dfx Interactive Inc","Voodoo3","All Voodoo3 chips, 3000" },
-{0x121A, 0x0007, "3dfx Interactive Inc","Voodoo4","" },
-{0x121A, 0x0009, "3dfx Interactive Inc","Voodoo5","AGP X2, or PCI. Chip: 2x VSA100 with 32Mo" },
-{0x121A, 0x0010, "3dfx Interactive Inc","Rampage","Rev.A AGPx4, 0.25µ, 200/2x200 core/RAM" },
-{0x121A, 0x0057, "3dfx Interactive Inc","Voodoo 3/3000","Avenger" },
-{0x1220, 0x1220, "Ariel Corporation","9622qac","AMCC 5933 TMS320C80 DSP/Imaging Board" },
-{0x1220, 0x4242, "Ariel Corporation"," ","controller audio multimediale" },
-{0x1223, 0x0001, "Artesyn Embedded Technologies","KatanaQp","Real-Time Processing Blade in a standard single-slot AdvancedTCA® formfactor" },
-{0x1223, 0x0002, "Artesyn Embedded Technologies","KosaiPM","Intel® Pentium-M® based AMC Module" },
-{0x1223, 0x0016, "Artesyn Embedded Technologies","PCIe-8120","PCIe-8120 MGW Octasic DSP card " },
-{0x1223, 0x003, "Artesyn Embedded Technologies","Katana3752","Advanced Tri-Processor Blade" },
-{0x1223, 0x004, "Artesyn Embedded Technologies","Katana3750","Advanced Tri-Processor Blade" },
-{0x1223, 0x0044, "Artesyn Embedded Technologies","Memory controller","Memory controller" },
-{0x1223, 0x005, "Artesyn Embedded Technologies","Katana752i","Real-time Processing Blade" },
-{0x1223, 0x006, "Artesyn Embedded Technologies","Katana750i","Real-time Processing Blade" },
-{0x1223, 0x007, "Artesyn Embedded Technologies","CC1000dm","Processor PMC Carrier Card" },
-{0x1223, 0x008, "Artesyn Embedded Technologies","Pm3Gv","Up to 8 E1/T1/J1 interfaces for PMC-compatible baseboards" },
-{0x1223, 0x009, "Artesyn Embedded Technologies","Pm3GE1T1","Third Generation E1 and T1/J1 interfaces for PMC-compatible baseboards" },
-{0x1223, 0x010, "Artesyn Embedded Technologies","SpiderwareSG","SIGTRAN Signalling Gateway Blade" },
-{0x1223, 0x011, "Artesyn Embedded Technologies","SpiderwareSS7","64 SS7 signaling channels on a single blade" },
-{0x1223, 0x012, "Artesyn Embedded Technologies","SpiderSS7","Portable, STREAMS-Based Implementation of the ITU SS7 Protocol Stack" },
-{0x1223, 0x013, "Artesyn Embedded Technologies","Spider FRAME RELAY","STREAMS-Based Frame Relay Implementation" },
-{0x1223, 0x014, "Artesyn Embedded Technologies","Spider STREAMS","Implementation of the UNIX STREAMS Environment" },
-{0x1223, 0x015, "Artesyn Embedded Technologies","Spider DSF","Transparent STREAMS Interface for High Speed LAN or Shared Memory Systems" },
-{0x1223, 0x7207, "Artesyn Embedded Technologies","pcie7207","PCIe7207 Server Accelerator" },
-{0x1224, 0x1000, "Interactive Images","CL560?","Plum Audio, Video and VTR Controller" },
-{0x122D, 0x1206, "Aztech System Ltd","ICH2","Asus" },
-{0x122D, 0x4201, "Aztech System Ltd","MR2800W","AMR 56K modem" },
-{0x122D, 0x50DC, "Aztech System Ltd","pci 120","Audio" },
-{0x122D, 0x80DA, "Aztech System Ltd","3328","Audio" },
-{0x122F, 0x37AF, "Andrew Corp.","0x9030","Reflectometer using PLX 9030" },
-{0x1236, 0x0000, "Sigma Designs, Inc","RealMagic64/GX","SD6425" },
-{0x1236, 0x0531, "Sigma Designs, Inc","MX98715/25","Single Chip Fast Ethernet NIC Controller" },
-{0x1236, 0x3d01, "Sigma Designs, Inc","000","RealMagic/2D" },
-{0x1236, 0x6401, "Sigma Designs, Inc","REALmagic64/GX","GUI" },
-{0x1236, 0x9708, "Sigma Designs, Inc","realmagic64/gx","sd6425" },
-{0x123D, 0x0010, "Engineering Design Team Inc.","PCI-DV","PCI-DV Digital Video Interface" },
-{0x123F, 0x00E4, "C-Cube Microsystems","cl 480","MPEG" },
-{0x123F, 0x6120, "C-Cube Microsystems","12.03","DVD device" },
-{0x123F, 0x8120, "C-Cube Microsystems","176","i440B" },
-{0x123F, 0x8888, "C-Cube Microsystems","12.03","cPEG C 3.0 DVD/MPEG2 Decoder" },
-{0x1241, 0x1603, "DSC Communications","1","keyboard" },
-{0x1242, 0x1460, "JNI Corporation","JNIC-1460","2-Gb/s Fibre Channel-PCI 64-bit 66 MHz" },
-{0x1242, 0x1560, "JNI Corporation","JNIC-1560","Dual Channel 2 Gb/s Fibre Channel-PCI-X" },
-{0x1242, 0x4643, "JNI Corporation","JNI PCI 64-bit Fibrechannel","JNI PCI 64-bit Fibrechannel (needs clone)" },
-{0x1244, 0x0700, "AVM AUDIOVISUELLES MKTG & Computer GmbH","B1","ISDN controller" },
-{0x1244, 0x0800, "AVM AUDIOVISUELLES MKTG & Computer GmbH","C4","ISDN Controller" },
-{0x1244, 0x0A00, "AVM AUDIOVISUELLES MKTG & Computer GmbH","A1","ISDN Controller" },
-{0x1244, 0x0E00, "AVM AUDIOVISUELLES MKTG & Computer GmbH","0x1244","Fritz!PCI 2.0 ISDN Controller" },
-{0x1244, 0x1100, "AVM AUDIOVISUELLES MKTG & Computer GmbH","C2","ISDN Controller" },
-{0x1244, 0x1200, "AVM AUDIOVISUELLES MKTG & Computer GmbH","T1","ISDN Controller" },
-{0x1244, 0x2700, "AVM AUDIOVISUELLES MKTG & Computer GmbH","E13 32A5KYW / 2CAKRCT","DSP TNETD5100GHK / TNETD5015" },
-{0x1244, 0x2900, "AVM AUDIOVISUELLES MKTG & Computer GmbH","-","AVM Fritz!Card DSL v2.0 PCI" },
-{0x124A, 0x10BD, "AEG Electrocom GmbH","82566DM-2","Intel Gigabit network connection" },
-{0x124A, 0x4023, "AEG Electrocom GmbH","BWU713 v2.0","Blitzz Wireless G" },
-{0x124C, 0x0220, "Solitron Technologies Inc.",".","." },
-{0x124D, 0x0000, "Stallion Technologies","EasyConnect 8/32","" },
-{0x124D, 0x0002, "Stallion Technologies","EasyConnect 8/64","" },
-{0x124D, 0x0003, "Stallion Technologies","EasyIO PCI","" },
-{0x124F, 0x0041, "Infortrend Technology Inc","IFT-2000","PCI RAID Controller" },
-{0x1250, 0x1978, "Hitachi Microcomputer System Ltd.","","" },
-{0x1250, 0x2898, "Hitachi Microcomputer System Ltd.","","" },
-{0x1255, 0x1110, "Optibase Ltd.","MPEG Forge","" },
-{0x1255, 0x1210, "Optibase Ltd.","MPEG Fusion","" },
-{0x1255, 0x2110, "Optibase Ltd.","VideoPlex-pci","VideoPlex pci bpc1825 rev a" },
-{0x1255, 0x2120, "Optibase Ltd.","VideoPlex plus","VideoPlex BPC 1851 A" },
-{0x1255, 0x2130, "Optibase Ltd.","VideoQuest","" },
-{0x1256, 0x4201, "Perceptive Solutions Inc.","PCI-2240i","EIDE Adapter" },
-{0x1256, 0x4401, "Perceptive Solutions Inc.","PCI-2220i","Dale EIDE Adapter" },
-{0x1256, 0x5201, "Perceptive Solutions Inc.","PCI-2000","IntelliCache SCSI Adapter" },
-{0x1258, 0x1988, "Gilbarco Inc.","0001","" },
-{0x1259, 0x2503, "Allied Telesyn International","Realtek 8139b","" },
-{0x1259, 0x2560, "Allied Telesyn International","82845G","AT-2560 Fast Ethernet Adapter (i82557B)" },
-{0x1259, 0xc107, "Allied Telesyn International","Realtek 8110S","" },
-{0x125B, 0x0B95, "Asix Electronics Corp.","AX88772A","USB2.0 to 10/100M Fast Ethernet Controller" },
-{0x125B, 0x1400, "Asix Electronics Corp.","AX88140A","ASIX AX88140 Based PCI Fast Ethernet Adapter" },
-{0x125B, 0x1720, "Asix Electronics Corp.","AX88172","USB2 to Fast Ethernet Adapter" },
-{0x125D, 0x0000, "ESS Technology","ESS336H","PCI Fax Modem (early model)" },
-{0x125D, 0x1961, "ESS Technology","Multimedia Device","ESS Solo-1 Soundcard" },
-{0x125D, 0x1968, "ESS Technology","ES2839","Maestro-2 PCI audio accelerator" },
-{0x125D, 0x1969, "ESS Technology","ES1969","Solo-1 PCI AudioDrive family" },
-{0x125D, 0x1978, "ESS Technology","ES1978","ESS Maestro-2E PCI Audiodrive" },
-{0x125D, 0x1980, "ESS Technology","0x0401","subsys_0012103c_rev_12" },
-{0x125D, 0x1988, "ESS Technology","ES1999","ESS Allegro PCI Audio (WDM)" },
-{0x125D, 0x1989, "ESS Technology","ES1980","ESS Maestro 3 PCI Audio Accelerator" },
-{0x125D, 0x1990, "ESS Technology","ES2898S","" },
-{0x125D, 0x1992, "ESS Technology","","" },
-{0x125D, 0x1998, "ESS Technology","Maestro 3i","Maestro 3i" },
-{0x125D, 0x1999, "ESS Technology","ES1980S","TAWE0548S" },
-{0x125D, 0x199B, "ESS Technology","ES1938/41/46 solo audio","Maestro-3.COMM PCI Voice+audio" },
-{0x125D, 0x2808, "ESS Technology","ES336H","PCI Fax Modem (later model)" },
-{0x125D, 0x2828, "ESS Technology","ES2828S","TeleDrive" },
-{0x125D, 0x2838, "ESS Technology","PCI\\VEN_125D&DEV_2838&SUBSYS_2838125D&REV_01","PCI Data Fax Modem" },
-{0x125D, 0x2839, "ESS Technology","2838","Superlink Modem/V.92 chipset 56K" },
-{0x125D, 0x2898, "ESS Technology","2898","TelDrive ES56T-PI family V.90 PCI modem" },
-{0x125F, 0x2084, "Concurrent Technologies Inc.","AMCC S5933","AMCC Bridge + 2 x Super I/O (National PC97338)" },
-{0x1260, 0x3860, "Intersil Corporation","PRISM 2.5 ","PRISM 2.5 802.11b 11Mbps Wireless Controller" },
-{0x1260, 0x3872, "Intersil Corporation","PRISM 3","LAN-Express IEEE 802.11b PCI Adapter" },
-{0x1260, 0x3873, "Intersil Corporation","ISL3886A","PRISMII.5 IEE802.11g Wireless LAN" },
-{0x1260, 0x3886, "Intersil Corporation","200206BE","Creatix CTX405 WLAN Controller / ZyAir G100 - WLAN" },
-{0x1260, 0x3890, "Intersil Corporation","ISL3890","PRISM GT 802.11g 54Mbps Wireless Controller" },
-{0x1260, 0x8130, "Intersil Corporation","HMP8130","NTSC/PAL Video Decoder" },
-{0x1260, 0x8131, "Intersil Corporation","HMP8131","NTSC/PAL Video Decoder" },
-{0x1266, 0x0001, "Microdyne Corp.","023132","NE10/100 Adapter (i82557B)" },
-{0x1266, 0x1910, "Microdyne Corp.","","NE2000Plus (RT8029) Ethernet Adapter" },
-{0x1267, 0x1016, "S.A. Telecommunications","","NICCY PCI card" },
-{0x1267, 0x4243, "S.A. Telecommunications","","Satellite receiver board / MPEG2 decoder" },
-{0x1267, 0x5352, "S.A. Telecommunications","PCR2101","" },
-{0x1267, 0x5A4B, "S.A. Telecommunications","telsatturbo","" },
-{0x1268, 0x0204, "Tektronix","Unknown","Tektronix IO Processor / Tektronix PCI Acquisition Interface Rev 204" },
-{0x126A, 0x2698, "Lexmark International Inc.","631xesb/6321esb/3100","sm bus controller" },
-{0x126A, 0x269B, "Lexmark International Inc.","631xESB/6321ESB/3100","SM Bus Controller" },
-{0x126C, 0x1F1F, "Nortel Networks Corp.","","e-mobility 802.11b Wireless LAN PCI Card" },
-{0x126F, 0x0501, "Silicon Motion","SM501/SM502","Mobile Multimedia Companion Chip (MMCC)" },
-{0x126F, 0x0710, "Silicon Motion","SM710","LynxEM" },
-{0x126F, 0x0712, "Silicon Motion","SM712","LynxEM+" },
-{0x126F, 0x0720, "Silicon Motion","SM720 / SM722","Lynx3DM" },
-{0x126F, 0x0810, "Silicon Motion","SM810","LynxE" },
-{0x126F, 0x0811, "Silicon Motion","SM811","LynxE" },
-{0x126F, 0x0820, "Silicon Motion","SM820","Lynx3D" },
-{0x126F, 0x0910, "Silicon Motion","SM910","SILICON MOTION" },
-{0x126F, 0x2260, "Silicon Motion","SM2260","PCIe SSD (NVMe/AHCI)" },
-{0x1272, 0x0780, "themrtaish","PCI\\VEN_8086&DEV_1C3A&SUBSYS_307c17aa &7rev_04","PCI\\VEN_8086&DEV_1C3A" },
-{0x1272, 0x1272, "themrtaish","PCI\\VEN_8086&DEV_1C3A&CC_078000","PCI\\VEN_8086&DEV_1C3A&SUBSYS_1C3A1458" },
-{0x1272, 0x1c3A, "themrtaish","0X78000","0X78000" },
-{0x1272, 0x9876, "themrtaish","PCI\\VEN_1272&DEV_0780&SUBSYS_00000008&REV_7A\\3&61A","PCI\\VEN_1272&DEV_0780&SUBSYS_00000008&REV_7A\\3&61AAA01&0&58" },
-{0x1273, 0x0002, "Hughes Network Systems","DirecPC","t9p17af-01" },
-{0x1274, 0x1005, "Ensoniq","","Serial PCI Port" },
-{0x1274, 0x1274, "Ensoniq","1880x1274","multimedia audio device" },
-{0x1274, 0x1371, "Ensoniq","ES 1371","Creative AudioPCI (ES1371,ES1373)" },
-{0x1274, 0x1373, "Ensoniq","ES1373","Sound Blaster Audio(PCI)" },
-{0x1274, 0x5000, "Ensoniq","ES1371","AudioPCI" },
-{0x1274, 0x5880, "Ensoniq","5880x","Soundblaster (CT4750)" },
-{0x1274, 0x9876, "Ensoniq","","" },
-{0x1278, 0x0701, "Transtech Parallel Systems","TPE3/TM3","PowerPC Node" },
-{0x1278, 0x1001, "Transtech Parallel Systems","TMB17","TMB17 Motherboard" },
-{0x1279, 0x0060, "Transmeta Corp.","TM8000","Efficeon Virtual Northbridge" },
-{0x1279, 0x0061, "Transmeta Corp.","TMTM8000","Efficeon AGP Bridge" },
-{0x1279, 0x0295, "Transmeta Corp.","","Virtual Northbridge" },
-{0x1279, 0x0395, "Transmeta Corp.","LongRun","Northbridge" },
-{0x1279, 0x0396, "Transmeta Corp.","","SDRAM Controller" },
-{0x1279, 0x0397, "Transmeta Corp.","18490397","BIOS scratchpad" },
-{0x127E, 0x0010, "Winnov L.P.","Unknown","Videum 1000 AV Plus" },
-{0x1282, 0x1282, "Davicom Semiconductor Inc.","DM9102AF","DEV" },
-{0x1282, 0x9009, "Davicom Semiconductor Inc.","DM9009","Ethernet Adapter" },
-{0x1282, 0x9100, "Davicom Semiconductor Inc.","","" },
-{0x1282, 0x9102, "Davicom Semiconductor Inc.","DM9102/A/AF","10/100 Mbps Fast Ethernet Controller" },
-{0x1283, 0x0801, "Waldo","Audio Digital Controller","Audio Digital Controller" },
-{0x1283, 0x673A, "Waldo","IT8330G","IDE Controller" },
-{0x1283, 0x8152, "Waldo","IT8152F/G","Advanced RISC-to-PCI Companion Chip" },
-{0x1283, 0x8172, "Waldo","IT8172G","Ultra RISC (MIPS, SH4) Companion Chip" },
-{0x1283, 0x8211, "Waldo","IT8211F","ATA/ATAPI Controller" },
-{0x1283, 0x8212, "Waldo","ITE8212","ATA 133 IDE RAID Controller" },
-{0x1283, 0x8213, "Waldo","IT8213F","IDE Controller" },
-{0x1283, 0x8330, "Waldo","IT8330G","Host Bridge" },
-{0x1283, 0x8872, "Waldo","IT8871/72","PCI-ISA I/O chip with SMB & Parallel Port" },
-{0x1283, 0x8875, "Waldo","IT8875F","PCI Parallel Port" },
-{0x1283, 0x8888, "Waldo","IT8888F","PCI to ISA Bridge" },
-{0x1283, 0x8889, "Waldo","IT8889F","sound" },
-{0x1283, 0x9876, "Waldo","IT8875F","PCI I/O CARD" },
-{0x1283, 0xE886, "Waldo","IT8330G","PCI to ISA Bridge" },
-{0x1285, 0x0100, "Platform Technologies Inc.","ES1849","Maestro-1 AudioDrive" },
-{0x1287, 0x001E, "LuxSonor Inc.","LS220D","DVD Decoder" },
-{0x1287, 0x001F, "LuxSonor Inc.","LS220C","DVD Decoder" },
-{0x1287, 0x0020, "LuxSonor Inc.","LS242","MPEG/DVD video decoder" },
-{0x1289, 0x1006, "AVC Technology Inc.","1106","1708" },
-{0x128A, 0xF001, "Asante Technologies Inc.","Ethernet 10/100","controller ethernet" },
-{0x128D, 0x0021, "G2 Networks Inc.","","ATM Adapter" },
-{0x1290, 0x0010, "Sord Computer Corp.","?","?" },
-{0x129A, 0x0415, "Curtiss Wright Controls Electronic Systems","PBT-415","PCI 66MHz Analyzer and 33MHz Exerciser" },
-{0x129A, 0x0515, "Curtiss Wright Controls Electronic Systems","PBT-515","PCI 66MHz Analyzer and Exerciser" },
-{0x129A, 0x0615, "Curtiss Wright Controls Electronic Systems","PBT-615","PCI 66MHz and PCI-X 100MHz Bus Analyzer and Exerciser" },
-{0x129A, 0x0715, "Curtiss Wright Controls Electronic Systems","Vanguard PCI/PMC/cPCI","PCI 66MHz and PCI-X 133MHz Bus Analyzer and Exerciser" },
-{0x129A, 0xDD10, "Curtiss Wright Controls Electronic Systems","DPIO","Digital Parallel Input Output Device 32bit, 33MHz PCI bus" },
-{0x129A, 0xDD11, "Curtiss Wright Controls Electronic Systems","DPIO2","Digital Parallel Input Output Device 64bit, 33MHz PCI bus" },
-{0x129A, 0xDD12, "Curtiss Wright Controls Electronic Systems","DPIO2-66","Digital Parallel Input Output Device 64bit, 66MHz PCI bus" },
-{0x12A0, 0x0008, "Allen Bradley Co.","1784-PKTX","Allen-Bradley 1784-PKTX" },
-{0x12A3, 0xECB8, "Lucent Technologies AMR","1646T00","V.92 Lucent Modem" },
-{0x12AA, 0x5568, "SDL Communications Inc.","Wan405","WANic 400 series X.21 controller" },
-{0x12AA, 0x556C, "SDL Communications Inc.","","NAI HSSI Sniffer PCI Adapter" },
-{0x12AB, 0x3000, "Yuan Yuan Enterprise Co. Ltd.","JRS-3DS100","PCI" },
-{0x12AD, 0x0010, "MULTIDATA GmbH","1","HERMES-S0" },
-{0x12AD, 0x0020, "MULTIDATA GmbH","1","HERMES-PRI" },
-{0x12AD, 0x0080, "MULTIDATA GmbH","1","HERMES-PRI/PCIX" },
-{0x12AE, 0x0001, "Alteon Networks Inc.","3C986","ACEnic 1000 BASE-SX Ethernet adapter" },
-{0x12AE, 0x0002, "Alteon Networks Inc.","3C986-T","Copper Gigabit Ethernet Adapter" },
-{0x12B9, 0x00c2, "3Com Corporation","00000005","pci simple communication controller" },
-{0x12B9, 0x1006, "3Com Corporation","5610","5610 56K FaxModem WinModem" },
-{0x12B9, 0x1007, "3Com Corporation","AD1807JS","US Robotics 56K DATA FAX WINMODEM" },
-{0x12B9, 0x1008, "3Com Corporation","USR5610B","USR5610B (0005610-02) 56K Performance Pro Modem (PCI Internal)" },
-{0x12B9, 0x12b9, "3Com Corporation","00000005","pci simple communication controller" },
-{0x12B9, 0x3F0, "3Com Corporation","3CP2977","US Robotics 56K Fax PCI aka Model 0726, V.90 56K Internal Faxmodem" },
-{0x12BA, 0x0032, "Bittware, Inc","Hammerhead-Lite-PCI","DSP Prototyping & Development Card" },
-{0x12BA, 0x0041, "Bittware, Inc","Stratix5 Family FPGA","Altera FPGA" },
-{0x12C1, 0x9080, "GMM Research Corp.","Sync4hs/CCP/PCI/MP","Communications Processor" },
-{0x12C3, 0x0058, "Holtek Microelectronics Inc.","HT80232","LAN Adapter (NE2000-compatible)" },
-{0x12C3, 0x5598, "Holtek Microelectronics Inc.","HT80229","Ethernet Adapter (NE2000-compatible)" },
-{0x12C4, 0x0001, "Connect Tech Inc.","","" },
-{0x12C4, 0x0002, "Connect Tech Inc.","","" },
-{0x12C4, 0x0003, "Connect Tech Inc.","","" },
-{0x12C4, 0x0004, "Connect Tech Inc.","","" },
-{0x12C4, 0x0005, "Connect Tech Inc.","Blue Heat-8 RS232","BlueHeat 8 Port RS232 Serial Board" },
-{0x12C4, 0x0006, "Connect Tech Inc.","","" },
-{0x12C4, 0x0007, "Connect Tech Inc.","","" },
-{0x12C4, 0x0008, "Connect Tech Inc.","","" },
-{0x12C4, 0x0009, "Connect Tech Inc.","","" },
-{0x12C4, 0x000A, "Connect Tech Inc.","","" },
-{0x12C4, 0x000B, "Connect Tech Inc.","","" },
-{0x12C4, 0x000C, "Connect Tech Inc.","","" },
-{0x12C4, 0x000D, "Connect Tech Inc.","","" },
-{0x12C4, 0x000E, "Connect Tech Inc.","","" },
-{0x12C4, 0x000F, "Connect Tech Inc.","","" },
-{0x12C4, 0x0300, "Connect Tech Inc.","","" },
-{0x12C4, 0x0301, "Connect Tech Inc.","","" },
-{0x12C4, 0x0302, "Connect Tech Inc.","","" },
-{0x12C4, 0x0303, "Connect Tech Inc.","","" },
-{0x12C4, 0x0304, "Connect Tech Inc.","","" },
-{0x12C4, 0x0305, "Connect Tech Inc.","","" },
-{0x12C4, 0x0306, "Connect Tech Inc.","","" },
-{0x12C4, 0x0307, "Connect Tech Inc.","","" },
-{0x12C4, 0x0308, "Connect Tech Inc."," 32","Starcom UM100 Wireless modem for WiMax " },
-{0x12C4, 0x0309, "Connect Tech Inc.","","" },
-{0x12C4, 0x030A, "Connect Tech Inc.","","" },
-{0x12C4, 0x030B, "Connect Tech Inc.","","" },
-{0x12C5, 0x007F, "Picture Elements Inc.","ISE","PEI Imaging Subsystem Engine" },
-{0x12C5, 0x0081, "Picture Elements Inc.","PCIVST","PCI Thresholding Engine" },
-{0x12C5, 0x0085, "Picture Elements Inc.","","Video Simulator/Sender" },
-{0x12C5, 0x0086, "Picture Elements Inc.","THR2","Multi-scale Thresholder" },
-{0x12C7, 0x0546, "Dialogic Corp.","kssjsjj","D120JCT-LS Card" },
-{0x12C7, 0x0561, "Dialogic Corp.","","BRI/2 Type Card (Voice Driver)" },
-{0x12C7, 0x0647, "Dialogic Corp.","","D/240JCT-T1 Card" },
-{0x12C7, 0x0648, "Dialogic Corp.","064812C7","D/300JCT-E1 Card" },
-{0x12C7, 0x0649, "Dialogic Corp.","030000","D/300JCT-E1 Card" },
-{0x12C7, 0x0651, "Dialogic Corp.","","MSI PCI Card" },
-{0x12C7, 0x0673, "Dialogic Corp.","","BRI/160-PCI Card" },
-{0x12C7, 0x0674, "Dialogic Corp.","","BRI/120-PCI Card" },
-{0x12C7, 0x0675, "Dialogic Corp.","","BRI/80-PCI Card" },
-{0x12C7, 0x0676, "Dialogic Corp.","067612C7","D/41JCT Card" },
-{0x12C7, 0x0685, "Dialogic Corp.","","D/480JCT-2T1 Card" },
-{0x12C7, 0x0687, "Dialogic Corp.","","D/600JCT-2E1 (75 Ohm) Card" },
-{0x12C7, 0x0689, "Dialogic Corp.","D/600JCT-2E1","Dialogic 2E1 - JCT series" },
-{0x12C7, 0x0707, "Dialogic Corp.","","D/320JCT (Resource Only) Card" },
-{0x12C7, 0x0708, "Dialogic Corp.","","D/160JCT (Resource Only) Card" },
-{0x12CB, 0x0027, "Antex Electronics Corp.","StudioCard","studiocard" },
-{0x12CB, 0x002D, "Antex Electronics Corp.","BX-12","agp" },
-{0x12CB, 0x002E, "Antex Electronics Corp.","SC-2000","" },
-{0x12CB, 0x002F, "Antex Electronics Corp.","LX-44","" },
-{0x12CB, 0x0030, "Antex Electronics Corp.","SC-22","" },
-{0x12CB, 0x0031, "Antex Electronics Corp.","BX-44","" },
-{0x12CB, 0x0032, "Antex Electronics Corp.","LX-24M","20-bit 2-in, 4-out audio card w/MPEG-2" },
-{0x12CB, 0x0033, "Antex Electronics Corp.","LX-22M","" },
-{0x12CB, 0x0034, "Antex Electronics Corp.","BX-8","" },
-{0x12CB, 0x0035, "Antex Electronics Corp.","BX-12e","" },
-{0x12D1, 0x1001, "Huawei Technologies Co., Ltd.","MSM6246","Huawei E1750 3G modem (labled T-Mobile" },
-{0x12D1, 0x1003, "Huawei Technologies Co., Ltd.","173","HUAWEI Mobile Connect - 3G Modem" },
-{0x12D1, 0x140B, "Huawei Technologies Co., Ltd.","EC159","HUAWEI MOBILE BROADBAND MODEM" },
-{0x12D1, 0x1412, "Huawei Technologies Co., Ltd.","09HT1407","MW6208E" },
-{0x12D1, 0x1446, "Huawei Technologies Co., Ltd.","E1800","3G Modem" },
-{0x12D1, 0x14c5, "Huawei Technologies Co., Ltd.","K4204","HSPA+ USB Stick" },
-{0x12D1, 0x1506, "Huawei Technologies Co., Ltd.","E5776","Huawei Technologies Co., Ltd. E398 LTE/UMTS/GSM Modem/Networkcard" },
-{0x12D1, 0x1520, "Huawei Technologies Co., Ltd.","-e620","-vodacom mobile connect" },
-{0x12D1, 0x1802, "Huawei Technologies Co., Ltd.","unknown","unknown" },
-{0x12D1, 0x3609, "Huawei Technologies Co., Ltd.","N/A","M88++" },
-{0x12D4, 0x0301, "Ulticom, Inc.","EP1S","SS7 Telecommunications Interface Adapter" },
-{0x12D5, 0x1000, "Equator Technologies","MAP-CA","Broadband Signal Processor" },
-{0x12D5, 0x1002, "Equator Technologies","MAP-1000","Digital Signal Processor" },
-{0x12D8, 0x2304, "Pericom Semiconductor","PI7C9X2G304SL","GENII PCI Express Packet Switch" },
-{0x12D8, 0x71E2, "Pericom Semiconductor","PI7C7300","3 Port PCI to PCI bridge" },
-{0x12D8, 0x8140, "Pericom Semiconductor","PI7C8140","4 Port PCI to PCI bridge" },
-{0x12D8, 0x8150, "Pericom Semiconductor","PI7C8150","2-Port PCI to PCI Bridge" },
-{0x12D8, 0x8152, "Pericom Semiconductor","PI7C8152","2-Port PCI-To-PCI Bridge" },
-{0x12D8, 0xA404, "Pericom Semiconductor","PI7C9X20404SL","PCIe Packet Switch" },
-{0x12D8, 0xE111, "Pericom Semiconductor","P17C9X","PCI to PCIe Bridge" },
-{0x12D8, 0xe130, "Pericom Semiconductor","PI7C9X130","PCI-X Bridge" },
-{0x12DB, 0x0003, "Annapolis Micro Systems Inc.","","FoxFire II" },
-{0x12DE, 0x0200, "Rainbow Technologies","2005063294","Cryptoswift 200" },
-{0x12DF, 0x2102, "SBS Technologies Inc.","Infineon PEB 20534","Communications Controller" },
-{0x12DF, 0x8236, "SBS Technologies Inc.","Unknown","PCI Controller" },
-{0x12E0, 0x0010, "Chase Research PLC","ST16C654","Quad UART" },
-{0x12E0, 0x0020, "Chase Research PLC","ST16C654","Quad UART" },
-{0x12E0, 0x0030, "Chase Research PLC","ST16C654","Quad UART" },
-{0x12E4, 0x1000, "Brooktrout Technology Inc.","TR1000 PRI","PRI Controller" },
-{0x12E4, 0x1140, "Brooktrout Technology Inc.","NV34","ISDN Controller" },
-{0x12E4, 0xB005, "Brooktrout Technology Inc.","TR1000 BRI","BRI Controller" },
-{0x12E4, 0xB006, "Brooktrout Technology Inc.","TR1000 BRI","BRI Controller" },
-{0x12EB, 0x0001, "Aureal Semiconductor","AU8820","Vortex 1 Digital Audio Processor" },
-{0x12EB, 0x0002, "Aureal Semiconductor","AU8830A2","Vortex 2 Audio Processor" },
-{0x12EB, 0x0003, "Aureal Semiconductor","312EB&REV3","Aureal Soundcard" },
-{0x12EC, 0x8139, "3A International Inc.","0xxxx","0xxxx" },
-{0x12EC, 0x8140, "3A International Inc.","10","asf" },
-{0x12F2, 0x1002, "Gammagraphx Inc.","215RAAGCGA11F","Grapics Radeon X850" },
-{0x12F2, 0x3059, "Gammagraphx Inc.","VT8235","AC97 Enhanced Audio Controller - the 8251 controller is different" },
-{0x12F8, 0x0002, "Electronic-Design GmbH","VideoMaker","s3 trio" },
-{0x12FC, 0x5cec, "Capital Equipment Corp","PCI-488 GPIB","IEEE 488" },
-{0x1303, 0x0001, "Innovative Integration","0239","cM67 CompactPCI DSP Card" },
-{0x1303, 0x0002, "Innovative Integration","1","M44/cM44 DSP board" },
-{0x1303, 0x0003, "Innovative Integration","1","Quattro6x DSP board" },
-{0x1303, 0x0004, "Innovative Integration","1","Chico/ChicoPlus Data Acquisition Board" },
-{0x1303, 0x0005, "Innovative Integration","1","Code Hammer Jtag Debugger board" },
-{0x1303, 0x0006, "Innovative Integration","1","Matador DSP board" },
-{0x1303, 0x0007, "Innovative Integration","1","Quixote DSP board" },
-{0x1303, 0x0008, "Innovative Integration","1","Quadia C64x DSP" },
-{0x1303, 0x0009, "Innovative Integration","1","Quadia DSP Baseboard" },
-{0x1304, 0x0004, "Juniper Networks Inc.","PTX SAm FPGA","PTX SAM FPGA" },
-{0x1307, 0x0001, "ComputerBoards","PCI-DAS1602/16","" },
-{0x1307, 0x0006, "ComputerBoards","PCI-GPIB","PCI 488.2" },
-{0x1307, 0x000B, "ComputerBoards","PCI-DIO48H","" },
-{0x1307, 0x000C, "ComputerBoards","PCI-PDISO8","" },
-{0x1307, 0x000D, "ComputerBoards","PCI-PDISO16","" },
-{0x1307, 0x000F, "ComputerBoards","PCI-DAS1200","" },
-{0x1307, 0x0010, "ComputerBoards","PCI-DAS1602/12","" },
-{0x1307, 0x0014, "ComputerBoards","PCI-DIO24H","24 Bit Digital Input/Output Board" },
-{0x1307, 0x0015, "ComputerBoards","PCI-DIO24H/CTR3","" },
-{0x1307, 0x0016, "ComputerBoards","PCI-DIO24H/CTR16","" },
-{0x1307, 0x0017, "ComputerBoards","PCI-DIO96H","" },
-{0x1307, 0x0018, "ComputerBoards","PCI-CTR05","" },
-{0x1307, 0x0019, "ComputerBoards","PCI-DAS1200/JR","xkbhavu" },
-{0x1307, 0x001A, "ComputerBoards","PCI-DAS1001","" },
-{0x1307, 0x001B, "ComputerBoards","PCI-DAS1002","" },
-{0x1307, 0x001C, "ComputerBoards","PCI-DAS1602JR/16","AR2425" },
-{0x1307, 0x001D, "ComputerBoards","PCI-DAS6402/16","" },
-{0x1307, 0x001E, "ComputerBoards","PCI-DAS6402/12","" },
-{0x1307, 0x001F, "ComputerBoards","PCI-DAS16/M1","" },
-{0x1307, 0x0020, "ComputerBoards","PCI-DDA02/12","" },
-{0x1307, 0x0021, "ComputerBoards","PCI-DDA04/12","" },
-{0x1307, 0x0022, "ComputerBoards","PCI-DDA08/12","" },
-{0x1307, 0x0023, "ComputerBoards","PCI-DDA02/16","" },
-{0x1307, 0x0024, "ComputerBoards","PCI-DDA04/16","" },
-{0x1307, 0x0025, "ComputerBoards","PCI-DDA08/16","" },
-{0x1307, 0x0026, "ComputerBoards","PCI-DAC04/12-HS","" },
-{0x1307, 0x0027, "ComputerBoards","PCI-DAC04/16-HS","" },
-{0x1307, 0x0028, "ComputerBoards","PCI-DIO24","24 Bit Digital Input/Output Board" },
-{0x1307, 0x0029, "ComputerBoards","PCI-DAS08","" },
-{0x1307, 0x002C, "ComputerBoards","PCI-INT32","PCI-INT32" },
-{0x1307, 0x0033, "ComputerBoards","PCI-DUAL-AC5","" },
-{0x1307, 0x0034, "ComputerBoards","PCI-DAS-TC","" },
-{0x1307, 0x0035, "ComputerBoards","PCI-DAS64/M1/16","65+6" },
-{0x1307, 0x0036, "ComputerBoards","PCI-DAS64/M2/16","Dell" },
-{0x1307, 0x0037, "ComputerBoards","PCI-DAS64/M3/16","" },
-{0x1307, 0x004C, "ComputerBoards","PCI-DAS1000","" },
-{0x1307, 0x004D, "ComputerBoards","PCI-QUAD04","" },
-{0x1307, 0x0064, "ComputerBoards","PCI-CTR10","10 channels, 16 bit counter/timer with 32-Bits of Digital I/O" },
-{0x1307, 0x0361, "ComputerBoards","?","?" },
-{0x1308, 0x0001, "Jato Technologies Inc.","","NetCelerator Adapter" },
-{0x130B, 0x130b, "Colorgraphic Communications Corp","0x9876","0x9876" },
-{0x1310, 0x0003, "Gespac","9060","CompactPCI Interface" },
-{0x1310, 0x000D, "Gespac","","FPGA PCI Bridge" },
-{0x1317, 0x0531, "ADMtek Inc","nm0403A03461H121S122P","ADMtek AN986" },
-{0x1317, 0x0981, "ADMtek Inc","AN981","FastNIC 10/100 Fast Ethernet Adapter" },
-{0x1317, 0x0985, "ADMtek Inc","an983B","Linksys LNE 100TX Fast Ethernet Adapter(LNE100TX v4)" },
-{0x1317, 0x1985, "ADMtek Inc","AN985","CardBus 10/100 Fast Ethernet&#1050;&#1086;&#1085;&#1090;&#1088;&#1086;&#1083;&#1083;&#1077;&#1088;" },
-{0x1317, 0x2850, "ADMtek Inc","016","HSP56 MicroModem" },
-{0x1317, 0x5120, "ADMtek Inc","ADM5120","ADMtek ADM5120 SOC (rev: 0)" },
-{0x1317, 0x7892, "ADMtek Inc","PCT 789T-A","HSP56 MicroModem" },
-{0x1317, 0x8201, "ADMtek Inc","ADM8211","802.11b Wireless PCI Card" },
-{0x1317, 0x9511, "ADMtek Inc","ADM9511","PCI 10/100 Fast Ethernet Adapter" },
-{0x1317, 0x9513, "ADMtek Inc","ADM9513","PCI 10/100 Fast Ethernet Adapter" },
-{0x1317, 0x8201, "ADMtek Inc","13d1","1317" },
-{0x1318, 0x0911, "Packet Engines, Inc.","G-NIC II","1000BT Network Interface Card" },
-{0x1319, 0x0801, "Forte Media","FM0801-as","PCI Card MediaForte made in singapore (driver - ct" },
-{0x1319, 0x0802, "Forte Media","FM801-as","Xwave PCI Joystick" },
-{0x1319, 0x1000, "Forte Media","FM801-as","PCI Audio" },
-{0x1319, 0x1001, "Forte Media","FM801","Joystick" },
-{0x1319, 0x1319, "Forte Media","FM0801-as","Xwave PCI audio controller" },
-{0x1319, 0x4901, "Forte Media","FM801-AU","ForteMedia PCI Audio Card" },
-{0x1319, 0x802, "Forte Media","fm801-au","PCI Audio" },
-{0x131F, 0x2002, "SIIG","72svec","CyberSerial 16850" },
-{0x131F, 0x2011, "SIIG","1655","Siig Inc Duet 1S(16550)+1P" },
-{0x131F, 0x2012, "SIIG","","Duet 1S(16850)+1P" },
-{0x131F, 0x2020, "SIIG","SIIG cyber8000","Communication controller" },
-{0x131F, 0x2030, "SIIG","SIIG CyberSerial PCI 16C550","SIIG Cyber Serial Dual PCI Board" },
-{0x131F, 0x2042, "SIIG","","Trio 1S(16850)+2P" },
-{0x131F, 0x2050, "SIIG","Siig Inc CyberSerial (4-port) 16550","Siig Inc CyberSerial (4-port) 16550" },
-{0x131F, 0x2051, "SIIG","","CyberSerial 16650" },
-{0x131F, 0x2052, "SIIG","","CyberSerial 16850" },
-{0x131F, 0x2060, "SIIG","JJ_P21022-B","Trio 2S(16550)+1P" },
-{0x131F, 0x2061, "SIIG","","Trio 2S(16650)+1P" },
-{0x131F, 0x2062, "SIIG","1969","Trio 2S(16850)+1P" },
-{0x131F, 0x9876, "SIIG","JJ_P21022-B","Trio 2S(16550)+1P" },
-{0x1328, 0x2048, "CIFELLI SYSTEMS CORPORATION","","" },
-{0x1328, 0x8888, "CIFELLI SYSTEMS CORPORATION","rev 1.5","cPEG™ C 3.0 DVD/MPEG2 decoder" },
-{0x1332, 0x5410, "Curtiss-Wright Controls Embedded Computing","MM-5410D","PCI 32bit Bulk Memory w/DMA" },
-{0x1332, 0x5415, "Curtiss-Wright Controls Embedded Computing","MM-5415CN","PCI Battery Backed SDRAM Adapter" },
-{0x1332, 0x5425, "Curtiss-Wright Controls Embedded Computing","MM-5425CN","PCI Memory Module with Battery Backup" },
-{0x1332, 0x6140, "Curtiss-Wright Controls Embedded Computing","MM-6140D","Memory Module" },
-{0x133D, 0x1000, "Prisa Networks","SST-5136-PFB-PCI","Industrial I/O Card" },
-{0x1344, 0x3240, "Micron Technology, Inc.","","CopperHead CopperTail SC1 AMC AC97" },
-{0x1344, 0x3320, "Micron Technology, Inc.","MT8LLN21PADF","North Bridge" },
-{0x1344, 0x3321, "Micron Technology, Inc.","21PAD","North Bridge" },
-{0x1344, 0x3470, "Micron Technology, Inc.","MT7LLN22NCNE","South Bridge" },
-{0x1344, 0x4020, "Micron Technology, Inc.","123","CopperHead CopperTail SC1 IDE Controller4" },
-{0x1344, 0x4030, "Micron Technology, Inc.","","CopperHead CopperTail SC1 USB Controller" },
-{0x134A, 0x0001, "DTC Technology Corp.","F01 2ASV17184.1","Domex DMX 3191D PCI SCSI Controller" },
-{0x134A, 0x0002, "DTC Technology Corp.","","Domex DMX3192U/3194UP SCSI Adapter" },
-{0x134A, 0x3510, "DTC Technology Corp.","DTC50C18","scsi" },
-{0x134D, 0x2188, "PCTEL Inc.","fa82537ep","intel" },
-{0x134D, 0x2189, "PCTEL Inc.","HSP688T","pctel HSP56 V92 PCI Modem" },
-{0x134D, 0x2486, "PCTEL Inc.","82537","V.92 MDC Modem" },
-{0x134D, 0x7890, "PCTEL Inc.","8086","HSP56 MicroModem" },
-{0x134D, 0x7891, "PCTEL Inc.","PCT 789T-c1","HSP MicroModem 56" },
-{0x134D, 0x7892, "PCTEL Inc.","PCT 789T-A","HSP56 MicroModem" },
-{0x134D, 0x7893, "PCTEL Inc.","S911 K017","HSP MicroModem 56" },
-{0x134D, 0x7894, "PCTEL Inc.","688w","HSP MicroModem 56" },
-{0x134D, 0x7895, "PCTEL Inc.","PCT789T","HSP MicroModem 56" },
-{0x134D, 0x7896, "PCTEL Inc.","pct789t-c","HSP MicroModem 56" },
-{0x134D, 0x7897, "PCTEL Inc.","97860963","HSP MicroModem 56/PCT789T" },
-{0x134D, 0x9714, "PCTEL Inc.","PCT 288-1A","PCTEL" },
-{0x134D, 0xD800, "PCTEL Inc.","pct388p-a","pctel 56k modem" },
-{0x134D, 0x8086, "PCTEL Inc.","hfp56","dev" },
-{0x135A, 0x0042, "Brain Boxes Limited","16550","4-port RS-232" },
-{0x135A, 0x0181, "Brain Boxes Limited","16550","PCI LPT and RS-232" },
-{0x135A, 0x0224, "Brain Boxes Limited","PLX9050","PLX PCI Bus Logic" },
-{0x135A, 0x0228, "Brain Boxes Limited","f97260118","pq100akj9737" },
-{0x135E, 0x0EC3, "Sealevel Systems Inc.","8012e","PCIe 8 Relay Output/8 Isolated Input Board " },
-{0x135E, 0x5101, "Sealevel Systems Inc.","5101","Route 56" },
-{0x135E, 0x5102, "Sealevel Systems Inc.","PCI-ACB","RS-232 synchronous card" },
-{0x135E, 0x7101, "Sealevel Systems Inc.","","Single Port RS-232/422/485/520" },
-{0x135E, 0x7201, "Sealevel Systems Inc."," ","Dual Port RS-232/422/485 Interface" },
-{0x135E, 0x7202, "Sealevel Systems Inc.","","Dual Port RS-232 Interface" },
-{0x135E, 0x7401, "Sealevel Systems Inc.","","Four Port RS-232 Interface" },
-{0x135E, 0x7402, "Sealevel Systems Inc.","","Four Port RS-422/485 Interface" },
-{0x135E, 0x7801, "Sealevel Systems Inc.","","Eight Port RS-232 Interface" },
-{0x135E, 0x8001, "Sealevel Systems Inc.","8001","Digital I/O Adapter" },
-{0x1360, 0x0101, "Meinberg Funkuhren GmbH & Co. KG","PCI32","DCF77 Radio Clock" },
-{0x1360, 0x0102, "Meinberg Funkuhren GmbH & Co. KG","PCI509","DCF77 Radio Clock" },
-{0x1360, 0x0103, "Meinberg Funkuhren GmbH & Co. KG","PCI510","DCF77 Radio Clock" },
-{0x1360, 0x0104, "Meinberg Funkuhren GmbH & Co. KG","PCI511","DCF77 Radio Clock" },
-{0x1360, 0x0105, "Meinberg Funkuhren GmbH & Co. KG","PEX511","DCF77 Receiver" },
-{0x1360, 0x0106, "Meinberg Funkuhren GmbH & Co. KG","PZF180PEX","High Precision DCF77 Radio Clock" },
-{0x1360, 0x0201, "Meinberg Funkuhren GmbH & Co. KG","GPS167PCI","GPS Receiver" },
-{0x1360, 0x0202, "Meinberg Funkuhren GmbH & Co. KG","GPS168PCI","GPS Receiver" },
-{0x1360, 0x0203, "Meinberg Funkuhren GmbH & Co. KG","GPS169PCI","GPS Receiver" },
-{0x1360, 0x0204, "Meinberg Funkuhren GmbH & Co. KG","GPS170PCI","GPS Receiver" },
-{0x1360, 0x0205, "Meinberg Funkuhren GmbH & Co. KG","GPS170PEX","GPS Receiver" },
-{0x1360, 0x0206, "Meinberg Funkuhren GmbH & Co. KG","GPS180PEX","GPS receiver" },
-{0x1360, 0x0207, "Meinberg Funkuhren GmbH & Co. KG","GLN180PEX","GPS/GLONASS receiver" },
-{0x1360, 0x0208, "Meinberg Funkuhren GmbH & Co. KG","GPS180AMC","GPS Receiver" },
-{0x1360, 0x0301, "Meinberg Funkuhren GmbH & Co. KG","TCR510PCI","IRIG Timecode Reader" },
-{0x1360, 0x0302, "Meinberg Funkuhren GmbH & Co. KG","TCR167PCI","IRIG Timecode Reader" },
-{0x1360, 0x0303, "Meinberg Funkuhren GmbH & Co. KG","TCR511PCI","IRIG Timecode Reader" },
-{0x1360, 0x0304, "Meinberg Funkuhren GmbH & Co. KG","TCR511PEX","IRIG Timecode Receiver" },
-{0x1360, 0x0305, "Meinberg Funkuhren GmbH & Co. KG","TCR170PEX","IRIG Timecode Reader" },
-{0x1360, 0x0306, "Meinberg Funkuhren GmbH & Co. KG","TCR180PEX","IRIG Timecode Reader" },
-{0x1360, 0x0501, "Meinberg Funkuhren GmbH & Co. KG","PTP270PEX","PTP/IEEE1588 Slave Card" },
-{0x1360, 0x0601, "Meinberg Funkuhren GmbH & Co. KG","FRC511PEX","Free Running Clock" },
-{0x1365, 0x9050, "Hypercope Corp.","HYSDN","" },
-{0x1375, 0x2571, "Boeing - Sunnyvale","NA","NA" },
-{0x137A, 0x0001, "Mark Of The Unicorn Inc","","" },
-{0x137A, 0x0003, "Mark Of The Unicorn Inc","PCI-424 Original","PCI-424 Original" },
-{0x137A, 0x0004, "Mark Of The Unicorn Inc","PCI-424 X","PCI-424 X" },
-{0x137A, 0x0005, "Mark Of The Unicorn Inc","PCIe-424","PCIe-424" },
-{0x1382, 0x0001, "Marian - Electronic & Software","f97260118","Sek'D ARC88 professional soundcard" },
-{0x1382, 0x2009, "Marian - Electronic & Software","PLX TECHNOLOGY \\n PCI9052 \\n 0435 \\n BX9497.1 MALA","SEK'D Prodif 96 Pro - professional audio card" },
-{0x1382, 0x2048, "Marian - Electronic & Software","2048","Prodif Plus sound card" },
-{0x1382, 0x2088, "Marian - Electronic & Software","Marc 8 Midi","8-in, 8-out sound card" },
-{0x1385, 0x4100, "Netgear","MA401","802.11b Wireless Adapter" },
-{0x1385, 0x4105, "Netgear","","" },
-{0x1385, 0x620A, "Netgear","GA620","Toshiba" },
-{0x1385, 0x622A, "Netgear","GA622","" },
-{0x1385, 0x630A, "Netgear","GA630","" },
-{0x1385, 0x8169, "Netgear","10ec","Gigabit Ethernet Adapter" },
-{0x1385, 0xF311, "Netgear","FA311","Fast Ethernet Adapter" },
-{0x1385, 0xF312, "Netgear","","" },
-{0x1387, 0x4640, "Curtiss-Wright Controls Electronic Systems","-none-","sl240" },
-{0x1387, 0x5310, "Curtiss-Wright Controls Electronic Systems","N/A","SCRAMNet GT200" },
-{0x1389, 0x0001, "Applicom International","PCI1500PFB","Intelligent fieldbus Adapter" },
-{0x1389, 0x0104, "Applicom International","PCI-CANIO","PCI-CANIO adapter" },
-{0x138A, 0x0001, "Validity Sensors, Inc.","0001","REV_0372" },
-{0x138A, 0x0005, "Validity Sensors, Inc.","0008","VFS301 Fingerprint Scanner" },
-{0x138A, 0x0006, "Validity Sensors, Inc.","0006","VFS351 Fingerprint Scanner" },
-{0x138A, 0x0007, "Validity Sensors, Inc.","0007","VFS451 Fingerprint Scanner" },
-{0x138A, 0x0009, "Validity Sensors, Inc.","0008","VFS421 Fingerprint Scanner" },
-{0x138A, 0x0011, "Validity Sensors, Inc.","11","Validity Fingerprint Reader" },
-{0x138A, 0x0018, "Validity Sensors, Inc.","Biometric Devices","Validity Sensors, Inc. (WBF) (PID=0018)" },
-{0x138A, 0x003C, "Validity Sensors, Inc.","0086","VFS431 Validity-Fingerprint Driver" },
-{0x138A, 0x003D, "Validity Sensors, Inc.","0104","Validity Fingerprint Sensor" },
-{0x138A, 0x11, "Validity Sensors, Inc.","VFS5011","Fingerprint Reader" },
-{0x1393, 0x1010, "Moxa Technologies Co Ltd","","" },
-{0x1393, 0x1020, "Moxa Technologies Co Ltd","","" },
-{0x1393, 0x1022, "Moxa Technologies Co Ltd","unknown","unknown" },
-{0x1393, 0x1040, "Moxa Technologies Co Ltd","C104H/PCI","SmartIo" },
-{0x1393, 0x1041, "Moxa Technologies Co Ltd","CP104U series","" },
-{0x1393, 0x1042, "Moxa Technologies Co Ltd","","" },
-{0x1393, 0x1140, "Moxa Technologies Co Ltd","","" },
-{0x1393, 0x1141, "Moxa Technologies Co Ltd","","" },
-{0x1393, 0x1320, "Moxa Technologies Co Ltd","CP-132","Industio" },
-{0x1393, 0x1321, "Moxa Technologies Co Ltd","","" },
-{0x1393, 0x1340, "Moxa Technologies Co Ltd","CP--134U-I-DB9 V2.3 UPCI Board","UniversalPCI board, 4 ports RS-422/485 with Isolation DB9M" },
-{0x1393, 0x1401, "Moxa Technologies Co Ltd","","" },
-{0x1393, 0x1680, "Moxa Technologies Co Ltd","C168H/PCI","Smartio" },
-{0x1393, 0x1681, "Moxa Technologies Co Ltd","CP-168U","CP-168U Smart Serial Board" },
-{0x1393, 0x2040, "Moxa Technologies Co Ltd","CP-204J","Intellio" },
-{0x1393, 0x2180, "Moxa Technologies Co Ltd","C218","Intellio Turbo PCI" },
-{0x1393, 0x2210, "Moxa Technologies Co Ltd","---","---" },
-{0x1393, 0x2240, "Moxa Technologies Co Ltd","---","---" },
-{0x1393, 0x3200, "Moxa Technologies Co Ltd","C320","Intellio Turbo PCI" },
-{0x1393, 0x5020, "Moxa Technologies Co Ltd","e400","" },
-{0x1393, 0x6800, "Moxa Technologies Co Ltd","0x0000","dvr capture card" },
-{0x1394, 0x0001, "Level One Communications","0x1394","Gigabit Ethernet Adapter" },
-{0x1394, 0x1394, "Level One Communications","INTEL","1394 Net adapter " },
-{0x1397, 0x0B4D, "Cologne Chip Designs GmbH","HFC-8S 16B8D8S0","ISDN HDLC FIFO Controller" },
-{0x1397, 0x2BD0, "Cologne Chip Designs GmbH","HFC-PCI A ISDN 2BDS0","ISDN HDLC FIFO Controller" },
-{0x1397, 0x8B4D, "Cologne Chip Designs GmbH","HFC-4S ISDN 8B4D4S0","ISDN HDLC FIFO Controller" },
-{0x1397, 0xB000, "Cologne Chip Designs GmbH","B000","HCF-PCI card" },
-{0x1397, 0xB006, "Cologne Chip Designs GmbH","B006","HCF-PCI card" },
-{0x1397, 0xB007, "Cologne Chip Designs GmbH","B007","HCF-PCI card" },
-{0x1397, 0xB008, "Cologne Chip Designs GmbH","n/a","usb webcam" },
-{0x1397, 0xB009, "Cologne Chip Designs GmbH","B009","HCF-PCI card" },
-{0x1397, 0xB00A, "Cologne Chip Designs GmbH","B00A","HCF-PCI card" },
-{0x1397, 0xB00B, "Cologne Chip Designs GmbH","B00B","HCF-PCI card" },
-{0x1397, 0xB00C, "Cologne Chip Designs GmbH","B00C","HCF-PCI card" },
-{0x1397, 0xB100, "Cologne Chip Designs GmbH","B100","HCF-PCI card" },
-{0x139A, 0x0007, "Alacritech Inc","SES2000","Alacritech iSCSI Controller" },
-{0x13A3, 0x0005, "HI-FN Inc.","7751","Security Processor" },
-{0x13A3, 0x0006, "HI-FN Inc.","6500","Public Key Processor" },
-{0x13A3, 0x0007, "HI-FN Inc.","7811","Security Processor" },
-{0x13A3, 0x0012, "HI-FN Inc.","7951","Security Processor" },
-{0x13A3, 0x0014, "HI-FN Inc.","7814","Security Processor" },
-{0x13A3, 0x0015, "HI-FN Inc.","8065","Security Processor" },
-{0x13A3, 0x0017, "HI-FN Inc.","8165","Security Processor" },
-{0x13A3, 0x0018, "HI-FN Inc.","8154","Security Processor" },
-{0x13A3, 0x001d, "HI-FN Inc.","7956","Cryptographic Processor" },
-{0x13A3, 0x0020, "HI-FN Inc.","7954/7955","Cryptographic Processor" },
-{0x13A3, 0x0026, "HI-FN Inc.","8155","Security Processor" },
-{0x13A3, 0x16, "HI-FN Inc.","8065","Security Processor" },
-{0x13A7, 0x6240, "amc330","Network Controller","BSRV2-301A" },
-{0x13A8, 0x0152, "Exar Corp.","XR17C152","Dual UART" },
-{0x13A8, 0x0154, "Exar Corp.","XR17C154","Four Channel PCI Bus UART" },
-{0x13A8, 0x0158, "Exar Corp.","XR17C158","Eight Channel PCI Bus UART (5V)" },
-{0x13A8, 0x0354, "Exar Corp.","XR17V354","High Performance Quad PCI Express UART" },
-{0x13A8, 0x0358, "Exar Corp.","XR17V358","High Performance Octal PCI Express UART" },
-{0x13B6, 0x13b6, "DLoG Gesellschaft für elektronische Datentechnik mbH","S/N 26296347","sguiu" },
-{0x13C0, 0x0010, "Microgate Corp.","SyncLink Adapter","single port multiprotocol serial adapter" },
-{0x13C0, 0x0020, "Microgate Corp.","SyncLink SCC","low speed single port multiprotocol serial adapter" },
-{0x13C0, 0x0030, "Microgate Corp.","SyncLink 4 Port Adapter","4 port multiprotocol serial adapter" },
-{0x13C0, 0x0070, "Microgate Corp.","SyncLink GT Adapter","single port multiprotocol serial adapter" },
-{0x13C0, 0x0080, "Microgate Corp.","SyncLink GT4 Adapter","4 port multiprotocol serial adapter" },
-{0x13C0, 0x0090, "Microgate Corp.","SyncLink AC Adapter","one port asynchronous serial adapter" },
-{0x13C0, 0x00a0, "Microgate Corp.","SyncLink GT2 Adapter","2 port multiprotocol serial adapter" },
-{0x13C0, 0x0210, "Microgate Corp.","SyncLink Serial Adapter version 2","single port multiprotocol serial adapter" },
-{0x13C1, 0x1000, "LSI","9548qad","ATA-RAID Controller" },
-{0x13C1, 0x1001, "LSI","7000/8000 series","ATA-133 Storage Controller" },
-{0x13C1, 0x1002, "LSI","9000 series","SATA/PATA Storage Controller" },
-{0x13C1, 0x1003, "LSI","9550SX/9590SE Series","SATA2 Raid Controller" },
-{0x13C1, 0x1004, "LSI","9650SE Series","PCI-Express SATA2 Raid Controller" },
-{0x13C1, 0x1005, "LSI","9690SA Series","PCI-Express SATA2/SAS Raid Controller" },
-{0x13C1, 0x1010, "LSI","9750 Series","PCI-Express2 SAS2/SATA2 Raid Controller" },
-{0x13C7, 0x0ADC, "Blue Chip Technology Ltd","","Multi-Function Analogue/Digital IO card" },
-{0x13C7, 0x0B10, "Blue Chip Technology Ltd",".","Parallel I/O Card" },
-{0x13C7, 0x0D10, "Blue Chip Technology Ltd",".","Digital I/O Card" },
-{0x13C7, 0x5744, "Blue Chip Technology Ltd",".","Watchdog Card" },
-{0x13D0, 0x2103, "B2C2 Inc","T228502","B2C2 Sky2PC Core Chip sky star 2 <technisat>" },
-{0x13D0, 0x2200, "B2C2 Inc","","" },
-{0x13D1, 0xAB02, "AboCom Systems, Inc","","PCMCIA 10/100 mbps Ethernet Adapter" },
-{0x13D1, 0xAB03, "AboCom Systems, Inc","","" },
-{0x13D1, 0xAB06, "AboCom Systems, Inc","FE2000VX","CardBus /Atelco Fibreline Ethernet Adptr" },
-{0x13D1, 0xAB08, "AboCom Systems, Inc","SMC8035TX","EZ Card™ 10/100 Fast Ethernet CardBus Adapter" },
-{0x13D7, 0x0205, "Toshiba Engineering Corporation","6208","toshiba" },
-{0x13D7, 0x8086, "Toshiba Engineering Corporation","6205","toshiba" },
-{0x13D8, 0x1000, "Phobos Corporation","XQ11800FP","XaQti 1000Mbit/sec Gbit Ethernet Controller" },
-{0x13DF, 0x0001, "E-Tech Inc.","PCI56RVP","Modem" },
-{0x13EA, 0x3131, "Dallas Semiconductor","DS3131","BoSS Bit Synchronous HDLC Controller" },
-{0x13EA, 0x3134, "Dallas Semiconductor","DS3134","Chateau Channelized T1/E1/HDLC Controller" },
-{0x13F0, 0x0200, "IC Plus Corporation","0x0200","IP100A Integrated 10/100 Ethernet MAC + PHY" },
-{0x13F0, 0x0201, "IC Plus Corporation","ST201","Fast Ehternet Adapter" },
-{0x13F0, 0x0300, "IC Plus Corporation","NX1001","Network Adapter" },
-{0x13F0, 0x1021, "IC Plus Corporation","Tamarack 9021A","Tamarack 9021A Gigabit Ethernet adapter" },
-{0x13F0, 0x1023, "IC Plus Corporation","NX1101a","Gigabit Ethernet Controller" },
-{0x13F0, 0x13F0, "IC Plus Corporation","PCI\\VEN_13F0&DEV_0200&SUBSYS_82131043&REV_41\\4&19","82131043" },
-{0x13F1, 0x0028, "OCE - Industries S.A.","NV05","MCP67 High Definition Audio" },
-{0x13F6, 0x0211 ,"C-Media Electronics Inc.","pcnet ht2001 9932","serl" },
-{0x13F6, 0x0111, "C-Media Electronics Inc.","520098396000734","sound card" },
-{0x13F6, 0x0100, "C-Media Electronics Inc.","CMI8338/PCI C3DX","PCI" },
-{0x13F6, 0x0101, "C-Media Electronics Inc.","CMI8338-031","PCI Audio Device" },
-{0x13F6, 0x0111, "C-Media Electronics Inc.","0434119232","PCI-SCCME8738LX-2" },
-{0x13F6, 0x0112, "C-Media Electronics Inc.","CMI-8378B/PCI-6CH","PCI Audio Chip" },
-{0x13F6, 0x0191, "C-Media Electronics Inc.","PCI\\VEN_13F6&DEV_0111&REV_10","CMI 8738 8CH Sound Card" },
-{0x13F6, 0x0211, "C-Media Electronics Inc.","PCI_021113F6&rev_10\\2&EBB567F&0&79"," Driver controller pci simple comunications - PCtel HSP56 Micro Modem Driver  " },
-{0x13F6, 0x0300, "C-Media Electronics Inc.","0x4005","pci audio driver" },
-{0x13F6, 0x111, "C-Media Electronics Inc.","PCI\\VEN_13F6&DEPCI\\VEN_13F6&DEV_0511&SUBSYS_051113","C-Media Audio Controller" },
-{0x13F6, 0x8788, "C-Media Electronics Inc.","CMI8788/PCI-8CH","C-Media Oxygen HD" },
-{0x13F6, 0x9876, "C-Media Electronics Inc.","CMI8738","C-Media Audio Controller" },
-{0x13F6, 0x9891, "C-Media Electronics Inc.","CMI8738","C-Media Audio Controller" },
-{0x13FD, 0x160E, "Micro Science Inc","Initio1606l","SATA/150 &#1091;&#1089;&#1090;&#1088;&#1086;&#1081;&#1089;&#1090;&#1074;&#1072; USB 2.0" },
-{0x13FD, 0x161F, "Micro Science Inc","1D59CB92","s" },
-{0x13FD, 0x1840, "Micro Science Inc","INIC-1608L","SATA/150 device to USB 2.0 Host interface (http://www.initio.com/Html/inic-1608.html)" },
-{0x13FE, 0x1011, "Advantech Co., Ltd.","13FE","Advantech SRamDisk Device" },
-{0x13FE, 0x1240, "Advantech Co., Ltd.","PS2134CE-0","4-Axis Stepping/Servo Motor Card" },
-{0x13FE, 0x1600, "Advantech Co., Ltd.","PCI-1610CU/9-AE","4-port RS-232 UNI PCI COMM card w/S&I&D" },
-{0x13FE, 0x1680, "Advantech Co., Ltd.","PCI-1680U-A","2-port CAN UniversalPCI Communication Card with Isolation" },
-{0x13FE, 0x16FF, "Advantech Co., Ltd.","PCI-1610CU/9-AE","4-port RS-232 UNI PCI COMM card w/S&I&D" },
-{0x13FE, 0x1713, "Advantech Co., Ltd.","PCI-1713","32-channel Isolated Analog Input Card" },
-{0x13FE, 0x1723, "Advantech Co., Ltd.","PCI-1723","16-bit, 8-ch Analog Output PCI Card with 16-ch Digital I/O" },
-{0x13FE, 0x1724, "Advantech Co., Ltd.","PCI-1723","14-bit, 32-channel Isolated Analog Output Card" },
-{0x13FE, 0x1755, "Advantech Co., Ltd.","PCI-1755","80 MB/s, 32-ch Digital I/O PCI Card" },
-{0x13FE, 0x1760, "Advantech Co., Ltd.","amcc pci matchmaker s5920q","pci" },
-{0x13FE, 0x1761, "Advantech Co., Ltd.","PCI-1751","48 Digital IO + Counter " },
-{0x13FE, 0x1762, "Advantech Co., Ltd.","PCI-1762","16-ch Relay and 16-ch Isolated Digital Input PCI Card" },
-{0x13FE, 0x1a00, "Advantech Co., Ltd.","0x03","0x0200" },
-{0x13FE, 0x3730, "Advantech Co., Ltd.","PCM-3730I","16Bit dig. I/O Board" },
-{0x1400, 0x0001, "ArtX Inc","","" },
-{0x1400, 0x0003, "ArtX Inc","","" },
-{0x1400, 0x0004, "ArtX Inc","030000","030000" },
-{0x1400, 0x1401, "ArtX Inc","9432 TX","hd 2600xt" },
-{0x1402, 0x2E00, "Meilhaus Electronic GmbH Germany","ME-2000/2600","Multifunction Data Aquistion card" },
-{0x1402, 0x4610, "Meilhaus Electronic GmbH Germany","ME-4610","Multi-IO board (16x 16bit ADC, 32x TTL I/O)" },
-{0x1402, 0x4650, "Meilhaus Electronic GmbH Germany","ME-4650","Multi-IO board (16x 16bit ADC, 32x TTL I/O)" },
-{0x1407, 0x0100, "Lava Computer MFG Inc.","0439","Lava Dual Serial 550 PCI" },
-{0x1407, 0x0101, "Lava Computer MFG Inc.","","Lava Quattro PCI A/B" },
-{0x1407, 0x0102, "Lava Computer MFG Inc.","","Lava Quattro PCI C/D" },
-{0x1407, 0x0110, "Lava Computer MFG Inc.","0110","Lava DSerial PCI Port A" },
-{0x1407, 0x0111, "Lava Computer MFG Inc.","nep5p","Lava DSerial PCI Port B" },
-{0x1407, 0x0180, "Lava Computer MFG Inc.","Lava Octopus PCI Ports ","Lava Octopus PCI Ports 1-4" },
-{0x1407, 0x0181, "Lava Computer MFG Inc.","","Lava Octopus PCI Ports 5-8" },
-{0x1407, 0x0200, "Lava Computer MFG Inc.","9923","LavaPort Dual-650 PCI" },
-{0x1407, 0x0201, "Lava Computer MFG Inc.","","LavaPort Quad-650 PCI A/B" },
-{0x1407, 0x0202, "Lava Computer MFG Inc.","","LavaPort Quad-650 PCI C/D" },
-{0x1407, 0x0220, "Lava Computer MFG Inc.","","LavaPort Quad-650 PCI A/B" },
-{0x1407, 0x0221, "Lava Computer MFG Inc.","","LavaPort Quad-650 PCI C/D" },
-{0x1407, 0x0400, "Lava Computer MFG Inc.","","Lava 8255 PIO PCI" },
-{0x1407, 0x0500, "Lava Computer MFG Inc.","P4","Lava Single Serial 550 PCI" },
-{0x1407, 0x0510, "Lava Computer MFG Inc.","0510","Lava SP Serial 550 PCI" },
-{0x1407, 0x0511, "Lava Computer MFG Inc.","","Lava SP BIDIR Parallel PCI" },
-{0x1407, 0x0520, "Lava Computer MFG Inc.","s","Lava RS422 SS-PCI" },
-{0x1407, 0x0600, "Lava Computer MFG Inc.","4-0 9253","LavaPort 650 PCI" },
-{0x1407, 0x0A00, "Lava Computer MFG Inc.","LavaPort PCI","COM Port Accelerator" },
-{0x1407, 0x120, "Lava Computer MFG Inc.","","Lava Quattro 550 PCI A/B" },
-{0x1407, 0x121, "Lava Computer MFG Inc.","","Lava Quattro 550 PCI C/D" },
-{0x1407, 0x520, "Lava Computer MFG Inc.","s","s" },
-{0x1407, 0x8000, "Lava Computer MFG Inc.","197B&CC_0880","Lava Parallel" },
-{0x1407, 0x8001, "Lava Computer MFG Inc.","","Lava Dual Parallel port A" },
-{0x1407, 0x8002, "Lava Computer MFG Inc.","9923","Lava Dual Parallel port A" },
-{0x1407, 0x8003, "Lava Computer MFG Inc.","0x00010002030C2BB0","Lava Dual Parallel port B" },
-{0x1407, 0x8800, "Lava Computer MFG Inc.","2003","BOCA Research IOPPAR" },
-{0x1409, 0x1409, "SUNIX Co., Ltd.","7168","PCI Serial port" },
-{0x1409, 0x7168, "SUNIX Co., Ltd.","1889","PCI Serial Port (WinXP --> Win 8.1) (Win 2003 - 2008R2)" },
-{0x1409, 0x7268, "SUNIX Co., Ltd.","PCI / ISA IEEE1284 ECP/EPP/SPP/BPP Signal Chips So","PCI parallel port" },
-{0x140B, 0x0610, "Ramix Inc","","" },
-{0x140B, 0x615, "Ramix Inc","NA","Na" },
-{0x140B, 0x682, "Ramix Inc","NA","NA" },
-{0x1412, 0x1712, "IC Ensemble, Inc.","ICE1712","M-audio Delta 44 (http://www.m-audio.com)" },
-{0x1412, 0x1724, "IC Ensemble, Inc.","VT1723","Envy24PT/HT PCI Multi-Channel Audio Controller (&#1072;&#1091;&#1076;&#1080;&#1086;&#1082;&#1086;&#1" },
-{0x1415, 0x8401, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX9162","PCI Interface to local bus" },
-{0x1415, 0x8403, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX12PCI840","PCI Parallel Card" },
-{0x1415, 0x9500, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX16PCI952","Quad UART (disabled)" },
-{0x1415, 0x9501, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX16PCI954","Quad UART" },
-{0x1415, 0x9505, "Oxford Semiconductor Ltd - now part of PLX Technology ","OXuPCI952","Dual UART" },
-{0x1415, 0x950A, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX16PCI954","Dual PCI UARTS" },
-{0x1415, 0x950B, "Oxford Semiconductor Ltd - now part of PLX Technology ","OXCF950","Integrated High Performance UART" },
-{0x1415, 0x9510, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX16PCI954","PCI Interface (disabled)" },
-{0x1415, 0x9511, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX9160","PCI Interface to 8-bit local bus" },
-{0x1415, 0x9512, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX16PCI954","PCI Interface to 32-bit bus" },
-{0x1415, 0x9513, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX16PCI954","Parallel Port" },
-{0x1415, 0x9521, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX16PCI952","Dual UART" },
-{0x1415, 0x9523, "Oxford Semiconductor Ltd - now part of PLX Technology ","OX16PCI952","Integrated Parallel Port" },
-{0x1415, 0xc110, "Oxford Semiconductor Ltd - now part of PLX Technology ","OXPCIe952","Parallel PCI Express Card (Manhattan 158176)" },
-{0x1415, 0xc158, "Oxford Semiconductor Ltd - now part of PLX Technology ","OXPCIe952","Scheda PCI Express Seriale Due porte, X1 linea " },
-{0x1415, 0xc15d, "Oxford Semiconductor Ltd - now part of PLX Technology ","OXPCIe952","2 native UARTs (function 1)" },
-{0x1415, 0xc208, "Oxford Semiconductor Ltd - now part of PLX Technology ","OXPCIe954","Quad UARTs" },
-{0x1415, 0xc20d, "Oxford Semiconductor Ltd - now part of PLX Technology ","OXPCIe954","Quad UARTs (function 1)" },
-{0x1415, 0xc308, "Oxford Semiconductor Ltd - now part of PLX Technology ","OXPCIe958","Octo UARTs" },
-{0x1415, 0xc30d, "Oxford Semiconductor Ltd - now part of PLX Technology ","OXPCIe958","Octo UARTs (function 1)" },
-{0x1418, 0x0781, "Kyushu Electronics Systems Inc","RaLink RT2860 300Mbps"," 802.11n Wireless Card" },
-{0x141F, 0x6181, "Visiontech Ltd","KFIR","MPEG decoder" },
-{0x1425, 0x0030, "Chelsio Communications","N/A","T310 10GbE Single Port Adapter" },
-{0x1425, 0x31, "Chelsio Communications","N/A","T320 10GbE Dual Port Adapter" },
-{0x1425, 0x32, "Chelsio Communications","N/A","T302 1GbE Dual Port Adapter" },
-{0x1425, 0x33, "Chelsio Communications","N/A","T304 1GbE Quad Port Adapter" },
-{0x1425, 0x34, "Chelsio Communications","N/A","B320 10GbE Dual Port Adapter" },
-{0x1425, 0x35, "Chelsio Communications","N/A","S310-CR 10GbE Single Port Adapter" },
-{0x1425, 0x36, "Chelsio Communications","N/A","S320-LP-CR 10GbE Dual Port Adapter" },
-{0x1425, 0x37, "Chelsio Communications","N/A","N320-G2-CR 10GbE Dual Port Adapter" },
-{0x1425, 0x4401, "Chelsio Communications","N/A","T420-CR Unified Wire Ethernet Controller" },
-{0x1425, 0x4402, "Chelsio Communications","N/A","T422-CR Unified Wire Ethernet Controller" },
-{0x1425, 0x4403, "Chelsio Communications","N/A","T440-CR Unified Wire Ethernet Controller" },
-{0x1425, 0x4404, "Chelsio Communications","N/A","T420-BCH Unified Wire Ethernet Controller" },
-{0x1425, 0x4405, "Chelsio Communications","N/A","T440-BCH Unified Wire Ethernet Controller" },
-{0x1425, 0x4406, "Chelsio Communications","N/A","T440-CH Unified Wire Ethernet Controller" },
-{0x1425, 0x4407, "Chelsio Communications","N/A","T420-SO Unified Wire Ethernet Controller" },
-{0x1425, 0x4408, "Chelsio Communications","N/A","T420-CX Unified Wire Ethernet Controller" },
-{0x1425, 0x4409, "Chelsio Communications","N/A","T420-BT Unified Wire Ethernet Controller" },
-{0x1425, 0x440a, "Chelsio Communications","N/A","T404-BT Unified Wire Ethernet Controller" },
-{0x1425, 0x440d, "Chelsio Communications","N/A","T480 Unified Wire Ethernet Controller" },
-{0x1425, 0x440e, "Chelsio Communications","N/A","T440-LP-CR Unified Wire Ethernet Controller" },
-{0x1425, 0x7145, "Chelsio Communications","1002","N/A" },
-{0x1435, 0x0531, "RTD Embedded Technologies, Inc.","DELETE","DELETE" },
-{0x1435, 0x6020, "RTD Embedded Technologies, Inc.","SPM6020","PCI-104 dspModule" },
-{0x1435, 0x6030, "RTD Embedded Technologies, Inc.","SPM6030","PC/104-Plus dspModule" },
-{0x1435, 0x6420, "RTD Embedded Technologies, Inc.","SPM186420","PC/104-Plus dspModule" },
-{0x1435, 0x6430, "RTD Embedded Technologies, Inc.","SPM176430","PC/104-Plus dspModule" },
-{0x1435, 0x7520, "RTD Embedded Technologies, Inc.","DM7520","PC/104-Plus dataModule" },
-{0x1435, 0x7540, "RTD Embedded Technologies, Inc.","SDM7540","PC/104-Plus dataModule with SmartCal" },
-{0x1446, 0x6A73, "Graphin Co., LTD","not known","not known" },
-{0x1448, 0x0001, "Alesis Studio","ADAT/EDIT","Audio Editing" },
-{0x144A, 0x348A, "ADLINK Technology Inc","LPCI-3488A","Low-profile High-Performance IEEE488 GPIB Interface Card for PCI Bus" },
-{0x144A, 0x7230, "ADLINK Technology Inc","PLX PCI-9052","PLX PCI-9052" },
-{0x144A, 0x7248, "ADLINK Technology Inc","PCI-9052","PLX PCI9052" },
-{0x144A, 0x7250, "ADLINK Technology Inc","PCI-7250","PLX PCI-9050" },
-{0x144A, 0x7256, "ADLINK Technology Inc","PCI-7256","PCI-7256 16-CH Latching Relay & 16-CH Isolated Digital Input Card" },
-{0x144A, 0x7296, "ADLINK Technology Inc","PCI-7296 (PLX PCI-9052)","96-ch digital I/O card" },
-{0x144A, 0x7432, "ADLINK Technology Inc","PCI-7432","" },
-{0x144A, 0x7433, "ADLINK Technology Inc","PCI-7433","64-ch digital Input card" },
-{0x144A, 0x7434, "ADLINK Technology Inc","PCI-7434","" },
-{0x144A, 0x7841, "ADLINK Technology Inc","PCI-7841","SJA 1000- baseddual port  CAN bus card" },
-{0x144A, 0x8133, "ADLINK Technology Inc","PCI-8133","Dell Wireless 5720 VZW Mobile Broadband Card" },
-{0x144A, 0x8554, "ADLINK Technology Inc","PCI-8554","" },
-{0x144A, 0x9111, "ADLINK Technology Inc","PCI-9111","" },
-{0x144A, 0x9113, "ADLINK Technology Inc","PCI-9113","" },
-{0x144A, 0x9114, "ADLINK Technology Inc","PCI-9114","" },
-{0x144B, 0x0601, "Loronix Information Systems, Inc.","","" },
-{0x1458, 0x1458, "Giga-Byte Technologies","0x29e0","microsoft" },
-{0x1458, 0x5000, "Giga-Byte Technologies","0x29e0","GA-X48T-DQ6" },
-{0x1458, 0x67B1, "Giga-Byte Technologies","0x29e0","GA-X48T-DQ6" },
-{0x145F, 0x0001, "Baldor Electric Company","NextMove PCI","Multi-axis Motion Controller" },
-{0x145F, 0x0002, "Baldor Electric Company","NextMove PCI-2","Multi-axis Motion Controller" },
-{0x1462, 0x00C1, "Micro-Star International Co Ltd","NV41.1","NX6800-TD256E" },
-{0x1462, 0x4720, "Micro-Star International Co Ltd","883","Audio controller" },
-{0x1462, 0x5071, "Micro-Star International Co Ltd","883","Audio controller" },
-{0x1462, 0x5964, "Micro-Star International Co Ltd","PCI\\VEN_1002&DEV_7291&SUBSYS_08101462&REV_9A0PCI\\V","RADEON 9250/9200 series AGP" },
-{0x1462, 0x7120, "Micro-Star International Co Ltd","","" },
-{0x1462, 0x7960, "Micro-Star International Co Ltd","MCP2T","MCP2T" },
-{0x1471, 0x0188, "Integrated Telecom Express Inc","RoadRunner 10","ADSL PCI" },
-{0x148C, 0x4011, "C.P. Technology Co. Ltd","RV250","RADEON 9000 PRO EVIL COMMANDO" },
-{0x148C, 0x4152, "C.P. Technology Co. Ltd","0x1002","0x2079" },
-{0x148D, 0x1003, "Digicom Systems Inc.","Rockwell HCF chipset","Creative ModemBlaster V.90 PCI DI5655" },
-{0x148F, 0x1000, "Plant Equipment Inc.","unknown","Ralink Motorola BC4 Bluetooth 3.0+HS Adapter" },
-{0x148F, 0x148f, "Plant Equipment Inc.","5370","TP-LINK 7200ND" },
-{0x148F, 0x2000, "Plant Equipment Inc.","Unknown","Ralink Motorola BC8 Bluetooth 3.0 + HS Adapter" },
-{0x148F, 0x2070, "Plant Equipment Inc.","1.0","802.11 g WLAN" },
-{0x148F, 0x2573, "Plant Equipment Inc.","1192Af7b","802.11 bg" },
-{0x148F, 0x2870, "Plant Equipment Inc.","1.0","802.11 n WLAN" },
-{0x148F, 0x3000, "Plant Equipment Inc.","RT3290","ralink rt3290_bluetooth_01" },
-{0x148F, 0x3070, "Plant Equipment Inc.","RT3070L","FreeWifiLink D3-10000N" },
-{0x148F, 0x3572, "Plant Equipment Inc.","RT3572","Ralink 3572" },
-{0x148F, 0x5370, "Plant Equipment Inc.","Ralink RT2870","802.11n USB Wireless LAN Card" },
-{0x148F, 0x9021, "Plant Equipment Inc.","Unknown","Netopia USB b/g Adapter (black)" },
-{0x1491, 0x0020, "Futronic ","USB Fingerprint Scanner Model FS80","USB Fingerprint Scanner Model FS80" },
-{0x1491, 0x0021, "Futronic ","USB Fingerprint Scanner Model FS80","USB Fingerprint Scanner Model FS80" },
-{0x14A9, 0xad1f, "Hivertec Inc.","1","1" },
-{0x14B1, 0x1033, "Nextcom K.K.","R6795-12","RH56D-PCI" },
-{0x14B1, 0x2F30, "Nextcom K.K.","01","zyxel omni 56k CI lus rev." },
-{0x14B3, 0x0000, "Xpeed Inc.","9ff-usa-a99-99-0970","DSL NIC" },
-{0x14B5, 0x0200, "Creamware GmbH","Scope","" },
-{0x14B5, 0x0300, "Creamware GmbH","Pulsar","" },
-{0x14B5, 0x0400, "Creamware GmbH","Pulsar SRB","" },
-{0x14B5, 0x0600, "Creamware GmbH","Pulsar 2","" },
-{0x14B5, 0x0800, "Creamware GmbH","","DSP-Board" },
-{0x14B5, 0x0900, "Creamware GmbH","1039","DSP-Board" },
-{0x14B5, 0x0A00, "Creamware GmbH","","DSP-Board" },
-{0x14B5, 0x0B00, "Creamware GmbH","","DSP-Board" },
-{0x14B7, 0x0001, "Proxim Inc.","Symphony 4110","pci9052" },
-{0x14B9, 0x0001, "Aironet Wireless Communication","PC4800","werwerwerwe" },
-{0x14B9, 0x0340, "Aironet Wireless Communication","","Cisco Systems 340 PCI Wireless LAN Adptr" },
-{0x14B9, 0x2500, "Aironet Wireless Communication","PC2500 DS","Wireless PCI LAN Adapter" },
-{0x14B9, 0x3100, "Aironet Wireless Communication","PC3100 FH","Wireless PCI LAN Adapter" },
-{0x14B9, 0x3101, "Aironet Wireless Communication","PC3100 FH","Wireless PCI LAN Adapter" },
-{0x14B9, 0x3500, "Aironet Wireless Communication","PC3500 FH","Wireless PCI LAN Adapter" },
-{0x14B9, 0x4500, "Aironet Wireless Communication","PC4500 DS","Wireless PCI LAN Adapter" },
-{0x14B9, 0x4800, "Aironet Wireless Communication","PC4800 DS","Wireless PCI LAN Adapter" },
-{0x14B9, 0xA504, "Aironet Wireless Communication","A504 Cisco MAC","Cisco Aironet 350 Series Mini-PCI (MPI350)" },
-{0x14B9, 0xA506, "Aironet Wireless Communication","AIR-MP21G","802.11b/g wireless adapter" },
-{0x14C1, 0x8043, "Myricom Inc.","LANai 9.2 0129","MyriNet" },
-{0x14C8, 0x0003, "Turbocomm Tech Inc","0000066779","0" },
-{0x14CD, 0x03, "Universal Scientific Ind.","0x02","0x1212" },
-{0x14CD, 0x1001, "Universal Scientific Ind.","BCM4356","802.11 ac wireless module" },
-{0x14CD, 0x168a, "Universal Scientific Ind.","NA","Multi-Card reader" },
-{0x14CF, 0x2920, "TEK Microsystems Inc.","FPMC-FIO1-F100-1","Serial I/O Controller aka FPMC-DFLEX64" },
-{0x14D4, 0x0400, "Panacom Technology Corporation","Panacom 7","Interface chip" },
-{0x14D9, 0x0010, "Alpha Processor Inc","AP1011/SP1011","Sturgeon HyperTransport-PCI Bridge" },
-{0x14DB, 0x2100, "Avlab Technology Inc.","PCI IO 1S","download drivers" },
-{0x14DB, 0x2101, "Avlab Technology Inc.","PCI IO 1S-650","" },
-{0x14DB, 0x2102, "Avlab Technology Inc.","PCI IO 1S-850","" },
-{0x14DB, 0x2110, "Avlab Technology Inc.","PCI IO 1S1P","OX16PCI952" },
-{0x14DB, 0x2111, "Avlab Technology Inc.","PCI IO 1S1P-650","" },
-{0x14DB, 0x2112, "Avlab Technology Inc.","PCI IO 1S1P-850","" },
-{0x14DB, 0x2120, "Avlab Technology Inc.","TK9902","0701 Parallel Port device" },
-{0x14DB, 0x2121, "Avlab Technology Inc.","PCI IO 2P","Avlab Technology PCI IO 2P" },
-{0x14DB, 0x2130, "Avlab Technology Inc.","PCI IO 2S","2 Port PCI Serial Card" },
-{0x14DB, 0x2131, "Avlab Technology Inc.","PCI IO 2S-650","pci serial port" },
-{0x14DB, 0x2132, "Avlab Technology Inc.","PCI IO 2S-850","" },
-{0x14DB, 0x2140, "Avlab Technology Inc.","PCI IO 2P1S","" },
-{0x14DB, 0x2141, "Avlab Technology Inc.","PCI IO 2P1S-650","" },
-{0x14DB, 0x2142, "Avlab Technology Inc.","PCI IO 2P1S-850","" },
-{0x14DB, 0x2144, "Avlab Technology Inc.","PCI IO 2P2S","" },
-{0x14DB, 0x2145, "Avlab Technology Inc.","PCI IO 2P2S-650","" },
-{0x14DB, 0x2146, "Avlab Technology Inc.","PCI IO 2P2S-850","" },
-{0x14DB, 0x2150, "Avlab Technology Inc.","PCI IO 4S","" },
-{0x14DB, 0x2151, "Avlab Technology Inc.","PCI IO 4S-654","" },
-{0x14DB, 0x2152, "Avlab Technology Inc.","PCI IO 4S-850","" },
-{0x14DB, 0x2160, "Avlab Technology Inc.","PCI IO 2S1P","" },
-{0x14DB, 0x2161, "Avlab Technology Inc.","PCI IO 2S1P-650","" },
-{0x14DB, 0x2162, "Avlab Technology Inc.","PCI IO 2S1P-850","" },
-{0x14DB, 0x2180, "Avlab Technology Inc.","PCI IO 8S","VEN_14DB&DEV_2180&SUBSYS_218014DB&REV_00" },
-{0x14DB, 0x2181, "Avlab Technology Inc.","PCI IO 8S-654","Avlab Technology Inc" },
-{0x14DB, 0x2182, "Avlab Technology Inc.","PCI IO 8S-850","Avlab Technology Inc" },
-{0x14DC, 0x0000, "Amplicon Liveline Limited","PCI 230","" },
-{0x14DC, 0x0001, "Amplicon Liveline Limited","PCI242H","4-port high speed RS-232" },
-{0x14DC, 0x0002, "Amplicon Liveline Limited","PCI244H","8-port high speed RS-232" },
-{0x14DC, 0x0003, "Amplicon Liveline Limited","PCI247H","2-port high speed RS-232" },
-{0x14DC, 0x0004, "Amplicon Liveline Limited","PCI248H","2-port high speed RS-422/485" },
-{0x14DC, 0x0005, "Amplicon Liveline Limited","PCI249H","2-port high speed RS-232 and RS-422/485" },
-{0x14DC, 0x0006, "Amplicon Liveline Limited","PCI260","16-channel analog input (with timers)" },
-{0x14DC, 0x0007, "Amplicon Liveline Limited","PCI224","16-chan 12-bit analog output (w/ timers)" },
-{0x14DC, 0x0008, "Amplicon Liveline Limited","PCI234","4-chan 16-bit analog output (w/ timers)" },
-{0x14DC, 0x0009, "Amplicon Liveline Limited","PCI236","24-channel digital I/O" },
-{0x14DC, 0x000A, "Amplicon Liveline Limited","PCI272","72-channel digital I/O" },
-{0x14DC, 0x000B, "Amplicon Liveline Limited","PCI215","48-channel digital I/O (w/ 6 timers)" },
-{0x14DC, 0x000C, "Amplicon Liveline Limited","PCI263","16-channel reed relay output" },
-{0x14E4, 0x0038, "Broadcom","BCM88038","100G packet processor " },
-{0x14E4, 0x0102, "Broadcom","T2500","Intel (R)" },
-{0x14E4, 0x0318, "Broadcom","n/a","n/a" },
-{0x14E4, 0x034F, "Broadcom","NV36GL?","???" },
-{0x14E4, 0x04B5, "Broadcom","BCM4312","Broadcom 54bg Wireless" },
-{0x14E4, 0x0732, "Broadcom","BCM88732","2x40G/8x10G MAC Aggregation Switch with 80G Uplink" },
-{0x14E4, 0x0800, "Broadcom","BCM33xx/47xx","Sentry5 Chipcommon I/O Controller" },
-{0x14E4, 0x0804, "Broadcom","BCM33xx/47xx","Sentry5 PCI Bridge" },
-{0x14E4, 0x0805, "Broadcom","BCM33xx/47xx","Sentry5 MIPS32 CPU" },
-{0x14E4, 0x0806, "Broadcom","BCM33xx/47xx","Sentry5 Ethernet Controller" },
-{0x14E4, 0x080B, "Broadcom","BCM33xx/47xx","Sentry5 Crypto Accelerator" },
-{0x14E4, 0x080F, "Broadcom","BCM33xx/47xx","Sentry5 DDR/SDR RAM Controller" },
-{0x14E4, 0x0811, "Broadcom","BCM33xx/47xx","Sentry5 External Interface" },
-{0x14E4, 0x0816, "Broadcom","BCM3302","Sentry5 MIPS32 CPU" },
-{0x14E4, 0x1234, "Broadcom","7175144F","networkcontroller" },
-{0x14E4, 0x1361, "Broadcom","BCM4313","Ethernet" },
-{0x14E4, 0x14E4, "Broadcom","BCM57780","802.11b/g Wireless Lan Controller" },
-{0x14E4, 0x1570, "Broadcom","720p FaceTime HD camera","Webcam found on Macbook Pro with Retina Display, 2014 (aka. Macbook Pro /w Retina 11,3)" },
-{0x14E4, 0x1600, "Broadcom","BCM5752","NetXtreme BCM5752 Gigabit Ethernet PCI Express" },
-{0x14E4, 0x1601, "Broadcom","BCM5752M","NetXtreme Desktop/Mobile" },
-{0x14E4, 0x1610, "Broadcom","BCM70010","Broadcom BCN70010 Video Decoder" },
-{0x14E4, 0x1612, "Broadcom","BCM70010/BCM70012","Crystal HD Video Decoder" },
-{0x14E4, 0x1615, "Broadcom","BCM70015","Broadcom Crystal HD Video Decoder" },
-{0x14E4, 0x161F, "Broadcom","BCM70010/BCM70012","AVC/VC-1/MPEG PCI Express® HD Decoder Chipset for Netbooks/Nettops" },
-{0x14E4, 0x1639, "Broadcom","BCM5709","NetXtreme Gigabit Ethernet II" },
-{0x14E4, 0x163B, "Broadcom","BCM5709","Broadcom NetXtreme II BCM5706/5708/5709/5716 Driver" },
-{0x14E4, 0x1644, "Broadcom"," BCM5751F","ven_1102dev_0004" },
-{0x14E4, 0x1645, "Broadcom","BCM570123","broadtcomBCM5701 Gigabit EthernetASD" },
-{0x14E4, 0x1646, "Broadcom","BCM5702x1","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x1647, "Broadcom","BCM57788","NetLink tm Gigabit Ethernet pcie" },
-{0x14E4, 0x1648, "Broadcom","BCM5704","NetXtreme Dual Gigabit Adapter" },
-{0x14E4, 0x164C, "Broadcom","BCM5708","Broadcom NetXtreme II Gigabit Ethernet Adapter" },
-{0x14E4, 0x164D, "Broadcom","83471043","NetXtreme Fast Ethernet Controller" },
-{0x14E4, 0x1650, "Broadcom","BCM57711","Broadcom PCIe 10Gb Network Controller " },
-{0x14E4, 0x1653, "Broadcom","BCM5788","Broadcom NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x1654, "Broadcom","BCM5705A2","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x1658, "Broadcom","BM5750","NtXtreme Gigabit Ethernet" },
-{0x14E4, 0x1659, "Broadcom","BCM5721","NetXtreme Gigabit Ethernet PCI Express" },
-{0x14E4, 0x165A, "Broadcom","94309","Broadcom NetXtreme BCM5722 Gigabit" },
-{0x14E4, 0x165D, "Broadcom","Aspire5733Z","Broadcom NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x165E, "Broadcom","3C905B","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x165F, "Broadcom","BCM5720","Broadcom NetXtreme 5720 Gigabit Ethernet" },
-{0x14E4, 0x166a, "Broadcom","BCM5780","Broadcom NetXtreme Gigabit Ethernet 5780" },
-{0x14E4, 0x166B, "Broadcom","BCM5780S","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x166D, "Broadcom","BCM5705MFE","NetXtreme Ethernet 100kB" },
-{0x14E4, 0x166E, "Broadcom","BCM5705","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x167, "Broadcom","BCM5751F","NetXtreme Fast Ethernet Controller" },
-{0x14E4, 0x1672, "Broadcom","BCM5754M","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x1673, "Broadcom","B5755M","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x1674, "Broadcom","57XX","57XX Series Broadcom Driver X86/X64" },
-{0x14E4, 0x1676, "Broadcom","BCM5750A1","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x1677, "Broadcom","BCM5751","NetXtreme Desktop/Mobile" },
-{0x14E4, 0x167A, "Broadcom","BCM5754","Broadcom NetXtreme Gigabit Ethernet Controller" },
-{0x14E4, 0x167B, "Broadcom","BCM5755/5780","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x167C, "Broadcom","BCM5750","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x167d, "Broadcom","BCM5751M","Broadcom NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x167E, "Broadcom","BCM5751FKFB","vierkant" },
-{0x14E4, 0x1680, "Broadcom","BCM5761E","NetXtreme Desktop/Mobile" },
-{0x14E4, 0x1681, "Broadcom","BCM5761","Broadcom 57XX Gigabit Integrated Controller " },
-{0x14E4, 0x1684, "Broadcom","BCM5764","Broadcom NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x1690, "Broadcom","BCM5776","NexTreme Desktop/Mobile" },
-{0x14E4, 0x1691, "Broadcom","BCM57788","Broadcom BCM57788 LOM " },
-{0x14E4, 0x1692, "Broadcom","BCM57780","NetLink" },
-{0x14E4, 0x1693, "Broadcom","BCM5787","Ethernet Controller Broadcom Netlink Gigabit" },
-{0x14E4, 0x1696, "Broadcom","BCM5782","Broadcom NetXtreme Gigabit Ethernet " },
-{0x14E4, 0x1698, "Broadcom","02941028","NetLink Ethernet-FOR DELL LAPTOP AND MAYBE OTHERS" },
-{0x14E4, 0x169A, "Broadcom","BCM5787","Broadcom Netlink (TM) gigabit ethernet Driver" },
-{0x14E4, 0x169B, "Broadcom","BCM5786","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x169C, "Broadcom","17351043","Broadcom NetLink (TM) Gigabit Ethernet" },
-{0x14E4, 0x169D, "Broadcom","BCM5782k, BCM5789","Broadcom Ethernet Adapter" },
-{0x14E4, 0x169E, "Broadcom","BCM5754","NetXtreme Gigabit Ethernet PCI Express" },
-{0x14E4, 0x16A6, "Broadcom","BCM5702X","Gigabit Ethernet" },
-{0x14E4, 0x16A7, "Broadcom","BCM5703X","Gigabit Ethernet" },
-{0x14E4, 0x16A8, "Broadcom","BLM5701","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x16AA, "Broadcom","B06BDRV","BroadCom NetExtreme II Server" },
-{0x14E4, 0x16B1, "Broadcom","BCM57781","BCM57781" },
-{0x14E4, 0x16B5, "Broadcom","BCM57785X","Broadcom NetLink Gigabit Ethernet" },
-{0x14E4, 0x16BE, "Broadcom","16BE8","CardReader Broadcom 1.0.0.221" },
-{0x14E4, 0x16BF, "Broadcom","0x16BF","CardReader Broadcom 15.0.7.2" },
-{0x14E4, 0x16C6, "Broadcom","BCM5702A3","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x16C7, "Broadcom","BCM 94311","DELL Wireless 1390 WLAN MiniCard" },
-{0x14E4, 0x16DD, "Broadcom","BCM5781","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x16f7, "Broadcom","BCM5753","NetXtreme BCM5753 Gigabit PCI Express" },
-{0x14E4, 0x16FD, "Broadcom","BCM5753M","NetXtreme Gigabit Ethernet PciXpress" },
-{0x14E4, 0x16FE, "Broadcom","BCM5753F","NetXtreme Gigabit Ethernet" },
-{0x14E4, 0x170C, "Broadcom","PCI\\VEN_14E4&DEV_1692&CC_020000","Broadcom 440x 10/100 Integrated Controller" },
-{0x14E4, 0x170D, "Broadcom","BCM5901","NetXtreme" },
-{0x14E4, 0x170E, "Broadcom","BCM5901","NetXtreme 100Base-TX" },
-{0x14E4, 0x1713, "Broadcom","BCM5906m","Broadcom NetLink (TM) Fast Ethernet" },
-{0x14E4, 0x21E3, "Broadcom","BCM43142A0","Broadcom Bluetooth 4.0" },
-{0x14E4, 0x333, "Broadcom","BCM53333","16p 1G (PHY)" },
-{0x14E4, 0x3352, "Broadcom","BCM3352","BCM3352 QAMLink® Single-Chip 4-Line VoIP" },
-{0x14E4, 0x3360, "Broadcom","BCM3360","Advanced PHY Broadband Gateway Cable Modem" },
-{0x14E4, 0x4211, "Broadcom","intel CORE I5","10Mb/s NIC" },
-{0x14E4, 0x4212, "Broadcom","BCM V.90","56k Modem" },
-{0x14E4, 0x4301, "Broadcom","Broadcom BCM4301 802.11g Wireless LAN Controller","Dell Truemobile 1180 802.11g MiniPCI" },
-{0x14E4, 0x4303, "Broadcom","BCM4303","BCM4301 802.11b802.11b Wireless LAN Controller" },
-{0x14E4, 0x4305, "Broadcom","BCM4307","V.90 56k Modem" },
-{0x14E4, 0x4306, "Broadcom","BCM4306","Unknown device 4306 (rev 02)" },
-{0x14E4, 0x4307, "Broadcom","BCM4306","802.11b Wireless LAN Controller" },
-{0x14E4, 0x4310, "Broadcom","BCM4310","BCM4301USB Controller" },
-{0x14E4, 0x4311, "Broadcom","BCM4311","802.11b/g Wireless LAN" },
-{0x14E4, 0x4312, "Broadcom","BCM4310","broadcom wireless 1490 (dell)" },
-{0x14E4, 0x4313, "Broadcom","BCM4310 UART","wireless network card" },
-{0x14E4, 0x4315, "Broadcom","BCM4315/BCM22062000","Broadcom Wireless b/g (Tested Drivers)" },
-{0x14E4, 0x4318, "Broadcom","BCM4318","Broadcom 802.11b/g WLAN" },
-{0x14E4, 0x4320, "Broadcom","BCM4306","802.11B/G Wireless Lan Controller 3-&#1103; &#1056;&#1077;&#1076;&#1072;&#1082;&#1094;&#1080;&#1103;" },
-{0x14E4, 0x4321, "Broadcom","BCM4306","802.11a Wireless LAN Controller" },
-{0x14E4, 0x4322, "Broadcom","BCM4306","UART" },
-{0x14E4, 0x4323, "Broadcom","BCM4306","V.90 56k Modem" },
-{0x14E4, 0x4324, "Broadcom","Broadcom 43225","802.11a/b/g Wireless LAN" },
-{0x14E4, 0x4325, "Broadcom","BCM4306","802.11b/g Wireless LAN Controller" },
-{0x14E4, 0x4326, "Broadcom","BCM4306","Chipcommon I/O Controller?" },
-{0x14E4, 0x4328, "Broadcom","BCM4321KFBG","Broadcom BCM43xx 1.0 (5.10.91.27)" },
-{0x14E4, 0x4329, "Broadcom","BCM43XX","Broadcom 802.11n Network Adapter" },
-{0x14E4, 0x432B, "Broadcom","4322","Broadcom Wireless LAN Driver " },
-{0x14E4, 0x4331, "Broadcom","BCM4331","Broadcom BCM4331" },
-{0x14E4, 0x4353, "Broadcom","BCM943224HMS","Broadcom Half Mini PCI Express Wifi card / DL1520 (aka Dell Wireless 1520 802.11n Mini Card WLAN Dri" },
-{0x14E4, 0x4357, "Broadcom","BCM94322c5HM","Broadcom WiFi 802.11b/g/n" },
-{0x14E4, 0x4358, "Broadcom","BCM943227HM4L","Broadcom 802.11n WLAN module" },
-{0x14E4, 0x4359, "Broadcom","BCM943228HM4L","Half-mini wireless-N card DW1530" },
-{0x14E4, 0x4365, "Broadcom","061117AA","Broadcom 43142 Wireless LAN Adapter" },
-{0x14E4, 0x43a1, "Broadcom","0x4360","Broadcom BCM4708A0" },
-{0x14E4, 0x4401, "Broadcom","BCM4401","10/100 Integrated Ethernet Controller" },
-{0x14E4, 0x4402, "Broadcom","BCM440","10/100 Integrated Ethernet Controller" },
-{0x14E4, 0x4403, "Broadcom","BCM4402","V.90 56k Modem" },
-{0x14E4, 0x4410, "Broadcom","BCM4413","iLine32 HomePNA 2.0" },
-{0x14E4, 0x4411, "Broadcom","BCM4212","V.90 56k Modem" },
-{0x14E4, 0x4412, "Broadcom","BCM4412","10/100BaseT Ethernet" },
-{0x14E4, 0x4430, "Broadcom","BCM44xx","CardBus iLine32 HomePNA 2.0" },
-{0x14E4, 0x4432, "Broadcom","BCM44xx","CardBus 10/100BaseT Ethernet" },
-{0x14E4, 0x4610, "Broadcom","BCM4610","Sentry5 PCI to SB Bridge" },
-{0x14E4, 0x4611, "Broadcom","BCM4610","Sentry5 iLine32 HomePNA 1.0" },
-{0x14E4, 0x4612, "Broadcom","BCM4610","Sentry5 V.90 56k Modem" },
-{0x14E4, 0x4613, "Broadcom","BCM4610","Sentry5 Ethernet Controller" },
-{0x14E4, 0x4614, "Broadcom","BCM4610","Sentry5 External Interface" },
-{0x14E4, 0x4615, "Broadcom","BCM4610","Sentry5 USB Controller" },
-{0x14E4, 0x4704, "Broadcom","BCM4704","Sentry5 PCI to SB Bridge" },
-{0x14E4, 0x4708, "Broadcom","BCM4704","Crypto Accelerator" },
-{0x14E4, 0x4710, "Broadcom","BCM4710","Sentry5 PCI to SB Bridge" },
-{0x14E4, 0x4711, "Broadcom","BCM47xx","Sentry5 iLine32 HomePNA 2.0" },
-{0x14E4, 0x4712, "Broadcom","BCM47xx","Sentry5 V.92 56k modem" },
-{0x14E4, 0x4713, "Broadcom","BCM47xx","Sentry5 Ethernet Controller" },
-{0x14E4, 0x4714, "Broadcom","BCM47xx","Sentry5 External Interface" },
-{0x14E4, 0x4715, "Broadcom","BCM47xx","Sentry5 USB Controller" },
-{0x14E4, 0x4716, "Broadcom","BCM47xx","Sentry5 USB Host Controller" },
-{0x14E4, 0x4717, "Broadcom","BCM47xx","Sentry5 USB Device Controller" },
-{0x14E4, 0x4718, "Broadcom","BCM47xx","Sentry5 Crypto Accelerator" },
-{0x14E4, 0x4720, "Broadcom","BCM4712","MIPS CPU" },
-{0x14E4, 0x4726, "Broadcom","7175144f","01" },
-{0x14E4, 0x4727, "Broadcom","BCM1503HMGIPAD_NT61","Dell Wireless 1501/1503/1701 Half Mini Card Driver  (used google chrome to download file)" },
-{0x14E4, 0x4728, "Broadcom","7175144f","01" },
-{0x14E4, 0x5365, "Broadcom","BCM5365P","Sentry5 PCI to SB Bridge" },
-{0x14E4, 0x5600, "Broadcom","BCM5600","StrataSwitch 24+2 Ethernet Switch Controller" },
-{0x14E4, 0x5605, "Broadcom","BCM5605","StrataSwitch 24+2 Ethernet Switch Controller" },
-{0x14E4, 0x5615, "Broadcom","BCM5784","StrataSwitch 24+2 Ethernet Switch Controller" },
-{0x14E4, 0x5625, "Broadcom","BCM5625","StrataSwitch 24+2 Ethernet Switch Controller" },
-{0x14E4, 0x5645, "Broadcom","BCM5645","StrataSwitch 24+2 Ethernet Switch Controller" },
-{0x14E4, 0x5670, "Broadcom","BCM5670","8-Port 10GE Ethernet Switch Fabric" },
-{0x14E4, 0x5680, "Broadcom","BCM5680","G-Switch 8-Port Gigabit Ethernet Switch Controller" },
-{0x14E4, 0x5690, "Broadcom","BCM5690","12-port Multi-Layer Gigabit Ethernet Switch" },
-{0x14E4, 0x5691, "Broadcom","BCM5691","GE/10GE 8+2 Gigabit Ethernet Switch Controller" },
-{0x14E4, 0x5802, "Broadcom","BCM5802","The BCM5802 Security Processor integrates Broadcom’s IPSec engine (DES, 3DES, HMAC-SHA-1, HMAC-MD5)," },
-{0x14E4, 0x5805, "Broadcom","BCM5805","The BCM5805 Security Processor integrates a high-performance IPSec engine (DES, 3DES, HMAC-SHA-1, HM" },
-{0x14E4, 0x5820, "Broadcom","BCM5820","Crypto Accelerator" },
-{0x14E4, 0x5821, "Broadcom","BCM5821","Crypto Accelerator" },
-{0x14E4, 0x5822, "Broadcom","BCM5822","Crypto Accelerator" },
-{0x14E4, 0x5823, "Broadcom","BCM5823","Crypto Accelerator" },
-{0x14E4, 0x5824, "Broadcom","BCM5824","Crypto Accelerator" },
-{0x14E4, 0x5825, "Broadcom","BCM5825","BCM5825" },
-{0x14E4, 0x5840, "Broadcom","BCM5840","Crypto Accelerator" },
-{0x14E4, 0x5841, "Broadcom","BCM5841","Crypto Accelerator" },
-{0x14E4, 0x5850, "Broadcom","BCM5850","Crypto Accelerator" },
-{0x14E4, 0x7321, "Broadcom","BCM5751","network card integrated" },
-{0x14E4, 0x7411, "Broadcom","BCM7411","High Definition Video/Audio Decoder" },
-{0x14E4, 0x8010, "Broadcom","BCM53010","Next generation router SOC with gigabit switch" },
-{0x14E4, 0x8011, "Broadcom","BCM53011","Next generation router SOC with gigabit switch" },
-{0x14E4, 0x8012, "Broadcom","BCM53012","Next generation router SOC with gigabit switch" },
-{0x14E4, 0x8016, "Broadcom","BCM53016","Next generation router SOC with gigabit switch with RGMII/SDIO, but disable 3 GPHY" },
-{0x14E4, 0x8018, "Broadcom","BCM53018","Next generation router SOC with gigabit switch with RGMII/SDIO" },
-{0x14E4, 0x8019, "Broadcom","BCM53019","Next generation router SOC with gigabit switch without RGMII/SDIO" },
-{0x14E4, 0x8022, "Broadcom","BCM53022","Next generation router SOC with gigabit switch with RGMII/SDIO" },
-{0x14E4, 0x8023, "Broadcom","BCM53023","Next generation router SOC with gigabit switch with SATA instead of RGMII/SDIO" },
-{0x14E4, 0x8025, "Broadcom","BCM53025","Next generation router SOC with gigabit switch with RGMII/SDIO, GMII, SGMII and SATA" },
-{0x14E4, 0x8202, "Broadcom","BCM8202","Packet Processor ASIC" },
-{0x14E4, 0x8334, "Broadcom","BCM53334","24 1G" },
-{0x14E4, 0x8342, "Broadcom","BCM53342","8 1G (PHY)" },
-{0x14E4, 0x8344, "Broadcom","BCM53344"," 24P 1G +4P 1G  (PHY)" },
-{0x14E4, 0x8346, "Broadcom","BCM53346","24P 1G +4P 1G/10G  (PHY)" },
-{0x14E4, 0x8393, "Broadcom","BCM53393","14P (1G,  (no PHY)" },
-{0x14E4, 0x8394, "Broadcom","BCM53394","10P 1G + 4x1/2.5/5/10G  (no PHY) " },
-{0x14E4, 0x8401, "Broadcom","BCM53401","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8402, "Broadcom","BCM53402","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8405, "Broadcom","BCM53405","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8406, "Broadcom","BCM53406","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8408, "Broadcom","BCM53408","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8411, "Broadcom","BCM53411","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8412, "Broadcom","BCM53412","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8415, "Broadcom","BCM53415","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8416, "Broadcom","BCM53416","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8418, "Broadcom","BCM53418","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0x8433, "Broadcom","BCM53433","L2+ Ethernet switch: 16P 1G" },
-{0x14E4, 0x8434, "Broadcom","BCM53434","L2+ Ethernet switch: 24P 1G" },
-{0x14E4, 0x8442, "Broadcom","BCM53442","L2+ Ethernet switch: 8P 1G + 4P 1G" },
-{0x14E4, 0x8443, "Broadcom","BCM53443","L2+ Ethernet switch: 16P 1G + 4P 1G" },
-{0x14E4, 0x8444, "Broadcom","BCM53444","L2+ Ethernet switch: 24P 1G + 4P 1G" },
-{0x14E4, 0x8446, "Broadcom","BCM53446","L2+ Ethernet switch: 24P 1G +2P 1G/10G +2P 1G/10G" },
-{0x14E4, 0x8447, "Broadcom","BCM53447","L2+ Ethernet switch: 24P 1G +2P 1G/10G +2P 1G/10G" },
-{0x14E4, 0x8448, "Broadcom","BCM53448","L2+ Ethernet switch: 8P 1G + 8P 1G/2.5G + 4P 10G" },
-{0x14E4, 0x8449, "Broadcom","BCM53449","L2+ Ethernet switch: 16P 1G + 8P 1G/2.5G + 4P 10G + 2P 20G" },
-{0x14E4, 0x9867, "Broadcom","900000000","900000000" },
-{0x14E4, 0x9876, "Broadcom","Texas Instruments PCI GemCore based SmartCard cont","0x14E4" },
-{0x14E4, 0xA8D6, "Broadcom","BCM6368","Broadcom 802.11n WLAN chip" },
-{0x14E4, 0xB061, "Broadcom","BCM56061","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0xB062, "Broadcom","BCM56062","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0xB063, "Broadcom","BCM56063","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0xB064, "Broadcom","BCM56064","160Gbps L2+ Ethernet Switch" },
-{0x14E4, 0xB150, "Broadcom","BCM56150","Hurricane2 (Lightly Managed) 24P 1G +4P 1G/10G  (PHY)" },
-{0x14E4, 0xb152, "Broadcom","BCM56152","24P  1G (PHY)" },
-{0x14E4, 0xB160, "Broadcom","BCM56160","L2+ switch: 24P 1G +2P 1G/10G +2P 1G/10G" },
-{0x14E4, 0xB161, "Broadcom","BCM56161","L2+ Ethernet switch: 24P 1G +2P 1G/10G +2P 1G/10G" },
-{0x14E4, 0xB162, "Broadcom","BCM56162","L2+ Ethernet switch: 24P 1G +4P 1G" },
-{0x14E4, 0xB340, "Broadcom","BCM56340","48-port multi-layer switch with embedded CPU" },
-{0x14E4, 0xB450, "Broadcom","BCM56450","100G Multi-layer Ethernet Switch" },
-{0x14E4, 0xB640, "Broadcom","BCM56640","260Gbps Extensible Switch with 100GE" },
-{0x14E4, 0xB842, "Broadcom","BCM56842","320Gbps Ethernet Multilayer Switch" },
-{0x14E4, 0xB845, "Broadcom","BCM56845","640G Multi-layer Ethernet Switch" },
-{0x14E4, 0xB850, "Broadcom","BCM56850","1.28T I/O Multi-layer Ethernet Switch" },
-{0x14E4, 0xB960, "Broadcom","BCM56960","3.2T I/O Multi-layer Ethernet Switch" },
-{0x14EA, 0xAB06, "Planex Communications, Inc.","XFNW-3603-T","10/100 Fast Ethernet CardBus (RTL8139)" },
-{0x14EB, 0x0020, "Seiko Epson Corporation","BEMx.x","PCI to S5U13xxxB00B Bridge Adapter" },
-{0x14EB, 0x0C01, "Seiko Epson Corporation","S1D13808","Embedded Memory Display Controller" },
-{0x14EC, 0x16BE, "Acqiris","CardReader_Broadcom","1.0.0.222_W7x86_A" },
-{0x14F1, 0x0F00, "Conexant","cx11252-11","HSF Generic Modem" },
-{0x14F1, 0x0F30, "Conexant","0x14F1","0x14F1" },
-{0x14F1, 0x1031, "Conexant","332","dfd" },
-{0x14F1, 0x1033, "Conexant","RH56D","RH56D-PCI" },
-{0x14F1, 0x1035, "Conexant","R6795-11","RH56D/SP-PCI, R6795-11, E416921/1, 0336 Mexico" },
-{0x14F1, 0x1036, "Conexant","Conexant RH56D/SP-PCI","" },
-{0x14F1, 0x1056, "Conexant","105614f1","subsys" },
-{0x14F1, 0x1059, "Conexant","DI15630-5, DI5631, DI5633","SmartHCF" },
-{0x14F1, 0x10B4, "Conexant","Conextant HFC","All Conextant HFC Modems (PCI)" },
-{0x14F1, 0x10B6, "Conexant","unknown","Conexant HCF PCI Soft modem" },
-{0x14F1, 0x1416, "Conexant","","Contexant" },
-{0x14F1, 0x1456, "Conexant","1456","HCFp Modem" },
-{0x14F1, 0x14F1, "Conexant","0x14F1","0x14F1" },
-{0x14F1, 0x1611, "Conexant","?","AccessRunner ADSL Modem" },
-{0x14F1, 0x1612, "Conexant","8","8" },
-{0x14F1, 0x2013, "Conexant","RS56-PCI","in-Build CX11235 modem" },
-{0x14F1, 0x2400, "Conexant","unknown","unknown" },
-{0x14F1, 0x2702, "Conexant","cx11252-11","HSFi or Soft V92 PCI Modem" },
-{0x14F1, 0x2710, "Conexant","","PCI modem card Conexant" },
-{0x14F1, 0x2740, "Conexant","CC_0780","Pci Simple Communtications Controller" },
-{0x14F1, 0x2B10, "Conexant","0x14F1","0x14F1" },
-{0x14F1, 0x2BFA, "Conexant","0x0000ffff","Conexant HDA D110 MDC v.92 Modem" },
-{0x14F1, 0x2C06, "Conexant","136","Conexant HD Audio SoftV92 Data Fax Modem with SmartCP" },
-{0x14F1, 0x2F00, "Conexant","00101767","HSF 56k HSFi Modem" },
-{0x14F1, 0x2f01, "Conexant","0x0780","missing driver for pci simple communications controller" },
-{0x14F1, 0x2F10, "Conexant","USR90-12","CXT / USR 56K Fax Host int" },
-{0x14F1, 0x2F20, "Conexant","CX11256","SoftV92 Data Fax Modem with SmartCP" },
-{0x14F1, 0x2F30, "Conexant","CX11252-41z","PCI SoftV92 Modem" },
-{0x14F1, 0x2F40, "Conexant","200014F1","PCI Soft Data Fax Modem with SmartCP" },
-{0x14F1, 0x2F50, "Conexant","99269","SmartLink 2801" },
-{0x14F1, 0x2F52, "Conexant","C0220001","01\\3&61AAA01&0&50" },
-{0x14F1, 0x2F81, "Conexant"," "," " },
-{0x14F1, 0x2F82, "Conexant","cx9510-11z","Conexant PCI-E Soft Data/Fax Modem with SmartCP" },
-{0x14F1, 0x5045, "Conexant","4.0.3.1","http://h10025.www1.hp.com/ewfrf/wc/softwareDownloadIndex?softwareitem=ob-43284-1&lc=en&dlc=en&cc=us&" },
-{0x14F1, 0x5047, "Conexant","Not sure","HDAUDIO Soft Data Fax Modm- Conexant Sound Card Audio Driver" },
-{0x14F1, 0x5051, "Conexant","4.0.1.6","Conexant HD-Audio SmartAudio 221" },
-{0x14F1, 0x5066, "Conexant","Cx20561","HDAUDIO\\Func_01&VEN_14F1&DEV_5069&SUBSYS_17AA214C&REV_1003" },
-{0x14F1, 0x5069, "Conexant","20585","conexant 20585 smartAudio HD" },
-{0x14F1, 0x506C, "Conexant","0x506C","Conexant High Definition Audio" },
-{0x14F1, 0x506E, "Conexant","001","Conexant 20672 SmartAudio HD" },
-{0x14F1, 0x50A1, "Conexant","CX20641/CX20651","Conexant HD Audio" },
-{0x14F1, 0x50A2, "Conexant","Conexant CX20642","Conexant HD Audio" },
-{0x14F1, 0x5B7A, "Conexant","Belived to be a CX23416","Single-Chip MPEG-2 Encoder with Integrated Analog Video/Broadcast Audio Decoder" },
-{0x14F1, 0x8800, "Conexant","Conexant CX23881","PAL audio/video decoder" },
-{0x14F1, 0x8801, "Conexant","CX23880","PCI Broadcast Audio/Video Decoder" },
-{0x14F1, 0x8802, "Conexant","CX2388x","MPEG Encoder " },
-{0x14F1, 0x8811, "Conexant","CX2388x","Audio Capture ike" },
-{0x14F1, 0x8852, "Conexant","cx23885","Leadtek Winfast PxDVR3200 H (XC3028)" },
-{0x14F1, 0x8880, "Conexant","CX23888","PCI Express Video and Broadcast Audio Decoder" },
-{0x14F1, 0x9876, "Conexant","PCI\\VEN_14F1&DEV_2F20&SUBSYS_200C14F1&REV_00\\4&CF8","Communication controller" },
-{0x14F2, 0x0001, "Mobility Electronics, Inc.","","Moselle Split Bridge" },
-{0x14F2, 0x0002, "Mobility Electronics, Inc.","","Capilano Split Bridge" },
-{0x14F2, 0x0120, "Mobility Electronics, Inc.","win7_rtm.090713-1257","Merlin Split Bridge" },
-{0x14F2, 0x0121, "Mobility Electronics, Inc.","","PCI Parallel Port" },
-{0x14F2, 0x0122, "Mobility Electronics, Inc.","unknown","PCI Serial Port" },
-{0x14F2, 0x0123, "Mobility Electronics, Inc.","6.1.7600.16385","PCI PS/2 Keyboard Port" },
-{0x14F2, 0x0124, "Mobility Electronics, Inc.","3103","PCI PS/2 Mouse Port" },
-{0x14F5, 0x2F00, "Sopac Ltd","x","x" },
-{0x14FD, 0x0001, "Silex Technology Inc.","H260u","H260u printer server for HP Printer" },
-{0x1507, 0x0001, "Htec Ltd.","MPC105 Eagle","" },
-{0x1507, 0x0002, "Htec Ltd.","MPC106 Grackle","" },
-{0x1507, 0x0003, "Htec Ltd.","MPC8240 Kahlua","" },
-{0x1507, 0x0100, "Htec Ltd.","MPC145575 HFC-PCI","" },
-{0x1507, 0x0431, "Htec Ltd.","KTI829c 100VG","" },
-{0x1507, 0x4801, "Htec Ltd.","Raven","" },
-{0x1507, 0x4802, "Htec Ltd.","Falcon","" },
-{0x1507, 0x4803, "Htec Ltd.","Hawk","" },
-{0x1507, 0x4806, "Htec Ltd.","CPX8216","" },
-{0x1516, 0x0800, "Myson Technology Inc","Myson MTD803/TAMARACK TC6020","PCI Ethernet controller" },
-{0x1516, 0x0803, "Myson Technology Inc","Myson MTD803/TAMARACK TC6020","PCI Ethernet controller" },
-{0x1516, 0x0891, "Myson Technology Inc","Myson MTD803/TAMARACK TC6020","PCI Ethernet controller" },
-{0x1519, 0x0020, "Telefon Aktiebolaget LM Ericsson","0123456789","HSIC Device" },
-{0x1519, 0x2004, "Telefon Aktiebolaget LM Ericsson","1","PCI Interface bus" },
-{0x151A, 0x1002, "Globetek Inc.","PCI-1002&DEV_4341&subsys_82441033&rev_01\\","4341" },
-{0x151A, 0x1004, "Globetek Inc.","PCI-1004","" },
-{0x151A, 0x1008, "Globetek Inc.","PCI-1008","" },
-{0x151B, 0x9080, "Combox Ltd","me594v02100 combox","combox cb 300a" },
-{0x151D, 0x9876, "Fujitsu Computer Products Of America","?","?" },
-{0x151F, 0x0001, "Topic Semiconductor Corp","TOPIC FM-56PCI-TP","TOPIC FM-56PCI-TP" },
-{0x151F, 0x0568, "Topic Semiconductor Corp","1.0.1.8","56k Internal Data Fax Voice Modem" },
-{0x1522, 0x0100, "Mainpine Limited","PBridge+","PCI Interface Chip" },
-{0x1523, 0x8, "Music Semiconductors","MU9C8K64","Content Addressable Memory" },
-{0x1524, 0x0751 ,"ENE Technology Inc","08011558","pci" },
-{0x1524, 0x0100, "ENE Technology Inc","ACPI\\ENE0100 ","ENE CIR Receiver " },
-{0x1524, 0x0510, "ENE Technology Inc","1.4.5.0","PCI Memory Card Reader Controller" },
-{0x1524, 0x0530, "ENE Technology Inc","CB-712/714/810","Memory Stick Card Reader" },
-{0x1524, 0x0550, "ENE Technology Inc","CB-712/714/810","Secure Digital Card Reader" },
-{0x1524, 0x0551, "ENE Technology Inc","10C11734","ven1524&dev_0551&SUBSYS_009F1025&REV_01" },
-{0x1524, 0x0555, "ENE Technology Inc","10c11734","ven1524&dev_0551&SUBSYS_009F1025&REV_01" },
-{0x1524, 0x0610, "ENE Technology Inc","???","PCI Smart Card Reader Controller" },
-{0x1524, 0x0730, "ENE Technology Inc","0x0751","CardBus Controller" },
-{0x1524, 0x100, "ENE Technology Inc","ACPI/ENE0100/3&21436425&0","ENE CIR Receiver" },
-{0x1524, 0x1025, "ENE Technology Inc","1025123","PCI\\VEN_127a&DEV_1025&SUBSYS_1025123A&REV_01\\4&1351887D&0&58F0" },
-{0x1524, 0x1211, "ENE Technology Inc","CB-1211","CardBus Controller" },
-{0x1524, 0x1225, "ENE Technology Inc","CB-1225","CardBus Controller" },
-{0x1524, 0x1410, "ENE Technology Inc","CB-1420","CardBus Controller" },
-{0x1524, 0x1411, "ENE Technology Inc","CB-710/2/4/810","pci device" },
-{0x1524, 0x1412, "ENE Technology Inc","CB-712/714/810","Cardbus Controller" },
-{0x1524, 0x1420, "ENE Technology Inc","CB-1420","CardBus Controller" },
-{0x1524, 0x1421, "ENE Technology Inc","CB-720/2/4","CardBus Controller" },
-{0x1524, 0x1422, "ENE Technology Inc","CB-722/4","CardBus Controller" },
-{0x1524, 0x510, "ENE Technology Inc","1.4.5.0","PCI Memory Card Reader Controller" },
-{0x1524, 0x551, "ENE Technology Inc","10C11734","ven1524&dev_0551&SUBSYS_009F1025&REV_01" },
-{0x1524, 0x9876, "ENE Technology Inc","1941","1941" },
-{0x1524, 0xFC10, "ENE Technology Inc","card bus","pci device" },
-{0x152D, 0x2329, "Quanta Computer Inc","2338","J micron JM20329" },
-{0x152D, 0x2519, "Quanta Computer Inc","n/a","JMicron Technology Corp. / JMicron USA Technology Corp" },
-{0x152E, 0x2507, "Melec Inc","0","0" },
-{0x1538, 0x0301, "Aralion Inc.","ARS106S","Tekram DC200 PATA100 RAID Controller" },
-{0x1538, 0x0303, "Aralion Inc.","ARS0304S","ARS0304S PATA133 RAID5" },
-{0x153B, 0x1115, "Terratec Electronic GMBH","ICE1712 Envy24","IC Ensemble Inc ICE1712 Envy24 Multichannel Audio Controller" },
-{0x153B, 0x1143, "Terratec Electronic GMBH","SAA7134HL","Philips Semiconductors SAA7134HL Multimedia Capture Device" },
-{0x153B, 0x6003, "Terratec Electronic GMBH","CS4614/22/24","CrystalClear SoundFusion PCI Audio Accel" },
-{0x153F, 0xdead, "MIPS Technologies, Inc","xx12345","Not a chip ..." },
-{0x1540, 0x9524, "Provideo Multimedia Co Ltd","saa7130","PAL/SECAM TV card w/ FM1216ME MK3 tuner (+FM radio)" },
-{0x1543, 0x1052, "Silicon Laboratories","30201543","Modem Intel 537EP (Chipset KAIOMY)" },
-{0x1543, 0x3052, "Silicon Laboratories","30201543","Modem Intel 537EP (Chipset KAIOMY)" },
-{0x1543, 0x3155, "Silicon Laboratories","InfineonTPMProfessional","ModemDeviceonHighDefinitionAudioBus" },
-{0x1549, 0x80FF, "Interconnect Systems Solutions","PCI-ISA-001","PCI/ISA Bus Bridge" },
-{0x154A, 0x9016, "Max Technologies Inc.","AF9016","USB DVB-T Device AF9015" },
-{0x154A, 0x9876, "Max Technologies Inc.","AF9015","USB DVB-T Device  CE950081" },
-{0x154B, 0x3038, "Computex Co Ltd","VT6212L","USB" },
-{0x1555, 0x0002, "Gesytec GmbH","PLX PCI 9050","Easylon PCI Bus Interface" },
-{0x1556, 0x5555, "PLDA","001","an cpci application" },
-{0x1558, 0x1558, "Clevo/Kapok Computer","0x1558","gtx 670mx GPU" },
-{0x155E, 0x0020, "KUKA Roboter GmbH","MFC3","Multi Function Card Version 3" },
-{0x1562, 0x0001, "Symbol Technologies, Inc.","LA-41x3","Spectrum24 Wireless LAN PCI Card" },
-{0x1562, 0x0002, "Symbol Technologies, Inc.","LA-5030","Symbol Wireless Networker 802.11a/g CardBus" },
-{0x1562, 0x0003, "Symbol Technologies, Inc.","LA-5033","Symbol Wireless Networker 802.11a/g PCI" },
-{0x156A, 0x5000, "Avtec Systems Inc","NA","Wideband Advanced Signal Processor" },
-{0x156A, 0x5100, "Avtec Systems Inc","NA","High Data Rate Radio" },
-{0x1571, 0xA001, "Contemporary Controls","TFF","GHB" },
-{0x1571, 0xA002, "Contemporary Controls","CCSI PCI20-485D","ARCnet" },
-{0x1571, 0xA003, "Contemporary Controls","CCSI PCI20-485X","ARCnet" },
-{0x1571, 0xA004, "Contemporary Controls","CCSI PCI20-CXB","ARCnet" },
-{0x1571, 0xA005, "Contemporary Controls","CCSI PCI20-CXS","ARCnet" },
-{0x1571, 0xA006, "Contemporary Controls","CCSI PCI20-FOG-SMA","ARCnet" },
-{0x1571, 0xA007, "Contemporary Controls","CCSI PCI20-FOG-ST","ARCnet" },
-{0x1571, 0xA008, "Contemporary Controls","CCSI PCI20-TB5","SONY" },
-{0x1571, 0xA009, "Contemporary Controls","CCSI PCI20-5-485","5 Mbit ARCnet" },
-{0x1571, 0xA00A, "Contemporary Controls","CCSI PCI20-5-485D","5 Mbit ARCnet" },
-{0x1571, 0xA00B, "Contemporary Controls","CCSI PCI20-5-485X","5 Mbit ARCnet" },
-{0x1571, 0xA00C, "Contemporary Controls","CCSI PIC20-5-FOG-ST","5 Mbit ARCnet" },
-{0x1571, 0xA00D, "Contemporary Controls","CCSI PCI20-5-FOG-SMA","5 Mbit ARCnet" },
-{0x1571, 0xA00E, "Contemporary Controls","COM200C22","ARCNET" },
-{0x1571, 0xA201, "Contemporary Controls","CCSI PCI22-485","10 Mbit ARCnet" },
-{0x1571, 0xA202, "Contemporary Controls","CCSI PCI22-485D","10 Mbit ARCnet" },
-{0x1571, 0xA203, "Contemporary Controls","CCSI PCI22-485X","10 Mbit ARCnet" },
-{0x1571, 0xA204, "Contemporary Controls","CCSI PCI22-CHB","10 Mbit ARCnet" },
-{0x1571, 0xA205, "Contemporary Controls","CCSI PCI22-FOG-ST","10 Mbit ARCnet" },
-{0x1571, 0xA206, "Contemporary Controls","CCSI PCI22-THB","10 Mbit ARCnet" },
-{0x157C, 0x8001, "Eurosoft (UK)","Fix2000","PCI Y2K Compliance Card" },
-{0x1584, 0x5054, "Vetronix Corporation Engenharia Ltda","VAS5055","VAS Vetronix Automotive Service" },
-{0x1584, 0x4003, "Vetronix Corporation Engenharia Ltda","VAS5052","VAS Vetronix Automotive Service" },
-{0x1586, 0x0803, "Lancast Inc","","" },
-{0x1588, 0x1100, "Solidum Systems Corp","PAX.port 1100","PAX.ware 1100 dual Gb classifier engine" },
-{0x1588, 0x2000, "Solidum Systems Corp","AMD '971","SNP 8023 packet classifier - AMD component" },
-{0x1588, 0x8023, "Solidum Systems Corp","SNP8023","PAX.ware 100 packet classifier" },
-{0x158B, 0x0005, "Allied Data Technologies","HLF-VMPEU560-C","Standar HSP Modem" },
-{0x158B, 0x0015, "Allied Data Technologies","HLF-VMPEU560-C","Standar HSP Modem Series" },
-{0x1592, 0x0781, "Syba Tech Ltd.","W83787IF","Multi-IO Card" },
-{0x1592, 0x0782, "Syba Tech Ltd.","W837871F","Parallel Port Card (EPP)" },
-{0x1592, 0x0783, "Syba Tech Ltd.","TC32001 PCI I/O","Multi-IO Card" },
-{0x1592, 0x0785, "Syba Tech Ltd.","907ab184740802","Multi-IO Card" },
-{0x1592, 0x0786, "Syba Tech Ltd.","Winbond w83787if","Multi-IO Card" },
-{0x1592, 0x0787, "Syba Tech Ltd.","winbond w83787if","Multi-IO Card 2 series" },
-{0x1592, 0x0788, "Syba Tech Ltd.","w837871f","Multi-IO Card" },
-{0x1592, 0x078A, "Syba Tech Ltd.","007AB192367002ND","Multi-IO Card" },
-{0x15A2, 0x0001, "Catalyst Enterprises Inc","TA700","PCI Bus Analyzer/Exerciser" },
-{0x15AD, 0x0405, "VMware Inc.","9500MGS","VMWARE SVGA II" },
-{0x15AD, 0x0710, "VMware Inc.","0740","Virtual SVGA" },
-{0x15AD, 0x0720, "VMware Inc.","VMXNET","VMware PCI Ethernet Adapter" },
-{0x15AD, 0x0740, "VMware Inc.","58","VMW5858are VMCI Bus Device" },
-{0x15AD, 0x0770, "VMware Inc.","n/a","Standard Enhanced PCI to USB Host Controller" },
-{0x15AD, 0x0778, "VMware Inc.","0778","Sabrent USB-to-Parallel Adapter" },
-{0x15AD, 0x07B0, "VMware Inc.","VMXNET 3","VMware vSphere 4 PCI Ethernet Adapter" },
-{0x15AD, 0x0801, "VMware Inc.","n/a","PCI Memory Controller" },
-{0x15AD, 0x1975, "VMware Inc.","N/A","High Definition Audio Codec" },
-{0x15AD, 0x1977, "VMware Inc.","N/A","High Definition Audio Controller" },
-{0x15B0, 0x0001, "Zoltrix International Limited","FM-3986","Pctel" },
-{0x15B0, 0x0003, "Zoltrix International Limited","FM-3986","Pctel" },
-{0x15B0, 0x2BD0, "Zoltrix International Limited","2BD0","soft56k voice,data,fax CARP" },
-{0x15B3, 0x5274, "Mellanox Technology","MT21108","InfiniBridge" },
-{0x15B3, 0x5A44, "Mellanox Technology","MT23108","InfiniHost I" },
-{0x15B3, 0x6274, "Mellanox Technology","MT25204","InfiniHost III Lx" },
-{0x15B3, 0x6278, "Mellanox Technology","MT25208A0-FCC","InfiniHost TM III Ex" },
-{0x15B3, 0x6282, "Mellanox Technology","MT25218","MT25218 [InfiniHost III Ex]" },
-{0x15B3, 0x634A, "Mellanox Technology","MT2518","Mellanox ConnectX VPI (MT2548) - PCIe 2.0 2.5GT/s, IB DDR /10GigE Network Adaptor" },
-{0x15B3, 0x6732, "Mellanox Technology","MT26418","ConnectX VPI (MT26418) - PCIe 2.0 5GT/s, IB DDR / 10GigE" },
-{0x15B8, 0x3009, "Addi-Data GMBH","xPCI-3504","Analog output board" },
-{0x15BC, 0x0101, "Agilent Technologies","n2530a","DX2+ FC-AL Adapter" },
-{0x15BC, 0x0103, "Agilent Technologies","QX4","4 Port Fibre Channel Controller" },
-{0x15BC, 0x0B01, "Agilent Technologies","SUBSYS_000015BC&REV_00","Agilen PCI-GPIB" },
-{0x15BC, 0x1200, "Agilent Technologies","0x15bc","Agilent QX4 Fibre Channel Controller" },
-{0x15BC, 0x2530, "Agilent Technologies","???","HP Communications Port" },
-{0x15BC, 0x2531, "Agilent Technologies","???","HP Toptools Remote Control Adapter" },
-{0x15BC, 0x2532, "Agilent Technologies","???","HP Toptools Remote Control Adapter" },
-{0x15BC, 0x2929, "Agilent Technologies","E2929A","PCI/PCI-X Bus Analyzer" },
-{0x15C2, 0x0038, "Newer Technology Inc","2.4G","part of the iMon-IR-RC-Display-Kit" },
-{0x15D1, 0x0001, "Infineon Technologies AG","TC11IB","TriCore 32-bit Single-chip Microctrlr" },
-{0x15D1, 0x0003, "Infineon Technologies AG","PEB 20544 E v1.1","6 Port Optimized Comm Ctrlr (SPOCC)" },
-{0x15D1, 0x0004, "Infineon Technologies AG","PNPA000","Infineon Technologies AG" },
-{0x15D1, 0x000B, "Infineon Technologies AG","SLB9635","TPM" },
-{0x15D8, 0x9001, "Cybernetics Technology Co Ltd","","" },
-{0x15D9, 0x9876, "Super Micro Computer Inc","1234","4567" },
-{0x15DC, 0x0001, "Litronic Inc.","Argus 300","PCI Cryptography Module" },
-{0x15DD, 0x7664, "Sigmatel Inc.","vgn-ar51j","idt high audio" },
-{0x15DD, 0x7680, "Sigmatel Inc.","2772","SIGMATEL STAC 92XX C-Major HD Audio" },
-{0x15DD, 0x769, "Sigmatel Inc.","7690","9200 HD ÐÑƒÐ´Ð¸Ð¾ ÐšÐžÐ”Ð•Ðš" },
-{0x15DD, 0x7690, "Sigmatel Inc.","10F70000","You'll Love me 4 this/ visit http://wendhelofopportunity.info Support Me!" },
-{0x15DD, 0x8384, "Sigmatel Inc.","HDAUDIO\\FUNC_01&VEN_8384&DEV_7616&SUBSYS_1028020A&","Intel Audio Studio" },
-{0x15DD, 0x9876, "Sigmatel Inc.","1","1" },
-{0x15E0, 0x7134, "Cacheflow Inc","01385168","01" },
-{0x15E2, 0x0500, "Quicknet Technologies Inc","","Internet PhoneJack PCI Card" },
-{0x15E6, 0x0002, "Agere Inc.","1646t00","v.90 Lucent Modem" },
-{0x15E7, 0x755, "GET Engineering Corp.","QUAD-P","NTDS Parallel Adapter" },
-{0x15E8, 0x0130, "National Datacomm Corp.","NCP130","Wireless NIC" },
-{0x15E8, 0x0131, "National Datacomm Corp.","Prism II","InstantWave HR PCI card" },
-{0x15E9, 0x1841, "Pacific Digital Corp.","NetStaQ ADMA-100","ATA controller" },
-{0x15EF, 0x0028, "Intelligent Paradigm Inc","8280BDM SoundMAX Controller (ICH7-M B0 Setup)","SigmaTelHigh Definition Audio CODEC" },
-{0x15EF, 0x24c5, "Intelligent Paradigm Inc","8280BDM SoundMAX Controller (ICH4-M B0 Setup)","VIA-Vynil v700b" },
-{0x15EF, 0x7616, "Intelligent Paradigm Inc","102801F7","SigmaTelHigh Definition Audio CODEC" },
-{0x15F1, 0x2F30, "Times N Systems Inc","CX11252-15","Conexant HSFi" },
-{0x15F2, 0x0001, "SPOT Imaging Solutions a division of Diagnostic Instruments, Inc","Spot RT","Spot RT Interface Board" },
-{0x15F2, 0x0002, "SPOT Imaging Solutions a division of Diagnostic Instruments, Inc","Spot RT #2","Spot RT Interface Board" },
-{0x15F2, 0x0003, "SPOT Imaging Solutions a division of Diagnostic Instruments, Inc","Spot Insight","Spot Insight Interface Board" },
-{0x160A, 0x3184, "Kollmorgen Servotronix","6656","Via VT6656 Wireless Lan Adapter" },
-{0x1616, 0x0409, "Iotech Inc.","DaqBoard/2000","16-Bit, 200-kHz PCI Data Acquisition DaqBoards with DBK Signal Conditioning Support " },
-{0x1619, 0x0400, "FarSite Communications Limited","FarSync T2P","Two Port Intelligent Sync Comms Card" },
-{0x1619, 0x0440, "FarSite Communications Limited","FarSync T4P","Four Port Intelligent Sync Comms Card" },
-{0x1619, 0x0610, "FarSite Communications Limited","FarSync T1U","One Port Intelligent Sync Comms Card" },
-{0x1619, 0x0620, "FarSite Communications Limited","FarSync T2U","Two Port Intelligent Sync Comms Card" },
-{0x1619, 0x0640, "FarSite Communications Limited","FarSync T4U","Four Port Intelligent Sync Comms Card" },
-{0x1619, 0x1610, "FarSite Communications Limited","FarSync TE1","One Port Intelligent Sync Comms Card" },
-{0x1619, 0x1612, "FarSite Communications Limited","FarSync TE1e (PCI Express)","One Port Intelligent Sync Comms Card" },
-{0x1619, 0x2610, "FarSite Communications Limited","FarSync DSL-S1","G.SHDSL Intelligent Sync Comms Card" },
-{0x1619, 0x3640, "FarSite Communications Limited","FarSync T4E","Four Port Intelligent Sync Comms Card" },
-{0x1619, 0x4620, "FarSite Communications Limited","FarSync T2Ue (PCI Express)","Two Port Intelligent Sync Comms Card" },
-{0x1619, 0x4640, "FarSite Communications Limited","FarSync T4Ue (PCI Express)","Four Port Intelligent Sync Comms Card" },
-{0x1619, 0x5621, "FarSite Communications Limited","FarSync T2Ee (PCI Express)","Two Port Intelligent Sync Comms Card" },
-{0x1619, 0x5641, "FarSite Communications Limited","FarSync T4Ee (PCI Express)","Four Port Intelligent Sync Comms Card" },
-{0x1619, 0x6620, "FarSite Communications Limited","FarSync-T2U-PMC","Two Port Intelligent Sync Comms Card" },
-{0x1621, 0x0020, "Lynx Studio Technology Inc","LynxTWO-A","4 in/4 out Professional Digital Audio Card" },
-{0x1621, 0x0021, "Lynx Studio Technology Inc","LynxTWO-B","2 in/6 out Professional Digital Audio Card" },
-{0x1621, 0x0022, "Lynx Studio Technology Inc","LynxTWO-C","6 in/2 out Professional Digital Audio Card" },
-{0x1621, 0x0023, "Lynx Studio Technology Inc","Lynx L22","2 in/2 out Professional Digital Audio Card" },
-{0x1621, 0x0024, "Lynx Studio Technology Inc","Lynx AES16","16 in/16 out AES/EBU Audio Card" },
-{0x1621, 0x0025, "Lynx Studio Technology Inc","Lynx AES16-SRC","16 in/16 out AES/EBU Audio Card w/SRC" },
-{0x1629, 0x1003, "Kongsberg Spacetec a.s.","","Format Synchronizer v3.0" },
-{0x1629, 0x2002, "Kongsberg Spacetec a.s.","","Fast Universal Data Output" },
-{0x162D, 0x0100, "Reprosoft Co Ltd","driver","Repeographics controller" },
-{0x162D, 0x0101, "Reprosoft Co Ltd","","Reprographics Controller" },
-{0x162D, 0x0102, "Reprosoft Co Ltd","","Reprographics Controller" },
-{0x162D, 0x0103, "Reprosoft Co Ltd","","Reprographics Controller" },
-{0x162F, 0x1111, "Rohde & Schwarz GMBH & Co KG","TS-PRL1","General Purpose Relay Card" },
-{0x162F, 0x1112, "Rohde & Schwarz GMBH & Co KG","TS-PMA","Matrix Card" },
-{0x1638, 0x1100, "Eumitcom Technology Inc","WL11000P"," WL11000P" },
-{0x163B, 0x2416, "Glotrex Co Ltd","Techwell - TW2804  Model - JSA-2416Drivers on this","DVR Video Capture Card 16CH" },
-{0x163C, 0x3052, "intel","R6793-11","RS56/HSP-PCI" },
-{0x163C, 0xFF02, "intel","82801 GB","PCI Bridge - 244E" },
-{0x164F, 0x0001, "Datavoice (Pty) Ltd.","PLX 9054","PCI interface chip" },
-{0x164F, 0x0002, "Datavoice (Pty) Ltd.","PLX 9054","PCI interaface chip" },
-{0x1657, 0x0646, "Brocade Communications Systems","BRE040","Brocade 400 series PCIe HBA" },
-{0x1658, 0x0704, "Med Associates Inc.","905410B5","DIG 704 PCI - Interface with Millisecond Timer and Interrupts" },
-{0x165A, 0xC100, "Epix Inc.","PIXCI CL1","PCI camera link video capture board" },
-{0x165A, 0xD200, "Epix Inc.","PIXCI D2X","PCI digital video capture board" },
-{0x165A, 0xD300, "Epix Inc.","PIXCI D3X","PCI digital video capture board" },
-{0x165A, 0xF001, "Epix Inc.","PIXCI EL1","PCI-E camera link video capture board" },
-{0x165C, 0x0002, "Kondo Kagaku","FT232BL","FT232BL" },
-{0x165F, 0x2000, "Comartsystem Korea","XILINX SPARTAN","16 Channel Audio Capture Card" },
-{0x1668, 0x0100, "Actiontec Electronics Inc.","0304","PCI to PCI Bridge" },
-{0x166D, 0x0001, "Sibyte Inc.","BCM1125/BCM1250 PCI Configuration Header","" },
-{0x166D, 0x0002, "Sibyte Inc.","BCM1125/BCM1250 HyperTransport Configuration Heade","MIPS BCM1125/BCM1250 processors" },
-{0x1676, 0x1001, "Emachines Inc.","5.10.00.5760","Realtek AC' 97 Audio Driver" },
-{0x1677, 0x20ad, "Bernecker + Rainer","5ACPCI.MFIO-K01","Profibus DP / K-Feldbus / COM" },
-{0x167F, 0x4634, "iba AG","","FOB-IO Card" },
-{0x167F, 0x4C32, "iba AG","","L2B PCI Board" },
-{0x167F, 0x5344, "iba AG","SD \\ VID_03 ÃÂ¸ OID_5344 ÃÂ¸ PID_SU01G ÃÂ¸ REV_","FOB-SD Card" },
-{0x167F, 0x5443, "iba AG","","FOB-TDC Card" },
-{0x167F, 0xF0B1, "iba AG","ibaFOB-io-D","ibaFOB-io-D" },
-{0x167F, 0xF0B2, "iba AG","ibaFOB-2io-D","ibaFOB-2io-D" },
-{0x167F, 0xF0B4, "iba AG","ibaFOB-4io-D","ibaFOB-4io-D" },
-{0x167F, 0xF1B2, "iba AG","ibaFOB-2i-D","ibaFOB-2i-D" },
-{0x167F, 0xF5DE, "iba AG","ibaFOB-SDexp","ibaFOB-SDexp" },
-{0x167F, 0xFDCE, "iba AG","ibaFOB-TDCexp","ibaFOB-TDCexp" },
-{0x167F, 0xFEC1, "iba AG","ibaFOB-io-ExpressCard","ibaFOB-io-ExpressCard" },
-{0x1681, 0x0050, "Hercules","HWGPCI-54","Hercules WiFi PCI 802.11G" },
-{0x1682, 0x2931, "PINE Technology, Ltd.","unknown","HD-467X-DDF2 video card " },
-{0x1682, 0x9875, "PINE Technology, Ltd.","779A","HD 7700 Series" },
-{0x1688, 0x0013, "CastleNet Technology Inc.","AR5213","" },
-{0x168C, 0x001c,"Atheros Communications Inc.","AR5005GS","pci\\ven_10ac&dev_ooo" },
-{0x168C, 0x0027, "Atheros Communications Inc.","E017105B","Atheros AR5B95 Wireless LAN 802.11 a/b/g/n Controller" },
-{0x168C, 0x0030, "Atheros Communications Inc.","PCI\\VEN_168C&DEV_0030&SUBSYS_16A810CF&REV_01","TP-LINK 450Mbps Wireless N Adapter" },
-{0x168C, 0x0007, "Atheros Communications Inc.","AR5007UG","ROOT\\MS_SSTPMINIPORT\\0000" },
-{0x168C, 0x0011, "Atheros Communications Inc.","11L/b/g Wireless LAN Mini PCI Adapter","11L/b/g Wireless LAN Mini PCI Adapter" },
-{0x168C, 0x0012, "Atheros Communications Inc.","AR5211"," PCI\\VEN_1217&DEV_7130&SUBSYS_FF501179&REV_01 DELL Latitude C510 as mini-PCI board behind the larg" },
-{0x168C, 0x0013, "Atheros Communications Inc.","Netgear WPN311","Netgear RangeMax WPN311 PCI Wireless NIC" },
-{0x168C, 0x0019, "Atheros Communications Inc.","AR5bmb5","802.11a Wireless Adapter" },
-{0x168C, 0x001A, "Atheros Communications Inc.","Atheros AR5005GS","http://support1.toshiba-tro.de/tools/updates/atheros-wlan/atheros-wlan-xp-7702331.zip" },
-{0x168C, 0x001B, "Atheros Communications Inc.","AR5006X","802.11abg NIC" },
-{0x168C, 0x001c, "Atheros Communications Inc.","AR5007EG","Atheros AR5007EG Wireless Network Adapter" },
-{0x168C, 0x001D, "Atheros Communications Inc.","TP-Link TL-WN350GD","PCI\\VEN_168C&DEV_002B&SUBSYS_E034105B&REV_01\\4&124A40C8&0&00E1" },
-{0x168C, 0x002, "Atheros Communications Inc.","c660","PCI/VEN_168C&DEV_002B&SUBSYS_7173144F&REV_01\\4&200004B7&0&00E1" },
-{0x168C, 0x0023, "Atheros Communications Inc.","AR5416","802.11a/b/g/n&#1041;&#1077;&#1089;&#1087;&#1088;&#1086;&#1074;&#1086;&#1076;&#1085;&#1086;&#1081; PC" },
-{0x168C, 0x0024, "Atheros Communications Inc.","AR5B97","Atheros 802.11a/b/g/n" },
-{0x168C, 0x0027, "Atheros Communications Inc.","E017105B","Atheros AR5B95 Wireless LAN 802.11 a/b/g/n Controller" },
-{0x168C, 0x002A, "Atheros Communications Inc.","AR9283-ALIA or DW1525","Wireless Network Adapter" },
-{0x168C, 0x002B, "Atheros Communications Inc.","66318898888811ad","Atheros AR5B95 " },
-{0x168C, 0x002C, "Atheros Communications Inc.","AR5006","Wireless 802.11 a/b/g/n WiFi Adapter (PCI-Express)" },
-{0x168C, 0x002D, "Atheros Communications Inc.","AR9287 rev01","802.11b/g/n" },
-{0x168C, 0x002E, "Atheros Communications Inc.","AR9287","Atheros ar9287 PCI &#1052;&#1086;&#1078;&#1083;&#1080;&#1074;&#1086;&#1089;&#1090;&#1110;: &#1047;&#" },
-{0x168C, 0x0030, "Atheros Communications Inc.","1102 - 1103","Killer Wireless - N" },
-{0x168C, 0x0032, "Atheros Communications Inc.","168Cx0032","Atheros AR9485" },
-{0x168C, 0x0034, "Atheros Communications Inc.","DW1901","802.11a/b/g/n, BT4.0+HS " },
-{0x168C, 0x0036, "Atheros Communications Inc.","AR956x","Qualcomm Atheros AR956x Wireless Network Adapter" },
-{0x168C, 0x0037, "Atheros Communications Inc.","AR1111","Atheros AR1111 WB-EG Wireless Network Adapter" },
-{0x168C, 0x003e, "Atheros Communications Inc.","QCA61x4","Wireless Network Adapter" },
-{0x168C, 0x007, "Atheros Communications Inc.","AR5007UG","Wireless Network Adapter" },
-{0x168C, 0x0280, "Atheros Communications Inc.","0x002b","PCI\\VEN_168C&DEV_002B&SUBSYS_30AF185F" },
-{0x168C, 0x032, "Atheros Communications Inc.","0x0280","Dell Wireless DW1703 802.11b/g/n, BT4.0 + HS " },
-{0x168C, 0x1014, "Atheros Communications Inc.","AR9285","Atheros AR5212 802.11abg wireless Drivers" },
-{0x168C, 0x14F1, "Atheros Communications Inc.","nForce6100-430  ","PCI\\VEN_168C&DEV_001A&SUBSYS_04181468&REV_01\\4&FCF0450&0&10A4" },
-{0x168C, 0x168C, "Atheros Communications Inc.","AREG9485WB-0036","Qualcomm Atheros AR9485WB-EG Wireless Network Adapter" },
-{0x168C, 0x1a3b, "Atheros Communications Inc.","ar8132","802.11a/b/g/n Wireless PCI Adapte" },
-{0x168C, 0x3002, "Atheros Communications Inc.","AR3011","Bluetooth 3.0" },
-{0x168C, 0x6666, "Atheros Communications Inc.","AR5007UG","Atheros AR5B95 Wireless LAN 802.11 a/b/g/n Controller" },
-{0x168C, 0x9876, "Atheros Communications Inc.","AR5419","Atheros AR5B95 Wireless LAN 802.11 a/b/g/n Controller" },
-{0x168C, 0xFF1B, "Atheros Communications Inc.","AR 5001","Wireless LAN G" },
-{0x168C, 0xFF96, "Atheros Communications Inc.","AR5212","LAN-Express AS IEEE 802.11g miniPCI adapter" },
-{0x1690, 0x0742, "NetContinuum, Inc.","BCM2070","BRCM Bluetooth Controller BCM2070" },
-{0x1693, 0x0212, "FERMA","PLX PCI9054","EPONINE ESR-PCI Board" },
-{0x1693, 0x0213, "FERMA","Motorola MPC8245","EPONINE MTM120 PCI Board" },
-{0x16AE, 0x000A, "SafeNet Inc.","SafeXcel-1841","Crypto Accelerator" },
-{0x16AE, 0x1141, "SafeNet Inc.","SafeXcel-1141","Crypto Accelerator" },
-{0x16CA, 0x0001, "Cenatek Inc.","Rocket Drive","Solid State Disk" },
-{0x16EC, 0x0116, "U.S. Robotics","RTL8169S","RealTek 8169S chip" },
-{0x16EC, 0x0303, "U.S. Robotics","Rev_0200","U.S. Robotics 56K FAX USB V1.1.0 /  V.92 USB modem" },
-{0x16EC, 0x1007, "U.S. Robotics","0637","U.S. Robotics 56K Win INT" },
-{0x16EC, 0x2013, "U.S. Robotics","11323A","U.S. Robotics 56K Voice Host Int" },
-{0x16EC, 0x2F00, "U.S. Robotics","USRobotics 5660A - Internal Soft Modem","http://www.usr.com/support/product-template.asp?prod=5660a" },
-{0x16EC, 0x2f12, "U.S. Robotics","E129336-1","U.S.Robotic (A- Modem/PCI)" },
-{0x16EC, 0x3685, "U.S. Robotics","1518","Wireless Access Adapter Model 022415" },
-{0x16EC, 0x5685, "U.S. Robotics","E129336-1","U.S. Robotics 56K Voice Host Int (A-Modem/ PCI)" },
-{0x170B, 0x0100, "NetOctave Inc.","NSP2000-SSL","Crypto Aceletator" },
-{0x1710, 0x5812, "Pelago Networks","5812","itech numeric small keyboard" },
-{0x1710, 0x9835, "Pelago Networks","9825","2 serial, 1 LPT port PCI Card" },
-{0x1712, 0x3038, "NICE Systems Inc.","VT6212L","usb" },
-{0x1712, 0x7130, "NICE Systems Inc.","0x1712","unknown" },
-{0x1725, 0x7174, "Vitesse Semiconductor","VSC7174","VSC7174 PCI/PCI-X SATA Controller" },
-{0x1734, 0x007a, "Fujitsu-Siemens Computers GmbH","Rage XL","ATI Rage XL (rev 27)" },
-{0x1734, 0x1011, "Fujitsu-Siemens Computers GmbH","AIC-7902W","Adaptec AIC-7902 Dual Channel U320 SCSI" },
-{0x1734, 0x1012, "Fujitsu-Siemens Computers GmbH","CSB6","Serverworks Southbridge with RAID/IDE (rev a0), OHCI USB (rev 05), GCLE-2 Host Bridge" },
-{0x1734, 0x1013, "Fujitsu-Siemens Computers GmbH","BCM5703","Broadcom Corp. NetXtreme Gigabyte Ethernet" },
-{0x1734, 0x10b9, "Fujitsu-Siemens Computers GmbH","0x00541000","SAS 3000 series, 8-port with 1068 -StorPort" },
-{0x1737, 0x0071, "LinkSys","RT2870","Dual Band Wireless N USB Network Adapter" },
-{0x1737, 0x1032, "LinkSys","EG1032 v3","Linksys Instant Gigabit Desktop Network Interface" },
-{0x173B, 0x03E8, "Altima Communications Inc.","AC1000","Gigabit Ethernet Adapter" },
-{0x173B, 0x03EA, "Altima Communications Inc.","AC1002","Gigabit Ethernet Adapter" },
-{0x1743, 0x8139, "Peppercon AG","ROL/F-100","Fast Ethernet Adapter with ROL" },
-{0x174B, 0x0260, "PC Partner Limited","RV280","Saphire Radeon 9250" },
-{0x174B, 0x0261, "PC Partner Limited","RV280","Sapphire Radeon 9250 - Secondary" },
-{0x174B, 0x7176, "PC Partner Limited","RV250","RADEON 9000 ATLANTIS PRO" },
-{0x174B, 0x7177, "PC Partner Limited","RV280","RADEON 9000 ATLANTIS PRO - Secondary" },
-{0x174B, 0x71C6, "PC Partner Limited","RV530","ATI RADEON X1650 Series" },
-{0x174B, 0x7244, "PC Partner Limited","RV580","Sapphire ATI  X1950 XT" },
-{0x174B, 0x7C12, "PC Partner Limited","RV280","RADEON 9200 ATLANTIS - Secondary" },
-{0x174B, 0x7C13, "PC Partner Limited","RV280","RADEON 9200 ATLANTIS" },
-{0x174B, 0x9501, "PC Partner Limited","RV620 ","ATI Radeon HD 3450" },
-{0x174B, 0xE106, "PC Partner Limited","0x954F","Graphics Chipset	ATI Radeon HD 4300/4500 Series       	" },
-{0x174B, 0xe131, "PC Partner Limited","RV770","ATI 4870" },
-{0x174B, 0xE140, "PC Partner Limited","5870","Sapphire HD 5870 1GB GDDR5" },
-{0x1753, 0x1001, "TeraRecon, Inc.","VP500","VolumePro 500" },
-{0x1753, 0x1004, "TeraRecon, Inc.","VP1000","VolumePro 1000" },
-{0x1755, 0x000, "Alchemy Semiconductor Inc.","","" },
-{0x1755, 0x0000, "Alchemy Semiconductor Inc.","Au1500","Au1500 Processor" },
-{0x17A1, 0x0128, "Tascorp"," 17A1","USB2.0 JPEG WebCam " },
-{0x17AA, 0x0106, "Legend Ltd. (Beijing)","Intel HD Graphics 2000","Intel Sandy Bridge-MB GT1 - Integrated Graphics Controller [D2/J1/Q0] [Lenovo" },
-{0x17AA, 0x7145, "Legend Ltd. (Beijing)","138A","Mobility ATI Radeon X1400" },
-{0x17AF, 0x4150, "Hightech Information Systems, Ltd.","200","HIS Excalibur Radeon 6870" },
-{0x17AF, 0x7291, "Hightech Information Systems, Ltd.","RV560","HIS  Radeon X1650 XT" },
-{0x17C0, 0x12ab, "Wistron Corp.","","intel" },
-{0x17CC, 0x1978, "NetChip","net 2280","usb 2.0 device controller" },
-{0x17CC, 0x2280, "NetChip","Net 2280","USB 2.0 Device Controller" },
-{0x17D5, 0x5831, "Neterion Inc.","X1","Xframe 10GbE PCI-X Adapter" },
-{0x17D5, 0x5832, "Neterion Inc.","X2","Xframe II 10GbE PCI-X 2.0 Adapter" },
-{0x17D5, 0x5833, "Neterion Inc.","X3","E3100 PCI-Express 10Gb Ethernet Interface" },
-{0x17db, 0x0101, "Cray, Inc.","NA","Seastar Network" },
-{0x17db, 0x0201, "Cray, Inc.","NA","Gemini Network" },
-{0x17db, 0x0301, "Cray, Inc.","NA","Aries Network" },
-{0x17E9, 0x02a7, "DH electronics GmbH / Sabrent","0000","USB VGA/DVI Adapter UV-D4A1-B" },
-{0x17E9, 0x4318, "DH electronics GmbH / Sabrent","n/a","Dell GigabitEthernet (USB-G1000)" },
-{0x17EE, 0x4153, "Connect Components, Ltd.","RV350","Radeon 9550" },
-{0x17F3, 0x1010, "RDC Semiconductor Co., Ltd.","D1010","IDE Controller " },
-{0x17F3, 0x1011, "RDC Semiconductor Co., Ltd.","D1011","Standard IDE Controller" },
-{0x17F3, 0x1030, "RDC Semiconductor Co., Ltd.","M1030","PCI to PCI-E Bridge" },
-{0x17F3, 0x2010, "RDC Semiconductor Co., Ltd.","M2010","GPU (VGA )" },
-{0x17F3, 0x3010, "RDC Semiconductor Co., Ltd.","M3010","HD Audio" },
-{0x17F3, 0x6021, "RDC Semiconductor Co., Ltd."," ","Host Bridge" },
-{0x17F3, 0x6036, "RDC Semiconductor Co., Ltd."," ","PCI to ISA Bridge" },
-{0x17F3, 0x6040, "RDC Semiconductor Co., Ltd.","R6040x","Ethernet MACx" },
-{0x17F3, 0x6060, "RDC Semiconductor Co., Ltd."," modem","USB Controller (OHCI)" },
-{0x17F3, 0x6061, "RDC Semiconductor Co., Ltd."," V90479. 1","USB 2.0 Controller (EHCI)" },
-{0x17FE, 0x2220, "INPROCOMM","2120","Generic IEEE 802.11b/g Wireless LAN Card" },
-{0x1813, 0x3059, "Ambient Technologies Inc","VT8237","AC97 Enhanced Audio Controller - the 8251 controller is different" },
-{0x1813, 0x4000, "Ambient Technologies Inc","MD5628D-L-A","intel V.92 HaM Modem" },
-{0x1813, 0x4100, "Ambient Technologies Inc","Ambient MD8820","Intel HaM V.92 Modem" },
-{0x1814, 0x0001, "Ralink Technology, Corp.","...B742000","...I don't know" },
-{0x1814, 0x0101, "Ralink Technology, Corp.","2460  802.11b","RT2460  802.11b Baseband/MAC integrated chip" },
-{0x1814, 0x0201, "Ralink Technology, Corp.","PCI\\VEN_1814&DEV_3298&SUBSYS_1451033","Ralink Chipset 802.11b/g WLAN Card" },
-{0x1814, 0x0301, "Ralink Technology, Corp.","RT2561","Ralink RT2561 Wireless-G PCI" },
-{0x1814, 0x0302, "Ralink Technology, Corp.","RT2525 2.4GHz transceiver + RT2560 MAC/BBP","wireless p/n same Chipset in D-Link DWL-G510" },
-{0x1814, 0x0401, "Ralink Technology, Corp.","RT 2661","Ralink MIMO RT 2661 Wireless 54 Mbps" },
-{0x1814, 0x0601, "Ralink Technology, Corp.","RT2860T","b/g/n  Wlan" },
-{0x1814, 0x0701, "Ralink Technology, Corp.","RT2860T","802.11 bgn" },
-{0x1814, 0x0781, "Ralink Technology, Corp.","RT2790T/RT2860/RT2890/RT2700E","Wireless 802.11 bgn PCI-e" },
-{0x1814, 0x1418, "Ralink Technology, Corp.","0x14FI","802.11b/g Wireless LAN" },
-{0x1814, 0x14F1, "Ralink Technology, Corp.","0x1814","PCI\\VEN_168C&DEV_001A&SUBSYS_04181468&REV_01\\4&FCF0450&0&10A4" },
-{0x1814, 0x201, "Ralink Technology, Corp.","25601814&REV_01","Ralink RT2500 Wireless Lan Card" },
-{0x1814, 0x3060, "Ralink Technology, Corp.","RT3060","Ralink corp. RT3060 Wireless 802.11n PCI adapter" },
-{0x1814, 0x3090, "Ralink Technology, Corp.","Ralink RT3090","Ralink RT3090 Wireless Lan Card with Bluetooth" },
-{0x1814, 0x3290, "Ralink Technology, Corp.","1010","802.11n   Bluetooth 4.0" },
-{0x1814, 0x3298, "Ralink Technology, Corp.","-3290","Ralink Bluetooth" },
-{0x1814, 0x3592, "Ralink Technology, Corp.","RT3592","Wireless LAN a/b/g/n plus Bluetooth 3.0 combo" },
-{0x1814, 0x5360, "Ralink Technology, Corp.","RT5360 ","http://www.wikidevi.com/wiki/D-Link_DWA-525_rev_A2" },
-{0x1814, 0x5390, "Ralink Technology, Corp.","ASUS X55VD VEN_1814&DEV_5390&SUBSYS_E054105B&REV00","802.11n Wireless Lan Card - Asus X55V - Win 7 64bit - Foxconn Wireless" },
-{0x1814, 0x539B, "Ralink Technology, Corp.","RT5390R","Ralink RT5390R 802.11b/g/n WiFi" },
-{0x1814, 0x9876, "Ralink Technology, Corp.","b8341462","Edimax 54 MBit WLan 802.11g rt 2500" },
-{0x186C, 0x1014, "Humusoft S.R.O","AR5BXB6","Atheros 802.11abg" },
-{0x1888, 0x0301, "Varisys Limited","","" },
-{0x1888, 0x0601, "Varisys Limited","","" },
-{0x1888, 0x0710, "Varisys Limited","","" },
-{0x1888, 0x0720, "Varisys Limited","","" },
-{0x1888, 0x2503, "Varisys Limited","Bt881","Video Capture (10 bit High qualtiy cap)" },
-{0x1888, 0x2504, "Varisys Limited","Bt878","Video Capture" },
-{0x1888, 0x3503, "Varisys Limited","nVidia NV28","VGA Geforce4 MX440" },
-{0x1888, 0x3505, "Varisys Limited","nVidia NV28","VGA Geforce4 Ti4200" },
-{0x18C9, 0x1011, "ARVOO Engineering BV","Leonardo CL","Video processor" },
-{0x18C9, 0x1012, "ARVOO Engineering BV","Leonardo CL-P","Video processor" },
-{0x18C9, 0x1013, "ARVOO Engineering BV","Leonardo CL-DB","Video processor" },
-{0x18C9, 0x1014, "ARVOO Engineering BV","Leonardo CL-P-DB","Video processor" },
-{0x18C9, 0x1015, "ARVOO Engineering BV","Leonardo CL-DVR","Video processor" },
-{0x18C9, 0x1016, "ARVOO Engineering BV","Leonardo CL-DVR-DB","Video processor" },
-{0x18C9, 0x2011, "ARVOO Engineering BV","Picasso 2SQ","Framegrabber" },
-{0x18C9, 0x2012, "ARVOO Engineering BV","Picasso 3C/3Cpro","Framegrabber" },
-{0x18C9, 0x2013, "ARVOO Engineering BV","Picasso LS","Framegrabber" },
-{0x18C9, 0x2014, "ARVOO Engineering BV","Picasso CL","Framegrabber" },
-{0x18C9, 0x2015, "ARVOO Engineering BV","Picasso FI","Framegrabber" },
-{0x18C9, 0x2016, "ARVOO Engineering BV","Picasso SDI","Framegrabber" },
-{0x18C9, 0x2017, "ARVOO Engineering BV","Picasso DUO","Framegrabber" },
-{0x18C9, 0x2021, "ARVOO Engineering BV","Colory","Framegrabber" },
-{0x18C9, 0x3011, "ARVOO Engineering BV","Valentino","Video Output Board" },
-{0x18CA, 0x0020, "XGI Technology Inc","Volari Z9s","Volari Z series (Select GPU Graphic Drivers" },
-{0x18CA, 0x0040, "XGI Technology Inc","Silicon Intgrated System","Volari Family Z Series" },
-{0x18F7, 0x0001, "Commtech, Inc.","ESCC-PCI-335","Fastcom:ESCC-PCI-335 Syncronous RS422/485 serial communication adapter" },
-{0x18F7, 0x0002, "Commtech, Inc.","422/4-PCI-335","Fastcom:422/4-PCI-335 Asyncronous RS422/485 serial adapter" },
-{0x18F7, 0x0004, "Commtech, Inc.","422/2-PCI-335","Fastcom:422/2-PCI-335 Asyncronous RS422/485 serial adapter" },
-{0x18F7, 0x000a, "Commtech, Inc.","232/4-PCI-335","Fastcom:232/4-PCI-335 Asyncronous RS232 serial adapter" },
-{0x1904, 0x2031, "Ritmo","n /a","silan sc92031 Network adapter" },
-{0x1904, 0x8139, "Ritmo","8129","Realtek RTL8139 PCI Fast Ethernet Adapter" },
-{0x1904, 0x8139, "Ritmo","8139","Realtek RTL8139 PCI Fast Ethernet Adapter" },
-{0x1910, 0x0001, "Seaway Networks","SW5000-NCA","Seaway Network Content Accelerator" },
-{0x1912, 0x0014, "Renesas Electronics","YET-D720201-0014","usb3.0 renesas" },
-{0x1912, 0x0015, "Renesas Electronics"," upd720202"," nec" },
-{0x1969, 0x1026, "Atheros Communications","AR8121/AR8113 ","PCI-E ETHERNET CONTROLLER " },
-{0x1969, 0x1048, "Atheros Communications","Atheros L1","Gigabit Ethernet 10/100/1000 Base-T Controller" },
-{0x1969, 0x1060, "Atheros Communications","AR8162","PCI-E Fast Ethernet Controller" },
-{0x1969, 0x1062, "Atheros Communications","Atheros L1 ","Gigabit Ethernet 10/100/1000 Base-T Controller" },
-{0x1969, 0x1063, "Atheros Communications","AR8131","Atheros AR8131 PCI-E Gigabit Ethernet Controller" },
-{0x1969, 0x1073, "Atheros Communications","AR8151","Atheros AR8151" },
-{0x1969, 0x1083, "Atheros Communications","78161462","Atheros AR8151 PCI-E Gigabit Ethernet Controller (NDIS 6.20)" },
-{0x1969, 0x1090, "Atheros Communications","AR8162+","Fast Ethernet" },
-{0x1969, 0x1091, "Atheros Communications","AR8161/8165","PCI-E Gigabit Ethernet Controller" },
-{0x1969, 0x10a0, "Atheros Communications","Atheros AR8172/8176/8178","Controller Ethernet Qualcomm Atheros AR8172/8176/8178 PCI-E Fast (NDIS 6.30)" },
-{0x1969, 0x168c, "Atheros Communications","Atheros L1 ","Gigabit Ethernet 10/100/1000 Base-T Controller " },
-{0x1969, 0x1969, "Atheros Communications","Atheros L3","Atheros AR815x/816x Ethernet Controller Driver " },
-{0x1969, 0x2048, "Atheros Communications","Atheros L2","Fast Ethernet 10/100 Base-T Controller" },
-{0x1969, 0x2049, "Atheros Communications","234543","der" },
-{0x1969, 0x2060, "Atheros Communications","fd501179&rev-c1","AR8152 v1.1 Fast Ethernet" },
-{0x1969, 0x2061, "Atheros Communications","1","Ethernet Controller" },
-{0x1969, 0x2062, "Atheros Communications","FB501179","Qualcomm Atheros AR8152/8158" },
-{0x1969, 0x4747, "Atheros Communications","1969","VEN_1969" },
-{0x1969, 0x9876, "Atheros Communications","Atheros L2","Fast Ethernet 10/100 Base-T Controller " },
-{0x1969, 0xE091, "Atheros Communications","Killer E2200","Killer E2200 Network Card" },
-{0x1971, 0x0001, "AGEIA Technologies, Inc.","PCI\\VEN_1971&DEV_0000&SUBSYS_0003105B&REV_00","AGEIA PhysX 100 Series PCI Express Card" },
-{0x1971, 0x1011, "AGEIA Technologies, Inc.","PCI\\\\VEN_1971&DEV_1011&CC_FF00","AGEIA PhysX 100 Series PCI Card" },
-{0x1971, 0x1021, "AGEIA Technologies, Inc.","","AGEIA PhysX 200 Series PCI Express Card" },
-{0x197B, 0x0250, "JMicron Technology Corp.","JMC25","JMC250 PCI Express, Gigabit Ethernet" },
-{0x197B, 0x0256, "JMicron Technology Corp.","JMC2XX","JMC260 PCI Express Fast Ethernet" },
-{0x197B, 0x0260, "JMicron Technology Corp.","ethernet","JMC260 PCI Express Fast Ethernet" },
-{0x197B, 0x0261, "JMicron Technology Corp.","0261","JMB38X MS Host Controller" },
-{0x197B, 0x1234, "JMicron Technology Corp.","12345678","1234567" },
-{0x197B, 0x197b, "JMicron Technology Corp.","JMB38X","JMB38X SD/MMC " },
-{0x197B, 0x2360, "JMicron Technology Corp.","JMicron JMB36X","JMB36X" },
-{0x197B, 0x2361, "JMicron Technology Corp.","JMB363","PCI Express to SATA II and PATA Host Controller" },
-{0x197B, 0x2363, "JMicron Technology Corp.","JMB36X","JMicron JMB362/JMB363 AHCI Controller" },
-{0x197B, 0x2366, "JMicron Technology Corp.","JMB36X","JMicron JMB366 AHCI/IDE Controller" },
-{0x197B, 0x2368, "JMicron Technology Corp.","JMB368","IDE Comtroller" },
-{0x197B, 0x2380, "JMicron Technology Corp.","JMB38X","IEEE 1394 Host Controller" },
-{0x197B, 0x2381, "JMicron Technology Corp.","JMB38X","JMB38X SD Host Controller" },
-{0x197B, 0x2382, "JMicron Technology Corp.","JMB38X","JMB38X SD/MMC Host Controller" },
-{0x197B, 0x2383, "JMicron Technology Corp.","0261","JMB38X MS Host Controller" },
-{0x197B, 0x2384, "JMicron Technology Corp.","JMB38X","JMB38X xD Host Controller" },
-{0x197B, 0x2391, "JMicron Technology Corp.","JMB38X","JMB38X SD/MMC - JMicron PCIe SD Host Controller" },
-{0x197B, 0x2392, "JMicron Technology Corp.","721179"," JMB38X SD/MMC - JMicron PCIe SD Host Controller" },
-{0x197B, 0x2393, "JMicron Technology Corp."," Chip Number: 	JMB38X","Chip Description: 	JMB38X SD/MMC Host Controller" },
-{0x197B, 0x7002, "JMicron Technology Corp.","JMB38Xam5","JMB38X SD/MMC Host Controller" },
-{0x198a, 0x0210, "Nallatech"," ","XMC-210" },
-{0x198a, 0x0220, "Nallatech"," ","XMC-220" },
-{0x198a, 0x0230, "Nallatech"," ","XMC-230" },
-{0x198a, 0x0240, "Nallatech"," ","XMC-240" },
-{0x198a, 0x1180, "Nallatech"," pm 965","PCIe-180" },
-{0x198a, 0x1280, "Nallatech"," ","PCIe-280" },
-{0x198a, 0x1395, "Nallatech","STRATIX V","PCIe-395 standard" },
-{0x198a, 0x198a, "Nallatech","pm 965","PCIe-180" },
-{0x198a, 0x3395, "Nallatech","STRATIX V","PCIe-395 BSP" },
-{0x198a, 0x402F, "Nallatech"," "," BenNUEY PCIX" },
-{0x198a, 0x4030, "Nallatech"," ","H100-PCIX" },
-{0x198a, 0x4031, "Nallatech"," ","BenNUEY PCI-104-V4" },
-{0x198a, 0x4032, "Nallatech"," ","BenONE-PCIe" },
-{0x198a, 0x4033, "Nallatech"," PCI\\VEN_198A&DEV_4033&SUBSYS_00000000&REV_00","BenONE-Xilinx-Kit-ROHS" },
-{0x198a, 0x4034, "Nallatech"," ","BenNUEY PCIX RoHS" },
-{0x19a2, 0x0710, "ServerEngines","","Emulex OneConnect 10Gb NIC (be3) (rev01)" },
-{0x19a2, 0x0712, "ServerEngines","","Emulex OneConnect 10Gb iSCSI Initiator (be3) (rev 01)" },
-{0x19a2, 0x0714, "ServerEngines","Emulex OneConnect 10Gb FCoE","Emulex OneConnect 10Gb FCoE &#1048;&#1085;&#1080;&#1094;&#1080;&#1072;&#1090;&#1086;&#1088; (be3) (&" },
-{0x19AC, 0x0001, "Kasten Chase Applied Research","ACA2400","Crypto Accelerator" },
-{0x19B6, 0x110c, "Mikrotik","AR5413","Atheros chipset for 802.11a/b/g" },
-{0x19E3, 0x5801, "DDRdrive LLC","NA","DDRdrive X1" },
-{0x19E3, 0x5808, "DDRdrive LLC","NA","DDRdrive X8" },
-{0x19E3, 0xDD52, "DDRdrive LLC"," ","DDRdrive X1-30" },
-{0x1B13, 0x0001, "Jaton Corporation USA","GeForce4 MX 440","nVidia Corporation NV17" },
-{0x1B21, 0x0612, "Asustek - ASMedia Technology Inc.","Asmedia 106x SATA Controler","Link Below to Mainboard Driver inside" },
-{0x1B21, 0x1041, "Asustek - ASMedia Technology Inc.","SUBSYS_2104174C","USB 3.0 Host Controller Driver for Windows 7" },
-{0x1B21, 0x1042, "Asustek - ASMedia Technology Inc.","pci\\ven_14f1&dev_2f50&subsys_205f14f1&rev_01\\4&cf8","Asmedia ASM104x USB 3.0 Host Controller" },
-{0x1B6F, 0x7023, "Etron","DEV_7023&REV_010","Etron USB 3.0 Extensible Host Controller" },
-{0x1B73, 0x1000, "Fresco Logic Inc.","1","PCI\\VEN_1000&DEV_0020&SUBSYS_10301000&REV_01PCI\\VEN" },
-{0x1B73, 0x1009, "Fresco Logic Inc.","Unknown","USB3.0 host controller" },
-{0x1B73, 0x1100, "Fresco Logic Inc.","n/a","USB 3.0 eXtensibile Host controller" },
-{0x1c39, 0x0300, "Thomson Video Networks","PEGAVIO","Pegasus Board PCI-e interface" },
-{0x1DE1, 0x0045, "Tekram","RaidCore5000 Series","Tekram SAS860 Embedded 8xSAS/SATAII RAID" },
-{0x1DE1, 0x0058, "Tekram","RC5000Series","Tekram Elrond 8xSAS/SATAII RAID" },
-{0x1DE1, 0x0391, "Tekram","TRM-S1040","SCSI ASIC" },
-{0x1DE1, 0x2020, "Tekram","DC-390","SCSI Controller" },
-{0x1DE1, 0x690C, "Tekram","DC-690C","IDE Cache Controller" },
-{0x1DE1, 0xDC29, "Tekram","DC290M","Bus Master IDE PCI 2 controllers" },
-{0x2001, 0x3C19, "Temporal Research Ltd","Ralink RT5370","USB <=> Wireless N 150 Adapter" },
-{0x2001, 0xF103, "Temporal Research Ltd",".7D01",".driver" },
-{0x2646, 0x0001, "Kingston Technology Co.","12333","22323" },
-{0x2646, 0x2646, "Kingston Technology Co.","6.06324","22323" },
-{0x3388, 0x0020, "Hint Corp.","HB2/HB6","Universal PCI-PCI Bridge (transparent mode)" },
-{0x3388, 0x0021, "Hint Corp.","HB1 pci-pci 0304","ZS095A0" },
-{0x3388, 0x0022, "Hint Corp.","HB1  0304","PCI-PCI Bridge" },
-{0x3388, 0x0026, "Hint Corp.","PCI6154BB","Universal PCI-PCI Bridge (transparent mode)" },
-{0x3388, 0x0028, "Hint Corp.","HB8","Dual Mode PCI-X-to-PCI-X Bridge (transparent mode)" },
-{0x3388, 0x0029, "Hint Corp.","HB8","Dual Mode PCI-X-to-PCI-X Bridge (non-transparent mode)" },
-{0x3388, 0x0030, "Hint Corp.","HB7","Transparent PCI-X-to-PCI-X Bridge" },
-{0x3388, 0x0031, "Hint Corp.","PCI 6156","Synchronous 32-Bit, 33 MHz PCI-to-PCI Bridge for Video Capture Applications" },
-{0x3388, 0x8011, "Hint Corp.","II","CPU to PCI Bridge" },
-{0x3388, 0x8012, "Hint Corp.","cmi 8330","PCI to ISA Bridge" },
-{0x3388, 0x8013, "Hint Corp.","PLX Registration Record Management","EIDE Controller" },
-{0x3D3D, 0x0001, "3Dlabs, Inc. Ltd","GLint 300SX","3D Accelerator" },
-{0x3D3D, 0x0002, "3Dlabs, Inc. Ltd","GLint 500TX","Sapphire 3D Accelerator" },
-{0x3D3D, 0x0003, "3Dlabs, Inc. Ltd","GLint","Delta Geometry processor" },
-{0x3D3D, 0x0004, "3Dlabs, Inc. Ltd","3C0SX","2D+3D Accelerator" },
-{0x3D3D, 0x0005, "3Dlabs, Inc. Ltd","Permedia","2D+3D Accelerator" },
-{0x3D3D, 0x0006, "3Dlabs, Inc. Ltd","GLint MX","3D Accelerator" },
-{0x3D3D, 0x0007, "3Dlabs, Inc. Ltd","3D Extreme","Permedia II 2D+3D Accelerator" },
-{0x3D3D, 0x0008, "3Dlabs, Inc. Ltd","GLint Gamma G1","" },
-{0x3D3D, 0x0009, "3Dlabs, Inc. Ltd","Permedia2v","2d+3d chipset, integrated ramdac" },
-{0x3D3D, 0x000A, "3Dlabs, Inc. Ltd","8086","Driver Ethernet Pci Ven 1969" },
-{0x3D3D, 0x000C, "3Dlabs, Inc. Ltd","Permedia 3","video card" },
-{0x3D3D, 0x000D, "3Dlabs, Inc. Ltd","GLINT R4","3D Accelerator" },
-{0x3D3D, 0x000E, "3Dlabs, Inc. Ltd","GLINT Gamma G2","" },
-{0x3D3D, 0x0020, "3Dlabs, Inc. Ltd","0x0024","3Dlabs Wildcat VP 880 Pro" },
-{0x3D3D, 0x0030, "3Dlabs, Inc. Ltd","0x030000","3Dlabs Wildcat Realizm 800" },
-{0x3D3D, 0x0100, "3Dlabs, Inc. Ltd","Permedia II","2D+3D Accelerator" },
-{0x3D3D, 0x1004, "3Dlabs, Inc. Ltd","Permedia","3D+3D Accelerator" },
-{0x3D3D, 0x3D04, "3Dlabs, Inc. Ltd","Permedia","2D+3D Accelerator" },
-{0x3D3D, 0xFFFF, "3Dlabs, Inc. Ltd","GLint VGA","" },
-{0x4005, 0x0300, "Avance Logic Inc.","3220","PCI Audio Device" },
-{0x4005, 0x0308, "Avance Logic Inc.","3220","PCI Audio Device + modem" },
-{0x4005, 0x0309, "Avance Logic Inc.","ALS300 ","PCI Input Controller" },
-{0x4005, 0x1064, "Avance Logic Inc.","ALG2064","GUI Accelerator" },
-{0x4005, 0x2064, "Avance Logic Inc.","<DELETE>","GUI Accelerator" },
-{0x4005, 0x2128, "Avance Logic Inc.","ALG2364A","GUI Accelerator" },
-{0x4005, 0x2301, "Avance Logic Inc.","ALG2301","GUI Accelerator" },
-{0x4005, 0x2302, "Avance Logic Inc.","ALG2302","GUI Accelerator" },
-{0x4005, 0x2303, "Avance Logic Inc.","AVG2302","GUI Accelerator" },
-{0x4005, 0x2364, "Avance Logic Inc.","ALG2364","GUI Accelerator" },
-{0x4005, 0x2464, "Avance Logic Inc.","ALG2464","GUI Accelerator" },
-{0x4005, 0x2501, "Avance Logic Inc.","ALG2564A/25128A","GUI Accelerator" },
-{0x4005, 0x4000, "Avance Logic Inc.","ALS4000","Audio Chipset" },
-{0x4144, 0x0040, "Alpha Data","ADM-XRC","Virtex-E Bridge" },
-{0x4144, 0x0041, "Alpha Data","ADM-XRC-II Lite","Virtex-II Bridge" },
-{0x4144, 0x0042, "Alpha Data","ADM-XRC-II","Virtex-II Bridge" },
-{0x4144, 0x0043, "Alpha Data","ADM-XPL","Virtex-II Pro Bridge" },
-{0x4144, 0x0044, "Alpha Data","ADM-XP","Virtex-II Pro PCI/PCI-X Bridge" },
-{0x4144, 0x0045, "Alpha Data","ADP-WRC-II","Virtex-II Bridge" },
-{0x4144, 0x0046, "Alpha Data","ADP-DRC-II","Virtex-II Bridge" },
-{0x4144, 0x0049, "Alpha Data","ADP-XPI","Virtex-II Pro PCI" },
-{0x4144, 0x004A, "Alpha Data","ADP-XPI (PCI-X)","Virtex-II Pro PCI-X Bridge" },
-{0x4144, 0x004F, "Alpha Data","ADM-XRC-4FX","Virtex-II Pro PCI-X Bridge" },
-{0x4144, 0x0050, "Alpha Data","ADM-XRC-5LX","Virtex-4LX Bridge" },
-{0x4144, 0x0051, "Alpha Data","ADM-XRC-5T1","ADM-XRC-5T1" },
-{0x4144, 0x0052, "Alpha Data","ADM-XRC-5T2","Xilinx Virtex 5 PMC" },
-{0x4144, 0x0056, "Alpha Data","ADM-AMC-5A2","Virtex 5 AMC FPGA board" },
-{0x4144, 0x0057, "Alpha Data","ADM-XRC-5TZ","Xilinx Virtex 5 FPGA PMC " },
-{0x4144, 0x0058, "Alpha Data","ADC-VXS","VXS FPGA and PMC Carrier Board" },
-{0x4144, 0x005B, "Alpha Data","ADM-XRC-5T2-ADV","ADM-XRC-5T2 with JPEG 2000 devices" },
-{0x4144, 0x005C, "Alpha Data","ADM-XRC-5T-DA1","FPGA PMC with Analog I/O Interface" },
-{0x4144, 0x005F, "Alpha Data","ADM-XRC-5T2-ADV6","As per XRC-5T2 but with 6 JPEG2000 devices" },
-{0x4144, 0x0300, "Alpha Data","ADM-XRC-6T1","Xilinx Virtex 6 FPGA XMC" },
-{0x4144, 0x0301, "Alpha Data","ADM-XRC-6TGE","Xilinx Virtex 6 FPGA XMC" },
-{0x4144, 0x0303, "Alpha Data","ADPe-XRC-6T-L","Full lenght PCI Express Xilinx Virtex-6 FPGA platform" },
-{0x4144, 0x0305, "Alpha Data","ADPe-XRC-6T","Full length PC Card Xilinx Virtex-6 FPGA platform" },
-{0x416C, 0x0100, "Aladdin Knowledge Systems","AlladinCARD","Puerto paralelo PCI" },
-{0x416C, 0x0200, "Aladdin Knowledge Systems","CPC","" },
-{0x4348, 0x1453, "wch.cn","202204073","WCH353L" },
-{0x4348, 0x3253, "wch.cn","32534348","SIE9835 PCI=>DUAL SERIAL" },
-{0x4348, 0x5053, "wch.cn","4348","4980" },
-{0x4348, 0x7053, "wch.cn","35255","PCI Serial Port" },
-{0x4348, 0x7173, "wch.cn","ch350L"," CH35X" },
-{0x4C53, 0x0000, "SBS-OR Industrial Computers","PLUSTEST","Diagnostics Device" },
-{0x4C53, 0x0001, "SBS-OR Industrial Computers","pustest","Diagnostics Device" },
-{0x4D51, 0x0200, "Mediaq Inc.","MQ-200","" },
-{0x4E8, 0x618c, "Samsung Windows Portable Devices","rev_0400","usb lan adapter4" },
-{0x4E8, 0x618d, "Samsung Windows Portable Devices","rev_0400","usb lan adapter4" },
-{0x5053, 0x2010, "TBS/Voyetra Technologies","14441","Daytona Audio Adapter" },
-{0x5136, 0x4678, "S S Technologies","12363383","S S Technologies" },
-{0x5143, 0x9204, "Qualcomm Inc. USA","Unknown","WAN Card Lenovo Notebook" },
-{0x5333, 0x0551, "S3 Graphics Co., Ltd","86C551","Plato/PX" },
-{0x5333, 0x5333, "S3 Graphics Co., Ltd","S3 86c765","via" },
-{0x5333, 0x5631, "S3 Graphics Co., Ltd","86C325","Virge 3D " },
-{0x5333, 0x8800, "S3 Graphics Co., Ltd","86C866","Vision 866 GUI Accelerator" },
-{0x5333, 0x8801, "S3 Graphics Co., Ltd","86C964","Vision 964 GUI Accelerator" },
-{0x5333, 0x8810, "S3 Graphics Co., Ltd","86C732-P","S3 TRIO32  IACB2  86C732-P" },
-{0x5333, 0x8811, "S3 Graphics Co., Ltd","8622mcq04","Trio 64/64V" },
-{0x5333, 0x8812, "S3 Graphics Co., Ltd","86CM65?","Aurora 64V+" },
-{0x5333, 0x8813, "S3 Graphics Co., Ltd","86C764","Trio 32/64 GUI Accelerator v3" },
-{0x5333, 0x8814, "S3 Graphics Co., Ltd","86C767","Trio 64UV+" },
-{0x5333, 0x8815, "S3 Graphics Co., Ltd","86CM66","Aurora128" },
-{0x5333, 0x883D, "S3 Graphics Co., Ltd","86C988","ViRGE/VX 3D GUI Accelerator" },
-{0x5333, 0x8870, "S3 Graphics Co., Ltd","Fire GL","" },
-{0x5333, 0x8880, "S3 Graphics Co., Ltd","86C868","Vision 868 GUI Accelerator VRAM rev. 0" },
-{0x5333, 0x8881, "S3 Graphics Co., Ltd","86C868","Vision 868 GUI Accelerator VRAM rev. 1" },
-{0x5333, 0x8882, "S3 Graphics Co., Ltd","86C868","Vision 868 GUI Accelerator VRAM rev. 2" },
-{0x5333, 0x8883, "S3 Graphics Co., Ltd","86C868","Vision 868 GUI Accelerator VRAM rev. 3" },
-{0x5333, 0x88B0, "S3 Graphics Co., Ltd","86C928","Vision 928 GUI Accelerator VRAM rev. 0" },
-{0x5333, 0x88B1, "S3 Graphics Co., Ltd","86C928","Vision 928 GUI Accelerator VRAM rev. 1" },
-{0x5333, 0x88B2, "S3 Graphics Co., Ltd","86C928","Vision 928 GUI Accelerator VRAM rev. 2" },
-{0x5333, 0x88B3, "S3 Graphics Co., Ltd","86C928","Vision 928 GUI Accelerator VRAM rev. 3" },
-{0x5333, 0x88C0, "S3 Graphics Co., Ltd","86C864","Vision 864 GUI Accelerator DRAM rev. 0" },
-{0x5333, 0x88C1, "S3 Graphics Co., Ltd","86C864","Vision 864 GUI Accelerator DRAM rev. 1" },
-{0x5333, 0x88C2, "S3 Graphics Co., Ltd","86C864","Vision 864 GUI Accelerator DRAM rev. 2" },
-{0x5333, 0x88C3, "S3 Graphics Co., Ltd","86C864","Vision 864 GUI Accelerator DRAM rev. 3" },
-{0x5333, 0x88D0, "S3 Graphics Co., Ltd","86C964","Vision 964 GUI Accelerator VRAM rev. 0" },
-{0x5333, 0x88D1, "S3 Graphics Co., Ltd","86C964","Vision 964-P GUI Accelerator VRAM rev. 1" },
-{0x5333, 0x88D2, "S3 Graphics Co., Ltd","86C964","Vision 964-P GUI Accelerator DRAM rev 2" },
-{0x5333, 0x88D3, "S3 Graphics Co., Ltd","86C964","Vision 964-P GUI Accelerator VRAM rev. 3" },
-{0x5333, 0x88F0, "S3 Graphics Co., Ltd","86C968","Vision 968 GUI Accelerator VRAM rev. 0" },
-{0x5333, 0x88F1, "S3 Graphics Co., Ltd","86C968","Vision 968 GUI Accelerator VRAM rev. 1" },
-{0x5333, 0x88F2, "S3 Graphics Co., Ltd","86C968","Vision 968 GUI Accelerator VRAM rev. 2" },
-{0x5333, 0x88F3, "S3 Graphics Co., Ltd","86C968","Vision 968 GUI Accelerator VRAM rev. 3" },
-{0x5333, 0x8900, "S3 Graphics Co., Ltd","86C775","Trio64V2/DX" },
-{0x5333, 0x8901, "S3 Graphics Co., Ltd","pci\\ven_5333dev_8C2E&SUBSYS_00011179&REV_05\\4&74C6","S3 trio64uv+ for windows 7" },
-{0x5333, 0x8902, "S3 Graphics Co., Ltd","86C551","SMA Family" },
-{0x5333, 0x8903, "S3 Graphics Co., Ltd","","TrioV Family" },
-{0x5333, 0x8904, "S3 Graphics Co., Ltd","86C365/366","Trio3D QFP/BGA" },
-{0x5333, 0x8905, "S3 Graphics Co., Ltd","86c765","86C765 Trio64V+ compatible" },
-{0x5333, 0x8906, "S3 Graphics Co., Ltd","86c765","86C765 Trio64V+ compatible" },
-{0x5333, 0x8907, "S3 Graphics Co., Ltd","86c765","86C765 Trio64V+ compatible" },
-{0x5333, 0x8908, "S3 Graphics Co., Ltd","9711 MCN74","86C765 Trio64V+ compatible" },
-{0x5333, 0x8909, "S3 Graphics Co., Ltd","7699688","86C765 Trio64V+ compatible" },
-{0x5333, 0x890A, "S3 Graphics Co., Ltd","0x00091011","86C765 Trio64V+ compatible" },
-{0x5333, 0x890B, "S3 Graphics Co., Ltd","9726 c19394.00","86C765 Trio64V+ compatible" },
-{0x5333, 0x890C, "S3 Graphics Co., Ltd","86C765","86C765 Trio64V+ compatible" },
-{0x5333, 0x890D, "S3 Graphics Co., Ltd","86C765 Trio64V+ compatible","86C765 Trio64V+ compatible" },
-{0x5333, 0x890E, "S3 Graphics Co., Ltd","9711 MCN74","86C765 Trio64V+ compatible" },
-{0x5333, 0x890F, "S3 Graphics Co., Ltd","86c765","86C765 Trio64V+ compatible" },
-{0x5333, 0x8A01, "S3 Graphics Co., Ltd","86C375/86C385","ViRGE /DX & /GX" },
-{0x5333, 0x8A10, "S3 Graphics Co., Ltd","86C357","ViRGE /GX2" },
-{0x5333, 0x8A11, "S3 Graphics Co., Ltd","86C359","ViRGE /GX2+ Macrovision" },
-{0x5333, 0x8A12, "S3 Graphics Co., Ltd","86C359","ViRGE /GX2+" },
-{0x5333, 0x8A13, "S3 Graphics Co., Ltd","86C368","Trio3D2x & Trio3D2x+ AGP / Trio3D2x & Trio3D2x+ 8MB" },
-{0x5333, 0x8A20, "S3 Graphics Co., Ltd","86C391","S3savage3D" },
-{0x5333, 0x8A21, "S3 Graphics Co., Ltd","86C390","Savage3D/MV" },
-{0x5333, 0x8A22, "S3 Graphics Co., Ltd","86c398","Savage 4" },
-{0x5333, 0x8A23, "S3 Graphics Co., Ltd","86C394-397","Savage 4" },
-{0x5333, 0x8A25, "S3 Graphics Co., Ltd","86C370","Savage4" },
-{0x5333, 0x8A26, "S3 Graphics Co., Ltd","86C395B","ProSavage" },
-{0x5333, 0x8C00, "S3 Graphics Co., Ltd","85C260","ViRGE/M3 (ViRGE/MX)" },
-{0x5333, 0x8C01, "S3 Graphics Co., Ltd","86C260","ViRGE/M5 (ViRGE/MX)" },
-{0x5333, 0x8C02, "S3 Graphics Co., Ltd","86C240","ViRGE/MXC" },
-{0x5333, 0x8C03, "S3 Graphics Co., Ltd","86C280","ViRGE /MX+mv" },
-{0x5333, 0x8C10, "S3 Graphics Co., Ltd","86C270/274/290/294","Savage MX/IX/MX+MV/IX+MV" },
-{0x5333, 0x8C12, "S3 Graphics Co., Ltd","86C270/274/290/294","Savage MX/IX/MX+MV/IX+MV" },
-{0x5333, 0x8C13, "S3 Graphics Co., Ltd","82C294","SAVAGE IX" },
-{0x5333, 0x8C22, "S3 Graphics Co., Ltd","86C508","SuperSavage 128/MX" },
-{0x5333, 0x8C2A, "S3 Graphics Co., Ltd","86C544","SuperSavage 128/IX" },
-{0x5333, 0x8C2B, "S3 Graphics Co., Ltd","86C553","SuperSavage 128/IX DDR" },
-{0x5333, 0x8C2C, "S3 Graphics Co., Ltd","86C564","SuperSavage/IX" },
-{0x5333, 0x8C2D, "S3 Graphics Co., Ltd","86C573","SuperSavage/IX DDR" },
-{0x5333, 0x8C2E, "S3 Graphics Co., Ltd","86C584","SuperSavage/IXC SDRAM" },
-{0x5333, 0x8C2F, "S3 Graphics Co., Ltd","86C594","SuperSavage/IXC DDR" },
-{0x5333, 0x8D01, "S3 Graphics Co., Ltd","86C380/381","Twister/Twister T" },
-{0x5333, 0x8D02, "S3 Graphics Co., Ltd","86c387","Twister K" },
-{0x5333, 0x8D04, "S3 Graphics Co., Ltd","86C410","ProSavage DDR P4X333" },
-{0x5333, 0x8E00, "S3 Graphics Co., Ltd","86C777/787","DeltaChrome S8/F1" },
-{0x5333, 0x8E01, "S3 Graphics Co., Ltd","86C732","DeltaChromeX9m" },
-{0x5333, 0x9102, "S3 Graphics Co., Ltd","86c410","Inno Savage 2000" },
-{0x5333, 0x9876, "S3 Graphics Co., Ltd","86C390","Savage3D/MV" },
-{0x5333, 0xCA00, "S3 Graphics Co., Ltd","86C617","SonicVibes PCI Audio Accelerator" },
-{0x544C, 0x0350, "Teralogic Inc","00212673158479","IAM" },
-{0x5555, 0x0003, "Genroco Inc.","VPI General Digital Video Component","Digital Video OEM computer module" },
-{0x5853, 0x0001, "Citrix Systems, Inc.","n/a","Citrix XenServer PV SCSI Host Adapter" },
-{0x5853, 0x0002, "Citrix Systems, Inc.","n/a","Citrix PV Bus Device" },
-{0x5853, 0xC000, "Citrix Systems, Inc.","N/A","XenServer Device of Windows Update" },
-{0x6666, 0x0001, "Decision Computer International Co.","815","PCCOM4" },
-{0x6666, 0x0002, "Decision Computer International Co.","","PCCOM8" },
-{0x7d1, 0x3304, "D-Link Corporation","graphic card","802.11N usb wifi device" },
-{0x7d1, 0x3c03, "D-Link Corporation","DWL-G122 Wifi PCI","Same chipset of RALINK  RT2500" },
-{0x7d1, 0x3C07, "D-Link Corporation","D-Link Wireless G DWA-110 USB Adapter","PCI\\VEN_1799&DEV_700F&SUBSYS_700F1799&REV_20\\3&61AAA01&0&48" },
-{0x8080, 0x1040, "Xirlink, Inc","VIA 82C259 rev 0","PCI\\VEN_8086&DEV_0084&SUBSYS_13158086&REV_00" },
-{0x8086 ,0x27B8, "Intel Corporation","82801GB/GR","Intel(R) 82801GB/GR (ICH7 Family) LPC Interface Controller" },
-{0x8086, 0x0004, "Intel Corporation","0x05971028","IUSB3\\ROOT" },
-{0x8086, 0x0008, "Intel Corporation","","Extended Express System Support Ctrlr" },
-{0x8086, 0x0011, "Intel Corporation","0x108D","Ethernet Controller" },
-{0x8086, 0x0042, "Intel Corporation","Intel graphics","Intel Q57/H55 Clarkdale (Onboard on D2912-A1x)" },
-{0x8086, 0x0044, "Intel Corporation","0044","Intel(R) Processor DRAM Controller" },
-{0x8086, 0x0046, "Intel Corporation","Intel(R) HD Graphics (Core i3)","Intel(R) HD Graphics" },
-{0x8086, 0x0054, "Intel Corporation","not known","Audio" },
-{0x8086, 0x0082, "Intel Corporation","6205","Centrino Advanced-N 6205 " },
-{0x8086, 0x0083, "Intel Corporation","Mobile Intel® 5 Series Chipset","Intel Centrino Wireless-N 1000" },
-{0x8086, 0x0084, "Intel Corporation","Intel PROSet WiFi 1000","Intel Wireless Link WiFi 1000, download -> http://downloadmirror.intel.com/20791/eng/Wireless_14.3.0" },
-{0x8086, 0x0085, "Intel Corporation","0x0280","Intel Centrino(R) Advanced-N 6205" },
-{0x8086, 0x0087, "Intel Corporation","1306","00E1" },
-{0x8086, 0x008A, "Intel Corporation","???","Intel Centrino Wireless-N1030" },
-{0x8086, 0x008B, "Intel Corporation","Intel Wireless-N 1030","Intel(R) Centrino(R) Wireless-N 1030 " },
-{0x8086, 0x0091, "Intel Corporation","622ANHW","Intel® Centrino® Advanced-N 6230" },
-{0x8086, 0x0100, "Intel Corporation","0100","2nd Generation Intel(R) Core(TM) Processor Family DRAM Controller" },
-{0x8086, 0x0102, "Intel Corporation","0001","Intel HD Graphics 3000" },
-{0x8086, 0x0104, "Intel Corporation","2nd Gen Intel(R) Core(TM) Processor Family","DRAM Controller (Host Bus Controller)" },
-{0x8086, 0x0106, "Intel Corporation","HD Graphics 3000/2000","asus x501a" },
-{0x8086, 0x010A, "Intel Corporation","010A","Lenovo TS130 Intel Video Adapter HD" },
-{0x8086, 0x0111, "Intel Corporation","82915","Intel Graphics Conroller" },
-{0x8086, 0x0116, "Intel Corporation","intel core i3","Intel HD Graphics 3000" },
-{0x8086, 0x0123, "Intel Corporation","0300","hardwareids" },
-{0x8086, 0x0152, "Intel Corporation","Intel HD Graphics 2500","3rd Generation Intel Core Processors with Intel HD Graphics 2500" },
-{0x8086, 0x0153, "Intel Corporation","Intel® Dynamic Platform and Thermal Framework Driv","Use the Link, choose Win7 64Bit -> Others -> Intel DPTF Driver -> Global. Then download, install and" },
-{0x8086, 0x0154, "Intel Corporation","0x01548086"," 3rd Gen Core processor DRAM Controller (rev 09)" },
-{0x8086, 0x0162, "Intel Corporation","Core I5, Core I7, Ivy Bridge","Graphics embedded" },
-{0x8086, 0x0166, "Intel Corporation","I3","Intel(R) HD Graphics 4000" },
-{0x8086, 0x0189, "Intel Corporation","Intel Centrino Wireless-N 1030 Bluetooth Adapter","Intel Centrino Wireless Bluetooth 3.0 + High Speed Adapter" },
-{0x8086, 0x27AE, "Intel Corporation","82945GM","Mobile Intel(R) 945 Express Chipset Family" },
-{0x8086, 0x27D8, "Intel Corporation","293esd","High Definition Audio Controller" },
-{0x8086, 0x283E, "Intel Corporation","AA01211025","Intel(R) ICH8 Family SMBus Controller" },
-{0x8086, 0x0308, "Intel Corporation","3220","PCI Audio Device + modem" },
-{0x8086, 0x0309, "Intel Corporation","80303","I/O Processor PCI-to-PCI Bridge Unit" },
-{0x8086, 0x030D, "Intel Corporation","80312","I/O Companion Unit PCI-to-PCI Bridge" },
-{0x8086, 0x0318, "Intel Corporation","80219","General Purpose PCI Processor Address Translation Unit" },
-{0x8086, 0x0319, "Intel Corporation","80219","General Purpose PCI Processor Address Translation Unit" },
-{0x8086, 0x0326, "Intel Corporation","670xPXH","I/OxAPIC Interrupt Controller" },
-{0x8086, 0x0327, "Intel Corporation","6700PXH","I/OxAPIC Interrupt Controller B" },
-{0x8086, 0x0329, "Intel Corporation","6700PXH","PCI Express-to-PCI Express Bridge A" },
-{0x8086, 0x032A, "Intel Corporation","6700PXH","PCI Express-to-PCI Express Bridge B" },
-{0x8086, 0x032C, "Intel Corporation","6702PXH","PCI Express-to-PCI Express Bridge" },
-{0x8086, 0x0330, "Intel Corporation","80332","A-Segment Bridge" },
-{0x8086, 0x0331, "Intel Corporation","80332","A-Segment IOAPIC" },
-{0x8086, 0x0332, "Intel Corporation","80332","B-Segment Bridge" },
-{0x8086, 0x0333, "Intel Corporation","80332","B-Segment IOAPIC" },
-{0x8086, 0x0334, "Intel Corporation","80332","Address Translation Unit" },
-{0x8086, 0x0335, "Intel Corporation","80331","PCI-X Bridge" },
-{0x8086, 0x0336, "Intel Corporation","80331","Address Translation Unit (ATU)" },
-{0x8086, 0x0340, "Intel Corporation","41210","Serial to Parallel PCI Bridge A" },
-{0x8086, 0x0341, "Intel Corporation","41210","Serial to Parallel PCI Bridge B" },
-{0x8086, 0x0370, "Intel Corporation","80333","Segment-A PCI Express-to-PCI Express Bridge" },
-{0x8086, 0x0371, "Intel Corporation","80333","A-Bus IOAPIC" },
-{0x8086, 0x0372, "Intel Corporation","0893","network controller" },
-{0x8086, 0x0373, "Intel Corporation","80333","B-Bus IOAPIC" },
-{0x8086, 0x0374, "Intel Corporation","80333","Address Translation Unit" },
-{0x8086, 0x0401, "Intel Corporation","266E","P040100" },
-{0x8086, 0x0402, "Intel Corporation","ACPI x86-based PC","HD Graphics 4200" },
-{0x8086, 0x0412, "Intel Corporation","Intel HD Graphics 4600","ven_8086&dev_0412" },
-{0x8086, 0x0416, "Intel Corporation","SUBSYS_197A103C","Intel(R) HD Graphics 4600" },
-{0x8086, 0x0482, "Intel Corporation","82375MB","PCI\\VEN_8086&DEV_3B64&SUBSYS_20391B0A&REV_06" },
-{0x8086, 0x0483, "Intel Corporation","82424TX/ZX","CPU (i486) Bridge (Saturn)" },
-{0x8086, 0x0484, "Intel Corporation","82378ZB/IB","SIO ISA Bridge" },
-{0x8086, 0x0486, "Intel Corporation","PCI\\VEN_8086&DEV_1C22&SUBSYS_2AC2103C&REV_04","HP Pro 3400  XPx32/7x32 drivers" },
-{0x8086, 0x04A3, "Intel Corporation","82434bX/zX","Mercury/Neptune Cache/DRAM Controller" },
-{0x8086, 0x0500, "Intel Corporation","E8870","Processor Bus Controller" },
-{0x8086, 0x0501, "Intel Corporation","E8870","Memory Controller" },
-{0x8086, 0x0502, "Intel Corporation","E8870","Scalability Port 0" },
-{0x8086, 0x0503, "Intel Corporation","E8870","Scalability Port 1 / Glob. Perf. Monitor" },
-{0x8086, 0x0510, "Intel Corporation","E8870IO","Hub Interface Port 0 (8-bit compatible)" },
-{0x8086, 0x0511, "Intel Corporation","E8870IO","Hub Interface Port 2" },
-{0x8086, 0x0512, "Intel Corporation","E8870IO","Hub Interface Port 2" },
-{0x8086, 0x0513, "Intel Corporation","E8870IO","Hub Interface Port 3" },
-{0x8086, 0x0514, "Intel Corporation","E8870IO","Hub Interface Port 4" },
-{0x8086, 0x0515, "Intel Corporation","E8870IO","Server I/O Hub (SIOH)" },
-{0x8086, 0x0516, "Intel Corporation","E8870IO","Reliabilty, Availability, Serviceability" },
-{0x8086, 0x0530, "Intel Corporation","E8870SP","Scalability Port 0" },
-{0x8086, 0x0531, "Intel Corporation","E8870SP","Scalability Port 1" },
-{0x8086, 0x0532, "Intel Corporation","E8870SP","Scalability Port 2" },
-{0x8086, 0x0533, "Intel Corporation","E8870SP","Scalability Port 3" },
-{0x8086, 0x0534, "Intel Corporation","E8870SP","Scalability Port 4" },
-{0x8086, 0x0535, "Intel Corporation","E8870SP","Scalability Port 5" },
-{0x8086, 0x0536, "Intel Corporation","E8870SP","Scalability Port Switch Global Registers" },
-{0x8086, 0x0537, "Intel Corporation","E8870SP","Interleave Configuration Registers" },
-{0x8086, 0x0600, "Intel Corporation","1043","Storage RAID Controller" },
-{0x8086, 0x0780, "Intel Corporation","3.0/2.0","Intel B75 Express Chipset" },
-{0x8086, 0x0800, "Intel Corporation","10B01734","pci/ven_8086&dev_27da&subsys_30b2103c&rev_02\\3&b1bfb68&0&fb" },
-{0x8086, 0x0885, "Intel Corporation","612BNXHMW","Intel Centrino Wireless-N + WiMAX 6150" },
-{0x8086, 0x0887, "Intel Corporation","Intel Centrino Chipset","Intel Centrino Wireless-N 2230" },
-{0x8086, 0x0888, "Intel Corporation","0","Intel Centrino Wireless-N 2230" },
-{0x8086, 0x088E, "Intel Corporation","40608086","Intel Centrino Advanced N 6235" },
-{0x8086, 0x0890, "Intel Corporation","Intel","Network Controller" },
-{0x8086, 0x0894, "Intel Corporation","86881","Centrino Wireless-N 105" },
-{0x8086, 0x0896, "Intel Corporation","Wireless-N 130","Intel Centrino Wireless-N 130" },
-{0x8086, 0x08AE, "Intel Corporation","802.11n","Intel Centrino Wireless-N 100" },
-{0x8086, 0x08B1, "Intel Corporation","PCI\\VEN_8086&DEV_08B1","Intel(R) Dual Band Wireless-AC 7260" },
-{0x8086, 0x08B3, "Intel Corporation","?","Intel Dual Band Wireless-AC 3160" },
-{0x8086, 0x0960, "Intel Corporation","80960RP","i960 RP Microprocessor/Bridge" },
-{0x8086, 0x0962, "Intel Corporation","80960RM/RN","i960RM/RN Microprocessor/Bridge" },
-{0x8086, 0x0964, "Intel Corporation","80960RP","i960 RP Microprocessor Bridge" },
-{0x8086, 0x0A03, "Intel Corporation","0A03","Intel(R) Dynamic Platform and Thermal Framework Processor Participant" },
-{0x8086, 0x0A04, "Intel Corporation","0A04","PCI standard host CPU bridge" },
-{0x8086, 0x0A0C, "Intel Corporation","0A0C","High Definition Audio Controller" },
-{0x8086, 0x0A16, "Intel Corporation","3000","Intel HD Graphics Controller" },
-{0x8086, 0x0A1E, "Intel Corporation","0A1","Intel(R) HD Graphics" },
-{0x8086, 0x0BE1, "Intel Corporation","0000000","Intel Graphics Media Accelerator 3600 Series" },
-{0x8086, 0x0C00, "Intel Corporation","0C00","Intel(R) 4th Gen Core processor DRAM Controller" },
-{0x8086, 0x0C05, "Intel Corporation","V9201015","Intel(R) 6 Series/C200 Series Chipset Family SMBus Controller" },
-{0x8086, 0x0F00, "Intel Corporation","0F00","Intel(R) Pentium(R)/Celeron(R) processor N-/J- series SoC Transaction Router" },
-{0x8086, 0x0F04, "Intel Corporation","0F04","High Definition Audio Controller" },
-{0x8086, 0x0F12, "Intel Corporation","0F12","Intel(R) Pentium(R)/Celeron(R) processor N-/J- series Platform Control Unit - SMBus Port" },
-{0x8086, 0x0F18, "Intel Corporation","0F18","Intel(R) Trusted Execution Engine Interface" },
-{0x8086, 0x0F1C, "Intel Corporation","0F1C","Intel(R) Pentium(R)/Celeron(R) processor N-/J- series Platform Conrol Unit LPC: Bridge to Intel Lega" },
-{0x8086, 0x0F23, "Intel Corporation","0F23","Intel(R) Pentium(R)/Celeron(R) processor N-/J- series AHCI" },
-{0x8086, 0x0f31, "Intel Corporation","5200","Iris pro 5200" },
-{0x8086, 0x0F35, "Intel Corporation","0F35","Intel(R) USB 3.0 eXtensible Host Controller" },
-{0x8086, 0x0F48, "Intel Corporation","0F48","Intel(R) Pentium(R)/Celeron(R) processor N-/J- series PCI Express Root Port" },
-{0x8086, 0x0F4A, "Intel Corporation","0F4A","Intel(R) Pentium(R)/Celeron(R) processor N-/J- series PCI Express Root Port" },
-{0x8086, 0x100, "Intel Corporation","0100","2nd Generation Intel(R) Core(TM) Processor Family DRAM Controller" },
-{0x8086, 0x1000, "Intel Corporation","82542","Gigabit Ethernet Controller" },
-{0x8086, 0x1001, "Intel Corporation","2572","10/100/1000 Ethernet Controller (Fiber)" },
-{0x8086, 0x1002, "Intel Corporation","","Pro 100 LAN+Modem 56 CardBus II" },
-{0x8086, 0x1004, "Intel Corporation","82543GC","Gigabit Ethernet Controller (Copper)" },
-{0x8086, 0x1008, "Intel Corporation","82544EI/GC","Gigabit Ethernet Controller (Copper)" },
-{0x8086, 0x1009, "Intel Corporation","82845G/GL/GV/GE/PE Integrated Graphics Device","Intel" },
-{0x8086, 0x100C, "Intel Corporation","82543EI/GC","Gigabit Ethernet Controller (Copper)" },
-{0x8086, 0x100D, "Intel Corporation","82544GC","Gigabit Ethernet Controller (LOM)" },
-{0x8086, 0x100E, "Intel Corporation","02000","Intel Pro 1000/MT" },
-{0x8086, 0x100F, "Intel Corporation","82545EM","Intel(R) PRO/1000 MT Network Connection" },
-{0x8086, 0x1010, "Intel Corporation","82546EB","Dual Port Gigabit Ethernet Controller (Copper)" },
-{0x8086, 0x1011, "Intel Corporation","82545EM","Gigabit Ethernet Controller (Fiber)" },
-{0x8086, 0x1012, "Intel Corporation","82546EB","Dual Port Gigabit Ethernet Controller (Fiber)" },
-{0x8086, 0x1013, "Intel Corporation","82541EI","Gigabit Ethernet Controller (Copper)" },
-{0x8086, 0x1014, "Intel Corporation","82541ER","Gigabit Ethernet Controller" },
-{0x8086, 0x1015, "Intel Corporation","82540EM","Gigabit Ethernet Controller (LOM)" },
-{0x8086, 0x1016, "Intel Corporation","82540EP","Gigabit Ethernet Controller (LOM)" },
-{0x8086, 0x1017, "Intel Corporation","82540EP","Gigabit Ethernet Controller (LOM)" },
-{0x8086, 0x1018, "Intel Corporation","82541EI","PRO/1000 MT Mobile connection" },
-{0x8086, 0x1019, "Intel Corporation","82547EI","Gigabit Ethernet Controller (LOM)" },
-{0x8086, 0x101A, "Intel Corporation","82547EI","Gigabit Ethernet Controller (LOM)" },
-{0x8086, 0x101d, "Intel Corporation","82546EB","Dual Port Gigabit Ethernet Controller" },
-{0x8086, 0x101E, "Intel Corporation","82540EP","Gigabit Ethernet Controller (Mobile)" },
-{0x8086, 0x1026, "Intel Corporation","82545ep","Gigabit Ethernet Controller" },
-{0x8086, 0x1027, "Intel Corporation","82545GM","Gigabit Ethernet Controller (Fiber)" },
-{0x8086, 0x1028, "Intel Corporation","82545GM","Gigabit Ethernet Controller" },
-{0x8086, 0x1029, "Intel Corporation","82559","Fast Ethernet PCI/CardBus Controller" },
-{0x8086, 0x1030, "Intel Corporation","82801","PCI Networking device" },
-{0x8086, 0x1031, "Intel Corporation","82801CAM","PRO/100 VE Network Connection" },
-{0x8086, 0x1032, "Intel Corporation","82801CAM","PRO/100 VE Network Connection" },
-{0x8086, 0x1033, "Intel Corporation","PB 642365-003","multimedia video controller" },
-{0x8086, 0x1034, "Intel Corporation","82801CAM","PRO/100 VM Network Connection" },
-{0x8086, 0x1035, "Intel Corporation","82562EH","Phoneline Network Connection" },
-{0x8086, 0x1036, "Intel Corporation","82562EH","Phoneline Network Connection" },
-{0x8086, 0x1037, "Intel Corporation","82801CAM","LAN Controller" },
-{0x8086, 0x1038, "Intel Corporation","82801CAM","PRO/100 VM/KM Network Connection" },
-{0x8086, 0x1039, "Intel Corporation","10011734"," 82562" },
-{0x8086, 0x103A, "Intel Corporation","82801DB","LAN Controller with 82562ET/EZ (CNR) PHY" },
-{0x8086, 0x103B, "Intel Corporation","82801DB","LAN Controller with 82562EM/EX PHY" },
-{0x8086, 0x103C, "Intel Corporation","82801DB","LAN Controller with 82562EM/EX (CNR) PHY" },
-{0x8086, 0x103D, "Intel Corporation","05221014","PRO/100 VE Network Connection" },
-{0x8086, 0x103E, "Intel Corporation","82801DB","PRO/100 VM Network Connection" },
-{0x8086, 0x1040, "Intel Corporation","536EP","V.92 PCI (DSP) Data Fax Modema" },
-{0x8086, 0x1042, "Intel Corporation","8086","PRO/Wireless 2011 LAN PCI Card" },
-{0x8086, 0x1043, "Intel Corporation","82801","Intel(R) PRO/Wireless 2100 LAN Card Driver" },
-{0x8086, 0x1048, "Intel Corporation","82597EX","10 Gigabit Ethernet Controller" },
-{0x8086, 0x1049, "Intel Corporation","82566MM NIC","Gigabit Network Connection Interface Controller" },
-{0x8086, 0x104A, "Intel Corporation","Intel 82566DM Gigabit Ethernet","gigabit ethernet" },
-{0x8086, 0x104B, "Intel Corporation","82566DC","Gigabit Ethernet" },
-{0x8086, 0x104D, "Intel Corporation","82566MC","Intel Gigabit 82566MC" },
-{0x8086, 0x1050, "Intel Corporation","82562EZ","PRO/100 VE Network Connection" },
-{0x8086, 0x1051, "Intel Corporation","82801EB/ER","PRO/100 VE Network Connection" },
-{0x8086, 0x1052, "Intel Corporation","82801EB/ER","PRO/100 VM Network Connection" },
-{0x8086, 0x1053, "Intel Corporation","82801EB/ER","PRO/100 VM ork NetConnectionw" },
-{0x8086, 0x1054, "Intel Corporation","82801EB/ER","PRO/100 VE Network Connection (mobile)" },
-{0x8086, 0x1055, "Intel Corporation","82801EB/ER","PRO/100 VM Network Connection (mobile)" },
-{0x8086, 0x1059, "Intel Corporation","82551QM","Fast Ethernet PCI/CardBus Controller" },
-{0x8086, 0x105E, "Intel Corporation","82579V","Intel(R) PRO/1000 PT Dual Port Server Adapter" },
-{0x8086, 0x1064, "Intel Corporation","Intel Pro VE","82562EZ PLC" },
-{0x8086, 0x1065, "Intel Corporation","82801FB/FR/FW/FRW","LAN Controller Intel Corporation 82562ET/EZ/GT/GZ - PRO/100 VE Ethernet Controller" },
-{0x8086, 0x1068, "Intel Corporation","82562","1068h 82562ET/EZ/GT/GZ PRO/100 VE Ethernet Controller" },
-{0x8086, 0x1075, "Intel Corporation","82547EI","Gigabit Ethernet Controller" },
-{0x8086, 0x1076, "Intel Corporation","82541EI","Gigabit Ethernet Controller" },
-{0x8086, 0x1077, "Intel Corporation","82547EI","Gigabit Ethernet Controller (Mobile)" },
-{0x8086, 0x1078, "Intel Corporation","82541ER","Gigabit Ethernet Controller" },
-{0x8086, 0x1079, "Intel Corporation","82546EB","Dual Port Gigabit Ethernet Controller" },
-{0x8086, 0x107A, "Intel Corporation","82546EB","Dual Port Gigabit Ethernet Controller (Fiber)" },
-{0x8086, 0x107B, "Intel Corporation","82546EB","Dual Port Gigabit Ethernet Controller (Copper)" },
-{0x8086, 0x107C, "Intel Corporation","82541PI","Gigabit Ethernet Controller (Copper) rev 5" },
-{0x8086, 0x1080, "Intel Corporation","0321CGEA04","FA82537EP - Intel 537EP V.92 (PCI)  modem" },
-{0x8086, 0x108B, "Intel Corporation","PC82573V","Intel network controller (PCIE Gigabit Ethernet)" },
-{0x8086, 0x108c, "Intel Corporation","82573E","Intel Corporation 82573E Gigabit Ethernet Controller (Copper)" },
-{0x8086, 0x108E, "Intel Corporation","ICH7R","Intel(R) Active Management Technology - KCS" },
-{0x8086, 0x108F, "Intel Corporation","ICH7R","Intel(R) Active Management Technology - SOL" },
-{0x8086, 0x1092, "Intel Corporation","27DA","PRO/100 VE Network Controller" },
-{0x8086, 0x1094, "Intel Corporation","Onboard - Intel PRO 100/VE nic","get PRO2KXP.exe from Intel" },
-{0x8086, 0x1096, "Intel Corporation","Intel PRO/1000 EB","Intel PRO/1000 EB" },
-{0x8086, 0x109A, "Intel Corporation","82573L","Intel PRO/1000 PL Network Adaptor" },
-{0x8086, 0x109c, "Intel Corporation","e1qexpress","HP E1Q Express" },
-{0x8086, 0x10a7, "Intel Corporation","82575 ?","82575EB Gigabit Network Connection" },
-{0x8086, 0x10a9, "Intel Corporation","82575 ?","82575EB Gigabit Backplane Connection" },
-{0x8086, 0x10b5, "Intel Corporation","82546GB","Quad Port Gigabit Ethernet Controller" },
-{0x8086, 0x10b9, "Intel Corporation","82572GI","Intel PRO/1000 PT Desktop" },
-{0x8086, 0x10BD, "Intel Corporation","82566DM","Intel 82566DM Gigabit Ethernet Adapter" },
-{0x8086, 0x10C0, "Intel Corporation","8082","Intel(R) 82562V-2 10/100 Network Connection" },
-{0x8086, 0x10c4, "Intel Corporation","82562GT","Intel 82562GT 10/100 Network Controller" },
-{0x8086, 0x10c4, "Intel Corporation","82562EZ PLC","Intel 82562GT 10/100 Network Controller" },
-{0x8086, 0x10c9, "Intel Corporation","82576?","82576 Gigabit ET Dual Port Server Adapter" },
-{0x8086, 0x10cd, "Intel Corporation","82567","Intel(R) 82567LF-2 Gigabit Network Connection" },
-{0x8086, 0x10CE, "Intel Corporation","82567V-2","Intel 82567V-2 Gigabit Network Connection" },
-{0x8086, 0x10d3, "Intel Corporation","82574L","Intel® 82574L Gigabit Ethernet Controller" },
-{0x8086, 0x10d6, "Intel Corporation","82575","82566 DM-2-gigabyte" },
-{0x8086, 0x10DE, "Intel Corporation","02761028","Intel Gigabit network connection" },
-{0x8086, 0x10e6, "Intel Corporation","82576 ?","82576 Gigabit Network Connection" },
-{0x8086, 0x10e7, "Intel Corporation","82576 ?","82576 Gigabit Network Connection" },
-{0x8086, 0x10E8, "Intel Corporation","82576","E64750-xxx Intel Gigabit ET Quad Port Server Adapter" },
-{0x8086, 0x10EA, "Intel Corporation","82577LM","Intel 82577LM Gigabit LAN Controller" },
-{0x8086, 0x10EC, "Intel Corporation","Realtek AC97Audio","Realtek 171 High Definition Audio" },
-{0x8086, 0x10EF, "Intel Corporation","Intel® 82578DM Gigabit Ethernet Controller","Intel® 82578DM Gigabit Ethernet Controller" },
-{0x8086, 0x10F0, "Intel Corporation","82578","Intel(R) 82578DC Gigabit NIC" },
-{0x8086, 0x10F5, "Intel Corporation","82567LM","Intel®  82567LM-2 Gigabit Network Connection" },
-{0x8086, 0x10fb, "Intel Corporation","82599","10 Gb Ethernet controller" },
-{0x8086, 0x1100, "Intel Corporation","82815/EP/P","Host-Hub Interface Bridge / DRAM Ctrlr" },
-{0x8086, 0x1101, "Intel Corporation","82815/EP/P","AGP Bridge" },
-{0x8086, 0x1102, "Intel Corporation","82915GV","Internal Graphics Device" },
-{0x8086, 0x1110, "Intel Corporation","82815","Host-Hub Interface Bridge / DRAM Ctrlr" },
-{0x8086, 0x1112, "Intel Corporation","82815","Internal Graphics Device" },
-{0x8086, 0x1120, "Intel Corporation","82815","Host-Hub Interface Bridge / DRAM Ctrlr" },
-{0x8086, 0x1121, "Intel Corporation","82815","AGP Bridge" },
-{0x8086, 0x112D, "Intel Corporation","2200","pci simple controller " },
-{0x8086, 0x1130, "Intel Corporation","82815/82815EM/EP","Host-Hub Interface Bridge / DRAM Ctrlr" },
-{0x8086, 0x1131, "Intel Corporation","82815/82815EM/EP","AGP Bridge" },
-{0x8086, 0x1132, "Intel Corporation","65416http://www.pcidatabase.com/update_device.php?","Internal Graphics Device [810/815 chipset AGP]" },
-{0x8086, 0x1161, "Intel Corporation","82806AA","I/O APIC Device" },
-{0x8086, 0x1162, "Intel Corporation","BECC","XScale 80200 Companion Chip (FPGA)" },
-{0x8086, 0x1179, "Intel Corporation","82546EB","Dual Port Gigabit Ethernet Controller" },
-{0x8086, 0x12, "Intel Corporation","03491025","00" },
-{0x8086, 0x1200, "Intel Corporation","IXP1200","Network Processor" },
-{0x8086, 0x1209, "Intel Corporation","8255xER/IT","Fast Ethernet Controller for xp pc" },
-{0x8086, 0x1221, "Intel Corporation","82092AA","PCMCIA Bridge" },
-{0x8086, 0x1222, "Intel Corporation","2792","IDE Ctrlr" },
-{0x8086, 0x1223, "Intel Corporation","Conexant Cx20468 @ Intel 82801FB ICH6 - AC'97 Audi","Audio Controller" },
-{0x8086, 0x1225, "Intel Corporation","82452KX/GX","Orion Extended Express CPU to PCI Bridge" },
-{0x8086, 0x1226, "Intel Corporation","82596","EtherExpress PRO/10" },
-{0x8086, 0x1227, "Intel Corporation","82801db ich4","LAN Controller with 82562EM" },
-{0x8086, 0x1228, "Intel Corporation","EE PRO/100 Smart","Intelligent 10/100 Fast Ethernet Adapter" },
-{0x8086, 0x1229, "Intel Corporation","1e22","Intel(R) PRO/100 http://ftp.dell.com/network/R56484.EXE" },
-{0x8086, 0x122D, "Intel Corporation","82437FX","System Controller (TSC)" },
-{0x8086, 0x122E, "Intel Corporation","82371AB/EB PCI","PCI to ISA Bridge (Triton)" },
-{0x8086, 0x1230, "Intel Corporation","FW82371AB","IDE Interface (Triton)" },
-{0x8086, 0x1231, "Intel Corporation","16345","DSVD Modem" },
-{0x8086, 0x1234, "Intel Corporation","82371MX","PCI to ISA Bridge" },
-{0x8086, 0x1235, "Intel Corporation","82439TX","Mobile System Controller (MTSC)" },
-{0x8086, 0x1237, "Intel Corporation","82440LX/EX","PCI & Memory" },
-{0x8086, 0x1239, "Intel Corporation","82371FB","IDE Interface (Triton)" },
-{0x8086, 0x123B, "Intel Corporation","82380PB","PCI to PCI Docking Bridge" },
-{0x8086, 0x123C, "Intel Corporation","82380AB","Mobile PCI-to-ISA Bridge (MISA)" },
-{0x8086, 0x123D, "Intel Corporation","683053","Programmable Interrupt Device" },
-{0x8086, 0x123E, "Intel Corporation","82466GX","Integrated Hot-Plug Controller (IHPC)" },
-{0x8086, 0x123F, "Intel Corporation","82466GX","Integrated Hot-Plug Controller (IHPC)" },
-{0x8086, 0x124, "Intel Corporation","PCI\\VEN_8086&DEV_9C22","24c6" },
-{0x8086, 0x1240, "Intel Corporation","82752","AGP Graphics Accelerator" },
-{0x8086, 0x124B, "Intel Corporation","PCI\\VEN_8086&DEV_2E17&CC_070002","24c6" },
-{0x8086, 0x124C, "Intel Corporation","9776","Mobile PCI-to-PCI Bridge (MPCI2)" },
-{0x8086, 0x1250, "Intel Corporation","82430HX","System Controller (TXC)" },
-{0x8086, 0x12D8, "Intel Corporation","92XX","SIGMATEL STAC 92XX C-Major HD Audio" },
-{0x8086, 0x1360, "Intel Corporation","82806AA","Hub Interface to PCI Bridge" },
-{0x8086, 0x1361, "Intel Corporation","82806AA","Advanced Interrupt Controller" },
-{0x8086, 0x13ca, "Intel Corporation","VVVV","VVVVVV" },
-{0x8086, 0x1460, "Intel Corporation","82870P2","Hub Interface-to-PCI Bridge" },
-{0x8086, 0x1461, "Intel Corporation","14611014","I/OxAPIC Interrupt Controller" },
-{0x8086, 0x1462, "Intel Corporation","82870P2","Hot Plug Controller" },
-{0x8086, 0x1502, "Intel Corporation","0x04931028","Intel 82579LM Gigabit Network Card" },
-{0x8086, 0x1503, "Intel Corporation","Intel 82579v","Gigabit Network Connection" },
-{0x8086, 0x150a, "Intel Corporation","82576 ?","82576NS Gigabit Ethernet Controller" },
-{0x8086, 0x150C, "Intel Corporation","82583V","Intel® 82583V Gigabit Ethernet  Controller" },
-{0x8086, 0x150d, "Intel Corporation","82576 ?","82576 Gigabit Backplane Connection" },
-{0x8086, 0x150e, "Intel Corporation","82580 ?","82580 Gigabit Network Connection" },
-{0x8086, 0x150f, "Intel Corporation","82580 ?","82580 Gigabit Fiber Network Connection" },
-{0x8086, 0x1510, "Intel Corporation","82580 ?","82580 Gigabit Backplane Connection" },
-{0x8086, 0x1511, "Intel Corporation","82580 ?","82580 Gigabit SFP Connection" },
-{0x8086, 0x1516, "Intel Corporation","82580 ?","82580 Gigabit Network Connection" },
-{0x8086, 0x1518, "Intel Corporation","82576 ?","82576NS SerDes Gigabit Network Connection" },
-{0x8086, 0x1521, "Intel Corporation","I350","i350 Gigabit Network Connection" },
-{0x8086, 0x1525, "Intel Corporation","82567V-4","Intel 82567V-4 Gigabit Network Connection" },
-{0x8086, 0x1526, "Intel Corporation","82576","Intel Gigabit ET2 Quad Port Server Adapter" },
-{0x8086, 0x1533, "Intel Corporation","210","Intel I210 Gigabit Network Connection" },
-{0x8086, 0x153A, "Intel Corporation","USB\\VID_0424&PID_2504&REV_0001","Intel I217-LM Ethernet Connection" },
-{0x8086, 0x153B, "Intel Corporation","I217-V","Intel Gigabit Ethernet Controller I217-V" },
-{0x8086, 0x1559, "Intel Corporation","0x8CBA","Intel Ethernet I218-V" },
-{0x8086, 0x155a, "Intel Corporation","I218LM","Gigabit Ethernet" },
-{0x8086, 0x15A1, "Intel Corporation","0x8CBA","Intel® Ethernet Connection I218-V" },
-{0x8086, 0x15A2, "Intel Corporation","I218LM","Gigabit Ethernet" },
-{0x8086, 0x167D, "Intel Corporation","2200bg","PCI Simple Communications Controller" },
-{0x8086, 0x1960, "Intel Corporation","80960RP","i960RP Microprocessor" },
-{0x8086, 0x1962, "Intel Corporation","???","Promise SuperTrak SX6000 IDE RAID Controller" },
-{0x8086, 0x1A12, "Intel Corporation","???","Eicon DIVA Server Voice PRI 2.0 (PCI)" },
-{0x8086, 0x1A13, "Intel Corporation","???","Eicon DIVA Server Voice PRI 2.0 (PCI)" },
-{0x8086, 0x1A20, "Intel Corporation","82840","" },
-{0x8086, 0x1A21, "Intel Corporation","82840","Host-Hub Interface A Bridge / DRAM Ctrlr" },
-{0x8086, 0x1A22, "Intel Corporation","82840","Host to I/O Hub Bridge (Quad PCI)" },
-{0x8086, 0x1A23, "Intel Corporation","82840","AGP Bridge" },
-{0x8086, 0x1A24, "Intel Corporation","82840","Hub Interface B Bridge" },
-{0x8086, 0x1A30, "Intel Corporation","82845G[GL/GV/GE/PE]","Host-Hub Interface Bridge" },
-{0x8086, 0x1A31, "Intel Corporation","82845[MP/MZ]","AGP Bridge" },
-{0x8086, 0x1A38, "Intel Corporation","5000P","5000 Series Chipset DMA Engine" },
-{0x8086, 0x1A3E, "Intel Corporation","Z77","C216 Chipset - Platform controller hub" },
-{0x8086, 0x1c02, "Intel Corporation","1C02","Intel(R) 6/C200 Series Chipset Family 6 Port SATA AHCI Controller" },
-{0x8086, 0x1C03, "Intel Corporation","Intel(R) Mobile Express Chipset SATA AHCI Controll","Intel(R) CPT Chipset Family 6 Port SATA AHCI Controller " },
-{0x8086, 0x1C10, "Intel Corporation","1C10","Intel(R) 6/C200 Series Chipset Family PCI Express Root Port" },
-{0x8086, 0x1C18, "Intel Corporation","1C18","Intel(R) 6/C200 Series Chipset Family PCI Express Root Port" },
-{0x8086, 0x1C1A, "Intel Corporation","1C3Afsfsdf","1C3Asfsfsdf" },
-{0x8086, 0x1C1C, "Intel Corporation","1C1C","Intel(R) 6/C200 Series Chipset Family PCI Express Root Port" },
-{0x8086, 0x1C1E, "Intel Corporation","1C1E","Intel(R) 6/C200 Series Chipset Family PCI Express Root Port" },
-{0x8086, 0x1C20, "Intel Corporation","1C20","High Definition Audio Controller" },
-{0x8086, 0x1C22, "Intel Corporation","win7 64-bit ","Intel(R) 6 Series/C200 Series Chipset Family SMBus Controller" },
-{0x8086, 0x1C26, "Intel Corporation","HM65","Intel(R) 6/C200 Series Chipset Family USB Enhanced Host Controller" },
-{0x8086, 0x1C2D, "Intel Corporation","1C2D","Intel(R) 6/C200 Series Chipset Family USB Enhanced Host Controller" },
-{0x8086, 0x1c3a, "Intel Corporation","161C103C","Intel Management Engine Interface" },
-{0x8086, 0x1C3b, "Intel Corporation","111","Series Chipset Family HECI Controller #2" },
-{0x8086, 0x1C3D, "Intel Corporation","Intel(R) 6 Series Series Chipset Family","Intel(R) Active Management Technology - SOL" },
-{0x8086, 0x1C49, "Intel Corporation","FCD01179","04" },
-{0x8086, 0x1C4C, "Intel Corporation","Q65","Intel(R) Q65 Express Chipset Family LPC Interface Controller" },
-{0x8086, 0x1D3A, "Intel Corporation","X79 series chipset HECI Controller","X79/C600 series chipset Management Engine Interface" },
-{0x8086, 0x1D3D, "Intel Corporation","CC0700","Intel Active Management Technology AMT" },
-{0x8086, 0x1e00, "Intel Corporation","Intel H77 Express Chipset","2 ports IDE Controller" },
-{0x8086, 0x1e02, "Intel Corporation","SUBSYS_102E17AA&REV_04","Intel 7 Series/C216 Chipset Family SATA AHCI Controller" },
-{0x8086, 0x1E03, "Intel Corporation","PCI\\CC_010601","Intel(R) 7 Series Chipset Family SATA AHCI Controller" },
-{0x8086, 0x1e08, "Intel Corporation","Intel H77 Express Chipset","2 ports IDE Controller" },
-{0x8086, 0x1E10, "Intel Corporation","C216","Intel(R) 7 Series/C216 Chipset Family PCI Express Root Port" },
-{0x8086, 0x1E12, "Intel Corporation","1E12","Intel(R) 7 Series/C216 Chipset Family PCI Express Root Port" },
-{0x8086, 0x1E16, "Intel Corporation","C216","Intel(R) 7 Series/C216 Chipset Family PCI Express Root Port" },
-{0x8086, 0x1E20, "Intel Corporation","1E20","High Definition Audio Controller" },
-{0x8086, 0x1E22, "Intel Corporation","Intel(R) 7 SeriesC216 Chipset Family SMBus Host Co","SM-Bus Controller of the Intel Z77 Chipset" },
-{0x8086, 0x1E26, "Intel Corporation","C216","Intel(R) 7 Series/C216 Chipset Family USB Enhanced Host Controller" },
-{0x8086, 0x1E2D, "Intel Corporation","C216","Intel(R) 7 Series/C216 Chipset Family USB Enhanced Host Controller" },
-{0x8086, 0x1e31, "Intel Corporation","Intel USB 3.0 eXtensible Host Controller 1E31","Intel USB 3.0" },
-{0x8086, 0x1E3A, "Intel Corporation","PCI\\VEN_8086&DEV_1E3A&SUBSYS","Intel Management Engine Interface (MEI)" },
-{0x8086, 0x1E3D, "Intel Corporation","602317","Intel(R) AMT LMS_SOL for AMT 8.xx" },
-{0x8086, 0x1E59, "Intel Corporation","140889","Intel(R) HM76 Express Chipset LPC Controller" },
-{0x8086, 0x1f41, "Intel Corporation","Avoton SoC","Intel Corporation Ethernet Connection I354" },
-{0x8086, 0x2000, "Intel Corporation","CA 95054","505943621" },
-{0x8086, 0x2014, "Intel Corporation","0x18C9","Framegrabber" },
-{0x8086, 0x2048, "Intel Corporation","Atheros L2","Fast Ethernet 10/100 Base-T Controller" },
-{0x8086, 0x2124, "Intel Corporation","27DA","PRO/100 VE Network Connection" },
-{0x8086, 0x2125, "Intel Corporation","82801G ","AC97 Audio Controller. website to download - http://www.intel.com/design/chipsets/manuals/29802801.p" },
-{0x8086, 0x2222, "Intel Corporation","82801","Intel Management Interface" },
-{0x8086, 0x2250, "Intel Corporation","5110P","Intel(R) Xeon Phi(TM) Coprocessor" },
-{0x8086, 0x2255, "Intel Corporation","810D1043","02\\3" },
-{0x8086, 0x225C, "Intel Corporation","SE10","Intel(R) Xeon Phi(TM) Coprocessor" },
-{0x8086, 0x225D, "Intel Corporation","3120","Intel(R) Xeon Phi(TM) Coprocessor" },
-{0x8086, 0x225E, "Intel Corporation","31S1P","Intel(R) Xeon Phi(TM) Coprocessor" },
-{0x8086, 0x2406, "Intel Corporation","82801 / ?","AC97 Modem Controller / PCI Modem" },
-{0x8086, 0x2410, "Intel Corporation","82801AA","LPC Interface" },
-{0x8086, 0x2411, "Intel Corporation","82801AA","IDE Controller (UltraATA/66)" },
-{0x8086, 0x2412, "Intel Corporation","82801AA","USB Controller" },
-{0x8086, 0x2413, "Intel Corporation","82801AA","SMBus Controller" },
-{0x8086, 0x2415, "Intel Corporation","Intel 82801DBM SM/BUS Controller 24C3","Aureal (AD1881 SOUNDMAX) Placa Mãe Asaki P3-141" },
-{0x8086, 0x2416, "Intel Corporation","82801ER","AC'97 Modem Controller" },
-{0x8086, 0x2418, "Intel Corporation","82801AA","Hub Interface-to-PCI Bridge    82801 PCI-2448 0x2448" },
-{0x8086, 0x2420, "Intel Corporation","82801AB","LPC Interface" },
-{0x8086, 0x2421, "Intel Corporation","82801AB","IDE Controller (UltraATA/33)" },
-{0x8086, 0x2422, "Intel Corporation","82801AB","USB Controller" },
-{0x8086, 0x2423, "Intel Corporation","82801AB","SMBus Controller" },
-{0x8086, 0x2425, "Intel Corporation","82801BA","Audio controler" },
-{0x8086, 0x2426, "Intel Corporation","82801AB","AC97 Modem Controller" },
-{0x8086, 0x2428, "Intel Corporation","82801AB","Hub Interface-to-PCI Bridge" },
-{0x8086, 0x2431, "Intel Corporation","82810","pci bus" },
-{0x8086, 0x2440, "Intel Corporation","82801BA/BAM AC'97","LPC Interface Bridge, ICH2" },
-{0x8086, 0x2441, "Intel Corporation","82801BA","IDE Controller (UltraATA/66)" },
-{0x8086, 0x2442, "Intel Corporation","82801BA/BAM","USB Controller, USB-A" },
-{0x8086, 0x2443, "Intel Corporation","82801BA/BAM","SMBus Controller" },
-{0x8086, 0x2444, "Intel Corporation","82801BA/BAM","USB Controller, USB-B" },
-{0x8086, 0x2445, "Intel Corporation","Intel i945G/GZ","AC97 Audio Controller" },
-{0x8086, 0x2446, "Intel Corporation","82801BA/BAM","AC97 Modem Controller" },
-{0x8086, 0x2448, "Intel Corporation","82801BAM/CAM/DBM","Hub Interface to PCI Bridge" },
-{0x8086, 0x2449, "Intel Corporation","82559ER","82559ER Integrated 10Base-T/100Base-TX Ethernet Controller" },
-{0x8086, 0x244A, "Intel Corporation","82801BAM","IDE Controller" },
-{0x8086, 0x244B, "Intel Corporation","82801BA","IDE Controller" },
-{0x8086, 0x244C, "Intel Corporation","82801BAM","LPC Interface Bridge" },
-{0x8086, 0x244E, "Intel Corporation","82801DB","Intel(R) 82801 PCI Bridge" },
-{0x8086, 0x2450, "Intel Corporation","82801E","LPC Interface Bridge" },
-{0x8086, 0x2452, "Intel Corporation","82801E","USB Controller" },
-{0x8086, 0x2453, "Intel Corporation","82801E","SMBus Controller" },
-{0x8086, 0x2459, "Intel Corporation","82801E","LAN0 Controller" },
-{0x8086, 0x245B, "Intel Corporation","82801E","IDE Controller" },
-{0x8086, 0x245D, "Intel Corporation","82801E","Multimedia Audio Controller" },
-{0x8086, 0x245E, "Intel Corporation","82801E","Hub Interface to PCI Bridge" },
-{0x8086, 0x2480, "Intel Corporation","82801CA","LPC Interface Bridge" },
-{0x8086, 0x2481, "Intel Corporation","82801CA","IDE Controller (UltraATA/66)" },
-{0x8086, 0x2482, "Intel Corporation","82801CA/CAM","USB Controller" },
-{0x8086, 0x2483, "Intel Corporation","82801CA/CAM","SMBus Controller" },
-{0x8086, 0x2484, "Intel Corporation","82801CA/CAM","USB Controller" },
-{0x8086, 0x2485, "Intel Corporation","82801CA/CAM","AC97 Audio Controller" },
-{0x8086, 0x2486, "Intel Corporation","82801CA/CAM","AC 97 Modem Controller" },
-{0x8086, 0x2487, "Intel Corporation","82801CA/CAM","USB Controller" },
-{0x8086, 0x248A, "Intel Corporation","82801CAM","UltraATA IDE Controller" },
-{0x8086, 0x248B, "Intel Corporation","82801CA","UltraATA/100 IDE Controller" },
-{0x8086, 0x248C, "Intel Corporation","82801CAM","LPC Interface or ISA bridge: see Notes" },
-{0x8086, 0x248D, "Intel Corporation","82801??","USB 2.0 EHCI Contoroller" },
-{0x8086, 0x24C0, "Intel Corporation","82801DB/DBL","LPC Interface Bridge" },
-{0x8086, 0x24C2, "Intel Corporation","82801DB/DBL/DBM","USB UHCI Controller #1" },
-{0x8086, 0x24C3, "Intel Corporation","82801DB/DBL/DBM","modem" },
-{0x8086, 0x24C4, "Intel Corporation","82801DB/DBL/DBM","USB UHCI Controller" },
-{0x8086, 0x24C5, "Intel Corporation","82801DBM SoundMAXController (ICH4-M B0 step)","Realtek AC97" },
-{0x8086, 0x24C6, "Intel Corporation","82801 /8086","AC97 Modem Controller / PCI Modem" },
-{0x8086, 0x24C7, "Intel Corporation","82801DB/DBL/DBM","USB UHCI Controller #3" },
-{0x8086, 0x24CA, "Intel Corporation","82801DBM","IDE Controller (UltraATA/100)" },
-{0x8086, 0x24CB, "Intel Corporation","82801DB/DBL","IDE Controller (UltraATA/100)" },
-{0x8086, 0x24CC, "Intel Corporation","82801DBM","LPC Interface Bridge" },
-{0x8086, 0x24CD, "Intel Corporation","82801DB/DBL/DBM","USB EHCI Controller" },
-{0x8086, 0x24D0, "Intel Corporation","82801EB/ER","LPC Interface Bridge" },
-{0x8086, 0x24D1, "Intel Corporation","82801EB/ER","SATA Controller" },
-{0x8086, 0x24D2, "Intel Corporation","82801EB/ER","USB UHCI Controller 1" },
-{0x8086, 0x24D3, "Intel Corporation","82801EB/ER","SMBus Controller" },
-{0x8086, 0x24D4, "Intel Corporation","82801EB/ER","USB UHCI Controller #2" },
-{0x8086, 0x24D5, "Intel Corporation","AD1888/AD1980","Analog Devices AD1888/AD1980 @ Intel 82801EB ICH5 - AC'97 Audio Controller [A-2/A-3]" },
-{0x8086, 0x24D6, "Intel Corporation","82801EB/ER","Motorola SM56 Data Fax Modem" },
-{0x8086, 0x24D7, "Intel Corporation","82801EB/ER","USB UHCI Controller #3" },
-{0x8086, 0x24DB, "Intel Corporation","82801EB/ER","EIDE Controller" },
-{0x8086, 0x24DC, "Intel Corporation","82801EB","LPC Interface Controller" },
-{0x8086, 0x24DD, "Intel Corporation","82801EB/ER","USB EHCI Controller" },
-{0x8086, 0x24DE, "Intel Corporation","82801EB/ER","USB UHCI Controller #4" },
-{0x8086, 0x24DF, "Intel Corporation","82801ER","SATA Controller (RAID)" },
-{0x8086, 0x24E4, "Intel Corporation","24e4","intel " },
-{0x8086, 0x2500, "Intel Corporation","82820","Host-Hub Interface Bridge / DRAM Ctrlr" },
-{0x8086, 0x2501, "Intel Corporation","82820","Host Bridge (MCH)" },
-{0x8086, 0x2502, "Intel Corporation","82820","" },
-{0x8086, 0x2503, "Intel Corporation","82820","" },
-{0x8086, 0x2504, "Intel Corporation","82820","" },
-{0x8086, 0x250B, "Intel Corporation","82820","Host Bridge (MCH)" },
-{0x8086, 0x250F, "Intel Corporation","82820","AGP Bridge" },
-{0x8086, 0x2520, "Intel Corporation","82805AA","Memory Translator Hub (MTH)" },
-{0x8086, 0x2521, "Intel Corporation","8280","Audio Device on High Definition Audio Bus" },
-{0x8086, 0x2530, "Intel Corporation","82850/E","Host-Hub Interface Bridge(A2 step)" },
-{0x8086, 0x2531, "Intel Corporation","82860","Host-Hub Interface_A Bridge (DP mode)" },
-{0x8086, 0x2532, "Intel Corporation","82850/850E/860","AGP Bridge" },
-{0x8086, 0x2533, "Intel Corporation","82860","Hub Interface_B Bridge" },
-{0x8086, 0x2534, "Intel Corporation","82860","Hub Interface_C Bridge" },
-{0x8086, 0x2535, "Intel Corporation","82860","PCI Bridge" },
-{0x8086, 0x2536, "Intel Corporation","82860","PCI Bridge" },
-{0x8086, 0x2539, "Intel Corporation","82860","(Quad Processor mode)" },
-{0x8086, 0x2540, "Intel Corporation","E7500","Host-HI Bridge & DRAM Controller" },
-{0x8086, 0x2541, "Intel Corporation","E7500/E7501","DRAM Controller Error Reporting" },
-{0x8086, 0x2543, "Intel Corporation","E7500/E7501","HI_B Virtual PCI-to-PCI Bridge" },
-{0x8086, 0x2544, "Intel Corporation","E7500/E7501","HI_B PCI-to-PCI Bridge Error Reporting" },
-{0x8086, 0x2545, "Intel Corporation","E7500/E7501","HI_C Virtual PCI-to-PCI Bridge" },
-{0x8086, 0x2546, "Intel Corporation","E7500/E7501","HI_C PCI-to-PCI Bridge Error Reporting" },
-{0x8086, 0x2547, "Intel Corporation","E7500/E7501","HI_D Virtual PCI-to-PCI Bridge" },
-{0x8086, 0x2548, "Intel Corporation","E7500/E7501","HI_D PCI-to-PCI Bridge Error Reporting" },
-{0x8086, 0x254C, "Intel Corporation","E7501","Host Controller" },
-{0x8086, 0x2550, "Intel Corporation","E7505","Host Controller" },
-{0x8086, 0x2551, "Intel Corporation","25511014","Host RAS Controller" },
-{0x8086, 0x2552, "Intel Corporation","E7205/E7505","PCI-to-AGP Bridge" },
-{0x8086, 0x2553, "Intel Corporation","E7505","Hub Interface_B PCI-to-PCI Bridge" },
-{0x8086, 0x2554, "Intel Corporation","E7505","Hub I/F_B PCI-to-PCI Bridge Error Report" },
-{0x8086, 0x255d, "Intel Corporation","E7205","Host Controller" },
-{0x8086, 0x2560, "Intel Corporation","82845G/GL/GV/GE/PE","DRAM Controller / Host-Hub I/F Bridge" },
-{0x8086, 0x2561, "Intel Corporation","82845G/GL/GV/GE/PE","Host-to-AGP Bridge" },
-{0x8086, 0x2562, "Intel Corporation","82845G","Integrated Graphics Device" },
-{0x8086, 0x2570, "Intel Corporation","82865G/PE/P, 82848P","DRAM Controller / Host-Hub Interface" },
-{0x8086, 0x2571, "Intel Corporation","82865G/PE/P, 82848P","PCI-to-AGP Bridge" },
-{0x8086, 0x2572, "Intel Corporation","intel d865glc","Integrated Graphics Device" },
-{0x8086, 0x2573, "Intel Corporation","82865G/PE/P, 82848P","PCI-to-CSA Bridge" },
-{0x8086, 0x2576, "Intel Corporation","82865G/PE/P, 82848P","Overflow Configuration" },
-{0x8086, 0x2578, "Intel Corporation","82875P/E7210","DRAM Controller / Host-Hub Interface" },
-{0x8086, 0x2579, "Intel Corporation","82875P","PCI-to-AGP Bridge" },
-{0x8086, 0x257A, "Intel Corporation","","" },
-{0x8086, 0x257B, "Intel Corporation","82875P/E7210","PCI to CSA Bridge" },
-{0x8086, 0x257E, "Intel Corporation","82875P/E7210","Overflow Configuration" },
-{0x8086, 0x2580, "Intel Corporation","915G/P/GV","Host Bridge / DRAM Controller" },
-{0x8086, 0x2581, "Intel Corporation","915G/P/GV, 925X/XE?","Host-PCI Express Bridge" },
-{0x8086, 0x2582, "Intel Corporation","142550","82915g/gv/910gl Express Chipset Family" },
-{0x8086, 0x2584, "Intel Corporation","82925X/XE","Host Bridge / DRAM Controller" },
-{0x8086, 0x2585, "Intel Corporation","","" },
-{0x8086, 0x2588, "Intel Corporation","E7221","Host Bridge/DRAM Controller" },
-{0x8086, 0x2589, "Intel Corporation","E7221","PCI Express Bridge" },
-{0x8086, 0x258A, "Intel Corporation","E7221","Internal Graphics" },
-{0x8086, 0x2590, "Intel Corporation","915GM","Mobile Intel(R) 915GM/PM/GMS/910GML Express Processor to DRAM Controller" },
-{0x8086, 0x2592, "Intel Corporation","Intel 82852/82855 ","Graphic controller family" },
-{0x8086, 0x25A1, "Intel Corporation","6300ESB","LPC Interface Bridge" },
-{0x8086, 0x25A2, "Intel Corporation","6300ESB","PATA100 IDE Controller" },
-{0x8086, 0x25A3, "Intel Corporation","6300ESB","SATA Controller(IDE Mode)" },
-{0x8086, 0x25A4, "Intel Corporation","6300ESB","SMBus Controller" },
-{0x8086, 0x25A6, "Intel Corporation","6300ESB","AC'97 Audio Controller" },
-{0x8086, 0x25A7, "Intel Corporation","6300ESB","AC'97 Modem Controller" },
-{0x8086, 0x25A9, "Intel Corporation","6300ESB","USB 1.1 UHCI Controller #1" },
-{0x8086, 0x25AA, "Intel Corporation","6300ESB","USB 1.1 UHCI Controller #2" },
-{0x8086, 0x25AB, "Intel Corporation","6300ESB","Watchdog Timer" },
-{0x8086, 0x25AC, "Intel Corporation","6300ESB","APIC1" },
-{0x8086, 0x25AD, "Intel Corporation","6300ESB","USB 2.0 EHCI Controller" },
-{0x8086, 0x25AE, "Intel Corporation","6300ESB","Hub Interface to PCI-X Bridge" },
-{0x8086, 0x25B0, "Intel Corporation","6300ESB","Serial ATA Controller (RAID mode)" },
-{0x8086, 0x2600, "Intel Corporation","E8500","Hub Interface 1.5" },
-{0x8086, 0x2601, "Intel Corporation","E8500","PCI Express Port D" },
-{0x8086, 0x2602, "Intel Corporation","E8500","PCI Express Port C0" },
-{0x8086, 0x2603, "Intel Corporation","E8500","PCI Express Port C1" },
-{0x8086, 0x2604, "Intel Corporation","E8500","PCI Express Port B0" },
-{0x8086, 0x2605, "Intel Corporation","E8500","PCI Express Port B1" },
-{0x8086, 0x2606, "Intel Corporation","E8500","PCI Express Port A0" },
-{0x8086, 0x2607, "Intel Corporation","E8500","PCI Express Port A1" },
-{0x8086, 0x2640, "Intel Corporation","82801FB/FR","LPC Interface Bridge" },
-{0x8086, 0x2641, "Intel Corporation","82801FBM","LPC Interface Bridge (ICH6-M)" },
-{0x8086, 0x2651, "Intel Corporation","82801Fb","SATA Controller" },
-{0x8086, 0x2652, "Intel Corporation","82801FR","SATA RAID Controller" },
-{0x8086, 0x2653, "Intel Corporation","82801FBM","SATA AHCI Controller" },
-{0x8086, 0x2658, "Intel Corporation","82801FB/FR/FW/FRW","USB UHCI Controller #1" },
-{0x8086, 0x2659, "Intel Corporation","82801FB/FR/FW/FRW","USB UHCI Controller #2" },
-{0x8086, 0x265A, "Intel Corporation","82801FB/FR/FW/FRW","USB UHCI Controller #3" },
-{0x8086, 0x265B, "Intel Corporation","82801FB/FR/FW/FRW","USB UHCI Controller #4" },
-{0x8086, 0x265C, "Intel Corporation","82801FB/FR/FW/FRW","USB 2.0 EHCI Controller" },
-{0x8086, 0x266, "Intel Corporation","VIA Technologies Vinyl AC'97 Codec Combo Driver (W","VIA AC97 codec incorporated into VT82C686VT8251 SouthbridA/B, VT8231, VT8233/A/C, VT8235, VT8237/R" },
-{0x8086, 0x2660, "Intel Corporation","82801FB/FR/FW/FRW","PCI Express Port 1" },
-{0x8086, 0x2662, "Intel Corporation","82801FB/FR/FW/FRW","PCI Express Port 2" },
-{0x8086, 0x2664, "Intel Corporation","82801FB","PCI Express Port 3" },
-{0x8086, 0x2666, "Intel Corporation","82801FB/FR/FW/FRW","PCI Express Port 4" },
-{0x8086, 0x2668, "Intel Corporation","11511583659","82801FB (ICH6) High Definition Audio Controller" },
-{0x8086, 0x2669, "Intel Corporation","2028026","jkn " },
-{0x8086, 0x266A, "Intel Corporation","82801BA/CA","SMBus Controller" },
-{0x8086, 0x266C, "Intel Corporation","82801FB/FR/FW/FRW","LAN Controller" },
-{0x8086, 0x266D, "Intel Corporation","czc82809kr","http://www.dell.com/support/drivers/us/en/19/DriverDetails/DriverFileFormats?DriverId=R104087&FileId" },
-{0x8086, 0x266E, "Intel Corporation","Driver audio digitale integrato ADI SoundMAX","Driver audio digitale integrato ADI SoundMAX - HP DV4000" },
-{0x8086, 0x266F, "Intel Corporation","82801FB/FBM/FW/FR/FRW","PATA100 Controller - 266F" },
-{0x8086, 0x2670, "Intel Corporation","631xESB/6321ESB/3100 ","LPC Interface Controller" },
-{0x8086, 0x2678, "Intel Corporation","8280","8280 (ICH6) High Defininition Audio Controller" },
-{0x8086, 0x2680, "Intel Corporation","631x/632x ESB2&3100","SATA Controller(IDE Mode)" },
-{0x8086, 0x2681, "Intel Corporation","62089A2","631xESB/632xESB SATA AHCI Controller" },
-{0x8086, 0x2682, "Intel Corporation","ESB2","Intel(R) ESB2 SATA RAID Controller" },
-{0x8086, 0x269B, "Intel Corporation","631xESB/6321ESB/3100","SMBus Controller" },
-{0x8086, 0x269E, "Intel Corporation","631x/632x ESB2","PATA100 IDE Controller" },
-{0x8086, 0x27, "Intel Corporation","82801G ","ICH7 Family" },
-{0x8086, 0x2770, "Intel Corporation","82945G/GZ/P/PL","Intel(R) 945G/GZ/GC/P/PL Processor to I/O Controller" },
-{0x8086, 0x2771, "Intel Corporation","82945G/GZ/P/PL","Host to PCI Express Bridge" },
-{0x8086, 0x2772, "Intel Corporation","82945G/GZ","PCI\\VEN_8086&DEV_2772&SUBSYS_2A57103C&REV_02\\3&11583659&0&10" },
-{0x8086, 0x2776, "Intel Corporation","82945G","INTEL(R) 82945G EXPRESS FAMILY" },
-{0x8086, 0x277C, "Intel Corporation","82975X","Intel 975X Express Chipset" },
-{0x8086, 0x2780, "Intel Corporation","82915G","Graphics device" },
-{0x8086, 0x2782, "Intel Corporation","82915G","Graphics device: 82915G/GV/910GL Express Chipset Family" },
-{0x8086, 0x2792, "Intel Corporation","038000","Mobile Intel(R) 915GM/GMS/, 910GML Express Chipset Family" },
-{0x8086, 0x2794, "Intel Corporation","945","Mobile chipset" },
-{0x8086, 0x27A0, "Intel Corporation","874079","Mobile Intel(R) 945GM/GU/PM/GMS/940GML/943GML and Intel(R) 945GT Express Processor to DRAM Controlle" },
-{0x8086, 0x27A1, "Intel Corporation","Intel 82945PM Memory Controller","Intel Corporation Mobile 945PM Express PCI Express Root Port" },
-{0x8086, 0x27A2, "Intel Corporation","HPQ0006","Mobile Intel(R) 945 Express Chipset Family" },
-{0x8086, 0x27A6, "Intel Corporation","945GM","Intel 945GM/950" },
-{0x8086, 0x27B8, "Intel Corporation","945GL","Intel(R) ICH7 Family LPC Interface Controller" },
-{0x8086, 0x27B9, "Intel Corporation","ICH7","Intel(R) ICH7M/U LPC Interface Controller" },
-{0x8086, 0x27BC, "Intel Corporation","NM10","NM10 Family LPC Interface Controller" },
-{0x8086, 0x27c0, "Intel Corporation","82801GB/GR/GH","Intel(R) N10/ICH7 Family Serial ATA Storage Controller" },
-{0x8086, 0x27C1, "Intel Corporation","82801GB/GR/GH","AHCI Controller" },
-{0x8086, 0x27c3, "Intel Corporation","82801GR/GH","Raid Controller" },
-{0x8086, 0x27c4, "Intel Corporation","82801GBM/GHM","SATA IDE Controller" },
-{0x8086, 0x27C5, "Intel Corporation","82801GBM/GHM","Intel(R) ICH7/M/MDH SATA AHCI Controller" },
-{0x8086, 0x27C6, "Intel Corporation","82801GHM","Raid Controller" },
-{0x8086, 0x27c8, "Intel Corporation","946","Intel(R) N10/ICH7 Family USB Universal Host Controller" },
-{0x8086, 0x27c9, "Intel Corporation","USB UHCI Controller","Intel(R) N10/ICH7 Family USB Universal Host Controller" },
-{0x8086, 0x27CA, "Intel Corporation","ICH7","Intel(R) N10/ICH7 Family USB Universal Host Controller" },
-{0x8086, 0x27CB, "Intel Corporation","ICH7","Intel(R) N10/ICH7 Family USB Universal Host Controller" },
-{0x8086, 0x27CC, "Intel Corporation","82801G","Intel(R) N10/ICH7 Family USB2 Enhanced Host Controller" },
-{0x8086, 0x27D0, "Intel Corporation","82801G","Intel(R) 82801G (ICH7 Family) PCI Express Root Port" },
-{0x8086, 0x27D2, "Intel Corporation","82801G","Intel(R) 82801G (ICH7 Family) PCI Express Root Port" },
-{0x8086, 0x27D4, "Intel Corporation","ICH7","Intel(R) N10/ICH7 Family PCI Express Root Port" },
-{0x8086, 0x27d8, "Intel Corporation","27D8","UAA Bus Driver for HD Audio" },
-{0x8086, 0x27D9, "Intel Corporation","A62516F3","IDT High Definition Audio Driver	" },
-{0x8086, 0x27DA, "Intel Corporation","82801G","Intel(R) N10/ICH7 Family SMBus Controller" },
-{0x8086, 0x27DC, "Intel Corporation","336C1462","Intel® PRO/100 VE Desktop Adapter" },
-{0x8086, 0x27DE, "Intel Corporation","RTL8100C","AUDIO (ALC850) << Realtek " },
-{0x8086, 0x27df, "Intel Corporation","82801GB/GBM","Intel(R) ICH7 Family Ultra ATA Storage Controller" },
-{0x8086, 0x2802, "Intel Corporation","8086","INTEL(R) HIGH DEFINITION AUDIO HDMI" },
-{0x8086, 0x2803, "Intel Corporation","0111","Intel(R) High Definition Audio HDMI Service" },
-{0x8086, 0x2804, "Intel Corporation","80860101","IntcDAudModel" },
-{0x8086, 0x2807, "Intel Corporation","Intel HD Audio","Intel HDMI Audio Chip" },
-{0x8086, 0x2812, "Intel Corporation","2812","Intel(R) ICH8DH LPC Interface Controller" },
-{0x8086, 0x2815, "Intel Corporation","902D104D","Intel(R) ICH8M LPC Interface Controller - 2815 Driver" },
-{0x8086, 0x2820, "Intel Corporation","82801HB/HR/HH/HO","SATA IDE Controller:4 port" },
-{0x8086, 0x2821, "Intel Corporation","82821HR/HH/HO","AHCI Controller" },
-{0x8086, 0x2822, "Intel Corporation","82801HR/HH/HO&82801IR/IH/IO(AIE=0)/ICH10R","Raid Controller" },
-{0x8086, 0x2824, "Intel Corporation","82801HB","ICH8 AHCI Controller" },
-{0x8086, 0x2825, "Intel Corporation","82801IIH","Intel Q35" },
-{0x8086, 0x2828, "Intel Corporation","82801HBM/HEM","SATA IDE Controller" },
-{0x8086, 0x2829, "Intel Corporation","82801HBM","Intel(R) ICH8M SATA AHCI Controller" },
-{0x8086, 0x282A, "Intel Corporation","ICH8M/9M/ICH10M/i5M","Raid Controller" },
-{0x8086, 0x2830, "Intel Corporation","2830","Intel(R) ICH8 Family USB Universal Host Controller" },
-{0x8086, 0x2831, "Intel Corporation","2831","Intel(R) ICH8 Family USB Universal Host Controller" },
-{0x8086, 0x2832, "Intel Corporation","2832","Intel(R) ICH8 Family USB Universal Host Controller" },
-{0x8086, 0x2834, "Intel Corporation","2834","Intel(R) ICH8 Family USB Universal Host Controller" },
-{0x8086, 0x2835, "Intel Corporation","2835","Intel(R) ICH8 Family USB Universal Host Controller" },
-{0x8086, 0x2836, "Intel Corporation","2836","Intel(R) ICH8 Family USB2 Enhanced Host Controller" },
-{0x8086, 0x283A, "Intel Corporation","81EC1043 (?)","ICH8 Family USB2 Enhanced Host Controller" },
-{0x8086, 0x283E, "Intel Corporation","PCI\\VEN_8086&DEV_283E&SUBSYS_20A917AA&REV_03\\3&B1B","Intel(R) ICH8 Family SMBus Controller" },
-{0x8086, 0x283F, "Intel Corporation","283F","Intel(R) ICH8 Family PCI Express Root Port" },
-{0x8086, 0x284, "Intel Corporation","888","Microsoft UAA bus for HD audio" },
-{0x8086, 0x2841, "Intel Corporation","ICH8","Intel(R) ICH8 Family PCI Express Root Port" },
-{0x8086, 0x2843, "Intel Corporation","ICH8","Intel(R) ICH8 Family PCI Express Root Port" },
-{0x8086, 0x2845, "Intel Corporation","ICH8","Intel(R) ICH8 Family PCI Express Root Port" },
-{0x8086, 0x2847, "Intel Corporation","2847","Intel(R) ICH8 Family PCI Express Root Port" },
-{0x8086, 0x284B, "Intel Corporation","888","Microsoft UAA bus for HD audio" },
-{0x8086, 0x2850, "Intel Corporation","82801HBM/HEM","Intel(R) ICH8M Ultra ATA Storage Controller" },
-{0x8086, 0x2880, "Intel Corporation","0000000","Intel Display Audio" },
-{0x8086, 0x2888, "Intel Corporation","Q945","Q945" },
-{0x8086, 0x2914, "Intel Corporation","ICH9D0","LPC bridge of ICH9" },
-{0x8086, 0x2916, "Intel Corporation","3","PCI Simple Communications-Controller " },
-{0x8086, 0x2918, "Intel Corporation","ATK0110 driver for WindowsXP/Vista/Win7 32&64-bit","http://dlcdnet.asus.com/pub/ASUS/misc/utils/MB_WIN7_ATK.ZIP" },
-{0x8086, 0x2919, "Intel Corporation","ICH9M","Intel(R) ICH9M/M-E Family 4 Port SATA AHCI Controller" },
-{0x8086, 0x2920, "Intel Corporation","82801(IB)/IR/IH/IO","SATA IDE Controller:4 port" },
-{0x8086, 0x2921, "Intel Corporation","82801IR/IH/IO","SATA IDE Controller:2 port1" },
-{0x8086, 0x2922, "Intel Corporation","82801IR/IH/IO","AHCI Controller" },
-{0x8086, 0x2923, "Intel Corporation","82801IB","ICH9 AHCI Controller" },
-{0x8086, 0x2925, "Intel Corporation","82801IR/IH/IO(AIE=1)","Raid Controller" },
-{0x8086, 0x2926, "Intel Corporation","82801IR/IH/IO","SATA IDE Controller:2 port2" },
-{0x8086, 0x2928, "Intel Corporation","?(ICH9M Family)","SATA IDE Controller:2port1" },
-{0x8086, 0x2929, "Intel Corporation","ICH9M/ME","ICH9M/ME AHCI Controller" },
-{0x8086, 0x292D, "Intel Corporation","?(ICH9M Family)","SATA IDE Controller:2port2" },
-{0x8086, 0x292E, "Intel Corporation","?(ICH9M Family)","SATA IDE Controller:1port2" },
-{0x8086, 0x2930, "Intel Corporation","8086","2930" },
-{0x8086, 0x2930, "Intel Corporation","Intel ICH9 Family SMBus Controller","Intel ICH9 Family SMBus Controller" },
-{0x8086, 0x2932, "Intel Corporation","ICH9","Intel(R) ICH9 Family Thermal Subsystem" },
-{0x8086, 0x2934, "Intel Corporation","ICH9","Intel(R) ICH9 Family USB Universal Host Controller" },
-{0x8086, 0x2935, "Intel Corporation","ICH9","Intel(R) ICH9 Family USB Universal Host Controller" },
-{0x8086, 0x2936, "Intel Corporation","0x02141028","Intel(R) ICH9 Family USB Univeral Host Controller" },
-{0x8086, 0x2937, "Intel Corporation","ICH9","Intel(R) ICH9 Family USB Universal Host Controller" },
-{0x8086, 0x2938, "Intel Corporation","ICH9","Intel(R) ICH9 Family USB Universal Host Controller" },
-{0x8086, 0x2939, "Intel Corporation","ICH9","Intel(R) ICH9 Family USB Universal Host Controller" },
-{0x8086, 0x293A, "Intel Corporation","ICH9","Intel(R) ICH9 Family USB2 Enhanced Host Controller" },
-{0x8086, 0x293C, "Intel Corporation","ICH9","Intel(R) ICH9 Family USB2 Enhanced Host Controller" },
-{0x8086, 0x293E, "Intel Corporation","486486 ","82801IB/IR/IH (ICH9 Family) HD Audio Controller" },
-{0x8086, 0x293E, "Intel Corporation","486486","82801IB/IR/IH (ICH9 Family) HD Audio Controller" },
-{0x8086, 0x2940, "Intel Corporation","ICH9","Intel(R) ICH9 Family PCI Express Root Port" },
-{0x8086, 0x2942, "Intel Corporation","ICH9","Intel(R) ICH9 Family PCI Express Root Port" },
-{0x8086, 0x2944, "Intel Corporation","ICH9","Intel(R) ICH9 Family PCI Express Root Port" },
-{0x8086, 0x2948, "Intel Corporation","ICH9","Intel(R) ICH9 Family PCI Express Root Port" },
-{0x8086, 0x294C, "Intel Corporation","82566DC-2","Intel(R) 82566DC-2 Gigabit Network Connection" },
-{0x8086, 0x2972, "Intel Corporation","82946GZ ","Onboard Video Device for 82946GZ chips" },
-{0x8086, 0x2986, "Intel Corporation","265452","Intel" },
-{0x8086, 0x2987, "Intel Corporation","Q965/Q963","Intel PCI Serial Port" },
-{0x8086, 0x2992, "Intel Corporation","Q965/Q963","Intel(R) Express Chipset video" },
-{0x8086, 0x2993, "Intel Corporation","G965","Intel(R) Express Chipset Dell Version" },
-{0x8086, 0x2994, "Intel Corporation","2802103C","Intel Management Engine Interface (HECI)" },
-{0x8086, 0x2996, "Intel Corporation","Q963/Q965","IDE Controller" },
-{0x8086, 0x2997, "Intel Corporation","Q965/Q963","PCI Serial Port" },
-{0x8086, 0x29a0, "Intel Corporation","?(82P965)","Intel P965/G965 Processor to I/O Controller" },
-{0x8086, 0x29a1, "Intel Corporation","?(82Q965, 82G965, 82P965)","Intel P965/G965 PCI Express Root Port" },
-{0x8086, 0x29A2, "Intel Corporation","Intel 82G965 Graphics and Memory Controller Hub (G","Intel 82G965 Graphics and Memory Controller Hub (GMCH)" },
-{0x8086, 0x29A4, "Intel Corporation","86881","" },
-{0x8086, 0x29A6, "Intel Corporation","G965","IDE Controller" },
-{0x8086, 0x29B2, "Intel Corporation","Q35","Intel(R) Q35 Express Chipset Family" },
-{0x8086, 0x29B3, "Intel Corporation","Q35","Intel Graphics" },
-{0x8086, 0x29B4, "Intel Corporation","Q35-Chipset","Intel® ME: Management Engine" },
-{0x8086, 0x29B6, "Intel Corporation","Q35","IDE Controller" },
-{0x8086, 0x29B7, "Intel Corporation","Q35-Chipset","Serial Over LAN" },
-{0x8086, 0x29C2, "Intel Corporation","8086","Intel(R) G33 chipset GMA3100 video Driver" },
-{0x8086, 0x29C4, "Intel Corporation","Intel DG33BU","Intel ME: Management Engine Interface" },
-{0x8086, 0x29C6, "Intel Corporation","G3x","IDE Controller" },
-{0x8086, 0x29D4, "Intel Corporation","281e103c","Intel Management Interface" },
-{0x8086, 0x29D6, "Intel Corporation","Q33","IDE Controller" },
-{0x8086, 0x29E6, "Intel Corporation","x48","IDE Controller" },
-{0x8086, 0x29F6, "Intel Corporation","32xx","IDE Controller" },
-{0x8086, 0x2A00, "Intel Corporation","PM965","Mobile Intel(R) PM965/GM965/GL960/GS965 Express Processor to DRAM Controller" },
-{0x8086, 0x2A02, "Intel Corporation","88B31033","Intel GM965, Intel X3100" },
-{0x8086, 0x2A03, "Intel Corporation","82Q965","Mobile Intel(R) 965 Express Chipset Family" },
-{0x8086, 0x2A04, "Intel Corporation","Q965/Q96","Intel PCI communication controller-Intel Management Engine Interface update" },
-{0x8086, 0x2A06, "Intel Corporation","965PM","IDE Controller" },
-{0x8086, 0x2A07, "Intel Corporation","Q965/Q963","Intel PCI Serial Port" },
-{0x8086, 0x2A08, "Intel Corporation","Q965 Chipset","Intel(R) Extended Thermal Model MCH" },
-{0x8086, 0x2A12, "Intel Corporation","965","Mobile Intel(R) 965 Express Chipset Family" },
-{0x8086, 0x2A16, "Intel Corporation","96xMG","IDE Controller" },
-{0x8086, 0x2A40, "Intel Corporation","2A40","Mobile Intel(R) 4 Series Chipset Processor to DRAM Controller" },
-{0x8086, 0x2A42, "Intel Corporation","Mobile Intel 4 Series Chipset Family","Intel Mobile Graphic" },
-{0x8086, 0x2A43, "Intel Corporation","Mobile Intel 4 Series Chipset Family","Intel Mobile Graphic" },
-{0x8086, 0x2A44, "Intel Corporation","Mobile 4 Series Chipset","IC658" },
-{0x8086, 0x2A46, "Intel Corporation","M4x","IDE Controller" },
-{0x8086, 0x2a47, "Intel Corporation","20EC17AA","Active Management Technology - SOL" },
-{0x8086, 0x2A52, "Intel Corporation","Cantiga","IDE Controller" },
-{0x8086, 0x2C62, "Intel Corporation","2C62","QuickPath Architecture Generic Non-core Registers" },
-{0x8086, 0x2D01, "Intel Corporation","2D01","QuickPath Architecture System Address Decoder" },
-{0x8086, 0x2D10, "Intel Corporation","2D10","QPI Link" },
-{0x8086, 0x2D11, "Intel Corporation","2D11","QPI Physical" },
-{0x8086, 0x2E06, "Intel Corporation","4x","IDE Controller" },
-{0x8086, 0x2E12, "Intel Corporation","-","Intel Q45/Q43 Express Chipset" },
-{0x8086, 0x2e13, "Intel Corporation","Intel Q43/Q45/G43/G45 (Eaglelake) Graphics Control","Intel(R) 4 Series Internal Chipset" },
-{0x8086, 0x2E14, "Intel Corporation","PCI\\VEN_8086&DEV_2E14","Intel Management Engine Interface (HECI)" },
-{0x8086, 0x2E15, "Intel Corporation","PCI\\VEN_8086&DEV_29C2&SUBSYS_29C28086&REV_10\\3&115","Intel AMT LMS_SOL for AMT 5.xx" },
-{0x8086, 0x2E16, "Intel Corporation","4x","IDE Controller" },
-{0x8086, 0x2E17, "Intel Corporation","3646103C","Intel AMT LMS_SOL for AMT 5.xx" },
-{0x8086, 0x2E24, "Intel Corporation","pci\\VEN 8086&DEV_3B64&subsys _ 76361462&rev _06","pci simple communications controller" },
-{0x8086, 0x2E26, "Intel Corporation","4x","IDE Controller" },
-{0x8086, 0x2e29, "Intel Corporation","2e29","Intel(R) 4 Series Chipset PCI Express Root Port - 2E29" },
-{0x8086, 0x2E30, "Intel Corporation","2E30","Intel(R) 4 Series Chipset Processor to I/O Controller" },
-{0x8086, 0x2E32, "Intel Corporation","PCI\\VEN_8086&DEV_2E32&SUBSYS_31031565&REV_03","Intel G41 express graphics" },
-{0x8086, 0x2E33, "Intel Corporation","G41TY EXPRESS CHIPSET","ghaphics chipset g41TY" },
-{0x8086, 0x2E46, "Intel Corporation","4x","IDE Controller" },
-{0x8086, 0x2E96, "Intel Corporation","4x","IDE Controller" },
-{0x8086, 0x2f00, "Intel Corporation","815B104D","multimedia audio device (codec AC97) SoundMAX or VIA" },
-{0x8086, 0x3092, "Intel Corporation","SRCU32","I2O 1.5 RAID Controller" },
-{0x8086, 0x3200, "Intel Corporation","31244","PCI-X to Serial ATA Controller" },
-{0x8086, 0x3252, "Intel Corporation","2802103","SUBSYS" },
-{0x8086, 0x3340, "Intel Corporation","82855PM","Host-Hub Interface Bridge" },
-{0x8086, 0x3341, "Intel Corporation","82855PM","AGP Bridge" },
-{0x8086, 0x3342, "Intel Corporation","82855PM","Power Management" },
-{0x8086, 0x3400, "Intel Corporation","3400","Intel(R) 5520/5500/X58 I/O Hub to ESI Port" },
-{0x8086, 0x3408, "Intel Corporation","7500","Intel(R) 7500/5520/5500/X58 I/O Hub PCI Express Root Port" },
-{0x8086, 0x3409, "Intel Corporation","7500","Intel 7500 Chipset PCIe Root Port" },
-{0x8086, 0x340A, "Intel Corporation","7500","Intel(R) 7500/5520/5500/X58 I/O Hub PCI Express Root Port" },
-{0x8086, 0x340B, "Intel Corporation","7500","Intel 7500 Chipset PCIe Root Port" },
-{0x8086, 0x340C, "Intel Corporation","7500","Intel 7500 Chipset PCIe Root Port" },
-{0x8086, 0x340E, "Intel Corporation","7500","Intel(R) 7500/5520/5500/X58 I/O Hub PCI Express Root Port" },
-{0x8086, 0x3410, "Intel Corporation","7500","Intel 7500 Chipset PCIe Root Port" },
-{0x8086, 0x3422, "Intel Corporation","3422","Intel(R) 7500/5520/5500/X58 I/O Hub GPIO and Scratch Pad Registers" },
-{0x8086, 0x3423, "Intel Corporation","The Intel® Server RAID Controller U2-1 (SRCU21) an","SRCU21/SRCU31 Microsoft Windows* 2000 Memory Management Files" },
-{0x8086, 0x342E, "Intel Corporation","7500","Intel(R) 7500/5520/5500/X58 I/O Hub System Management Registers" },
-{0x8086, 0x3438, "Intel Corporation","7500","Intel(R) 7500/5520/5500/X58 I/O Hub Throttle Registers" },
-{0x8086, 0x3463, "Intel Corporation","PCI\\VEN_14E4&DEV_1692&SUBSYS_04831025&REV_01","NTPNP_PCI0002" },
-{0x8086, 0x3464, "Intel Corporation","22","NTPNP_PCI0002" },
-{0x8086, 0x3465, "Intel Corporation","PCI\\VEN_14E4&DEV_1692&SUBSYS_04831025&REV_01","NTPNP_PCI0002" },
-{0x8086, 0x348D, "Intel Corporation","82541EI","Gigabit Ethernet Controller" },
-{0x8086, 0x34c5, "Intel Corporation","82801DBM SoundMAXController (ICH4-M B0 step)","Realtek AC97 (NOT an intel)" },
-{0x8086, 0x3575, "Intel Corporation","82830[MP]","Host-Hub I/F Bridge / SDRAM Controller" },
-{0x8086, 0x3576, "Intel Corporation","82830M/MP","Host-AGP Bridge" },
-{0x8086, 0x3577, "Intel Corporation","82830vm","Integrated Graphics Device" },
-{0x8086, 0x3578, "Intel Corporation","82830[MP]","CPU to I/O Bridge" },
-{0x8086, 0x3579, "Intel Corporation","82835","SDRAM Controller / Host-hub Interface" },
-{0x8086, 0x357B, "Intel Corporation","82835","Integrated Graphics Device" },
-{0x8086, 0x3580, "Intel Corporation","852GM/GMV","Host-Hub Interface Bridge" },
-{0x8086, 0x3581, "Intel Corporation","82852GME/PM","Virtual PCI to AGP Bridge" },
-{0x8086, 0x3582, "Intel Corporation","852GM/GMV or 82852/82855 GM/GME","Integrated Graphics Device" },
-{0x8086, 0x3584, "Intel Corporation","852GM/GMV","System Memory Controller" },
-{0x8086, 0x3585, "Intel Corporation","852GM","Configuration Process" },
-{0x8086, 0x3590, "Intel Corporation","E7520","Memory Controller Hub" },
-{0x8086, 0x3591, "Intel Corporation","E7520","Memory Controller Hub" },
-{0x8086, 0x3592, "Intel Corporation","E7320","Memory Controller Hub" },
-{0x8086, 0x3593, "Intel Corporation","E7320","MCH Error Reporting Registers" },
-{0x8086, 0x3594, "Intel Corporation","E7520","DMA Controller Registers" },
-{0x8086, 0x3595, "Intel Corporation","E7525","PCI Express Port A" },
-{0x8086, 0x3596, "Intel Corporation","E7525","PCI Express Port B" },
-{0x8086, 0x3597, "Intel Corporation","E7525","PCI Express Port B" },
-{0x8086, 0x3598, "Intel Corporation","E7520","PCI Express Port B1" },
-{0x8086, 0x3599, "Intel Corporation","E7520","PCI Express Port C" },
-{0x8086, 0x359A, "Intel Corporation","E7520","PCI Express Port C1" },
-{0x8086, 0x359B, "Intel Corporation","E7525","Extended Configuration Registers" },
-{0x8086, 0x359E, "Intel Corporation","E7525","MCH Control Registers" },
-{0x8086, 0x360B, "Intel Corporation","PCI\\VEN_8086&DEV_2994&SUBSYS_13E910","intel simple communication controller" },
-{0x8086, 0x3A00, "Intel Corporation","ICH10 Family","ICH10 4 port SATA IDE Controller" },
-{0x8086, 0x3A02, "Intel Corporation","82801JD","ICH10D SATA Controller" },
-{0x8086, 0x3A03, "Intel Corporation","ICH10","ICH10 AHCI" },
-{0x8086, 0x3A05, "Intel Corporation","82801JD","ICH10D SATA Controller" },
-{0x8086, 0x3A06, "Intel Corporation","ICH10 Family","SATA2(2Port1)" },
-{0x8086, 0x3A14, "Intel Corporation","82801JDO","82801JDO ICH10DO" },
-{0x8086, 0x3A16, "Intel Corporation","ICH10R","Intel(R) ICH10R LPC Interface Controller" },
-{0x8086, 0x3A1A, "Intel Corporation","82801JD","82801JD ICH10D" },
-{0x8086, 0x3A20, "Intel Corporation","ICH10 Family","Intel(R) ICH10 Family 4 port Serial ATA Storage Controller" },
-{0x8086, 0x3A22, "Intel Corporation","ICH10R","AHCI Controller" },
-{0x8086, 0x3A23, "Intel Corporation","ICH10","ICH10 AHCI" },
-{0x8086, 0x3A26, "Intel Corporation","ICH10 Family","Intel(R) ICH10 Family 2 port Serial ATA Storage Controller" },
-{0x8086, 0x3A30, "Intel Corporation","50011458","INTEL(R) ICH10 Family SMB controller " },
-{0x8086, 0x3A34, "Intel Corporation","ICH10","Intel(R) ICH10 Family USB Universal Host Controller" },
-{0x8086, 0x3A35, "Intel Corporation","ICH10","Intel(R) ICH10 Family USB Universal Host Controller" },
-{0x8086, 0x3A36, "Intel Corporation","ICH10","Intel(R) ICH10 Family USB Universal Host Controller" },
-{0x8086, 0x3A37, "Intel Corporation","ICH10","Intel(R) ICH10 Family USB Universal Host Controller" },
-{0x8086, 0x3A38, "Intel Corporation","ICH10","Intel(R) ICH10 Family USB Universal Host Controller" },
-{0x8086, 0x3A39, "Intel Corporation","ICH10","Intel(R) ICH10 Family USB Universal Host Controller" },
-{0x8086, 0x3A3A, "Intel Corporation","ICH10","Intel(R) ICH10 Family USB Universal Host Controller" },
-{0x8086, 0x3A3C, "Intel Corporation","ICH10","Intel(R) ICH10 Family USB Enhanced Host Controller" },
-{0x8086, 0x3A3E, "Intel Corporation","Microsoft UAA Bus Driver for High Definition Audio","Microsoft UAA Bus Driver for High Definition Audio" },
-{0x8086, 0x3A40, "Intel Corporation","ICH10","Intel(R) ICH10 Family PCI Express Root Port" },
-{0x8086, 0x3A42, "Intel Corporation","ICH10","Intel(R) ICH10 Family PCI Express Root Port" },
-{0x8086, 0x3a60, "Intel Corporation","ICH10","SM-Bus Controller" },
-{0x8086, 0x3B00, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B01, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B02, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B03, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B06, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B07, "Intel Corporation","3B07","Intel(R) 5/3400 Series Chipset LPC Interface Controller" },
-{0x8086, 0x3B08, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B09, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B0A, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B0B, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B0D, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B0F, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B12, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B14, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B16, "Intel Corporation","Intel(R) 5 Series/3400 Series Chipset Family","LPC Interface Controller" },
-{0x8086, 0x3B20, "Intel Corporation","PCH (Ibex P","SATA IDE 4-Port Desktop" },
-{0x8086, 0x3B21, "Intel Corporation","PCH (Ibex Peak)","SATA IDE 2-Port Desktop" },
-{0x8086, 0x3B22, "Intel Corporation","PCH (Ibex Peak)","SATA AHCI 6-Port Desktop" },
-{0x8086, 0x3B23, "Intel Corporation","PCH (Ibex Peak)","SATA AHCI 4-Port Desktop" },
-{0x8086, 0x3B24, "Intel Corporation","PCH","SATA Enhanced RAID" },
-{0x8086, 0x3B25, "Intel Corporation","PCH","SATA Raid Controller" },
-{0x8086, 0x3B26, "Intel Corporation","PCH (Ibex Peak)","SATA IDE 2-Port Secondary Desktop" },
-{0x8086, 0x3B28, "Intel Corporation","PCH (Ibex Peak)","SATA IDE 4-Port Mobile" },
-{0x8086, 0x3B29, "Intel Corporation","PCH (Ibex Peak)","SATA AHCI 4-Port Mobile" },
-{0x8086, 0x3B2B, "Intel Corporation","PCHM","SATA Enhanced RAID" },
-{0x8086, 0x3B2C, "Intel Corporation","PCHM","SATA Raid Controller" },
-{0x8086, 0x3B2D, "Intel Corporation","PCHM","SATA IDE Controller:2 port" },
-{0x8086, 0x3B2E, "Intel Corporation","PCH (Ibex Peak)","SATA IDE 4-Port Mobile" },
-{0x8086, 0x3B2F, "Intel Corporation","PCH (Ibex Peak)","Intel(R) 5/3400 Series Chipset Family 6 Port SATA AHCI Controller" },
-{0x8086, 0x3B30, "Intel Corporation","3B30","Intel(R) 5/3400 Series Chipset Family SMBus Controller" },
-{0x8086, 0x3B32, "Intel Corporation","3B64","Intel(R) 5/3400 Series Chipset Family Thermal Subsystem" },
-{0x8086, 0x3B34, "Intel Corporation","3B34","Standard Enhanced PCI to USB Host Controller" },
-{0x8086, 0x3B3C, "Intel Corporation","3B3C","Standard Enhanced PCI to USB Host Controller" },
-{0x8086, 0x3B42, "Intel Corporation","3B42","Intel(R) 5/3400 Series Chipset Family PCI Express Root Port" },
-{0x8086, 0x3B44, "Intel Corporation","3B44","Intel(R) 5/3400 Series Chipset Family PCI Express Root Port" },
-{0x8086, 0x3B46, "Intel Corporation","3B46","Intel(R) 5/3400 Series Series Chipset Family PCI Express Root Port" },
-{0x8086, 0x3B48, "Intel Corporation","3B48","Intel(R) 5/3400 Series Chipset Family PCI Express Root Port" },
-{0x8086, 0x3B56, "Intel Corporation","3B56","High Definition Audio Controller" },
-{0x8086, 0x3b63, "Intel Corporation","ff1e1179","06" },
-{0x8086, 0x3B64, "Intel Corporation","3B64","Management Engine Driver" },
-{0x8086, 0x3b65, "Intel Corporation","ff1e1179","06" },
-{0x8086, 0x3B67, "Intel Corporation","Vendor ID 0x8086 ","Intel(R) Active Management Technology - Serial Over LAN (SOL) " },
-{0x8086, 0x4000, "Intel Corporation","Creatix","V.90 HaM Modem" },
-{0x8086, 0x402f, "Intel Corporation","-","Intel (R) 5400 Chipset QuickData Technology device - 402F" },
-{0x8086, 0x4220, "Intel Corporation","Intel Pro/Wireless 2200BG","Intel 54 MBit/s Notebook WLAN Card" },
-{0x8086, 0x4222, "Intel Corporation","10208086","Intel 3945ABG Wireless LAN controller" },
-{0x8086, 0x4223, "Intel Corporation","2915ABG","Intel (R) PRO/Wireless 2200BG Network Connection, (R) PRO/Wireless 2915ABG Network Connection" },
-{0x8086, 0x4224, "Intel Corporation","Intel Pro Wireless 2915ABG","802.11a/b/g WLan adapter" },
-{0x8086, 0x4227, "Intel Corporation","3945ABG","Intel(R) PRO/Wireless 3945ABG" },
-{0x8086, 0x4229, "Intel Corporation","Intel 4965AGN","Intel® Wireless WiFi Link 4965AGN(supporting 802.11a/b/g/Draft-N)" },
-{0x8086, 0x422B, "Intel Corporation"," ","Intel(R) Centrino(R) Ultimate-N 6300 AGN" },
-{0x8086, 0x422C, "Intel Corporation","BCM4311KFBG","Intel(R) Centrino(R) Advanced-N 6200 AGN" },
-{0x8086, 0x422D, "Intel Corporation","Intel 4965AGN","Intel® Wireless WiFi Link 4965AGN" },
-{0x8086, 0x4230, "Intel Corporation","Intel 4965AGN","Intel® Wireless WiFi Link 4965AGN" },
-{0x8086, 0x4232, "Intel Corporation","Intel® WiFi Link 5100","Carte Intel® WiFi Link 5100 AGN" },
-{0x8086, 0x4233, "Intel Corporation","Intel 4965AGN","Intel® Wireless WiFi Link 4965AGN" },
-{0x8086, 0x4235, "Intel Corporation","5300AGN","Intel® WiFi Link 5300 AGN" },
-{0x8086, 0x4236, "Intel Corporation","5300AGN","Intel(R) WiFi Link 5300 AGN" },
-{0x8086, 0x4237, "Intel Corporation","27DA","Intel (R) WiFi Link 5100 AGN" },
-{0x8086, 0x4238, "Intel Corporation","6300","Intel Centrino Ultimate-N 6300 AGN" },
-{0x8086, 0x4239, "Intel Corporation","0x4239","Intel(R) Centrino(R) Advanced-N 6200 AGN" },
-{0x8086, 0x423A, "Intel Corporation","5350AGN","PRO/Wireless 5350 AGN [Echo Peak]" },
-{0x8086, 0x423C, "Intel Corporation","5150AGN","WiMAX/WiFi Link 5150" },
-{0x8086, 0x4318, "Intel Corporation","1370 (0280)","Dell Wireless 1370 WLAN Mini-PCI Card" },
-{0x8086, 0x444E, "Intel Corporation","TurboMemory","Intel TurboMemory" },
-{0x8086, 0x4813, "Intel Corporation","1370 (0280)","Dell Wireless 1370 WLAN Mini-PCI Card" },
-{0x8086, 0x482, "Intel Corporation","82375MB","PCI\\VEN8086" },
-{0x8086, 0x4836, "Intel Corporation","242121","2425678" },
-{0x8086, 0x4888, "Intel Corporation","3945","intel 3945abg wireless lan controller" },
-{0x8086, 0x5001, "Intel Corporation","\\Device\\0000004c","Modem - PPP" },
-{0x8086, 0x5005, "Intel Corporation","PRO/DSL 2200","Modem - PPPoA" },
-{0x8086, 0x5029, "Intel Corporation","?(EP80579)","AHCI Controller" },
-{0x8086, 0x502A, "Intel Corporation","Tolaoai","SATA Controller" },
-{0x8086, 0x502B, "Intel Corporation","Tolapai","SATA Controller" },
-{0x8086, 0x5200, "Intel Corporation","NH82801GR","PCI to PCI Bridge" },
-{0x8086, 0x5201, "Intel Corporation","i960","Network Controller" },
-{0x8086, 0x5309, "Intel Corporation","80303","I/O Processor Address Translation Unit" },
-{0x8086, 0x530D, "Intel Corporation","80312","I/O Companion Unit Address Translation" },
-{0x8086, 0x6741, "Intel Corporation","0x8086","Intel USB 3.0" },
-{0x8086, 0x6960, "Intel Corporation","","EHCI 960 emulator" },
-{0x8086, 0x7000, "Intel Corporation","82371SB","PIIX3 PCI-to-ISA Bridge (Triton II)" },
-{0x8086, 0x7010, "Intel Corporation","82371SB","PIIX3 IDE Interface (Triton II)" },
-{0x8086, 0x7020, "Intel Corporation","82371SB","PIIX3 USB Host Controller (Triton II)" },
-{0x8086, 0x7030, "Intel Corporation","82437VX","System Controller" },
-{0x8086, 0x7051, "Intel Corporation","PB 642365-003","Intel Business Video Conferencing Card" },
-{0x8086, 0x7100, "Intel Corporation","82439TX","System Controller (MTXC), part of 430TX chipset" },
-{0x8086, 0x7110, "Intel Corporation","82371AB/EB/MB","Intel 82371AB/EB PCI to ISA bridge (ISA mode)" },
-{0x8086, 0x7111, "Intel Corporation","82371AB/EB/MB","Intel(R) 82371AB/EB PCI Bus Master IDE Controller" },
-{0x8086, 0x7112, "Intel Corporation","82371AB/EB/MB","PIIX4/4E/4M USB Interface" },
-{0x8086, 0x7113, "Intel Corporation","82371AB/EB/MB","PIIX4/4E/4M Power Management Controller" },
-{0x8086, 0x7120, "Intel Corporation","Intel(R) 82801IMB","Host-Hub Interface Bridge / DRAM Ctrlr" },
-{0x8086, 0x7121, "Intel Corporation","801F104","Graphics Controller" },
-{0x8086, 0x7122, "Intel Corporation","82810-DC100","Host-Hub Interface Bridge / DRAM Ctrlr" },
-{0x8086, 0x7123, "Intel Corporation","82810-DC100","IntelÂ® 82810 Graphics Controller" },
-{0x8086, 0x7123, "Intel Corporation","82810-DC100","Intel® 82810 Graphics Controller" },
-{0x8086, 0x7124, "Intel Corporation","82810E","Host-Hub Interface Bridge / DRAM Ctrlr" },
-{0x8086, 0x7125, "Intel Corporation","82810E","Intel Direct AGP 810Chipset " },
-{0x8086, 0x7126, "Intel Corporation","82810-DC133","Host Bridge and Memory Controller Hub" },
-{0x8086, 0x7127, "Intel Corporation","82810-DC133","Graphics Device (FSB 133 MHz)" },
-{0x8086, 0x7128, "Intel Corporation","82810-M DC-100","Host Bridge and Memory Controller Hub" },
-{0x8086, 0x712A, "Intel Corporation","82810-M DC-133","Host Bridge and Memory Controller Hub" },
-{0x8086, 0x7180, "Intel Corporation","rmc","Host/PCI bridge in 440LX/EX AGP chipset" },
-{0x8086, 0x7181, "Intel Corporation","82443 ex/lx","AGP device in 440LX/EX AGP chipset" },
-{0x8086, 0x7182, "Intel Corporation","440LX/EX","intel" },
-{0x8086, 0x7190, "Intel Corporation","82443BX/ZX","Intel 82443BX Pentium(R) II Processor to PCI Bridge" },
-{0x8086, 0x7191, "Intel Corporation","82443BX/ZX","Intel 82443BX Pentium(R) II Processor to AGP Controller" },
-{0x8086, 0x7192, "Intel Corporation","82443BX/ZX","440BX/ZX chipset Host-to-PCI Bridge" },
-{0x8086, 0x7194, "Intel Corporation","82443MX","AC'97 Audio device" },
-{0x8086, 0x7195, "Intel Corporation","82443MX","AC97 Audio Controller" },
-{0x8086, 0x7196, "Intel Corporation","82440 - 443MX","AC97 Modem Controller (Winmodem)" },
-{0x8086, 0x7198, "Intel Corporation","82443MX","PCI to ISA Bridge" },
-{0x8086, 0x7199, "Intel Corporation","82443MX","EIDE Controller" },
-{0x8086, 0x719A, "Intel Corporation","82443MX","USB Universal Host Controller" },
-{0x8086, 0x719B, "Intel Corporation","82443MX","Power Management Controller" },
-{0x8086, 0x71A0, "Intel Corporation","82443GX","Host-to-PCI Bridge" },
-{0x8086, 0x71A1, "Intel Corporation","intel 82801 IB ICH9 ","fabricated by Intel " },
-{0x8086, 0x71A2, "Intel Corporation","82443GX","Host-to-PCI Bridge" },
-{0x8086, 0x7221, "Intel Corporation","82810","graphics device" },
-{0x8086, 0x7600, "Intel Corporation","82372FB/82468GX","LPC/FWH Interface" },
-{0x8086, 0x7601, "Intel Corporation","82372FB/82468GX","EIDE Controller" },
-{0x8086, 0x7602, "Intel Corporation","82372FB/82468GX","USB Host Controller" },
-{0x8086, 0x7603, "Intel Corporation","82372FB/82468GX","SM Bus Controller" },
-{0x8086, 0x7605, "Intel Corporation","82372FB","IEEE1394 OpenHCI Host Controller" },
-{0x8086, 0x7800, "Intel Corporation","82740","AGP Graphics Accelerator" },
-{0x8086, 0x803b, "Intel Corporation","0x104d","0x81ef" },
-{0x8086, 0x8083, "Intel Corporation","Intel PM45","Intel Wireless WiFi Link 5100 ABGN 10/100/1000 Base T" },
-{0x8086, 0x8086, "Intel Corporation","http://dlcdnet.asus.com/pub/ASUS/nb/Drivers/MEI/ME","0x8086&DEV_3B64&CC_0780" },
-{0x8086, 0x8108, "Intel Corporation","SCH US15WP","Intel(R) Graphics Media Accelerator 500  https://downloadcenter.intel.com/confirm.aspx?httpDown=http" },
-{0x8086, 0x811A, "Intel Corporation","Atom SCH","Atom SCH PATA" },
-{0x8086, 0x8186, "Intel Corporation","i dont know","i dont know" },
-{0x8086, 0x84C4, "Intel Corporation","82454KX/GX","450KX/GX PCI Bridge (Orion)" },
-{0x8086, 0x84C5, "Intel Corporation","82453KX/GX","450KX/GX Memory Controller (Orion)" },
-{0x8086, 0x84CA, "Intel Corporation","82451NX","450NX PCIset Memory & I/O Controller" },
-{0x8086, 0x84CB, "Intel Corporation","82454NX/82467GX","PCI Expander Bridge" },
-{0x8086, 0x84E0, "Intel Corporation","82461GX","System Address controller" },
-{0x8086, 0x84E1, "Intel Corporation","82462GX","System Data Controller" },
-{0x8086, 0x84E2, "Intel Corporation","82465GX","Graphics Expander Bridge" },
-{0x8086, 0x84E3, "Intel Corporation","82463GX","Memory Address Controller" },
-{0x8086, 0x84E4, "Intel Corporation","82464GX","Memory Data Controller" },
-{0x8086, 0x84E6, "Intel Corporation","82466GX","Wide and fast PCI eXpander Bridge" },
-{0x8086, 0x84EA, "Intel Corporation","82460GX","AGP Bridge (GXB function 1)" },
-{0x8086, 0x85A1, "Intel Corporation","6300ESB","LPC Bridge" },
-{0x8086, 0x85A2, "Intel Corporation","6300ESB","IDE Controller" },
-{0x8086, 0x85A3, "Intel Corporation","6300ESB","Serial ATA Controller" },
-{0x8086, 0x85A4, "Intel Corporation","6300ESB","SMBus Controller" },
-{0x8086, 0x85A6, "Intel Corporation","6300ESB","AC'97 Audio Controller" },
-{0x8086, 0x85A7, "Intel Corporation","6300ESB","AC'97 Modem Controller" },
-{0x8086, 0x85A9, "Intel Corporation","6300ESB","USB 1.1 UHCI Controller #1" },
-{0x8086, 0x85AA, "Intel Corporation","6300ESB","USB 1.1 UHCI Controller #2" },
-{0x8086, 0x8C02, "Intel Corporation","C220","Intel(R) 8 Series/C220 Series SATA AHCI Controller" },
-{0x8086, 0x8C22, "Intel Corporation","8C22","Intel(R) 8 Series/C220 Series SMBus Controller" },
-{0x8086, 0x8c31, "Intel Corporation","PCI\\VEN_8086&DEV_8C3A&SUBSYS_85341043&REV_04","Intel USB 3.0 eXtensible" },
-{0x8086, 0x8C3A, "Intel Corporation","0x8C31","Intel(R) Management Engine Interface" },
-{0x8086, 0x8C5C, "Intel Corporation","8C5C","Intel(R) H81 LPC Controller" },
-{0x8086, 0x8CBA, "Intel Corporation","PCI\\VEN_8086&DEV_8CBA&SUBSYS_8CBA1849&REV_00","PCI Simple Communications Controller" },
-{0x8086, 0x8d3a, "Intel Corporation","PCI\\VEN_8086&DEV_8D3A&SUBSYS_86001043","Intel Management Engine Interface (MEI)" },
-{0x8086, 0x9620, "Intel Corporation","","I2O RAID PCI to PCI Bridge" },
-{0x8086, 0x9621, "Intel Corporation","SRCU21","I2O 1.5 RAID Controller" },
-{0x8086, 0x9622, "Intel Corporation","SRCUxx","I2O 1.5 RAID Controller" },
-{0x8086, 0x9641, "Intel Corporation","SRCU31","I2O 1.5 RAID Controller" },
-{0x8086, 0x96A1, "Intel Corporation","SRCU31L","I2O 1.5 RAID Controller" },
-{0x8086, 0x9779, "Intel Corporation","0x2992","0x2992" },
-{0x8086, 0x9874, "Intel Corporation","AC97","AUDIO CONTROLLER" },
-{0x8086, 0x9876, "Intel Corporation","i845","intel brokdale" },
-{0x8086, 0x9877, "Intel Corporation","1","1" },
-{0x8086, 0x9888, "Intel Corporation","HDAUDIO\\FUNC_01&VEN_8086&DEV_27d8&SUBSYS_80860101&","HDAUDIO\\FUNC_01&VEN_8086&DEV_27d8&REV_1000" },
-{0x8086, 0x9998, "Intel Corporation","42468068"," 02" },
-{0x8086, 0x9999, "Intel Corporation","pci30b2103c","Interface chip" },
-{0x8086, 0x9C03, "Intel Corporation","9C03","Intel(R) 8 Series SATA Controller" },
-{0x8086, 0x9C14, "Intel Corporation","9C14","Intel(R) 9 Series PCI Express Root Port" },
-{0x8086, 0x9C20, "Intel Corporation","9C20","High Definition Audio Controller" },
-{0x8086, 0x9C22, "Intel Corporation","9C22","Intel(R) 8 Series SMBus Controller" },
-{0x8086, 0x9C24, "Intel Corporation","9C24","Intel(R) 8 Series Thermal" },
-{0x8086, 0x9C26, "Intel Corporation","9C26","Intel(R) 8 Series USB Enhanced Host Controller" },
-{0x8086, 0x9C31, "Intel Corporation","Unknown","Intel USB 3.0 eXtensible Host Controller" },
-{0x8086, 0x9C3A, "Intel Corporation","PCI\\VEN_8086","Intel Management Engine Interface driver" },
-{0x8086, 0x9C43, "Intel Corporation","9C43","Intel(R) 8 Series LPC Controller" },
-{0x8086, 0x9CB1, "Intel Corporation","PCI\\VEN_8086&DEV_9CB1","Intel USB 3.0 Driver for Intel 8 and U/Y Series " },
-{0x8086, 0xA001, "Intel Corporation","3150","Intel Media Accelerator 3150" },
-{0x8086, 0xA002, "Intel Corporation","GMA 3150","Intel® Grafik-Media-Accelerator 3150 (Intel® GMA 3150)" },
-{0x8086, 0xA011, "Intel Corporation","02\\3","Intel(R) Graphics Media Accelerator 3150" },
-{0x8086, 0xA012, "Intel Corporation","GMA3150","Intel® Graphics Media Accelerator 3150" },
-{0x8086, 0xB152, "Intel Corporation","S21152BB","PCI to PCI Bridge" },
-{0x8086, 0xB154, "Intel Corporation","1C20","PCI to PCI Bridge" },
-{0x8086, 0xB555, "Intel Corporation","21555","Non-Transparent PCI-to-PCI Bridge" },
-{0x8086, 0xC50, "Intel Corporation","fd","sdf" },
-{0x8086, 0xE13A, "Intel Corporation","7600","NXMOQSN00430812D49" },
-{0x8086, 0xF4E, "Intel Corporation","0F4E","Intel(R) Pentium(R)/Celeron(R) processor N-/J- series PCI Express Root Port" },
-{0x8086, 0x8671, "Intel Corporation","","" },
-{0x8087, 0x0028, "Intel","NV05","MCP67 High Definition Audio" },
-{0x8087, 0x07D6, "Intel","612BNXHMW","Intel Centrino Wireless-N + WiMAX 6150" },
-{0x80EE, 0x7145, "Oracle Corporation - InnoTek Systemberatung GmbH","VBoxVideo 0x8168","VirtualBox Graphics Adapter" },
-{0x80EE, 0xBEEF, "Oracle Corporation - InnoTek Systemberatung GmbH","VBoxVideo 0x8168","VirtualBox Graphics Adapter" },
-{0x80EE, 0xCAFE, "Oracle Corporation - InnoTek Systemberatung GmbH","N/A - Virtual Device","VirtualBox Device" },
-{0x8866, 0x1685, "T-Square Design Inc.","T2-Mp3-001","MP3 player/FM radio/voice recorder 256 Mo flash" },
-{0x8866, 0x1689, "T-Square Design Inc.","T2-MP3-001","MP3 player/FM radio/voice recorder 256 Mo flash" },
-{0x9004, 0x0078, "Adaptec Inc","aic-7880x","AHA-2940UW/CN" },
-{0x9004, 0x1078, "Adaptec Inc","AIC-7810C","RAID Coprocessor" },
-{0x9004, 0x1135, "Adaptec Inc","0x0035","Texas Instruments" },
-{0x9004, 0x1160, "Adaptec Inc","AIC-1160","Fibre Channel Adapter" },
-{0x9004, 0x2178, "Adaptec Inc","AIC-7821","SCSI Controller" },
-{0x9004, 0x3860, "Adaptec Inc","","AIC-2930U Ultra SCSI Ctrlr" },
-{0x9004, 0x3B78, "Adaptec Inc","AHA-4944W/4944UW","QuadChannel Fast-Wide/Ultra-Wide Diff. SCSI Ctrlr" },
-{0x9004, 0x5075, "Adaptec Inc","AIC-755x","SCSI Ctrlr" },
-{0x9004, 0x5078, "Adaptec Inc","AIC-7850P","Fast/Wide SCSI Controller" },
-{0x9004, 0x5175, "Adaptec Inc","AIC-755x","SCSI Ctrlr" },
-{0x9004, 0x5178, "Adaptec Inc","AIC-7850","FAST-SCSI Ctrlr" },
-{0x9004, 0x5275, "Adaptec Inc","AIC-755x","SCSI Ctrlr" },
-{0x9004, 0x5278, "Adaptec Inc","AIC-7850","Fast SCSI Ctrlr" },
-{0x9004, 0x5375, "Adaptec Inc","AIC-755x","SCSI Ctrlr" },
-{0x9004, 0x5378, "Adaptec Inc","AIC-7850","Fast SCSI Ctrlr" },
-{0x9004, 0x5475, "Adaptec Inc","AIC-755x","SCSI Ctrlr" },
-{0x9004, 0x5478, "Adaptec Inc","AIC-7850","Fast SCSI Ctrlr" },
-{0x9004, 0x5575, "Adaptec Inc","AVA-2930","SCSI Ctrlr" },
-{0x9004, 0x5578, "Adaptec Inc","AIC-7855","Fast SCSI Ctrlr" },
-{0x9004, 0x5675, "Adaptec Inc","AIC-755x","SCSI Ctrlr" },
-{0x9004, 0x5678, "Adaptec Inc","AIC-7856","Fast SCSI Ctrlr" },
-{0x9004, 0x5775, "Adaptec Inc","AIC-755x","SCSI Ctrlr" },
-{0x9004, 0x5778, "Adaptec Inc","AIC-7850","Fast SCSI Ctrlr" },
-{0x9004, 0x5800, "Adaptec Inc","AIC-5800","PCI-to-1394 Ctrlr" },
-{0x9004, 0x5900, "Adaptec Inc","ANA-5910/30/40","ATM155 & 25 LAN Controller" },
-{0x9004, 0x5905, "Adaptec Inc","ANA-5910A/30A/40A","ATM Adpater" },
-{0x9004, 0x6038, "Adaptec Inc","AHA-2930C","Ultra SCSI Adpater (VAR)" },
-{0x9004, 0x6075, "Adaptec Inc","AIC-7560?","CardBus Ultra SCSI Controller" },
-{0x9004, 0x6078, "Adaptec Inc","AIC-7860","PCI SCSI Controller" },
-{0x9004, 0x6178, "Adaptec Inc","AIC-7861","PCI SCSI Controller" },
-{0x9004, 0x6278, "Adaptec Inc","AIC-7860","SCSI Ctrlr" },
-{0x9004, 0x6378, "Adaptec Inc","AIC-7860","SCSI Ctrlr" },
-{0x9004, 0x6478, "Adaptec Inc","AIC-786x","SCSI Ctrlr" },
-{0x9004, 0x6578, "Adaptec Inc","AIC-786x","SCSI Ctrlr" },
-{0x9004, 0x6678, "Adaptec Inc","AIC-786x","SCSI Ctrlr" },
-{0x9004, 0x6778, "Adaptec Inc","AIC-786x","SCSI Ctrlr" },
-{0x9004, 0x6915, "Adaptec Inc","ANA620xx/69011A","Fast Ethernet" },
-{0x9004, 0x7078, "Adaptec Inc","AIC-7870","Fast and Wide SCSI Ctrlr" },
-{0x9004, 0x7178, "Adaptec Inc","AHA-2940/2940W","Fast/Fast-Wide SCSI Ctrlr" },
-{0x9004, 0x7278, "Adaptec Inc","AHA-3940/3940W","Multichannel Fast/Fast-Wide SCSI Ctrlr" },
-{0x9004, 0x7378, "Adaptec Inc","AHA-3985","4-chan RAID SCSI Ctrlr" },
-{0x9004, 0x7478, "Adaptec Inc","AHA-2944","SCSI Ctrlr" },
-{0x9004, 0x7578, "Adaptec Inc","AHA-3944/3944W","Multichannel Fast/Fast-Wide Diff. SCSI Ctrlr" },
-{0x9004, 0x7678, "Adaptec Inc","AHA-4944W/4944UW","QuadChannel Fast-Wide/Ultra-Wide Diff. SCSI Ctrlr" },
-{0x9004, 0x7778, "Adaptec Inc","AIC-787x","SCSI Ctrlr" },
-{0x9004, 0x7810, "Adaptec Inc","aic 7810","Memory control IC" },
-{0x9004, 0x7815, "Adaptec Inc","AIC-7515","RAID + Memory Controller IC" },
-{0x9004, 0x7850, "Adaptec Inc","aic-7850P","Fast/Wide SCSI-2 Controller" },
-{0x9004, 0x7855, "Adaptec Inc","AHA-2930","Single channel SCSI Host Adapter" },
-{0x9004, 0x7860, "Adaptec Inc","AIC-7860","PCI SCSI Controller" },
-{0x9004, 0x7870, "Adaptec Inc","AIC-7870","Fast/Wide SCSI-2 Controller" },
-{0x9004, 0x7871, "Adaptec Inc","aha 2940","SCSI" },
-{0x9004, 0x7872, "Adaptec Inc","aha 3940","Multiple SCSI channels" },
-{0x9004, 0x7873, "Adaptec Inc","aha 3985","Multiple SCSI channels" },
-{0x9004, 0x7874, "Adaptec Inc","aha 2944","Differential SCSI" },
-{0x9004, 0x7880, "Adaptec Inc","aic7880p","Fast 20 SCSI" },
-{0x9004, 0x7890, "Adaptec Inc","AIC-7890","SCSI controller" },
-{0x9004, 0x7891, "Adaptec Inc","AIC-789x","SCSI controller" },
-{0x9004, 0x7892, "Adaptec Inc","AIC-789x","SCSI controller" },
-{0x9004, 0x7893, "Adaptec Inc","AIC-789x","SCSI controller" },
-{0x9004, 0x7894, "Adaptec Inc","AIC-789x","SCSI controller" },
-{0x9004, 0x7895, "Adaptec Inc","AIC-7895","Ultra-Wide SCSI Ctrlr on AHA-2940 AHA-394x" },
-{0x9004, 0x7896, "Adaptec Inc","AIC-789x","SCSI controller" },
-{0x9004, 0x7897, "Adaptec Inc","AIC-789x","SCSI controller" },
-{0x9004, 0x8078, "Adaptec Inc","AIC-7880P","Ultra Wide SCSI" },
-{0x9004, 0x8178, "Adaptec Inc","AHA-2940U/2940UW","Ultra/Ultra-Wide SCSI Ctrlr" },
-{0x9004, 0x8278, "Adaptec Inc","AHA-3940Uxx","AHA-3940U/3940UW/3940UWD SCSI Ctrlr" },
-{0x9004, 0x8378, "Adaptec Inc","AIC-7883U","SCSI Controller" },
-{0x9004, 0x8478, "Adaptec Inc","ADAPTEC 2940UW CN SCSI","Ultra-Wide Diff. SCSI Ctrlr" },
-{0x9004, 0x8578, "Adaptec Inc","AHA-3944U/3944UWD","Fast-Wide/Ultra-Wide Diff. SCSI Ctrlr" },
-{0x9004, 0x8678, "Adaptec Inc","AHA-4944UW","QuadChannel Ultra-Wide Diff. SCSI Ctrlr" },
-{0x9004, 0x8778, "Adaptec Inc","AIC-788x","Ultra-Wide SCSI Ctrlr" },
-{0x9004, 0x8878, "Adaptec Inc","AIC-7888?","Ultra Wide SCSI Controller" },
-{0x9004, 0x8B78, "Adaptec Inc","ABA-1030","AIC-7880P" },
-{0x9004, 0xEC78, "Adaptec Inc","AHA-4944W/4944UW","QuadChannel Fast-Wide/Ultra-Wide Diff. SCSI Ctrlr" },
-{0x9005, 0x0010, "Adaptec Inc","AIC-7890AB scsi controller","AHA-2940U2W/U2B,2950U2W Ultra2 SCSI" },
-{0x9005, 0x0011, "Adaptec Inc","11111","AHA-2930U2 Ultra2 SCSI Host Adapter" },
-{0x9005, 0x0013, "Adaptec Inc","AIC-7890/1","SCSI Controller" },
-{0x9005, 0x001F, "Adaptec Inc","AIC-7890 AB for Windows  XP","Ultra2-Wide SCSI controller" },
-{0x9005, 0x0020, "Adaptec Inc","AIC-789x","SCSI Controller" },
-{0x9005, 0x002F, "Adaptec Inc","AIC-789x","SCSI Controller" },
-{0x9005, 0x0030, "Adaptec Inc","AIC-789x","SCSI Controller" },
-{0x9005, 0x003F, "Adaptec Inc","AIC-789x","SCSI Controller" },
-{0x9005, 0x0050, "Adaptec Inc","","AHA-3940U2x/3950U2x Ultra2 SCSI Adapter" },
-{0x9005, 0x0051, "Adaptec Inc","","AHA-3950U2x Ultra2 SCSI Adapter" },
-{0x9005, 0x0053, "Adaptec Inc","AIC-7896","SCSI Controller" },
-{0x9005, 0x005F, "Adaptec Inc","AIC-7896/7","Ultra2 SCSI Controller" },
-{0x9005, 0x0080, "Adaptec Inc","AIC-7892Q","Ultra160/m PCI SCSI Controller" },
-{0x9005, 0x0081, "Adaptec Inc","AIC-7892B","Ultra160 SCSI Controller" },
-{0x9005, 0x0083, "Adaptec Inc","AIC-7892D","Ultra160 SCSI Controller" },
-{0x9005, 0x008F, "Adaptec Inc","AIC-7892","Ultra160 SCSI Controller" },
-{0x9005, 0x00C0, "Adaptec Inc","AIC-7899A","Ultra160 SCSI Controller" },
-{0x9005, 0x00C1, "Adaptec Inc","AIC-7899B","Ultra160 SCSI Controller" },
-{0x9005, 0x00C3, "Adaptec Inc","AIC-7899D","Ultra160 SCSI Controller" },
-{0x9005, 0x00C5, "Adaptec Inc","","RAID Subsystem HBA" },
-{0x9005, 0x00CF, "Adaptec Inc","AIC-7899G","Ultra160 SCSI Controller" },
-{0x9005, 0x0241, "Adaptec Inc","1420","Adaptec 1420SA Serial AHA HostRAID Controller" },
-{0x9005, 0x0258, "Adaptec Inc","AAC-RAID","Adaptec AAR-2610SA SATA 6-Port Raid" },
-{0x9005, 0x0285, "Adaptec Inc","Adaptec 2410SA SATA RAID","PCIX133 32/64bit" },
-{0x9005, 0x0286, "Adaptec Inc","SUBSYS_95801014REV_02","SUBSYS_95801014REV_02" },
-{0x9005, 0x041F, "Adaptec Inc","AIC 9410","SAS/SATA Controller" },
-{0x9005, 0x043E, "Adaptec Inc","AIC9450W","SAS/SATA Controller" },
-{0x9005, 0x41E, "Adaptec Inc","AIC-9410W","Razor ASIC" },
-{0x9005, 0x564A, "Adaptec Inc","AIC-7211W","iSCSI Controller" },
-{0x9005, 0x8000, "Adaptec Inc","ASC-29320A","Ultra320 SCSI Controller" },
-{0x9005, 0x800F, "Adaptec Inc","AIC-7901","Ultra320 SCSI Controller" },
-{0x9005, 0x8010, "Adaptec Inc","ASC-39320","Ultra320 SCSI Controller" },
-{0x9005, 0x8011, "Adaptec Inc","ASC-39320D","Ultra320 SCSI Controller" },
-{0x9005, 0x8012, "Adaptec Inc","ASC-29320","Ultra320 SCSI Controller" },
-{0x9005, 0x8014, "Adaptec Inc","ASC-29320LP","Ultra320 SCSI Controller" },
-{0x9005, 0x8015, "Adaptec Inc","ASC-39320","Ultra320 SCSI Controller" },
-{0x9005, 0x8016, "Adaptec Inc","ASC-39320A","Ultra320 SCSI Controller" },
-{0x9005, 0x8017, "Adaptec Inc","ASC-29320ALP","Ultra320 SCSI Controller" },
-{0x9005, 0x801C, "Adaptec Inc","AIC-?????","Ultra320 SCSI Controller" },
-{0x9005, 0x801D, "Adaptec Inc","AIC-7902B","Ultra320 SCSI Controller" },
-{0x9005, 0x801E, "Adaptec Inc","AIC-7901","Ultra320 SCSI Controller" },
-{0x9005, 0x801F, "Adaptec Inc","AIC-7902","Ultra320 SCSI Controller" },
-{0x9005, 0x8080, "Adaptec Inc","ASC-29320A","Ultra320 HostRAID Controller" },
-{0x9005, 0x808F, "Adaptec Inc","AIC-7901","Ultra320 HostRAID Controller" },
-{0x9005, 0x8090, "Adaptec Inc","ASC-39320","HostRAID SCSI Controller" },
-{0x9005, 0x8091, "Adaptec Inc","ASC-39320D","HostRAID SCSI Controller" },
-{0x9005, 0x8092, "Adaptec Inc","ASC-29320","HostRAID SCSI Controller" },
-{0x9005, 0x8093, "Adaptec Inc","ASC-29320LPE","HostRAID SCSI Controller" },
-{0x9005, 0x8094, "Adaptec Inc","ASC-29320LP","HostRAID SCSI Controller" },
-{0x9005, 0x8095, "Adaptec Inc","ASC-39320","HostRAID SCSI Controller" },
-{0x9005, 0x8096, "Adaptec Inc","ASC-39320A","HostRAID SCSI Controller" },
-{0x9005, 0x8097, "Adaptec Inc","ASC-29320ALP","HostRAID SCSI Controller" },
-{0x9005, 0x809C, "Adaptec Inc","ASC-39320D","HostRAID SCSI Controller" },
-{0x9005, 0x809D, "Adaptec Inc","AIC-7902B","HostRAID SCSI Controller" },
-{0x9005, 0x809E, "Adaptec Inc","AIC-7901A","HostRAID SCSI Controller" },
-{0x9005, 0x809F, "Adaptec Inc","AIC-7902B","HostRAID SCSI Controller" },
-{0x9412, 0x6565, "Holtek","HT6565","IDE Controller?" },
-{0x9710, 0x7705, "MosChip Semiconductor Technology","MCS7705","USB 1.1 to Single Parallel Controller " },
-{0x9710, 0x7830, "MosChip Semiconductor Technology","MCS7830","USB 2.0 to 10/100M Fast Ethernet Controller" },
-{0x9710, 0x8729, "MosChip Semiconductor Technology","mcs7830","usb 2.0 10/100M ethernet adaptor" },
-{0x9710, 0x9805, "MosChip Semiconductor Technology","mcs9805cv","MosChip PCI Parallel Port" },
-{0x9710, 0x9815, "MosChip Semiconductor Technology","9815","MCS9815 / M-CAB Parallel Adapter" },
-{0x9710, 0x9835, "MosChip Semiconductor Technology","9835","2 serial, 1 LPT port PCI Card" },
-{0x9710, 0x9845, "MosChip Semiconductor Technology","NM9845CV","2 serial" },
-{0x9710, 0x9865, "MosChip Semiconductor Technology","MCS9865","PCI Porta Paralela" },
-{0x9710, 0x9900, "MosChip Semiconductor Technology","MCS9900CV-AA","NetMOS Single Parallel Port Card" },
-{0x9710, 0x9904, "MosChip Semiconductor Technology","MCS9900","PCIe to Multi IO Controller" },
-{0x9710, 0x9912, "MosChip Semiconductor Technology","MCS9901CV-CC","PCIe to Dual Serial and Single Parallel" },
-{0x9710, 0x9922, "MosChip Semiconductor Technology","MCS9922","PCIe to Dual Serial Port Controller" },
-{0x9902, 0x0001, "StarGen, Inc.","SG2010","PCI-to-PCI Bridge" },
-{0x9902, 0x0002, "StarGen, Inc.","SG2010","PCI to high speed serial bridge" },
-{0x9902, 0x0003, "StarGen, Inc.","SG1010","6 port serial switch /PCI-to-PCI bridge" },
-{0xA0F1, 0x9876, "Unisys Corporation","0x9876","0x9876" },
-{0xA200, 0xa200, "NEC Corp.","saa1735hl","tv" },
-{0xA259, 0x3038, "Hewlett Packard","82945G","PCI\\VEN_103C&DEV_3302&SUBSYS_3305103C&REV_00" },
-{0xA304, 0x3038, "Sony","10EC","USB" },
-{0xA727, 0x0013, "3com Corporation","3com p/n: 3CRDAG675","3com 11 a/b/g wireless PCI Adapter" },
-{0xAA42, 0x03A3, "Abekas, Inc","9400-0931","CharKey" },
-{0xC0DE, 0x5600, "Motorola","62802","" },
-{0xC0DE, 0xC0DE, "Motorola","ENF656","oZ0030" },
-{0xD4D4, 0x010F, "Curtiss-Wright Controls Embedded Computing","PMC-211","PMC-211" },
-{0xD4D4, 0x0601, "Curtiss-Wright Controls Embedded Computing","","PCI Mezzanine Card" },
-{0xDEAF, 0x9050, "Middle Digital, Inc","","PC Weasel PCI VGA Device" },
-{0xDEAF, 0x9051, "Middle Digital, Inc","","PC Weasel PCI Serial Comm. Device" },
-{0xDEAF, 0x9052, "Middle Digital, Inc","","PC Weasel PCI" },
-{0xE159, 0x0001, "Tiger Jet Network Inc","Ambient MD3200 A","Yeastar TDM400" },
-{0xE159, 0x0002, "Tiger Jet Network Inc","","Sedlbauer Speed PCI" },
-{0xE159, 0x0600, "Tiger Jet Network Inc","Tiger 600","PCI-to-PCI Bridge" },
-{0xEACE, 0x24C5, "Endace Measurement Systems Ltd.","1","VIA Vynil v700b" },
-{0xEACE, 0x3100, "Endace Measurement Systems Ltd.","DAG 3.10","OC-3/OC-12" },
-{0xEACE, 0x3200, "Endace Measurement Systems Ltd.","DAG 3.2x","OC-3/OC-12" },
-{0xEACE, 0x320E, "Endace Measurement Systems Ltd.","DAG 3.2E","Fast Ethernet" },
-{0xEACE, 0x340E, "Endace Measurement Systems Ltd.","DAG 3.4E","Fast Ethernet" },
-{0xEACE, 0x341E, "Endace Measurement Systems Ltd.","DAG 3.41E","Fast Ethernet" },
-{0xEACE, 0x3500, "Endace Measurement Systems Ltd.","DAG 3.5","OC-3/OC-12" },
-{0xEACE, 0x351C, "Endace Measurement Systems Ltd.","DAG 3.5ECM","Fast Ethernet" },
-{0xEACE, 0x4100, "Endace Measurement Systems Ltd.","DAG 4.10","OC-48" },
-{0xEACE, 0x4110, "Endace Measurement Systems Ltd.","DAG 4.11","OC-48" },
-{0xEACE, 0x4200, "Endace Measurement Systems Ltd.","DAG 4.2","OC-48" },
-{0xEACE, 0x420E, "Endace Measurement Systems Ltd.","DAG 4.2E","Dual Gigabit Ethernet" },
-{0xEACE, 0x430e, "Endace Measurement Systems Ltd.","DAG 4.3E","Dual Gigabit Ethernet" },
-{0xECC0, 0x0050, "Echo Digital Audio Corporation","","" },
-{0xECC0, 0x0051, "Echo Digital Audio Corporation","","" },
-{0xECC0, 0x0060, "Echo Digital Audio Corporation","","" },
-{0xECC0, 0x0070, "Echo Digital Audio Corporation","","" },
-{0xECC0, 0x0071, "Echo Digital Audio Corporation","","" },
-{0xECC0, 0x0072, "Echo Digital Audio Corporation","","" },
-{0xECC0, 0x0080, "Echo Digital Audio Corporation","MiaMIDI","4/2 channel (analog/digital) audio card" },
-{0xECC0, 0x0100, "Echo Digital Audio Corporation","GINA3G","6/8 channel (analog/digital) audio card" },
-{0xECC0, 0x3410, "Echo Digital Audio Corporation","0x0001","Motorola" },
-{0xEDD8, 0xA091, "ARK Logic, Inc","ARK1000PV","Stingray GUI Accelerator" },
-{0xEDD8, 0xA099, "ARK Logic, Inc","ARK2000PV","Stingray GUI Accelerator" },
-{0xEDD8, 0xA0A1, "ARK Logic, Inc","ARK2000MT","Stingray 64" },
-{0xEDD8, 0xA0A9, "ARK Logic, Inc","ARK2000MI","Quadro645 GUI Accelerator" },
-{0xEDD8, 0xA0B1, "ARK Logic, Inc","ARK2000MI+","GUI Accelerator" },
-{0xFA57, 0x0001, "Interagon AS","PMC","Pattern Matching Chip" },
-};
+int PCI_get_device_name(uint vendor, uint device, char **vendor_name, char **device_name) {
+	*vendor_name = "n/a";
+	*device_name = "n/a";
+
+	int low = 0, high = sizeof(PCI_vendors) / sizeof(PCIVendorID) - 1;
+	const PCIVendorID *v = 0;
+
+	while (low <= high) {
+		int mid = (low + high) / 2;
+		if (PCI_vendors[mid].vendor == vendor) {
+			v = &PCI_vendors[mid];
+			break;
+		}
+		if (PCI_vendors[mid].vendor < vendor) low = mid + 1;
+		else high = mid - 1;
+	}
 
+	if (!v) return -1;
+	*vendor_name = (char*)&PCI_strings[v->name];
 
-int PCI_get_device_name(uint16 vendor, uint16 device, char **vendor_name, char **device_name) {
-	uint nb_devices = sizeof(device_list) / sizeof(PCIDevice);
-    *vendor_name = "n/a";
-    *device_name = "n/a";
+	low = v->first_device;
+	high = v->first_device + v->nb_devices - 1;
 
-	for (int i=0; i<nb_devices; i++) {
-		if (device_list[i].vendor == vendor) {
-            *vendor_name = device_list[i].vendor_name;
-            if (device_list[i].device == device) {
-                *device_name = device_list[i].device_name;
-                return 1;
-            }
-        } 
+	while (low <= high) {
+		int mid = (low + high) / 2;
+		if (PCI_devices[mid].device == device) {
+			*device_name = (char*)&PCI_strings[PCI_devices[mid].name];
+			break;
+		}
+		if (PCI_devices[mid].device < device) low = mid + 1;
+		else high = mid - 1;
 	}
 
-    if (*vendor_name != "n/a") return 1;
-	return -1;
+	return 1;
 }
@@ -0,0 +1,215 @@
+// Generates drivers/pci_ids.h from pci_ids.txt. This runs on the build
+// machine, not in CHAOS.
+//
+// Each line of pci_ids.txt is "VVVV DDDD<tab>vendor name<tab>device name"
+// (IDs in hexadecimal). The output has:
+// - PCI_strings: every name once, NUL-terminated, in a single array
+// - PCI_vendors: the vendors sorted by ID, with their range in PCI_devices
+// - PCI_devices: the devices sorted by (vendor, device)
+// so that PCI_get_device_name() is two binary searches.
+//
+// When an ID is listed twice, the first line wins. A vendor takes the name
+// of its first line.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LINE 1024
+
+typedef struct {
+    unsigned vendor, device;
+    unsigned line;
+    char *vendor_name, *device_name;
+} Entry;
+
+typedef struct {
+    char *str;
+    unsigned offset;
+} PoolString;
+
+static Entry *entries;
+static unsigned nb_entries, max_entries;
+
+// The string pool, with a hash table to find the names already in it
+static char *pool;
+static unsigned pool_size, max_pool_size;
+static PoolString *pool_hash;
+static unsigned pool_hash_size = 1 << 15;
+
+static void *xrealloc(void *ptr, size_t size) {
+    ptr = realloc(ptr, size);
+    if (!ptr) {
+        fprintf(stderr, "gen_pci_ids: out of memory\n");
+        exit(1);
+    }
+    return ptr;
+}
+
+static char *trim(char *str) {
+    while (*str == ' ') str++;
+
+    size_t len = strlen(str);
+    while (len && (str[len-1] == ' ' || str[len-1] == '\n' || str[len-1] == '\r')) str[--len] = 0;
+
+    return str;
+}
+
+static unsigned hash(const char *str) {
+    unsigned h = 2166136261u;       // FNV-1a
+    for (; *str; str++) h = (h ^ (unsigned char)*str) * 16777619u;
+    return h;
+}
+
+static unsigned pool_add(const char *str) {
+    unsigned i = hash(str) & (pool_hash_size - 1);
+
+    while (pool_hash[i].str) {
+        if (!strcmp(pool_hash[i].str, str)) return pool_hash[i].offset;
+        i = (i + 1) & (pool_hash_size - 1);
+    }
+
+    size_t len = strlen(str) + 1;
+    if (pool_size + len > max_pool_size) {
+        max_pool_size = (max_pool_size + len) * 2;
+        pool = xrealloc(pool, max_pool_size);
+    }
+
+    pool_hash[i].str = strdup(str);
+    pool_hash[i].offset = pool_size;
+    memcpy(pool + pool_size, str, len);
+    pool_size += len;
+
+    return pool_hash[i].offset;
+}
+
+static int compare_entries(const void *a, const void *b) {
+    const Entry *e1 = a, *e2 = b;
+
+    if (e1->vendor != e2->vendor) return e1->vendor < e2->vendor ? -1 : 1;
+    if (e1->device != e2->device) return e1->device < e2->device ? -1 : 1;
+    return e1->line < e2->line ? -1 : 1;
+}
+
+static void read_entries(FILE *f) {
+    char line[MAX_LINE];
+    unsigned nb_line = 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        nb_line++;
+        if (line[0] == '#' || line[0] == '\n') continue;
+
+        char *vendor_name = strchr(line, '\t');
+        char *device_name = vendor_name ? strchr(vendor_name + 1, '\t') : 0;
+        if (!device_name) {
+            fprintf(stderr, "gen_pci_ids: line %u: expected 3 fields\n", nb_line);
+            exit(1);
+        }
+        *vendor_name++ = 0;
+        *device_name++ = 0;
+
+        Entry e;
+        if (sscanf(line, "%x %x", &e.vendor, &e.device) != 2 || e.vendor > 0xFFFF || e.device > 0xFFFF) {
+            fprintf(stderr, "gen_pci_ids: line %u: bad IDs\n", nb_line);
+            exit(1);
+        }
+        e.line = nb_line;
+        e.vendor_name = strdup(trim(vendor_name));
+        e.device_name = strdup(trim(device_name));
+
+        if (nb_entries == max_entries) {
+            max_entries = max_entries ? max_entries * 2 : 1024;
+            entries = xrealloc(entries, max_entries * sizeof(Entry));
+        }
+        entries[nb_entries++] = e;
+    }
+}
+
+static void print_pool() {
+    printf("static const char PCI_strings[] =\n\"");
+
+    unsigned column = 1;
+    for (unsigned i=0; i<pool_size; i++) {
+        unsigned char c = pool[i];
+
+        // Octal escapes always have 3 digits, so that a digit after
+        // them isn't taken as part of the escape
+        if (c == '"' || c == '\\') column += printf("\\%c", c);
+        else if (c >= 0x20 && c < 0x7F) column += printf("%c", c);
+        else column += printf("\\%03o", c);
+
+        if (c == 0 && column > 72 && i + 1 < pool_size) {
+            printf("\"\n\"");
+            column = 1;
+        }
+    }
+
+    printf("\";\n\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: gen_pci_ids pci_ids.txt > pci_ids.h\n");
+        return 1;
+    }
+
+    FILE *f = fopen(argv[1], "r");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    read_entries(f);
+    fclose(f);
+
+    qsort(entries, nb_entries, sizeof(Entry), compare_entries);
+
+    pool_hash = calloc(pool_hash_size, sizeof(PoolString));
+    if (nb_entries * 2 >= pool_hash_size) {
+        fprintf(stderr, "gen_pci_ids: too many names for the hash table\n");
+        return 1;
+    }
+
+    unsigned *vendor_offsets = calloc(nb_entries, sizeof(unsigned));
+    unsigned *device_offsets = calloc(nb_entries, sizeof(unsigned));
+    unsigned nb_vendors = 0, nb_devices = 0;
+
+    // The entries of a vendor are contiguous and in the order of the file
+    // for each device, which keeps the first name of the vendor and device
+    for (unsigned i=0; i<nb_entries; i++) {
+        if (i == 0 || entries[i].vendor != entries[i-1].vendor) {
+            vendor_offsets[nb_vendors++] = pool_add(entries[i].vendor_name);
+        }
+
+        if (i > 0 && entries[i].vendor == entries[i-1].vendor && entries[i].device == entries[i-1].device) {
+            device_offsets[i] = ~0u;
+            continue;
+        }
+        device_offsets[i] = pool_add(entries[i].device_name);
+        nb_devices++;
+    }
+
+    printf("// Generated by drivers/pci_ids/gen_pci_ids.c from drivers/pci_ids/pci_ids.txt, don't edit\n");
+    printf("// %u vendors, %u devices, %u bytes of names\n\n", nb_vendors, nb_devices, pool_size);
+
+    print_pool();
+
+    printf("static const PCIVendorID PCI_vendors[] = {\n");
+    unsigned vendor = 0, first_device = 0, device = 0;
+    for (unsigned i=0; i<nb_entries; i++) {
+        if (i > 0 && entries[i].vendor != entries[i-1].vendor) {
+            printf("{0x%04X, %u, %u, %u},\n", entries[i-1].vendor, vendor_offsets[vendor++], first_device, device - first_device);
+            first_device = device;
+        }
+        if (device_offsets[i] != ~0u) device++;
+    }
+    if (nb_entries) printf("{0x%04X, %u, %u, %u},\n", entries[nb_entries-1].vendor, vendor_offsets[vendor], first_device, device - first_device);
+    printf("};\n\n");
+
+    printf("static const PCIDeviceID PCI_devices[] = {\n");
+    for (unsigned i=0; i<nb_entries; i++) {
+        if (device_offsets[i] != ~0u) printf("{0x%04X, %u},\n", entries[i].device, device_offsets[i]);
+    }
+    printf("};\n");
+
+    return 0;
+}
@@ -0,0 +1,273 @@
+// Discovers the processors and the interrupt controllers of the machine
+//
+// We first look for the ACPI RSDP and go through the RSDT to find the MADT
+// ("APIC" table). If the machine has no ACPI tables, we fall back on the
+// older Intel MultiProcessor Specification tables ("_MP_" floating pointer).
+//
+// This runs before paging is enabled: the tables are usually at the top of
+// the physical memory, far beyond what the kernel maps, so we read them
+// through their physical addresses and keep a copy of what we need.
+
+#include "libc.h"
+#include "kernel.h"
+#include "acpi.h"
+
+#define DEFAULT_LAPIC_ADDRESS   0xFEE00000
+
+#define MADT_LAPIC              0
+#define MADT_IOAPIC             1
+#define MADT_ISO                2
+#define MADT_LAPIC_OVERRIDE     5
+
+#define MP_PROCESSOR            0
+#define MP_BUS                  1
+#define MP_IOAPIC               2
+#define MP_IO_INTERRUPT         3
+#define MP_LOCAL_INTERRUPT      4
+
+typedef struct __attribute__((packed)) {
+	char signature[8];          // "RSD PTR "
+	uint8 checksum;
+	char OEM_id[6];
+	uint8 revision;
+	uint RSDT_address;
+} ACPIRSDP;
+
+typedef struct __attribute__((packed)) {
+	char signature[4];
+	uint length;
+	uint8 revision;
+	uint8 checksum;
+	char OEM_id[6];
+	char OEM_table_id[8];
+	uint OEM_revision;
+	uint creator_id;
+	uint creator_revision;
+} ACPISDTHeader;
+
+typedef struct __attribute__((packed)) {
+	ACPISDTHeader header;
+	uint LAPIC_address;
+	uint flags;
+} ACPIMADT;
+
+typedef struct __attribute__((packed)) {
+	uint8 type;
+	uint8 length;
+} ACPIMADTEntry;
+
+// One entry of the MCFG table per PCI segment
+typedef struct __attribute__((packed)) {
+	uint address_low;
+	uint address_high;
+	uint16 segment;
+	uint8 start_bus;
+	uint8 end_bus;
+	uint reserved;
+} ACPIMCFGEntry;
+
+typedef struct __attribute__((packed)) {
+	char signature[4];          // "_MP_"
+	uint config_table;
+	uint8 length;
+	uint8 spec_rev;
+	uint8 checksum;
+	uint8 features[5];
+} MPFloatingPointer;
+
+typedef struct __attribute__((packed)) {
+	char signature[4];          // "PCMP"
+	uint16 length;
+	uint8 spec_rev;
+	uint8 checksum;
+	char OEM_id[8];
+	char product_id[12];
+	uint OEM_table;
+	uint16 OEM_table_size;
+	uint16 nb_entries;
+	uint LAPIC_address;
+	uint16 ext_length;
+	uint8 ext_checksum;
+	uint8 reserved;
+} MPConfigTable;
+
+ACPIInfo ACPI_info;
+
+ACPIInfo *ACPI_get_info() {
+	return &ACPI_info;
+}
+
+static uint8 ACPI_checksum(uint8 *ptr, uint length) {
+	uint8 sum = 0;
+	for (uint i=0; i<length; i++) sum += ptr[i];
+	return sum;
+}
+
+// Looks for a signature on a 16-byte boundary (where both the RSDP and the
+// MP floating pointer live) and checks the structure checksum
+static uint8 *ACPI_scan(uint start, uint end, const char *signature, uint sig_length, uint length) {
+	for (uint addr = start; addr + length <= end; addr += 16) {
+		if (!strncmp((char*)addr, signature, sig_length) &&
+			ACPI_checksum((uint8*)addr, length) == 0)
+			return (uint8*)addr;
+	}
+
+	return 0;
+}
+
+// The EBDA (segment stored at 0x40E) then the BIOS read-only area
+static uint8 *ACPI_find(const char *signature, uint sig_length, uint length) {
+	uint EBDA = (*(uint16*)0x40E) << 4;
+	uint8 *ptr = 0;
+
+	if (EBDA) ptr = ACPI_scan(EBDA, EBDA + 1024, signature, sig_length, length);
+	if (!ptr) ptr = ACPI_scan(0xE0000, 0x100000, signature, sig_length, length);
+
+	return ptr;
+}
+
+static void ACPI_add_CPU(uint8 LAPIC_id) {
+	if (ACPI_info.nb_CPUs >= MAX_CPUS) return;
+	ACPI_info.LAPIC_ids[ACPI_info.nb_CPUs++] = LAPIC_id;
+}
+
+static void ACPI_parse_MADT(ACPIMADT *madt) {
+	ACPI_info.LAPIC_address = madt->LAPIC_address;
+
+	uint8 *ptr = (uint8*)madt + sizeof(ACPIMADT);
+	uint8 *end = (uint8*)madt + madt->header.length;
+
+	while (ptr < end) {
+		ACPIMADTEntry *entry = (ACPIMADTEntry*)ptr;
+		if (entry->length < 2) break;
+
+		switch (entry->type) {
+			case MADT_LAPIC:
+				// ptr[2] = ACPI processor ID, ptr[3] = APIC ID, ptr[4] = flags (bit 0: enabled)
+				if (ptr[4] & 0x1) ACPI_add_CPU(ptr[3]);
+				break;
+			case MADT_IOAPIC:
+				// We only drive the first IOAPIC (the only one on QEMU, Bochs and VirtualBox)
+				if (!ACPI_info.IOAPIC_address) {
+					ACPI_info.IOAPIC_id = ptr[2];
+					ACPI_info.IOAPIC_address = *(uint*)(ptr + 4);
+					ACPI_info.IOAPIC_GSI_base = *(uint*)(ptr + 8);
+				}
+				break;
+			case MADT_ISO:
+				// ptr[2] = bus (0 = ISA), ptr[3] = IRQ, then the GSI and the flags
+				if (ptr[2] == 0 && ptr[3] < 16) {
+					ACPI_info.IRQ_GSI[ptr[3]] = *(uint*)(ptr + 4);
+					ACPI_info.IRQ_flags[ptr[3]] = *(uint16*)(ptr + 8);
+				}
+				break;
+			case MADT_LAPIC_OVERRIDE:
+				// 64-bit address, we can only use it if it is below 4GB
+				if (*(uint*)(ptr + 8) == 0) ACPI_info.LAPIC_address = *(uint*)(ptr + 4);
+				break;
+		}
+
+		ptr += entry->length;
+	}
+}
+
+// The memory-mapped PCI configuration space (ECAM). We only use it for the
+// segment 0, and only if it is below 4GB
+static void ACPI_parse_MCFG(ACPISDTHeader *mcfg) {
+	// The entries follow the header and 8 reserved bytes
+	ACPIMCFGEntry *entry = (ACPIMCFGEntry*)((uint8*)mcfg + sizeof(ACPISDTHeader) + 8);
+	ACPIMCFGEntry *end = (ACPIMCFGEntry*)((uint8*)mcfg + mcfg->length);
+
+	for (; entry < end; entry++) {
+		if (entry->segment != 0 || entry->address_high != 0) continue;
+
+		ACPI_info.MCFG_address = entry->address_low;
+		ACPI_info.MCFG_start_bus = entry->start_bus;
+		ACPI_info.MCFG_end_bus = entry->end_bus;
+		return;
+	}
+}
+
+static int ACPI_parse_RSDT(ACPIRSDP *rsdp) {
+	ACPISDTHeader *rsdt = (ACPISDTHeader*)rsdp->RSDT_address;
+	if (strncmp(rsdt->signature, "RSDT", 4) || ACPI_checksum((uint8*)rsdt, rsdt->length)) return 0;
+
+	uint nb_tables = (rsdt->length - sizeof(ACPISDTHeader)) / 4;
+	uint *tables = (uint*)((uint8*)rsdt + sizeof(ACPISDTHeader));
+
+	for (uint i=0; i<nb_tables; i++) {
+		ACPISDTHeader *table = (ACPISDTHeader*)tables[i];
+		if (ACPI_checksum((uint8*)table, table->length)) continue;
+
+		if (!strncmp(table->signature, "APIC", 4)) {
+			ACPI_parse_MADT((ACPIMADT*)table);
+			ACPI_info.source = ACPI_SOURCE_MADT;
+		}
+		else if (!strncmp(table->signature, "MCFG", 4)) ACPI_parse_MCFG(table);
+	}
+
+	return ACPI_info.source == ACPI_SOURCE_MADT;
+}
+
+static int ACPI_parse_MP(MPFloatingPointer *mp) {
+	// A null configuration table means one of the MP default configurations,
+	// i.e. two processors with the LAPIC IDs 0 and 1
+	if (mp->config_table == 0) {
+		ACPI_add_CPU(0);
+		ACPI_add_CPU(1);
+		ACPI_info.IOAPIC_address = 0xFEC00000;
+		ACPI_info.source = ACPI_SOURCE_MP;
+		return 1;
+	}
+
+	MPConfigTable *table = (MPConfigTable*)mp->config_table;
+	if (strncmp(table->signature, "PCMP", 4) || ACPI_checksum((uint8*)table, table->length)) return 0;
+
+	ACPI_info.LAPIC_address = table->LAPIC_address;
+	uint8 *ptr = (uint8*)table + sizeof(MPConfigTable);
+
+	for (uint i=0; i<table->nb_entries; i++) {
+		switch (*ptr) {
+			case MP_PROCESSOR:
+				// ptr[1] = LAPIC ID, ptr[3] = flags (bit 0: enabled)
+				if (ptr[3] & 0x1) ACPI_add_CPU(ptr[1]);
+				ptr += 20;
+				break;
+			case MP_IOAPIC:
+				// ptr[1] = IOAPIC ID, ptr[3] = flags (bit 0: enabled)
+				if ((ptr[3] & 0x1) && !ACPI_info.IOAPIC_address) {
+					ACPI_info.IOAPIC_id = ptr[1];
+					ACPI_info.IOAPIC_address = *(uint*)(ptr + 4);
+				}
+				ptr += 8;
+				break;
+			default:
+				ptr += 8;
+				break;
+		}
+	}
+
+	ACPI_info.source = ACPI_SOURCE_MP;
+	return 1;
+}
+
+void init_ACPI() {
+	memset(&ACPI_info, 0, sizeof(ACPIInfo));
+	ACPI_info.LAPIC_address = DEFAULT_LAPIC_ADDRESS;
+
+	// By default the ISA IRQs are identity-mapped to the GSIs
+	for (int i=0; i<16; i++) ACPI_info.IRQ_GSI[i] = i;
+
+	ACPIRSDP *rsdp = (ACPIRSDP*)ACPI_find("RSD PTR ", 8, 20);
+	if (rsdp && ACPI_parse_RSDT(rsdp)) return;
+
+	// The MADT parsing may have found some entries before failing
+	ACPI_info.nb_CPUs = 0;
+
+	MPFloatingPointer *mp = (MPFloatingPointer*)ACPI_find("_MP_", 4, 16);
+	if (mp && ACPI_parse_MP(mp)) return;
+
+	// No table at all: we are on our own
+	ACPI_info.nb_CPUs = 0;
+	ACPI_info.source = ACPI_SOURCE_NONE;
+}
@@ -0,0 +1,31 @@
+#ifndef __ACPI_H
+#define __ACPI_H
+
+#include "libc.h"
+#include "smp.h"
+
+// What we learn from the ACPI MADT (or the MP tables on older machines)
+// about the interrupt controllers and the processors
+typedef struct {
+	uint LAPIC_address;             // Physical address of the local APICs
+	uint nb_CPUs;                   // Number of usable processors
+	uint8 LAPIC_ids[MAX_CPUS];      // Local APIC ID of each processor
+	uint IOAPIC_address;            // Physical address of the first IOAPIC (0 if none)
+	uint IOAPIC_GSI_base;           // First global system interrupt handled by the IOAPIC
+	uint8 IOAPIC_id;
+	uint IRQ_GSI[16];               // ISA IRQ -> global system interrupt (interrupt source overrides)
+	uint16 IRQ_flags[16];           // Polarity/trigger mode of the override (MPS INTI flags)
+	uint8 source;                   // Where the information comes from (ACPI_SOURCE_*)
+	uint MCFG_address;              // PCI Express ECAM of the segment 0 (0 if none)
+	uint8 MCFG_start_bus;
+	uint8 MCFG_end_bus;
+} ACPIInfo;
+
+#define ACPI_SOURCE_NONE        0
+#define ACPI_SOURCE_MADT        1
+#define ACPI_SOURCE_MP          2
+
+void init_ACPI();
+ACPIInfo *ACPI_get_info();
+
+#endif
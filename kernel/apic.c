@@ -0,0 +1,194 @@
+// The local APIC: every CPU has one, mapped at the same physical address.
+// It delivers the interrupts to its CPU, sends inter-processor interrupts
+// (which is how the APs are woken up) and has its own timer, which is the
+// scheduler tick.
+//
+// The IOAPIC replaces the 8259 PIC when the ACPI/MP tables describe one:
+// the ISA and PCI interrupts are routed to the BSP with the same vectors as
+// with the PIC (IRQ0 + line), and acknowledged with an MMIO write to the
+// LAPIC instead of the PIC I/O ports.
+
+#include "libc.h"
+#include "kernel.h"
+#include "isr.h"
+#include "apic.h"
+#include "acpi.h"
+#include "virtualmem.h"
+
+extern void pit_wait_ms(uint ms);
+
+volatile uint8 *LAPIC_base = 0;
+volatile uint8 *IOAPIC_base = 0;
+uint IOAPIC_nb_inputs = 0;          // Number of redirection entries of the IOAPIC
+
+// Number of LAPIC timer ticks (with a divider of 16) per millisecond
+uint LAPIC_timer_ticks_per_ms = 0;
+
+static void LAPIC_write(uint reg, uint value) {
+    *(volatile uint*)(LAPIC_base + reg) = value;
+}
+
+static uint LAPIC_read(uint reg) {
+    return *(volatile uint*)(LAPIC_base + reg);
+}
+
+uint LAPIC_is_enabled() {
+    return LAPIC_base != 0;
+}
+
+uint8 LAPIC_id() {
+    if (!LAPIC_base) return 0;
+    return LAPIC_read(LAPIC_ID) >> 24;
+}
+
+void LAPIC_eoi() {
+    LAPIC_write(LAPIC_EOI, 0);
+}
+
+// Sends an IPI and waits for the LAPIC to accept it
+void LAPIC_send_IPI(uint8 LAPIC_id, uint command) {
+    LAPIC_write(LAPIC_ICR_HIGH, (uint)LAPIC_id << 24);
+    LAPIC_write(LAPIC_ICR_LOW, command);
+    while (LAPIC_read(LAPIC_ICR_LOW) & LAPIC_ICR_PENDING);
+}
+
+// Counts how much the LAPIC timer decrements during 10ms of PIT time
+void LAPIC_timer_calibrate() {
+    LAPIC_write(LAPIC_TIMER_DIVIDE, LAPIC_TIMER_DIVIDE_16);
+    LAPIC_write(LAPIC_LVT_TIMER, LAPIC_LVT_MASKED);
+    LAPIC_write(LAPIC_TIMER_INIT, 0xFFFFFFFF);
+
+    pit_wait_ms(10);
+
+    uint elapsed = 0xFFFFFFFF - LAPIC_read(LAPIC_TIMER_CURRENT);
+    LAPIC_write(LAPIC_TIMER_INIT, 0);
+
+    LAPIC_timer_ticks_per_ms = elapsed / 10;
+}
+
+// Starts the periodic LAPIC timer of the current CPU
+void LAPIC_timer_start(uint hz) {
+    LAPIC_write(LAPIC_TIMER_DIVIDE, LAPIC_TIMER_DIVIDE_16);
+    LAPIC_write(LAPIC_LVT_TIMER, IRQ_LAPIC_TIMER | LAPIC_TIMER_PERIODIC);
+    LAPIC_write(LAPIC_TIMER_INIT, LAPIC_timer_ticks_per_ms * 1000 / hz);
+}
+
+// Enables the LAPIC of the current CPU. The BSP keeps LINT0 as configured
+// by the BIOS (virtual wire mode), which is how the 8259 PIC interrupts
+// still reach it
+void init_LAPIC(uint is_BSP) {
+    LAPIC_base = (volatile uint8*)ACPI_get_info()->LAPIC_address;
+
+    // Accept all interrupts
+    LAPIC_write(LAPIC_TPR, 0);
+
+    if (!is_BSP) {
+        LAPIC_write(LAPIC_LVT_LINT0, LAPIC_LVT_MASKED);
+        LAPIC_write(LAPIC_LVT_LINT1, LAPIC_LVT_MASKED);
+    }
+
+    LAPIC_write(LAPIC_LVT_ERROR, LAPIC_LVT_MASKED);
+    LAPIC_write(LAPIC_LVT_TIMER, LAPIC_LVT_MASKED);
+
+    // Clear the error status (it must be written before being read)
+    LAPIC_write(LAPIC_ESR, 0);
+    LAPIC_read(LAPIC_ESR);
+
+    // Software-enable the LAPIC, spurious interrupts go to IRQ_LAPIC_SPURIOUS
+    LAPIC_write(LAPIC_SVR, LAPIC_SVR_ENABLE | IRQ_LAPIC_SPURIOUS);
+
+    LAPIC_eoi();
+}
+
+static void IOAPIC_write(uint reg, uint value) {
+    *(volatile uint*)(IOAPIC_base + IOAPIC_REGSEL) = reg;
+    *(volatile uint*)(IOAPIC_base + IOAPIC_WIN) = value;
+}
+
+static uint IOAPIC_read(uint reg) {
+    *(volatile uint*)(IOAPIC_base + IOAPIC_REGSEL) = reg;
+    return *(volatile uint*)(IOAPIC_base + IOAPIC_WIN);
+}
+
+uint IOAPIC_is_enabled() {
+    return IOAPIC_base != 0;
+}
+
+// Sends a global system interrupt to a vector of the BSP. A GSI the IOAPIC
+// doesn't have (a bad MADT override or PCI line) is ignored
+static void IOAPIC_route(uint GSI, uint8 vector, uint flags) {
+    ACPIInfo *info = ACPI_get_info();
+    uint pin = GSI - info->IOAPIC_GSI_base;
+
+    if (GSI < info->IOAPIC_GSI_base || pin >= IOAPIC_nb_inputs) {
+        printf("IOAPIC: no input for GSI %d\n", GSI);
+        return;
+    }
+
+    IOAPIC_write(IOAPIC_REDIRECTION + pin * 2 + 1, (uint)LAPIC_id() << 24);
+    IOAPIC_write(IOAPIC_REDIRECTION + pin * 2, vector | flags);
+}
+
+// The polarity and trigger mode of an ISA IRQ, from its interrupt source
+// override, with the default of the bus otherwise
+static uint IOAPIC_IRQ_flags(uint8 irq, uint default_flags) {
+    uint16 inti = ACPI_get_info()->IRQ_flags[irq];
+    uint flags = default_flags;
+
+    if (inti & INTI_POLARITY_MASK) {
+        flags &= ~IOAPIC_ACTIVE_LOW;
+        if ((inti & INTI_POLARITY_MASK) == INTI_POLARITY_LOW) flags |= IOAPIC_ACTIVE_LOW;
+    }
+    if (inti & INTI_TRIGGER_MASK) {
+        flags &= ~IOAPIC_LEVEL;
+        if ((inti & INTI_TRIGGER_MASK) == INTI_TRIGGER_LEVEL) flags |= IOAPIC_LEVEL;
+    }
+
+    return flags;
+}
+
+// Routes the interrupt line of a PCI device (the IRQ the BIOS wrote in its
+// configuration space). We can't read the ACPI _PRT without an AML
+// interpreter, so we rely on the PCI interrupt router sending the line to
+// the IOAPIC input of the same ISA IRQ, as the BIOS set it up: PCI
+// interrupts are level-triggered and active low unless overridden
+void IOAPIC_route_PCI_IRQ(uint8 irq) {
+    if (!IOAPIC_base || irq >= 16) return;
+
+    IOAPIC_route(ACPI_get_info()->IRQ_GSI[irq], IRQ0 + irq, IOAPIC_IRQ_flags(irq, IOAPIC_LEVEL | IOAPIC_ACTIVE_LOW));
+}
+
+static void init_IOAPIC() {
+    ACPIInfo *info = ACPI_get_info();
+
+    map_device_page(info->IOAPIC_address);
+    IOAPIC_base = (volatile uint8*)info->IOAPIC_address;
+
+    IOAPIC_nb_inputs = ((IOAPIC_read(IOAPIC_VERSION) >> 16) & 0xFF) + 1;
+    for (uint i=0; i<IOAPIC_nb_inputs; i++) IOAPIC_write(IOAPIC_REDIRECTION + i * 2, IOAPIC_MASKED);
+
+    // The ISA IRQs (edge-triggered, active high) keep their PIC vectors.
+    // IRQ 0 (the PIT) stays masked: the LAPIC timer is the scheduler tick
+    for (uint8 irq=1; irq<16; irq++) {
+        if (irq == 2) continue;     // The cascade of the 8259
+        IOAPIC_route(info->IRQ_GSI[irq], IRQ0 + irq, IOAPIC_IRQ_flags(irq, 0));
+    }
+
+    // Mask everything on the 8259, we don't use it anymore
+    outportb(0x21, 0xFF);
+    outportb(0xA1, 0xFF);
+}
+
+// Switches the BSP to the APIC if the machine has one. Without the ACPI or
+// MP tables we keep the 8259 and the PIT
+void init_APIC() {
+    ACPIInfo *info = ACPI_get_info();
+    if (info->source == ACPI_SOURCE_NONE) return;
+
+    map_device_page(info->LAPIC_address);
+    init_LAPIC(1);
+    LAPIC_timer_calibrate();
+
+    if (info->IOAPIC_address) init_IOAPIC();
+    else outportb(0x21, inportb(0x21) | 0x01);  // The LAPIC timer replaces the PIT
+}
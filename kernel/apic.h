@@ -0,0 +1,63 @@
+#ifndef __APIC_H
+#define __APIC_H
+
+#include "libc.h"
+
+#define LAPIC_ID                0x0020
+#define LAPIC_VERSION           0x0030
+#define LAPIC_TPR               0x0080  // Task Priority Register
+#define LAPIC_EOI               0x00B0
+#define LAPIC_SVR               0x00F0  // Spurious Interrupt Vector Register
+#define LAPIC_ESR               0x0280  // Error Status Register
+#define LAPIC_ICR_LOW           0x0300  // Interrupt Command Register
+#define LAPIC_ICR_HIGH          0x0310
+#define LAPIC_LVT_TIMER         0x0320
+#define LAPIC_LVT_LINT0         0x0350
+#define LAPIC_LVT_LINT1         0x0360
+#define LAPIC_LVT_ERROR         0x0370
+#define LAPIC_TIMER_INIT        0x0380
+#define LAPIC_TIMER_CURRENT     0x0390
+#define LAPIC_TIMER_DIVIDE      0x03E0
+
+#define LAPIC_SVR_ENABLE        0x100
+#define LAPIC_LVT_MASKED        0x10000
+#define LAPIC_TIMER_PERIODIC    0x20000
+#define LAPIC_TIMER_DIVIDE_16   0x3
+
+// IOAPIC registers, accessed through IOREGSEL/IOWIN
+#define IOAPIC_REGSEL           0x00
+#define IOAPIC_WIN              0x10
+#define IOAPIC_VERSION          0x01
+#define IOAPIC_REDIRECTION      0x10    // 2 registers per input (low, high)
+
+#define IOAPIC_ACTIVE_LOW       0x2000
+#define IOAPIC_LEVEL            0x8000
+#define IOAPIC_MASKED           0x10000
+
+// MPS INTI flags of the ACPI interrupt source overrides
+#define INTI_POLARITY_MASK      0x3
+#define INTI_POLARITY_LOW       0x3
+#define INTI_TRIGGER_MASK       0xC
+#define INTI_TRIGGER_LEVEL      0xC
+
+#define LAPIC_ICR_INIT          0x00000500
+#define LAPIC_ICR_STARTUP       0x00000600
+#define LAPIC_ICR_PENDING       0x00001000
+#define LAPIC_ICR_ASSERT        0x00004000
+#define LAPIC_ICR_LEVEL         0x00008000
+
+// The scheduler tick
+#define LAPIC_TIMER_HZ          100
+
+void init_LAPIC(uint is_BSP);
+uint8 LAPIC_id();
+void LAPIC_eoi();
+void LAPIC_send_IPI(uint8 LAPIC_id, uint command);
+void LAPIC_timer_calibrate();
+void LAPIC_timer_start(uint hz);
+uint LAPIC_is_enabled();
+void init_APIC();
+uint IOAPIC_is_enabled();
+void IOAPIC_route_PCI_IRQ(uint8 irq);
+
+#endif
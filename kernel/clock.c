@@ -0,0 +1,174 @@
+// The clocksource: a monotonic high-resolution clock based on the TSC,
+// calibrated against the PIT at boot, and the wall-clock time read from
+// the RTC (CMOS) at boot and advanced with the TSC.
+//
+// The TSCs of the CPUs are assumed to be synchronized (they are on QEMU and
+// on any CPU with an invariant TSC), so clock_ns() can be compared between
+// CPUs.
+
+#include "libc.h"
+#include "kernel.h"
+#include "clock.h"
+
+#define CMOS_ADDRESS        0x70
+#define CMOS_DATA           0x71
+
+#define RTC_SECONDS         0x00
+#define RTC_MINUTES         0x02
+#define RTC_HOURS           0x04
+#define RTC_DAY             0x07
+#define RTC_MONTH           0x08
+#define RTC_YEAR            0x09
+#define RTC_CENTURY         0x32
+#define RTC_STATUS_A        0x0A
+#define RTC_STATUS_B        0x0B
+
+#define RTC_UPDATING        0x80    // Status A: update in progress
+#define RTC_24H             0x02    // Status B: 24 hour format
+#define RTC_BINARY          0x04    // Status B: binary instead of BCD
+#define RTC_PM              0x80    // Hour bit in 12 hour format
+
+// How long the TSC is calibrated against the PIT
+#define CALIBRATION_MS      50
+
+extern void pit_wait_ms(uint ms);
+
+uint64 clock_boot_cycles = 0;   // The TSC when the clock was initialized
+uint clock_kHz = 0;             // TSC cycles per millisecond
+uint clock_boot_time = 0;       // Unix time when the clock was initialized
+
+uint64 clock_cycles() {
+    return rdtsc() - clock_boot_cycles;
+}
+
+// ns = cycles * 10^6 / kHz, done in two steps so that it doesn't overflow
+uint64 cycles_to_ns(uint64 cycles) {
+    if (!clock_kHz) return 0;
+
+    uint remainder;
+    uint64 ms = udiv64(cycles, clock_kHz, &remainder);
+
+    return ms * 1000000 + udiv64((uint64)remainder * 1000000, clock_kHz, 0);
+}
+
+// Nanoseconds since the boot
+uint64 clock_ns() {
+    return cycles_to_ns(clock_cycles());
+}
+
+uint clock_TSC_kHz() {
+    return clock_kHz;
+}
+
+static uint8 CMOS_read(uint8 reg) {
+    outportb(CMOS_ADDRESS, reg);
+    return inportb(CMOS_DATA);
+}
+
+static uint8 BCD_to_binary(uint8 bcd) {
+    return (bcd & 0x0F) + (bcd >> 4) * 10;
+}
+
+static void RTC_read_raw(DateTime *date, uint8 *century) {
+    while (CMOS_read(RTC_STATUS_A) & RTC_UPDATING);
+
+    date->second = CMOS_read(RTC_SECONDS);
+    date->minute = CMOS_read(RTC_MINUTES);
+    date->hour = CMOS_read(RTC_HOURS);
+    date->day = CMOS_read(RTC_DAY);
+    date->month = CMOS_read(RTC_MONTH);
+    date->year = CMOS_read(RTC_YEAR);
+    *century = CMOS_read(RTC_CENTURY);
+}
+
+// Reads the date from the RTC. The registers can change while we read them,
+// so we read them until we get the same values twice in a row
+void RTC_read(DateTime *date) {
+    DateTime last;
+    uint8 century, last_century;
+
+    RTC_read_raw(date, &century);
+    do {
+        last = *date;
+        last_century = century;
+        RTC_read_raw(date, &century);
+    } while (last.second != date->second || last.minute != date->minute || last.hour != date->hour ||
+             last.day != date->day || last.month != date->month || last.year != date->year ||
+             last_century != century);
+
+    uint8 status = CMOS_read(RTC_STATUS_B);
+    uint8 pm = date->hour & RTC_PM;
+    date->hour &= ~RTC_PM;
+
+    if (!(status & RTC_BINARY)) {
+        date->second = BCD_to_binary(date->second);
+        date->minute = BCD_to_binary(date->minute);
+        date->hour = BCD_to_binary(date->hour);
+        date->day = BCD_to_binary(date->day);
+        date->month = BCD_to_binary(date->month);
+        date->year = BCD_to_binary(date->year);
+        century = BCD_to_binary(century);
+    }
+
+    // In 12-hour mode the hours go 12, 1, ..., 11: 12 AM is 0, 12 PM is 12
+    if (!(status & RTC_24H)) date->hour = (date->hour % 12) + (pm ? 12 : 0);
+
+    // The century register is not always there
+    if (century >= 19 && century <= 30) date->year += century * 100;
+    else date->year += 2000;
+}
+
+// Days since 1970-01-01 (from Howard Hinnant's days_from_civil)
+static uint days_from_civil(uint year, uint month, uint day) {
+    if (month <= 2) year--;
+    uint era = year / 400;
+    uint yoe = year - era * 400;
+    uint doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    uint doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + doe - 719468;
+}
+
+static void civil_from_days(uint days, DateTime *date) {
+    days += 719468;
+    uint era = days / 146097;
+    uint doe = days - era * 146097;
+    uint yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    uint mp = (5 * doy + 2) / 153;
+
+    date->day = doy - (153 * mp + 2) / 5 + 1;
+    date->month = mp < 10 ? mp + 3 : mp - 9;
+    date->year = yoe + era * 400 + (date->month <= 2);
+}
+
+// The Unix time (seconds since 1970-01-01 UTC, assuming the RTC is in UTC)
+uint clock_time() {
+    return clock_boot_time + (uint)udiv64(clock_ns(), 1000000000, 0);
+}
+
+void clock_get_date(DateTime *date) {
+    uint time = clock_time();
+
+    civil_from_days(time / 86400, date);
+    date->hour = (time % 86400) / 3600;
+    date->minute = (time % 3600) / 60;
+    date->second = time % 60;
+}
+
+void init_clock() {
+    // Count the TSC cycles during a PIT-timed interval
+    uint64 start = rdtsc();
+    pit_wait_ms(CALIBRATION_MS);
+    uint64 end = rdtsc();
+
+    clock_kHz = (uint)udiv64(end - start, CALIBRATION_MS, 0);
+    clock_boot_cycles = rdtsc();
+
+    DateTime date;
+    RTC_read(&date);
+    clock_boot_time = days_from_civil(date.year, date.month, date.day) * 86400 +
+                      date.hour * 3600 + date.minute * 60 + date.second;
+
+    printf("TSC: %d MHz\n", clock_kHz / 1000);
+}
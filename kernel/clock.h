@@ -0,0 +1,24 @@
+#ifndef __CLOCK_H
+#define __CLOCK_H
+
+#include "libc.h"
+
+typedef struct {
+	uint16 year;
+	uint8 month;
+	uint8 day;
+	uint8 hour;
+	uint8 minute;
+	uint8 second;
+} DateTime;
+
+void init_clock();
+uint64 clock_cycles();
+uint64 clock_ns();
+uint64 cycles_to_ns(uint64 cycles);
+uint clock_TSC_kHz();
+uint clock_time();
+void clock_get_date(DateTime *date);
+void RTC_read(DateTime *date);
+
+#endif
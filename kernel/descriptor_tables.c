@@ -2,15 +2,17 @@
 #include "kernel.h"
 #include "descriptor_tables.h"
 #include "isr.h"
+#include "smp.h"
+#include "syscall.h"
 
 // Lets us access our ASM functions from our C code.
 extern void gdt_flush(uint);
 extern void idt_flush(uint);
 
 // Internal function prototypes.
-static void init_gdt();
+static void init_gdt(uint);
 static void init_idt();
-static void gdt_set_gate(sint32,uint,uint,uint8,uint8);
+static void gdt_set_gate(uint,sint32,uint,uint,uint8,uint8);
 static void idt_set_gate(uint8,uint,uint16,uint8);
 
 // This structure contains the value of one GDT entry.
@@ -114,9 +116,11 @@ typedef struct __attribute__((packed))
 } TSSEntry;
 
 extern void tss_flush();
-static void write_tss(int,uint16,uint);
+static void write_tss(uint,int,uint16,uint);
 
-TSSEntry tss_entry;
+// Each CPU has its own GDT and TSS: the TSS holds the kernel stack of the
+// process running on that CPU, and a TSS descriptor is marked busy once loaded
+TSSEntry tss_entry[MAX_CPUS];
 
 // These extern directives let us access the addresses of our ASM ISR handlers.
 extern void isr0 ();    // Division by zero
@@ -168,9 +172,12 @@ extern void irq12();
 extern void irq13();
 extern void irq14();
 extern void irq15();
+extern void irq16();
+extern void LAPIC_spurious();
+extern uint irq_MSI_stubs[];
 
-gdt_entry_t gdt_entries[6];
-gdt_ptr_t   gdt_ptr;
+gdt_entry_t gdt_entries[MAX_CPUS][6];
+gdt_ptr_t   gdt_ptr[MAX_CPUS];
 idt_entry_t idt_entries[256];
 idt_ptr_t   idt_ptr;
 
@@ -182,45 +189,52 @@ extern isr_t interrupt_handlers[];
 void init_descriptor_tables()
 {
 
-    // Initialise the global descriptor table.
-    init_gdt();
+    // Initialise the global descriptor table of the BSP.
+    init_gdt(0);
     // Initialise the interrupt descriptor table.
     init_idt();
     // Nullify all the interrupt handlers.
     memset((void*)&interrupt_handlers, 0, sizeof(isr_t)*256);
 }
 
-static void init_gdt()
+// Called by each AP: it gets its own GDT and TSS but shares the IDT
+void init_descriptor_tables_AP(uint cpu)
 {
-    gdt_ptr.limit = (sizeof(gdt_entry_t) * 6) - 1;
-    gdt_ptr.base  = (uint)&gdt_entries;
+    init_gdt(cpu);
+    idt_flush((uint)&idt_ptr);
+}
 
-    gdt_set_gate(0, 0, 0, 0, 0);                // Null segment
-    gdt_set_gate(1, 0, 0xFFFFFFFF, 0x9A, 0xCF); // Code segment
-    gdt_set_gate(2, 0, 0xFFFFFFFF, 0x92, 0xCF); // Data segment
-    gdt_set_gate(3, 0, 0xFFFFFFFF, 0xFA, 0xCF); // User mode code segment
-    gdt_set_gate(4, 0, 0xFFFFFFFF, 0xF2, 0xCF); // User mode data segment
-    write_tss(5, 0x10, 0x10);
+static void init_gdt(uint cpu)
+{
+    gdt_ptr[cpu].limit = (sizeof(gdt_entry_t) * 6) - 1;
+    gdt_ptr[cpu].base  = (uint)&gdt_entries[cpu];
 
-    gdt_flush((uint)&gdt_ptr);
+    gdt_set_gate(cpu, 0, 0, 0, 0, 0);                // Null segment
+    gdt_set_gate(cpu, 1, 0, 0xFFFFFFFF, 0x9A, 0xCF); // Code segment
+    gdt_set_gate(cpu, 2, 0, 0xFFFFFFFF, 0x92, 0xCF); // Data segment
+    gdt_set_gate(cpu, 3, 0, 0xFFFFFFFF, 0xFA, 0xCF); // User mode code segment
+    gdt_set_gate(cpu, 4, 0, 0xFFFFFFFF, 0xF2, 0xCF); // User mode data segment
+    write_tss(cpu, 5, 0x10, 0x10);
+
+    gdt_flush((uint)&gdt_ptr[cpu]);
     tss_flush();
 }
 
-// Initialise our task state segment structure.
-static void write_tss(int num, uint16 ss0, uint esp0)
+// Initialise the task state segment structure of a CPU.
+static void write_tss(uint cpu, int num, uint16 ss0, uint esp0)
 {
    // Firstly, let's compute the base and limit of our entry into the GDT.
-   uint base = (uint) &tss_entry;
-   uint limit = base + sizeof(tss_entry);
+   uint base = (uint) &tss_entry[cpu];
+   uint limit = base + sizeof(TSSEntry);
 
    // Now, add our TSS descriptor's address to the GDT.
-   gdt_set_gate(num, base, limit, 0xE9, 0x00);
+   gdt_set_gate(cpu, num, base, limit, 0xE9, 0x00);
 
    // Ensure the descriptor is initially zero.
-   memset(&tss_entry, 0, sizeof(tss_entry));
+   memset(&tss_entry[cpu], 0, sizeof(TSSEntry));
 
-   tss_entry.ss0  = ss0;  // Set the kernel stack segment.
-   tss_entry.esp0 = esp0; // Set the kernel stack pointer.
+   tss_entry[cpu].ss0  = ss0;  // Set the kernel stack segment.
+   tss_entry[cpu].esp0 = esp0; // Set the kernel stack pointer.
 
    // Here we set the cs, ss, ds, es, fs and gs entries in the TSS. These specify what
    // segments should be loaded when the processor switches to kernel mode. Therefore
@@ -228,27 +242,31 @@ static void write_tss(int num, uint16 ss0, uint esp0)
    // but with the last two bits set, making 0x0b and 0x13. The setting of these bits
    // sets the RPL (requested privilege level) to 3, meaning that this TSS can be used
    // to switch to kernel mode from ring 3.
-   tss_entry.cs   = 0x0b;
-   tss_entry.ss = tss_entry.ds = tss_entry.es = tss_entry.fs = tss_entry.gs = 0x13;
+   tss_entry[cpu].cs   = 0x0b;
+   tss_entry[cpu].ss = tss_entry[cpu].ds = tss_entry[cpu].es = tss_entry[cpu].fs = tss_entry[cpu].gs = 0x13;
 }
 
+// Sets the kernel stack of the CPU we are running on
 void set_kernel_stack(void *stack)
 {
-   tss_entry.esp0 = (uint)stack;
+   tss_entry[cpu_current()->id].esp0 = (uint)stack;
+   sysenter_set_stack((uint)stack);
 }
 
 // Set the value of one GDT entry.
-static void gdt_set_gate(int num, uint base, uint limit, uint8 access, uint8 gran)
+static void gdt_set_gate(uint cpu, int num, uint base, uint limit, uint8 access, uint8 gran)
 {
-    gdt_entries[num].base_low    = (base & 0xFFFF);
-    gdt_entries[num].base_middle = (base >> 16) & 0xFF;
-    gdt_entries[num].base_high   = (base >> 24) & 0xFF;
+    gdt_entry_t *gdt = gdt_entries[cpu];
+
+    gdt[num].base_low    = (base & 0xFFFF);
+    gdt[num].base_middle = (base >> 16) & 0xFF;
+    gdt[num].base_high   = (base >> 24) & 0xFF;
 
-    gdt_entries[num].limit_low   = (limit & 0xFFFF);
-    gdt_entries[num].granularity = (limit >> 16) & 0x0F;
+    gdt[num].limit_low   = (limit & 0xFFFF);
+    gdt[num].granularity = (limit >> 16) & 0x0F;
     
-    gdt_entries[num].granularity |= gran & 0xF0;
-    gdt_entries[num].access      = access;
+    gdt[num].granularity |= gran & 0xF0;
+    gdt[num].access      = access;
 }
 
 static void init_idt()
@@ -318,6 +336,9 @@ static void init_idt()
     idt_set_gate(45, (uint)irq13, 0x08, 0x8E);
     idt_set_gate(46, (uint)irq14, 0x08, 0x8E);
     idt_set_gate(47, (uint)irq15, 0x08, 0x8E);
+    idt_set_gate(IRQ_LAPIC_TIMER, (uint)irq16, 0x08, 0x8E);
+    idt_set_gate(IRQ_LAPIC_SPURIOUS, (uint)LAPIC_spurious, 0x08, 0x8E);
+    for (uint i=IRQ_MSI_FIRST; i<=IRQ_MSI_LAST; i++) idt_set_gate(i, irq_MSI_stubs[i - IRQ_MSI_FIRST], 0x08, 0x8E);
     idt_set_gate(128, (uint)isr128, 0x08, 0x8E);
 
     idt_flush((uint)&idt_ptr);
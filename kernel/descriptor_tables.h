@@ -2,6 +2,7 @@
 #define DESCRIPTOR_TABLES_H
 
 void init_descriptor_tables();
+void init_descriptor_tables_AP(uint cpu);
 void set_kernel_stack(void *stack);
 
 #endif
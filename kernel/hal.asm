@@ -144,6 +144,34 @@ IRQ  12,    44
 IRQ  13,    45
 IRQ  14,    46
 IRQ  15,    47
+IRQ  16,    48              ; LAPIC timer
+
+; The MSI vectors (IRQ_MSI_FIRST to IRQ_MSI_LAST), given to the PCI devices
+IRQ  17,    49
+IRQ  18,    50
+IRQ  19,    51
+IRQ  20,    52
+IRQ  21,    53
+IRQ  22,    54
+IRQ  23,    55
+IRQ  24,    56
+IRQ  25,    57
+IRQ  26,    58
+IRQ  27,    59
+IRQ  28,    60
+IRQ  29,    61
+IRQ  30,    62
+IRQ  31,    63
+
+global irq_MSI_stubs
+irq_MSI_stubs:
+    dd irq17, irq18, irq19, irq20, irq21, irq22, irq23, irq24
+    dd irq25, irq26, irq27, irq28, irq29, irq30, irq31
+
+; Spurious interrupts from the local APIC must not be acknowledged
+global LAPIC_spurious
+LAPIC_spurious:
+    iret
 
 ; In isr.c
 extern isr_handler
@@ -163,7 +191,9 @@ isr_common_stub:
     mov fs, ax
     mov gs, ax
 
+    push esp                 ; registers_t *: the frame we just built
     call isr_handler
+    add esp, 4
 
     pop ebx        ; reload the original data segment descriptor
     mov ds, bx
@@ -194,7 +224,9 @@ irq_common_stub:
     mov fs, ax
     mov gs, ax
 
+    push esp                 ; registers_t *: the frame we just built
     call irq_handler
+    add esp, 4
 
     pop ebx        ; reload the original data segment descriptor
     mov ds, bx
@@ -270,6 +302,50 @@ jump_usermode:
      push shell ;may need to remove the _ for this to work right 
      iret
 
+; The return address of the _start() function of the user programs (see
+; elf_exec): calls the exit syscall, which does not come back
+[GLOBAL user_exit_stub]
+user_exit_stub:
+    mov eax, 1
+    int 0x80
+    jmp user_exit_stub
+
+; SYSENTER lands here with the kernel stack of the process (the
+; SYSENTER_ESP MSR) and interrupts off. EAX is the syscall number, EBX, ESI
+; and EDI arguments 1, 4 and 5 and EBP the user stack (see lib/syscall.h)
+[EXTERN sysenter_handler]
+[GLOBAL sysenter_entry]
+sysenter_entry:
+    push ebp              ; user_stack
+    push edi
+    push esi
+    push ebx
+    push eax
+    mov dx, 0x10          ; Kernel data segments, as in isr_common_stub
+    mov ds, dx
+    mov es, dx
+    mov fs, dx
+    mov gs, dx
+
+    call sysenter_handler ; The return value stays in EAX
+
+    add esp, 4
+    pop ebx
+    pop esi
+    pop edi
+    pop ecx               ; user_stack
+
+    mov dx, 0x23
+    mov ds, dx
+    mov es, dx
+    mov fs, dx
+    mov gs, dx
+
+    mov edx, [ecx]        ; Return address
+    add ecx, 4            ; SYSEXIT: EIP = EDX, ESP = ECX
+    sti                   ; Only takes effect after the next instruction
+    sysexit
+
 [EXTERN syscall_handler2]
 [GLOBAL syscall]
 syscall:
@@ -1,8 +1,23 @@
 #include "libc.h"
 #include "kernel.h"
 #include "isr.h"
+#include "apic.h"
 
-isr_t interrupt_handlers[256];
+#define MAX_INTERRUPT_HANDLERS  64
+
+typedef struct interrupt_handler_t {
+    isr_t handler;
+    struct interrupt_handler_t *next;
+} InterruptHandler;
+
+// The handlers of each vector are chained, their nodes come from a pool:
+// they are registered at boot and never removed
+static InterruptHandler handler_pool[MAX_INTERRUPT_HANDLERS];
+static uint nb_handlers = 0;
+
+InterruptHandler *interrupt_handlers[256];
+InterruptStats interrupt_stats[256];
+uint8 interrupt_switches[256];
 
 const char *int_msg[19] = {
     "Division by zero",
@@ -28,50 +43,117 @@ const char *int_msg[19] = {
 
 void register_interrupt_handler(uint8 n, isr_t handler)
 {
-    interrupt_handlers[n] = handler;
+    if (nb_handlers >= MAX_INTERRUPT_HANDLERS) {
+        printf("Too many interrupt handlers\n");
+        return;
+    }
+
+    InterruptHandler *node = &handler_pool[nb_handlers++];
+    node->handler = handler;
+    node->next = 0;
+
+    // The node is complete before it is linked, an interrupt can come anytime
+    InterruptHandler **last = &interrupt_handlers[n];
+    while (*last) last = &(*last)->next;
+    *last = node;
+}
+
+void register_switching_handler(uint8 n, isr_t handler)
+{
+    interrupt_switches[n] = 1;
+    register_interrupt_handler(n, handler);
+}
+
+InterruptStats *interrupt_get_stats(uint8 n)
+{
+    return &interrupt_stats[n];
+}
+
+static uint8 next_MSI_vector = IRQ_MSI_FIRST;
+
+// A vector of its own for a device, 0 if there are none left
+uint8 interrupt_alloc_vector()
+{
+    if (next_MSI_vector > IRQ_MSI_LAST) return 0;
+    return next_MSI_vector++;
+}
+
+// Calls the handlers of a vector and samples how long they take
+static void interrupt_dispatch(registers_t *regs, uint8 int_no)
+{
+    InterruptStats *stats = &interrupt_stats[int_no];
+    __sync_fetch_and_add(&stats->count, 1);
+
+    if (interrupt_switches[int_no]) {
+        for (InterruptHandler *node = interrupt_handlers[int_no]; node; node = node->next) node->handler(regs);
+        return;
+    }
+
+    uint64 start = rdtsc();
+    for (InterruptHandler *node = interrupt_handlers[int_no]; node; node = node->next) node->handler(regs);
+    uint cycles = (uint)(rdtsc() - start);
+
+    // Only a sample: two CPUs can race here, one of the values wins
+    if (cycles > stats->max_cycles) stats->max_cycles = cycles;
 }
 
 // This gets called from our ASM interrupt handler stub.
-void isr_handler(registers_t regs)
+void isr_handler(registers_t *regs)
 {
-    uint8 int_no = regs.int_no & 0xFF;
+    uint8 int_no = regs->int_no & 0xFF;
     if (interrupt_handlers[int_no] != 0)
     {
-        isr_t handler = interrupt_handlers[int_no];
-        handler(regs);
+        interrupt_dispatch(regs, int_no);
     }
     else
     {
-        // We have an unhandled interruption (regs.int_no)
+        // We have an unhandled interruption (regs->int_no)
         printf("Unhandled interruption: ");
-        if (int_no <= 18) printf("%s\n", int_msg[regs.int_no]);
-        else printf("%d\n", regs.int_no);
+        if (int_no <= 18) printf("%s\n", int_msg[int_no]);
+        else printf("%d\n", int_no);
 
-        printf("ss %d\n", regs.ss);
+        printf("ss %d\n", regs->ss);
 
 //        stack_dump();
-        C_stack_dump((void*)regs.esp, (void*)regs.ebp);
+        C_stack_dump((void*)regs->esp, (void*)regs->ebp);
         for (;;);
     }
 }
 
 // This gets called from our ASM interrupt handler stub.
-void irq_handler(registers_t regs)
+void irq_handler(registers_t *regs)
 {
-    // Send an EOI (end of interrupt) signal to the PICs.
-    // If this interrupt involved the slave.
-    if (regs.int_no >= 40)
+    uint8 int_no = regs->int_no & 0xFF;
+
+    // With the IOAPIC everything is acknowledged to the LAPIC. The EOI comes
+    // after the handler, otherwise a level-triggered line which the handler
+    // has not cleared yet would fire again right away. Except for the timer,
+    // whose handler switches to another process
+    if (IOAPIC_is_enabled() && int_no != IRQ_LAPIC_TIMER)
     {
-        // Send reset signal to slave.
-        outportb(0xA0, 0x20);
+        if (interrupt_handlers[int_no] != 0) interrupt_dispatch(regs, int_no);
+
+        LAPIC_eoi();
+        return;
     }
-    // Send reset signal to master. (As well as slave, if necessary).
-    outportb(0x20, 0x20);
 
-    if (interrupt_handlers[regs.int_no] != 0)
+    // Interrupts coming from the local APIC are acknowledged there
+    if (int_no >= IRQ_LAPIC_TIMER)
+    {
+        LAPIC_eoi();
+    }
+    else
     {
-        isr_t handler = interrupt_handlers[regs.int_no];
-        handler(regs);
+        // Send an EOI (end of interrupt) signal to the PICs.
+        // If this interrupt involved the slave.
+        if (int_no >= 40)
+        {
+            // Send reset signal to slave.
+            outportb(0xA0, 0x20);
+        }
+        // Send reset signal to master. (As well as slave, if necessary).
+        outportb(0x20, 0x20);
     }
 
+    if (interrupt_handlers[int_no] != 0) interrupt_dispatch(regs, int_no);
 }
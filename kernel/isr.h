@@ -19,6 +19,14 @@
 #define IRQ14 46
 #define IRQ15 47
 
+// Interrupts delivered by the local APICs
+#define IRQ_LAPIC_TIMER 48
+#define IRQ_LAPIC_SPURIOUS 0xFF
+
+// Vectors given to the PCI devices using MSI (see interrupt_alloc_vector())
+#define IRQ_MSI_FIRST 49
+#define IRQ_MSI_LAST 63
+
 typedef struct registers
 {
     uint ds;                  // Data segment selector
@@ -29,8 +37,24 @@ typedef struct registers
 
 // Enables registration of callbacks for interrupts or IRQs.
 // For IRQs, to ease confusion, use the #defines above as the
-// first parameter.
-typedef void (*isr_t)(registers_t);
+// first parameter. The handlers get a pointer to the frame saved by the
+// stub, what they change in it is restored when the interrupt returns.
+// Several handlers can share a vector (e.g. PCI lines), they are called
+// in the order they were registered
+typedef void (*isr_t)(registers_t *regs);
 void register_interrupt_handler(uint8 n, isr_t handler);
 
+// For the handlers which may switch to another process (the scheduler
+// tick, the syscalls): their latency is not sampled, as the handler only
+// returns when the interrupted process runs again
+void register_switching_handler(uint8 n, isr_t handler);
+
+typedef struct {
+    uint count;                 // Number of interrupts
+    uint max_cycles;            // Longest time spent in the handlers (TSC cycles)
+} InterruptStats;
+
+InterruptStats *interrupt_get_stats(uint8 n);
+uint8 interrupt_alloc_vector();
+
 #endif
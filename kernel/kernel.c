@@ -10,6 +10,8 @@
 #include "process.h"
 #include "descriptor_tables.h"
 #include "syscall.h"
+#include "e1000.h"
+#include "tcp.h"
 
 unsigned char inportb (unsigned short _port)
 {
@@ -78,6 +80,11 @@ extern void jump_usermode();
 extern void init_syscalls();
 extern void init_PCI();
 extern void init_network();
+extern void init_ACPI();
+extern void init_APIC();
+extern void init_SMP();
+extern void init_clock();
+extern void init_vdso();
 
 int main (uint esp) {
     // We save the first ESP pointer to have an idea of the
@@ -92,12 +99,19 @@ int main (uint esp) {
     init_mouse();
     init_keyboard();
     init_debug();
+    init_ACPI();
     init_virtualmem();
+    init_APIC();
+    init_SMP();
+    init_clock();
+    init_vdso();
     init_syscalls();
     init_PCI();
     init_network();
     init_tasking();
     init_scheduler();
+    E1000_start_polling();
+    TCP_start_timers();
 
     // Launch a new process
     int ret = fork();
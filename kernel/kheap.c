@@ -15,7 +15,7 @@ void init_kheap() {
 }
 
 void* kmalloc_pages(uint nb_pages, const char *name) {
-	heap_alloc_pages(nb_pages, name, &kheap);
+	return heap_alloc_pages(nb_pages, name, &kheap);
 }
 
 void* kmalloc(uint nb_bytes) {
@@ -0,0 +1,79 @@
+// A mutex built on the scheduler: a process which can't get the mutex is
+// flagged PROCESS_BLOCKED, which makes switch_process() skip it, and yields
+// the CPU. Releasing the mutex wakes up the first waiting process.
+
+#include "libc.h"
+#include "mutex.h"
+#include "process.h"
+
+void mutex_init(Mutex *mutex) {
+    spinlock_init(&mutex->lock);
+    mutex->owner = 0;
+    mutex->waiters = 0;
+    mutex->waiters_last = 0;
+}
+
+void mutex_lock(Mutex *mutex) {
+    uint eflags = spinlock_lock_irqsave(&mutex->lock);
+
+    while (mutex->owner) {
+        Process *ps = (Process*)current_process;
+
+        // Join the queue of waiting processes, unless we are still in it:
+        // switch_process() comes back to a blocked process when the BSP
+        // has nothing else to run
+        if (!(ps->flags & PROCESS_WAITING)) {
+            ps->wait_next = 0;
+            if (mutex->waiters) mutex->waiters_last->wait_next = ps;
+            else mutex->waiters = ps;
+            mutex->waiters_last = ps;
+
+            __sync_fetch_and_or(&ps->flags, PROCESS_WAITING | PROCESS_BLOCKED);
+        }
+
+        // The interrupts stay disabled until switch_process() has saved our
+        // context, so a wake up from another CPU can't be missed: at worst
+        // we are scheduled again and check the mutex once more
+        spinlock_unlock(&mutex->lock);
+        switch_process();
+
+        // Still blocked: nothing else could run, wait for an interrupt
+        if (ps->flags & PROCESS_BLOCKED) asm volatile("sti; hlt");
+
+        eflags = spinlock_lock_irqsave(&mutex->lock);
+    }
+
+    mutex->owner = current_process;
+    spinlock_unlock_irqrestore(&mutex->lock, eflags);
+}
+
+int mutex_trylock(Mutex *mutex) {
+    int locked = 0;
+    uint eflags = spinlock_lock_irqsave(&mutex->lock);
+
+    if (!mutex->owner) {
+        mutex->owner = current_process;
+        locked = 1;
+    }
+
+    spinlock_unlock_irqrestore(&mutex->lock, eflags);
+    return locked;
+}
+
+void mutex_unlock(Mutex *mutex) {
+    uint eflags = spinlock_lock_irqsave(&mutex->lock);
+
+    mutex->owner = 0;
+
+    // Wake up the first waiting process, it will compete for the mutex
+    // with whoever asks for it in the meantime
+    Process *ps = mutex->waiters;
+    if (ps) {
+        mutex->waiters = ps->wait_next;
+        if (!mutex->waiters) mutex->waiters_last = 0;
+        ps->wait_next = 0;
+        __sync_fetch_and_and(&ps->flags, ~(PROCESS_WAITING | PROCESS_BLOCKED));
+    }
+
+    spinlock_unlock_irqrestore(&mutex->lock, eflags);
+}
@@ -0,0 +1,25 @@
+#ifndef __MUTEX_H
+#define __MUTEX_H
+
+#include "libc.h"
+#include "spinlock.h"
+
+struct process_t;
+
+// A sleeping lock: the processes waiting for it are taken out of the
+// scheduler until it is released. It can't be used by interrupt handlers
+typedef struct {
+    Spinlock lock;                      // Protects the fields below
+    volatile struct process_t *owner;
+    struct process_t *waiters;          // The processes waiting for the mutex (FIFO)
+    struct process_t *waiters_last;
+} Mutex;
+
+#define MUTEX_INIT { SPINLOCK_INIT, 0, 0, 0 }
+
+void mutex_init(Mutex *mutex);
+void mutex_lock(Mutex *mutex);
+int mutex_trylock(Mutex *mutex);
+void mutex_unlock(Mutex *mutex);
+
+#endif
@@ -6,19 +6,19 @@
 #include "process.h"
 #include "virtualmem.h"
 #include "display.h"
+#include "vdso.h"
 #include "gui_window.h"
 #include "text_window.h"
 #include "gui_mouse.h"
 #include "descriptor_tables.h"
 
 uint next_pid = 0;
-extern PageDirectory *current_page_directory;
 
 // For now we are statically allocating the process structures
 char pad[7];
-Process processes[3];
+Process processes[MAX_PROCESSES];
+Spinlock processes_lock = SPINLOCK_INIT;
 //process *process_focus;		           // The process which has user focus
-volatile Process *current_process;  // The process which gets CPU cycles
 
 extern uint initial_esp;
 
@@ -55,6 +55,8 @@ void switch_to_user_mode()
 
 // For now we're hard-coding 2 processes
 void init_processes() {
+	for (int i=0; i<MAX_PROCESSES; i++) ring_init(&processes[i].input, processes[i].input_slots, PROCESS_INPUT_SIZE);
+
 	processes[0].pid = 0;
 	processes[1].pid = 1;
   processes[0].function = shell;
@@ -73,30 +75,149 @@ void init_processes() {
 	current_process = &processes[0];
 }
 
+// Whether a CPU is running the process (or is about to switch from it)
+static int process_is_running(Process *ps) {
+    for (uint i=0; i<cpu_count(); i++) {
+        if (cpu_get(i)->current == ps) return 1;
+    }
+
+    return 0;
+}
+
+// Returns a process structure: a new one, or the one of a process which has
+// exited and has been removed from its run queue
+static Process *alloc_process() {
+    Process *ps = 0;
+    uint eflags = spinlock_lock_irqsave(&processes_lock);
+
+    if (nb_processes < MAX_PROCESSES) {
+        ps = &processes[nb_processes++];
+        ps->stack = (unsigned char *)kmalloc_pages(PROCESS_STACK_SIZE / 0x1000, "Process stack");
+    } else {
+        for (int i=0; i<MAX_PROCESSES; i++) {
+            if ((processes[i].flags & PROCESS_EXITED) && !processes[i].cpu && !process_is_running(&processes[i])) {
+                ps = &processes[i];
+                // Its stack is kept
+                if (ps->page_dir) free_page_directory(ps->page_dir);
+                ps->flags = 0;
+                break;
+            }
+        }
+    }
+
+    spinlock_unlock_irqrestore(&processes_lock, eflags);
+    return ps;
+}
+
 Process *get_new_process(PageDirectory *dir) {
-    Process *ps = &processes[nb_processes];
-    if (current_process) current_process->next = ps;
-    ps->next = &processes[0];
-    ps->stack = (unsigned char *)kmalloc_pages(PROCESS_STACK_SIZE / 0x1000, "Process stack");
+    Process *ps = alloc_process();
+    if (!ps) {
+        printf("Too many processes\n");
+        return 0;
+    }
+
+    ps->next = ps;
 //    memset(ps->stack, 0, PROCESS_STACK_SIZE);
-    ps->pid = nb_processes++;
+    ps->pid = __sync_fetch_and_add(&next_pid, 1);
     ps->esp = 0;
     ps->ebp = 0;
     ps->eip = 0;
     ps->page_dir = dir;
     ps->flags = 0;
-    ps->buffer = 0;
+    ps->cpu = 0;
+    ps->wait_next = 0;
+    ps->user_entry = 0;
+    ps->user_stack = 0;
+    ps->user_brk = 0;
+    ps->wake_tick = 0;
+    memset(&ps->stats, 0, sizeof(ProcessStats));
+    ring_init(&ps->input, ps->input_slots, PROCESS_INPUT_SIZE);
 
     return ps;
 }
 
+// Inserts a process in the run queue of a CPU (a circular linked list),
+// right after the process currently running there
+static void runqueue_add(CPU *cpu, Process *ps) {
+    uint eflags = spinlock_lock_irqsave(&cpu->runqueue_lock);
+    ps->cpu = cpu;
+
+    if (!cpu->current || cpu->current == ps) {
+        ps->next = ps;
+        cpu->current = ps;
+    } else {
+        ps->next = cpu->current->next;
+        cpu->current->next = ps;
+    }
+
+    cpu->nb_processes++;
+    spinlock_unlock_irqrestore(&cpu->runqueue_lock, eflags);
+}
+
+uint process_count() {
+    return nb_processes;
+}
+
+Process *process_get(uint index) {
+    return &processes[index];
+}
+
+// Called on every timer tick of a CPU, before switch_process()
+void process_account_tick(uint user_mode) {
+    CPU *cpu = cpu_current();
+    Process *ps = (Process*)cpu->current;
+    if (!ps) return;
+
+    uint64 now = rdtsc();
+    ps->stats.runtime_cycles += now - cpu->switch_cycles;
+    cpu->switch_cycles = now;
+
+    if (user_mode) ps->stats.user_ticks++;
+    else ps->stats.kernel_ticks++;
+
+    // The other processes of the run queue are either waiting for the CPU or for an event
+    spinlock_lock(&cpu->runqueue_lock);
+    for (Process *other = ps->next; other != ps; other = other->next) {
+        if (other == cpu->idle) continue;
+
+        if (other->flags & (PROCESS_POLLING | PROCESS_BLOCKED)) other->stats.blocked_ticks++;
+        else other->stats.runnable_ticks++;
+    }
+    spinlock_unlock(&cpu->runqueue_lock);
+}
+
+// Called by the BSP on every timer tick: wakes up the processes which poll
+// until ticks. A process which sets another wake_tick meanwhile keeps it
+void process_wake_sleepers(uint ticks) {
+    for (uint i=0; i<nb_processes; i++) {
+        Process *ps = &processes[i];
+        uint tick = ps->wake_tick;
+
+        if (tick && (int)(ticks - tick) >= 0 && __sync_bool_compare_and_swap(&ps->wake_tick, tick, 0))
+            __sync_fetch_and_and(&ps->flags, ~PROCESS_POLLING);
+    }
+}
+
+// Gives a process to the online CPU with the fewest processes
+void schedule_process(Process *ps) {
+    CPU *cpu = cpu_get(0);
+
+    for (uint i=1; i<cpu_count(); i++) {
+        CPU *other = cpu_get(i);
+        if (other->online && other->nb_processes < cpu->nb_processes) cpu = other;
+    }
+
+    runqueue_add(cpu, ps);
+}
+
 void init_tasking()
 {
     // Disable interrupts
     asm volatile("cli");
 
-    // Initialise the first process
-    current_process = get_new_process(current_page_directory);
+    // Initialise the first process, it stays on the BSP
+    runqueue_add(cpu_current(), get_new_process(current_page_directory));
+    cpu_current()->switch_cycles = rdtsc();
 
     // Relocate the stack so we know where it is.
 //    move_stack((char*)&current_process->eax, 0x2000);
@@ -234,19 +355,16 @@ void copy_stack(void *new_stack_start, void *old_stack_start)
 
 }
 
-// We're using static variable to avoid messing up with the
-// stack at a time where we are relocating the stack
-uint esp_global;
-uint ebp_global;
-uint eip_global;
-
 void switch_process()
 {
     // Disable interrupts
     asm volatile("cli");
 
+    // Every CPU switches between the processes of its own run queue
+    CPU *cpu = cpu_current();
+
     // If there is no current process, do nothing
-    if (!current_process)
+    if (!cpu->current)
         return;
 
     // Read the ESP, EBP and EIP registers
@@ -267,44 +385,85 @@ void switch_process()
         return;
     }
 
+    // Other CPUs may be adding processes to our run queue
+    spinlock_lock(&cpu->runqueue_lock);
+
+    // Get the next process. The processes are linked in a circular linked list
+    Process *new_process = cpu->current->next;
+    // We skip processes that are polling (e.g. waiting for the keyboard) or
+    // blocked on a mutex as there is no need to spend cycles on them,
+    // and the idle process
+    while ((new_process->flags & (PROCESS_POLLING | PROCESS_BLOCKED | PROCESS_EXITED) || new_process == cpu->idle) &&
+           new_process != cpu->current) new_process = new_process->next;
+
+    if (new_process == cpu->current) {
+        if (cpu->idle) {
+            // On the APs, a process with nothing else to compete with keeps the CPU,
+            // and the CPU goes idle when all its processes are waiting
+            if (!(cpu->current->flags & (PROCESS_POLLING | PROCESS_BLOCKED | PROCESS_EXITED))) {
+                spinlock_unlock(&cpu->runqueue_lock);
+                asm volatile("sti");
+                return;
+            }
+            new_process = cpu->idle;
+        }
+        // if all processes are polling, go on with the next one which isn't
+        // blocked on a mutex (the BSP always has the first shell, which never
+        // exits). Without any, stay on the current process: a blocked or
+        // exited process waits for an interrupt and calls us again
+        else {
+            new_process = cpu->current->next;
+            while (new_process->flags & (PROCESS_BLOCKED | PROCESS_EXITED) && new_process != cpu->current)
+                new_process = new_process->next;
+
+            if (new_process == cpu->current) {
+                spinlock_unlock(&cpu->runqueue_lock);
+                asm volatile("sti");
+                return;
+            }
+        }
+    }
+
+    // An exited process leaves the run queue
+    if (cpu->current->flags & PROCESS_EXITED) {
+        Process *prev = new_process;
+        while (prev->next != cpu->current) prev = prev->next;
+        prev->next = cpu->current->next;
+        cpu->current->cpu = 0;
+        cpu->nb_processes--;
+    }
+
+    // Charge the time spent on the CPU. A process which was waiting for
+    // something gave up the CPU, the others are preempted
+    uint64 now = rdtsc();
+    current_process->stats.runtime_cycles += now - cpu->switch_cycles;
+    cpu->switch_cycles = now;
+    if (current_process->flags & (PROCESS_POLLING | PROCESS_BLOCKED)) current_process->stats.voluntary_switches++;
+    else current_process->stats.involuntary_switches++;
+
     // We haven't switched context yet
     // So we save the registers in the process structure
     current_process->eip = eip;
     current_process->esp = esp;
     current_process->ebp = ebp;
-/*
-    debug_i("Before switch to ESP: ", esp);
-    debug_i("EBP: ", ebp);
-    debug_i("EIP: ", eip);
-  */
-
-    // Get the next process. The processes are linked in a circular linked list
-    Process *new_process = current_process->next;
-    // We skip processes that are polling (e.g. waiting for the keyboard)
-    // as there is no need to spend cycles on them
-    while (new_process->flags & PROCESS_POLLING &&
-           new_process != current_process) new_process = new_process->next;
-    // if all processes are polling, stay on the current process
-    if (new_process == current_process) current_process = current_process->next;
-    else current_process = new_process;
 
     // Retrieves the values for the new current process
-    eip_global = current_process->eip;
-    esp_global = current_process->esp;
-    ebp_global = current_process->ebp;
-    current_page_directory = current_process->page_dir;
-    set_kernel_stack((void*)&current_process->eip);
-
-/*
-    debug_i("Switch to ESP: ", esp_global);
-    debug_i("EBP: ", ebp_global);
-    debug_i("EIP: ", eip_global);
-    */
-//    debug_i("Page dir: ", (uint)current_page_directory);
+    // They are kept in the CPU structure to avoid messing up with the
+    // stack at a time where we are relocating the stack
+    cpu->current = new_process;
+    spinlock_unlock(&cpu->runqueue_lock);
+    cpu->eip_global = new_process->eip;
+    cpu->esp_global = new_process->esp;
+    cpu->ebp_global = new_process->ebp;
+    cpu->page_dir = new_process->page_dir;
+
+    // Interrupts from ring 3 switch to the kernel stack of the process
+    if (new_process->user_entry) set_kernel_stack(new_process->kernel_stack + PROCESS_STACK_SIZE);
+    else set_kernel_stack((void*)&new_process->eip);
 
     // We set the PROCESS_EXIT_NOW for the new current process to exit the fork() or
     // switch_process() functions as soon as it gets there
-    current_process->flags |= PROCESS_EXIT_NOW;
+    new_process->flags |= PROCESS_EXIT_NOW;
 
     // - Sets the ESP and EBP pointers to the saved values for the new current process
     // - Sets the CR3 pointer to point to the new page directory
@@ -318,7 +477,97 @@ void switch_process()
       mov %3, %%eax;       \
       sti;                 \
       jmp *%%eax           "
-                 : : "r"(esp_global), "r"(ebp_global), "r"(current_page_directory), "r"(eip_global));
+                 : : "r"(cpu->esp_global), "r"(cpu->ebp_global), "r"(cpu->page_dir), "r"(cpu->eip_global));
+}
+
+// The first code a user mode process runs, on its kernel stack, right after
+// switch_process() jumped to it: drops to ring 3 at the entry point
+static void user_process_entry()
+{
+    Process *ps = (Process*)current_process;
+    __sync_fetch_and_and(&ps->flags, ~PROCESS_EXIT_NOW);
+
+    // Same as switch_to_user_mode() but with the process stack and entry point
+    asm volatile("          \
+      mov $0x23, %%ax;      \
+      mov %%ax, %%ds;       \
+      mov %%ax, %%es;       \
+      mov %%ax, %%fs;       \
+      mov %%ax, %%gs;       \
+      pushl $0x23;          \
+      pushl %0;             \
+      pushl $0x202;         \
+      pushl $0x1B;          \
+      pushl %1;             \
+      iret                  "
+                 : : "r"(ps->user_stack), "r"(ps->user_entry) : "eax");
+}
+
+// Starts a new process in its own address space, running in ring 3 from
+// entry with the stack pointer user_stack. It shares the window of the
+// process which starts it. Returns its PID, or -1
+int start_user_process(PageDirectory *dir, uint entry, uint user_stack)
+{
+    Process *ps = get_new_process(dir);
+    if (!ps) return -1;
+
+    vdso_map(dir, ps->pid);
+
+    ps->win = current_process->win;
+    ps->user_entry = entry;
+    ps->user_stack = user_stack;
+
+    // switch_process() will jump to user_process_entry() with this stack
+    ps->esp = (uint)ps->stack + PROCESS_STACK_SIZE - 16;
+    ps->ebp = 0;
+    ps->eip = (uint)user_process_entry;
+
+    schedule_process(ps);
+    return ps->pid;
+}
+
+// The first code a kernel process runs, see start_kernel_process()
+static void kernel_process_entry()
+{
+    Process *ps = (Process*)current_process;
+    __sync_fetch_and_and(&ps->flags, ~PROCESS_EXIT_NOW);
+
+    ps->function();
+    process_exit();
+}
+
+// Starts a process running function in ring 0, with the kernel mappings
+// and the window of the process which starts it. It ends when function
+// returns. It runs on cpu, or on the least busy CPU when cpu is 0. Needs
+// init_tasking(). Returns the process, or 0
+Process *start_kernel_process(void (*function)(), CPU *cpu)
+{
+    Process *ps = get_new_process(clone_page_directory(current_page_directory));
+    if (!ps) return 0;
+
+    ps->win = current_process->win;
+    ps->function = function;
+
+    ps->esp = (uint)ps->stack + PROCESS_STACK_SIZE - 16;
+    ps->ebp = 0;
+    ps->eip = (uint)kernel_process_entry;
+
+    if (cpu) runqueue_add(cpu, ps);
+    else schedule_process(ps);
+    return ps;
+}
+
+// Ends the current process. switch_process() removes it from the run queue
+// the next time the CPU switches away from it, which is right now
+void process_exit()
+{
+    __sync_fetch_and_or(&current_process->flags, PROCESS_EXITED);
+
+    // On the BSP, switch_process() comes back when every other process is blocked
+    for (;;) {
+        switch_process();
+        asm volatile("hlt");
+    }
 }
 
 // Spawn a new process
@@ -332,6 +581,10 @@ int fork()
 
     // Create a new child process.
     Process *new_process = get_new_process(directory);
+    if (!new_process) {
+        asm volatile("sti");
+        return 0;
+    }
 
     // Copy the stack of the parent process to the child process
 //    copy_stack((void*)&new_process->eax, (void*)&current_process->eax);
@@ -361,6 +614,9 @@ int fork()
     new_process->esp = esp + stack_offset;
     new_process->ebp = ebp + stack_offset;
     new_process->eip = eip;
+
+    // Only now the child can be picked up by a CPU
+    schedule_process(new_process);
     asm volatile("sti");
 
 /*    debug_i("Old process stack trace start: ", (uint)&current_process->eax);
@@ -3,15 +3,36 @@
 
 #include "display.h"
 #include "virtualmem.h"
+#include "smp.h"
+#include "ring.h"
 
 #define PROCESS_STACK_SIZE 16384
 #define PROCESS_EXIT_NOW 1
 #define PROCESS_POLLING 2
+#define PROCESS_BLOCKED 4							// Waiting for a mutex
+#define PROCESS_EXITED 8							// Finished, waiting to be removed from its run queue
+#define PROCESS_WAITING 16							// In the wait queue of a mutex
 
+#define MAX_PROCESSES 16
+
+#define PROCESS_INPUT_SIZE 16
+
+
+// CPU accounting, updated by the scheduler
+typedef struct {
+	uint user_ticks;					// Timer ticks spent in user mode
+	uint kernel_ticks;					// Timer ticks spent in kernel mode
+	uint runnable_ticks;				// Timer ticks spent waiting for the CPU
+	uint blocked_ticks;					// Timer ticks spent polling or blocked on a mutex
+	uint voluntary_switches;			// Gave up the CPU to wait for something
+	uint involuntary_switches;			// Preempted by the timer
+	uint64 runtime_cycles;				// Time spent on the CPU, measured with RDTSC
+} ProcessStats;
 
 typedef struct process_t {
 	uint pid;							// The process ID
-	unsigned char buffer;				// A buffer (where the keyboard handler)
+	Ring input;							// The keystrokes (filled by the keyboard handler)
+	uint input_slots[PROCESS_INPUT_SIZE];
 	Window *win;						// The window used by the process
 	PageDirectory *page_dir;			// The page directory
 	struct process_t *next;				// The next process
@@ -22,9 +43,16 @@ typedef struct process_t {
 	uint esp;
 	char kernel_stack[PROCESS_STACK_SIZE];
 	uint eip;
-	uint flags;							// Some flags
+	volatile uint flags;				// Some flags
 	void (*function) ();				// The function to call after initialization
 	char error[128];					// Buffer for errors
+	struct cpu_t *cpu;					// The CPU whose run queue holds the process
+	struct process_t *wait_next;		// The next process waiting for the same mutex
+	ProcessStats stats;
+	uint user_entry;					// Where a user mode process starts (ring 3)
+	uint user_stack;
+	uint user_brk;						// End of the heap (sbrk syscall), 0 until first used
+	volatile uint wake_tick;			// The timer tick which clears PROCESS_POLLING, 0 for none
 } Process;
 
 void init_processes();
@@ -33,11 +61,20 @@ void switch_process();
 int fork();
 void move_stack(void *new_stack_start, uint size);
 void init_tasking();
+void schedule_process(Process *ps);
+void process_account_tick(uint user_mode);
+void process_wake_sleepers(uint ticks);
+int start_user_process(PageDirectory *dir, uint entry, uint user_stack);
+Process *start_kernel_process(void (*function)(), CPU *cpu);
+void process_exit();
+uint process_count();
+Process *process_get(uint index);
 int getpid();
 void error(const char*);
 void error_reset();
 const char *error_get();
 
-extern volatile Process *current_process;
+// The process which gets the cycles of the CPU we are running on
+#define current_process (cpu_current()->current)
 
 #endif
@@ -1,5 +1,6 @@
-// The scheduler relies on IRQ 0 to be called at regular intervals and
-// performs a context switch every time it's called
+// The scheduler relies on a timer interrupt to be called at regular intervals
+// and performs a context switch every time it's called. Each CPU has its
+// LAPIC timer, or without APIC the BSP uses the PIT (IRQ 0)
 
 #include "libc.h"
 #include "kernel.h"
@@ -8,6 +9,9 @@
 #include "display.h"
 #include "process.h"
 #include "isr.h"
+#include "vdso.h"
+#include "smp.h"
+#include "apic.h"
 
 void scheduler_phase(int hz)
 {
@@ -19,16 +23,61 @@ void scheduler_phase(int hz)
 
 uint timer_ticks = 0;
 
+// The PIT runs at 18.2Hz by default (scheduler_phase() is not called)
+uint timer_hz = 18;
+
 uint get_ticks() {
 	return timer_ticks;
 }
 
-static void scheduler_handler(registers_t regs)
+uint get_timer_hz() {
+	return timer_hz;
+}
+
+// Busy-waits using the PIT channel 2 (the PC speaker one), whose output can be
+// read on port 0x61. It doesn't need interrupts, so it can be used during the
+// boot, e.g. to calibrate the LAPIC timer or to pace the AP startup IPIs
+void pit_wait_ms(uint ms)
+{
+	while (ms > 0) {
+		// The 16-bit counter overflows after ~55ms
+		uint chunk = ms > 50 ? 50 : ms;
+		uint count = 1193 * chunk;
+
+		// Gate of the channel 2 on, speaker off
+		outportb(0x61, (inportb(0x61) & ~0x02) | 0x01);
+
+		// Channel 2, low byte then high byte, mode 0 (interrupt on terminal count)
+		outportb(0x43, 0xB0);
+		outportb(0x42, count & 0xFF);
+		outportb(0x42, count >> 8);
+
+		// The output goes high when the count reaches 0
+		while (!(inportb(0x61) & 0x20));
+
+		ms -= chunk;
+	}
+}
+
+// timer_ticks is only incremented by the BSP
+static void scheduler_handler(registers_t *regs)
 {
-	timer_ticks++;
+	if (cpu_current()->id == 0) {
+		timer_ticks++;
+		vdso_tick(timer_ticks);
+		process_wake_sleepers(timer_ticks);
+	}
+
+	process_account_tick((regs->cs & 0x3) == 3);
 	switch_process();
 }
 
 void init_scheduler() {
-	register_interrupt_handler(IRQ0, &scheduler_handler);
+	register_switching_handler(IRQ_LAPIC_TIMER, &scheduler_handler);
+
+	if (LAPIC_is_enabled()) {
+		timer_hz = LAPIC_TIMER_HZ;
+		LAPIC_timer_start(LAPIC_TIMER_HZ);
+	}
+	else register_switching_handler(IRQ0, &scheduler_handler);
 }
@@ -0,0 +1,142 @@
+// Symmetric multiprocessing: wakes up the application processors (APs)
+//
+// The BSP (the processor the BIOS started) copies the real mode trampoline
+// below 1MB and sends the INIT-SIPI-SIPI sequence to each AP listed in the
+// ACPI/MP tables. The AP switches to protected mode with paging, loads its
+// own GDT/TSS and ends up in ap_main(), where it runs its idle process until
+// fork() gives it a process of its own.
+
+#include "libc.h"
+#include "kernel.h"
+#include "kheap.h"
+#include "smp.h"
+#include "acpi.h"
+#include "apic.h"
+#include "process.h"
+#include "virtualmem.h"
+#include "descriptor_tables.h"
+#include "syscall.h"
+
+extern char ap_trampoline_start[], ap_trampoline_end[];
+extern uint ap_trampoline_cr3, ap_trampoline_stack, ap_trampoline_entry;
+extern PageDirectory *kernel_page_directory;
+extern void pit_wait_ms(uint ms);
+
+CPU cpus[MAX_CPUS];
+uint nb_cpus = 1;
+
+// Set once the LAPIC is usable, before that we only run on the BSP
+uint8 SMP_started = 0;
+uint8 LAPIC_to_CPU[256];
+
+CPU *cpu_current() {
+    if (!SMP_started) return &cpus[0];
+    return &cpus[LAPIC_to_CPU[LAPIC_id()]];
+}
+
+CPU *cpu_get(uint id) {
+    return &cpus[id];
+}
+
+uint cpu_count() {
+    return nb_cpus;
+}
+
+// Address of a trampoline variable in the copy at AP_TRAMPOLINE
+static uint *trampoline_var(uint *var) {
+    return (uint*)(AP_TRAMPOLINE + (uint)var - (uint)ap_trampoline_start);
+}
+
+static void ap_main() {
+    CPU *cpu = cpu_current();
+
+    init_descriptor_tables_AP(cpu->id);
+    init_LAPIC(0);
+    init_sysenter();
+
+    cpu->page_dir = kernel_page_directory;
+    cpu->current = cpu->idle;
+    cpu->switch_cycles = rdtsc();
+    set_kernel_stack((void*)&cpu->idle->eip);
+    LAPIC_timer_start(LAPIC_TIMER_HZ);
+
+    cpu->online = 1;
+
+    // The idle process: wait for the next timer interrupt
+    asm volatile("sti");
+    for (;;) asm volatile("hlt");
+}
+
+static Process *new_idle_process(CPU *cpu) {
+    Process *idle = (Process*)kmalloc(sizeof(Process));
+    memset(idle, 0, sizeof(Process));
+
+    idle->pid = -1;
+    idle->page_dir = kernel_page_directory;
+    idle->next = idle;
+    idle->cpu = cpu;
+
+    return idle;
+}
+
+static void SMP_start_AP(CPU *cpu) {
+    *trampoline_var(&ap_trampoline_stack) = (uint)cpu->boot_stack + PROCESS_STACK_SIZE;
+
+    // INIT, then two STARTUP IPIs as described in the MP specification (B.4).
+    // The vector of the STARTUP IPI is the page where the AP starts
+    LAPIC_send_IPI(cpu->LAPIC_id, LAPIC_ICR_INIT | LAPIC_ICR_ASSERT | LAPIC_ICR_LEVEL);
+    pit_wait_ms(10);
+
+    for (int i=0; i<2 && !cpu->online; i++) {
+        LAPIC_send_IPI(cpu->LAPIC_id, LAPIC_ICR_STARTUP | (AP_TRAMPOLINE >> 12));
+        pit_wait_ms(1);
+    }
+
+    // Give it 100ms to come up
+    for (int i=0; i<100 && !cpu->online; i++) pit_wait_ms(1);
+}
+
+void init_SMP() {
+    ACPIInfo *info = ACPI_get_info();
+    CPU *bsp = &cpus[0];
+
+    bsp->id = 0;
+    bsp->online = 1;
+
+    // init_APIC() has enabled the LAPIC of the BSP if there is one
+    if (info->nb_CPUs <= 1 || !LAPIC_is_enabled()) return;
+
+    // The trampoline page must be mapped in the kernel page directory,
+    // which is the one the APs start with
+    map_page(AP_TRAMPOLINE, AP_TRAMPOLINE, 0, 1);
+
+    bsp->LAPIC_id = LAPIC_id();
+    LAPIC_to_CPU[bsp->LAPIC_id] = 0;
+
+    memcpy((void*)AP_TRAMPOLINE, ap_trampoline_start, ap_trampoline_end - ap_trampoline_start);
+    *trampoline_var(&ap_trampoline_cr3) = (uint)kernel_page_directory;
+    *trampoline_var(&ap_trampoline_entry) = (uint)ap_main;
+
+    SMP_started = 1;
+
+    for (uint i=0; i<info->nb_CPUs && nb_cpus < MAX_CPUS; i++) {
+        if (info->LAPIC_ids[i] == bsp->LAPIC_id) continue;
+
+        CPU *cpu = &cpus[nb_cpus];
+        cpu->id = nb_cpus;
+        cpu->LAPIC_id = info->LAPIC_ids[i];
+        cpu->idle = new_idle_process(cpu);
+        if (!cpu->boot_stack) cpu->boot_stack = (unsigned char*)kmalloc_pages(PROCESS_STACK_SIZE / 0x1000, "AP stack");
+        LAPIC_to_CPU[cpu->LAPIC_id] = cpu->id;
+
+        SMP_start_AP(cpu);
+
+        if (cpu->online) nb_cpus++;
+        else {
+            printf("CPU with LAPIC ID %d did not start\n", cpu->LAPIC_id);
+            LAPIC_to_CPU[cpu->LAPIC_id] = 0;
+        }
+    }
+
+    printf("%d CPUs online\n", nb_cpus);
+}
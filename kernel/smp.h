@@ -0,0 +1,44 @@
+#ifndef __SMP_H
+#define __SMP_H
+
+#include "libc.h"
+#include "spinlock.h"
+
+#define MAX_CPUS                8
+
+// The APs start in real mode at this address (it must be page aligned and
+// below 1MB). The SIPI vector is the page number.
+#define AP_TRAMPOLINE           0x8000
+
+struct process_t;
+struct page_directory_t;
+
+// Per-CPU state. Each CPU has its own run queue: a circular linked list of
+// processes (through Process.next) that only this CPU schedules
+typedef struct cpu_t {
+	uint id;                            // Index in the cpus array
+	uint8 LAPIC_id;                     // Local APIC ID (from the ACPI/MP tables)
+	volatile uint8 online;              // Set by the CPU once it can schedule processes
+	volatile struct process_t *current; // The process which gets CPU cycles on this CPU
+	struct process_t *idle;             // Runs when nothing else is runnable (APs only)
+	struct page_directory_t *page_dir;  // The page directory loaded in CR3
+	uint nb_processes;                  // Number of processes in the run queue
+	Spinlock runqueue_lock;             // Taken to modify or walk the run queue
+	uint64 switch_cycles;               // TSC when the current process was last accounted
+	unsigned char *boot_stack;          // The stack the AP uses until it switches to a process
+
+	// Scratch space for switch_process(), which cannot use the stack
+	// while it is switching stacks
+	uint esp_global;
+	uint ebp_global;
+	uint eip_global;
+} CPU;
+
+void init_SMP();
+CPU *cpu_current();
+CPU *cpu_get(uint id);
+uint cpu_count();
+
+extern CPU cpus[MAX_CPUS];
+
+#endif
@@ -0,0 +1,52 @@
+// Spinlocks protect the data shared between the CPUs, and between the
+// interrupt handlers and the processes (with the irqsave variants).
+// They must only be held for short sections, never while waiting for
+// something else to happen: use a Mutex for that.
+
+#include "libc.h"
+#include "spinlock.h"
+
+#define EFLAGS_IF 0x200
+
+void spinlock_init(Spinlock *lock) {
+    lock->next = 0;
+    lock->owner = 0;
+}
+
+void spinlock_lock(Spinlock *lock) {
+    uint16 ticket = __sync_fetch_and_add(&lock->next, 1);
+
+    while (lock->owner != ticket) asm volatile("pause" ::: "memory");
+}
+
+int spinlock_trylock(Spinlock *lock) {
+    uint16 owner = lock->owner;
+
+    // Only take a ticket if it would be served right away
+    return __sync_bool_compare_and_swap(&lock->next, owner, (uint16)(owner + 1));
+}
+
+void spinlock_unlock(Spinlock *lock) {
+    // Only the holder writes owner, x86 doesn't reorder the stores
+    // so a compiler barrier is enough
+    asm volatile("" ::: "memory");
+    lock->owner++;
+}
+
+int spinlock_is_locked(Spinlock *lock) {
+    return lock->next != lock->owner;
+}
+
+uint spinlock_lock_irqsave(Spinlock *lock) {
+    uint eflags;
+    asm volatile("pushf; pop %0; cli" : "=r"(eflags) : : "memory");
+
+    spinlock_lock(lock);
+    return eflags;
+}
+
+void spinlock_unlock_irqrestore(Spinlock *lock, uint eflags) {
+    spinlock_unlock(lock);
+
+    if (eflags & EFLAGS_IF) asm volatile("sti" ::: "memory");
+}
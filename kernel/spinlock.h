@@ -0,0 +1,25 @@
+#ifndef __SPINLOCK_H
+#define __SPINLOCK_H
+
+#include "libc.h"
+
+// A ticket spinlock: the CPUs get the lock in the order they asked for it
+typedef struct {
+    volatile uint16 next;       // The next ticket to hand out
+    volatile uint16 owner;      // The ticket currently holding the lock
+} Spinlock;
+
+#define SPINLOCK_INIT { 0, 0 }
+
+void spinlock_init(Spinlock *lock);
+void spinlock_lock(Spinlock *lock);
+int spinlock_trylock(Spinlock *lock);
+void spinlock_unlock(Spinlock *lock);
+int spinlock_is_locked(Spinlock *lock);
+
+// For data shared with interrupt handlers: disables the interrupts on the
+// current CPU while the lock is held, and restores them as they were
+uint spinlock_lock_irqsave(Spinlock *lock);
+void spinlock_unlock_irqrestore(Spinlock *lock, uint eflags);
+
+#endif
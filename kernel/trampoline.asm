@@ -0,0 +1,84 @@
+; AP trampoline
+;
+; The application processors start in real mode at the address given by the
+; Startup IPI (AP_TRAMPOLINE in smp.h). init_SMP() copies the code between
+; ap_trampoline_start and ap_trampoline_end there, and fills in the page
+; directory, the stack and the C entry point before waking up each AP.
+;
+; Because this code runs from its copy, every address is computed relative to
+; AP_TRAMPOLINE instead of the address the linker gives it.
+
+AP_TRAMPOLINE equ 0x8000
+%define TRAMPOLINE_ADDR(x) (AP_TRAMPOLINE + (x) - ap_trampoline_start)
+
+[GLOBAL ap_trampoline_start]
+[GLOBAL ap_trampoline_end]
+[GLOBAL ap_trampoline_cr3]
+[GLOBAL ap_trampoline_stack]
+[GLOBAL ap_trampoline_entry]
+
+section .text
+
+[BITS 16]
+ap_trampoline_start:
+    cli
+    cld
+    xor ax, ax
+    mov ds, ax
+
+    ; Same flat code and data segments as the boot GDT (boot/pm_gdt.asm)
+    lgdt [TRAMPOLINE_ADDR(ap_gdt_descriptor)]
+
+    mov eax, cr0
+    or eax, 0x1             ; Protected mode
+    mov cr0, eax
+
+    jmp dword 0x08:TRAMPOLINE_ADDR(ap_protected_mode)
+
+[BITS 32]
+ap_protected_mode:
+    mov ax, 0x10
+    mov ds, ax
+    mov es, ax
+    mov fs, ax
+    mov gs, ax
+    mov ss, ax
+
+    ; Use the kernel page directory: the kernel is identity-mapped
+    ; and so is this page
+    mov eax, [TRAMPOLINE_ADDR(ap_trampoline_cr3)]
+    mov cr3, eax
+    mov eax, cr0
+    or eax, 0x80000000      ; Paging
+    mov cr0, eax
+
+    mov esp, [TRAMPOLINE_ADDR(ap_trampoline_stack)]
+    mov ebp, esp
+
+    ; ap_main() never returns
+    mov eax, [TRAMPOLINE_ADDR(ap_trampoline_entry)]
+    call eax
+
+.hang:
+    cli
+    hlt
+    jmp .hang
+
+align 8
+ap_gdt:
+    dq 0x0000000000000000   ; Null segment
+    dq 0x00CF9A000000FFFF   ; Code segment
+    dq 0x00CF92000000FFFF   ; Data segment
+
+ap_gdt_descriptor:
+    dw ap_gdt_descriptor - ap_gdt - 1
+    dd TRAMPOLINE_ADDR(ap_gdt)
+
+ap_trampoline_cr3:
+    dd 0
+ap_trampoline_stack:
+    dd 0
+ap_trampoline_entry:
+    dd 0
+
+ap_trampoline_end:
@@ -0,0 +1,66 @@
+// The vDSO pages (see lib/vdso.h): a page of kernel data shared read-only
+// with every user process, and a page of per-process data.
+
+#include "libc.h"
+#include "kheap.h"
+#include "virtualmem.h"
+#include "clock.h"
+#include "network.h"
+#include "vdso.h"
+
+extern uint64 clock_boot_cycles;
+extern uint clock_boot_time;
+
+VDSOData *vdso = 0;
+
+void init_vdso() {
+    vdso = (VDSOData*)kmalloc_pages(1, "vDSO");
+    memset(vdso, 0, 0x1000);
+
+    vdso->boot_cycles = clock_boot_cycles;
+    vdso->boot_time = clock_boot_time;
+    vdso->time = clock_boot_time;
+    vdso->TSC_kHz = clock_TSC_kHz();
+
+    // ns = cycles * 10^6 / kHz = cycles * ns_mult >> ns_shift, with the
+    // largest shift (the best precision) for which ns_mult fits in 32 bits
+    if (vdso->TSC_kHz) {
+        uint shift = 32;
+        while (shift > 0 && udiv64((uint64)1000000 << shift, vdso->TSC_kHz, 0) >> 32) shift--;
+
+        vdso->ns_shift = shift;
+        vdso->ns_mult = (uint)udiv64((uint64)1000000 << shift, vdso->TSC_kHz, 0);
+    }
+}
+
+// Maps the shared page and a new process page in a user address space
+void vdso_map(PageDirectory *dir, uint pid) {
+    if (!vdso) return;
+
+    map_page_to(dir, VDSO_ADDRESS, (uint)vdso, 1, 0);
+
+    // free_page_directory() must leave the shared page alone
+    get_PTE(VDSO_ADDRESS, dir, 0)->avail_1 = 1;
+
+    VDSOProcess *process = (VDSOProcess*)map_user_page(dir, VDSO_PROCESS_ADDRESS, 0);
+    process->pid = pid;
+}
+
+// Called by the BSP timer interrupt
+void vdso_tick(uint timer_ticks) {
+    if (!vdso) return;
+
+    vdso->timer_ticks = timer_ticks;
+    vdso->time = clock_time();
+}
+
+void vdso_update_network() {
+    if (!vdso) return;
+
+    Network *network = network_get_info();
+    vdso->IPv4 = network->IPv4;
+    vdso->router_IPv4 = network->router_IPv4;
+    vdso->DNS = network->dns;
+    memcpy(vdso->MAC, network->MAC, 6);
+    vdso->network_status = network->status;
+}
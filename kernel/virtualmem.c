@@ -8,9 +8,6 @@
 // The kernel's page directory
 //PageDirectory *kernel_directory=0;
 
-// The current page directory;
-PageDirectory *current_page_directory=0;
-
 void print_page_directory(PageDirectory *, Window *);
 extern void copy_physical_page(uint, uint);
 extern void stack_dump();
@@ -26,7 +23,7 @@ uint nb_frames;
 char test[1024];
 char *forbidden_page;
 
-static void page_fault(registers_t reg);
+static void page_fault(registers_t *regs);
 
 
 // Turns the bit from the frame bitmap
@@ -110,6 +107,20 @@ void map_page(uint virtual_addr, uint physical_addr, int is_user, int is_writeab
     pte->frame = physical_addr / 0x1000;
 }
 
+// Maps a page of memory-mapped device registers (e.g. the local APIC) at
+// the same address. Those pages are not RAM, so they are not tracked in the
+// frame bitmap, and they must not be cached
+void map_device_page(uint address) {
+    PageTableEntry *pte = get_PTE(address, current_page_directory, 1);
+
+    pte->present = 1;
+    pte->writeable = 1;
+    pte->user_access = 0;
+    pte->write_through = 1;
+    pte->cache_disabled = 1;
+    pte->frame = address / 0x1000;
+}
+
 // Unmap a page
 void unmap_page(uint virtual_addr) {
     PageTableEntry *pte = get_PTE(virtual_addr, current_page_directory, 0);
@@ -342,6 +353,70 @@ PageDirectory *clone_page_directory(PageDirectory *src)
     return dst;
 }
 
+// A page directory for a new address space: it shares the kernel page
+// tables and has nothing else mapped
+PageDirectory *new_page_directory()
+{
+    PageDirectory *dir = (PageDirectory*)kmalloc_pages(sizeof(PageDirectory) / 0x1000, "VM Page directory");
+    memset(dir, 0, sizeof(PageDirectory));
+
+    for (int i = 0; i < 1024; i++) dir->entry[i] = kernel_page_directory->entry[i];
+
+    return dir;
+}
+
+// Frees a page directory created by new_page_directory(), the page tables
+// which are not shared with the kernel and the pages they map
+void free_page_directory(PageDirectory *dir)
+{
+    for (int i = 0; i < 1024; i++) {
+        if (!dir->entry[i] || dir->entry[i] == kernel_page_directory->entry[i]) continue;
+
+        PageTable *pt = (PageTable *)(dir->entry[i] & 0xFFFFF000);
+        // avail_1 marks the pages which are shared (the vDSO data page)
+        for (int j = 0; j < 1024; j++) {
+            if (pt->pte[j].frame && !pt->pte[j].avail_1) kfree((void*)(pt->pte[j].frame * 0x1000));
+        }
+
+        kfree(pt);
+    }
+
+    kfree(dir);
+}
+
+// Maps a page in a page directory which may not be the current one. The
+// physical page comes from the kernel page heap, so it is not tracked in
+// the frame bitmap
+void map_page_to(PageDirectory *dir, uint virtual_addr, uint physical_addr, int is_user, int is_writeable)
+{
+    PageTableEntry *pte = get_PTE(virtual_addr, dir, 1);
+
+    pte->present = 1;
+    pte->writeable = is_writeable ? 1 : 0;
+    pte->user_access = is_user ? 1 : 0;
+    pte->frame = physical_addr / 0x1000;
+}
+
+// Returns the user page at virtual_addr in the address space, allocating it
+// if needed. The returned pointer is the kernel (identity-mapped) address of
+// the page, so that we can fill it without switching page directories
+uint8 *map_user_page(PageDirectory *dir, uint virtual_addr, int is_writeable)
+{
+    PageTableEntry *pte = get_PTE(virtual_addr, dir, 1);
+
+    // Two ELF segments can share a page
+    if (pte->frame) {
+        if (is_writeable) pte->writeable = 1;
+        return (uint8*)(pte->frame * 0x1000);
+    }
+
+    uint8 *page = (uint8*)kmalloc_pages(1, "User page");
+    memset(page, 0, 0x1000);
+    map_page_to(dir, virtual_addr, (uint)page, 1, is_writeable);
+
+    return page;
+}
+
 // Debug function that prints the contents of a page directory
 /*
 void print_page_directory(PageDirectory *dir) {
@@ -437,7 +512,7 @@ void memory_print(Window *win) {
 // that is either not mapped yet or mapped to a restricted address
 // Right now we handle the error gracefully by printing some debug information and mapping that
 // page to the forbidden page
-static void page_fault(registers_t regs)
+static void page_fault(registers_t *regs)
 {
     // A page fault has occurred.
     // The faulting address is stored in the CR2 register.
@@ -445,14 +520,14 @@ static void page_fault(registers_t regs)
     asm volatile("mov %%cr2, %0" : "=r" (faulting_address));
     
     // The error code gives us details of what happened.
-    int present   = !(regs.err_code & 0x1); // Page not present
-    int rw = regs.err_code & 0x2;           // Write operation?
-    int us = regs.err_code & 0x4;           // Processor was in user-mode?
-    int reserved = regs.err_code & 0x8;     // Overwritten CPU-reserved bits of page entry?
-    int id = regs.err_code & 0x10;          // Caused by an instruction fetch?
+    int present   = !(regs->err_code & 0x1); // Page not present
+    int rw = regs->err_code & 0x2;           // Write operation?
+    int us = regs->err_code & 0x4;           // Processor was in user-mode?
+    int reserved = regs->err_code & 0x8;     // Overwritten CPU-reserved bits of page entry?
+    int id = regs->err_code & 0x10;          // Caused by an instruction fetch?
 
     // Output an error message.
-    printf("Page fault! %x %x ( ", regs.esp, regs.ebp);
+    printf("Page fault! %x %x ( ", regs->esp, regs->ebp);
     if (present) {printf("present ");}
     if (rw) {printf("read-only ");}
     if (us) {printf("user-mode ");}
@@ -461,7 +536,7 @@ static void page_fault(registers_t regs)
 
 //for (;;);
     stack_dump();
-//    C_stack_dump((void*)regs.esp, (void*)regs.ebp);
+//    C_stack_dump((void*)regs->esp, (void*)regs->ebp);
 //    for (;;);
     // Maps to the forbidden page
     map_forbidden(faulting_address & 0xFFFFF000);
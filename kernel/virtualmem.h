@@ -5,6 +5,7 @@
 // i386 family of processors
 
 #include "libc.h"
+#include "smp.h"
 
 typedef struct {
   uint present          : 1;
@@ -26,15 +27,23 @@ typedef struct {
   PageTableEntry pte[1024];
 } PageTable;
 
-typedef struct {
+typedef struct page_directory_t {
   uint entry[1024];
   PageTable *tables[1024];
 } PageDirectory;
 
+// Each CPU has its own current page directory (the one loaded in its CR3)
+#define current_page_directory (cpu_current()->page_dir)
+
 void init_virtualmem();
 void switch_page_directory(PageDirectory *dir);
 PageTableEntry *get_PTE(uint address, PageDirectory *dir, int create_if_not_exist);
 void map_page(uint virtual_addr, uint physical_addr, int is_user, int is_writeable);
+void map_device_page(uint address);
 PageDirectory *clone_page_directory(PageDirectory *src);
+PageDirectory *new_page_directory();
+void free_page_directory(PageDirectory *dir);
+void map_page_to(PageDirectory *dir, uint virtual_addr, uint physical_addr, int is_user, int is_writeable);
+uint8 *map_user_page(PageDirectory *dir, uint virtual_addr, int is_writeable);
 
 #endif
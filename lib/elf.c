@@ -3,46 +3,25 @@
 #include "disk.h"
 #include "elf.h"
 #include "kernel.h"
+#include "virtualmem.h"
+#include "process.h"
 
-typedef struct {
-	uint offset;
-	uint info;
-} ElfRelocation;
-
-typedef void (*function)(int, char **);
-
-void elf_relocate_addresses(Elf *elf) {
-	uint *ptr;
-//    unsigned char *ptr_to_ptr;
-
-    elf->relocation_offset = (int)elf->section[ELF_SECTION_TEXT].start - elf->initial_code_address;
-
-	for (ElfRelocation *entry = (ElfRelocation*)elf->section[ELF_SECTION_REL_TEXT].start;
-         entry < (ElfRelocation*)elf->section[ELF_SECTION_REL_TEXT].end;
-         entry++) {
-//		printf("Offset: %x, info: %x (%d)\n", entry->offset, entry->info, entry->info & 0xFF);
-		if ((entry->info & 0xFF) == 01) {
-			ptr = (uint*)(elf->section[ELF_SECTION_TEXT].start + entry->offset - elf->initial_code_address);
-//			printf("Pointer to relocate: %x (%x + %x - %x)\n", ptr, elf->section[ELF_SECTION_TEXT].start, entry->offset, elf->initial_code_address);
-//			memcpy(&ptr, ptr_to_ptr, 4);
-//			printf("Old pointer: %x\n", *ptr);
-			*ptr = *ptr + elf->relocation_offset;
-//			printf("New pointer: %x\n", *ptr);
-//			memcpy(ptr_to_ptr, &ptr, 4);
-		}
-	}
-}
+// In hal.asm: where the programs return from _start(), it exits the process
+extern void user_exit_stub();
 
 Elf *elf_load(const char *filename, uint dir_cluster) {
     File *f = (File*)kmalloc(sizeof(File));
+    f->body = 0;
 
     disk_load_file_index();
     DirEntry *dir_index = (DirEntry*)kmalloc_pages(1, "Root dir to load ELF");
     disk_load_file(filename, dir_cluster, dir_index, f);
     kfree(dir_index);
 
-    if (strncmp(f->body + 1, "ELF", 3)) {
+    if (!f->body || f->info.size < sizeof(ElfHeader) || strncmp(f->body + 1, "ELF", 3)) {
         printf("Invalid ELF binary at %x\n", f->body);
+        if (f->body) kfree(f->body);
+        kfree(f);
         return 0;
     }
 
@@ -52,6 +31,12 @@ Elf *elf_load(const char *filename, uint dir_cluster) {
     elf->file = f;
     elf->header = (ElfHeader*)f->body;
 
+    // Without a section table in the file, there is only what elf_exec() needs
+    ElfHeader *header = elf->header;
+    if (header->e_shoff > f->info.size || header->e_shstrndx >= header->e_shnum
+        || (uint)header->e_shnum * sizeof(ElfSectionHeader) > f->info.size - header->e_shoff)
+        return elf;
+
     ElfSectionHeader *sections = (ElfSectionHeader*)((uint)elf->header + elf->header->e_shoff);
     ElfSectionHeader *string_table_section = sections + elf->header->e_shstrndx;
 
@@ -92,22 +77,112 @@ Elf *elf_load(const char *filename, uint dir_cluster) {
     return elf;
 }
 
-void elf_exec(const char *filename, int argc, char **argv) {
-    DirEntry *dir_index = (DirEntry*)kmalloc_pages(1, "Root dir to load ELF");
+// A PT_LOAD segment must be in the file, and in the user space: a program
+// can't make us read past its file, nor map itself over the kernel
+static int elf_check_segment(Elf *elf, ElfProgramHeader *ph) {
+    uint file_size = elf->file->info.size;
 
-    Elf *elf = elf_load(filename, ROOT_DIR_CLUSTER);
-    if (!elf) return;
+    if (ph->p_offset > file_size || ph->p_filesz > file_size - ph->p_offset) return 0;
+    if (ph->p_filesz > ph->p_memsz) return 0;
 
-    elf_relocate_addresses(elf);
+    // Written so that p_vaddr + p_memsz can't wrap
+    return ph->p_vaddr >= USER_SPACE_START && ph->p_vaddr < USER_HEAP_START && ph->p_memsz <= USER_HEAP_START - ph->p_vaddr;
+}
 
-//    printf("Code section: %x\n", elf->section[ELF_SECTION_TEXT].start);
+// Maps a PT_LOAD segment at its link address. The part of the segment which
+// is not in the file (.bss) stays zeroed
+static void elf_load_segment(Elf *elf, ElfProgramHeader *ph, PageDirectory *dir) {
+    uint file_end = ph->p_vaddr + ph->p_filesz;
 
-    function fct = (function)(elf->header->e_entry + elf->relocation_offset);
-//    printf("main(): %x\n", fct);
-    fct(argc, argv);
+    for (uint page = ph->p_vaddr & 0xFFFFF000; page < ph->p_vaddr + ph->p_memsz; page += 0x1000) {
+        uint8 *frame = map_user_page(dir, page, ph->p_flags & ELF_PF_W);
+
+        uint copy_start = umax(page, ph->p_vaddr);
+        uint copy_end = umin(page + 0x1000, file_end);
+        if (copy_start < copy_end)
+            memcpy(frame + copy_start - page, (uint8*)elf->header + ph->p_offset + copy_start - ph->p_vaddr, copy_end - copy_start);
+    }
+}
+
+static void elf_push(uint8 *stack_top, uint *sp, uint value) {
+    *sp -= 4;
+    *(uint*)(stack_top - (USER_STACK_TOP - *sp)) = value;
+}
+
+// Sets up the user stack: the argument strings at the top, then the argv
+// array, and a call frame for _start(argc, argv) returning to user_exit_stub
+// (which ends the process). Returns the initial stack pointer
+static uint elf_setup_stack(PageDirectory *dir, int argc, char **argv) {
+    for (uint page = USER_STACK_TOP - USER_STACK_SIZE; page < USER_STACK_TOP; page += 0x1000)
+        map_user_page(dir, page, 1);
+
+    // The arguments must fit in the top page
+    uint8 *stack_top = map_user_page(dir, USER_STACK_TOP - 0x1000, 1) + 0x1000;
+    uint sp = USER_STACK_TOP;
+    uint args[ELF_MAX_ARGS];
+
+    argc = min(argc, ELF_MAX_ARGS);
+    for (int i=argc-1; i>=0; i--) {
+        uint length = umin(strlen(argv[i]) + 1, 256);
+        sp -= length;
+        uint8 *arg = stack_top - (USER_STACK_TOP - sp);
+        memcpy(arg, argv[i], length);
+        arg[length - 1] = 0;
+        args[i] = sp;
+    }
+
+    sp &= 0xFFFFFFFC;
+    elf_push(stack_top, &sp, 0);
+    for (int i=argc-1; i>=0; i--) elf_push(stack_top, &sp, args[i]);
+
+    uint argv_address = sp;
+    elf_push(stack_top, &sp, argv_address);
+    elf_push(stack_top, &sp, argc);
+    elf_push(stack_top, &sp, (uint)user_exit_stub);
+
+    return sp;
+}
+
+// Loads an executable in a new address space and starts it as a new ring 3
+// process. The PT_LOAD segments are mapped at their link address, so there
+// is nothing to relocate. Returns the PID of the process, or -1
+int elf_exec(const char *filename, int argc, char **argv) {
+    Elf *elf = elf_load(filename, ROOT_DIR_CLUSTER);
+    if (!elf) return -1;
+
+    ElfHeader *header = elf->header;
+    PageDirectory *dir = new_page_directory();
+    uint file_size = elf->file->info.size, nb_headers = 0;
+    int pid = -1, nb_segments = 0;
+
+    // The program headers must be in the file
+    if (file_size >= sizeof(ElfHeader) && header->e_phoff <= file_size
+        && (!header->e_phnum || header->e_phentsize >= sizeof(ElfProgramHeader))
+        && (uint)header->e_phnum * header->e_phentsize <= file_size - header->e_phoff)
+        nb_headers = header->e_phnum;
+    else printf("%s: invalid program headers\n", filename);
+
+    ElfProgramHeader *ph = (ElfProgramHeader*)((uint)header + header->e_phoff);
+    for (uint i=0; i<nb_headers; i++, ph = (ElfProgramHeader*)((uint)ph + header->e_phentsize)) {
+        if (ph->p_type != ELF_PT_LOAD || ph->p_memsz == 0) continue;
+
+        if (!elf_check_segment(elf, ph)) {
+            printf("%s: invalid segment at %x\n", filename, ph->p_vaddr);
+            nb_segments = 0;
+            break;
+        }
+
+        elf_load_segment(elf, ph, dir);
+        nb_segments++;
+    }
+
+    // Without a process to own it, the address space and its pages are freed
+    if (nb_segments > 0) pid = start_user_process(dir, header->e_entry, elf_setup_stack(dir, argc, argv));
+    if (pid < 0) free_page_directory(dir);
 
-    kfree(dir_index);
     kfree(elf->file);
     kfree(elf->header);
     kfree(elf);
+
+    return pid;
 }
@@ -41,6 +41,33 @@ typedef struct
     uint sh_entsize;
 } ElfSectionHeader;
 
+typedef struct
+{
+    uint p_type;
+    uint p_offset;
+    uint p_vaddr;
+    uint p_paddr;
+    uint p_filesz;
+    uint p_memsz;
+    uint p_flags;
+    uint p_align;
+} ElfProgramHeader;
+
+#define ELF_PT_LOAD                 1
+#define ELF_PF_X                    1
+#define ELF_PF_W                    2
+#define ELF_PF_R                    4
+
+// The layout of the user address spaces. The programs are linked at
+// USER_SPACE_START (see utils/user.ld), above everything the kernel maps.
+// The heap grows from USER_HEAP_START with the sbrk syscall, and the vDSO
+// pages are above the stack (VDSO_ADDRESS in vdso.h)
+#define USER_SPACE_START            0x40000000
+#define USER_HEAP_START             0x80000000
+#define USER_STACK_TOP              0xB0000000
+#define USER_STACK_SIZE             0x4000
+#define ELF_MAX_ARGS                16
+
 typedef struct
 {
     unsigned char *start;
@@ -57,5 +84,4 @@ typedef struct
 } Elf;
 
 Elf *elf_load(const char *filename, uint dir_cluster);
-void elf_exec(const char *filename, int argc, char **argv);
-void elf_relocate_addresses(Elf *elf);
+int elf_exec(const char *filename, int argc, char **argv);
@@ -105,6 +105,7 @@ void init_heap(Heap *h, uint start, uint pages, uint end) {
     default_heap = h;
 
     // Initialized the Heap object
+    spinlock_init(&h->lock);
     h->start = start;
     if (h->start % 0x1000 != 0) h->start += -h->start % 0x1000 + 0x1000;
 //    next_memory_block = h->start;
@@ -145,7 +146,7 @@ void init_heap(Heap *h, uint start, uint pages, uint end) {
 
 int flag_alloc;
 
-void *heap_alloc(uint nb_bytes, Heap *h) {
+static void *heap_alloc_small_object(uint nb_bytes, Heap *h) {
     HeapHeader *header = (HeapHeader*)h->start;
     HeapFooter *footer = (HeapFooter*)(h->start + sizeof(HeapHeader) + header->size);
     HeapHeader *candidate, *next_header;
@@ -261,7 +262,7 @@ void heap_free_small_object(uint ptr, Heap *p) {
     header->occupied = 0;
 }
 
-void *heap_alloc_pages(uint nb_requested_pages, const char *name, Heap *h) {
+static void *heap_alloc_page_block(uint nb_requested_pages, const char *name, Heap *h) {
     HeapPageIndex *candidate, *idx = (HeapPageIndex*)h->page_index_start;
     uint candidate_pages = NO_MORE_SPACE;
 
@@ -394,7 +395,23 @@ void heap_print_pages(Window *win, Heap *h) {
     }
 }
 
-void heap_free(void *ptr, Heap *h) {
+void *heap_alloc(uint nb_bytes, Heap *h) {
+    uint eflags = spinlock_lock_irqsave(&h->lock);
+    void *ptr = heap_alloc_small_object(nb_bytes, h);
+    spinlock_unlock_irqrestore(&h->lock, eflags);
+
+    return ptr;
+}
+
+void *heap_alloc_pages(uint nb_requested_pages, const char *name, Heap *h) {
+    uint eflags = spinlock_lock_irqsave(&h->lock);
+    void *ptr = heap_alloc_page_block(nb_requested_pages, name, h);
+    spinlock_unlock_irqrestore(&h->lock, eflags);
+
+    return ptr;
+}
+
+static void heap_free_block(void *ptr, Heap *h) {
     uint pointer = (uint)ptr;
 
     // Small object deallocation
@@ -414,6 +431,12 @@ void heap_free(void *ptr, Heap *h) {
     printf("Error, trying to free %x outside of the heap range\n", pointer);
 }
 
+void heap_free(void *ptr, Heap *h) {
+    uint eflags = spinlock_lock_irqsave(&h->lock);
+    heap_free_block(ptr, h);
+    spinlock_unlock_irqrestore(&h->lock, eflags);
+}
+
 uint heap_free_space(Heap *h) {
     HeapFooter *footer = (HeapFooter*)(h->end - sizeof(HeapFooter));
     HeapHeader *header = footer->header;
@@ -3,6 +3,7 @@
 
 #include "libc.h"
 #include "display.h"
+#include "spinlock.h"
 
 typedef struct {
 	uint start;
@@ -13,6 +14,7 @@ typedef struct {
 	uint page_start;
 	uint page_end;
 	uint nb_pages;
+	Spinlock lock;		// The heaps are used by all the CPUs and by the interrupt handlers
 } Heap;
 
 void init_heap(Heap *, uint, uint, uint);
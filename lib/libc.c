@@ -79,18 +79,58 @@ void lmemset(uint *dest, uint val, uint len) {
 }
 
 unsigned char getch() {
-    current_process->flags |= PROCESS_POLLING;
-    char c;
+    Process *ps = (Process*)current_process;
+    uint c;
 
     for (;;) {
-        if (current_process->buffer) {
-            c = current_process->buffer;
-            current_process->buffer = 0;
+        // The flag is set before looking at the ring, so a keystroke
+        // arriving in between clears it and we don't miss it
+        __sync_fetch_and_or(&ps->flags, PROCESS_POLLING);
+
+        if (ring_pop(&ps->input, &c)) {
+            __sync_fetch_and_and(&ps->flags, ~PROCESS_POLLING);
             return c;
         }
     }
+}
+
+// Whether a keystroke is waiting to be read by getch()
+int key_pressed() {
+    Process *ps = (Process*)current_process;
+    return !ring_is_empty(&ps->input);
+}
+
+// Reads the CPU time stamp counter
+uint64 rdtsc() {
+    uint low, high;
+    asm volatile("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64)high << 32) | low;
+}
+
+void cpuid(uint leaf, uint *eax, uint *ebx, uint *ecx, uint *edx) {
+    asm volatile("cpuid" : "=a"(*eax), "=b"(*ebx), "=c"(*ecx), "=d"(*edx) : "a"(leaf), "c"(0));
+}
+
+uint64 rdmsr(uint msr) {
+    uint low, high;
+    asm volatile("rdmsr" : "=a"(low), "=d"(high) : "c"(msr));
+    return ((uint64)high << 32) | low;
+}
+
+void wrmsr(uint msr, uint64 value) {
+    asm volatile("wrmsr" : : "c"(msr), "a"((uint)value), "d"((uint)(value >> 32)));
+}
+
+// 64-bit by 32-bit division. We don't link with libgcc, so a plain 64-bit
+// division would need __udivdi3: instead, two divl (high then low half)
+uint64 udiv64(uint64 n, uint d, uint *remainder) {
+    uint high = n >> 32, low = (uint)n;
+    uint q_high = high / d, r = high % d, q_low;
+
+    asm("divl %4" : "=a"(q_low), "=d"(r) : "a"(low), "d"(r), "rm"(d));
 
-    return current_process->buffer;
+    if (remainder) *remainder = r;
+    return ((uint64)q_high << 32) | q_low;
 }
 
 int atoi(char *str) {
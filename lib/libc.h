@@ -45,6 +45,13 @@ uint switch_endian32(uint nb);
 uint rand();
 
 unsigned char getch();
+int key_pressed();
+
+uint64 rdtsc();
+void cpuid(uint leaf, uint *eax, uint *ebx, uint *ecx, uint *edx);
+uint64 rdmsr(uint msr);
+void wrmsr(uint msr, uint64 value);
+uint64 udiv64(uint64 n, uint d, uint *remainder);
 
 void debug_i(char *msg, uint nb);
 void debug(char *msg);
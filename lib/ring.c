@@ -0,0 +1,51 @@
+// Single-producer/single-consumer ring buffer
+//
+// head and tail are free-running counters, the slot is the counter modulo
+// the size. On x86 the stores are not reordered with other stores, nor the
+// loads with other loads, so compiler barriers are enough to make sure a
+// slot is written before head moves, and read before tail moves.
+
+#include "libc.h"
+#include "ring.h"
+
+#define barrier() asm volatile("" ::: "memory")
+
+void ring_init(Ring *ring, uint *slots, uint size) {
+    ring->head = 0;
+    ring->tail = 0;
+    ring->size = size;
+    ring->slots = slots;
+}
+
+uint ring_count(Ring *ring) {
+    return ring->head - ring->tail;
+}
+
+int ring_is_empty(Ring *ring) {
+    return ring->head == ring->tail;
+}
+
+// Returns 0 if the ring is full
+int ring_push(Ring *ring, uint value) {
+    uint head = ring->head;
+    if (head - ring->tail >= ring->size) return 0;
+
+    ring->slots[head & (ring->size - 1)] = value;
+    barrier();
+    ring->head = head + 1;
+
+    return 1;
+}
+
+// Returns 0 if the ring is empty
+int ring_pop(Ring *ring, uint *value) {
+    uint tail = ring->tail;
+    if (tail == ring->head) return 0;
+
+    barrier();
+    *value = ring->slots[tail & (ring->size - 1)];
+    barrier();
+    ring->tail = tail + 1;
+
+    return 1;
+}
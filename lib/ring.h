@@ -0,0 +1,22 @@
+#ifndef __RING_H
+#define __RING_H
+
+#include "libc.h"
+
+// A lock-free single-producer/single-consumer ring buffer, typically to hand
+// data from an interrupt handler to a process. Only the producer writes head
+// and only the consumer writes tail. The size must be a power of 2
+typedef struct {
+    volatile uint head;         // Next slot to write (producer)
+    volatile uint tail;         // Next slot to read (consumer)
+    uint size;
+    uint *slots;
+} Ring;
+
+void ring_init(Ring *ring, uint *slots, uint size);
+int ring_push(Ring *ring, uint value);
+int ring_pop(Ring *ring, uint *value);
+uint ring_count(Ring *ring);
+int ring_is_empty(Ring *ring);
+
+#endif
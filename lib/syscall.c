@@ -2,60 +2,259 @@
 #include "syscall.h"
 #include "isr.h"
 #include "process.h"
+#include "kheap.h"
+#include "virtualmem.h"
+#include "clock.h"
+#include "disk.h"
+#include "elf.h"
+#include "dns.h"
+#include "icmp.h"
+#include "network.h"
 
-static void syscall_handler(registers_t regs);
+static void syscall_handler(registers_t *regs);
 extern void sysret();
+extern void sysenter_entry();
 
+#define MSR_SYSENTER_CS     0x174
+#define MSR_SYSENTER_ESP    0x175
+#define MSR_SYSENTER_EIP    0x176
+
+// The longest string a process can give us
+#define SYSCALL_MAX_STRING  4096
+
+// Set once SYSENTER is configured
+static uint8 sysenter_enabled = 0;
+
+typedef int (*syscall_t)(uint, uint, uint, uint, uint);
+
+// The pointers given by a user process must be mapped in its part of the
+// address space, otherwise it could make us read or write the kernel.
+// The processes running in ring 0 can pass anything
+static int syscall_check_buffer(const void *ptr, uint size, int is_write)
+{
+    if (!current_process->user_entry) return 1;
+
+    uint start = (uint)ptr, end = start + size;
+    if (start < USER_SPACE_START || end > USER_STACK_TOP || end < start) return 0;
+
+    for (uint page = start & 0xFFFFF000; page < end; page += 0x1000) {
+        PageTableEntry *pte = get_PTE(page, current_page_directory, 0);
+        if (!pte || !pte->present || (is_write && !pte->writeable)) return 0;
+    }
+
+    return 1;
+}
+
+static int syscall_check_string(const char *str)
+{
+    for (uint addr = (uint)str; addr - (uint)str < SYSCALL_MAX_STRING; addr++) {
+        if ((addr == (uint)str || (addr & 0xFFF) == 0) && !syscall_check_buffer((void*)addr, 1, 0)) return 0;
+        if (*(char*)addr == 0) return 1;
+    }
+    return 0;
+}
+
+// The format of kprint_int() may only print the int it comes with: any
+// other conversion would read the kernel stack (%s, a second %d...)
+static int syscall_check_format(const char *format)
+{
+    int nb_conversions = 0;
+
+    for (; *format; format++) {
+        if (*format != '%') continue;
+
+        format++;
+        if (*format != 'd' && *format != 'x' && *format != 'X' && *format != 'i') return 0;
+        if (++nb_conversions > 1) return 0;
+    }
+    return 1;
+}
+
+// The strings of the processes are never formats
 void kprint(const char *txt) {
-    printf_win(current_process->win, txt);
+    if (!syscall_check_string(txt)) return;
+    printf_win(current_process->win, "%s", txt);
 }
 
-static void *syscalls[1] =
+void kprint_int(const char *format, int value) {
+    if (!syscall_check_string(format)) return;
+
+    if (syscall_check_format(format)) printf_win(current_process->win, format, value);
+    else printf_win(current_process->win, "%s", format);
+}
+
+static int sys_yield() {
+    switch_process();
+    return 0;
+}
+
+static int sys_sleep(uint ms) {
+    uint64 end = clock_ns() + (uint64)ms * 1000000;
+    while (clock_ns() < end) switch_process();
+    return 0;
+}
+
+// Loads a file of the root directory, the caller frees f->body
+static int syscall_load_file(const char *filename, File *f) {
+    if (!syscall_check_string(filename)) return 0;
+
+    f->body = 0;
+    disk_load_file_index();
+    DirEntry *dir_index = (DirEntry*)kmalloc_pages(1, "Root dir for syscall");
+    int result = disk_load_file(filename, ROOT_DIR_CLUSTER, dir_index, f);
+    kfree(dir_index);
+
+    return result == DISK_CMD_OK;
+}
+
+static int sys_file_size(const char *filename) {
+    File *f = (File*)kmalloc(sizeof(File));
+    int size = -1;
+
+    if (syscall_load_file(filename, f)) size = f->info.size;
+
+    if (f->body) kfree(f->body);
+    kfree(f);
+    return size;
+}
+
+// Reads up to size bytes of a file, returns how many were read or -1
+static int sys_read_file(const char *filename, void *buffer, uint size) {
+    if (!syscall_check_buffer(buffer, size, 1)) return -1;
+
+    File *f = (File*)kmalloc(sizeof(File));
+    int read = -1;
+
+    if (syscall_load_file(filename, f)) {
+        read = umin(size, f->info.size);
+        if (read > 0) memcpy(buffer, f->body, read);
+    }
+
+    if (f->body) kfree(f->body);
+    kfree(f);
+    return read;
+}
+
+// Grows (or shrinks) the heap of a user process. Returns the previous end
+// of the heap, or -1. The pages are not given back when it shrinks
+static int sys_sbrk(int increment) {
+    Process *ps = (Process*)current_process;
+    if (!ps->user_entry) return -1;
+
+    if (!ps->user_brk) ps->user_brk = USER_HEAP_START;
+
+    uint old_brk = ps->user_brk, new_brk = old_brk + increment;
+    if (new_brk < USER_HEAP_START || new_brk > USER_STACK_TOP - USER_STACK_SIZE) return -1;
+
+    for (uint page = old_brk & 0xFFFFF000; page < new_brk; page += 0x1000)
+        map_user_page(ps->page_dir, page, 1);
+
+    ps->user_brk = new_brk;
+    return old_brk;
+}
+
+static int sys_uptime_ms() {
+    return (uint)udiv64(clock_ns(), 1000000, 0);
+}
+
+static int sys_dns_resolve(const char *hostname) {
+    if (!syscall_check_string(hostname)) return 0;
+    return DNS_query((char*)hostname);
+}
+
+// Pings an IPv4 address, returns the round trip time in microseconds or -1
+static int sys_ping(uint ipv4, uint timeout_ms) {
+    uint ps_id = getpid();
+    uint64 start = clock_ns(), timeout = start + (uint64)timeout_ms * 1000000;
+    int rtt = -1;
+
+    ICMP_register_reply(ps_id);
+    ICMP_send_packet(ipv4, ps_id);
+
+    while (clock_ns() < timeout) {
+        uint8 status = ICMP_check_response(ps_id);
+        if (status == ICMP_TYPE_ECHO_REQUEST) continue;
+
+        if (status == ICMP_TYPE_ECHO_REPLY) rtt = (uint)udiv64(clock_ns() - start, 1000, 0);
+        break;
+    }
+
+    ICMP_unregister_reply(ps_id);
+    return rtt;
+}
+
+static syscall_t syscalls[] =
 {
-   &kprint,
+#define SYSCALL0(num, name, kernel_fn) [num] = (syscall_t)&kernel_fn,
+#define SYSCALL1(num, name, kernel_fn, P1) [num] = (syscall_t)&kernel_fn,
+#define SYSCALL2(num, name, kernel_fn, P1, P2) [num] = (syscall_t)&kernel_fn,
+#define SYSCALL3(num, name, kernel_fn, P1, P2, P3) [num] = (syscall_t)&kernel_fn,
+#define SYSCALL4(num, name, kernel_fn, P1, P2, P3, P4) [num] = (syscall_t)&kernel_fn,
+#define SYSCALL5(num, name, kernel_fn, P1, P2, P3, P4, P5) [num] = (syscall_t)&kernel_fn,
+#include "syscall_table.h"
 };
-uint num_syscalls = 1;
+uint num_syscalls = sizeof(syscalls) / sizeof(syscall_t);
 
 void syscall_handler2() {
    *((unsigned char *)0xb8000) = 'A';
    printf("Test\n");
 }
 
-void syscall_handler(registers_t regs)
-{
-//   *((unsigned char *)0xb8000) = 'A';
-
-   // Firstly, check if the requested syscall number is valid.
-   // The syscall number is found in EAX.
-   if (regs.eax >= num_syscalls)
-       return;
-
-   // Get the required syscall location.
-   void *location = syscalls[regs.eax];
-   // We don't know how many parameters the function wants, so we just
-   // push them all onto the stack in the correct order. The function will
-   // use all the parameters it wants, and we can pop them all back off afterwards.
-   int ret;
-   asm volatile (" \
-     push %1; \
-     push %2; \
-     push %3; \
-     push %4; \
-     push %5; \
-     call *%6; \
-     pop %%ebx; \
-     pop %%ebx; \
-     pop %%ebx; \
-     pop %%ebx; \
-     pop %%ebx; \
-   " : "=a" (ret) : "r" (regs.edi), "r" (regs.esi), "r" (regs.edx), "r" (regs.ecx), "r" (regs.ebx), "r" (location));
-   regs.eax = ret;
+// Both entry points end up here. A syscall can wait (for the network, the
+// disk...), so unlike the interrupt handlers it runs with interrupts on
+static int syscall_call(uint num, uint p1, uint p2, uint p3, uint p4, uint p5)
+{
+   if (num >= num_syscalls || !syscalls[num])
+       return -1;
+
+   asm volatile("sti");
+
+   // We don't know how many parameters the function wants, so we pass all
+   // of them: with the cdecl convention the extra ones are ignored
+   return syscalls[num](p1, p2, p3, p4, p5);
+}
+
+void syscall_handler(registers_t *regs)
+{
+   // The syscall number is found in EAX, the parameters in EBX, ECX, EDX, ESI and EDI.
+   // The return value goes in the EAX the stub restores
+   regs->eax = syscall_call(regs->eax, regs->ebx, regs->ecx, regs->edx, regs->esi, regs->edi);
+}
+
+// Called by sysenter_entry (hal.asm) with the registers of the caller. The
+// arguments 2 and 3 are on the user stack (see syscall.h)
+int sysenter_handler(uint num, uint p1, uint p4, uint p5, uint *user_stack)
+{
+   if (!syscall_check_buffer(user_stack, 12, 0)) process_exit();
+
+   return syscall_call(num, p1, user_stack[1], user_stack[2], p4, p5);
+}
+
+// Configures SYSENTER on the current CPU, if it has it. SYSEXIT returns to
+// the user code segment, which the GDT has 16 bytes after the kernel one
+void init_sysenter()
+{
+   uint eax, ebx, ecx, edx;
+   cpuid(1, &eax, &ebx, &ecx, &edx);
+
+   uint family = (eax >> 8) & 0xF, model = (eax >> 4) & 0xF, stepping = eax & 0xF;
+   if (!(edx & SYSCALL_CPUID_SEP) || (family == 6 && model < 3 && stepping < 3)) return;
+
+   wrmsr(MSR_SYSENTER_CS, 0x08);
+   wrmsr(MSR_SYSENTER_EIP, (uint)sysenter_entry);
+   sysenter_enabled = 1;
 }
 
 void init_syscalls()
 {
-   // Register our syscall handler.
-   register_interrupt_handler (0x80, &syscall_handler);
+   // Register our syscall handler. A syscall can switch to another process
+   register_switching_handler (0x80, &syscall_handler);
+   init_sysenter();
 }
 
-DEFN_SYSCALL1(printf, 0, const char*);
+// SYSENTER switches to the same kernel stack as the interrupts from ring 3,
+// set_kernel_stack() calls this on every context switch
+void sysenter_set_stack(uint esp)
+{
+   if (sysenter_enabled) wrmsr(MSR_SYSENTER_ESP, esp);
+}
@@ -3,36 +3,119 @@
 
 #include "libc.h"
 
-#define DECL_SYSCALL0(fn) int syscall_##fn();
-#define DECL_SYSCALL1(fn,p1) int syscall_##fn(p1);
-#define DECL_SYSCALL2(fn,p1,p2) int syscall_##fn(p1,p2);
+// A system call goes through SYSENTER when the CPU has it (and when we are
+// in ring 3, SYSEXIT always returns to ring 3), through int 0x80 otherwise.
+// The number is in EAX and the arguments in EBX, ECX, EDX, ESI and EDI.
+//
+// SYSENTER does not save the user stack and return address, so we push
+// them with ECX and EDX (which SYSEXIT overwrites) and give the stack to the
+// kernel in EBP:
+//   [ebp] return address, [ebp+4] ECX (arg 2), [ebp+8] EDX (arg 3), [ebp+12] EBP
+// The kernel reads the arguments 2 and 3 from there and returns on ebp+4.
+
+#define SYSCALL_CPUID_SEP       (1 << 11)
+
+// -1 until syscall_has_sysenter() looks. Defined in utils/user/syscall.c,
+// which the programs are linked with
+extern int syscall_use_sysenter;
+
+static inline int syscall_has_sysenter()
+{
+    if (syscall_use_sysenter < 0) {
+        uint eax, ebx, ecx, edx, cs;
+        asm volatile("mov %%cs, %0" : "=r"(cs));
+        // Not cpuid() from libc: the user programs are not linked with it
+        asm volatile("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(1), "c"(0));
+
+        // The Pentium Pro reports SEP without really having it
+        uint family = (eax >> 8) & 0xF, model = (eax >> 4) & 0xF, stepping = eax & 0xF;
+        int broken = family == 6 && model < 3 && stepping < 3;
+
+        syscall_use_sysenter = (cs & 3) == 3 && (edx & SYSCALL_CPUID_SEP) && !broken;
+    }
+
+    return syscall_use_sysenter;
+}
+
+static inline int syscall_invoke(uint num, uint p1, uint p2, uint p3, uint p4, uint p5)
+{
+    int ret;
+
+    if (syscall_has_sysenter()) {
+        asm volatile("      \
+          push %%ebp;       \
+          push %%edx;       \
+          push %%ecx;       \
+          push $1f;         \
+          mov %%esp, %%ebp; \
+          sysenter;         \
+        1:                  \
+          pop %%ecx;        \
+          pop %%edx;        \
+          pop %%ebp         "
+                     : "=a"(ret) : "a"(num), "b"(p1), "c"(p2), "d"(p3), "S"(p4), "D"(p5) : "memory");
+    }
+    else {
+        asm volatile("int $0x80"
+                     : "=a"(ret) : "a"(num), "b"(p1), "c"(p2), "d"(p3), "S"(p4), "D"(p5) : "memory");
+    }
+
+    return ret;
+}
 
 #define DEFN_SYSCALL0(fn, num) \
-int syscall_##fn() \
+static inline int syscall_##fn() \
 { \
- int a; \
- asm volatile("int $0x80" : "=a" (a) : "0" (num)); \
- return a; \
+ return syscall_invoke(num, 0, 0, 0, 0, 0); \
 }
 
 #define DEFN_SYSCALL1(fn, num, P1) \
-int syscall_##fn(P1 p1) \
+static inline int syscall_##fn(P1 p1) \
 { \
- int a; \
- asm volatile("int $0x80" : "=a" (a) : "0" (num), "b" ((int)p1)); \
- return a; \
+ return syscall_invoke(num, (uint)p1, 0, 0, 0, 0); \
 }
 
 #define DEFN_SYSCALL2(fn, num, P1, P2) \
-int syscall_##fn(P1 p1, P2 p2) \
+static inline int syscall_##fn(P1 p1, P2 p2) \
+{ \
+ return syscall_invoke(num, (uint)p1, (uint)p2, 0, 0, 0); \
+}
+
+#define DEFN_SYSCALL3(fn, num, P1, P2, P3) \
+static inline int syscall_##fn(P1 p1, P2 p2, P3 p3) \
+{ \
+ return syscall_invoke(num, (uint)p1, (uint)p2, (uint)p3, 0, 0); \
+}
+
+#define DEFN_SYSCALL4(fn, num, P1, P2, P3, P4) \
+static inline int syscall_##fn(P1 p1, P2 p2, P3 p3, P4 p4) \
+{ \
+ return syscall_invoke(num, (uint)p1, (uint)p2, (uint)p3, (uint)p4, 0); \
+}
+
+#define DEFN_SYSCALL5(fn, num, P1, P2, P3, P4, P5) \
+static inline int syscall_##fn(P1 p1, P2 p2, P3 p3, P4 p4, P5 p5) \
 { \
- int a; \
- asm volatile("int $0x80" : "=a" (a) : "0" (num), "b" ((int)p1), "c" ((int)p2)); \
- return a; \
+ return syscall_invoke(num, (uint)p1, (uint)p2, (uint)p3, (uint)p4, (uint)p5); \
 }
 
-void initialise_syscalls();
+// The syscall_<name>() stubs of every system call in syscall_table.h
+#define SYSCALL0(num, name, kernel_fn) DEFN_SYSCALL0(name, num)
+#define SYSCALL1(num, name, kernel_fn, P1) DEFN_SYSCALL1(name, num, P1)
+#define SYSCALL2(num, name, kernel_fn, P1, P2) DEFN_SYSCALL2(name, num, P1, P2)
+#define SYSCALL3(num, name, kernel_fn, P1, P2, P3) DEFN_SYSCALL3(name, num, P1, P2, P3)
+#define SYSCALL4(num, name, kernel_fn, P1, P2, P3, P4) DEFN_SYSCALL4(name, num, P1, P2, P3, P4)
+#define SYSCALL5(num, name, kernel_fn, P1, P2, P3, P4, P5) DEFN_SYSCALL5(name, num, P1, P2, P3, P4, P5)
+#include "syscall_table.h"
+#undef SYSCALL0
+#undef SYSCALL1
+#undef SYSCALL2
+#undef SYSCALL3
+#undef SYSCALL4
+#undef SYSCALL5
 
-DECL_SYSCALL1(printf, const char*);
+void init_syscalls();
+void init_sysenter();
+void sysenter_set_stack(uint esp);
 
 #endif
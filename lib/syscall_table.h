@@ -0,0 +1,30 @@
+// The system calls: number, name, kernel function and argument types.
+//
+// This file is included with different definitions of the SYSCALLn macros:
+// lib/syscall.h turns each line into a syscall_<name>() stub for the user
+// programs, lib/syscall.c into an entry of the kernel syscall table. The
+// numbers are the ABI, don't reuse or reorder them.
+
+// Console and processes
+SYSCALL1(0,  printf,      kprint,              const char*)
+SYSCALL0(1,  exit,        process_exit)
+SYSCALL0(2,  getpid,      getpid)
+SYSCALL0(3,  yield,       sys_yield)
+SYSCALL1(4,  sleep,       sys_sleep,           uint)
+SYSCALL2(5,  print_int,   kprint_int,          const char*, int)
+
+// Files (in the root directory)
+SYSCALL1(6,  file_size,   sys_file_size,       const char*)
+SYSCALL3(7,  read_file,   sys_read_file,       const char*, void*, uint)
+
+// Memory
+SYSCALL1(8,  sbrk,        sys_sbrk,            int)
+
+// Time
+SYSCALL0(9,  time,        clock_time)
+SYSCALL0(10, uptime_ms,   sys_uptime_ms)
+
+// Network
+SYSCALL1(11, dns_resolve, sys_dns_resolve,     const char*)
+SYSCALL2(12, ping,        sys_ping,            uint, uint)
+SYSCALL0(13, ipv4,        network_get_IPv4)
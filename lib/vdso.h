@@ -0,0 +1,82 @@
+#ifndef __VDSO_H
+#define __VDSO_H
+
+#include "libc.h"
+
+// Read-only pages the kernel maps at the top of every user address space:
+// the first one is shared by all the processes and updated by the kernel,
+// the second one belongs to the process. The helpers below only read them,
+// so the programs can get the time or their PID without a system call.
+//
+// Like syscall.h, this is compiled in the user programs: everything is
+// static inline and can't use the libc.
+
+#define VDSO_ADDRESS            0xBFFFE000
+#define VDSO_PROCESS_ADDRESS    (VDSO_ADDRESS + 0x1000)
+
+typedef struct {
+	volatile uint timer_ticks;		// The BSP timer interrupts since the boot
+	volatile uint time;				// Unix time, updated every tick
+
+	// The TSC: ns = (rdtsc() - boot_cycles) * ns_mult >> ns_shift
+	uint64 boot_cycles;
+	uint TSC_kHz;
+	uint ns_mult;
+	uint ns_shift;
+	uint boot_time;					// Unix time at boot_cycles
+
+	// The network configuration (IPv4 addresses in network order)
+	volatile uint network_status;	// NET_* in net/network.h
+	volatile uint IPv4;
+	volatile uint router_IPv4;
+	volatile uint DNS;
+	uint8 MAC[6];
+} VDSOData;
+
+typedef struct {
+	uint pid;
+} VDSOProcess;
+
+static inline VDSOData *vdso_data() {
+	return (VDSOData*)VDSO_ADDRESS;
+}
+
+static inline uint vdso_getpid() {
+	return ((VDSOProcess*)VDSO_PROCESS_ADDRESS)->pid;
+}
+
+static inline uint vdso_ticks() {
+	return vdso_data()->timer_ticks;
+}
+
+static inline uint vdso_time() {
+	return vdso_data()->time;
+}
+
+// Nanoseconds since the boot, the same clock as clock_ns() in the kernel.
+// 64 x 32-bit multiplication done in two halves, without libgcc
+static inline uint64 vdso_ns() {
+	VDSOData *data = vdso_data();
+	uint low, high;
+	asm volatile("rdtsc" : "=a"(low), "=d"(high));
+
+	uint64 cycles = (((uint64)high << 32) | low) - data->boot_cycles;
+	uint cycles_high = cycles >> 32, cycles_low = (uint)cycles;
+
+	return (((uint64)cycles_high * data->ns_mult) << (32 - data->ns_shift)) +
+	       (((uint64)cycles_low * data->ns_mult) >> data->ns_shift);
+}
+
+static inline uint vdso_IPv4() {
+	return vdso_data()->IPv4;
+}
+
+// The kernel side, in kernel/vdso.c
+struct page_directory_t;
+
+void init_vdso();
+void vdso_map(struct page_directory_t *dir, uint pid);
+void vdso_tick(uint timer_ticks);
+void vdso_update_network();
+
+#endif
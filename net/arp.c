@@ -3,6 +3,8 @@
 #include "ethernet.h"
 #include "display.h"
 #include "debug.h"
+#include "spinlock.h"
+#include "packet.h"
 
 #define ARP_REQUEST		0x0100
 #define ARP_REPLY		0x0200
@@ -28,8 +30,31 @@ typedef struct {
 ARPEntry ARP_table[100];
 uint16 nb_ARP_entries = 0;
 
+// The table is filled by the receive path (in the network interrupt)
+// and read by the processes
+Spinlock ARP_lock = SPINLOCK_INIT;
+
+// Returns the MAC address of the IP address if we know it, 0 otherwise
+static uint8 *ARP_lookup(uint ipv4) {
+	uint8 *MAC = 0;
+	uint eflags = spinlock_lock_irqsave(&ARP_lock);
+
+	for (int i=0; i<nb_ARP_entries; i++) {
+		if (ARP_table[i].ipv4 == ipv4) {
+			MAC = (uint8*)&ARP_table[i].MAC;
+			break;
+		}
+	}
+
+	spinlock_unlock_irqrestore(&ARP_lock, eflags);
+	return MAC;
+}
+
 void ARP_print_table(Window *win) {
 	uint8 *ip;
+
+	// No lock: printing is too slow to keep the interrupts off, and the
+	// entries are only ever appended
 	for (int i=0; i<nb_ARP_entries; i++) {
 		ip = (uint8*)&(ARP_table[i].ipv4);
 		printf_win(win, "%d.%d.%d.%d => %X:%X:%X:%X:%X:%X\n",
@@ -39,12 +64,11 @@ void ARP_print_table(Window *win) {
 }
 
 void ARP_send_request(uint ipv4) {
-	// Get an Ethernet packet
-	uint16 offset;
-	uint8 *buffer = ethernet_create_packet(ETHERNET_ARP, 0xFFFFFFFF, ARP_HEADER_SIZE + 18, &offset);
+	// The packet is padded to the minimum Ethernet frame size
+	PacketBuffer *pb = packet_alloc(PACKET_HEADROOM);
+	if (!pb) return;
 
-	// Append the IPv4 header
-	ARPPacket *header = (ARPPacket*)(buffer + offset);
+	ARPPacket *header = (ARPPacket*)packet_put_zero(pb, ARP_HEADER_SIZE + 18);
 	header->hw_type = 0x0100;
 	header->protocol = 0x0008;
 	header->hw_size = 6;
@@ -57,16 +81,15 @@ void ARP_send_request(uint ipv4) {
 	for (int i=0; i<6; i++)
 		header->sender_MAC[i] = MAC[i];
 
-	ethernet_send_packet(buffer, offset + 18 + ARP_HEADER_SIZE);
+	ethernet_send_packet(pb, ETHERNET_ARP, 0xFFFFFFFF);
 }
 
-uint8 *ARP_send_reply(uint ipv4, uint8 *MAC_dest) {
-	// Get an Ethernet packet
-	uint16 offset;
-	uint8 *buffer = ethernet_create_packet(ETHERNET_ARP, ipv4, ARP_HEADER_SIZE + 18, &offset);
+void ARP_send_reply(uint ipv4, uint8 *MAC_dest) {
+	// The packet is padded to the minimum Ethernet frame size
+	PacketBuffer *pb = packet_alloc(PACKET_HEADROOM);
+	if (!pb) return;
 
-	// Append the IPv4 header
-	ARPPacket *header = (ARPPacket*)(buffer + offset);
+	ARPPacket *header = (ARPPacket*)packet_put_zero(pb, ARP_HEADER_SIZE + 18);
 	header->hw_type = 0x0100;
 	header->protocol = 0x0008;
 	header->hw_size = 6;
@@ -81,13 +104,12 @@ uint8 *ARP_send_reply(uint ipv4, uint8 *MAC_dest) {
 		header->target_MAC[i] = MAC_dest[i];
 	}
 
-	ethernet_send_packet(buffer, offset + 18 + ARP_HEADER_SIZE);
+	ethernet_send_packet(pb, ETHERNET_ARP, ipv4);
 }
 
 uint8 *ARP_get_MAC(uint ipv4) {
-	for (int i=0; i<nb_ARP_entries; i++) {
-		if (ARP_table[i].ipv4 == ipv4) return (uint8*)&ARP_table[i].MAC;
-	}
+	uint8 *MAC = ARP_lookup(ipv4);
+	if (MAC) return MAC;
 
 	if (nb_ARP_entries == 1) printf("No MAC for %x\n", ipv4);
 
@@ -96,9 +118,8 @@ uint8 *ARP_get_MAC(uint ipv4) {
 		ARP_send_request(ipv4);
 
 		for (int j=0; j<2000000000; j++) {
-			for (int i=0; i<nb_ARP_entries; i++) {
-				if (ARP_table[i].ipv4 == ipv4) return (uint8*)&ARP_table[i].MAC;
-			}
+			MAC = ARP_lookup(ipv4);
+			if (MAC) return MAC;
 		}
 	}
 
@@ -110,20 +131,28 @@ uint8 *ARP_get_MAC(uint ipv4) {
 
 void ARP_add_MAC(uint ipv4, uint8 *MAC) {
 	int i;
+	uint eflags = spinlock_lock_irqsave(&ARP_lock);
 
 	for (i=0; i<nb_ARP_entries; i++) {
 		if (ARP_table[i].ipv4 == ipv4) {
 			for (int j=0; j<6; j++)
 				ARP_table[i].MAC[j] = MAC[j];
+			spinlock_unlock_irqrestore(&ARP_lock, eflags);
 			return;
 		}
 	}
 
+	if (nb_ARP_entries >= 100) {
+		spinlock_unlock_irqrestore(&ARP_lock, eflags);
+		return;
+	}
+
 	ARP_table[nb_ARP_entries].ipv4 = ipv4;
 	for (int j=0; j<6; j++)
 		ARP_table[nb_ARP_entries].MAC[j] = MAC[j];
 
 	nb_ARP_entries++;
+	spinlock_unlock_irqrestore(&ARP_lock, eflags);
 
 	if (is_debug()) printf("%i => %X:%X:%X:%X:%X:%X\n",
 						   ipv4,
@@ -138,6 +167,10 @@ void ARP_receive_packet(uint8 *buffer) {
 		ARP_add_MAC(header->sender_ip, (uint8*)&header->sender_MAC);
 	}
 	else if (header->opcode == ARP_REQUEST) {
+		// The requests are broadcast, we only answer the ones for us
+		uint ipv4 = network_get_IPv4();
+		if (ipv4 && header->target_ip != ipv4) return;
+
 		if (is_debug()) printf("=> [ARP request from %i]\n", header->sender_ip);
 		ARP_add_MAC(header->sender_ip, (uint8*)&header->sender_MAC);
 		ARP_send_reply(header->sender_ip, (uint8*)&header->sender_MAC);
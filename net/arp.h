@@ -6,7 +6,7 @@
 
 uint8 *ARP_get_MAC(uint ipv4);
 void ARP_send_request(uint ipv4);
-void ARP_send_reply(uint ipv4);
+void ARP_send_reply(uint ipv4, uint8 *MAC_dest);
 void ARP_receive_packet(uint8 *buffer);
 void init_ARP();
 void ARP_print_table(Window *win);
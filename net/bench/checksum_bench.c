@@ -0,0 +1,119 @@
+// Compares the implementations of inet_csum_partial() (net/checksum.c).
+// This runs on the build machine, not in CHAOS: make checksum_bench
+//
+// Each implementation is first checked against the way the protocols used
+// to compute their checksums (16-bit words, swapped to host order), on
+// random data of every length and alignment, then timed on packet sized
+// buffers.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "checksum.h"
+
+#define MAX_SIZE    65536
+#define BENCH_BYTES (256u << 20)    // Summed per implementation and size
+
+typedef struct {
+    const char *name;
+    uint (*partial)(const void *buf, uint len, uint sum);
+} Variant;
+
+static const Variant variants[] = {
+    { "16-bit",  inet_csum_partial_16 },
+    { "32-bit",  inet_csum_partial_32 },
+    { "64-bit",  inet_csum_partial_64 },
+#ifdef __SSE2__
+    { "SSE2",    inet_csum_partial_sse2 },
+#endif
+    { "default", inet_csum_partial },
+};
+#define NB_VARIANTS (sizeof(variants) / sizeof(Variant))
+
+static const uint sizes[] = { 20, 64, 576, 1500, 9000, 65536 };
+#define NB_SIZES (sizeof(sizes) / sizeof(uint))
+
+// The old code: big endian words, and the result swapped back
+static uint16 reference_csum(const uint8 *buf, uint len) {
+    uint sum = 0;
+
+    for (; len > 1; len -= 2, buf += 2) sum += (buf[0] << 8) | buf[1];
+    if (len) sum += buf[0] << 8;
+
+    while (sum >> 16) sum = (sum & 0xFFFF) + (sum >> 16);
+
+    uint16 check = ~sum;
+    return (check >> 8) | (check << 8);
+}
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int check_variants(uint8 *buf) {
+    int errors = 0;
+
+    for (uint len = 0; len <= 2048; len++) {
+        for (uint align = 0; align < 16; align++) {
+            uint16 expected = reference_csum(buf + align, len);
+
+            for (uint v = 0; v < NB_VARIANTS; v++) {
+                uint16 check = inet_csum_finish(variants[v].partial(buf + align, len, 0));
+                if (check != expected && errors++ < 10)
+                    printf("%s: length %u, alignment %u: %04X instead of %04X\n", variants[v].name, len, align, check, expected);
+            }
+        }
+    }
+
+    // A packet summed in two pieces, the second one at an odd offset
+    for (uint split = 0; split <= 1500; split++) {
+        uint sum = inet_csum_block_add(inet_csum_partial(buf, split, 0), inet_csum_partial(buf + split, 1500 - split, 0), split);
+        if (inet_csum_finish(sum) != reference_csum(buf, 1500) && errors++ < 10)
+            printf("block add: split at %u\n", split);
+    }
+
+    // An incremental update gives what summing again gives
+    for (uint i = 0; i < 1000; i++) {
+        uint16 *word = (uint16*)(buf + 2 * (rand() % 32));
+        uint16 check = inet_csum(buf, 64), old_value = *word;
+
+        *word = rand();
+        if (inet_csum_update16(check, old_value, *word) != inet_csum(buf, 64) && errors++ < 10)
+            printf("update16: %04X to %04X\n", old_value, *word);
+    }
+
+    return errors;
+}
+
+int main() {
+    uint8 *buf = malloc(MAX_SIZE + 64);
+    srand(42);
+    for (uint i = 0; i < MAX_SIZE + 64; i++) buf[i] = rand();
+
+    int errors = check_variants(buf);
+    printf("Correctness: %s\n\n", errors ? "FAILED" : "ok");
+
+    printf("%-8s", "bytes");
+    for (uint v = 0; v < NB_VARIANTS; v++) printf("%12s", variants[v].name);
+    printf("    (MB/s)\n");
+
+    volatile uint sink = 0;
+    for (uint s = 0; s < NB_SIZES; s++) {
+        uint size = sizes[s], rounds = BENCH_BYTES / size;
+        printf("%-8u", size);
+
+        for (uint v = 0; v < NB_VARIANTS; v++) {
+            double start = now();
+            for (uint r = 0; r < rounds; r++) sink += variants[v].partial(buf + (r & 1), size, 0);
+            double elapsed = now() - start;
+
+            printf("%12.0f", (double)rounds * size / elapsed / 1e6);
+        }
+        printf("\n");
+    }
+
+    free(buf);
+    return errors != 0;
+}
@@ -0,0 +1,146 @@
+#include "checksum.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// x86 loads words at any address. The types tell the compiler so
+typedef uint16 __attribute__((may_alias, aligned(1))) unaligned_uint16;
+typedef uint __attribute__((may_alias, aligned(1))) unaligned_uint;
+
+static uint csum_fold64(uint64 sum) {
+	sum = (sum & 0xFFFFFFFF) + (sum >> 32);
+	sum = (sum & 0xFFFFFFFF) + (sum >> 32);
+	return sum;
+}
+
+// A word at the end has its single byte first in memory: on a little
+// endian CPU, in the low half
+static uint64 csum_tail(const uint8 *p, uint len, uint64 sum) {
+	if (len & 2) {
+		sum += *(unaligned_uint16*)p;
+		p += 2;
+	}
+	if (len & 1) sum += *p;
+	return sum;
+}
+
+// 16 bits at a time, the way the protocols used to do it (without the
+// byte swaps)
+uint inet_csum_partial_16(const void *buf, uint len, uint sum) {
+	const uint8 *p = buf;
+	uint64 acc = sum;
+
+	for (; len >= 2; len -= 2, p += 2) acc += *(unaligned_uint16*)p;
+	if (len) acc += *p;
+
+	return csum_fold64(acc);
+}
+
+// 32 bits at a time in a 32-bit sum, the carry going back in every time
+uint inet_csum_partial_32(const void *buf, uint len, uint sum) {
+	const uint8 *p = buf;
+
+	for (; len >= 4; len -= 4, p += 4) {
+		uint word = *(unaligned_uint*)p;
+		sum += word;
+		sum += sum < word;
+	}
+
+	return inet_csum_add(sum, csum_fold64(csum_tail(p, len, 0)));
+}
+
+// 32 bits at a time in a 64-bit sum: no carry to take care of until the
+// end (it would take 4GB of data to overflow)
+uint inet_csum_partial_64(const void *buf, uint len, uint sum) {
+	const uint8 *p = buf;
+	uint64 acc = sum;
+
+	for (; len >= 32; len -= 32, p += 32) {
+		acc += *(unaligned_uint*)p;
+		acc += *(unaligned_uint*)(p + 4);
+		acc += *(unaligned_uint*)(p + 8);
+		acc += *(unaligned_uint*)(p + 12);
+		acc += *(unaligned_uint*)(p + 16);
+		acc += *(unaligned_uint*)(p + 20);
+		acc += *(unaligned_uint*)(p + 24);
+		acc += *(unaligned_uint*)(p + 28);
+	}
+	for (; len >= 4; len -= 4, p += 4) acc += *(unaligned_uint*)p;
+
+	return csum_fold64(csum_tail(p, len, acc));
+}
+
+#ifdef __SSE2__
+// 16 bytes at a time: the four 32-bit words are widened to 64 bits and
+// added to two 64-bit sums, which can't overflow either. Only built when
+// the compiler may use SSE2: the kernel doesn't enable it (nor save the XMM
+// registers on a context switch), the benchmark does
+uint inet_csum_partial_sse2(const void *buf, uint len, uint sum) {
+	const uint8 *p = buf;
+	__m128i zero = _mm_setzero_si128(), acc1 = zero, acc2 = zero;
+
+	for (; len >= 64; len -= 64, p += 64) {
+		__m128i v1 = _mm_loadu_si128((const __m128i*)p);
+		__m128i v2 = _mm_loadu_si128((const __m128i*)(p + 16));
+		__m128i v3 = _mm_loadu_si128((const __m128i*)(p + 32));
+		__m128i v4 = _mm_loadu_si128((const __m128i*)(p + 48));
+
+		acc1 = _mm_add_epi64(acc1, _mm_unpacklo_epi32(v1, zero));
+		acc2 = _mm_add_epi64(acc2, _mm_unpackhi_epi32(v1, zero));
+		acc1 = _mm_add_epi64(acc1, _mm_unpacklo_epi32(v2, zero));
+		acc2 = _mm_add_epi64(acc2, _mm_unpackhi_epi32(v2, zero));
+		acc1 = _mm_add_epi64(acc1, _mm_unpacklo_epi32(v3, zero));
+		acc2 = _mm_add_epi64(acc2, _mm_unpackhi_epi32(v3, zero));
+		acc1 = _mm_add_epi64(acc1, _mm_unpacklo_epi32(v4, zero));
+		acc2 = _mm_add_epi64(acc2, _mm_unpackhi_epi32(v4, zero));
+	}
+
+	uint64 lanes[2];
+	_mm_storeu_si128((__m128i*)lanes, _mm_add_epi64(acc1, acc2));
+
+	return inet_csum_partial_64(p, len, csum_fold64((uint64)sum + lanes[0] + lanes[1]));
+}
+#endif
+
+// Adds a buffer to a partial sum. The buffer starts a 16-bit word: for a
+// piece which starts at an odd offset, use inet_csum_block_add()
+uint inet_csum_partial(const void *buf, uint len, uint sum) {
+#ifdef __SSE2__
+	if (len >= 256) return inet_csum_partial_sse2(buf, len, sum);
+#endif
+	return inet_csum_partial_64(buf, len, sum);
+}
+
+// Adds the pseudo header TCP and UDP checksums start with. The addresses
+// are in network byte order, the length in host byte order
+uint inet_csum_pseudo(uint ip_src, uint ip_dst, uint8 protocol, uint16 length, uint sum) {
+	uint64 acc = sum;
+
+	acc += ip_src;
+	acc += ip_dst;
+	acc += (uint16)((length >> 8) | (length << 8));
+	acc += (uint)protocol << 8;
+
+	return csum_fold64(acc);
+}
+
+// Updates a checksum after a 16-bit field of the data it covers has
+// changed, without going over the data again (RFC 1624, equation 3:
+// HC' = ~(~HC + ~m + m')). The values are as they are in the packet
+uint16 inet_csum_update16(uint16 check, uint16 old_value, uint16 new_value) {
+	uint sum = (uint16)~check;
+	sum += (uint16)~old_value;
+	sum += new_value;
+
+	return inet_csum_finish(sum);
+}
+
+// The same for a 32-bit field, e.g. an IPv4 address
+uint16 inet_csum_update32(uint16 check, uint old_value, uint new_value) {
+	uint64 sum = (uint16)~check;
+	sum += ~old_value;
+	sum += new_value;
+
+	return inet_csum_finish(csum_fold64(sum));
+}
@@ -0,0 +1,69 @@
+#ifndef __CHECKSUM_H
+#define __CHECKSUM_H
+
+// The Internet checksum (RFC 1071): the one's complement of the one's
+// complement sum of the 16-bit words. That sum doesn't depend on the byte
+// order, so we add the words as the CPU loads them and the result can be
+// stored in the packet as it is, without swapping anything.
+//
+// The partial sums are 32 bits: inet_csum_partial() adds a buffer to one,
+// inet_csum_finish() folds it to 16 bits and complements it. The pieces of
+// a packet can be summed separately and put together with
+// inet_csum_block_add().
+
+#ifdef CHECKSUM_HOST
+// Built on the host by the benchmark (net/bench), without the kernel libc
+#include <stdint.h>
+typedef uint32_t uint;
+typedef uint16_t uint16;
+typedef uint8_t  uint8;
+typedef uint64_t uint64;
+#else
+#include "libc.h"
+#endif
+
+uint inet_csum_partial(const void *buf, uint len, uint sum);
+uint inet_csum_pseudo(uint ip_src, uint ip_dst, uint8 protocol, uint16 length, uint sum);
+uint16 inet_csum_update16(uint16 check, uint16 old_value, uint16 new_value);
+uint16 inet_csum_update32(uint16 check, uint old_value, uint new_value);
+
+// The implementations inet_csum_partial() chooses from, for the benchmark
+uint inet_csum_partial_16(const void *buf, uint len, uint sum);
+uint inet_csum_partial_32(const void *buf, uint len, uint sum);
+uint inet_csum_partial_64(const void *buf, uint len, uint sum);
+#ifdef __SSE2__
+uint inet_csum_partial_sse2(const void *buf, uint len, uint sum);
+#endif
+
+// Adds two partial sums, with the carry going around
+static inline uint inet_csum_add(uint sum, uint sum2) {
+	sum += sum2;
+	return sum + (sum < sum2);
+}
+
+// Adds the partial sum of a block which starts offset bytes into the data:
+// at an odd offset its bytes are in the other half of the 16-bit words
+static inline uint inet_csum_block_add(uint sum, uint sum2, uint offset) {
+	if (offset & 1) sum2 = (sum2 >> 8) | (sum2 << 24);
+	return inet_csum_add(sum, sum2);
+}
+
+// The 16 bits of a partial sum, not complemented (e.g. the pseudo header
+// a NIC completes)
+static inline uint16 inet_csum_fold(uint sum) {
+	sum = (sum & 0xFFFF) + (sum >> 16);
+	sum = (sum & 0xFFFF) + (sum >> 16);
+	return sum;
+}
+
+// The value of the checksum field. Over data which includes its checksum,
+// it is 0 when the checksum is right
+static inline uint16 inet_csum_finish(uint sum) {
+	return ~inet_csum_fold(sum);
+}
+
+static inline uint16 inet_csum(const void *buf, uint len) {
+	return inet_csum_finish(inet_csum_partial(buf, len, 0));
+}
+
+#endif
@@ -40,14 +40,15 @@ uint txn_id = 0x36823B2C;
 
 void DHCP_send_packet() {
 //	printf_win(win, "MAC address: %X:%X:%X:%X:%X:%X\n", E1000_adapter.MAC[0], E1000_adapter.MAC[1], E1000_adapter.MAC[2], E1000_adapter.MAC[3], E1000_adapter.MAC[4], E1000_adapter.MAC[5]);
-	uint16 offset;
 
 	// We want to send an UDP packet to IP address 255.255.255.255 (broadcast)
 	// source port=68, dest port=67 whose message is 300 bytes long (excluding headers)
-	uint8* buffer = UDP_create_packet(0xFFFFFFFF, UDP_PORT_DHCP, 67, 300, &offset);
+	PacketBuffer *pb = packet_alloc(PACKET_HEADROOM);
+	if (!pb) return;
+	uint8 *buffer = packet_put_zero(pb, 300);
 
 	// Append the HDCP header
-	DHCPHeader *header = (DHCPHeader*)(buffer + offset);
+	DHCPHeader *header = (DHCPHeader*)buffer;
 
 	header->msg_type = DHCP_REQUEST;
 	header->hardware_type = 0x01;
@@ -72,25 +73,26 @@ void DHCP_send_packet() {
 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	0x00, 0x00, 0x00, 0x00, 0x00, 0x00,	0x00, 0x00, 0x00, 0x00
 	};
 	
-	memcpy(buffer + offset + DHCP_HEADER_SIZE, (unsigned char *)&dhcp_options, 60);
+	memcpy(buffer + DHCP_HEADER_SIZE, (unsigned char *)&dhcp_options, 60);
 
 //	uint16 checksum_UDP = checksum(&dhcp_packet + 42, 300);
 //	printf_win(win, "%x\n", checksum_UDP);
 
-	UDP_send_packet(buffer, 300 + offset, offset);
+	UDP_send_packet(pb, 0xFFFFFFFF, UDP_PORT_DHCP, 67);
 }
 
 void DHCP_send_request(uint ip, uint router_ip) {
 //	printf_win(win, "MAC address: %X:%X:%X:%X:%X:%X\n", E1000_adapter.MAC[0], E1000_adapter.MAC[1], E1000_adapter.MAC[2], E1000_adapter.MAC[3], E1000_adapter.MAC[4], E1000_adapter.MAC[5]);
-	uint16 offset;
 	uint8 *ipv4 = (uint8*)&ip, *router_ipv4 = (uint8*)&router_ip;
 
 	// We want to send an UDP packet to IP address 255.255.255.255 (broadcast)
 	// source port=68, dest port=67 whose message is 300 bytes long (excluding headers)
-	uint8* buffer = UDP_create_packet(0xFFFFFFFF, UDP_PORT_DHCP, 67, 300, &offset);
+	PacketBuffer *pb = packet_alloc(PACKET_HEADROOM);
+	if (!pb) return;
+	uint8 *buffer = packet_put_zero(pb, 300);
 
 	// Append the HDCP header
-	DHCPHeader *header = (DHCPHeader*)(buffer + offset);
+	DHCPHeader *header = (DHCPHeader*)buffer;
 
 	header->msg_type = DHCP_REQUEST;
 	header->hardware_type = 0x01;
@@ -119,12 +121,12 @@ void DHCP_send_request(uint ip, uint router_ip) {
 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 	};
 	
-	memcpy(buffer + offset + DHCP_HEADER_SIZE, (unsigned char *)&dhcp_options, 60);
+	memcpy(buffer + DHCP_HEADER_SIZE, (unsigned char *)&dhcp_options, 60);
 
 //	uint16 checksum_UDP = checksum(&dhcp_packet + 42, 300);
 //	printf_win(win, "%x\n", checksum_UDP);
 
-	UDP_send_packet(buffer, 300 + offset, offset);
+	UDP_send_packet(pb, 0xFFFFFFFF, UDP_PORT_DHCP, 67);
 }
 
 void DHCP_receive_packet(uint8* buffer, uint16 size) {
@@ -177,13 +179,13 @@ void DHCP_receive_packet(uint8* buffer, uint16 size) {
 	}
 
 	Network *network = network_get_info();
-	network->IPv4 = ipv4;
 	network->router_IPv4 = router_IPv4;
 	network->subnet_mask = subnet_mask;
 	// Hard-coding the DNS from Level 3 (209.244.0.3)
 	network->dns = 0x0300F4D1;
 //	network->dns = 0x7900A8C0;
 //	network->dns = dns;
+	network_set_IPv4(ipv4);
 
 	// We want to fill the ARP table to get
 	// the MAC address of the router
@@ -2,6 +2,7 @@
 #include "network.h"
 #include "udp.h"
 #include "display.h"
+#include "spinlock.h"
 
 #define DNS_FLAG_QUERY			0x0001
 #define DNS_FLAG_RESPONSE		0x0080
@@ -39,6 +40,10 @@ typedef struct {
 DNSEntry DNS_table[100];
 uint nb_DNS_entries;
 
+// The table is filled by the receive path (in the network interrupt)
+// and read by the processes
+Spinlock DNS_lock = SPINLOCK_INIT;
+
 void DNS_print_table(Window *win) {
 	for (int i=0; i<nb_DNS_entries; i++) {
 		printf_win(win, "%s => %i\n", &DNS_table[i].hostname, DNS_table[i].ipv4);
@@ -46,15 +51,28 @@ void DNS_print_table(Window *win) {
 }
 
 int DNS_get_entry(char *hostname) {
+	int idx = -1;
+	uint eflags = spinlock_lock_irqsave(&DNS_lock);
+
 	for (int i=0; i<nb_DNS_entries; i++) {
-		if (!strcmp(hostname, DNS_table[i].hostname)) return i;
+		if (!strcmp(hostname, DNS_table[i].hostname)) {
+			idx = i;
+			break;
+		}
 	}
 
-	return -1;
+	spinlock_unlock_irqrestore(&DNS_lock, eflags);
+	return idx;
 }
 
 void DNS_add_entry(uint8 *buffer, char *hostname, uint ipv4) {
 	int idx = 0;
+	uint eflags = spinlock_lock_irqsave(&DNS_lock);
+
+	if (nb_DNS_entries >= 100) {
+		spinlock_unlock_irqrestore(&DNS_lock, eflags);
+		return;
+	}
 
 	strcpy(DNS_table[nb_DNS_entries].hostname, hostname+1);
 
@@ -79,21 +97,23 @@ void DNS_add_entry(uint8 *buffer, char *hostname, uint ipv4) {
 
 //	printf("DNS: %s -> %i\n", DNS_table[nb_DNS_entries].hostname, DNS_table[nb_DNS_entries].ipv4);
 	nb_DNS_entries++;
+	spinlock_unlock_irqrestore(&DNS_lock, eflags);
 }
 
 void DNS_send_packet(char *hostname) {
 //	printf_win(win, "MAC address: %X:%X:%X:%X:%X:%X\n", E1000_adapter.MAC[0], E1000_adapter.MAC[1], E1000_adapter.MAC[2], E1000_adapter.MAC[3], E1000_adapter.MAC[4], E1000_adapter.MAC[5]);
-	uint16 offset;
 	uint len = strlen(hostname);
 
 	// We want to send an UDP packet to IP address 255.255.255.255 (broadcast)
 	// source port=68, dest port=67 whose message is 300 bytes long (excluding headers)
 	Network *network = network_get_info();
 
-	uint8* buffer = UDP_create_packet(network_get_DNS(), 53, UDP_PORT_DNS, 18 + len, &offset);
+	PacketBuffer *pb = packet_alloc(PACKET_HEADROOM);
+	if (!pb) return;
+	uint8 *buffer = packet_put_zero(pb, 18 + len);
 
 	// Append the HDCP header
-	DNSHeader *header = (DNSHeader*)(buffer + offset);
+	DNSHeader *header = (DNSHeader*)buffer;
 	header->txn_id = 0x0000;
 	header->flags = DNS_FLAG_QUERY;
 	header->questions = switch_endian16(1);
@@ -101,8 +121,8 @@ void DNS_send_packet(char *hostname) {
 	header->authority_rr = 0;
 	header->addnl_rr = 0;
 
-	int len_offset = offset + 12;
-	int write_offset = offset + 13;
+	int len_offset = 12;
+	int write_offset = 13;
 	for (int i=0; i<len; i++) {
 		if (hostname[i] == '.') {
 			buffer[len_offset] = write_offset - len_offset - 1;
@@ -114,10 +134,10 @@ void DNS_send_packet(char *hostname) {
 	}
 	buffer[len_offset] = write_offset - len_offset - 1;
 
-	buffer[offset + 13 + len + 2] = 0x01;
-	buffer[offset + 13 + len + 4] = 0x01;
+	buffer[13 + len + 2] = 0x01;
+	buffer[13 + len + 4] = 0x01;
 
-	UDP_send_packet(buffer, offset + 18 + len, offset);
+	UDP_send_packet(pb, network_get_DNS(), 53, UDP_PORT_DNS);
 }
 
 void DNS_receive_packet(uint8* buffer, uint16 size) {
@@ -5,6 +5,7 @@
 #include "ethernet.h"
 #include "ipv4.h"
 #include "arp.h"
+#include "packet.h"
 
 #define ETHERNET_HEADER_SIZE	14
 
@@ -14,38 +15,36 @@ typedef struct __attribute__((packed)) {
 	uint16 type;
 } EthernetHeader;
 
-uint8 *ethernet_create_packet(uint16 protocol, uint ipv4, uint16 size, uint16 *offset) {
-	size += ETHERNET_HEADER_SIZE;
-	uint8 *buffer = (uint8*)kmalloc(size);
-	memset(buffer, 0, size);
+// Adds the Ethernet header and gives the packet to the NIC, which frees it
+void ethernet_send_packet(PacketBuffer *pb, uint16 protocol, uint ipv4) {
+	EthernetHeader *header = (EthernetHeader*)packet_push(pb, ETHERNET_HEADER_SIZE);
+	if (!header) {
+		packet_free(pb);
+		return;
+	}
 
 	uint8 *MAC_src = network_get_MAC();
 	uint8 *MAC_dst = ARP_get_MAC(ipv4);
 
-	EthernetHeader *header = (EthernetHeader*)buffer;
 	for (int i=0; i<6; i++) {
 		header->dest[i] = MAC_dst[i];
 		header->src[i] = MAC_src[i];
 	}
 	header->type = protocol;
 
-	*offset = ETHERNET_HEADER_SIZE;
-	return buffer;
-}
-
-void ethernet_send_packet(uint8* buffer, uint16 size) {
-	EthernetHeader *header = (EthernetHeader*)buffer;
 //	printf("%X:%X:%X:%X:%X:%X <=\n", header->dest[0], header->dest[1], header->dest[2], header->dest[3], header->dest[4], header->dest[5]);
-	E1000_send_packet(buffer, size);
-
-	kfree(buffer);
+	E1000_send_packet(pb);
 }
 
-void ethernet_receive_packet(uint8* buffer, uint16 size) {
-	EthernetHeader *header = (EthernetHeader*)buffer;
+// The driver frees the buffer when we return, the layers above take a
+// reference if they keep it
+void ethernet_receive_packet(PacketBuffer *pb) {
+	EthernetHeader *header = (EthernetHeader*)pb->data;
 	uint8 *MAC_router;
 	IPv4Header *header_ip;
 
+	if (!packet_pull(pb, ETHERNET_HEADER_SIZE)) return;
+
 	switch(header->type) {
 		case ETHERNET_IPV4:
 			MAC_router = network_get_router_MAC();
@@ -56,13 +55,13 @@ void ethernet_receive_packet(uint8* buffer, uint16 size) {
 				header->src[4] != MAC_router[4] ||
 				header->src[5] != MAC_router[5]) {
 
-				header_ip = (IPv4Header*)(buffer + ETHERNET_HEADER_SIZE);
+				header_ip = (IPv4Header*)pb->data;
 				ARP_add_MAC(header_ip->ip_src, (uint8*)&header->src);
 			}
-			IPv4_receive_packet(buffer + ETHERNET_HEADER_SIZE, size - ETHERNET_HEADER_SIZE);
+			IPv4_receive_packet(pb);
 			break;
 		case ETHERNET_ARP:
-			ARP_receive_packet(buffer + ETHERNET_HEADER_SIZE);
+			ARP_receive_packet(pb->data);
 			break;
 	}
 }
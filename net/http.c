@@ -8,30 +8,42 @@ void TLS_init(Window *win, uint ip, char *hostname, uint8 payload[]);
 
 void HTTP_TCP(Window *win, uint ip, char *hostname, uint8 payload[]) {
 	TCPConnection *connection = TCP_start_connection(ip, TCP_PORT_HTTP, payload, strlen(payload));
+	if (!connection) {
+		printf_win(win, "Too many TCP connections\n");
+		return;
+	}
 
 	// It's an HTTP 1.0 request - the server sends the response and closes the TCP connection
-	// We're just waiting until the connection is closed to look at the result
-	for (int i=0; i<2000000000; i++) {
-		if (connection->status == TCP_STATUS_FIN) {
-			if (connection->data_first) {
-				uint16 idx = 0, idx_start = 0;
-
-				while (idx < connection->data_first->size) {
-					idx_start = idx;
-					while (connection->data_first->content[idx] != 0x0A && idx < connection->data_first->size) idx++;
-
-					connection->data_first->content[idx] = 0;
-					printf_win(win, "%s\n", connection->data_first + idx_start);
-					idx++;
-				}
+	// The lines are printed as they come, read in place in the receive buffer
+	TCPCursor cursor;
+	char line[128];
+	uint line_size = 0, received = 0;
+
+	TCP_cursor_init(&cursor, connection);
+	while (TCP_cursor_wait(&cursor, 1)) {
+		uint8 *content;
+		uint size = TCP_cursor_next(&cursor, &content);
+
+		for (uint idx = 0; idx < size; idx++) {
+			if (content[idx] != 0x0A) line[line_size++] = content[idx];
+			if (content[idx] == 0x0A || line_size == sizeof(line) - 1) {
+				line[line_size] = 0;
+				printf_win(win, content[idx] == 0x0A ? "%s\n" : "%s", line);
+				line_size = 0;
 			}
-			else
-				printf_win(win, "No data");
-			return;
 		}
+
+		received += size;
+		TCP_cursor_release(&cursor);
 	}
 
-	TCP_cleanup_connection();
+	line[line_size] = 0;
+	if (line_size) printf_win(win, "%s\n", line);
+
+	if (connection->status == TCP_STATUS_CLOSED) printf_win(win, "Connection reset\n");
+	else if (!received) printf_win(win, "No data");
+
+	TCP_close_connection(connection);
 }
 
 void _HTTP_get(Window *win, char *hostname, uint8 secure) {
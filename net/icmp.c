@@ -2,6 +2,7 @@
 #include "ipv4.h"
 #include "icmp.h"
 #include "debug.h"
+#include "checksum.h"
 
 #define ICMP_HEADER_SIZE 		16
 
@@ -24,21 +25,6 @@ uint8 ping_data[48] = {
 	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37
 };
 
-uint16 ICMP_checksum(uint8* buffer, uint16 size) {
-	uint sum = 0;
-	uint16 *body = (uint16*)((uint8*)buffer);
-
-	for (int i=0; i<size/2; i++) {
-		sum += switch_endian16(*body++);
-	}
-
-	while (sum >> 16) {
-		sum = (sum & 0xFFFF) + (sum >> 16);
-	}	
-
-	return ~switch_endian16((uint16)sum);
-}
-
 typedef struct {
 	uint16 txn_id;
 	uint8 status;
@@ -61,13 +47,11 @@ uint8 ICMP_check_response(uint ps_id) {
 }
 
 void ICMP_send_packet(uint ipv4, uint ps_id) {
-//	printf_win(win, "MAC address: %X:%X:%X:%X:%X:%X\n", E1000_adapter.MAC[0], E1000_adapter.MAC[1], E1000_adapter.MAC[2], E1000_adapter.MAC[3], E1000_adapter.MAC[4], E1000_adapter.MAC[5]);
-	uint16 offset;
-
-	uint8* buffer = IPv4_create_packet(IPV4_PROTOCOL_ICMP, ipv4, 64, &offset);
+	PacketBuffer *pb = packet_alloc(PACKET_HEADROOM);
+	if (!pb) return;
 
 	// Append the ICMP header
-	ICMPHeader *header = (ICMPHeader*)(buffer + offset);
+	ICMPHeader *header = (ICMPHeader*)packet_put_zero(pb, 64);
 
 	header->type = ICMP_TYPE_ECHO_REQUEST;
 	header->code = 0;
@@ -83,15 +67,14 @@ void ICMP_send_packet(uint ipv4, uint ps_id) {
 	header->timestamp[6] = 0x1C;
 	header->timestamp[7] = 0xD6;
 
-	strncpy((char*)&header->data, ping_data, 48);
-	header->checksum = ICMP_checksum((uint8*)header, 64);
+	memcpy(&header->data, ping_data, 48);
+	header->checksum = inet_csum(header, 64);
 
-	IPv4_send_packet(buffer, 64 + offset, offset);
+	IPv4_send_packet(pb, IPV4_PROTOCOL_ICMP, ipv4);
 }
 
-void ICMP_receive_packet(uint ipv4, uint8* buffer_ping, uint16 size) {
-
-	ICMPHeader *header_ping = (ICMPHeader*)buffer_ping;
+void ICMP_receive_packet(uint ipv4, PacketBuffer *pb) {
+	ICMPHeader *header_ping = (ICMPHeader*)pb->data;
 	if (is_debug()) printf("[ICMP]\n");
 	//printf("Pong from %x, code=%d\n", ipv4, header_ping->type);
 
@@ -105,30 +88,16 @@ void ICMP_receive_packet(uint ipv4, uint8* buffer_ping, uint16 size) {
 		return;
 	}
 
+	// The reply is the request with another type: we send the buffer we
+	// received back, the headers below go where the received ones were
 	if (header_ping->type == ICMP_TYPE_ECHO_REQUEST) {
-		uint16 offset, ping_msg_size = size - ICMP_HEADER_SIZE;
-
-		uint8* buffer_pong = IPv4_create_packet(IPV4_PROTOCOL_ICMP, ipv4, size, &offset);
-
-		// Append the ICMP header
-		ICMPHeader *header_pong = (ICMPHeader*)(buffer_pong + offset);
-
-		header_pong->type = ICMP_TYPE_ECHO_REPLY;
-		header_pong->code = 0;
-		header_pong->checksum = 0;
-		header_pong->id = header_ping->id;
-		header_pong->seq = header_ping->seq;
-		for (int i=0; i<8; i++)
-			header_pong->timestamp[i] = header_ping->timestamp[i];
-
-		strncpy((char*)&header_pong->data, buffer_ping + ICMP_HEADER_SIZE, ping_msg_size);
-
-		header_pong->checksum = ICMP_checksum((uint8*)header_pong, size);
-
-	//	dump_mem(buffer_pong, size, 14);
-	//	for (;;);
+		// Only the first word changes, so does the checksum (RFC 1624)
+		uint16 old_word = *(uint16*)header_ping;
+		header_ping->type = ICMP_TYPE_ECHO_REPLY;
+		header_ping->checksum = inet_csum_update16(header_ping->checksum, old_word, *(uint16*)header_ping);
 
-		IPv4_send_packet(buffer_pong, size + offset, offset);
+		packet_get(pb);
+		IPv4_send_packet(pb, IPV4_PROTOCOL_ICMP, ipv4);
 		return;
 	}
 }
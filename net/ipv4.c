@@ -6,30 +6,20 @@
 #include "udp.h"
 #include "icmp.h"
 #include "debug.h"
-
-uint16 IPv4_checksum(IPv4Header *header) {
-	uint sum = 0;
-	uint16 *elt = (uint16*)header;
-	for (int i=0; i<IPV4_HEADER_SIZE/2; i++) {
-		sum += switch_endian16(*elt++);
-	}
-
-	while (sum >> 16) {
-		sum = (sum & 0xFFFF) + (sum >> 16);
-	}
-
-	return ~switch_endian16((uint16)sum);
-}
+#include "checksum.h"
 
 uint16 id = 0x2424;
 
-uint8 *IPv4_create_packet(uint8 protocol, uint ipv4, uint16 size, uint16 *offset) {
-	// Get an Ethernet packet
-	size += IPV4_HEADER_SIZE;
-	uint8 *buffer = ethernet_create_packet(ETHERNET_IPV4, ipv4, size, offset);
+// Adds the IPv4 header in front of the packet and sends it
+void IPv4_send_packet(PacketBuffer *pb, uint8 protocol, uint ipv4) {
+	uint16 size = packet_length(pb) + IPV4_HEADER_SIZE;
+
+	IPv4Header *header = (IPv4Header*)packet_push(pb, IPV4_HEADER_SIZE);
+	if (!header) {
+		packet_free(pb);
+		return;
+	}
 
-	// Append the IPv4 header
-	IPv4Header *header = (IPv4Header*)(buffer + *offset);
 	header->header = 0x45;
 	header->diff_svc_fld = 0x00;
 	header->length = switch_endian16(size);
@@ -40,29 +30,71 @@ uint8 *IPv4_create_packet(uint8 protocol, uint ipv4, uint16 size, uint16 *offset
 	header->protocol = protocol;
 	header->ip_src = network_get_IPv4();
 	header->ip_dst = ipv4;
-	header->checksum = IPv4_checksum(header);
+	header->checksum = 0;
+	if ((network_get_checksum_offload() & NET_CSUM_TX) || pb->segment_size) pb->checksum |= PACKET_CSUM_IP;
+	else header->checksum = inet_csum(header, IPV4_HEADER_SIZE);
+
+	ethernet_send_packet(pb, ETHERNET_IPV4, ipv4);
+}
+
+// Checksum errors found in software, see IPv4_receive_packet()
+uint IPv4_bad_checksums = 0;
+
+// The TCP and UDP checksums cover the segment and the pseudo header (a UDP
+// checksum of 0 means the sender hasn't computed one), ICMP only the message
+static int IPv4_check_L4(IPv4Header *header, PacketBuffer *pb) {
+	switch(header->protocol) {
+		case IPV4_PROTOCOL_TCP:
+			return TCP_checksum(pb, header->ip_src, header->ip_dst) == 0;
+		case IPV4_PROTOCOL_UDP:
+			if (packet_data_length(pb) < 8) return 0;
+			return ((uint16*)pb->data)[3] == 0 || UDP_checksum(pb, header->ip_src, header->ip_dst) == 0;
+		case IPV4_PROTOCOL_ICMP:
+			return inet_csum(pb->data, packet_data_length(pb)) == 0;
+	}
 
-	*offset += IPV4_HEADER_SIZE;
-	return buffer;
+	return 1;
 }
 
-void IPv4_send_packet(uint8 *buffer, uint16 size, uint16 message_offset) {
-	ethernet_send_packet(buffer, size);
+uint IPv4_get_bad_checksums() {
+	return IPv4_bad_checksums;
 }
 
-void IPv4_receive_packet(uint8 *buffer, uint16 size) {
-	IPv4Header *header = (IPv4Header*)buffer;
+void IPv4_receive_packet(PacketBuffer *pb) {
+	IPv4Header *header = (IPv4Header*)pb->data;
 	uint8* ip = (uint8*)&header->ip_src;
 	if (is_debug()) printf("=> [IP %d.%d.%d.%d]", ip[0], ip[1], ip[2], ip[3]);
 
+	uint16 header_size = (header->header & 0xF) * 4;
+	if (header_size < IPV4_HEADER_SIZE || packet_data_length(pb) < header_size) return;
+
+	// What the NIC hasn't verified, we do
+	if (!(pb->checksum & PACKET_CSUM_IP_OK) && inet_csum(header, header_size) != 0) {
+		IPv4_bad_checksums++;
+		return;
+	}
+
+	// The frames shorter than 60 bytes are padded, the header has the real
+	// size. A total length which doesn't even cover the header is dropped
+	uint16 total_length = switch_endian16(header->length);
+	if (total_length < header_size) return;
+
+	packet_trim(pb, total_length);
+	if (!packet_pull(pb, header_size)) return;
+
+	if (!(pb->checksum & PACKET_CSUM_L4_OK) && !IPv4_check_L4(header, pb)) {
+		IPv4_bad_checksums++;
+		return;
+	}
+
 	switch(header->protocol) {
 		case IPV4_PROTOCOL_UDP:
-			UDP_receive_packet(buffer + IPV4_HEADER_SIZE);
+			UDP_receive_packet(pb);
 			break;
 		case IPV4_PROTOCOL_TCP:
-			TCP_receive_packet(header->ip_src, buffer + IPV4_HEADER_SIZE, size - IPV4_HEADER_SIZE);
+			TCP_receive_packet(header->ip_src, header->ip_dst, pb);
 			break;
 		case IPV4_PROTOCOL_ICMP:
-			ICMP_receive_packet(header->ip_src, buffer + IPV4_HEADER_SIZE, switch_endian16(header->length) - IPV4_HEADER_SIZE);
+			ICMP_receive_packet(header->ip_src, pb);
 	}
 }
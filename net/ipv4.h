@@ -2,6 +2,7 @@
 #define __IPV4_H
 
 #include "libc.h"
+#include "packet.h"
 
 #define IPV4_HEADER_SIZE	20
 #define IPV4_PROTOCOL_ICMP	0x01
@@ -22,8 +23,8 @@ typedef struct __attribute__((packed)) {
 	uint ip_dst;
 } IPv4Header;
 
-uint8 *IPv4_create_packet(uint8 protocol, uint ipv4, uint16 size, uint16 *offset);
-void IPv4_send_packet(uint8 *buffer, uint16 size, uint16 message_offset);
-void IPv4_receive_packet(uint8 *buffer, uint16 size);
+void IPv4_send_packet(PacketBuffer *pb, uint8 protocol, uint ipv4);
+void IPv4_receive_packet(PacketBuffer *pb);
+uint IPv4_get_bad_checksums();
 
 #endif
@@ -3,10 +3,7 @@
 #include "network.h"
 #include "dhcp.h"
 #include "arp.h"
-
-#define NET_UNINITIALIZED	0
-#define NET_MAC_ADDRESS		1
-#define NET_IPV4_ADDRESS	2
+#include "vdso.h"
 
 Network network;
 
@@ -17,6 +14,9 @@ void init_network() {
 
 	uint8 *MAC = E1000_get_MAC();
 	for (int i=0; i<6; i++) network.MAC[i] = MAC[i];
+	network.status = NET_MAC_ADDRESS;
+	vdso_update_network();
+	network_set_checksum_offload(NET_CSUM_TX | NET_CSUM_RX | NET_TSO);
 
 	DHCP_send_packet();
 }
@@ -24,6 +24,7 @@ void init_network() {
 void network_set_IPv4(uint IP) {
 	network.IPv4 = IP;
 	network.status = NET_IPV4_ADDRESS;
+	vdso_update_network();
 }
 
 uint network_get_IPv4() {
@@ -45,3 +46,26 @@ uint8 *network_get_router_MAC() {
 Network *network_get_info() {
 	return &network;
 }
+
+// Who computes the checksums and cuts the TCP segments: the NIC, or the
+// stack when the flag is off.
+// The stack verifies in software what the NIC hasn't
+void network_set_checksum_offload(uint8 offload) {
+	if (!(offload & NET_CSUM_TX)) offload &= ~NET_TSO;
+
+	network.checksum_offload = offload;
+	E1000_set_RX_checksum(offload & NET_CSUM_RX);
+}
+
+uint8 network_get_checksum_offload() {
+	return network.checksum_offload;
+}
+
+// The largest TCP payload of a TSO packet: one descriptor per buffer,
+// which must all fit in the TX ring. The headers are in the first buffer
+uint network_get_tso_max_size() {
+	uint nb_buffers = E1000_tx_max_buffers();
+	if (!nb_buffers) return 0;
+
+	return nb_buffers * PACKET_BUFFER_SIZE - PACKET_HEADROOM;
+}
@@ -3,6 +3,15 @@
 
 #include "libc.h"
 
+#define NET_UNINITIALIZED	0
+#define NET_MAC_ADDRESS		1
+#define NET_IPV4_ADDRESS	2
+
+// The checksums the NIC computes (otherwise the stack does)
+#define NET_CSUM_TX			1
+#define NET_CSUM_RX			2
+#define NET_TSO				4		// TCP segmentation, needs NET_CSUM_TX
+
 typedef struct {
 	unsigned char MAC[6];
 	unsigned char router_MAC[6];
@@ -11,6 +20,7 @@ typedef struct {
 	uint subnet_mask;
 	uint dns;
 	uint8 status;
+	uint8 checksum_offload;		// NET_CSUM_*
 } Network;
 
 void init_network();
@@ -20,5 +30,8 @@ uint network_get_IPv4();
 uint network_get_DNS();
 void network_set_IPv4(uint IP);
 Network *network_get_info();
+void network_set_checksum_offload(uint8 offload);
+uint8 network_get_checksum_offload();
+uint network_get_tso_max_size();
 
 #endif
@@ -0,0 +1,166 @@
+#include "libc.h"
+#include "kheap.h"
+#include "spinlock.h"
+#include "packet.h"
+#include "checksum.h"
+
+// The pool grows by PACKET_POOL_GROW buffers when it is empty, up to
+// PACKET_POOL_MAX. The buffers are never given back to the heap: the
+// network always needs about the same number of them
+#define PACKET_POOL_GROW		16
+#define PACKET_POOL_MAX			2048
+
+static PacketBuffer *packet_free_list = 0;
+static PacketPoolStats packet_stats;
+
+// Taken from the network interrupt as well as from the processes
+static Spinlock packet_lock = SPINLOCK_INIT;
+
+// Called with the pool lock held. The buffers are 2KB in pages from the
+// kernel heap, which are identity-mapped so the NIC can use them directly
+static void packet_pool_grow() {
+	if (packet_stats.nb_buffers + PACKET_POOL_GROW > PACKET_POOL_MAX) return;
+
+	uint8 *memory = (uint8*)kmalloc_pages(PACKET_POOL_GROW * PACKET_BUFFER_SIZE / 0x1000, "Packet buffers");
+	PacketBuffer *buffers = (PacketBuffer*)kmalloc(PACKET_POOL_GROW * sizeof(PacketBuffer));
+	if (!memory || !buffers) return;
+
+	for (uint i=0; i<PACKET_POOL_GROW; i++) {
+		buffers[i].head = memory + i * PACKET_BUFFER_SIZE;
+		buffers[i].end = buffers[i].head + PACKET_BUFFER_SIZE;
+		buffers[i].next = packet_free_list;
+		packet_free_list = &buffers[i];
+	}
+
+	packet_stats.nb_buffers += PACKET_POOL_GROW;
+	packet_stats.nb_free += PACKET_POOL_GROW;
+}
+
+// Returns an empty buffer with room for headroom bytes of headers, or 0
+PacketBuffer *packet_alloc(uint headroom) {
+	uint eflags = spinlock_lock_irqsave(&packet_lock);
+
+	if (!packet_free_list) packet_pool_grow();
+
+	PacketBuffer *pb = packet_free_list;
+	if (pb) {
+		packet_free_list = pb->next;
+		packet_stats.nb_free--;
+	}
+	else packet_stats.nb_failed++;
+
+	spinlock_unlock_irqrestore(&packet_lock, eflags);
+	if (!pb) return 0;
+
+	pb->data = pb->tail = pb->head + headroom;
+	pb->refcount = 1;
+	pb->checksum = 0;
+	pb->segment_size = 0;
+	pb->next = 0;
+	pb->next_packet = 0;
+
+	return pb;
+}
+
+void packet_get(PacketBuffer *pb) {
+	__sync_fetch_and_add(&pb->refcount, 1);
+}
+
+// Drops a reference. The last one gives the buffer, and the rest of the
+// packet chained to it, back to the pool
+void packet_free(PacketBuffer *pb) {
+	while (pb && __sync_sub_and_fetch(&pb->refcount, 1) == 0) {
+		PacketBuffer *next = pb->next;
+
+		uint eflags = spinlock_lock_irqsave(&packet_lock);
+		pb->next = packet_free_list;
+		packet_free_list = pb;
+		packet_stats.nb_free++;
+		spinlock_unlock_irqrestore(&packet_lock, eflags);
+
+		pb = next;
+	}
+}
+
+// Adds length bytes in front of the packet, returns them
+uint8 *packet_push(PacketBuffer *pb, uint length) {
+	if (length > packet_headroom(pb)) return 0;
+
+	pb->data -= length;
+	return pb->data;
+}
+
+// Removes length bytes from the front of the packet, returns the new start
+uint8 *packet_pull(PacketBuffer *pb, uint length) {
+	if (length > packet_data_length(pb)) return 0;
+
+	pb->data += length;
+	return pb->data;
+}
+
+// Adds length bytes at the end of the packet, returns them
+uint8 *packet_put(PacketBuffer *pb, uint length) {
+	if (length > packet_tailroom(pb)) return 0;
+
+	uint8 *tail = pb->tail;
+	pb->tail += length;
+	return tail;
+}
+
+uint8 *packet_put_zero(PacketBuffer *pb, uint length) {
+	uint8 *tail = packet_put(pb, length);
+	if (tail) memset(tail, 0, length);
+	return tail;
+}
+
+// Cuts the packet (this buffer only) to length bytes, e.g. to remove the
+// padding of a short Ethernet frame
+void packet_trim(PacketBuffer *pb, uint length) {
+	if (length < packet_data_length(pb)) pb->tail = pb->data + length;
+}
+
+// Copies data at the end of the packet, chaining new buffers when the last
+// one is full. Returns 0 if the pool is empty
+int packet_append(PacketBuffer *pb, uint8 *data, uint length) {
+	while (pb->next) pb = pb->next;
+
+	while (length > 0) {
+		if (!packet_tailroom(pb)) {
+			pb->next = packet_alloc(0);
+			if (!pb->next) return 0;
+			pb = pb->next;
+		}
+
+		uint size = umin(length, packet_tailroom(pb));
+		memcpy(packet_put(pb, size), data, size);
+		data += size;
+		length -= size;
+	}
+
+	return 1;
+}
+
+// Length of the whole packet, chained buffers included
+uint packet_length(PacketBuffer *pb) {
+	uint length = 0;
+
+	for (; pb; pb = pb->next) length += packet_data_length(pb);
+	return length;
+}
+
+// Adds the data of the packet, over all its buffers, to a partial checksum
+uint packet_csum(PacketBuffer *pb, uint sum) {
+	uint offset = 0;
+
+	for (; pb; pb = pb->next) {
+		uint length = packet_data_length(pb);
+		sum = inet_csum_block_add(sum, inet_csum_partial(pb->data, length, 0), offset);
+		offset += length;
+	}
+
+	return sum;
+}
+
+PacketPoolStats *packet_pool_stats() {
+	return &packet_stats;
+}
@@ -0,0 +1,83 @@
+#ifndef __PACKET_H
+#define __PACKET_H
+
+#include "libc.h"
+
+// A packet buffer holds a packet while it goes through the network stack,
+// so that no layer copies it. The buffers come from a pool and have a fixed
+// size, the packet being somewhere inside:
+//
+//   head          data                  tail            end
+//   | headroom    | packet              | tailroom      |
+//
+// To send, a protocol writes its payload with packet_put() and each layer
+// below adds its header in the headroom with packet_push(). On receive, the
+// NIC writes the frame at data and each layer removes its header with
+// packet_pull() before handing the buffer up.
+//
+// A packet larger than a buffer continues in the buffers chained with next.
+// The buffers are reference counted: whoever keeps one after the call that
+// gave it (e.g. ICMP sending it back as a reply) takes a reference with
+// packet_get().
+//
+// The checksum flags tell which checksums the NIC inserts when it sends the
+// packet (the layer leaves the checksum of the pseudo header in the field),
+// and which ones it has verified when it received it. With a segment size,
+// the NIC cuts the TCP payload in segments of that size (TSO).
+
+#define PACKET_BUFFER_SIZE		2048
+#define PACKET_HEADROOM			128		// Ethernet + IPv4 + TCP with options
+
+#define PACKET_CSUM_IP			1		// Send: the NIC computes the IPv4 header checksum
+#define PACKET_CSUM_TCP			2		// Send: the NIC computes the TCP checksum
+#define PACKET_CSUM_UDP			4		// Send: the NIC computes the UDP checksum
+#define PACKET_CSUM_IP_OK		8		// Received: the NIC has verified the IPv4 header
+#define PACKET_CSUM_L4_OK		16		// Received: the NIC has verified the TCP/UDP checksum
+
+typedef struct packet_buffer {
+	uint8 *head;
+	uint8 *data;
+	uint8 *tail;
+	uint8 *end;
+	volatile uint refcount;
+	uint8 checksum;						// PACKET_CSUM_*
+	uint16 segment_size;				// TSO: the MSS of the segments the NIC sends, 0 for none
+	struct packet_buffer *next;			// Rest of the packet (or next free buffer)
+	struct packet_buffer *next_packet;	// Next packet in a queue
+} PacketBuffer;
+
+typedef struct {
+	uint nb_buffers;
+	uint nb_free;
+	uint nb_failed;					// Allocations refused: the pool is full
+} PacketPoolStats;
+
+PacketBuffer *packet_alloc(uint headroom);
+void packet_get(PacketBuffer *pb);
+void packet_free(PacketBuffer *pb);
+
+uint8 *packet_push(PacketBuffer *pb, uint length);
+uint8 *packet_pull(PacketBuffer *pb, uint length);
+uint8 *packet_put(PacketBuffer *pb, uint length);
+uint8 *packet_put_zero(PacketBuffer *pb, uint length);
+void packet_trim(PacketBuffer *pb, uint length);
+int packet_append(PacketBuffer *pb, uint8 *data, uint length);
+
+uint packet_length(PacketBuffer *pb);
+uint packet_csum(PacketBuffer *pb, uint sum);
+PacketPoolStats *packet_pool_stats();
+
+static inline uint packet_headroom(PacketBuffer *pb) {
+	return pb->data - pb->head;
+}
+
+static inline uint packet_tailroom(PacketBuffer *pb) {
+	return pb->end - pb->tail;
+}
+
+// Length of this buffer only, without the chained ones
+static inline uint packet_data_length(PacketBuffer *pb) {
+	return pb->tail - pb->data;
+}
+
+#endif
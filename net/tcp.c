@@ -3,9 +3,67 @@
 #include "tcp.h"
 #include "kheap.h"
 #include "debug.h"
+#include "network.h"
+#include "packet.h"
+#include "checksum.h"
+#include "clock.h"
+#include "process.h"
+#include "mutex.h"
+
+extern uint get_ticks();
+extern uint get_timer_hz();
 
 #define TCP_HEADER_SIZE		20
 
+// The payload of a segment on Ethernet (1500 bytes, without the IPv4 and
+// TCP headers), and of the packets we give the NIC to cut (TSO): as much
+// as the IPv4 length can say
+#define TCP_MSS				1460
+#define TCP_TSO_MAX_SIZE	(0xFFFF - IPV4_HEADER_SIZE - TCP_HEADER_SIZE)
+
+// What the peer can send if it doesn't give its MSS (RFC 1122)
+#define TCP_DEFAULT_MSS		536
+
+// Options (RFC 7323 and RFC 2018). The header has room for 40 bytes of them
+#define TCP_OPTION_END				0
+#define TCP_OPTION_NOP				1
+#define TCP_OPTION_MSS				2
+#define TCP_OPTION_WINDOW_SCALE		3
+#define TCP_OPTION_SACK_PERMITTED	4
+#define TCP_OPTION_SACK				5
+#define TCP_OPTION_TIMESTAMP		8
+#define TCP_OPTIONS_MAX_SIZE		40
+#define TCP_TIMESTAMP_SIZE			12		// With the 2 NOPs which align it
+#define TCP_MAX_SACK_BLOCKS			4
+
+// The window we advertise is shifted by it: the receive buffer, shifted,
+// fits in the 16 bits of the header
+#define TCP_WINDOW_SHIFT	2
+
+// Retransmission timer, in microseconds. The minimum is Linux's: the 1s of
+// RFC 6298 is long on a LAN. The timers run every time the timer process
+// is scheduled
+#define TCP_RTO_INITIAL			1000000
+#define TCP_RTO_MIN				200000
+#define TCP_RTO_MAX				60000000
+#define TCP_TIMER_GRANULARITY	10000
+#define TCP_MAX_RETRIES			12
+
+#define TCP_DUPACK_THRESHOLD	3
+
+// Delayed acks (RFC 1122, section 4.2.3.2): at least every second full
+// segment, and within TCP_DELAYED_ACK microseconds. The first segments of
+// a connection, and those after a hole, are acked at once so that the
+// slow start of the peer isn't slowed down
+#define TCP_DELAYED_ACK			40000
+#define TCP_QUICKACK_SEGMENTS	16
+
+// Sequence numbers are compared modulo 2^32
+#define SEQ_LT(a, b)		((int)((a) - (b)) < 0)
+#define SEQ_LEQ(a, b)		((int)((a) - (b)) <= 0)
+#define SEQ_GT(a, b)		((int)((a) - (b)) > 0)
+#define SEQ_GEQ(a, b)		((int)((a) - (b)) >= 0)
+
 #define TCP_FLAGS_FIN		1
 #define TCP_FLAGS_SYN		2
 #define TCP_FLAGS_RESET		4
@@ -15,8 +73,6 @@
 #define TCP_FLAGS_ECHO		64
 #define TCP_FLAGS_CWR		128
 
-uint8 TCP_options[12] = { 0x01, 0x01, 0x08, 0x0A, 0x37, 0x8D, 0xE5, 0xDB, 0xA8, 0xF4, 0x91, 0xC6 };
-
 typedef struct __attribute__((packed)) {
 	uint16 sport;
 	uint16 dport;
@@ -29,195 +85,1192 @@ typedef struct __attribute__((packed)) {
 	uint16 urgent;
 } TCPHeader;
 
-TCPConnection connection;
+// The options of a received segment
+typedef struct {
+	uint16 mss;				// 0 if it didn't give one
+	uint8 wscale;
+	uint8 has_wscale;
+	uint8 sack_ok;
+	uint8 has_ts;
+	uint ts_val;
+	uint ts_ecr;
+	TCPInterval sacks[TCP_MAX_SACK_BLOCKS];
+	uint8 nb_sacks;
+} TCPOptions;
 
-uint16 TCP_checksum(TCPHeader *header, uint16 tcp_packet_size) {
-	uint sum = 0;
-	uint16 *body = (uint16*)((uint8*)header);
-//	uint16 body_size = switch_endian16(header->header_size + payload_size);
+// x86 loads words at any address, the options don't align them
+typedef uint16 __attribute__((may_alias, aligned(1))) unaligned_uint16;
+typedef uint __attribute__((may_alias, aligned(1))) unaligned_uint;
 
-	for (int i=0; i<tcp_packet_size/2; i++) {
-		sum += switch_endian16(*body++);
+// The connections, and the hash table that finds them from a received
+// segment. The table lock is taken before the lock of a connection
+static TCPConnection TCP_connections[TCP_MAX_CONNECTIONS];
+static TCPConnection *TCP_hash[TCP_HASH_SIZE];
+static Spinlock TCP_table_lock = SPINLOCK_INIT;
+static uint16 TCP_next_port;
+
+// Held by the processes which open or close a connection: they can wait
+// for the network, with the spinlocks released, and the slot of a closed
+// connection isn't reused until its last segment is out
+static Mutex TCP_setup_mutex = MUTEX_INIT;
+
+static uint TCP_hash_key(uint local_ipv4, uint16 local_port, uint remote_ipv4, uint16 remote_port) {
+	uint key = (local_ipv4 ^ remote_ipv4) * 2654435761u;
+	key ^= ((uint)remote_port << 16) | local_port;
+	key *= 2654435761u;
+	return key >> 16 & (TCP_HASH_SIZE - 1);
+}
+
+// Called with the table lock held
+static TCPConnection *TCP_lookup(uint local_ipv4, uint16 local_port, uint remote_ipv4, uint16 remote_port) {
+	TCPConnection *c = TCP_hash[TCP_hash_key(local_ipv4, local_port, remote_ipv4, remote_port)];
+
+	for (; c; c = c->hash_next) {
+		if (c->sport == local_port && c->dport == remote_port && c->ipv4 == remote_ipv4 && c->local_ipv4 == local_ipv4)
+			return c;
 	}
+	return 0;
+}
+
+// The next ephemeral port which isn't used to talk to that host and port.
+// Called with the table lock held, returns 0 when they all are
+static uint16 TCP_ephemeral_port(uint local_ipv4, uint remote_ipv4, uint16 remote_port) {
+	uint nb_ports = TCP_EPHEMERAL_PORT_LAST - TCP_EPHEMERAL_PORT_FIRST + 1;
+
+	// Start somewhere else after every boot
+	if (!TCP_next_port) TCP_next_port = TCP_EPHEMERAL_PORT_FIRST + rand() % nb_ports;
+
+	for (uint i = 0; i < nb_ports; i++) {
+		uint16 port = TCP_next_port;
+		TCP_next_port = port == TCP_EPHEMERAL_PORT_LAST ? TCP_EPHEMERAL_PORT_FIRST : port + 1;
 
-	if (tcp_packet_size % 2 == 1) {
-		uint16 tmp = (*body) & 0xFF;
-		sum += switch_endian16(tmp);
+		if (!TCP_lookup(local_ipv4, port, remote_ipv4, remote_port)) return port;
 	}
+	return 0;
+}
+
+// The checksum covers a pseudo header with the IP addresses, then the
+// segment, which can be spread over several chained buffers
+uint16 TCP_checksum(PacketBuffer *pb, uint ip_src, uint ip_dst) {
+	uint sum = inet_csum_pseudo(ip_src, ip_dst, IPV4_PROTOCOL_TCP, packet_length(pb), 0);
+	return inet_csum_finish(packet_csum(pb, sum));
+}
+
+// Copies data to a ring buffer, at the position of its sequence number
+static void TCP_buffer_write(uint8 *buffer, uint buffer_size, uint sequence_nb, uint8 *data, uint size) {
+	uint index = sequence_nb & (buffer_size - 1);
+	uint first = umin(size, buffer_size - index);
+
+	memcpy(buffer + index, data, first);
+	if (size > first) memcpy(buffer, data + first, size - first);
+}
+
+// Copies data from the send buffer to a packet buffer
+static int TCP_buffer_append(PacketBuffer *pb, uint8 *buffer, uint sequence_nb, uint size) {
+	uint index = sequence_nb & (TCP_SEND_BUFFER_SIZE - 1);
+	uint first = umin(size, TCP_SEND_BUFFER_SIZE - index);
 
-	// Because the TCP checksum is using the source and dest
-	// IP address for the checksum, we're looking at the IP header
-	IPv4Header *header_ip = (IPv4Header*)((uint8*)header - IPV4_HEADER_SIZE);
+	if (!packet_append(pb, buffer + index, first)) return 0;
+	return size == first || packet_append(pb, buffer, size - first);
+}
 
-	sum += switch_endian16(header_ip->ip_src & 0xFFFF);
-	sum += switch_endian16(header_ip->ip_src >> 16);
-	sum += switch_endian16(header_ip->ip_dst & 0xFFFF);
-	sum += switch_endian16(header_ip->ip_dst >> 16);
-	sum += tcp_packet_size;
-	sum += IPV4_PROTOCOL_TCP;
+// Adds an interval to a sorted list, merged with those it touches. When
+// the list is full, the furthest interval is forgotten
+static void TCP_interval_add(TCPInterval *list, uint8 *nb, uint max, uint start, uint end) {
+	uint n = *nb, i = 0, j;
 
-	while (sum >> 16) {
-		sum = (sum & 0xFFFF) + (sum >> 16);
+	while (i < n && SEQ_LT(list[i].end, start)) i++;
+	for (j = i; j < n && SEQ_GEQ(end, list[j].start); j++) {
+		if (SEQ_LT(list[j].start, start)) start = list[j].start;
+		if (SEQ_GT(list[j].end, end)) end = list[j].end;
 	}
 
-	return ~switch_endian16((uint16)sum);
+	// The intervals i to j-1 are replaced by the merged one
+	if (i == j) {
+		if (n == max) {
+			if (i == n) return;
+			n--;
+		}
+		for (uint k = n; k > i; k--) list[k] = list[k-1];
+		n++;
+	}
+	else {
+		for (uint k = j; k < n; k++) list[k - (j - i - 1)] = list[k];
+		n -= j - i - 1;
+	}
+
+	list[i].start = start;
+	list[i].end = end;
+	*nb = n;
 }
 
-uint8 *TCP_send_packet(uint ipv4, uint16 sport, uint16 dport,
-					   uint sequence_nb, uint ack_nb,
-					   uint8 flags,
-					   uint8 *options, uint16 options_length,
-					   uint8* payload, uint16 payload_size) {
+// Removes what is before sequence_nb from a sorted list
+static void TCP_interval_trim(TCPInterval *list, uint8 *nb, uint sequence_nb) {
+	uint n = 0;
 
-	// Remember the sequence and ack numbers
-	connection.sequence_nb = sequence_nb;
-	connection.ack_nb = ack_nb;
+	while (n < *nb && SEQ_LEQ(list[n].end, sequence_nb)) n++;
+	for (uint k = n; k < *nb; k++) list[k - n] = list[k];
+	*nb -= n;
+
+	if (*nb && SEQ_LT(list[0].start, sequence_nb)) list[0].start = sequence_nb;
+}
 
-	// Get an IPv4 packet
-	uint16 size = payload_size + TCP_HEADER_SIZE + options_length;
-	uint16 offset;
-	uint8 *buffer = IPv4_create_packet(IPV4_PROTOCOL_TCP, ipv4, size, &offset);
+// The clock of the timestamps, in milliseconds (RFC 7323, section 5.4)
+static uint TCP_timestamp() {
+	return (uint)udiv64(clock_ns(), 1000000, 0);
+}
+
+// Writes the options of a segment, returns their size (a multiple of 4)
+static uint TCP_write_options(TCPConnection *c, uint8 flags, uint payload_size, uint8 *options) {
+	uint8 *p = options;
+
+	// The SYN offers them all, the peer answers with those it knows
+	if (flags & TCP_FLAGS_SYN) {
+		p[0] = TCP_OPTION_MSS;
+		p[1] = 4;
+		*(unaligned_uint16*)(p + 2) = switch_endian16(TCP_MSS);
+		p[4] = TCP_OPTION_SACK_PERMITTED;
+		p[5] = 2;
+		p[6] = TCP_OPTION_TIMESTAMP;
+		p[7] = 10;
+		*(unaligned_uint*)(p + 8) = switch_endian32(TCP_timestamp());
+		*(unaligned_uint*)(p + 12) = 0;
+		p[16] = TCP_OPTION_NOP;
+		p[17] = TCP_OPTION_WINDOW_SCALE;
+		p[18] = 3;
+		p[19] = TCP_WINDOW_SHIFT;
+		return 20;
+	}
 
-	// Append the TCP header
-	TCPHeader *header = (TCPHeader*)(buffer + offset);
-	header->sport = switch_endian16(sport);
-	header->dport = switch_endian16(dport);
+	// Once negotiated, every segment has a timestamp
+	if (c->ts_ok) {
+		p[0] = p[1] = TCP_OPTION_NOP;
+		p[2] = TCP_OPTION_TIMESTAMP;
+		p[3] = 10;
+		*(unaligned_uint*)(p + 4) = switch_endian32(TCP_timestamp());
+		*(unaligned_uint*)(p + 8) = switch_endian32(c->ts_recent);
+		p += TCP_TIMESTAMP_SIZE;
+	}
+
+	// An ack without data gives the blocks received after a hole. The one
+	// received last comes first, then the others in order (RFC 2018,
+	// section 4)
+	if (c->sack_ok && c->nb_out_of_order && !payload_size && (flags & TCP_FLAGS_ACK)) {
+		TCPInterval *list = c->out_of_order;
+		uint max = c->ts_ok ? TCP_MAX_SACK_BLOCKS - 1 : TCP_MAX_SACK_BLOCKS, first = 0, n = 0;
+
+		for (uint i = 0; i < c->nb_out_of_order; i++) {
+			if (SEQ_LEQ(list[i].start, c->sack_recent) && SEQ_LT(c->sack_recent, list[i].end)) first = i;
+		}
+
+		for (uint i = 0; i < c->nb_out_of_order && n < max; i++, n++) {
+			TCPInterval *block = &list[i == 0 ? first : (i <= first ? i - 1 : i)];
+			*(unaligned_uint*)(p + 4 + 8 * n) = switch_endian32(block->start);
+			*(unaligned_uint*)(p + 8 + 8 * n) = switch_endian32(block->end);
+		}
+
+		p[0] = p[1] = TCP_OPTION_NOP;
+		p[2] = TCP_OPTION_SACK;
+		p[3] = 2 + 8 * n;
+		p += 4 + 8 * n;
+	}
+
+	return p - options;
+}
+
+// The window we advertise: the room left in the receive buffer
+static uint TCP_receive_window(TCPConnection *c) {
+	return c->rcv_read + TCP_RECEIVE_BUFFER_SIZE - c->rcv_nxt;
+}
+
+// Sends a segment with the payload_size bytes of the send buffer which
+// start at sequence_nb. The payload is copied once, in the buffer that goes
+// to the NIC. If it doesn't fit in a segment, the NIC cuts it
+static void TCP_send_packet(TCPConnection *c, uint sequence_nb, uint8 flags, uint payload_size) {
+	uint8 options[TCP_OPTIONS_MAX_SIZE];
+
+	PacketBuffer *pb = packet_alloc(PACKET_HEADROOM);
+	if (!pb) return;
+
+	if (payload_size > 0 && !TCP_buffer_append(pb, c->send_buffer, sequence_nb, payload_size)) {
+		packet_free(pb);
+		return;
+	}
+
+	// The window is scaled once the SYN of the peer agreed to it, and what
+	// the shift cuts off isn't advertised
+	uint options_length = TCP_write_options(c, flags, payload_size, options);
+	uint window = umin(TCP_receive_window(c) >> c->rcv_wscale, 0xFFFF);
+
+	// Add the TCP header in front
+	TCPHeader *header = (TCPHeader*)packet_push(pb, TCP_HEADER_SIZE + options_length);
+	if (!header) {
+		packet_free(pb);
+		return;
+	}
+	header->sport = switch_endian16(c->sport);
+	header->dport = switch_endian16(c->dport);
 	header->sequence_nb = switch_endian32(sequence_nb);
-	header->ack_nb = switch_endian32(ack_nb);
+	header->ack_nb = (flags & TCP_FLAGS_ACK) ? switch_endian32(c->rcv_nxt) : 0;
 	header->header_size = ((TCP_HEADER_SIZE + options_length) / 4) << 4;
 	header->flags = flags;
-	header->win_size_value = 0xFFFF;
+	header->win_size_value = switch_endian16(window);
 	header->urgent = 0;
 	header->checksum = 0;
 
-	if (options_length > 0) memcpy(buffer + offset + TCP_HEADER_SIZE, options, options_length);
-	if (payload_size > 0) {
-		memcpy(buffer + offset + TCP_HEADER_SIZE + options_length, payload, payload_size);
-		connection.sequence_nb += payload_size;
+	if (options_length > 0) memcpy((uint8*)header + TCP_HEADER_SIZE, options, options_length);
+
+	// With offload, the NIC adds the segment to the pseudo header. With
+	// TSO, it adds the length of each segment too, and copies the options
+	// in each of them
+	if (payload_size > c->mss && (network_get_checksum_offload() & NET_TSO))
+		pb->segment_size = c->mss;
+
+	if (pb->segment_size) {
+		header->checksum = inet_csum_fold(inet_csum_pseudo(c->local_ipv4, c->ipv4, IPV4_PROTOCOL_TCP, 0, 0));
+		pb->checksum |= PACKET_CSUM_TCP;
+	}
+	else if (network_get_checksum_offload() & NET_CSUM_TX) {
+		header->checksum = inet_csum_fold(inet_csum_pseudo(c->local_ipv4, c->ipv4, IPV4_PROTOCOL_TCP, packet_length(pb), 0));
+		pb->checksum |= PACKET_CSUM_TCP;
+	}
+	else header->checksum = TCP_checksum(pb, c->local_ipv4, c->ipv4);
+
+	// Any segment acks what we have received
+	if (flags & TCP_FLAGS_ACK) {
+		c->rcv_acked = c->rcv_nxt;
+		c->ack_timer = 0;
+	}
+
+	c->rcv_adv = c->rcv_nxt + (window << c->rcv_wscale);
+
+	// Sent by TCP_transmit() once the lock is released
+	pb->next_packet = 0;
+	if (c->tx_queue) c->tx_queue_last->next_packet = pb;
+	else c->tx_queue = pb;
+	c->tx_queue_last = pb;
+}
+
+static void TCP_send_queue(PacketBuffer *pb, uint ipv4) {
+	while (pb) {
+		PacketBuffer *next = pb->next_packet;
+		pb->next_packet = 0;
+		IPv4_send_packet(pb, IPV4_PROTOCOL_TCP, ipv4);
+		pb = next;
+	}
+}
+
+// Sends the segments queued with the lock held. Called without any lock:
+// with the interrupts off, an ARP reply could never come
+static void TCP_transmit(TCPConnection *c) {
+	uint eflags = spinlock_lock_irqsave(&c->lock);
+	PacketBuffer *pb = c->tx_queue;
+	uint ipv4 = c->ipv4;
+	c->tx_queue = c->tx_queue_last = 0;
+	spinlock_unlock_irqrestore(&c->lock, eflags);
+
+	TCP_send_queue(pb, ipv4);
+}
+
+static void TCP_send_ack(TCPConnection *c) {
+	TCP_send_packet(c, c->snd_nxt, TCP_FLAGS_ACK, 0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Timers
+
+static Process *TCP_timer_process;
+
+static void TCP_set_timer(uint64 *timer, uint us) {
+	*timer = clock_ns() + (uint64)us * 1000;
+
+	// Wakes the timer process up if it waits for one
+	Process *ps = TCP_timer_process;
+	if (ps) __sync_fetch_and_and(&ps->flags, ~PROCESS_POLLING);
+}
+
+// RFC 6298, section 2
+static void TCP_update_rtt(TCPConnection *c, uint rtt) {
+	if (!c->srtt) {
+		c->srtt = rtt;
+		c->rttvar = rtt / 2;
 	}
-//		strncpy(buffer + offset + TCP_HEADER_SIZE + options_length, payload, payload_size);
+	else {
+		uint delta = c->srtt > rtt ? c->srtt - rtt : rtt - c->srtt;
+		c->rttvar = (3 * c->rttvar + delta) / 4;
+		c->srtt = (7 * c->srtt + rtt) / 8;
+	}
+
+	c->rto = c->srtt + umax(TCP_TIMER_GRANULARITY, 4 * c->rttvar);
+	c->rto = umin(umax(c->rto, TCP_RTO_MIN), TCP_RTO_MAX);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Output
 
-/*	uint8 options[12] = { 0x01, 0x01, 0x08, 0x0A, 0x37, 0x8D, 0xE5, 0xDB, 0xA8, 0xF4, 0x91, 0xC6 };
-	for (int i=0; i<12; i++) {
-		buffer[offset + TCP_HEADER_SIZE + i] = options[i];
+static uint TCP_flight_size(TCPConnection *c) {
+	return c->snd_nxt - c->snd_una;
+}
+
+// RFC 5681, section 3.1
+static uint TCP_initial_window(uint mss) {
+	return mss > 2190 ? 2 * mss : (mss > 1095 ? 3 * mss : 4 * mss);
+}
+
+static uint TCP_sacked_size(TCPConnection *c) {
+	uint size = 0;
+
+	for (uint i = 0; i < c->nb_sacked; i++) size += c->sacked[i].end - c->sacked[i].start;
+	return size;
+}
+
+// The data still in the network. During a SACK recovery (RFC 6675,
+// section 4), it isn't what the peer SACKed, nor the holes under its
+// highest SACK which weren't sent again: those are lost
+static uint TCP_pipe(TCPConnection *c) {
+	uint flight = TCP_flight_size(c), out = 0;
+	if (!c->in_recovery || !c->sack_ok) return flight;
+
+	uint sequence_nb = SEQ_GT(c->rexmit_nxt, c->snd_una) ? c->rexmit_nxt : c->snd_una;
+	for (uint i = 0; i < c->nb_sacked; i++) {
+		TCPInterval *block = &c->sacked[i];
+		out += block->end - block->start;
+		if (SEQ_GT(block->start, sequence_nb)) out += block->start - sequence_nb;
+		if (SEQ_GT(block->end, sequence_nb)) sequence_nb = block->end;
 	}
-*/
-	header->checksum = TCP_checksum(header, TCP_HEADER_SIZE + options_length + payload_size);
 
-	IPv4_send_packet(buffer, size + offset, offset);
+	return flight > out ? flight - out : 0;
+}
+
+// Retransmits the segment at snd_una, whatever the windows say. With a
+// window of 0, it is a probe of one byte
+static void TCP_retransmit(TCPConnection *c) {
+	uint size = c->snd_wnd ? umin(c->mss, c->snd_end - c->snd_una) : 1;
+
+	c->rtt_timing = 0;
+	TCP_send_packet(c, c->snd_una, TCP_FLAGS_ACK, size);
+	c->rexmit_nxt = c->snd_una + size;
+
+	if (SEQ_LT(c->snd_nxt, c->snd_una + size)) c->snd_nxt = c->snd_una + size;
+	if (SEQ_LT(c->snd_max, c->snd_nxt)) c->snd_max = c->snd_nxt;
 }
 
-void TCP_send(uint8 payload[], uint size) {
-	TCP_send_packet(connection.ipv4, connection.sport, connection.dport,
-					connection.sequence_nb, connection.ack_nb,
-					TCP_FLAGS_PUSH | TCP_FLAGS_ACK,
-					0, 0,
-					payload, size);
+// Sends the holes under the highest SACK again, the first one first,
+// while the data in the network stays under the congestion window (RFC
+// 6675, section 5). Returns the number of segments sent
+static uint TCP_sack_retransmit(TCPConnection *c) {
+	uint nb_sent = 0;
+
+	while (TCP_pipe(c) < c->cwnd) {
+		uint sequence_nb = SEQ_GT(c->rexmit_nxt, c->snd_una) ? c->rexmit_nxt : c->snd_una, i = 0;
+
+		// The next hole ends where the next block starts
+		for (; i < c->nb_sacked && SEQ_LEQ(c->sacked[i].start, sequence_nb); i++) {
+			if (SEQ_GT(c->sacked[i].end, sequence_nb)) sequence_nb = c->sacked[i].end;
+		}
+		if (i == c->nb_sacked) break;
+
+		uint size = umin(c->mss, c->sacked[i].start - sequence_nb);
+		c->rtt_timing = 0;
+		TCP_send_packet(c, sequence_nb, TCP_FLAGS_ACK, size);
+		c->rexmit_nxt = sequence_nb + size;
+		nb_sent++;
+	}
+
+	return nb_sent;
 }
 
-void TCP_cleanup_connection() {
-	TCPData *data = connection.data_first, *tmp;
-	while (data) {
-		if (data->content) kfree(data->content);
-		tmp = data;
-		data = data->next;
-		kfree(tmp);
+// Sends what the windows of the peer and of the congestion allow: during
+// a SACK recovery, the holes first. Called with the connection lock held,
+// returns the number of segments sent
+static uint TCP_output(TCPConnection *c) {
+	// The options of a data segment are in the IPv4 length too, and the
+	// buffers of a packet must fit in the TX ring of the NIC
+	uint options_size = c->ts_ok ? TCP_TIMESTAMP_SIZE : 0;
+	uint max_size = c->mss;
+	if (network_get_checksum_offload() & NET_TSO)
+		max_size = umax(umin(TCP_TSO_MAX_SIZE - options_size, network_get_tso_max_size()), c->mss);
+	uint nb_sent = 0;
+
+	if (c->status != TCP_STATUS_TRANSFER_PUSH && c->status != TCP_STATUS_FIN) return 0;
+	if (c->in_recovery && c->sack_ok) nb_sent = TCP_sack_retransmit(c);
+
+	while (c->snd_nxt != c->snd_end) {
+		uint flight = TCP_flight_size(c), pipe = TCP_pipe(c), queued = c->snd_end - c->snd_nxt;
+		if (flight >= c->snd_wnd || pipe >= c->cwnd) break;
+
+		// Against the silly window syndrome, a small segment only goes out
+		// when it is the last one, or when nothing else is in flight
+		uint size = umin(umin(queued, umin(c->snd_wnd - flight, c->cwnd - pipe)), max_size);
+		if (size < c->mss && size < queued && flight) break;
+
+		// Times a segment which isn't a retransmission, when the
+		// timestamps don't time them all
+		if (!c->ts_ok && !c->rtt_timing && SEQ_GEQ(c->snd_nxt, c->snd_max)) {
+			c->rtt_timing = 1;
+			c->rtt_seq = c->snd_nxt;
+			c->rtt_start = clock_ns();
+		}
+
+		TCP_send_packet(c, c->snd_nxt, size == queued ? TCP_FLAGS_PUSH | TCP_FLAGS_ACK : TCP_FLAGS_ACK, size);
+		c->snd_nxt += size;
+		if (SEQ_LT(c->snd_max, c->snd_nxt)) c->snd_max = c->snd_nxt;
+		nb_sent++;
 	}
 
-	connection.data_first = 0;
-	connection.data_last = 0;
+	// Waits for an ack, or for the window of the peer to open: if the
+	// update is lost, the timer probes it
+	if (!c->rto_timer && (c->snd_nxt != c->snd_una || c->snd_nxt != c->snd_end)) TCP_set_timer(&c->rto_timer, c->rto);
+
+	return nb_sent;
 }
 
-void TCP_receive_packet(uint ipv4_from, uint8 *buffer, uint16 size) {
-	TCPHeader *header = (TCPHeader*)buffer;
-	if (is_debug()) printf("[TCP %d]", switch_endian16(header->dport));
-	uint16 flags, header_size = (header->header_size >> 4) * 4;
-	int payload_size;
-	uint16 port = switch_endian16(header->dport);
+// Queues the data in the send buffer, and sends what the windows allow.
+// Waits while the buffer is full. Returns the number of bytes queued, or -1
+// if the connection was closed
+int TCP_send(TCPConnection *c, uint8 payload[], uint size) {
+	uint queued = 0;
+
+	while (queued < size) {
+		uint eflags = spinlock_lock_irqsave(&c->lock);
 
-	if (port == connection.sport) {
-		flags = header->flags;
-		if (is_debug()) printf("[HTTP] (%x)\n", flags);
-		switch(connection.status) {
+		if (c->status == TCP_STATUS_CLOSED) {
+			spinlock_unlock_irqrestore(&c->lock, eflags);
+			return -1;
+		}
 
-			// TCP handshake
-			case TCP_STATUS_HANDSHAKE_SYN:
-				if (flags & TCP_FLAGS_SYN) {
-					TCP_send_packet(ipv4_from, connection.sport, connection.dport,
-									switch_endian32(header->ack_nb), switch_endian32(header->sequence_nb) + 1,
-									TCP_FLAGS_ACK,
-									TCP_options, 12,
-									0, 0);
-					connection.status = TCP_STATUS_HANDSHAKE_ACK;
+		uint room = TCP_SEND_BUFFER_SIZE - (c->snd_end - c->snd_una);
+		uint chunk = umin(room, size - queued);
 
-					TCP_send_packet(ipv4_from, connection.sport, connection.dport,
-									switch_endian32(header->ack_nb), switch_endian32(header->sequence_nb) + 1,
-									TCP_FLAGS_PUSH | TCP_FLAGS_ACK,
-									TCP_options, 12,
-									connection.payload, connection.payload_size);
+		if (chunk) {
+			TCP_buffer_write(c->send_buffer, TCP_SEND_BUFFER_SIZE, c->snd_end, payload + queued, chunk);
+			c->snd_end += chunk;
+			queued += chunk;
+			TCP_output(c);
+		}
+		spinlock_unlock_irqrestore(&c->lock, eflags);
 
-					connection.status = TCP_STATUS_TRANSFER_PUSH;
+		if (chunk) TCP_transmit(c);
+		else switch_process();
+	}
+
+	return queued;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Input
+
+// Reads the options we know, and skips the others
+static void TCP_parse_options(TCPHeader *header, uint header_size, TCPOptions *options) {
+	uint8 *p = (uint8*)header + TCP_HEADER_SIZE, *end = (uint8*)header + header_size;
+
+	memset(options, 0, sizeof(TCPOptions));
+
+	while (p < end && *p != TCP_OPTION_END) {
+		if (*p == TCP_OPTION_NOP) {
+			p++;
+			continue;
+		}
+		if (end - p < 2 || p[1] < 2 || p[1] > end - p) return;
+
+		switch(p[0]) {
+			case TCP_OPTION_MSS:
+				if (p[1] == 4) options->mss = switch_endian16(*(unaligned_uint16*)(p + 2));
+				break;
+
+			// A shift above 14 is taken as 14 (RFC 7323, section 2.3)
+			case TCP_OPTION_WINDOW_SCALE:
+				if (p[1] == 3) {
+					options->has_wscale = 1;
+					options->wscale = umin(p[2], 14);
 				}
-				return;
+				break;
 
-			// Receive data
-			case TCP_STATUS_TRANSFER_PUSH:
-				// The server ends the connection
-				if (flags & TCP_FLAGS_FIN) {
-					connection.status = TCP_STATUS_FIN;
-					TCP_send_packet(ipv4_from, connection.sport, connection.dport,
-									switch_endian32(header->ack_nb), switch_endian32(header->sequence_nb) + 1,
-									TCP_FLAGS_ACK,
-									TCP_options, 12,
-									0, 0);
-					return;
+			case TCP_OPTION_SACK_PERMITTED:
+				if (p[1] == 2) options->sack_ok = 1;
+				break;
+
+			case TCP_OPTION_SACK:
+				for (uint i = 2; i + 8 <= p[1] && options->nb_sacks < TCP_MAX_SACK_BLOCKS; i += 8) {
+					options->sacks[options->nb_sacks].start = switch_endian32(*(unaligned_uint*)(p + i));
+					options->sacks[options->nb_sacks].end = switch_endian32(*(unaligned_uint*)(p + i + 4));
+					options->nb_sacks++;
 				}
+				break;
 
-				// We receive an actual payload
-				if (size > header_size) {
-					payload_size = size - header_size;
-					TCPData *data = (TCPData*)kmalloc(sizeof(TCPData));
-					data->content = kmalloc(payload_size + 1);
-					memcpy(data->content, buffer + header_size, payload_size);
-					data->content[payload_size] = 0;
-					data->size = payload_size;
-					data->next = 0;
-					if (!connection.data_first) {
-						connection.data_first = data;
-					} else {
-						connection.data_last->next = data;
-					}
-					connection.data_last = data;
-					TCP_send_packet(ipv4_from, connection.sport, connection.dport,
-									switch_endian32(header->ack_nb), switch_endian32(header->sequence_nb) + payload_size,
-									TCP_FLAGS_ACK,
-									TCP_options, 12,
-									0, 0);
+			case TCP_OPTION_TIMESTAMP:
+				if (p[1] == 10) {
+					options->has_ts = 1;
+					options->ts_val = switch_endian32(*(unaligned_uint*)(p + 2));
+					options->ts_ecr = switch_endian32(*(unaligned_uint*)(p + 6));
 				}
-				return;
+				break;
+		}
+		p += p[1];
+	}
+}
+
+// Processes the ack of a segment: SACKs, RTT, send window and congestion
+// window
+static void TCP_process_ack(TCPConnection *c, TCPHeader *header, uint payload_size, TCPOptions *options) {
+	uint sequence_nb = switch_endian32(header->sequence_nb), ack_nb = switch_endian32(header->ack_nb);
+	uint window = switch_endian16(header->win_size_value) << c->snd_wscale;
+
+	// Acks data we haven't sent: tell the peer where we are
+	if (SEQ_GT(ack_nb, c->snd_max)) {
+		TCP_send_ack(c);
+		return;
+	}
+	if (SEQ_LT(ack_nb, c->snd_una)) return;
+
+	// The blocks the peer received after a hole (RFC 2018). Those which
+	// don't make sense are ignored
+	for (uint i = 0; c->sack_ok && i < options->nb_sacks; i++) {
+		uint start = options->sacks[i].start, end = options->sacks[i].end;
+		if (SEQ_LT(start, ack_nb)) start = ack_nb;
+		if (SEQ_LT(start, end) && SEQ_LEQ(end, c->snd_max)) TCP_interval_add(c->sacked, &c->nb_sacked, TCP_MAX_SACKED, start, end);
+	}
+	TCP_interval_trim(c->sacked, &c->nb_sacked, ack_nb);
+
+	// Updates the send window with the most recent segment (RFC 793)
+	uint old_window = c->snd_wnd;
+	if (SEQ_LT(c->snd_wl1, sequence_nb) || (c->snd_wl1 == sequence_nb && SEQ_GEQ(ack_nb, c->snd_wl2))) {
+		c->snd_wnd = window;
+		c->snd_wl1 = sequence_nb;
+		c->snd_wl2 = ack_nb;
+	}
+
+	if (ack_nb == c->snd_una) {
+		// A duplicate ack (RFC 5681, section 2): the peer received a
+		// segment after one which is missing
+		if (c->snd_una == c->snd_max || payload_size || (header->flags & (TCP_FLAGS_SYN | TCP_FLAGS_FIN)) || window != old_window) {
+			if (c->snd_wnd > old_window) TCP_output(c);
+			return;
+		}
+
+		// Fast retransmit, and fast recovery until what was in flight is
+		// acknowledged. With SACK, the peer may say sooner that it has
+		// enough data after the hole (RFC 6675, section 5)
+		c->dupacks++;
+		if ((c->dupacks == TCP_DUPACK_THRESHOLD || (c->sack_ok && TCP_sacked_size(c) >= TCP_DUPACK_THRESHOLD * c->mss))
+			&& !c->in_recovery && SEQ_GT(ack_nb, c->recover)) {
+			c->ssthresh = umax(TCP_flight_size(c) / 2, 2 * c->mss);
+			c->recover = c->snd_max;
+			c->in_recovery = 1;
+			TCP_retransmit(c);
+
+			// The SACKs say what left the network, the window doesn't
+			// have to be inflated
+			if (c->sack_ok) {
+				c->cwnd = c->ssthresh;
+				TCP_output(c);
+			}
+			else c->cwnd = c->ssthresh + TCP_DUPACK_THRESHOLD * c->mss;
+			TCP_set_timer(&c->rto_timer, c->rto);
+		}
+		// Each duplicate ack is a segment which left the network
+		else if (c->in_recovery) {
+			if (!c->sack_ok) c->cwnd += c->mss;
+			TCP_output(c);
+		}
+		return;
+	}
+
+	// With timestamps, the echo times every ack of new data, even after a
+	// retransmission (RFC 7323, section 4)
+	uint acked = ack_nb - c->snd_una;
+	if (c->ts_ok && options->has_ts && options->ts_ecr) {
+		TCP_update_rtt(c, (TCP_timestamp() - options->ts_ecr) * 1000);
+	}
+	else if (c->rtt_timing && SEQ_GT(ack_nb, c->rtt_seq)) {
+		c->rtt_timing = 0;
+		TCP_update_rtt(c, (uint)udiv64(clock_ns() - c->rtt_start, 1000, 0));
+	}
+
+	c->snd_una = ack_nb;
+	if (SEQ_LT(c->snd_nxt, c->snd_una)) c->snd_nxt = c->snd_una;
+	c->nb_retries = 0;
+
+	if (c->in_recovery) {
+		// Everything which was in flight is there
+		if (SEQ_GEQ(ack_nb, c->recover)) {
+			c->cwnd = umin(c->ssthresh, TCP_flight_size(c) + c->mss);
+			c->in_recovery = 0;
+			c->dupacks = 0;
+		}
+		// A partial ack: the next hole is at snd_una (RFC 6582). With SACK,
+		// the output sends the holes, unless the peer SACKed nothing after
+		// it and it wasn't sent again
+		else if (!c->sack_ok) {
+			TCP_retransmit(c);
+			c->cwnd = (c->cwnd > acked ? c->cwnd - acked : 0) + c->mss;
 		}
+		else if (!c->nb_sacked && SEQ_GEQ(c->snd_una, c->rexmit_nxt)) TCP_retransmit(c);
 	}
 	else {
-			if (is_debug()) printf("[%d]\n", switch_endian16(header->dport));
+		c->dupacks = 0;
+
+		// Slow start, then congestion avoidance: about one segment per RTT
+		if (c->cwnd < c->ssthresh) c->cwnd += umin(acked, c->mss);
+		else c->cwnd += umax(1, c->mss * c->mss / c->cwnd);
+	}
+
+	// The timer restarts for what is still in flight
+	c->rto_timer = 0;
+	TCP_output(c);
+}
+
+// Copies received data to the receive buffer. Its start is copied after its
+// end too, so that a cursor can peek at a few bytes across the end
+static void TCP_receive_write(TCPConnection *c, uint sequence_nb, uint8 *data, uint size) {
+	uint index = sequence_nb & (TCP_RECEIVE_BUFFER_SIZE - 1);
+	uint wraps = index + size > TCP_RECEIVE_BUFFER_SIZE;
+	uint start = wraps ? 0 : index, end = wraps ? index + size - TCP_RECEIVE_BUFFER_SIZE : index + size;
+
+	TCP_buffer_write(c->receive_buffer, TCP_RECEIVE_BUFFER_SIZE, sequence_nb, data, size);
+	if (start < TCP_CURSOR_PEEK_MAX)
+		memcpy(c->receive_buffer + TCP_RECEIVE_BUFFER_SIZE + start, c->receive_buffer + start, umin(end, TCP_CURSOR_PEEK_MAX) - start);
+}
+
+// Adds the interval of data received after a hole. When the list is full,
+// the furthest interval is forgotten: the peer sends it again
+static void TCP_out_of_order_add(TCPConnection *c, uint start, uint end) {
+	TCP_interval_add(c->out_of_order, &c->nb_out_of_order, TCP_MAX_OUT_OF_ORDER, start, end);
+	c->sack_recent = start;
+}
+
+// Once a hole is filled, the data after it is there already
+static void TCP_out_of_order_advance(TCPConnection *c) {
+	uint n = 0;
+
+	for (; n < c->nb_out_of_order && SEQ_LEQ(c->out_of_order[n].start, c->rcv_nxt); n++) {
+		if (SEQ_GT(c->out_of_order[n].end, c->rcv_nxt)) c->rcv_nxt = c->out_of_order[n].end;
+	}
+
+	for (uint k = n; k < c->nb_out_of_order; k++) c->out_of_order[k - n] = c->out_of_order[k];
+	c->nb_out_of_order -= n;
+}
+
+// Copies the payload of a segment to its place in the receive buffer, and
+// acks it. The data which comes in order can wait for a delayed ack, any
+// other segment is acked at once: after a hole, or with data we already
+// have, the ack is a duplicate which tells the peer where we are. Called
+// with the connection lock held
+static void TCP_receive_data(TCPConnection *c, uint sequence_nb, uint8 *data, uint size, int fin) {
+	uint window_end = c->rcv_read + TCP_RECEIVE_BUFFER_SIZE;
+	int in_order = 0;
+
+	if (c->rcv_fin) {
+		TCP_send_ack(c);
+		return;
+	}
+
+	// Drops what we already have, and what doesn't fit in the window
+	if (SEQ_LT(sequence_nb, c->rcv_nxt)) {
+		uint old = umin(c->rcv_nxt - sequence_nb, size);
+		sequence_nb += old;
+		data += old;
+		size -= old;
+	}
+	if (SEQ_GT(sequence_nb + size, window_end)) {
+		size = SEQ_GT(window_end, sequence_nb) ? window_end - sequence_nb : 0;
+		fin = 0;
 	}
+
+	if (size > 0) {
+		TCP_receive_write(c, sequence_nb, data, size);
+		c->rcv_mss = umax(c->rcv_mss, size);
+
+		// Filling a hole is acked at once too (RFC 5681, section 4.2)
+		if (sequence_nb == c->rcv_nxt) {
+			in_order = !c->nb_out_of_order;
+			c->rcv_nxt += size;
+			TCP_out_of_order_advance(c);
+		}
+		else {
+			TCP_out_of_order_add(c, sequence_nb, sequence_nb + size);
+			c->quickack = TCP_QUICKACK_SEGMENTS;
+		}
+	}
+
+	// The server ends the connection, once we have everything before
+	if (fin && sequence_nb + size == c->rcv_nxt) {
+		c->rcv_nxt++;
+		c->rcv_fin = 1;
+		c->status = TCP_STATUS_FIN;
+		in_order = 0;
+	}
+
+	if (in_order && c->quickack) c->quickack--;
+	else if (in_order && c->rcv_nxt - c->rcv_acked < 2 * c->rcv_mss) {
+		if (!c->ack_timer) TCP_set_timer(&c->ack_timer, TCP_DELAYED_ACK);
+		return;
+	}
+
+	TCP_send_ack(c);
 }
 
+// Called with the connection lock held
+static void TCP_process_packet(TCPConnection *c, PacketBuffer *pb) {
+	TCPHeader *header = (TCPHeader*)pb->data;
+	uint16 size = packet_data_length(pb);
+	uint16 flags = header->flags, header_size = (header->header_size >> 4) * 4;
+	uint sequence_nb = switch_endian32(header->sequence_nb), ack_nb = switch_endian32(header->ack_nb);
+	int payload_size = size - header_size;
+
+	TCPOptions options;
+
+	if (is_debug()) printf("[TCP %d] (%x)\n", c->sport, flags);
+
+	// The data offset must cover the header and stay in the segment
+	if (header_size < TCP_HEADER_SIZE || header_size > size) return;
+	TCP_parse_options(header, header_size, &options);
+
+	// A reset which isn't in the window is ignored (RFC 793, section 3.4).
+	// Only one at rcv_nxt closes the connection, another one in the window
+	// gets a challenge ack: a blind reset must guess the sequence number
+	// (RFC 5961, section 3.2)
+	if (flags & TCP_FLAGS_RESET) {
+		if (c->status == TCP_STATUS_HANDSHAKE_SYN ? ack_nb == c->snd_nxt : sequence_nb == c->rcv_nxt) {
+			c->status = TCP_STATUS_CLOSED;
+			c->rto_timer = 0;
+		}
+		else if (c->status != TCP_STATUS_HANDSHAKE_SYN && SEQ_GT(sequence_nb, c->rcv_nxt) && SEQ_LT(sequence_nb, c->rcv_adv))
+			TCP_send_ack(c);
+		return;
+	}
+
+	switch(c->status) {
+
+		// TCP handshake
+		case TCP_STATUS_HANDSHAKE_SYN:
+			if ((flags & (TCP_FLAGS_SYN | TCP_FLAGS_ACK)) == (TCP_FLAGS_SYN | TCP_FLAGS_ACK) && ack_nb == c->iss + 1) {
+				if (c->rtt_timing) TCP_update_rtt(c, (uint)udiv64(clock_ns() - c->rtt_start, 1000, 0));
+				c->rtt_timing = 0;
+				c->nb_retries = 0;
+				c->rto_timer = 0;
+
+				c->irs = sequence_nb;
+				c->rcv_read = c->rcv_nxt = sequence_nb + 1;
+				c->snd_una = c->snd_nxt = c->snd_max = ack_nb;
+				c->snd_wnd = switch_endian16(header->win_size_value);	// Never scaled on a SYN
+				c->snd_wl1 = sequence_nb;
+				c->snd_wl2 = ack_nb;
+				c->status = TCP_STATUS_TRANSFER_PUSH;
+				c->quickack = TCP_QUICKACK_SEGMENTS;
+
+				// An option is used only if both sides sent it. The
+				// timestamps take room in every segment
+				c->mss = umin(options.mss ? options.mss : TCP_DEFAULT_MSS, TCP_MSS);
+				c->sack_ok = options.sack_ok;
+				c->ts_ok = options.has_ts;
+				if (c->ts_ok) {
+					c->ts_recent = options.ts_val;
+					c->mss -= TCP_TIMESTAMP_SIZE;
+				}
+				if (options.has_wscale) {
+					c->snd_wscale = options.wscale;
+					c->rcv_wscale = TCP_WINDOW_SHIFT;
+				}
+				c->cwnd = TCP_initial_window(c->mss);
+
+				// The data queued meanwhile acks the SYN, otherwise an ack does
+				if (!TCP_output(c)) TCP_send_ack(c);
+			}
+			return;
+
+		// Receive data
+		case TCP_STATUS_TRANSFER_PUSH:
+		case TCP_STATUS_FIN:
+			// A segment older than the last timestamp is an old duplicate
+			// (PAWS, RFC 7323 section 5). Otherwise the timestamp of the
+			// segment our next ack is for will be echoed
+			if (c->ts_ok && options.has_ts) {
+				if ((int)(options.ts_val - c->ts_recent) < 0) {
+					TCP_send_ack(c);
+					return;
+				}
+				if (SEQ_LEQ(sequence_nb, c->rcv_acked)) c->ts_recent = options.ts_val;
+			}
+
+			if (flags & TCP_FLAGS_ACK) TCP_process_ack(c, header, payload_size, &options);
+
+			// Our ack of the SYN was lost
+			if (flags & TCP_FLAGS_SYN) {
+				TCP_send_ack(c);
+				return;
+			}
+
+			if (payload_size > 0 || (flags & TCP_FLAGS_FIN))
+				TCP_receive_data(c, sequence_nb, pb->data + header_size, payload_size, flags & TCP_FLAGS_FIN);
+			return;
+	}
+}
+
+// The addresses are those of the IPv4 header: the segment goes to the
+// connection with our address and port as destination
+void TCP_receive_packet(uint ip_src, uint ip_dst, PacketBuffer *pb) {
+	TCPHeader *header = (TCPHeader*)pb->data;
+	if (packet_data_length(pb) < TCP_HEADER_SIZE) return;
+
+	uint eflags = spinlock_lock_irqsave(&TCP_table_lock);
+	TCPConnection *c = TCP_lookup(ip_dst, switch_endian16(header->dport), ip_src, switch_endian16(header->sport));
+	if (!c) {
+		spinlock_unlock_irqrestore(&TCP_table_lock, eflags);
+		if (is_debug()) printf("[TCP %d]\n", switch_endian16(header->dport));
+		return;
+	}
+
+	// Locked before the table is released, so that it can't be closed
+	// in between
+	spinlock_lock(&c->lock);
+	spinlock_unlock(&TCP_table_lock);
+
+	TCP_process_packet(c, pb);
+	spinlock_unlock_irqrestore(&c->lock, eflags);
+
+	TCP_transmit(c);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Receive buffer
+
+// The window we advertised has grown enough to tell the peer (RFC 1122,
+// section 4.2.3.3: not by a few bytes at a time)
+static void TCP_window_update(TCPConnection *c) {
+	if (c->status != TCP_STATUS_TRANSFER_PUSH) return;
+
+	uint window_end = c->rcv_nxt + TCP_receive_window(c);
+	if (window_end - c->rcv_adv >= umin(TCP_RECEIVE_BUFFER_SIZE / 2, c->mss)) TCP_send_ack(c);
+}
+
+// Releases the data received so far, the connection stays open
+void TCP_cleanup_connection(TCPConnection *c) {
+	uint eflags = spinlock_lock_irqsave(&c->lock);
+	c->rcv_read = c->rcv_nxt - c->rcv_fin;
+	TCP_window_update(c);
+	spinlock_unlock_irqrestore(&c->lock, eflags);
+
+	TCP_transmit(c);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Cursors
+
+static uint TCP_cursor_sequence(TCPCursor *cursor) {
+	return cursor->connection->irs + 1 + cursor->offset;
+}
+
+// The bytes received after the cursor. Called with the connection lock held
+static uint TCP_cursor_available(TCPCursor *cursor) {
+	TCPConnection *c = cursor->connection;
+	return c->rcv_nxt - c->rcv_fin - TCP_cursor_sequence(cursor);
+}
+
+// The cursor starts at the first byte which isn't released
+void TCP_cursor_init(TCPCursor *cursor, TCPConnection *c) {
+	uint eflags = spinlock_lock_irqsave(&c->lock);
+	cursor->connection = c;
+	cursor->offset = c->rcv_read - c->irs - 1;
+	spinlock_unlock_irqrestore(&c->lock, eflags);
+}
+
+// Waits until size bytes after the cursor are received. Returns 0 if the
+// connection ends before
+int TCP_cursor_wait(TCPCursor *cursor, uint size) {
+	TCPConnection *c = cursor->connection;
+
+	for (;;) {
+		uint eflags = spinlock_lock_irqsave(&c->lock);
+		int received = TCP_cursor_available(cursor) >= size;
+		int ended = c->rcv_fin || c->status == TCP_STATUS_CLOSED;
+		spinlock_unlock_irqrestore(&c->lock, eflags);
+
+		if (received) return 1;
+		if (ended) return 0;
+		switch_process();
+	}
+}
+
+// Waits for the size bytes after the cursor and returns where they are in
+// the receive buffer, in one piece if size is at most TCP_CURSOR_PEEK_MAX.
+// The cursor doesn't move. Returns 0 if the connection ends before
+uint8 *TCP_cursor_peek(TCPCursor *cursor, uint size) {
+	if (!TCP_cursor_wait(cursor, size)) return 0;
+	return cursor->connection->receive_buffer + (TCP_cursor_sequence(cursor) & (TCP_RECEIVE_BUFFER_SIZE - 1));
+}
+
+// Returns the data received after the cursor, as much of it as is in one
+// piece, and moves the cursor after it. Doesn't wait
+uint TCP_cursor_next(TCPCursor *cursor, uint8 **data) {
+	TCPConnection *c = cursor->connection;
+	uint eflags = spinlock_lock_irqsave(&c->lock);
+
+	uint index = TCP_cursor_sequence(cursor) & (TCP_RECEIVE_BUFFER_SIZE - 1);
+	uint size = umin(TCP_cursor_available(cursor), TCP_RECEIVE_BUFFER_SIZE - index);
+	spinlock_unlock_irqrestore(&c->lock, eflags);
+
+	*data = c->receive_buffer + index;
+	cursor->offset += size;
+	return size;
+}
+
+int TCP_cursor_skip(TCPCursor *cursor, uint size) {
+	if (!TCP_cursor_wait(cursor, size)) return 0;
+
+	cursor->offset += size;
+	return 1;
+}
+
+// For data which may not be in one piece
+int TCP_cursor_copy(TCPCursor *cursor, uint8 *buffer, uint size) {
+	if (!TCP_cursor_wait(cursor, size)) return 0;
+
+	uint8 *receive_buffer = cursor->connection->receive_buffer;
+	uint index = TCP_cursor_sequence(cursor) & (TCP_RECEIVE_BUFFER_SIZE - 1);
+	uint first = umin(size, TCP_RECEIVE_BUFFER_SIZE - index);
+
+	memcpy(buffer, receive_buffer + index, first);
+	if (size > first) memcpy(buffer + first, receive_buffer, size - first);
+
+	cursor->offset += size;
+	return 1;
+}
+
+// The data before the cursor isn't needed anymore: its room goes back to
+// the window
+void TCP_cursor_release(TCPCursor *cursor) {
+	TCPConnection *c = cursor->connection;
+	uint eflags = spinlock_lock_irqsave(&c->lock);
+
+	uint sequence_nb = TCP_cursor_sequence(cursor);
+	if (SEQ_GT(sequence_nb, c->rcv_read)) {
+		c->rcv_read = sequence_nb;
+		TCP_window_update(c);
+	}
+
+	spinlock_unlock_irqrestore(&c->lock, eflags);
+	TCP_transmit(c);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Connections
+
+// Frees the connection and what it received. Once it is out of the hash
+// table, no segment can find it: taking its lock waits for the one which
+// may be processed. A connection the peer has closed gets our FIN,
+// otherwise it is reset. The segment is sent, and the buffers freed, once
+// the locks are released
+void TCP_close_connection(TCPConnection *c) {
+	mutex_lock(&TCP_setup_mutex);
+	uint eflags = spinlock_lock_irqsave(&TCP_table_lock);
+
+	TCPConnection **prev = &TCP_hash[TCP_hash_key(c->local_ipv4, c->sport, c->ipv4, c->dport)];
+	while (*prev && *prev != c) prev = &(*prev)->hash_next;
+	if (*prev) *prev = c->hash_next;
+
+	spinlock_lock(&c->lock);
+	if (c->status == TCP_STATUS_FIN) TCP_send_packet(c, c->snd_nxt, TCP_FLAGS_FIN | TCP_FLAGS_ACK, 0);
+	else if (c->status != TCP_STATUS_CLOSED) TCP_send_packet(c, c->snd_nxt, TCP_FLAGS_RESET | TCP_FLAGS_ACK, 0);
+
+	PacketBuffer *pb = c->tx_queue;
+	c->tx_queue = c->tx_queue_last = 0;
+	c->status = TCP_STATUS_CLOSED;
+	c->rto_timer = 0;
+	c->ack_timer = 0;
+	spinlock_unlock(&c->lock);
+
+	spinlock_unlock_irqrestore(&TCP_table_lock, eflags);
+
+	// Nothing uses the connection anymore. The slot can be taken again
+	// once the mutex is released
+	TCP_send_queue(pb, c->ipv4);
+	kfree(c->send_buffer);
+	kfree(c->receive_buffer);
+	c->in_use = 0;
+
+	mutex_unlock(&TCP_setup_mutex);
+}
+
+// Returns 0 if there is no connection or port left. The payload is sent
+// once the connection is established
 TCPConnection *TCP_start_connection(uint ipv4, uint16 dport, uint8 *payload, uint16 payload_size) {
+	uint local_ipv4 = network_get_IPv4();
+	uint8 *send_buffer = (uint8*)kmalloc(TCP_SEND_BUFFER_SIZE);
+	uint8 *receive_buffer = (uint8*)kmalloc(TCP_RECEIVE_BUFFER_SIZE + TCP_CURSOR_PEEK_MAX);
+	TCPConnection *c = 0;
+
+	mutex_lock(&TCP_setup_mutex);
+	uint eflags = spinlock_lock_irqsave(&TCP_table_lock);
+
+	uint16 sport = TCP_ephemeral_port(local_ipv4, ipv4, dport);
+	for (uint i = 0; sport && send_buffer && receive_buffer && i < TCP_MAX_CONNECTIONS; i++) {
+		if (!TCP_connections[i].in_use) {
+			c = &TCP_connections[i];
+			break;
+		}
+	}
+	if (!c) {
+		spinlock_unlock_irqrestore(&TCP_table_lock, eflags);
+		mutex_unlock(&TCP_setup_mutex);
+		if (send_buffer) kfree(send_buffer);
+		if (receive_buffer) kfree(receive_buffer);
+		return 0;
+	}
+
+	// A slot which isn't used has nothing in it to free. This clears the
+	// lock too
+	memset(c, 0, sizeof(TCPConnection));
+	c->in_use = 1;
+	c->ipv4 = ipv4;
+	c->local_ipv4 = local_ipv4;
+	c->status = TCP_STATUS_HANDSHAKE_SYN;
+	c->sport = sport;
+	c->dport = dport;
+	c->send_buffer = send_buffer;
+	c->receive_buffer = receive_buffer;
+	c->mss = TCP_MSS;
+
+	// The SYN takes the first sequence number, the payload follows it
+	c->iss = (rand() << 16) ^ rand();
+	c->snd_una = c->iss;
+	c->snd_nxt = c->snd_max = c->recover = c->iss + 1;
+	c->snd_end = c->iss + 1;
+	TCP_buffer_write(c->send_buffer, TCP_SEND_BUFFER_SIZE, c->snd_end, payload, payload_size);
+	c->snd_end += payload_size;
+
+	// Until the SYN of the peer comes, nothing is received
+	c->rcv_read = c->rcv_nxt = c->irs + 1;
+
+	// RFC 5681, section 3.1, and RFC 6298, section 2.1
+	c->cwnd = TCP_initial_window(c->mss);
+	c->ssthresh = 0xFFFFFFFF;
+	c->rto = TCP_RTO_INITIAL;
+	c->rtt_timing = 1;
+	c->rtt_seq = c->iss;
+	c->rtt_start = clock_ns();
+
+	TCP_set_timer(&c->rto_timer, c->rto);
+	TCP_send_packet(c, c->iss, TCP_FLAGS_SYN, 0);
+
+	uint key = TCP_hash_key(local_ipv4, sport, ipv4, dport);
+	c->hash_next = TCP_hash[key];
+	TCP_hash[key] = c;
+	spinlock_unlock_irqrestore(&TCP_table_lock, eflags);
+
+	// Sent without the locks: the first packet to a host may have to
+	// wait for an ARP reply, which comes through the network interrupt
+	TCP_transmit(c);
+	mutex_unlock(&TCP_setup_mutex);
+
+	return c;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Timer process
+
+// The retransmission timer expired (RFC 6298, section 5). Called with the
+// connection lock held
+static void TCP_timeout(TCPConnection *c) {
+	c->rto_timer = 0;
+	if (c->status == TCP_STATUS_CLOSED) return;
+
+	if (++c->nb_retries > TCP_MAX_RETRIES) {
+		c->status = TCP_STATUS_CLOSED;
+		return;
+	}
+
+	// Backs off, and stops timing the segment, which is sent again
+	c->rto = umin(c->rto * 2, TCP_RTO_MAX);
+	c->rtt_timing = 0;
+
+	if (c->status == TCP_STATUS_HANDSHAKE_SYN) {
+		TCP_send_packet(c, c->iss, TCP_FLAGS_SYN, 0);
+		TCP_set_timer(&c->rto_timer, c->rto);
+		return;
+	}
+	if (c->snd_una == c->snd_end) return;
+
+	// A loss: back to one segment, and everything after snd_una is sent
+	// again as the acks come (RFC 5681, section 3.1). A window probe
+	// doesn't say anything about the congestion
+	if (c->snd_wnd) {
+		c->ssthresh = umax(TCP_flight_size(c) / 2, 2 * c->mss);
+		c->cwnd = c->mss;
+	}
+	c->snd_nxt = c->snd_una;
+	c->recover = c->snd_max;
+	c->in_recovery = 0;
+	c->dupacks = 0;
+
+	// The peer may have dropped what it SACKed (RFC 2018, section 8)
+	c->nb_sacked = 0;
+
+	TCP_retransmit(c);
+	TCP_set_timer(&c->rto_timer, c->rto);
+}
+
+// Runs the timers which have expired. Returns when the next one expires
+// (clock_ns()), 0 when none is armed
+static uint64 TCP_run_timers() {
+	uint64 now = clock_ns();
+	uint64 next = 0;
+	uint eflags = spinlock_lock_irqsave(&TCP_table_lock);
+
+	for (uint i = 0; i < TCP_MAX_CONNECTIONS; i++) {
+		TCPConnection *c = &TCP_connections[i];
+		if (!c->in_use) continue;
+
+		spinlock_lock(&c->lock);
+		if (c->rto_timer && c->rto_timer <= now) TCP_timeout(c);
+		if (c->ack_timer && c->ack_timer <= now) TCP_send_ack(c);
+		if (c->rto_timer && (!next || c->rto_timer < next)) next = c->rto_timer;
+		if (c->ack_timer && (!next || c->ack_timer < next)) next = c->ack_timer;
+		spinlock_unlock(&c->lock);
+	}
+
+	spinlock_unlock_irqrestore(&TCP_table_lock, eflags);
+
+	// What the timers sent goes out without the locks
+	for (uint i = 0; i < TCP_MAX_CONNECTIONS; i++) {
+		if (TCP_connections[i].tx_queue) TCP_transmit(&TCP_connections[i]);
+	}
+	return next;
+}
+
+// The timer tick at which the process running the timers wakes up for a
+// deadline. The ticks are coarser than the timers, so it rounds up
+static uint TCP_deadline_tick(uint64 deadline) {
+	uint64 now = clock_ns();
+	uint ms = deadline > now ? (uint)udiv64(deadline - now, 1000000, 0) : 0;
+
+	uint tick = get_ticks() + ms * get_timer_hz() / 1000 + 1;
+	return tick ? tick : 1;
+}
+
+static void TCP_timers() {
+	Process *ps = (Process*)current_process;
+
+	for (;;) {
+		// Sleeps until the next timer expires, or until TCP_set_timer() arms
+		// one. The flag is set before running the timers, so that a timer
+		// armed in between wakes us up
+		__sync_fetch_and_or(&ps->flags, PROCESS_POLLING);
+		uint64 next = TCP_run_timers();
+		ps->wake_tick = next ? TCP_deadline_tick(next) : 0;
+
+		// The BSP comes back to a polling process when no process has
+		// anything to do: wait for an interrupt rather than spin
+		switch_process();
+		while (ps->flags & PROCESS_POLLING) {
+			asm volatile("hlt");
+			switch_process();
+		}
+	}
+}
 
-	connection.ipv4 = ipv4;
-	connection.status = TCP_STATUS_HANDSHAKE_SYN;
-	connection.sport = 10000 + rand();
-	connection.dport = dport;
-	connection.payload = payload;
-	connection.payload_size = payload_size;
-	connection.data_first = 0;
-	connection.data_last = 0;
-
-	TCP_send_packet(ipv4, connection.sport, connection.dport,
-					10, 0,
-					TCP_FLAGS_SYN,
-					TCP_options, 12,
-					0, 0);
-
-	return &connection;
+// Starts the process which runs the timers, which needs the scheduler.
+// Until then nothing is retransmitted
+void TCP_start_timers() {
+	if (!TCP_timer_process) TCP_timer_process = start_kernel_process(TCP_timers, 0);
 }
@@ -3,6 +3,8 @@
 
 #include "libc.h"
 #include "display.h"
+#include "spinlock.h"
+#include "packet.h"
 
 #define TCP_PORT_HTTP					80
 #define TCP_PORT_HTTPS					443
@@ -13,29 +15,131 @@
 #define TCP_STATUS_TRANSFER_PUSH		4
 #define TCP_STATUS_TRANSFER_ACK			5
 #define TCP_STATUS_FIN					6
+#define TCP_STATUS_CLOSED				7		// Reset by the peer, or it stopped answering
 
-typedef struct tcp_data {
-	uint8 *content;
-	uint16 size;
-	struct tcp_data *next;
-} TCPData;
+// The connections are found by their addresses and ports in a hash table
+#define TCP_MAX_CONNECTIONS				64
+#define TCP_HASH_SIZE					128		// A power of 2
+
+// The ports we connect from (RFC 6335)
+#define TCP_EPHEMERAL_PORT_FIRST		49152
+#define TCP_EPHEMERAL_PORT_LAST			65535
+
+// The data sent and not acknowledged yet, and the data not sent yet, wait
+// in a ring buffer indexed by sequence number. So does the data received,
+// until the application releases it. The receive window is larger than
+// the 64KB the header can say: it is advertised with a window scale
+#define TCP_SEND_BUFFER_SIZE			65536	// A power of 2
+#define TCP_RECEIVE_BUFFER_SIZE			131072	// A power of 2
+#define TCP_CURSOR_PEEK_MAX				64		// Bytes which can be peeked at across the end
+
+// The data received after a hole, and the data the peer tells us it has
+// received after one (SACK)
+#define TCP_MAX_OUT_OF_ORDER			8
+#define TCP_MAX_SACKED					8
 
 typedef struct {
-	uint ipv4;
-	uint16 sport;
-	uint16 dport;
-	int status;
-	uint8 *payload;
-	uint16 payload_size;
-	TCPData *data_first;
-	TCPData *data_last;
-	uint sequence_nb;
-	uint ack_nb;
+	uint start;
+	uint end;				// Excluded
+} TCPInterval;
+
+typedef struct tcp_connection {
+	uint ipv4;				// The remote host
+	uint local_ipv4;
+	uint16 sport;			// Our port
+	uint16 dport;			// The port of the remote host
+	uint8 in_use;
+	struct tcp_connection *hash_next;	// Next connection in the same bucket
+	volatile int status;
+	Spinlock lock;			// Shared between the network interrupt and the processes
+
+	// The segments built with the lock held. They are sent once it is
+	// released: a send can wait for an ARP reply
+	PacketBuffer *tx_queue;
+	PacketBuffer *tx_queue_last;
+
+	// Send sequence space (RFC 793): acknowledged < snd_una <= sent < snd_nxt
+	// <= queued < snd_end. snd_max is the highest sent, snd_nxt goes back
+	// to snd_una after a timeout
+	uint8 *send_buffer;
+	uint iss;
+	uint snd_una;
+	uint snd_nxt;
+	uint snd_max;
+	uint snd_end;
+	uint snd_wnd;			// The window of the peer
+	uint snd_wl1;			// Sequence and ack numbers of the segment it came in
+	uint snd_wl2;
+	uint16 mss;				// The payload of a segment, without its options
+
+	// Options negotiated on the SYN (RFC 7323 and RFC 2018)
+	uint8 snd_wscale;		// The window of the peer is shifted by it
+	uint8 rcv_wscale;		// The window we advertise is shifted by it
+	uint8 ts_ok;
+	uint8 sack_ok;
+	uint ts_recent;			// The timestamp we echo
+
+	// Receive sequence space: read by the application < rcv_read <= received
+	// < rcv_nxt <= window < rcv_read + TCP_RECEIVE_BUFFER_SIZE. The segments
+	// after a hole are in the buffer already, their intervals in out_of_order
+	uint8 *receive_buffer;
+	uint irs;
+	uint rcv_read;
+	uint rcv_nxt;
+	uint rcv_adv;			// The end of the window we advertised
+	uint rcv_acked;			// The last ack we sent
+	uint16 rcv_mss;			// The largest segment received
+	uint8 quickack;			// Segments still acked without delay
+	uint8 rcv_fin;			// rcv_nxt counts the FIN
+	TCPInterval out_of_order[TCP_MAX_OUT_OF_ORDER];
+	uint8 nb_out_of_order;
+	uint sack_recent;		// In the interval received last, reported first
+
+	// Congestion control (RFC 5681), with the recovery from RFC 6675 when
+	// the peer sends SACKs, NewReno (RFC 6582) when it doesn't
+	uint cwnd;
+	uint ssthresh;
+	uint recover;			// snd_max when the recovery started
+	uint8 dupacks;
+	uint8 in_recovery;
+	TCPInterval sacked[TCP_MAX_SACKED];		// Above snd_una
+	uint8 nb_sacked;
+	uint rexmit_nxt;		// The holes before it were sent again
+
+	// Retransmission timer (RFC 6298), in microseconds. Without timestamps,
+	// one segment at a time is timed, never a retransmitted one
+	uint srtt;
+	uint rttvar;
+	uint rto;
+	uint rtt_seq;
+	uint64 rtt_start;
+	uint8 rtt_timing;
+	uint8 nb_retries;		// Timeouts in a row
+	uint64 rto_timer;		// When it expires (clock_ns()), 0 when stopped
+	uint64 ack_timer;		// When the delayed ack is due
 } TCPConnection;
 
+// Reads the data received where it is, in the receive buffer. It stays
+// there until the application releases it, and another cursor can read it
+// again
+typedef struct {
+	TCPConnection *connection;
+	uint offset;			// In the data received since the start
+} TCPCursor;
+
 TCPConnection *TCP_start_connection(uint ipv4, uint16 dport, uint8 *payload, uint16 payload_size);
-void TCP_receive_packet(uint ipv4_from, uint8 *buffer, uint16 size);
-void TCP_send(uint8 payload[], uint size);
-void TCP_cleanup_connection();
+void TCP_receive_packet(uint ip_src, uint ip_dst, PacketBuffer *pb);
+uint16 TCP_checksum(PacketBuffer *pb, uint ip_src, uint ip_dst);
+int TCP_send(TCPConnection *c, uint8 payload[], uint size);
+void TCP_cleanup_connection(TCPConnection *c);
+void TCP_cursor_init(TCPCursor *cursor, TCPConnection *c);
+int TCP_cursor_wait(TCPCursor *cursor, uint size);
+uint8 *TCP_cursor_peek(TCPCursor *cursor, uint size);
+uint TCP_cursor_next(TCPCursor *cursor, uint8 **data);
+int TCP_cursor_skip(TCPCursor *cursor, uint size);
+int TCP_cursor_copy(TCPCursor *cursor, uint8 *buffer, uint size);
+void TCP_cursor_release(TCPCursor *cursor);
+void TCP_close_connection(TCPConnection *c);
+void TCP_start_timers();
 
 #endif
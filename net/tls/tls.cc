@@ -38,65 +38,35 @@ typedef struct __attribute__((packed)) {
 	uint16 version;
 } TLSHandshake;
 
-typedef struct {
-	TCPData **data;
-	uint offset;
-} TLSCursor;
+// The records are read in place in the TCP receive buffer
+typedef TCPCursor TLSCursor;
 
 void TLSCursor_init(TLSCursor *cursor, TCPConnection *connection) {
-	cursor->data = &(connection->data_first);
-	cursor->offset = 0;
+	TCP_cursor_init(cursor, connection);
 }
 
-uint8 *TLSCursor_next(TLSCursor *cursor, uint nb_bytes) {
-	while (*cursor->data == 0);
-
-	while (cursor->offset + nb_bytes > (*(cursor->data))->size) {
-//		printf("%d / %d\n", cursor->offset + nb_bytes , (*(cursor->data))->size);
-		nb_bytes = nb_bytes - (*(cursor->data))->size + cursor->offset;
-//		printf("New offset: %d\n", offset);
-		cursor->data = &(*(cursor->data))->next;
-		while (*cursor->data == 0);
-		cursor->offset = 0;
-	}
-
-	cursor->offset += nb_bytes;
-
-	return (uint8*)(*(cursor->data))->content + cursor->offset;
+// Skips nb_bytes, then waits for the peek_size bytes after them (at most
+// TCP_CURSOR_PEEK_MAX) and returns where they are. Returns 0 if the
+// connection ends before
+uint8 *TLSCursor_next(TLSCursor *cursor, uint nb_bytes, uint peek_size) {
+	if (!TCP_cursor_skip(cursor, nb_bytes)) return 0;
+	return TCP_cursor_peek(cursor, peek_size);
 }
 
-uint8 *TLSCursor_copy_next(TLSCursor *cursor, uint nb_bytes, uint8 *buffer) {
-	while (*cursor->data == 0);
-	uint buffer_offset = 0, bytes_left_in_data;
-
-	while (cursor->offset + nb_bytes > (*(cursor->data))->size) {
-		bytes_left_in_data = (*(cursor->data))->size - cursor->offset;
-		nb_bytes -= bytes_left_in_data;
-		memcpy(buffer + buffer_offset, (*(cursor->data))->content + cursor->offset, bytes_left_in_data);
-//		printf("Copy %d bytes (%x -> %x)\n", bytes_left_in_data, buffer + buffer_offset, buffer + buffer_offset + bytes_left_in_data);
-		buffer_offset += bytes_left_in_data;
-
-//		printf("New offset: %d\n", offset);
-		cursor->data = &(*(cursor->data))->next;
-		while (*cursor->data == 0);
-		cursor->offset = 0;
-	}
-
-	memcpy(buffer + buffer_offset, (*(cursor->data))->content + cursor->offset, nb_bytes);
-//	printf("Copy %d bytes (%x -> %x)\n", nb_bytes, buffer + buffer_offset, buffer + buffer_offset + nb_bytes);
-	cursor->offset += nb_bytes;
-
-	return (uint8*)(*(cursor->data))->content + cursor->offset;
+// Returns 0 if the connection ends before nb_bytes are received
+int TLSCursor_copy_next(TLSCursor *cursor, uint nb_bytes, uint8 *buffer) {
+	return TCP_cursor_copy(cursor, buffer, nb_bytes);
 }
 
 uint8 TLSCursor_next_byte(TLSCursor *cursor) {
-	uint8 *tmp = TLSCursor_next(cursor, 1);
-	return *tmp;
+	uint8 *tmp = TLSCursor_next(cursor, 1, 1);
+	return tmp ? *tmp : 0;
 }
 
+// Waits for a record header and the first byte of its content (the type of
+// a handshake message). Returns 0 if the connection has ended
 uint8 *TLSCursor_current(TLSCursor *cursor) {
-	while (*cursor->data == 0);
-	return (*(cursor->data))->content + cursor->offset;
+	return TCP_cursor_peek(cursor, sizeof(TLSRecord) + 1);
 }
 
 
@@ -239,6 +209,10 @@ class TLS {
 public:
 	TLS(Window *win, uint ip, char *hostname, uint8 payload[]) {
 		this->send_client_hello(ip, hostname);
+		if (!this->connection) {
+			printf_win(win, "Too many TCP connections\n");
+			return;
+		}
 		printf_win(win, ".");
 		if (this->receive_server_hello(win) < 0) return;
 		printf_win(win, ".");
@@ -305,7 +279,9 @@ public:
 	}
 
 	void handle_alert(Window *win, TLSCursor *cursor) {
-		uint8 *alert_code = TLSCursor_next(cursor, 1);
+		uint8 *alert = TCP_cursor_peek(cursor, 2);		// Level and description
+		if (!alert) return;
+		uint8 *alert_code = alert + 1;
 		printf_win(win, "\nAlert %d: ", *alert_code);
 
 		switch(*alert_code) {
@@ -466,9 +442,11 @@ public:
 
 		while (keep_downloading) {
 			TLSRecord *record = (TLSRecord *)TLSCursor_current(&this->cursor);
+			if (!record) return -1;
 			size = switch_endian16(record->length);
 	//		printf("Content type: %X, size:%d\n", record->content_type, size);
-			uint8 *tmp = TLSCursor_next(&this->cursor, 5);
+			uint8 *tmp = TLSCursor_next(&this->cursor, 5, 1);
+			if (!tmp) return -1;
 	//		printf("Content subtype: %X\n", tmp[0]);
 			this->handshake_size += size;
 
@@ -476,7 +454,7 @@ public:
 				keep_downloading = 0;
 	//			break;
 			}
-			else TLSCursor_next(&this->cursor, size);
+			else if (!TCP_cursor_skip(&this->cursor, size)) return -1;
 		};
 
 		// Allocates the handshake_buffer, which concatenates all the handshake
@@ -499,9 +477,11 @@ public:
 
 		while (keep_downloading) {
 			TLSRecord *record = (TLSRecord *)TLSCursor_current(&this->cursor);
+			if (!record) return -1;
 			size = switch_endian16(record->length);
 	//		printf("Content type: %X, size:%d\n", record->content_type, size);
-			uint8 *tmp = TLSCursor_next(&this->cursor, 5);
+			uint8 *tmp = TLSCursor_next(&this->cursor, 5, 1);
+			if (!tmp) return -1;
 	//		printf("Content subtype: %X\n", tmp[0]);
 
 			switch(tmp[0]) {
@@ -520,7 +500,7 @@ public:
 					break;
 			}
 
-			TLSCursor_copy_next(&this->cursor, size, this->handshake_buffer + this->handshake_size);
+			if (!TLSCursor_copy_next(&this->cursor, size, this->handshake_buffer + this->handshake_size)) return -1;
 			this->handshake_size += size;
 		};
 
@@ -595,14 +575,14 @@ public:
 		memcpy(this->handshake_buffer + this->handshake_size, this->client_key_exchange + 5, 6 + this->key_size);
 		this->handshake_size += 6 + this->key_size;
 
-		TCP_send(client_key_exchange, 11 + this->key_size);
+		TCP_send(this->connection, client_key_exchange, 11 + this->key_size);
 
 		delete this->client_key_exchange;
 	}
 
 	void send_client_change_cipher_suite() {
 		uint8 client_change_cipher_spec[6] = { 0x14, 0x03, 0x03, 0x00, 0x01, 0x01 };
-		TCP_send(client_change_cipher_spec, 6);
+		TCP_send(this->connection, client_change_cipher_spec, 6);
 	}
 
 	void send_client_encrypted_handshake() {
@@ -631,10 +611,10 @@ public:
 	//	printf("\n%x %x\n\n", &client_encrypted_handshake_message, ciphertext.value);
 		message_encrypt(msg, &this->client_write_key, &this->client_write_MAC_key, 0, TLS_HANDSHAKE);
 
-		TCP_cleanup_connection();
+		TCP_cleanup_connection(this->connection);
 		TLSCursor_init(&this->cursor, this->connection);
 
-		TCP_send(message_all(msg), msg->ciphertext.size);
+		TCP_send(this->connection, message_all(msg), msg->ciphertext.size);
 
 		message_free(msg);
 	}
@@ -644,9 +624,11 @@ public:
 
 		while (keep_downloading) {
 			TLSRecord *record = (TLSRecord *)TLSCursor_current(&this->cursor);
+			if (!record) return -1;
 			uint16 size = switch_endian16(record->length);
 	//		printf("Content type: %X, size:%d\n", record->content_type, size);
-			uint8 *tmp = TLSCursor_next(&this->cursor, 5);
+			uint8 *tmp = TLSCursor_next(&this->cursor, 5, 1);
+			if (!tmp) return -1;
 	//		printf("Content subtype: %X\n", tmp[0]);
 
 			if (record->content_type == TLS_ALERT) {
@@ -655,10 +637,10 @@ public:
 			}
 			if (record->content_type == TLS_CHANGE_CIPHER_SPEC) keep_downloading = 0;
 
-			TLSCursor_next(&this->cursor, size);
+			if (!TCP_cursor_skip(&this->cursor, size)) return -1;
 		};
 
-		TCP_cleanup_connection();
+		TCP_cleanup_connection(this->connection);
 		TLSCursor_init(&this->cursor, this->connection);
 		return 0;
 	}
@@ -675,7 +657,7 @@ public:
 		memcpy(plaintext+22+hostname_size, "\r\n\r\n", 4);*/
 
 		message_encrypt(msg, &this->client_write_key, &this->client_write_MAC_key, 1, TLS_APPLICATION_DATA);
-		TCP_send(message_all(msg), msg->ciphertext.size);
+		TCP_send(this->connection, message_all(msg), msg->ciphertext.size);
 
 		message_free(msg);
 	}
@@ -685,15 +667,20 @@ public:
 
 		while (keep_downloading) {
 			TLSRecord *record = (TLSRecord *)TLSCursor_current(&this->cursor);
+			if (!record) break;
 			uint16 size = switch_endian16(record->length);
 	//		printf("Content type: %X, size:%d\n", record->content_type, size);
-			uint8 *tmp = TLSCursor_next(&this->cursor, 5);
+			uint8 *tmp = TLSCursor_next(&this->cursor, 5, 1);
+			if (!tmp) break;
 	//		printf("Content subtype: %X\n", tmp[0]);
 
 			if (record->content_type == TLS_CHANGE_CIPHER_SPEC) keep_downloading = 0;
 
 			uint8 *data = (uint8*)kmalloc(size);
-			TLSCursor_copy_next(&this->cursor, size, data);
+			if (!TLSCursor_copy_next(&this->cursor, size, data)) {
+				kfree(data);
+				break;
+			}
 			TLSEncryptedMessage *msg = (TLSEncryptedMessage*)message_load(data, size);
 	//		printf("Plaintext: %d bytes. Ciphertext: %d bytes\n", msg->plaintext.size, msg->ciphertext.size);
 			message_decrypt(msg, &this->server_write_key, &this->server_write_MAC_key, 2, TLS_APPLICATION_DATA);
@@ -710,10 +697,11 @@ public:
 			kfree(data);
 			keep_downloading = 0;
 		};
-		TCP_cleanup_connection();
+		TCP_cleanup_connection(this->connection);
 	}
 
 	~TLS() {
+		if (this->connection) TCP_close_connection(this->connection);
 		kfree(this->client_hello);
 		kfree(this->handshake_buffer);
 		kfree(this->keys);
@@ -4,6 +4,8 @@
 #include "dhcp.h"
 #include "dns.h"
 #include "debug.h"
+#include "network.h"
+#include "checksum.h"
 
 #define UDP_HEADER_SIZE		8
 
@@ -14,74 +16,60 @@ typedef struct __attribute__((packed)) {
 	uint16 checksum;
 } UDPHeader;
 
-uint16 UDP_checksum(UDPHeader *header) {
-	uint sum = 0;
-	uint16 *body = (uint16*)((uint8*)header);
-	uint16 body_size = switch_endian16(header->size);
+// The checksum includes a pseudo header with the IP addresses. The
+// datagram is in one buffer
+uint16 UDP_checksum(PacketBuffer *pb, uint ip_src, uint ip_dst) {
+	UDPHeader *header = (UDPHeader*)pb->data;
+	uint16 size = switch_endian16(header->size);
 
-	for (int i=0; i<body_size/2; i++) {
-		sum += switch_endian16(*body++);
-	}
-
-	if (body_size % 2 == 1) {
-		uint16 tmp = (*body) & 0xFF;
-		sum += switch_endian16(tmp);
-	}
-	
-	// Because the UDP checksum is using the source and dest
-	// IP address for the checksum, we're looking at the IP header
-	IPv4Header *header_ip = (IPv4Header*)((uint8*)header - IPV4_HEADER_SIZE);
+	uint sum = inet_csum_pseudo(ip_src, ip_dst, IPV4_PROTOCOL_UDP, size, 0);
+	return inet_csum_finish(inet_csum_partial(header, umin(size, packet_data_length(pb)), sum));
+}
 
-	sum += switch_endian16(header_ip->ip_src & 0xFFFF);
-	sum += switch_endian16((header_ip->ip_src >> 16) & 0xFFFF);
-	sum += switch_endian16(header_ip->ip_dst & 0xFFFF);
-	sum += switch_endian16((header_ip->ip_dst >> 16) & 0xFFFF);
-	sum += switch_endian16(header->size);
-	sum += IPV4_PROTOCOL_UDP;
+// Adds the UDP header in front of the message in the packet and sends it
+void UDP_send_packet(PacketBuffer *pb, uint ipv4, uint16 sport, uint16 dport) {
+	uint16 size = packet_length(pb) + UDP_HEADER_SIZE;
 
-	while (sum >> 16) {
-		sum = (sum & 0xFFFF) + (sum >> 16);
+	UDPHeader *header = (UDPHeader*)packet_push(pb, UDP_HEADER_SIZE);
+	if (!header) {
+		packet_free(pb);
+		return;
 	}
 
-	return ~switch_endian16((uint16)sum);
-}
-
-uint8 *UDP_create_packet(uint ipv4, uint16 sport, uint16 dport, uint16 size, uint16 *offset) {
-	// Get an IPv4 packet
-	size += UDP_HEADER_SIZE;
-	uint8 *buffer = IPv4_create_packet(IPV4_PROTOCOL_UDP, ipv4, size, offset);
-
-	// Append the UDP header
-	UDPHeader *header = (UDPHeader*)(buffer + *offset);
 	header->sport = switch_endian16(sport);
 	header->dport = switch_endian16(dport);
 	header->size = switch_endian16(size);
 	header->checksum = 0;
 
-	*offset += UDP_HEADER_SIZE;
-	return buffer;
-}
-
-void UDP_send_packet(uint8 *buffer, uint16 size, uint16 message_offset) {
-	// NEED TO: compute the checksum
-	UDPHeader *header = (UDPHeader*)(buffer + message_offset - UDP_HEADER_SIZE);
-	header->checksum = UDP_checksum(header);
+	// With offload, the NIC adds the datagram to the pseudo header
+	if (network_get_checksum_offload() & NET_CSUM_TX) {
+		header->checksum = inet_csum_fold(inet_csum_pseudo(network_get_IPv4(), ipv4, IPV4_PROTOCOL_UDP, size, 0));
+		pb->checksum |= PACKET_CSUM_UDP;
+	}
+	else {
+		// 0 means no checksum, it is sent as 0xFFFF (RFC 768)
+		header->checksum = UDP_checksum(pb, network_get_IPv4(), ipv4);
+		if (!header->checksum) header->checksum = 0xFFFF;
+	}
 
-	IPv4_send_packet(buffer, size, message_offset);
+	IPv4_send_packet(pb, IPV4_PROTOCOL_UDP, ipv4);
 }
 
-void UDP_receive_packet(uint8 *buffer) {
-	UDPHeader *header = (UDPHeader*)buffer;
+void UDP_receive_packet(PacketBuffer *pb) {
+	UDPHeader *header = (UDPHeader*)pb->data;
 	if (is_debug()) printf("[UDP]");
 
+	uint16 size = switch_endian16(header->size);
+	if (size < UDP_HEADER_SIZE || !packet_pull(pb, UDP_HEADER_SIZE)) return;
+
 	switch(switch_endian16(header->dport)) {
 		case UDP_PORT_DHCP:
 			if (is_debug()) printf("[DHCP]\n");
-			DHCP_receive_packet(buffer + UDP_HEADER_SIZE, header->size - UDP_HEADER_SIZE);
+			DHCP_receive_packet(pb->data, size - UDP_HEADER_SIZE);
 			break;
 		case UDP_PORT_DNS:
 			if (is_debug()) printf("[DNS]\n");
-			DNS_receive_packet(buffer + UDP_HEADER_SIZE, header->size - UDP_HEADER_SIZE);
+			DNS_receive_packet(pb->data, size - UDP_HEADER_SIZE);
 			break;
 		default:
 			printf("[%d]\n", switch_endian16(header->dport));
@@ -2,12 +2,13 @@
 #define __UDP_H
 
 #include "libc.h"
+#include "packet.h"
 
 #define UDP_PORT_DHCP		68
 #define UDP_PORT_DNS		53
 
-uint8 *UDP_create_packet(uint ipv4, uint16 sport, uint16 dport, uint16 size, uint16 *offset);
-void UDP_send_packet(uint8 *buffer, uint16 size, uint16 message_offset);
-void UDP_receive_packet(uint8 *buffer);
+void UDP_send_packet(PacketBuffer *pb, uint ipv4, uint16 sport, uint16 dport);
+void UDP_receive_packet(PacketBuffer *pb);
+uint16 UDP_checksum(PacketBuffer *pb, uint ip_src, uint ip_dst);
 
 #endif
@@ -1,8 +1,6 @@
 #include "libc.h"
 #include "syscall.h"
 
-DEFN_SYSCALL1(printf, 0, const char*);
-
 void print(int nb) {
     char text[256];
     int pos = 0;
@@ -13,12 +13,17 @@
 #include "debug_info.h"
 #include "elf.h"
 #include "pci.h"
+#include "packet.h"
+#include "e1000.h"
 #include "dhcp.h"
 #include "network.h"
 #include "icmp.h"
+#include "ipv4.h"
 #include "arp.h"
 #include "dns.h"
 #include "http.h"
+#include "clock.h"
+#include "isr.h"
 
 #define DISK_ERR_DOES_NOT_EXIST	-2
 
@@ -36,6 +41,8 @@ extern void font_viewer();
 extern unsigned char *kernel_debug_line;
 extern unsigned char *kernel_debug_info;
 extern unsigned char *kernel_debug_str;
+extern uint get_ticks();
+extern uint get_timer_hz();
 extern void edit(DirEntry *current_dir, uint dir_cluster, const char *filename);
 extern unsigned char * read_sector(unsigned char *buf, uint addr);
 extern void write_sector(unsigned char *buf, uint addr);
@@ -288,7 +295,9 @@ void shell_run(Window *win, ShellEnv *env, Token *tokens, uint length) {
 	argc = 1;
 	argv[0] = win->buffer + idx;
 
-	elf_exec(filename, argc, (char **)&argv);
+	int pid = elf_exec(filename, argc, (char **)&argv);
+	if (pid < 0) printf_win(win, "Could not run %s\n", filename);
+	else printf_win(win, "Started %s (pid %d)\n", filename, pid);
 }
 
 void shell_edit(Window *win, ShellEnv *env, Token *tokens, uint length) {
@@ -346,13 +355,172 @@ void shell_ls(Window *win, ShellEnv *env, Token *tokens, uint length) {
 void shell_pci(Window *win, ShellEnv *env, Token *tokens, uint length) {
 	PCIDevice *devices = PCI_get_devices();
 	while (devices) {
-		printf_win(win,
-				   "Bus %d Slot %d IRQ %d [%s]: %s\n",
-				   devices->bus, devices->slot, devices->IRQ, devices->vendor_name, devices->device_name);
+		printf_win(win, "%d:%d.%d ", devices->bus, devices->slot, devices->func);
+		if (devices->MSI_vector) printf_win(win, "MSI %d", devices->MSI_vector);
+		else printf_win(win, "IRQ %d", devices->IRQ);
+		printf_win(win, " [%s]: %s\n", devices->vendor_name, devices->device_name);
+
+		for (uint i=0; i<6; i++) {
+			PCIBar *BAR = &devices->BARs[i];
+			if (!BAR->size) continue;
+			printf_win(win, "    BAR%d %s 0x%x size 0x%x\n", i, BAR->flags & PCI_BAR_IO ? "I/O" : "mem", BAR->address, BAR->size);
+		}
 		devices = devices->next;
 	}
 }
 
+void shell_cpus(Window *win, ShellEnv *env, Token *tokens, uint length) {
+	for (uint i=0; i<cpu_count(); i++) {
+		CPU *cpu = cpu_get(i);
+		printf_win(win, "CPU %d (LAPIC %d): %d process(es), running pid %d%s\n",
+				   cpu->id, cpu->LAPIC_id, cpu->nb_processes, cpu->current ? (int)cpu->current->pid : -1,
+				   cpu->current && cpu->current == cpu->idle ? " (idle)" : "");
+	}
+}
+
+// Prints a number right-aligned in a column of the given width (at most 10)
+static void shell_print_column(Window *win, uint nb, uint width) {
+	char number[12];
+	itoa_right(nb, number);
+	win->action->puts(win, number + 11 - width);
+}
+
+// The interrupts received since the boot, and the longest time their
+// handlers took. "-" for the handlers which switch process
+void shell_irqs(Window *win, ShellEnv *env, Token *tokens, uint length) {
+	printf_win(win, "Vector      Count  Max (ns)\n");
+
+	for (uint i=0; i<256; i++) {
+		InterruptStats *stats = interrupt_get_stats(i);
+		if (!stats->count) continue;
+
+		shell_print_column(win, i, 6);
+		shell_print_column(win, stats->count, 11);
+		if (stats->max_cycles) shell_print_column(win, (uint)cycles_to_ns(stats->max_cycles), 10);
+		else win->action->puts(win, "         -");
+		win->action->putcr(win);
+	}
+}
+
+// Prints the CPU accounting of a process. The load is the percentage of
+// the elapsed cycles the process got since the previous refresh
+static void shell_print_process_stats(Window *win, Process *ps, uint64 last_runtime, uint64 elapsed) {
+	ProcessStats *stats = &ps->stats;
+	const char *state = "run ";
+
+	if (ps->flags & PROCESS_EXITED) state = "exit";
+	else if (ps->flags & PROCESS_BLOCKED) state = "lock";
+	else if (ps->flags & PROCESS_POLLING) state = "poll";
+
+	// In 64 bits: udiv64() divides by 32 bits, so both are shifted until
+	// the time elapsed fits
+	uint64 runtime = stats->runtime_cycles - last_runtime;
+	uint usage = 0, shift = 0;
+	while (elapsed >> shift > 0xFFFFFFFF) shift++;
+	if (elapsed >> shift) usage = (uint)udiv64((runtime >> shift) * 100, (uint)(elapsed >> shift), 0);
+
+	if (ps->cpu && ps == ps->cpu->idle) win->action->puts(win, " idle");
+	else shell_print_column(win, ps->pid, 5);
+	shell_print_column(win, ps->cpu ? ps->cpu->id : 0, 4);
+	printf_win(win, "  %s", state);
+	shell_print_column(win, usage, 5);
+	shell_print_column(win, stats->user_ticks, 7);
+	shell_print_column(win, stats->kernel_ticks, 7);
+	shell_print_column(win, stats->runnable_ticks, 7);
+	shell_print_column(win, stats->blocked_ticks, 7);
+	shell_print_column(win, stats->voluntary_switches, 7);
+	shell_print_column(win, stats->involuntary_switches, 7);
+	shell_print_column(win, (uint)(stats->runtime_cycles >> 20), 8);
+	win->action->putcr(win);
+}
+
+// One runtime sample per process and per idle AP
+#define SHELL_NB_SAMPLES	(MAX_PROCESSES + MAX_CPUS)
+
+// Prints one line per process (and per idle AP). last_runtime holds the runtime
+// of each of them at the previous call and gets updated
+static void shell_print_processes(Window *win, uint64 *last_runtime, uint64 elapsed) {
+	uint idx = 0;
+
+	printf_win(win, "  PID CPU  STATE LOAD   USER   KERN RUNNBL BLOCKD    VOL  INVOL  MCYCLES\n");
+
+	for (uint i=0; i<process_count() && idx < SHELL_NB_SAMPLES; i++, idx++) {
+		Process *ps = process_get(i);
+		shell_print_process_stats(win, ps, last_runtime[idx], elapsed);
+		last_runtime[idx] = ps->stats.runtime_cycles;
+	}
+
+	for (uint i=1; i<cpu_count() && idx < SHELL_NB_SAMPLES; i++, idx++) {
+		Process *idle = cpu_get(i)->idle;
+		shell_print_process_stats(win, idle, last_runtime[idx], elapsed);
+		last_runtime[idx] = idle->stats.runtime_cycles;
+	}
+}
+
+void shell_ps(Window *win, ShellEnv *env, Token *tokens, uint length) {
+	uint64 last_runtime[SHELL_NB_SAMPLES];
+	memset(last_runtime, 0, sizeof(last_runtime));
+
+	// Without a previous sample, the CPU usage is since the boot
+	shell_print_processes(win, last_runtime, rdtsc());
+}
+
+// Refreshes the process list every second until a key is pressed
+void shell_top(Window *win, ShellEnv *env, Token *tokens, uint length) {
+	uint64 last_runtime[SHELL_NB_SAMPLES];
+	uint64 last_cycles = rdtsc();
+
+	memset(last_runtime, 0, sizeof(last_runtime));
+
+	for (;;) {
+		uint64 now = rdtsc();
+
+		win->action->cls(win);
+		printf_win(win, "%d processes, %d CPUs - press any key to exit\n\n", process_count(), cpu_count());
+		shell_print_processes(win, last_runtime, now - last_cycles);
+		last_cycles = now;
+
+		uint start = get_ticks();
+		while (get_ticks() - start < get_timer_hz() && !key_pressed());
+
+		if (key_pressed()) {
+			getch();
+			return;
+		}
+	}
+}
+
+// Prints a number with 2 digits
+static void shell_print_2_digits(Window *win, uint nb) {
+	if (nb < 10) win->action->putc(win, '0');
+	printf_win(win, "%d", nb);
+}
+
+void shell_date(Window *win, ShellEnv *env, Token *tokens, uint length) {
+	DateTime date;
+	clock_get_date(&date);
+
+	printf_win(win, "%d-", date.year);
+	shell_print_2_digits(win, date.month);
+	win->action->putc(win, '-');
+	shell_print_2_digits(win, date.day);
+	win->action->putc(win, ' ');
+	shell_print_2_digits(win, date.hour);
+	win->action->putc(win, ':');
+	shell_print_2_digits(win, date.minute);
+	win->action->putc(win, ':');
+	shell_print_2_digits(win, date.second);
+	printf_win(win, " UTC\n");
+}
+
+void shell_uptime(Window *win, ShellEnv *env, Token *tokens, uint length) {
+	uint ms = (uint)udiv64(clock_ns(), 1000000, 0);
+
+	printf_win(win, "Up %d.", ms / 1000);
+	shell_print_2_digits(win, ms % 1000 / 10);
+	printf_win(win, "s, TSC at %d MHz\n", clock_TSC_kHz() / 1000);
+}
+
 void shell_debug(Window *win, ShellEnv *env, Token *tokens, uint length) {
 	if (switch_debug()) win->action->puts(win, "Debug is ON");
 	else win->action->puts(win, "Debug is off");
@@ -406,6 +574,65 @@ void shell_ifconfig(Window *win, ShellEnv *env, Token *tokens, uint length) {
 	printf_win(win, "Gateway:         %i\n", network->router_IPv4);
 	printf_win(win, "DNS Server:      %i\n", network->dns);
 	printf_win(win, "Subnet mask:     %i\n", network->subnet_mask);
+
+	PacketPoolStats *pool = packet_pool_stats();
+	printf_win(win, "Packet buffers:  %d free / %d (%d allocations failed)\n", pool->nb_free, pool->nb_buffers, pool->nb_failed);
+}
+
+static void shell_print_ring(Window *win, const char *name, E1000RingStats *stats) {
+	printf_win(win, "%s ring: %d descriptors, %d in use (max %d)\n", name, stats->size, stats->in_use, stats->max_in_use);
+	printf_win(win, "    %d packets, %d bytes, %d dropped, %d ring full", stats->packets, stats->bytes, stats->dropped, stats->ring_full);
+	if (stats == E1000_get_RX_stats()) printf_win(win, ", %d missed", stats->missed);
+	win->action->putcr(win);
+}
+
+// nic: the e1000 rings and interrupt moderation
+// nic rings <rx> <tx>: resizes the rings
+// nic itr <hz> | rdtr <us> | radv <us> | tidv <us> | tadv <us>: sets a moderation timer
+// nic budget <frames>: frames per poll pass, 0 to receive in the interrupt handler
+// nic promisc <0|1>: receives every frame on the wire, not only ours
+// nic csum <0-7>: what the NIC does, 1 checksums on send, 2 on receive, 4 TCP segmentation
+void shell_nic(Window *win, ShellEnv *env, Token *tokens, uint length) {
+	E1000Moderation moderation = *E1000_get_moderation();
+
+	if (length >= 2 && tokens->code == PARSE_WORD && tokens->next->code == PARSE_NUMBER) {
+		char *param = (char*)tokens->value;
+		uint value = (uint)tokens->next->value;
+
+		if (!strcmp(param, "rings") && length >= 3 && tokens->next->next->code == PARSE_NUMBER)
+			E1000_resize_rings(value, (uint)tokens->next->next->value);
+		else if (!strcmp(param, "budget")) E1000_set_poll_budget(value);
+		else if (!strcmp(param, "promisc")) E1000_set_promiscuous(value != 0);
+		else if (!strcmp(param, "csum")) network_set_checksum_offload(value & (NET_CSUM_TX | NET_CSUM_RX | NET_TSO));
+		else {
+			if (!strcmp(param, "itr")) moderation.ITR_hz = value;
+			else if (!strcmp(param, "rdtr")) moderation.RDTR_us = value;
+			else if (!strcmp(param, "radv")) moderation.RADV_us = value;
+			else if (!strcmp(param, "tidv")) moderation.TIDV_us = value;
+			else if (!strcmp(param, "tadv")) moderation.TADV_us = value;
+			else {
+				printf_win(win, "Unknown parameter %s\n", param);
+				return;
+			}
+			E1000_set_moderation(&moderation);
+		}
+	}
+
+	shell_print_ring(win, "RX", E1000_get_RX_stats());
+	shell_print_ring(win, "TX", E1000_get_TX_stats());
+	printf_win(win, "ITR %d/s, RDTR %d us, RADV %d us, TIDV %d us, TADV %d us\n",
+			   moderation.ITR_hz, moderation.RDTR_us, moderation.RADV_us, moderation.TIDV_us, moderation.TADV_us);
+
+	E1000PollStats *poll = E1000_get_poll_stats();
+	if (poll->budget) printf_win(win, "Polling: %d frames per pass, %d interrupts, %d passes (%d used the whole budget)\n",
+								 poll->budget, poll->interrupts, poll->polls, poll->exhausted);
+	else printf_win(win, "Polling: off\n");
+	if (E1000_get_promiscuous()) printf_win(win, "Promiscuous mode\n");
+
+	uint8 offload = network_get_checksum_offload();
+	printf_win(win, "Checksums: send %s, receive %s, %d errors found in software\n",
+			   offload & NET_CSUM_TX ? "NIC" : "software", offload & NET_CSUM_RX ? "NIC" : "software", IPv4_get_bad_checksums());
+	printf_win(win, "TCP segmentation: %s\n", offload & NET_TSO ? "NIC" : "software");
 }
 
 void shell_stack(Window *win, ShellEnv *env, Token *tokens, uint length) {
@@ -468,6 +695,7 @@ void shell_ping(Window *win, ShellEnv *env, Token *tokens, uint length) {
 
 		uint ps_id = getpid();
 		ICMP_register_reply(ps_id);
+		uint64 start = clock_ns();
 		ICMP_send_packet(*ipv4, ps_id);
 		uint8 status;
 
@@ -475,7 +703,7 @@ void shell_ping(Window *win, ShellEnv *env, Token *tokens, uint length) {
 			status = ICMP_check_response(ps_id);
 			if (status != ICMP_TYPE_ECHO_REQUEST) {
 				if (status == ICMP_TYPE_ECHO_REPLY)
-					printf_win(win, "PONG!\n");
+					printf_win(win, "PONG! (%d us)\n", (uint)udiv64(clock_ns() - start, 1000, 0));
 				else if (status == ICMP_TYPE_ECHO_UNREACHABLE)
 					printf_win(win, "Host unreachable\n");
 				else
@@ -550,7 +778,7 @@ void shell_addr(Window *win, ShellEnv *env, Token *tokens, uint length) {
 
 ////////////////////////////////////////////////////////////////////////
 
-#define NB_CMDS	27
+#define NB_CMDS	34
 
 ShellCmd commands[NB_CMDS] = {
 	{ .name = "help",		.function = shell_help,			.description = "This help\n" },
@@ -561,7 +789,9 @@ ShellCmd commands[NB_CMDS] = {
 	{ .name = "cc",			.function = shell_cc,			.description = "cc <filename>.f: compiles a formula into a native x86 executable\n" },
 	{ .name = "cd",			.function = shell_cd,			.description = "cd <directory>: change directory\n" },
 	{ .name = "cls",		.function = shell_cls,			.description = "Clears the screen\n" },
+	{ .name = "cpus",		.function = shell_cpus,			.description = "Displays the processors and their run queues\n" },
 	{ .name = "countdown",	.function = shell_countdown,	.description = "Countdown (to test multitasking)\n" },
+	{ .name = "date",		.function = shell_date,			.description = "Displays the date and time\n" },
 	{ .name = "debug",		.function = shell_debug,		.description = "Sets the debug mode on/off\n" },
 	{ .name = "dns",		.function = shell_dns,			.description = "dns <hostname>: resolves a hostname into an IP address\n" },
 	{ .name = "edit",		.function = shell_edit,			.description = "edit <filename>: file editor\n" },
@@ -571,15 +801,20 @@ ShellCmd commands[NB_CMDS] = {
 	{ .name = "http",		.function = shell_http,			.description = "Sends an HTTP GET request\n" },
 	{ .name = "https",		.function = shell_https,		.description = "Sends an HTTPS GET request (using TLS 1.2)\n" },
 	{ .name = "ifconfig",	.function = shell_ifconfig,		.description = "Prints the network configuration\n" },
+	{ .name = "irqs",		.function = shell_irqs,			.description = "Displays the interrupt counts and handler latencies\n" },
 	{ .name = "ls",			.function = shell_ls,			.description = "Displays the files in the current directory\n" },
 	{ .name = "load",		.function = shell_load,			.description = "load <filename>: loads a file into memory\n" },
 	{ .name = "mem",		.function = shell_mem,			.description = "mem: shows the main memory addresses\nmem <hex>: memory dump\n" },
+	{ .name = "nic",		.function = shell_nic,			.description = "nic [rings <rx> <tx> | itr <hz> | rdtr <us> ... | budget <n> | promisc <0|1> | csum <0-7>]: e1000 settings\n" },
 	{ .name = "pci",		.function = shell_pci,			.description = "Displays the available PCI devices\n" },
 	{ .name = "ping",		.function = shell_ping,			.description = "Ping another host on the network\n" },
+	{ .name = "ps",			.function = shell_ps,			.description = "Displays the processes and their CPU usage\n" },
 	{ .name = "reboot",		.function = shell_reboot,		.description = "Reboots CHAOS\n" },
 	{ .name = "run",		.function = shell_run,			.description = "run <filename>: runs an ELF executable\n" },
 	{ .name = "redraw",		.function = shell_redraw,		.description = "Redraws the current window\n" },
 	{ .name = "stack",		.function = shell_stack,		.description = "Prints the current stack trace\n" },
+	{ .name = "top",		.function = shell_top,			.description = "Displays the processes and their CPU usage, refreshed every second\n" },
+	{ .name = "uptime",		.function = shell_uptime,		.description = "Displays the time since the boot\n" },
 };
 
 void shell_help(Window *win, ShellEnv *env, Token *tokens, uint length) {
@@ -0,0 +1,42 @@
+#include "libc.h"
+#include "syscall.h"
+#include "vdso.h"
+
+// Measures the cost of a system call: the average number of cycles of
+// syscall_getpid() through SYSENTER and through int 0x80, and of
+// vdso_getpid() which doesn't enter the kernel
+//
+// For reference, the same two entries into Linux (getpid(), 32-bit, on a
+// Xeon VM): about 1600 cycles through int 0x80, about 430 through SYSENTER
+// (the vDSO's __kernel_vsyscall)
+
+#define NB_CALLS    10000
+
+static uint cycles_low() {
+    uint low, high;
+    asm volatile("rdtsc" : "=a"(low), "=d"(high));
+    return low;
+}
+
+static uint measure() {
+    uint start = cycles_low();
+    for (int i=0; i<NB_CALLS; i++) syscall_getpid();
+    return (cycles_low() - start) / NB_CALLS;
+}
+
+static uint measure_vdso() {
+    volatile uint pid;
+    uint start = cycles_low();
+    for (int i=0; i<NB_CALLS; i++) pid = vdso_getpid();
+    return (cycles_low() - start) / NB_CALLS;
+}
+
+void _start(int argc, char **argv) {
+    if (syscall_has_sysenter()) syscall_print_int("sysenter:  %d cycles/call\n", measure());
+    else syscall_printf("sysenter:  not supported\n");
+
+    // Forces the int 0x80 path
+    syscall_use_sysenter = 0;
+    syscall_print_int("int 0x80:  %d cycles/call\n", measure());
+    syscall_print_int("vDSO:      %d cycles/call\n", measure_vdso());
+}
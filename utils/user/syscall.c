@@ -0,0 +1,5 @@
+#include "syscall.h"
+
+// Linked with every program (see the makefile): the state of the stubs of
+// lib/syscall.h, which are all inline
+int syscall_use_sysenter = -1;